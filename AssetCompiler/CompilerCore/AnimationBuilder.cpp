@@ -0,0 +1,494 @@
+#include "AnimationBuilder.h"
+#include "MeshCompiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include <unordered_set>
+
+//open FBX
+#include "../openFBX/openFBX/src/ofbx.h"
+
+namespace AssetCompiler {
+
+    namespace {
+
+        // Smallest-three range: the three kept components lie in [-1/sqrt(2), 1/sqrt(2)]
+        constexpr float ROTATION_RANGE = 0.70710678f;
+
+        // Key frame indices are stored as uint16
+        constexpr uint32_t MAX_FRAMES = 65535;
+
+        glm::dmat4 toMat4(const ofbx::DMatrix& m) {
+            glm::dmat4 out;
+            for (int c = 0; c < 4; ++c) {
+                for (int r = 0; r < 4; ++r) {
+                    out[c][r] = m.m[c * 4 + r];
+                }
+            }
+            return out;
+        }
+
+        /**
+         * @brief Split an affine matrix into translation, rotation and scale
+         * @param scale Mesh scale setting, applied to the translation
+         */
+        void decompose(const glm::dmat4& m, float scale, glm::vec3& t, glm::quat& r, glm::vec3& s) {
+            t = glm::vec3(m[3]) * scale;
+
+            glm::dvec3 axes[3] = { glm::dvec3(m[0]), glm::dvec3(m[1]), glm::dvec3(m[2]) };
+            glm::dvec3 lengths(glm::length(axes[0]), glm::length(axes[1]), glm::length(axes[2]));
+            if (glm::dot(glm::cross(axes[0], axes[1]), axes[2]) < 0.0) lengths.x = -lengths.x;
+
+            glm::dmat3 rotation(1.0);
+            for (int i = 0; i < 3; ++i) {
+                if (std::abs(lengths[i]) > 1e-12) rotation[i] = axes[i] / lengths[i];
+            }
+            s = glm::vec3(lengths);
+            r = glm::normalize(glm::quat(glm::quat_cast(rotation)));
+        }
+
+        /**
+         * @brief Kept frames of one channel
+         * @details Greedy: from the last kept frame, extend the segment as far as linear
+         *          interpolation (normalized for rotations) stays within tolerance of every
+         *          sampled frame it covers. A channel that never leaves tolerance of its first
+         *          frame keeps only that frame.
+         * @param samples One value per frame (vec3 channels leave w at 0)
+         */
+        std::vector<uint32_t> reduceKeys(const std::vector<glm::vec4>& samples, float tolerance, bool rotation) {
+            const uint32_t frameCount = static_cast<uint32_t>(samples.size());
+            std::vector<uint32_t> keys{ 0 };
+
+            auto withinTolerance = [&](const glm::vec4& a, const glm::vec4& b) {
+                const glm::vec4 d = glm::abs(a - b);
+                return std::max(std::max(d.x, d.y), std::max(d.z, d.w)) <= tolerance;
+            };
+
+            bool constant = true;
+            for (uint32_t f = 1; f < frameCount && constant; ++f) {
+                constant = withinTolerance(samples[f], samples[0]);
+            }
+            if (constant || frameCount < 2) return keys;
+
+            auto segmentFits = [&](uint32_t a, uint32_t b) {
+                for (uint32_t f = a + 1; f < b; ++f) {
+                    const float t = static_cast<float>(f - a) / static_cast<float>(b - a);
+                    glm::vec4 v = glm::mix(samples[a], samples[b], t);
+                    if (rotation) v = glm::normalize(v);
+                    if (!withinTolerance(v, samples[f])) return false;
+                }
+                return true;
+            };
+
+            const uint32_t last = frameCount - 1;
+            uint32_t start = 0;
+            while (start < last) {
+                uint32_t end = start + 1;
+                while (end < last && segmentFits(start, end + 1)) ++end;
+                keys.push_back(end);
+                start = end;
+            }
+            return keys;
+        }
+
+        uint16_t quantize(float value, float min, float extent) {
+            if (extent <= 0.0f) return 0;
+            const float n = std::clamp((value - min) / extent, 0.0f, 1.0f);
+            return static_cast<uint16_t>(std::lround(n * 65535.0f));
+        }
+
+        /**
+         * @brief Append a key-reduced, range-quantized vector channel
+         */
+        void compressVectorChannel(const std::vector<glm::vec4>& samples, float tolerance,
+            CompressedClip& out) {
+            const std::vector<uint32_t> keys = reduceKeys(samples, tolerance, false);
+
+            CompiledAnimationChannel channel;
+            channel.firstKey = static_cast<uint32_t>(out.keyFrames.size());
+            channel.keyCount = static_cast<uint32_t>(keys.size());
+
+            glm::vec3 lo(std::numeric_limits<float>::max());
+            glm::vec3 hi(std::numeric_limits<float>::lowest());
+            for (uint32_t k : keys) {
+                lo = glm::min(lo, glm::vec3(samples[k]));
+                hi = glm::max(hi, glm::vec3(samples[k]));
+            }
+            for (int i = 0; i < 3; ++i) {
+                channel.min[i] = lo[i];
+                channel.extent[i] = hi[i] - lo[i];
+            }
+
+            for (uint32_t k : keys) {
+                out.keyFrames.push_back(static_cast<uint16_t>(k));
+                for (int i = 0; i < 3; ++i) {
+                    out.keyValues.push_back(quantize(samples[k][i], channel.min[i], channel.extent[i]));
+                }
+            }
+            out.channels.push_back(channel);
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // PUBLIC API
+    // ============================================================================
+
+    bool AnimationBuilder::build(const ofbx::IScene& scene,
+        const MeshSettingsCompiler& settings,
+        SkeletonData& out) {
+        out = SkeletonData{};
+
+        if (!extractSkeleton(scene, settings.scale, out)) {
+            return false;
+        }
+        log("Skeleton: %zu joints", out.joints.size());
+
+        const float sampleRate = std::max(1.0f, settings.animationSampleRate);
+        for (int i = 0; i < scene.getAnimationStackCount(); ++i) {
+            SampledClip sampled;
+            if (!sampleClip(scene, i, settings.scale, sampleRate, sampled)) {
+                continue;
+            }
+
+            CompressedClip compressed;
+            compressClip(sampled, settings, compressed);
+
+            const size_t rawSize = sampled.frameCount * out.joints.size() * 10 * sizeof(float);
+            const size_t packedSize = compressed.channels.size() * sizeof(CompiledAnimationChannel) +
+                (compressed.keyFrames.size() + compressed.keyValues.size()) * sizeof(uint16_t);
+            log("Clip '%s': %u frames, %zu keys, %.1f KB -> %.1f KB",
+                compressed.name.c_str(), compressed.frameCount, compressed.keyFrames.size(),
+                rawSize / 1024.0f, packedSize / 1024.0f);
+
+            out.clips.push_back(std::move(compressed));
+        }
+
+        return true;
+    }
+
+    void AnimationBuilder::gatherInfluences(const ofbx::Mesh& mesh,
+        std::vector<glm::u16vec4>& joints,
+        std::vector<glm::vec4>& weights) {
+        const ofbx::GeometryData& geom = mesh.getGeometryData();
+        const int controlPoints = geom.getPositions().values_count;
+
+        // Default: follow the first joint (meshes without a skin move with the root)
+        joints.assign(static_cast<size_t>(std::max(controlPoints, 0)), glm::u16vec4(0));
+        weights.assign(joints.size(), glm::vec4(0.0f));
+
+        const ofbx::Skin* skin = mesh.getSkin();
+        for (int c = 0; skin && c < skin->getClusterCount(); ++c) {
+            const ofbx::Cluster* cluster = skin->getCluster(c);
+            const int32_t joint = findJoint(cluster->getLink());
+            if (joint < 0) continue;
+
+            const int* indices = cluster->getIndices();
+            const double* clusterWeights = cluster->getWeights();
+            const int count = std::min(cluster->getIndicesCount(), cluster->getWeightsCount());
+            for (int i = 0; i < count; ++i) {
+                const int cp = indices[i];
+                const float w = static_cast<float>(clusterWeights[i]);
+                if (cp < 0 || cp >= controlPoints || w <= 0.0f) continue;
+
+                // Keep the four largest: replace the smallest slot if this one is bigger
+                glm::vec4& slotWeights = weights[cp];
+                int smallest = 0;
+                for (int k = 1; k < 4; ++k) {
+                    if (slotWeights[k] < slotWeights[smallest]) smallest = k;
+                }
+                if (w > slotWeights[smallest]) {
+                    slotWeights[smallest] = w;
+                    joints[cp][smallest] = static_cast<uint16_t>(joint);
+                }
+            }
+        }
+
+        for (glm::vec4& w : weights) {
+            const float total = w.x + w.y + w.z + w.w;
+            w = total > 0.0f ? w / total : glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
+        }
+    }
+
+    void AnimationBuilder::compressClip(const SampledClip& clip, const MeshSettingsCompiler& settings,
+        CompressedClip& out) {
+        out = CompressedClip{};
+        out.name = clip.name;
+        out.sampleRate = clip.sampleRate;
+        out.frameCount = clip.frameCount;
+        out.duration = clip.frameCount > 1 ? static_cast<float>(clip.frameCount - 1) / clip.sampleRate : 0.0f;
+        if (clip.frameCount == 0) return;
+
+        const size_t jointCount = clip.rotations.size() / clip.frameCount;
+        std::vector<glm::vec4> samples(clip.frameCount);
+
+        for (size_t j = 0; j < jointCount; ++j) {
+            // Rotation: keys on the continuous (sign-aligned) curve, then smallest-three
+            for (uint32_t f = 0; f < clip.frameCount; ++f) {
+                const glm::quat& q = clip.rotations[f * jointCount + j];
+                samples[f] = glm::vec4(q.x, q.y, q.z, q.w);
+                if (f > 0 && glm::dot(samples[f], samples[f - 1]) < 0.0f) samples[f] = -samples[f];
+            }
+            const std::vector<uint32_t> keys = reduceKeys(samples, settings.animationRotationTolerance, true);
+
+            CompiledAnimationChannel rotation;
+            rotation.firstKey = static_cast<uint32_t>(out.keyFrames.size());
+            rotation.keyCount = static_cast<uint32_t>(keys.size());
+            for (uint32_t k : keys) {
+                uint16_t encoded[3];
+                encodeRotation(glm::quat(samples[k].w, samples[k].x, samples[k].y, samples[k].z), encoded);
+                out.keyFrames.push_back(static_cast<uint16_t>(k));
+                out.keyValues.insert(out.keyValues.end(), encoded, encoded + 3);
+            }
+            out.channels.push_back(rotation);
+
+            // Translation
+            for (uint32_t f = 0; f < clip.frameCount; ++f) {
+                samples[f] = glm::vec4(clip.translations[f * jointCount + j], 0.0f);
+            }
+            compressVectorChannel(samples, settings.animationTranslationTolerance, out);
+
+            // Scale
+            for (uint32_t f = 0; f < clip.frameCount; ++f) {
+                samples[f] = glm::vec4(clip.scales[f * jointCount + j], 0.0f);
+            }
+            compressVectorChannel(samples, settings.animationScaleTolerance, out);
+        }
+    }
+
+    void AnimationBuilder::encodeRotation(const glm::quat& q, uint16_t* out) {
+        float v[4] = { q.x, q.y, q.z, q.w };
+
+        uint32_t largest = 0;
+        for (uint32_t i = 1; i < 4; ++i) {
+            if (std::abs(v[i]) > std::abs(v[largest])) largest = i;
+        }
+
+        // q and -q are the same rotation: make the dropped component positive
+        const float sign = v[largest] < 0.0f ? -1.0f : 1.0f;
+        float kept[3];
+        for (uint32_t i = 0, k = 0; i < 4; ++i) {
+            if (i != largest) kept[k++] = std::clamp(v[i] * sign / ROTATION_RANGE, -1.0f, 1.0f) * 0.5f + 0.5f;
+        }
+
+        out[0] = static_cast<uint16_t>(std::lround(kept[0] * 32767.0f) | ((largest & 1u) << 15));
+        out[1] = static_cast<uint16_t>(std::lround(kept[1] * 32767.0f) | ((largest >> 1) << 15));
+        out[2] = static_cast<uint16_t>(std::lround(kept[2] * 65535.0f));
+    }
+
+    // ============================================================================
+    // EXTRACTION
+    // ============================================================================
+
+    bool AnimationBuilder::extractSkeleton(const ofbx::IScene& scene, float scale, SkeletonData& out) {
+        jointNodes_.clear();
+        meshToModel_ = glm::dmat4(1.0);
+
+        std::vector<glm::dmat4> clusterInverseBind;
+        std::vector<bool> hasCluster;
+        bool foundSkin = false;
+
+        // Every cluster link is a joint, whatever its node type
+        std::unordered_set<const ofbx::Object*> links;
+        for (int m = 0; m < scene.getMeshCount(); ++m) {
+            const ofbx::Skin* skin = scene.getMesh(m)->getSkin();
+            for (int c = 0; skin && c < skin->getClusterCount(); ++c) {
+                if (skin->getCluster(c)->getLink()) links.insert(skin->getCluster(c)->getLink());
+            }
+        }
+
+        // Add a node after the joints above it (links and limb nodes), so parents come first
+        auto addJoint = [&](const ofbx::Object* node, auto& self) -> void {
+            if (!node || findJoint(node) >= 0) return;
+            const ofbx::Object* parent = node->getParent();
+            if (parent && (parent->getType() == ofbx::Object::Type::LIMB_NODE || links.count(parent))) {
+                self(parent, self);
+            }
+            jointNodes_.push_back(node);
+            clusterInverseBind.push_back(glm::dmat4(1.0));
+            hasCluster.push_back(false);
+        };
+
+        for (int m = 0; m < scene.getMeshCount(); ++m) {
+            const ofbx::Skin* skin = scene.getMesh(m)->getSkin();
+            if (!skin) continue;
+
+            for (int c = 0; c < skin->getClusterCount(); ++c) {
+                const ofbx::Cluster* cluster = skin->getCluster(c);
+                const ofbx::Object* link = cluster->getLink();
+                if (!link) continue;
+
+                // Model space is the space of the first skinned mesh at bind time
+                if (!foundSkin) {
+                    meshToModel_ = glm::inverse(toMat4(cluster->getTransformMatrix()));
+                    foundSkin = true;
+                }
+
+                addJoint(link, addJoint);
+                const int32_t joint = findJoint(link);
+                if (!hasCluster[joint]) {
+                    clusterInverseBind[joint] = glm::inverse(toMat4(cluster->getTransformLinkMatrix())) *
+                        toMat4(cluster->getTransformMatrix());
+                    hasCluster[joint] = true;
+                }
+            }
+        }
+
+        if (jointNodes_.empty()) {
+            return false;
+        }
+        if (jointNodes_.size() > 0xffff) {
+            log("WARNING: %zu joints, only 65535 are supported", jointNodes_.size());
+            jointNodes_.clear();
+            return false;
+        }
+
+        out.joints.resize(jointNodes_.size());
+        for (size_t j = 0; j < jointNodes_.size(); ++j) {
+            const ofbx::Object* node = jointNodes_[j];
+            SkeletonJoint& joint = out.joints[j];
+
+            joint.name = node->name;
+            joint.parent = findJoint(node->getParent());
+
+            glm::dmat4 local = toMat4(node->getLocalTransform());
+            if (joint.parent < 0) local = rootPrefix(node) * local;
+            decompose(local, scale, joint.translation, joint.rotation, joint.scale);
+
+            // Joints without a cluster: bind pose is the rest pose
+            glm::dmat4 inverseBind = hasCluster[j] ? clusterInverseBind[j] :
+                glm::inverse(meshToModel_ * toMat4(node->getGlobalTransform()));
+            inverseBind[3] = glm::dvec4(glm::dvec3(inverseBind[3]) * static_cast<double>(scale), 1.0);
+            joint.inverseBind = glm::mat4(inverseBind);
+        }
+
+        return true;
+    }
+
+    bool AnimationBuilder::sampleClip(const ofbx::IScene& scene, int stackIndex, float scale, float sampleRate,
+        SampledClip& out) {
+        const ofbx::AnimationStack* stack = scene.getAnimationStack(stackIndex);
+        const ofbx::AnimationLayer* layer = stack ? stack->getLayer(0) : nullptr;
+        if (!layer) return false;
+
+        struct JointCurves {
+            const ofbx::AnimationCurveNode* translation;
+            const ofbx::AnimationCurveNode* rotation;
+            const ofbx::AnimationCurveNode* scaling;
+        };
+
+        // Curves per joint, and the key range as a fallback for the clip length
+        const size_t jointCount = jointNodes_.size();
+        std::vector<JointCurves> curves(jointCount);
+        bool animated = false;
+        double keyStart = std::numeric_limits<double>::max();
+        double keyEnd = std::numeric_limits<double>::lowest();
+
+        for (size_t j = 0; j < jointCount; ++j) {
+            const ofbx::Object& node = *jointNodes_[j];
+            curves[j] = { layer->getCurveNode(node, "Lcl Translation"),
+                layer->getCurveNode(node, "Lcl Rotation"),
+                layer->getCurveNode(node, "Lcl Scaling") };
+
+            for (const ofbx::AnimationCurveNode* curveNode : { curves[j].translation, curves[j].rotation, curves[j].scaling }) {
+                if (!curveNode) continue;
+                animated = true;
+                for (int axis = 0; axis < 3; ++axis) {
+                    const ofbx::AnimationCurve* curve = curveNode->getCurve(axis);
+                    if (!curve || curve->getKeyCount() == 0) continue;
+                    keyStart = std::min(keyStart, ofbx::fbxTimeToSeconds(curve->getKeyTime()[0]));
+                    keyEnd = std::max(keyEnd, ofbx::fbxTimeToSeconds(curve->getKeyTime()[curve->getKeyCount() - 1]));
+                }
+            }
+        }
+        if (!animated) return false;
+
+        // Clip length: the take, else the scene time span, else the keys
+        double start = 0.0;
+        double end = 0.0;
+        if (const ofbx::TakeInfo* take = scene.getTakeInfo(stack->name)) {
+            start = take->local_time_from;
+            end = take->local_time_to;
+        }
+        if (end <= start && scene.getGlobalSettings()) {
+            start = scene.getGlobalSettings()->TimeSpanStart;
+            end = scene.getGlobalSettings()->TimeSpanStop;
+        }
+        if (end <= start && keyEnd > keyStart) {
+            start = keyStart;
+            end = keyEnd;
+        }
+
+        const double frames = std::floor(std::max(0.0, end - start) * sampleRate + 0.5);
+        out.name = stack->name;
+        out.sampleRate = sampleRate;
+        out.frameCount = static_cast<uint32_t>(std::min<double>(frames + 1.0, MAX_FRAMES));
+        if (frames + 1.0 > MAX_FRAMES) {
+            log("WARNING: Clip '%s' truncated to %u frames", stack->name, MAX_FRAMES);
+        }
+
+        out.translations.resize(out.frameCount * jointCount);
+        out.rotations.resize(out.frameCount * jointCount);
+        out.scales.resize(out.frameCount * jointCount);
+
+        std::vector<glm::dmat4> prefixes(jointCount, glm::dmat4(1.0));
+        for (size_t j = 0; j < jointCount; ++j) {
+            if (findJoint(jointNodes_[j]->getParent()) < 0) prefixes[j] = rootPrefix(jointNodes_[j]);
+        }
+
+        for (uint32_t f = 0; f < out.frameCount; ++f) {
+            const double time = std::min(end, start + static_cast<double>(f) / sampleRate);
+            for (size_t j = 0; j < jointCount; ++j) {
+                const ofbx::Object& node = *jointNodes_[j];
+                const JointCurves& c = curves[j];
+
+                const ofbx::DVec3 t = c.translation ? c.translation->getNodeLocalTransform(time) : node.getLocalTranslation();
+                const ofbx::DVec3 r = c.rotation ? c.rotation->getNodeLocalTransform(time) : node.getLocalRotation();
+                const ofbx::DVec3 s = c.scaling ? c.scaling->getNodeLocalTransform(time) : node.getLocalScaling();
+
+                const glm::dmat4 local = prefixes[j] * toMat4(node.evalLocal(t, r, s));
+                const size_t sample = f * jointCount + j;
+                decompose(local, scale, out.translations[sample], out.rotations[sample], out.scales[sample]);
+            }
+        }
+
+        return true;
+    }
+
+    // ============================================================================
+    // HELPERS
+    // ============================================================================
+
+    int32_t AnimationBuilder::findJoint(const ofbx::Object* node) const {
+        if (!node) return -1;
+        for (size_t j = 0; j < jointNodes_.size(); ++j) {
+            if (jointNodes_[j] == node) return static_cast<int32_t>(j);
+        }
+        return -1;
+    }
+
+    glm::dmat4 AnimationBuilder::rootPrefix(const ofbx::Object* root) const {
+        // Non-joint ancestors (armature objects, unit conversion nodes) are baked into
+        // the root, and everything is expressed in the skinned mesh's space
+        const ofbx::Object* parent = root->getParent();
+        const glm::dmat4 parentGlobal = parent ? toMat4(parent->getGlobalTransform()) : glm::dmat4(1.0);
+        return meshToModel_ * parentGlobal;
+    }
+
+    void AnimationBuilder::log(const char* format, ...) {
+        if (!verbose_) return;
+
+        char buffer[1024];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+
+        std::cout << "  [AnimationBuilder] " << buffer << "\n";
+    }
+
+} //end of namespace AssetCompiler
@@ -0,0 +1,209 @@
+/*
+* @file AnimationBuilder.h
+* @brief Skeleton, skin weight and animation clip extraction for compiled meshes
+* @details Builds the skeleton section stored after the collision data in a compiled
+*          .mesh file:
+*          - the joint hierarchy of every skin in the FBX (cluster links and the limb
+*            nodes between them), with bind poses and inverse bind matrices
+*          - up to four joint influences per vertex
+*          - every animation stack as a clip, sampled at a fixed rate, then key-reduced
+*            (frames that linear interpolation reproduces within tolerance are dropped)
+*            and quantized (smallest-three rotations, range-quantized 16-bit vectors)
+* @author
+* @date
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_precision.hpp>
+
+namespace ofbx {
+	struct IScene;
+	struct Mesh;
+	struct Object;
+}
+
+namespace AssetCompiler {
+
+	struct MeshData;
+	struct MeshSettingsCompiler;
+
+	/**
+	 * @brief One joint of an extracted skeleton
+	 */
+	struct SkeletonJoint {
+		std::string name;
+		int32_t parent = -1;					// Earlier joint index, -1 for roots
+		glm::vec3 translation = glm::vec3(0.0f);	// Bind-pose local transform
+		glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+		glm::vec3 scale = glm::vec3(1.0f);
+		glm::mat4 inverseBind = glm::mat4(1.0f);	// Mesh space to joint space
+	};
+
+	/**
+	 * @brief Uncompressed clip: one local pose per joint per frame
+	 * @details Sample (frame * jointCount + joint).
+	 */
+	struct SampledClip {
+		std::string name;
+		float sampleRate = 30.0f;
+		uint32_t frameCount = 0;
+		std::vector<glm::vec3> translations;
+		std::vector<glm::quat> rotations;
+		std::vector<glm::vec3> scales;
+	};
+
+	/**
+	 * @brief Binary header of one key-reduced channel (mirrors Engine::CompiledAnimationChannel)
+	 */
+	struct CompiledAnimationChannel {
+		uint32_t firstKey = 0;
+		uint32_t keyCount = 0;
+		float min[3] = {};		// Dequantization range (translation/scale)
+		float extent[3] = {};
+	};
+
+	/**
+	 * @brief Compressed clip, ready to be written
+	 * @details Three channels per joint: rotation, translation, scale.
+	 */
+	struct CompressedClip {
+		std::string name;
+		float duration = 0.0f;
+		float sampleRate = 30.0f;
+		uint32_t frameCount = 0;
+		std::vector<CompiledAnimationChannel> channels;
+		std::vector<uint16_t> keyFrames;
+		std::vector<uint16_t> keyValues;		// 3 per key
+	};
+
+	/**
+	 * @brief Skeleton and clips generated for one mesh
+	 */
+	struct SkeletonData {
+		std::vector<SkeletonJoint> joints;
+		std::vector<CompressedClip> clips;
+
+		bool isEmpty() const {
+			return joints.empty();
+		}
+	};
+
+	/**
+	 * @brief Binary header of the skeleton section
+	 * @details Follows the collision section (or the indices) of a compiled mesh when
+	 *          CompiledMeshHeader::hasSkeleton is set. Layout after the header:
+	 *          CompiledJoint joints[jointCount], CompiledSkinVertex skin[vertexCount], then per
+	 *          clip a CompiledClipHeader, CompiledAnimationChannel channels[channelCount],
+	 *          uint16 keyFrames[keyCount], uint16 keyValues[keyCount * 3]
+	 */
+	struct CompiledSkeletonHeader {
+		char magic[4] = { 'S', 'K', 'N', '\0' };	// Magic number "SKN"
+		uint32_t version = 1;
+
+		uint32_t jointCount = 0;
+		uint32_t clipCount = 0;
+		uint32_t vertexCount = 0;
+
+		uint32_t reserved[3] = { 0 };
+	};
+
+	struct CompiledJoint {
+		char name[64] = {};
+		int32_t parent = -1;
+		float translation[3] = {};
+		float rotation[4] = { 0, 0, 0, 1 };		// x, y, z, w
+		float scale[3] = { 1, 1, 1 };
+		float inverseBind[16] = {};				// Column-major
+	};
+
+	struct CompiledSkinVertex {
+		uint16_t joints[4] = {};
+		uint8_t weights[4] = {};				// Sum to 255
+	};
+
+	struct CompiledClipHeader {
+		char name[64] = {};
+		float duration = 0.0f;
+		float sampleRate = 30.0f;
+		uint32_t frameCount = 0;
+		uint32_t channelCount = 0;
+		uint32_t keyCount = 0;
+		uint32_t reserved = 0;
+	};
+
+	class AnimationBuilder {
+	public:
+		explicit AnimationBuilder(bool verbose = false) : verbose_(verbose) {}
+
+		/**
+		* @brief Extract the skeleton and all clips of a scene
+		* @param scene Loaded FBX scene
+		* @param settings Scale (applied to joint translations) and sampling/compression settings
+		* @param out Receives joints and compressed clips
+		* @return false if no mesh in the scene is skinned
+		*/
+		bool build(const ofbx::IScene& scene,
+			const MeshSettingsCompiler& settings,
+			SkeletonData& out);
+
+		/**
+		* @brief Joint influences of every control point of a mesh
+		* @details Keeps the four largest weights and normalizes them. Control points
+		*          without influences (or meshes without a skin) follow the first joint.
+		*          Call after build, with the same scene.
+		* @param joints Receives four joint indices per control point
+		* @param weights Receives four weights per control point
+		*/
+		void gatherInfluences(const ofbx::Mesh& mesh,
+			std::vector<glm::u16vec4>& joints,
+			std::vector<glm::vec4>& weights);
+
+		/**
+		* @brief Key-reduce and quantize a sampled clip
+		* @details Independent of FBX, so compression can be checked on synthetic data.
+		*/
+		void compressClip(const SampledClip& clip, const MeshSettingsCompiler& settings, CompressedClip& out);
+
+		/**
+		* @brief Encode a unit quaternion as smallest-three (3 x uint16)
+		*/
+		static void encodeRotation(const glm::quat& q, uint16_t* out);
+
+	private:
+		/**
+		* @brief Collect cluster links and the limb nodes between them, parents first
+		*/
+		bool extractSkeleton(const ofbx::IScene& scene, float scale, SkeletonData& out);
+
+		/**
+		* @brief Sample one animation stack at a fixed rate
+		* @return false if the stack animates none of the joints
+		*/
+		bool sampleClip(const ofbx::IScene& scene, int stackIndex, float scale, float sampleRate,
+			SampledClip& out);
+
+		/**
+		* @brief Joint index of an FBX node, -1 if it is not part of the skeleton
+		*/
+		int32_t findJoint(const ofbx::Object* node) const;
+
+		/**
+		* @brief Transform baked into a root joint: its non-joint ancestors, in model space
+		*/
+		glm::dmat4 rootPrefix(const ofbx::Object* root) const;
+
+		std::vector<const ofbx::Object*> jointNodes_;	// Parallel to SkeletonData::joints
+		glm::dmat4 meshToModel_ = glm::dmat4(1.0);		// FBX world to the skinned mesh's bind space
+
+		bool verbose_ = false;
+
+		void log(const char* format, ...);
+	};
+
+}// end of namespace AssetCompiler
@@ -0,0 +1,658 @@
+#include "CollisionBuilder.h"
+#include "MeshCompiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace AssetCompiler {
+
+    namespace {
+
+        // ========================================================================
+        // CONVEX HULL
+        // ========================================================================
+
+        // The decomposition works on voxel centres and corners, i.e. small integer coordinates,
+        // so every orientation test below is exact in double precision.
+
+        struct HullFace {
+            int a, b, c;
+            glm::dvec3 normal;  // Unnormalized, points outwards
+        };
+
+        /**
+         * @brief Incremental 3D convex hull
+         * @param points Input points (integer valued)
+         * @param usedVertices Optional, receives indices of the points on the hull
+         * @return Hull volume, 0 if the points are coplanar
+         */
+        double convexHull(const std::vector<glm::dvec3>& points, std::vector<int>* usedVertices) {
+            const int count = static_cast<int>(points.size());
+            if (count < 4) return 0.0;
+
+            // Initial tetrahedron from extreme points
+            int i0 = 0;
+            for (int i = 1; i < count; ++i) {
+                if (points[i].x < points[i0].x) i0 = i;
+            }
+
+            int i1 = i0;
+            double best = 0.0;
+            for (int i = 0; i < count; ++i) {
+                glm::dvec3 d = points[i] - points[i0];
+                double dist = glm::dot(d, d);
+                if (dist > best) { best = dist; i1 = i; }
+            }
+
+            int i2 = i0;
+            best = 0.0;
+            glm::dvec3 line = points[i1] - points[i0];
+            for (int i = 0; i < count; ++i) {
+                glm::dvec3 c = glm::cross(points[i] - points[i0], line);
+                double dist = glm::dot(c, c);
+                if (dist > best) { best = dist; i2 = i; }
+            }
+
+            int i3 = i0;
+            best = 0.0;
+            glm::dvec3 planeNormal = glm::cross(points[i1] - points[i0], points[i2] - points[i0]);
+            for (int i = 0; i < count; ++i) {
+                double dist = std::abs(glm::dot(planeNormal, points[i] - points[i0]));
+                if (dist > best) { best = dist; i3 = i; }
+            }
+
+            if (best <= 0.0) return 0.0;
+
+            std::vector<HullFace> faces;
+            std::vector<char> alive;
+            faces.reserve(256);
+            alive.reserve(256);
+
+            auto addFace = [&](int a, int b, int c) {
+                HullFace face{ a, b, c, glm::cross(points[b] - points[a], points[c] - points[a]) };
+                faces.push_back(face);
+                alive.push_back(1);
+            };
+
+            // Orient each face away from the vertex opposite to it
+            const int simplex[4] = { i0, i1, i2, i3 };
+            const int tri[4][4] = { {0, 1, 2, 3}, {0, 1, 3, 2}, {0, 2, 3, 1}, {1, 2, 3, 0} };
+            for (const auto& t : tri) {
+                int a = simplex[t[0]], b = simplex[t[1]], c = simplex[t[2]];
+                glm::dvec3 n = glm::cross(points[b] - points[a], points[c] - points[a]);
+                if (glm::dot(n, points[simplex[t[3]]] - points[a]) > 0.0) std::swap(b, c);
+                addFace(a, b, c);
+            }
+
+            std::vector<int> visible;
+            std::unordered_set<uint64_t> edges;
+            std::vector<std::pair<int, int>> horizon;
+            size_t deadFaces = 0;
+
+            auto edgeKey = [](int from, int to) {
+                return (static_cast<uint64_t>(static_cast<uint32_t>(from)) << 32) | static_cast<uint32_t>(to);
+            };
+
+            for (int p = 0; p < count; ++p) {
+                if (p == i0 || p == i1 || p == i2 || p == i3) continue;
+
+                visible.clear();
+                for (int f = 0; f < static_cast<int>(faces.size()); ++f) {
+                    if (alive[f] && glm::dot(faces[f].normal, points[p] - points[faces[f].a]) > 0.0) {
+                        visible.push_back(f);
+                    }
+                }
+                if (visible.empty()) continue;
+
+                // Horizon: edges of visible faces whose twin is not on a visible face
+                edges.clear();
+                for (int f : visible) {
+                    const HullFace& face = faces[f];
+                    edges.insert(edgeKey(face.a, face.b));
+                    edges.insert(edgeKey(face.b, face.c));
+                    edges.insert(edgeKey(face.c, face.a));
+                }
+
+                horizon.clear();
+                for (int f : visible) {
+                    const HullFace& face = faces[f];
+                    const int v[3] = { face.a, face.b, face.c };
+                    for (int e = 0; e < 3; ++e) {
+                        int from = v[e], to = v[(e + 1) % 3];
+                        if (edges.find(edgeKey(to, from)) == edges.end()) {
+                            horizon.emplace_back(from, to);
+                        }
+                    }
+                    alive[f] = 0;
+                }
+                deadFaces += visible.size();
+
+                for (const auto& edge : horizon) {
+                    addFace(edge.first, edge.second, p);
+                }
+
+                // Compact once most of the face list is dead
+                if (deadFaces > faces.size() / 2) {
+                    size_t write = 0;
+                    for (size_t f = 0; f < faces.size(); ++f) {
+                        if (alive[f]) faces[write++] = faces[f];
+                    }
+                    faces.resize(write);
+                    alive.assign(write, 1);
+                    deadFaces = 0;
+                }
+            }
+
+            double volume = 0.0;
+            std::vector<char> used(usedVertices ? count : 0, 0);
+            for (size_t f = 0; f < faces.size(); ++f) {
+                if (!alive[f]) continue;
+                const HullFace& face = faces[f];
+                volume += glm::dot(points[face.a], glm::cross(points[face.b], points[face.c]));
+                if (usedVertices) {
+                    used[face.a] = used[face.b] = used[face.c] = 1;
+                }
+            }
+
+            if (usedVertices) {
+                usedVertices->clear();
+                for (int i = 0; i < count; ++i) {
+                    if (used[i]) usedVertices->push_back(i);
+                }
+            }
+
+            return volume / 6.0;
+        }
+
+        // ========================================================================
+        // VOXEL GRID
+        // ========================================================================
+
+        /**
+         * @brief Solid voxelization of a mesh with one empty voxel of padding on each side
+         */
+        struct VoxelGrid {
+            glm::ivec3 dims{ 0 };
+            glm::vec3 origin{ 0.0f };   // World position of voxel (0,0,0)'s min corner
+            float voxelSize = 1.0f;
+            std::vector<int> label;     // -1 = empty, otherwise owning cluster
+
+            int index(int x, int y, int z) const { return x + dims.x * (y + dims.y * z); }
+            glm::ivec3 coord(int i) const { return { i % dims.x, (i / dims.x) % dims.y, i / (dims.x * dims.y) }; }
+
+            bool build(const MeshData& mesh, int resolution, const glm::vec3& boundsMin, const glm::vec3& boundsMax) {
+                glm::vec3 extent = boundsMax - boundsMin;
+                float longest = std::max(extent.x, std::max(extent.y, extent.z));
+                if (longest <= 0.0f) return false;
+
+                voxelSize = longest / static_cast<float>(resolution);
+                for (int k = 0; k < 3; ++k) {
+                    dims[k] = std::max(1, static_cast<int>(std::ceil(extent[k] / voxelSize))) + 2;
+                }
+                origin = boundsMin - glm::vec3(voxelSize);
+
+                // Surface: sample every triangle densely enough to touch each voxel it crosses
+                std::vector<char> surface(static_cast<size_t>(dims.x) * dims.y * dims.z, 0);
+                auto toGrid = [&](const glm::vec3& p) { return (p - origin) / voxelSize; };
+                auto mark = [&](const glm::vec3& g) {
+                    int x = std::clamp(static_cast<int>(g.x), 1, dims.x - 2);
+                    int y = std::clamp(static_cast<int>(g.y), 1, dims.y - 2);
+                    int z = std::clamp(static_cast<int>(g.z), 1, dims.z - 2);
+                    surface[index(x, y, z)] = 1;
+                };
+
+                const size_t vertexCount = mesh.positions.size();
+                for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+                    uint32_t i0 = mesh.indices[i], i1 = mesh.indices[i + 1], i2 = mesh.indices[i + 2];
+                    if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) continue;
+
+                    glm::vec3 a = toGrid(mesh.positions[i0]);
+                    glm::vec3 b = toGrid(mesh.positions[i1]);
+                    glm::vec3 c = toGrid(mesh.positions[i2]);
+                    float edge = std::max(glm::length(b - a), std::max(glm::length(c - b), glm::length(a - c)));
+                    int steps = std::max(1, static_cast<int>(std::ceil(edge * 2.0f)));
+
+                    for (int u = 0; u <= steps; ++u) {
+                        for (int v = 0; v <= steps - u; ++v) {
+                            float fu = static_cast<float>(u) / steps;
+                            float fv = static_cast<float>(v) / steps;
+                            mark(a + (b - a) * fu + (c - a) * fv);
+                        }
+                    }
+                }
+
+                // Interior: everything the outside flood fill cannot reach
+                std::vector<char> outside(surface.size(), 0);
+                std::vector<int> stack;
+                stack.push_back(0);
+                outside[0] = 1;
+                while (!stack.empty()) {
+                    int i = stack.back();
+                    stack.pop_back();
+                    glm::ivec3 c = coord(i);
+                    const glm::ivec3 offsets[6] = { {1,0,0}, {-1,0,0}, {0,1,0}, {0,-1,0}, {0,0,1}, {0,0,-1} };
+                    for (const auto& o : offsets) {
+                        glm::ivec3 n = c + o;
+                        if (n.x < 0 || n.y < 0 || n.z < 0 || n.x >= dims.x || n.y >= dims.y || n.z >= dims.z) continue;
+                        int ni = index(n.x, n.y, n.z);
+                        if (outside[ni] || surface[ni]) continue;
+                        outside[ni] = 1;
+                        stack.push_back(ni);
+                    }
+                }
+
+                label.assign(surface.size(), -1);
+                for (size_t i = 0; i < label.size(); ++i) {
+                    if (!outside[i]) label[i] = 0;
+                }
+                return true;
+            }
+        };
+
+        /**
+         * @brief A set of voxels that will become one convex piece
+         */
+        struct Cluster {
+            std::vector<int> voxels;
+            double hullVolume = 0.0;    // Hull of the voxel corners, in voxels
+            double waste = 0.0;         // Estimated hull volume not covered by voxels
+
+            bool operator<(const Cluster& other) const { return waste < other.waste; }
+        };
+
+        /**
+         * @brief Collects hull points of the boundary voxels of part of a cluster
+         * @details Voxel corners are used to compare cuts and for the emitted hulls, so
+         *          halves meet at the cut plane and the pieces cover the surface instead
+         *          of sitting half a voxel inside. Voxel centres give the matching lower
+         *          bound used to judge how convex a piece is.
+         */
+        class BoundaryCollector {
+        public:
+            explicit BoundaryCollector(const VoxelGrid& grid)
+                : grid_(grid)
+                , cornerDims_(grid.dims + 1)
+                , stamp_(static_cast<size_t>(cornerDims_.x) * cornerDims_.y * cornerDims_.z, 0) {}
+
+            /**
+             * @brief Boundary points of { v in voxels : inPart(v) }
+             * @param inPart Predicate on voxel coordinates; neighbours must share the label and the predicate
+             * @param corners Emit the 8 voxel corners instead of the voxel centre
+             */
+            template<typename Pred>
+            const std::vector<glm::dvec3>& collect(const std::vector<int>& voxels, int label, Pred inPart, bool corners) {
+                points_.clear();
+                ++current_;
+
+                const glm::ivec3 offsets[6] = { {1,0,0}, {-1,0,0}, {0,1,0}, {0,-1,0}, {0,0,1}, {0,0,-1} };
+                for (int v : voxels) {
+                    glm::ivec3 c = grid_.coord(v);
+                    if (!inPart(c)) continue;
+
+                    bool boundary = false;
+                    for (const auto& o : offsets) {
+                        glm::ivec3 n = c + o;
+                        if (grid_.label[grid_.index(n.x, n.y, n.z)] != label || !inPart(n)) {
+                            boundary = true;
+                            break;
+                        }
+                    }
+                    if (!boundary) continue;
+
+                    if (!corners) {
+                        points_.emplace_back(c);
+                        continue;
+                    }
+
+                    for (int corner = 0; corner < 8; ++corner) {
+                        glm::ivec3 p = c + glm::ivec3(corner & 1, (corner >> 1) & 1, (corner >> 2) & 1);
+                        size_t key = static_cast<size_t>(p.x) + cornerDims_.x * (static_cast<size_t>(p.y) + cornerDims_.y * static_cast<size_t>(p.z));
+                        if (stamp_[key] == current_) continue;
+                        stamp_[key] = current_;
+                        points_.emplace_back(p);
+                    }
+                }
+                return points_;
+            }
+
+        private:
+            const VoxelGrid& grid_;
+            glm::ivec3 cornerDims_;
+            std::vector<uint32_t> stamp_;
+            uint32_t current_ = 0;
+            std::vector<glm::dvec3> points_;
+        };
+
+        /// Evenly spread directions for picking hull support points
+        std::vector<glm::vec3> fibonacciDirections(int count) {
+            std::vector<glm::vec3> directions;
+            directions.reserve(count);
+            const float golden = 2.39996323f;
+            for (int i = 0; i < count; ++i) {
+                float y = 1.0f - 2.0f * (static_cast<float>(i) + 0.5f) / static_cast<float>(count);
+                float r = std::sqrt(std::max(0.0f, 1.0f - y * y));
+                float phi = golden * static_cast<float>(i);
+                directions.emplace_back(std::cos(phi) * r, y, std::sin(phi) * r);
+            }
+            return directions;
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // PUBLIC API
+    // ============================================================================
+
+    bool CollisionBuilder::build(const MeshData& meshData,
+        const MeshSettingsCompiler& settings,
+        CollisionData& out) {
+        out = CollisionData{};
+
+        if (meshData.isEmpty() || meshData.getTriangleCount() == 0) {
+            log("ERROR: No triangles to build collision from");
+            return false;
+        }
+
+        if (settings.generateCollisionHulls) {
+            decompose(meshData, settings, out);
+        }
+
+        if (settings.generateCollisionMesh) {
+            simplify(meshData, settings, out);
+        }
+
+        return !out.isEmpty();
+    }
+
+    // ============================================================================
+    // CONVEX DECOMPOSITION
+    // ============================================================================
+
+    void CollisionBuilder::decompose(const MeshData& meshData,
+        const MeshSettingsCompiler& settings,
+        CollisionData& out) {
+        glm::vec3 boundsMin(std::numeric_limits<float>::max());
+        glm::vec3 boundsMax(std::numeric_limits<float>::lowest());
+        for (const auto& p : meshData.positions) {
+            boundsMin = glm::min(boundsMin, p);
+            boundsMax = glm::max(boundsMax, p);
+        }
+
+        VoxelGrid grid;
+        if (!grid.build(meshData, std::clamp(settings.collisionResolution, 4, 128), boundsMin, boundsMax)) {
+            log("WARNING: Degenerate mesh bounds, no collision hulls generated");
+            return;
+        }
+
+        Cluster root;
+        for (int i = 0; i < static_cast<int>(grid.label.size()); ++i) {
+            if (grid.label[i] == 0) root.voxels.push_back(i);
+        }
+        if (root.voxels.empty()) return;
+
+        const double totalVolume = static_cast<double>(root.voxels.size());
+        const double allowedWaste = std::max(0.0f, settings.collisionConcavity) * totalVolume;
+        const int maxHulls = std::max(1, settings.maxCollisionHulls);
+
+        BoundaryCollector boundary(grid);
+        auto everything = [](const glm::ivec3&) { return true; };
+
+        // The centre hull undershoots the voxelized surface by about as much as the corner
+        // hull overshoots it, so their mean tracks the true hull even for thin pieces
+        auto measureWaste = [&](Cluster& cluster, int label) {
+            double centres = convexHull(boundary.collect(cluster.voxels, label, everything, false), nullptr);
+            cluster.waste = 0.5 * (centres + cluster.hullVolume) - static_cast<double>(cluster.voxels.size());
+        };
+
+        root.hullVolume = convexHull(boundary.collect(root.voxels, 0, everything, true), nullptr);
+        measureWaste(root, 0);
+
+        std::priority_queue<Cluster> open;
+        std::vector<Cluster> done;
+        int nextLabel = 1;
+        open.push(std::move(root));
+
+        // Split the most wasteful piece until the budget is used or all pieces are convex enough
+        while (!open.empty() && open.size() + done.size() < static_cast<size_t>(maxHulls)) {
+            Cluster cluster = open.top();
+            open.pop();
+
+            if (cluster.waste <= allowedWaste || cluster.voxels.size() < 2) {
+                done.push_back(std::move(cluster));
+                continue;
+            }
+
+            const int label = grid.label[cluster.voxels.front()];
+            glm::ivec3 lo(std::numeric_limits<int>::max());
+            glm::ivec3 hi(std::numeric_limits<int>::lowest());
+            for (int v : cluster.voxels) {
+                glm::ivec3 c = grid.coord(v);
+                lo = glm::min(lo, c);
+                hi = glm::max(hi, c);
+            }
+
+            // Candidate planes: up to 9 per axis (odd, so the middle is one of them), left = coord < plane. Cost is the summed
+            // corner hull volume of both halves (they meet exactly at the plane) plus a small penalty for unbalanced cuts; axes are
+            // tried longest first and only a clear improvement replaces an earlier candidate,
+            // so symmetric shapes (rings, boxes) are cut across their long side.
+            int axes[3] = { 0, 1, 2 };
+            std::sort(axes, axes + 3, [&](int a, int b) { return hi[a] - lo[a] > hi[b] - lo[b]; });
+
+            const double tolerance = 1e-3 * cluster.hullVolume;
+            const double balanceWeight = 0.05 * cluster.hullVolume / static_cast<double>(cluster.voxels.size());
+
+            int bestAxis = -1;
+            int bestPlane = 0;
+            double bestCost = std::numeric_limits<double>::max();
+            double bestLeft = 0.0, bestRight = 0.0;
+
+            for (int axis : axes) {
+                int span = hi[axis] - lo[axis];
+                if (span < 1) continue;
+                int candidates = std::min(span, 9);
+                for (int k = 1; k <= candidates; ++k) {
+                    int plane = lo[axis] + (span * k + candidates) / (candidates + 1);
+                    plane = std::clamp(plane, lo[axis] + 1, hi[axis]);
+
+                    double leftCount = 0.0;
+                    for (int v : cluster.voxels) {
+                        if (grid.coord(v)[axis] < plane) leftCount += 1.0;
+                    }
+                    double rightCount = static_cast<double>(cluster.voxels.size()) - leftCount;
+
+                    double left = convexHull(boundary.collect(cluster.voxels, label,
+                        [&](const glm::ivec3& c) { return c[axis] < plane; }, true), nullptr);
+                    double right = convexHull(boundary.collect(cluster.voxels, label,
+                        [&](const glm::ivec3& c) { return c[axis] >= plane; }, true), nullptr);
+
+                    double leftWaste = left - leftCount;
+                    double rightWaste = right - rightCount;
+                    double cost = leftWaste + rightWaste + std::max(leftWaste, rightWaste)
+                        + balanceWeight * std::abs(leftCount - rightCount);
+                    if (cost < bestCost - tolerance) {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestPlane = plane;
+                        bestLeft = left;
+                        bestRight = right;
+                    }
+                }
+            }
+
+            if (bestAxis < 0) {
+                done.push_back(std::move(cluster));
+                continue;
+            }
+
+            Cluster leftCluster, rightCluster;
+            const int leftLabel = nextLabel++;
+            const int rightLabel = nextLabel++;
+            for (int v : cluster.voxels) {
+                bool isLeft = grid.coord(v)[bestAxis] < bestPlane;
+                grid.label[v] = isLeft ? leftLabel : rightLabel;
+                (isLeft ? leftCluster : rightCluster).voxels.push_back(v);
+            }
+
+            leftCluster.hullVolume = bestLeft;
+            rightCluster.hullVolume = bestRight;
+            measureWaste(leftCluster, leftLabel);
+            measureWaste(rightCluster, rightLabel);
+
+            open.push(std::move(leftCluster));
+            open.push(std::move(rightCluster));
+        }
+
+        while (!open.empty()) {
+            done.push_back(open.top());
+            open.pop();
+        }
+
+        // Emit hull vertices in mesh space, reduced to maxHullVertices support points
+        const int maxVertices = std::max(4, settings.maxHullVertices);
+        const std::vector<glm::vec3> directions = fibonacciDirections(maxVertices);
+        std::vector<int> used;
+        double hullTotal = 0.0;
+
+        for (const Cluster& cluster : done) {
+            const int label = grid.label[cluster.voxels.front()];
+            const std::vector<glm::dvec3>& points = boundary.collect(cluster.voxels, label, everything, true);
+            hullTotal += convexHull(points, &used);
+            if (used.size() < 4) continue;
+
+            std::vector<glm::vec3> hullPoints;
+            hullPoints.reserve(used.size());
+            for (int i : used) {
+                glm::vec3 p = grid.origin + glm::vec3(points[i]) * grid.voxelSize;
+                hullPoints.push_back(glm::clamp(p, boundsMin, boundsMax));
+            }
+
+            if (static_cast<int>(hullPoints.size()) > maxVertices) {
+                std::vector<glm::vec3> reduced;
+                std::unordered_set<size_t> picked;
+                for (const glm::vec3& dir : directions) {
+                    size_t best = 0;
+                    float bestDot = glm::dot(hullPoints[0], dir);
+                    for (size_t i = 1; i < hullPoints.size(); ++i) {
+                        float d = glm::dot(hullPoints[i], dir);
+                        if (d > bestDot) { bestDot = d; best = i; }
+                    }
+                    if (picked.insert(best).second) reduced.push_back(hullPoints[best]);
+                }
+                hullPoints = std::move(reduced);
+            }
+
+            if (hullPoints.size() >= 4) {
+                out.hulls.push_back(std::move(hullPoints));
+            }
+        }
+
+        log("Convex decomposition: %zu hulls, hull volume %.1f%% of mesh volume (grid %dx%dx%d)",
+            out.hulls.size(), 100.0 * hullTotal / totalVolume, grid.dims.x - 2, grid.dims.y - 2, grid.dims.z - 2);
+    }
+
+    // ============================================================================
+    // SIMPLIFICATION
+    // ============================================================================
+
+    void CollisionBuilder::simplify(const MeshData& meshData,
+        const MeshSettingsCompiler& settings,
+        CollisionData& out) {
+        glm::vec3 boundsMin(std::numeric_limits<float>::max());
+        glm::vec3 boundsMax(std::numeric_limits<float>::lowest());
+        for (const auto& p : meshData.positions) {
+            boundsMin = glm::min(boundsMin, p);
+            boundsMax = glm::max(boundsMax, p);
+        }
+
+        glm::vec3 extent = boundsMax - boundsMin;
+        float longest = std::max(extent.x, std::max(extent.y, extent.z));
+        const size_t target = static_cast<size_t>(std::max(0, settings.collisionMeshTriangles));
+        const size_t vertexCount = meshData.positions.size();
+
+        // Render meshes are split per face corner; start from a tiny cell that only welds
+        float cellSize = std::max(longest * 1e-5f, 1e-6f);
+
+        for (int attempt = 0; attempt < 64; ++attempt) {
+            std::unordered_map<uint64_t, uint32_t> cellToVertex;
+            std::vector<glm::vec3> sums;
+            std::vector<uint32_t> counts;
+            std::vector<uint32_t> remap(vertexCount);
+
+            for (size_t i = 0; i < vertexCount; ++i) {
+                glm::vec3 g = (meshData.positions[i] - boundsMin) / cellSize;
+                uint64_t key = (static_cast<uint64_t>(g.x) & 0x1FFFFF)
+                    | ((static_cast<uint64_t>(g.y) & 0x1FFFFF) << 21)
+                    | ((static_cast<uint64_t>(g.z) & 0x1FFFFF) << 42);
+
+                auto [it, inserted] = cellToVertex.emplace(key, static_cast<uint32_t>(sums.size()));
+                if (inserted) {
+                    sums.push_back(glm::vec3(0.0f));
+                    counts.push_back(0);
+                }
+                sums[it->second] += meshData.positions[i];
+                counts[it->second] += 1;
+                remap[i] = it->second;
+            }
+
+            std::vector<uint32_t> indices;
+            std::unordered_set<uint64_t> seen;
+            indices.reserve(meshData.indices.size());
+            for (size_t i = 0; i + 2 < meshData.indices.size(); i += 3) {
+                uint32_t i0 = meshData.indices[i], i1 = meshData.indices[i + 1], i2 = meshData.indices[i + 2];
+                if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) continue;
+
+                uint32_t a = remap[i0], b = remap[i1], c = remap[i2];
+                if (a == b || b == c || c == a) continue;
+
+                // Drop duplicates (same three vertices, any order or winding)
+                uint32_t s[3] = { a, b, c };
+                std::sort(s, s + 3);
+                uint64_t key = (static_cast<uint64_t>(s[0]) * 0x9E3779B97F4A7C15ULL)
+                    ^ (static_cast<uint64_t>(s[1]) << 21) ^ (static_cast<uint64_t>(s[2]) << 42);
+                if (!seen.insert(key).second) continue;
+
+                indices.push_back(a);
+                indices.push_back(b);
+                indices.push_back(c);
+            }
+
+            if (target == 0 || indices.size() / 3 <= target || attempt == 63) {
+                out.meshVertices.resize(sums.size());
+                for (size_t v = 0; v < sums.size(); ++v) {
+                    out.meshVertices[v] = sums[v] / static_cast<float>(counts[v]);
+                }
+                out.meshIndices = std::move(indices);
+                break;
+            }
+
+            cellSize = (attempt == 0) ? std::max(cellSize, longest / 256.0f) : cellSize * 1.25f;
+        }
+
+        log("Simplified collision mesh: %zu -> %zu triangles, %zu vertices",
+            meshData.getTriangleCount(), out.meshIndices.size() / 3, out.meshVertices.size());
+    }
+
+    // ============================================================================
+    // HELPERS
+    // ============================================================================
+
+    void CollisionBuilder::log(const char* format, ...) {
+        if (!verbose_) return;
+
+        char buffer[1024];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+
+        std::cout << "  [CollisionBuilder] " << buffer << "\n";
+    }
+
+} //end of namespace AssetCompiler
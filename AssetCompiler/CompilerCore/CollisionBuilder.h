@@ -0,0 +1,95 @@
+/*
+* @file CollisionBuilder.h
+* @brief Collision data generation for compiled meshes
+* @details Builds the physics representation stored after the render data in a
+*          compiled .mesh file:
+*          - an approximate convex decomposition (a bounded number of small hulls)
+*            for dynamic bodies, built at runtime as a compound of convex hulls
+*          - a simplified triangle mesh for static geometry
+* @author
+* @date
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace AssetCompiler {
+
+	struct MeshData;
+	struct MeshSettingsCompiler;
+
+	/**
+	 * @brief Collision data generated for one mesh
+	 */
+	struct CollisionData {
+		std::vector<std::vector<glm::vec3>> hulls;	// Points of each convex piece (hull vertices)
+		std::vector<glm::vec3> meshVertices;			// Simplified triangle mesh
+		std::vector<uint32_t> meshIndices;
+
+		bool isEmpty() const {
+			return hulls.empty() && meshIndices.empty();
+		}
+	};
+
+	/**
+	 * @brief Binary header of the collision section
+	 * @details Follows the indices of a compiled mesh when CompiledMeshHeader::hasCollision
+	 *          is set. Layout after the header:
+	 *          uint32 hullVertexCounts[hullCount], vec3 hullVertices[hullVertexTotal],
+	 *          vec3 meshVertices[meshVertexCount], uint32 meshIndices[meshIndexCount]
+	 */
+	struct CompiledCollisionHeader {
+		char magic[4] = { 'C', 'O', 'L', '\0' };	// Magic number "COL"
+		uint32_t version = 1;
+
+		uint32_t hullCount = 0;
+		uint32_t hullVertexTotal = 0;
+		uint32_t meshVertexCount = 0;
+		uint32_t meshIndexCount = 0;
+
+		uint32_t reserved[2] = { 0 };
+	};
+
+	class CollisionBuilder {
+	public:
+		explicit CollisionBuilder(bool verbose = false) : verbose_(verbose) {}
+
+		/**
+		* @brief Generate collision data as requested by the settings
+		* @param meshData Processed (scaled) render mesh
+		* @param settings generateCollisionHulls / generateCollisionMesh and their limits
+		* @param out Receives the hulls and/or simplified mesh
+		* @return false if the mesh has no usable triangles
+		*/
+		bool build(const MeshData& meshData,
+			const MeshSettingsCompiler& settings,
+			CollisionData& out);
+
+	private:
+		/**
+		* @brief Approximate convex decomposition
+		* @details Voxelizes the mesh, then repeatedly splits the voxel cluster whose
+		*          hull wastes the most volume with the axis-aligned plane that minimizes
+		*          the summed hull volume of both halves, until every cluster is convex
+		*          enough or the hull budget is used up.
+		*/
+		void decompose(const MeshData& meshData,
+			const MeshSettingsCompiler& settings,
+			CollisionData& out);
+
+		/**
+		* @brief Vertex-clustering simplification down to a target triangle count
+		*/
+		void simplify(const MeshData& meshData,
+			const MeshSettingsCompiler& settings,
+			CollisionData& out);
+
+		bool verbose_ = false;
+
+		void log(const char* format, ...);
+	};
+
+}// end of namespace AssetCompiler
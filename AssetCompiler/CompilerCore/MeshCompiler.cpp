@@ -1,5 +1,7 @@
 #include "MeshCompiler.h"
 #include "../Utility/DescriptorParser.h"
+#include <algorithm>
+#include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -50,14 +52,15 @@ namespace AssetCompiler {
             return false;
         }
 
-        // Step 3: Load mesh data from source file
+        // Step 3: Load mesh data (and skeleton/clips of skinned meshes) from source file
         MeshData meshData;
+        SkeletonData skeleton;
 
         std::string ext = fs::path(sourcePath).extension().string();
         bool loadSuccess = false;
 
         if (ext == ".fbx" || ext == ".FBX") {
-            loadSuccess = loadFBXMesh(sourcePath, meshData);
+            loadSuccess = loadFBXMesh(sourcePath, meshData, settings, skeleton);
         }
         else if (ext == ".obj" || ext == ".OBJ") {
             loadSuccess = loadOBJMesh(sourcePath, meshData);
@@ -110,7 +113,16 @@ namespace AssetCompiler {
             log("Optimized vertex cache");
         }
 
-        // Step 5: Prepare binary header
+        // Step 5: Build collision data from the processed mesh
+        CollisionData collision;
+        if (settings.generateCollisionHulls || settings.generateCollisionMesh) {
+            CollisionBuilder builder(verbose_);
+            if (!builder.build(meshData, settings, collision)) {
+                log("WARNING: No collision data generated");
+            }
+        }
+
+        // Step 6: Prepare binary header
         CompiledMeshHeader header;
         header.vertexCount = static_cast<uint32_t>(meshData.getVertexCount());
         header.indexCount = static_cast<uint32_t>(meshData.getIndexCount());
@@ -127,15 +139,17 @@ namespace AssetCompiler {
         if (header.hasTexCoords) header.vertexStride += sizeof(glm::vec2);
 
         header.indexSize = (settings.indexType == "UINT16") ? 2 : 4;
+        header.hasCollision = collision.isEmpty() ? 0 : 1;
+        header.hasSkeleton = (skeleton.isEmpty() || meshData.jointIndices.size() != meshData.positions.size()) ? 0 : 1;
 
-        // Step 6: Create output directory if needed
+        // Step 7: Create output directory if needed
         fs::path outPath(outputPath);
         if (!fs::exists(outPath.parent_path())) {
             fs::create_directories(outPath.parent_path());
         }
 
-        // Step 7: Write binary file
-        if (!writeBinaryMesh(outputPath, header, meshData)) {
+        // Step 8: Write binary file
+        if (!writeBinaryMesh(outputPath, header, meshData, collision, skeleton)) {
             log("ERROR: Failed to write binary mesh");
             return false;
         }
@@ -150,7 +164,8 @@ namespace AssetCompiler {
     // LOADING
     // ============================================================================
 
-    bool MeshCompiler::loadFBXMesh(const std::string& path, MeshData& meshData) {
+    bool MeshCompiler::loadFBXMesh(const std::string& path, MeshData& meshData,
+        const MeshSettingsCompiler& settings, SkeletonData& skeleton) {
         log("Loading FBX mesh: %s", path.c_str());
 
         log("Loading FBX mesh: %s", path.c_str());
@@ -182,6 +197,12 @@ namespace AssetCompiler {
 
         log("FBX loaded: %d meshes found", scene->getMeshCount());
 
+        // Skeleton and clips first, so vertices can be bound to joints below
+        AnimationBuilder animationBuilder(verbose_);
+        const bool skinned = settings.importAnimation && animationBuilder.build(*scene, settings, skeleton);
+        std::vector<glm::u16vec4> controlPointJoints;
+        std::vector<glm::vec4> controlPointWeights;
+
         // Process all meshes in the scene
         int meshCount = scene->getMeshCount();
         for (int mesh_idx = 0; mesh_idx < meshCount; mesh_idx++) {
@@ -197,6 +218,10 @@ namespace AssetCompiler {
             ofbx::Vec3Attributes normals = geom.getNormals();
             ofbx::Vec2Attributes uvs = geom.getUVs();
 
+            if (skinned) {
+                animationBuilder.gatherInfluences(*mesh, controlPointJoints, controlPointWeights);
+            }
+
             // Process each partition (submesh with same material)
             for (int partition_idx = 0; partition_idx < geom.getPartitionCount(); ++partition_idx) {
                 const ofbx::GeometryPartition& partition = geom.getPartition(partition_idx);
@@ -242,6 +267,14 @@ namespace AssetCompiler {
                         else {
                             meshData.texCoords.push_back(glm::vec2(0.0f, 0.0f));
                         }
+
+                        // Joint influences of the control point
+                        if (skinned) {
+                            const int cp = positions.indices ? positions.indices[i] : i;
+                            const bool valid = cp >= 0 && cp < static_cast<int>(controlPointJoints.size());
+                            meshData.jointIndices.push_back(valid ? controlPointJoints[cp] : glm::u16vec4(0));
+                            meshData.jointWeights.push_back(valid ? controlPointWeights[cp] : glm::vec4(1.0f, 0.0f, 0.0f, 0.0f));
+                        }
                     }
 
                     // Triangulate the polygon
@@ -372,6 +405,8 @@ namespace AssetCompiler {
         std::vector<glm::vec3> uniqueNormals;
         std::vector<glm::vec3> uniqueColors;
         std::vector<glm::vec2> uniqueTexCoords;
+        std::vector<glm::u16vec4> uniqueJointIndices;
+        std::vector<glm::vec4> uniqueJointWeights;
         std::vector<uint32_t> remap(meshData.positions.size());
 
         float thresholdSq = threshold * threshold;
@@ -396,6 +431,8 @@ namespace AssetCompiler {
                 if (i < meshData.normals.size()) uniqueNormals.push_back(meshData.normals[i]);
                 if (i < meshData.colors.size()) uniqueColors.push_back(meshData.colors[i]);
                 if (i < meshData.texCoords.size()) uniqueTexCoords.push_back(meshData.texCoords[i]);
+                if (i < meshData.jointIndices.size()) uniqueJointIndices.push_back(meshData.jointIndices[i]);
+                if (i < meshData.jointWeights.size()) uniqueJointWeights.push_back(meshData.jointWeights[i]);
             }
         }
 
@@ -410,6 +447,8 @@ namespace AssetCompiler {
         meshData.normals = std::move(uniqueNormals);
         meshData.colors = std::move(uniqueColors);
         meshData.texCoords = std::move(uniqueTexCoords);
+        meshData.jointIndices = std::move(uniqueJointIndices);
+        meshData.jointWeights = std::move(uniqueJointWeights);
     }
 
     void MeshCompiler::optimizeVertexCache(MeshData& meshData) {
@@ -424,7 +463,9 @@ namespace AssetCompiler {
 
     bool MeshCompiler::writeBinaryMesh(const std::string& outputPath,
         const CompiledMeshHeader& header,
-        const MeshData& meshData) {
+        const MeshData& meshData,
+        const CollisionData& collision,
+        const SkeletonData& skeleton) {
         std::ofstream file(outputPath, std::ios::binary);
         if (!file.is_open()) {
             log("ERROR: Failed to open output file: %s", outputPath.c_str());
@@ -464,6 +505,93 @@ namespace AssetCompiler {
                 meshData.indices.size() * sizeof(uint32_t));
         }
 
+        // Write collision section
+        if (header.hasCollision) {
+            CompiledCollisionHeader colHeader;
+            colHeader.hullCount = static_cast<uint32_t>(collision.hulls.size());
+            colHeader.meshVertexCount = static_cast<uint32_t>(collision.meshVertices.size());
+            colHeader.meshIndexCount = static_cast<uint32_t>(collision.meshIndices.size());
+
+            std::vector<uint32_t> hullVertexCounts;
+            for (const auto& hull : collision.hulls) {
+                hullVertexCounts.push_back(static_cast<uint32_t>(hull.size()));
+                colHeader.hullVertexTotal += static_cast<uint32_t>(hull.size());
+            }
+
+            file.write(reinterpret_cast<const char*>(&colHeader), sizeof(CompiledCollisionHeader));
+            file.write(reinterpret_cast<const char*>(hullVertexCounts.data()),
+                hullVertexCounts.size() * sizeof(uint32_t));
+            for (const auto& hull : collision.hulls) {
+                file.write(reinterpret_cast<const char*>(hull.data()), hull.size() * sizeof(glm::vec3));
+            }
+            file.write(reinterpret_cast<const char*>(collision.meshVertices.data()),
+                collision.meshVertices.size() * sizeof(glm::vec3));
+            file.write(reinterpret_cast<const char*>(collision.meshIndices.data()),
+                collision.meshIndices.size() * sizeof(uint32_t));
+        }
+
+        // Write skeleton section
+        if (header.hasSkeleton) {
+            CompiledSkeletonHeader skelHeader;
+            skelHeader.jointCount = static_cast<uint32_t>(skeleton.joints.size());
+            skelHeader.clipCount = static_cast<uint32_t>(skeleton.clips.size());
+            skelHeader.vertexCount = static_cast<uint32_t>(meshData.positions.size());
+            file.write(reinterpret_cast<const char*>(&skelHeader), sizeof(CompiledSkeletonHeader));
+
+            for (const SkeletonJoint& joint : skeleton.joints) {
+                CompiledJoint out;
+                joint.name.copy(out.name, sizeof(out.name) - 1);
+                out.parent = joint.parent;
+                for (int i = 0; i < 3; ++i) {
+                    out.translation[i] = joint.translation[i];
+                    out.scale[i] = joint.scale[i];
+                }
+                out.rotation[0] = joint.rotation.x;
+                out.rotation[1] = joint.rotation.y;
+                out.rotation[2] = joint.rotation.z;
+                out.rotation[3] = joint.rotation.w;
+                for (int c = 0; c < 4; ++c) {
+                    for (int r = 0; r < 4; ++r) {
+                        out.inverseBind[c * 4 + r] = joint.inverseBind[c][r];
+                    }
+                }
+                file.write(reinterpret_cast<const char*>(&out), sizeof(CompiledJoint));
+            }
+
+            // Weights as bytes summing to 255; the rounding error goes to the largest
+            for (size_t i = 0; i < meshData.positions.size(); ++i) {
+                CompiledSkinVertex out;
+                int total = 0;
+                int largest = 0;
+                for (int k = 0; k < 4; ++k) {
+                    out.joints[k] = meshData.jointIndices[i][k];
+                    out.weights[k] = static_cast<uint8_t>(std::lround(std::clamp(meshData.jointWeights[i][k], 0.0f, 1.0f) * 255.0f));
+                    total += out.weights[k];
+                    if (meshData.jointWeights[i][k] > meshData.jointWeights[i][largest]) largest = k;
+                }
+                out.weights[largest] = static_cast<uint8_t>(std::clamp(out.weights[largest] + 255 - total, 0, 255));
+                file.write(reinterpret_cast<const char*>(&out), sizeof(CompiledSkinVertex));
+            }
+
+            for (const CompressedClip& clip : skeleton.clips) {
+                CompiledClipHeader clipHeader;
+                clip.name.copy(clipHeader.name, sizeof(clipHeader.name) - 1);
+                clipHeader.duration = clip.duration;
+                clipHeader.sampleRate = clip.sampleRate;
+                clipHeader.frameCount = clip.frameCount;
+                clipHeader.channelCount = static_cast<uint32_t>(clip.channels.size());
+                clipHeader.keyCount = static_cast<uint32_t>(clip.keyFrames.size());
+
+                file.write(reinterpret_cast<const char*>(&clipHeader), sizeof(CompiledClipHeader));
+                file.write(reinterpret_cast<const char*>(clip.channels.data()),
+                    clip.channels.size() * sizeof(CompiledAnimationChannel));
+                file.write(reinterpret_cast<const char*>(clip.keyFrames.data()),
+                    clip.keyFrames.size() * sizeof(uint16_t));
+                file.write(reinterpret_cast<const char*>(clip.keyValues.data()),
+                    clip.keyValues.size() * sizeof(uint16_t));
+            }
+        }
+
         file.close();
         return true;
     }
@@ -517,6 +645,18 @@ namespace AssetCompiler {
             if (ms.HasMember("removeDegenerate")) settings.removeDegenerate = ms["removeDegenerate"].GetBool();
             if (ms.HasMember("weldVertices")) settings.weldVertices = ms["weldVertices"].GetBool();
             if (ms.HasMember("weldThreshold")) settings.weldThreshold = ms["weldThreshold"].GetFloat();
+            if (ms.HasMember("generateCollisionHulls")) settings.generateCollisionHulls = ms["generateCollisionHulls"].GetBool();
+            if (ms.HasMember("maxCollisionHulls")) settings.maxCollisionHulls = ms["maxCollisionHulls"].GetInt();
+            if (ms.HasMember("maxHullVertices")) settings.maxHullVertices = ms["maxHullVertices"].GetInt();
+            if (ms.HasMember("collisionResolution")) settings.collisionResolution = ms["collisionResolution"].GetInt();
+            if (ms.HasMember("collisionConcavity")) settings.collisionConcavity = ms["collisionConcavity"].GetFloat();
+            if (ms.HasMember("generateCollisionMesh")) settings.generateCollisionMesh = ms["generateCollisionMesh"].GetBool();
+            if (ms.HasMember("collisionMeshTriangles")) settings.collisionMeshTriangles = ms["collisionMeshTriangles"].GetInt();
+            if (ms.HasMember("importAnimation")) settings.importAnimation = ms["importAnimation"].GetBool();
+            if (ms.HasMember("animationSampleRate")) settings.animationSampleRate = ms["animationSampleRate"].GetFloat();
+            if (ms.HasMember("animationRotationTolerance")) settings.animationRotationTolerance = ms["animationRotationTolerance"].GetFloat();
+            if (ms.HasMember("animationTranslationTolerance")) settings.animationTranslationTolerance = ms["animationTranslationTolerance"].GetFloat();
+            if (ms.HasMember("animationScaleTolerance")) settings.animationScaleTolerance = ms["animationScaleTolerance"].GetFloat();
         }
 
         return true;
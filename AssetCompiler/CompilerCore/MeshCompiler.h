@@ -11,6 +11,9 @@
 #include <string>
 #include <vector>
 #include <glm/glm.hpp>
+#include <glm/gtc/type_precision.hpp>
+#include "CollisionBuilder.h"
+#include "AnimationBuilder.h"
 
 namespace AssetCompiler {
 
@@ -20,6 +23,8 @@ namespace AssetCompiler {
 		std::vector<glm::vec3> colors;
 		std::vector<glm::vec2> texCoords;
 		std::vector<uint32_t> indices;
+		std::vector<glm::u16vec4> jointIndices;	// Skinned meshes only: 4 influences per vertex
+		std::vector<glm::vec4> jointWeights;
 
 		bool isEmpty() const {
 			return positions.empty();
@@ -64,6 +69,24 @@ namespace AssetCompiler {
 		bool removeDegenerate = false;
 		bool weldVertices = false;
 		float weldThreshold = 0.00001f; 
+
+		//collision: approximate convex decomposition (dynamic bodies)
+		bool generateCollisionHulls = false;
+		int maxCollisionHulls = 8;			// Upper bound on convex pieces
+		int maxHullVertices = 32;			// Upper bound on points per piece
+		int collisionResolution = 32;		// Voxels along the longest axis
+		float collisionConcavity = 0.05f;	// Stop splitting below this wasted volume fraction
+
+		//collision: simplified triangle mesh (static geometry)
+		bool generateCollisionMesh = false;
+		int collisionMeshTriangles = 1024;	// Target triangle count
+
+		//animation: skeleton, skin weights and clips of skinned FBX meshes
+		bool importAnimation = true;
+		float animationSampleRate = 30.0f;				// Frames per second clips are sampled at
+		float animationRotationTolerance = 0.0005f;	// Max quaternion component error when dropping keys
+		float animationTranslationTolerance = 0.0005f;	// Max error in (scaled) units when dropping keys
+		float animationScaleTolerance = 0.0005f;		// Max scale error when dropping keys
 	};
 
 	/**
@@ -84,7 +107,10 @@ namespace AssetCompiler {
 		uint32_t vertexStride = 0;    // Bytes per vertex
 		uint32_t indexSize = 4;       // 2 for UINT16, 4 for UINT32
 
-		uint32_t reserved[6] = { 0 };   // For future use
+		uint32_t hasCollision = 0;    // 1 if a CompiledCollisionHeader section follows the indices
+		uint32_t hasSkeleton = 0;     // 1 if a CompiledSkeletonHeader section follows (after collision)
+
+		uint32_t reserved[4] = { 0 };   // For future use
 	};
 
 	class MeshCompiler {
@@ -105,7 +131,8 @@ namespace AssetCompiler {
 
 	private: 
 		// === Loading ===
-		bool loadFBXMesh(const std::string& path, MeshData& meshData);
+		bool loadFBXMesh(const std::string& path, MeshData& meshData,
+			const MeshSettingsCompiler& settings, SkeletonData& skeleton);
 		bool loadOBJMesh(const std::string& path, MeshData& meshData);
 
 		// === Processing ===
@@ -119,7 +146,9 @@ namespace AssetCompiler {
 		// === Serialization ===
 		bool writeBinaryMesh(const std::string& outputPath,
 			const CompiledMeshHeader& header,
-			const MeshData& meshData);
+			const MeshData& meshData,
+			const CollisionData& collision,
+			const SkeletonData& skeleton);
 
 		// === Helpers ===
 		bool parseSettings(const std::string& descriptorPath,
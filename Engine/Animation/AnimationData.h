@@ -0,0 +1,147 @@
+/**
+ * @file AnimationData.h
+ * @brief Runtime skeleton, compressed clip and skin data baked by the asset compiler
+ * @details Mirrors the skeleton section of a compiled .mesh file. Clips stay in their
+ *          compressed form at runtime and are decoded while sampling:
+ *          - every joint has three channels (rotation, translation, scale)
+ *          - a channel keeps only the frames needed to reproduce the source curve
+ *            within tolerance (one key if it never changes); the pose between two kept
+ *            frames is their linear (rotation: normalized linear) interpolation
+ *          - rotations are stored "smallest three": the largest component is dropped
+ *            and rebuilt from the unit length, the other three take 15/15/16 bits
+ *          - translations and scales are 16 bits per component within the channel's
+ *            [min, min + extent] range
+ *          Nothing in here touches OpenGL, so clips can be decoded without a context.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_precision.hpp>
+
+namespace Engine {
+
+    /**
+     * @brief Local transform of one joint relative to its parent
+     */
+    struct JointPose {
+        glm::vec3 Translation = glm::vec3(0.0f);
+        glm::quat Rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+        glm::vec3 Scale = glm::vec3(1.0f);
+    };
+
+    /**
+     * @brief Joint hierarchy, parents always stored before their children
+     */
+    struct Skeleton {
+        std::vector<std::string> JointNames;
+        std::vector<std::int32_t> Parents;      ///< -1 for roots
+        std::vector<JointPose> BindPose;        ///< Local pose the mesh was skinned in
+        std::vector<glm::mat4> InverseBind;     ///< Mesh space to joint space at bind time
+
+        std::uint32_t GetJointCount() const { return static_cast<std::uint32_t>(Parents.size()); }
+
+        /**
+         * @brief Joint index by name, -1 if not found
+         */
+        std::int32_t FindJoint(const std::string& name) const {
+            for (std::size_t i = 0; i < JointNames.size(); ++i) {
+                if (JointNames[i] == name) return static_cast<std::int32_t>(i);
+            }
+            return -1;
+        }
+    };
+
+    /**
+     * @brief Channels of a joint, in clip channel order
+     */
+    enum class AnimationChannelType : std::uint8_t {
+        Rotation = 0,
+        Translation = 1,
+        Scale = 2
+    };
+
+    inline constexpr std::uint32_t ANIMATION_CHANNELS_PER_JOINT = 3;
+
+    /**
+     * @brief One key-reduced, quantized channel of a clip
+     */
+    struct AnimationChannel {
+        std::uint32_t FirstKey = 0;             ///< Index into the clip's key arrays
+        std::uint32_t KeyCount = 0;             ///< At least 1; 1 means constant
+        glm::vec3 Min = glm::vec3(0.0f);        ///< Dequantization range (unused for rotations)
+        glm::vec3 Extent = glm::vec3(0.0f);
+    };
+
+    /**
+     * @brief Compressed animation clip
+     * @details Channel (joint * 3 + AnimationChannelType). Key k of a channel lives at
+     *          KeyFrames[FirstKey + k] (source frame index, increasing) and
+     *          KeyValues[(FirstKey + k) * 3 .. + 2].
+     */
+    struct AnimationClip {
+        std::string Name;
+        float Duration = 0.0f;                  ///< Seconds, (FrameCount - 1) / SampleRate
+        float SampleRate = 30.0f;               ///< Frames per second the source was sampled at
+        std::uint32_t FrameCount = 0;
+        std::vector<AnimationChannel> Channels;
+        std::vector<std::uint16_t> KeyFrames;
+        std::vector<std::uint16_t> KeyValues;
+
+        std::uint32_t GetJointCount() const {
+            return static_cast<std::uint32_t>(Channels.size() / ANIMATION_CHANNELS_PER_JOINT);
+        }
+
+        /**
+         * @brief Compressed size in bytes (keys and channel table)
+         */
+        std::size_t GetCompressedSize() const {
+            return Channels.size() * sizeof(AnimationChannel) +
+                (KeyFrames.size() + KeyValues.size()) * sizeof(std::uint16_t);
+        }
+    };
+
+    /**
+     * @brief Bind-pose vertices with up to four joint influences each
+     * @details Positions and normals are copied out of the render mesh so CPU skinning
+     *          does not depend on the interleaved GPU layout.
+     */
+    struct SkinData {
+        std::vector<glm::vec3> Positions;
+        std::vector<glm::vec3> Normals;
+        std::vector<glm::u16vec4> Joints;
+        std::vector<glm::vec4> Weights;         ///< Sum to 1 per vertex
+
+        std::size_t GetVertexCount() const { return Positions.size(); }
+    };
+
+    /**
+     * @brief Everything an animated mesh needs: skeleton, clips and skin
+     */
+    struct AnimationSet {
+        Engine::Skeleton Skeleton;
+        std::vector<AnimationClip> Clips;
+        SkinData Skin;
+
+        /**
+         * @brief Clip index by name, -1 if not found
+         */
+        std::int32_t FindClip(const std::string& name) const {
+            for (std::size_t i = 0; i < Clips.size(); ++i) {
+                if (Clips[i].Name == name) return static_cast<std::int32_t>(i);
+            }
+            return -1;
+        }
+    };
+
+} // namespace Engine
@@ -0,0 +1,264 @@
+/**
+ * @file AnimationPose.cpp
+ * @brief Clip decompression, pose blending, local-to-model evaluation and skinning
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "AnimationPose.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ANIMATION_SSE 1
+#include <xmmintrin.h>
+#endif
+
+namespace Engine {
+
+    namespace {
+
+        // Smallest-three range: the three kept components lie in [-1/sqrt(2), 1/sqrt(2)]
+        constexpr float ROTATION_RANGE = 0.70710678f;
+        constexpr float INV_15BIT = 1.0f / 32767.0f;
+        constexpr float INV_16BIT = 1.0f / 65535.0f;
+
+        /**
+         * @brief Interval of a channel containing a (fractional) frame
+         * @return Index of the first key; alpha is the position towards the next key
+         */
+        std::uint32_t FindKey(const AnimationClip& clip, const AnimationChannel& channel,
+            float frame, float& alpha) {
+            alpha = 0.0f;
+            if (channel.KeyCount <= 1) return channel.FirstKey;
+
+            const std::uint16_t* frames = clip.KeyFrames.data() + channel.FirstKey;
+            const std::uint16_t* last = frames + channel.KeyCount - 1;
+            if (frame >= static_cast<float>(*last)) return channel.FirstKey + channel.KeyCount - 1;
+
+            // First key after the frame; the interval starts one before it
+            const std::uint16_t* next = std::upper_bound(frames, last,
+                static_cast<std::uint16_t>(frame),
+                [](std::uint16_t value, std::uint16_t key) { return value < key; });
+            const std::uint16_t* prev = next - 1;
+
+            const float span = static_cast<float>(*next - *prev);
+            alpha = span > 0.0f ? (frame - static_cast<float>(*prev)) / span : 0.0f;
+            return channel.FirstKey + static_cast<std::uint32_t>(prev - frames);
+        }
+
+        glm::quat Nlerp(const glm::quat& a, const glm::quat& b, float t) {
+            const float sign = glm::dot(a, b) < 0.0f ? -1.0f : 1.0f;
+            glm::quat q = a * (1.0f - t) + b * (t * sign);
+            return glm::normalize(q);
+        }
+
+        void SkinOneScalar(const glm::mat4* skinning, const glm::u16vec4& joints, const glm::vec4& weights,
+            const glm::vec3& position, const glm::vec3& normal, glm::vec3& outPosition, glm::vec3* outNormal) {
+            glm::mat4 m = skinning[joints.x] * weights.x;
+            m += skinning[joints.y] * weights.y;
+            m += skinning[joints.z] * weights.z;
+            m += skinning[joints.w] * weights.w;
+
+            outPosition = glm::vec3(m * glm::vec4(position, 1.0f));
+            if (outNormal) {
+                glm::vec3 n = glm::mat3(m) * normal;
+                const float len2 = glm::dot(n, n);
+                *outNormal = len2 > 0.0f ? n / std::sqrt(len2) : normal;
+            }
+        }
+
+    } // namespace
+
+    namespace Animation {
+
+        glm::quat DecodeRotation(const std::uint16_t* key) {
+            // Top bits of the first two words hold the index of the dropped component
+            const std::uint32_t largest = (key[0] >> 15) | ((key[1] >> 15) << 1);
+            const float a = (static_cast<float>(key[0] & 0x7fff) * INV_15BIT * 2.0f - 1.0f) * ROTATION_RANGE;
+            const float b = (static_cast<float>(key[1] & 0x7fff) * INV_15BIT * 2.0f - 1.0f) * ROTATION_RANGE;
+            const float c = (static_cast<float>(key[2]) * INV_16BIT * 2.0f - 1.0f) * ROTATION_RANGE;
+            const float d = std::sqrt(std::max(0.0f, 1.0f - a * a - b * b - c * c));
+
+            // Component order x, y, z, w with the largest one re-inserted
+            float v[4];
+            float const kept[3] = { a, b, c };
+            for (std::uint32_t i = 0, k = 0; i < 4; ++i) {
+                v[i] = (i == largest) ? d : kept[k++];
+            }
+            return glm::normalize(glm::quat(v[3], v[0], v[1], v[2]));
+        }
+
+        glm::vec3 DecodeVector(const std::uint16_t* key, const glm::vec3& min, const glm::vec3& extent) {
+            return min + glm::vec3(
+                static_cast<float>(key[0]) * INV_16BIT,
+                static_cast<float>(key[1]) * INV_16BIT,
+                static_cast<float>(key[2]) * INV_16BIT) * extent;
+        }
+
+        void SampleClip(const AnimationClip& clip, float time, std::vector<JointPose>& out) {
+            const std::uint32_t jointCount = clip.GetJointCount();
+            out.resize(jointCount);
+            if (jointCount == 0 || clip.FrameCount == 0) return;
+
+            const float frame = std::clamp(time * clip.SampleRate, 0.0f,
+                static_cast<float>(clip.FrameCount - 1));
+
+            const std::uint16_t* values = clip.KeyValues.data();
+            for (std::uint32_t j = 0; j < jointCount; ++j) {
+                const AnimationChannel* channels = &clip.Channels[j * ANIMATION_CHANNELS_PER_JOINT];
+                JointPose& pose = out[j];
+                float alpha;
+
+                // Rotation
+                {
+                    const AnimationChannel& ch = channels[static_cast<int>(AnimationChannelType::Rotation)];
+                    const std::uint32_t k = FindKey(clip, ch, frame, alpha);
+                    const glm::quat q0 = DecodeRotation(values + k * 3);
+                    pose.Rotation = alpha > 0.0f ? Nlerp(q0, DecodeRotation(values + (k + 1) * 3), alpha) : q0;
+                }
+
+                // Translation
+                {
+                    const AnimationChannel& ch = channels[static_cast<int>(AnimationChannelType::Translation)];
+                    const std::uint32_t k = FindKey(clip, ch, frame, alpha);
+                    const glm::vec3 t0 = DecodeVector(values + k * 3, ch.Min, ch.Extent);
+                    pose.Translation = alpha > 0.0f ? glm::mix(t0, DecodeVector(values + (k + 1) * 3, ch.Min, ch.Extent), alpha) : t0;
+                }
+
+                // Scale
+                {
+                    const AnimationChannel& ch = channels[static_cast<int>(AnimationChannelType::Scale)];
+                    const std::uint32_t k = FindKey(clip, ch, frame, alpha);
+                    const glm::vec3 s0 = DecodeVector(values + k * 3, ch.Min, ch.Extent);
+                    pose.Scale = alpha > 0.0f ? glm::mix(s0, DecodeVector(values + (k + 1) * 3, ch.Min, ch.Extent), alpha) : s0;
+                }
+            }
+        }
+
+        void BlendPoses(const std::vector<JointPose>& a, const std::vector<JointPose>& b,
+            float weight, std::vector<JointPose>& out) {
+            const std::size_t count = std::min(a.size(), b.size());
+            out.resize(a.size());
+            weight = std::clamp(weight, 0.0f, 1.0f);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i].Translation = glm::mix(a[i].Translation, b[i].Translation, weight);
+                out[i].Rotation = Nlerp(a[i].Rotation, b[i].Rotation, weight);
+                out[i].Scale = glm::mix(a[i].Scale, b[i].Scale, weight);
+            }
+            if (&out != &a) {
+                std::copy(a.begin() + static_cast<std::ptrdiff_t>(count), a.end(),
+                    out.begin() + static_cast<std::ptrdiff_t>(count));
+            }
+        }
+
+        glm::mat4 ComposeMatrix(const JointPose& pose) {
+            glm::mat4 m = glm::mat4_cast(pose.Rotation);
+            m[0] *= pose.Scale.x;
+            m[1] *= pose.Scale.y;
+            m[2] *= pose.Scale.z;
+            m[3] = glm::vec4(pose.Translation, 1.0f);
+            return m;
+        }
+
+        void LocalToModel(const Skeleton& skeleton, const std::vector<JointPose>& local,
+            std::vector<glm::mat4>& model) {
+            const std::uint32_t jointCount = skeleton.GetJointCount();
+            model.resize(jointCount);
+
+            for (std::uint32_t j = 0; j < jointCount; ++j) {
+                const JointPose& pose = j < local.size() ? local[j] : skeleton.BindPose[j];
+                const glm::mat4 m = ComposeMatrix(pose);
+                const std::int32_t parent = skeleton.Parents[j];
+                model[j] = parent >= 0 ? model[static_cast<std::size_t>(parent)] * m : m;
+            }
+        }
+
+        void ComputeSkinningMatrices(const Skeleton& skeleton, const std::vector<glm::mat4>& model,
+            std::vector<glm::mat4>& skinning) {
+            skinning.resize(model.size());
+            for (std::size_t j = 0; j < model.size(); ++j) {
+                skinning[j] = model[j] * skeleton.InverseBind[j];
+            }
+        }
+
+        void SkinVerticesScalar(const SkinData& skin, const glm::mat4* skinning,
+            glm::vec3* positions, glm::vec3* normals, std::size_t begin, std::size_t end) {
+            const bool hasNormals = normals && skin.Normals.size() >= end;
+            for (std::size_t i = begin; i < end; ++i) {
+                SkinOneScalar(skinning, skin.Joints[i], skin.Weights[i], skin.Positions[i],
+                    hasNormals ? skin.Normals[i] : glm::vec3(0.0f), positions[i],
+                    hasNormals ? &normals[i] : nullptr);
+            }
+        }
+
+#if defined(ANIMATION_SSE)
+
+        void SkinVertices(const SkinData& skin, const glm::mat4* skinning,
+            glm::vec3* positions, glm::vec3* normals, std::size_t begin, std::size_t end) {
+            const bool hasNormals = normals && skin.Normals.size() >= end;
+            alignas(16) float result[4];
+
+            for (std::size_t i = begin; i < end; ++i) {
+                const glm::u16vec4& joints = skin.Joints[i];
+                const glm::vec4& weights = skin.Weights[i];
+
+                const float* m0 = &skinning[joints.x][0][0];
+                const float* m1 = &skinning[joints.y][0][0];
+                const float* m2 = &skinning[joints.z][0][0];
+                const float* m3 = &skinning[joints.w][0][0];
+                const __m128 w0 = _mm_set1_ps(weights.x);
+                const __m128 w1 = _mm_set1_ps(weights.y);
+                const __m128 w2 = _mm_set1_ps(weights.z);
+                const __m128 w3 = _mm_set1_ps(weights.w);
+
+                // Weighted sum of the four joint matrices, one column at a time
+                __m128 col[4];
+                for (int c = 0; c < 4; ++c) {
+                    __m128 v = _mm_mul_ps(_mm_loadu_ps(m0 + c * 4), w0);
+                    v = _mm_add_ps(v, _mm_mul_ps(_mm_loadu_ps(m1 + c * 4), w1));
+                    v = _mm_add_ps(v, _mm_mul_ps(_mm_loadu_ps(m2 + c * 4), w2));
+                    v = _mm_add_ps(v, _mm_mul_ps(_mm_loadu_ps(m3 + c * 4), w3));
+                    col[c] = v;
+                }
+
+                const glm::vec3& p = skin.Positions[i];
+                __m128 r = _mm_add_ps(_mm_mul_ps(col[0], _mm_set1_ps(p.x)), col[3]);
+                r = _mm_add_ps(r, _mm_mul_ps(col[1], _mm_set1_ps(p.y)));
+                r = _mm_add_ps(r, _mm_mul_ps(col[2], _mm_set1_ps(p.z)));
+                _mm_store_ps(result, r);
+                positions[i] = glm::vec3(result[0], result[1], result[2]);
+
+                if (hasNormals) {
+                    const glm::vec3& n = skin.Normals[i];
+                    __m128 rn = _mm_mul_ps(col[0], _mm_set1_ps(n.x));
+                    rn = _mm_add_ps(rn, _mm_mul_ps(col[1], _mm_set1_ps(n.y)));
+                    rn = _mm_add_ps(rn, _mm_mul_ps(col[2], _mm_set1_ps(n.z)));
+                    _mm_store_ps(result, rn);
+                    const glm::vec3 out(result[0], result[1], result[2]);
+                    const float len2 = glm::dot(out, out);
+                    normals[i] = len2 > 0.0f ? out / std::sqrt(len2) : n;
+                }
+            }
+        }
+
+        bool HasSimdSkinning() { return true; }
+
+#else
+
+        void SkinVertices(const SkinData& skin, const glm::mat4* skinning,
+            glm::vec3* positions, glm::vec3* normals, std::size_t begin, std::size_t end) {
+            SkinVerticesScalar(skin, skinning, positions, normals, begin, end);
+        }
+
+        bool HasSimdSkinning() { return false; }
+
+#endif
+    }
+
+} // namespace Engine
@@ -0,0 +1,99 @@
+/**
+ * @file AnimationPose.h
+ * @brief Clip decompression, pose blending, local-to-model evaluation and skinning
+ * @details Stateless building blocks used by AnimationSystem. They only read their
+ *          inputs and write their outputs, so any number of characters can be
+ *          evaluated in parallel, and none of them needs a scene or a GL context.
+ *          Per character and frame:
+ *          SampleClip (x2 when blending) -> BlendPoses -> LocalToModel ->
+ *          ComputeSkinningMatrices -> SkinVertices (CPU skinning only).
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "AnimationData.h"
+
+namespace Engine {
+
+    namespace Animation {
+
+        /**
+         * @brief Decode a "smallest three" rotation key (3 x uint16)
+         */
+        glm::quat DecodeRotation(const std::uint16_t* key);
+
+        /**
+         * @brief Decode a range-quantized vector key (3 x uint16)
+         */
+        glm::vec3 DecodeVector(const std::uint16_t* key, const glm::vec3& min, const glm::vec3& extent);
+
+        /**
+         * @brief Decompress a clip at a time into local joint poses
+         * @param clip Clip to sample
+         * @param time Seconds, clamped to [0, Duration]
+         * @param out Receives one pose per clip joint (resized)
+         */
+        void SampleClip(const AnimationClip& clip, float time, std::vector<JointPose>& out);
+
+        /**
+         * @brief Blend two local poses: out = a * (1 - weight) + b * weight
+         * @details Translation and scale are lerped, rotations nlerped along the shortest arc.
+         *          out may alias a.
+         */
+        void BlendPoses(const std::vector<JointPose>& a, const std::vector<JointPose>& b,
+            float weight, std::vector<JointPose>& out);
+
+        /**
+         * @brief Local pose of one joint as a matrix (T * R * S)
+         */
+        glm::mat4 ComposeMatrix(const JointPose& pose);
+
+        /**
+         * @brief Concatenate local poses down the hierarchy
+         * @param skeleton Joint parents (parents before children)
+         * @param local One pose per joint; joints past local.size() use the bind pose
+         * @param model Receives the model-space matrix of every joint (resized)
+         */
+        void LocalToModel(const Skeleton& skeleton, const std::vector<JointPose>& local,
+            std::vector<glm::mat4>& model);
+
+        /**
+         * @brief Model-space joint matrices times the inverse bind, ready for skinning
+         */
+        void ComputeSkinningMatrices(const Skeleton& skeleton, const std::vector<glm::mat4>& model,
+            std::vector<glm::mat4>& skinning);
+
+        /**
+         * @brief Linear blend skinning of a vertex range, SSE when available
+         * @param skin Bind-pose vertices and influences
+         * @param skinning One matrix per joint (ComputeSkinningMatrices)
+         * @param positions Output positions, at least end elements
+         * @param normals Output normals, at least end elements (nullptr to skip)
+         * @param begin First vertex
+         * @param end One past the last vertex
+         */
+        void SkinVertices(const SkinData& skin, const glm::mat4* skinning,
+            glm::vec3* positions, glm::vec3* normals, std::size_t begin, std::size_t end);
+
+        /**
+         * @brief Plain C++ version of SkinVertices, the reference the SIMD path is checked against
+         */
+        void SkinVerticesScalar(const SkinData& skin, const glm::mat4* skinning,
+            glm::vec3* positions, glm::vec3* normals, std::size_t begin, std::size_t end);
+
+        /**
+         * @brief Whether SkinVertices was built with the SSE path
+         */
+        bool HasSimdSkinning();
+    }
+
+} // namespace Engine
@@ -0,0 +1,199 @@
+/**
+ * @file AnimationSystem.cpp
+ * @brief Skeletal animation - clip playback, blending, pose evaluation and skinning
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "AnimationSystem.h"
+#include "AnimationPose.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/JobSystem.h>
+
+#include <tracy/Tracy.hpp>
+
+#include "../Core/CVar.h"
+#include "../ECS/SimulationLOD.h"
+#include "../Physics/PhysicsSystem.h"
+#include "../Utility/Logger.h"
+
+namespace Engine {
+
+    // Small batches balance better across workers; a skinned character is far more
+    // work than a pose-only one, so keep this low when CPU skinning is common.
+    static CVar<int> sAnimationBatchSize("anim.BatchSize", 16, 1, 4096,
+        "Animators per job when evaluating poses");
+
+    namespace {
+
+        bool IsValidClip(const AnimationSet& set, std::int32_t clip) {
+            return clip >= 0 && static_cast<std::size_t>(clip) < set.Clips.size();
+        }
+
+        /**
+         * @brief Advance a clip time, wrapping or clamping at the clip ends
+         */
+        float AdvanceTime(float time, float step, float duration, bool loop) {
+            if (duration <= 0.0f) return 0.0f;
+            time += step;
+            if (loop) {
+                time = std::fmod(time, duration);
+                if (time < 0.0f) time += duration;
+                return time;
+            }
+            return std::clamp(time, 0.0f, duration);
+        }
+
+    } // namespace
+
+    void AnimationSystem::OnInit(Scene* scene) {
+        // Optional: without physics the poses are simply evaluated on this thread
+        m_PhysicsSystem = scene ? scene->GetSystem<PhysicsSystem>() : nullptr;
+    }
+
+    void AnimationSystem::OnShutdown(Scene* scene) {
+        (void)scene;
+        m_Active.clear();
+        m_BatchScratch.clear();
+        m_PhysicsSystem = nullptr;
+    }
+
+    void AnimationSystem::Advance(AnimatorComponent& animator, float dt) {
+        const AnimationSet* set = animator.Animations.get();
+        if (!set || !animator.Playing) return;
+
+        const float step = dt * animator.Speed;
+        if (IsValidClip(*set, animator.Clip)) {
+            animator.Time = AdvanceTime(animator.Time, step,
+                set->Clips[static_cast<std::size_t>(animator.Clip)].Duration, animator.Loop);
+        }
+        if (IsValidClip(*set, animator.BlendClip)) {
+            animator.BlendTime = AdvanceTime(animator.BlendTime, step,
+                set->Clips[static_cast<std::size_t>(animator.BlendClip)].Duration, animator.Loop);
+        }
+    }
+
+    void AnimationSystem::Evaluate(AnimatorComponent& animator, std::vector<JointPose>& scratch) {
+        const AnimationSet* set = animator.Animations.get();
+        if (!set) return;
+        const Skeleton& skeleton = set->Skeleton;
+
+        // Local pose: the clip (or the bind pose), then the blend clip mixed in
+        const bool hasClip = IsValidClip(*set, animator.Clip);
+        const bool hasBlend = IsValidClip(*set, animator.BlendClip) && animator.BlendWeight > 0.0f;
+
+        if (hasClip) {
+            Animation::SampleClip(set->Clips[static_cast<std::size_t>(animator.Clip)], animator.Time, animator.LocalPose);
+        }
+        else {
+            animator.LocalPose = skeleton.BindPose;
+        }
+
+        if (hasBlend) {
+            Animation::SampleClip(set->Clips[static_cast<std::size_t>(animator.BlendClip)], animator.BlendTime, scratch);
+            Animation::BlendPoses(animator.LocalPose, scratch, animator.BlendWeight, animator.LocalPose);
+        }
+
+        Animation::LocalToModel(skeleton, animator.LocalPose, animator.ModelPose);
+        Animation::ComputeSkinningMatrices(skeleton, animator.ModelPose, animator.SkinningMatrices);
+
+        const std::size_t vertexCount = set->Skin.GetVertexCount();
+        if (animator.CpuSkinning && vertexCount > 0 && !animator.SkinningMatrices.empty()) {
+            animator.SkinnedPositions.resize(vertexCount);
+            animator.SkinnedNormals.resize(vertexCount);
+            Animation::SkinVertices(set->Skin, animator.SkinningMatrices.data(),
+                animator.SkinnedPositions.data(), animator.SkinnedNormals.data(), 0, vertexCount);
+        }
+    }
+
+    /**
+     * @brief Animate all animators for this frame
+     * @details
+     * 1) Bind animation sets to new animators and advance clip times (main thread).
+     * 2) Evaluate poses in batches on the job system and wait.
+     */
+    void AnimationSystem::OnUpdate(Scene* scene, Timestep ts) {
+        if (!scene || !IsEnabled()) return;
+        ZoneScopedN("Animation");
+
+        const float dt = ts.GetSeconds();
+        auto& reg = scene->GetRegistry();
+
+        // Stage phase: everything that touches the registry or the fetch callback
+        m_Active.clear();
+        std::uint32_t joints = 0;
+        std::uint32_t skinnedVertices = 0;
+
+        reg.view<AnimatorComponent>(entt::exclude<InactiveComponent>).each(
+            [&](entt::entity e, AnimatorComponent& animator) {
+                if (!animator.Animations && m_FetchAnimationSet) {
+                    animator.Animations = m_FetchAnimationSet(scene, e);
+                }
+                if (!animator.Animations) return;
+
+                const SimulationLODComponent* lod = reg.try_get<SimulationLODComponent>(e);
+                if (!SimulationLOD::ShouldTick(lod)) return;
+
+                Advance(animator, SimulationLOD::TickDelta(lod, dt));
+
+                joints += animator.Animations->Skeleton.GetJointCount();
+                if (animator.CpuSkinning) {
+                    skinnedVertices += static_cast<std::uint32_t>(animator.Animations->Skin.GetVertexCount());
+                }
+                m_Active.push_back(&animator);
+            }
+        );
+
+        const auto start = std::chrono::steady_clock::now();
+
+        const std::uint32_t count = static_cast<std::uint32_t>(m_Active.size());
+        const std::uint32_t batchSize = static_cast<std::uint32_t>(sAnimationBatchSize.Get());
+        const std::uint32_t batches = (count + batchSize - 1u) / batchSize;
+
+        if (m_BatchScratch.size() < batches) {
+            m_BatchScratch.resize(batches);
+        }
+
+        JPH::JobSystem* jobs = m_PhysicsSystem ? m_PhysicsSystem->GetJobSystem() : nullptr;
+        if (batches == 1u || !jobs) {
+            for (std::uint32_t i = 0; i < count; ++i) {
+                Evaluate(*m_Active[i], m_BatchScratch[i / batchSize]);
+            }
+        }
+        else if (batches > 1u) {
+            JPH::JobSystem::Barrier* barrier = jobs->CreateBarrier();
+            for (std::uint32_t b = 0; b < batches; ++b) {
+                const std::uint32_t begin = b * batchSize;
+                const std::uint32_t end = std::min(count, begin + batchSize);
+                std::vector<JointPose>* scratch = &m_BatchScratch[b];
+                JPH::JobHandle job = jobs->CreateJob("AnimationBatch", JPH::Color::sCyan,
+                    [this, begin, end, scratch]() {
+                        for (std::uint32_t i = begin; i < end; ++i) {
+                            Evaluate(*m_Active[i], *scratch);
+                        }
+                    });
+                barrier->AddJob(job);
+            }
+            jobs->WaitForJobs(barrier);
+            jobs->DestroyBarrier(barrier);
+        }
+
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        m_Stats.Characters = count;
+        m_Stats.Joints = joints;
+        m_Stats.SkinnedVertices = skinnedVertices;
+        m_Stats.Batches = batches;
+        m_Stats.EvaluateMs = ms;
+        m_Stats.CharactersPerMs = ms > 0.0 ? static_cast<double>(count) / ms : 0.0;
+        m_Stats.PeakMs = std::max(m_Stats.PeakMs, ms);
+    }
+
+} // namespace Engine
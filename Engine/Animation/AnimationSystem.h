@@ -0,0 +1,97 @@
+/**
+ * @file AnimationSystem.h
+ * @brief Skeletal animation - clip playback, blending, pose evaluation and skinning
+ * @details Advances every AnimatorComponent on the main thread, then evaluates the
+ *          poses in batches on the PhysicsSystem job system (inline without one).
+ *          Characters only read shared clip data and write their own component, so
+ *          batches never contend. Entities that SimulationLOD skips this frame keep
+ *          last frame's pose and catch up with the accumulated time on their next tick.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include "../ECS/Scene.h"
+#include "../ECS/System.h"
+#include "../ECS/Components.h"
+#include "AnimationData.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Engine {
+
+    class PhysicsSystem;
+
+    /**
+     * @brief Animation cost counters (last frame unless noted)
+     */
+    struct AnimationStats {
+        std::uint32_t Characters = 0;       ///< Animators evaluated
+        std::uint32_t Joints = 0;           ///< Joints evaluated over all animators
+        std::uint32_t SkinnedVertices = 0;  ///< Vertices skinned on the CPU
+        std::uint32_t Batches = 0;          ///< Jobs the evaluation was split into
+        double EvaluateMs = 0.0;            ///< Wall time of the batched evaluation
+        double CharactersPerMs = 0.0;       ///< Characters / EvaluateMs
+        double PeakMs = 0.0;                ///< Largest EvaluateMs since start
+    };
+
+    /**
+     * @brief Provides the animation set of an entity whose animator has none yet
+     * @return nullptr if the entity's mesh is not loaded (asked again next frame)
+     */
+    using FetchAnimationSetFn = std::function<std::shared_ptr<const AnimationSet>(Scene*, entt::entity)>;
+
+    /**
+     * @class AnimationSystem
+     * @brief ECS system that animates AnimatorComponents every frame
+     */
+    class AnimationSystem final : public System {
+    public:
+        void OnInit(Scene* scene) override;
+        void OnUpdate(Scene* scene, Timestep ts) override;
+        void OnShutdown(Scene* scene) override;
+
+        int GetPriority() const override { return 20; }
+        const char* GetName() const override { return "AnimationSystem"; }
+
+        /**
+         * @brief Set the provider that binds animation sets to new animators
+         */
+        void SetFetchAnimationSetCallback(FetchAnimationSetFn fn) { m_FetchAnimationSet = std::move(fn); }
+
+        const AnimationStats& GetStats() const { return m_Stats; }
+
+        /**
+         * @brief Advance an animator's clip times
+         * @param animator Animator to advance (needs Animations bound)
+         * @param dt Seconds to advance by, before Speed
+         */
+        static void Advance(AnimatorComponent& animator, float dt);
+
+        /**
+         * @brief Evaluate an animator's pose (and skin it if CpuSkinning is set)
+         * @details Safe to call from any thread for different animators. Usable without
+         *          a scene, which is how the pose pipeline is benchmarked.
+         * @param animator Animator to evaluate (needs Animations bound)
+         * @param scratch Pose buffer for the blend clip, reused between calls
+         */
+        static void Evaluate(AnimatorComponent& animator, std::vector<JointPose>& scratch);
+
+    private:
+        PhysicsSystem* m_PhysicsSystem = nullptr;
+        FetchAnimationSetFn m_FetchAnimationSet;
+
+        std::vector<AnimatorComponent*> m_Active;           ///< Animators evaluated this frame
+        std::vector<std::vector<JointPose>> m_BatchScratch; ///< One blend buffer per batch
+
+        AnimationStats m_Stats;
+    };
+
+} // namespace Engine
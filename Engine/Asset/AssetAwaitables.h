@@ -0,0 +1,48 @@
+#pragma once
+#ifndef __ASSET_AWAITABLES_H__
+#define __ASSET_AWAITABLES_H__
+
+/**
+ * @file AssetAwaitables.h
+ * @brief Coroutine awaitables for resource loads
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+//engine files
+#include "ResourceManager.h"
+#include "../ECS/Task.h"
+
+namespace Engine {
+
+    /**
+     * @brief Suspend a Task until a resource is loaded through RM
+     * @details RM loads synchronously on the main thread, so requests are queued and
+     *          the TaskRunner services a few per frame instead of stalling on all of
+     *          them at once. Resumes with the resource, or nullptr if loading failed.
+     *
+     * @example
+     *   MeshResource* mesh = co_await WaitForAsset<MeshResource>{ convertToFullGuid(guid, ResourceType::MESH) };
+     */
+    template<typename T>
+    struct WaitForAsset {
+        xresource::full_guid Guid;
+        T* Result = nullptr;
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(Task::Handle handle) {
+            handle.promise().Runner->SuspendUntilLoaded(handle, [this]() {
+                Result = RM.loadResource<T>(Guid);
+            });
+        }
+
+        T* await_resume() const noexcept { return Result; }
+    };
+
+}// end of namespace Engine
+
+#endif // __ASSET_AWAITABLES_H__
@@ -208,7 +208,14 @@ namespace Engine {
         ss << "    \"indexType\": \"" << EscapeJson(settings.indexType) << "\",\n";
         ss << "    \"scale\": " << settings.scale << ",\n";
         ss << "    \"optimizeVertices\": " << (settings.optimizeVertices ? "true" : "false") << ",\n";
-        ss << "    \"generateNormals\": " << (settings.generateNormals ? "true" : "false") << "\n";
+        ss << "    \"generateNormals\": " << (settings.generateNormals ? "true" : "false") << ",\n";
+        ss << "    \"generateCollisionHulls\": " << (settings.generateCollisionHulls ? "true" : "false") << ",\n";
+        ss << "    \"maxCollisionHulls\": " << settings.maxCollisionHulls << ",\n";
+        ss << "    \"maxHullVertices\": " << settings.maxHullVertices << ",\n";
+        ss << "    \"collisionResolution\": " << settings.collisionResolution << ",\n";
+        ss << "    \"collisionConcavity\": " << settings.collisionConcavity << ",\n";
+        ss << "    \"generateCollisionMesh\": " << (settings.generateCollisionMesh ? "true" : "false") << ",\n";
+        ss << "    \"collisionMeshTriangles\": " << settings.collisionMeshTriangles << "\n";
         ss << "  }\n";
         ss << "}\n";
 
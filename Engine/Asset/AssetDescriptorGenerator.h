@@ -63,6 +63,15 @@ namespace Engine {
 		//optimizations 
 		bool optimizeVertices = true; //remove duplicates and optimize cache
 		bool generateNormals = false; //generate if missing
+
+		//collision (stored after the render data in the compiled mesh)
+		bool generateCollisionHulls = false; //convex decomposition for dynamic bodies
+		int maxCollisionHulls = 8; //upper bound on convex pieces
+		int maxHullVertices = 32; //upper bound on points per piece
+		int collisionResolution = 32; //voxels along the longest axis
+		float collisionConcavity = 0.05f; //stop splitting below this wasted volume fraction
+		bool generateCollisionMesh = false; //simplified triangle mesh for static geometry
+		int collisionMeshTriangles = 1024; //target triangle count
 	};
 
 	//basic shader compilation settings
@@ -55,7 +55,90 @@ namespace Engine {
         uint32_t vertexStride = 0;                 // Bytes per vertex (if interleaved)
         uint32_t indexSize = 4;                    // 2 for uint16, 4 for uint32
 
-        uint32_t reserved[6] = { 0 };              // For future use
+        uint32_t hasCollision = 0;                 // 1 if a CompiledCollisionData section follows the indices
+        uint32_t hasSkeleton = 0;                  // 1 if a CompiledSkeletonData section follows (after collision)
+
+        uint32_t reserved[4] = { 0 };              // For future use
+    };
+
+    /**
+     * @brief Header for the collision section of a compiled mesh
+     * @details Follows the indices when CompiledMeshData::hasCollision is set:
+     *          uint32 hullVertexCounts[hullCount], vec3 hullVertices[hullVertexTotal],
+     *          vec3 meshVertices[meshVertexCount], uint32 meshIndices[meshIndexCount]
+     */
+    struct CompiledCollisionData {
+        char magic[4] = { 'C', 'O', 'L', '\0' };  // Magic number "COL"
+        uint32_t version = 1;                      // Format version
+
+        uint32_t hullCount = 0;                    // Convex pieces
+        uint32_t hullVertexTotal = 0;              // Points over all pieces
+        uint32_t meshVertexCount = 0;              // Simplified triangle mesh
+        uint32_t meshIndexCount = 0;
+
+        uint32_t reserved[2] = { 0 };              // For future use
+    };
+
+    /**
+     * @brief Header for the skeleton section of a compiled mesh
+     * @details Follows the collision section (or the indices) when CompiledMeshData::hasSkeleton
+     *          is set: CompiledJoint joints[jointCount], CompiledSkinVertex skin[vertexCount],
+     *          then per clip a CompiledClipData, CompiledAnimationChannel channels[channelCount],
+     *          uint16 keyFrames[keyCount] and uint16 keyValues[keyCount * 3].
+     *          See Animation/AnimationData.h for the key encoding.
+     */
+    struct CompiledSkeletonData {
+        char magic[4] = { 'S', 'K', 'N', '\0' };  // Magic number "SKN"
+        uint32_t version = 1;                      // Format version
+
+        uint32_t jointCount = 0;                   // Joints, parents before children
+        uint32_t clipCount = 0;                    // Animation clips
+        uint32_t vertexCount = 0;                  // Skinned vertices (the mesh vertex count)
+
+        uint32_t reserved[3] = { 0 };              // For future use
+    };
+
+    /**
+     * @brief One joint of a compiled skeleton
+     */
+    struct CompiledJoint {
+        char name[64] = {};                        // Null-terminated, truncated
+        int32_t parent = -1;                       // Earlier joint index, -1 for roots
+        float translation[3] = {};                 // Bind-pose local transform
+        float rotation[4] = { 0, 0, 0, 1 };        // Quaternion x, y, z, w
+        float scale[3] = { 1, 1, 1 };
+        float inverseBind[16] = {};                // Column-major, mesh space to joint space
+    };
+
+    /**
+     * @brief Joint influences of one vertex
+     */
+    struct CompiledSkinVertex {
+        uint16_t joints[4] = {};
+        uint8_t weights[4] = {};                   // Sum to 255
+    };
+
+    /**
+     * @brief Header of one compressed animation clip
+     */
+    struct CompiledClipData {
+        char name[64] = {};
+        float duration = 0.0f;                     // Seconds
+        float sampleRate = 30.0f;                  // Frames per second
+        uint32_t frameCount = 0;                   // Source frames (key frame indices are below this)
+        uint32_t channelCount = 0;                 // jointCount * 3 (rotation, translation, scale)
+        uint32_t keyCount = 0;                     // Keys over all channels
+        uint32_t reserved = 0;
+    };
+
+    /**
+     * @brief One key-reduced channel of a clip
+     */
+    struct CompiledAnimationChannel {
+        uint32_t firstKey = 0;
+        uint32_t keyCount = 0;
+        float min[3] = {};                         // Dequantization range (translation/scale)
+        float extent[3] = {};
     };
 
     /**
@@ -15,8 +15,11 @@
 
 #include "ResourceTypes.h"
 #include "../include/xresource_mgr.h"
+#include "../Animation/AnimationData.h"
+#include <memory>
 #include <string>
 #include <vector>
+#include <glm/glm.hpp>
 
 namespace Engine {
 
@@ -50,6 +53,14 @@ namespace Engine {
         unsigned int VBO = 0;  // Vertex Buffer Object
         unsigned int EBO = 0;  // Element Buffer Object
 
+        // Collision data baked by the asset compiler (empty if not requested)
+        std::vector<std::vector<glm::vec3>> collisionHulls;   // Convex pieces
+        std::vector<glm::vec3> collisionVertices;              // Simplified triangle mesh
+        std::vector<unsigned int> collisionIndices;
+
+        // Skeleton, clips and skin baked by the asset compiler (null if not skinned)
+        std::shared_ptr<const AnimationSet> animation;
+
         ~MeshResource() {
             // TODO: Release OpenGL buffers if needed
         }
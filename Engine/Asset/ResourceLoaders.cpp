@@ -15,6 +15,7 @@
 #include "../include/glad/glad.h" // OpenGL functions
 #include "../glm/glm/glm.hpp"
 
+#include <cstring>
 #include <fstream>
 #include <memory>
 
@@ -57,6 +58,123 @@ namespace Engine {
         return true;
     }
 
+    // Helper to check a count read from a file before sizing a buffer with it: count
+    // elements of elementSize bytes must still be in the file, so a corrupt or
+    // truncated file fails the read instead of allocating an arbitrary amount
+    static bool fitsInFile(std::ifstream& file, uint64_t count, uint64_t elementSize) {
+        const std::streampos position = file.tellg();
+        if (position < 0) return false;
+        file.seekg(0, std::ios::end);
+        const std::streampos end = file.tellg();
+        file.seekg(position);
+        return file && end >= position && count <= static_cast<uint64_t>(end - position) / elementSize;
+    }
+
+    // Helper to read the skeleton section of a compiled mesh
+    // Returns nullptr (and the caller keeps the static mesh) if the section is corrupt
+    static std::shared_ptr<AnimationSet> readSkeletonSection(std::ifstream& file,
+        const std::vector<float>& vertices, uint32_t vertexCount) {
+        CompiledSkeletonData skelHeader;
+        file.read(reinterpret_cast<char*>(&skelHeader), sizeof(skelHeader));
+        if (!file || strncmp(skelHeader.magic, "SKN", 3) != 0 ||
+            skelHeader.vertexCount != vertexCount || skelHeader.jointCount == 0 ||
+            skelHeader.jointCount > 0xffff) {
+            return nullptr;
+        }
+
+        auto set = std::make_shared<AnimationSet>();
+
+        // Joints
+        std::vector<CompiledJoint> joints(skelHeader.jointCount);
+        file.read(reinterpret_cast<char*>(joints.data()), joints.size() * sizeof(CompiledJoint));
+        if (!file) return nullptr;
+
+        Skeleton& skeleton = set->Skeleton;
+        skeleton.JointNames.resize(joints.size());
+        skeleton.Parents.resize(joints.size());
+        skeleton.BindPose.resize(joints.size());
+        skeleton.InverseBind.resize(joints.size());
+        for (size_t j = 0; j < joints.size(); ++j) {
+            const CompiledJoint& cj = joints[j];
+            if (cj.parent >= static_cast<int32_t>(j)) return nullptr;   // Parents must come first
+
+            skeleton.JointNames[j] = std::string(cj.name, strnlen(cj.name, sizeof(cj.name)));
+            skeleton.Parents[j] = cj.parent < 0 ? -1 : cj.parent;
+            skeleton.BindPose[j].Translation = glm::vec3(cj.translation[0], cj.translation[1], cj.translation[2]);
+            skeleton.BindPose[j].Rotation = glm::quat(cj.rotation[3], cj.rotation[0], cj.rotation[1], cj.rotation[2]);
+            skeleton.BindPose[j].Scale = glm::vec3(cj.scale[0], cj.scale[1], cj.scale[2]);
+            std::memcpy(&skeleton.InverseBind[j][0][0], cj.inverseBind, sizeof(cj.inverseBind));
+        }
+
+        // Skin: bind-pose vertices from the render data plus the influences
+        std::vector<CompiledSkinVertex> skinVertices(vertexCount);
+        file.read(reinterpret_cast<char*>(skinVertices.data()), skinVertices.size() * sizeof(CompiledSkinVertex));
+        if (!file) return nullptr;
+
+        SkinData& skin = set->Skin;
+        skin.Positions.resize(vertexCount);
+        skin.Normals.resize(vertexCount);
+        skin.Joints.resize(vertexCount);
+        skin.Weights.resize(vertexCount);
+        for (uint32_t i = 0; i < vertexCount; ++i) {
+            const float* v = &vertices[i * 11];
+            skin.Positions[i] = glm::vec3(v[0], v[1], v[2]);
+            skin.Normals[i] = glm::vec3(v[3], v[4], v[5]);
+
+            const CompiledSkinVertex& sv = skinVertices[i];
+            float total = 0.0f;
+            for (int k = 0; k < 4; ++k) {
+                if (sv.joints[k] >= skelHeader.jointCount) return nullptr;
+                skin.Joints[i][k] = sv.joints[k];
+                skin.Weights[i][k] = static_cast<float>(sv.weights[k]);
+                total += skin.Weights[i][k];
+            }
+            skin.Weights[i] = total > 0.0f ? skin.Weights[i] / total : glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
+        }
+
+        // Clips
+        if (!fitsInFile(file, skelHeader.clipCount, sizeof(CompiledClipData))) return nullptr;
+        set->Clips.resize(skelHeader.clipCount);
+        for (AnimationClip& clip : set->Clips) {
+            CompiledClipData clipHeader;
+            file.read(reinterpret_cast<char*>(&clipHeader), sizeof(clipHeader));
+            if (!file || clipHeader.channelCount != skelHeader.jointCount * ANIMATION_CHANNELS_PER_JOINT ||
+                clipHeader.frameCount == 0 || clipHeader.frameCount > 0x10000) {
+                return nullptr;
+            }
+
+            clip.Name = std::string(clipHeader.name, strnlen(clipHeader.name, sizeof(clipHeader.name)));
+            clip.Duration = clipHeader.duration;
+            clip.SampleRate = clipHeader.sampleRate;
+            clip.FrameCount = clipHeader.frameCount;
+
+            std::vector<CompiledAnimationChannel> channels(clipHeader.channelCount);
+            file.read(reinterpret_cast<char*>(channels.data()), channels.size() * sizeof(CompiledAnimationChannel));
+            // Each key is a frame index and three quantized values
+            if (!file || !fitsInFile(file, clipHeader.keyCount, 4 * sizeof(uint16_t))) return nullptr;
+            clip.KeyFrames.resize(clipHeader.keyCount);
+            file.read(reinterpret_cast<char*>(clip.KeyFrames.data()), clip.KeyFrames.size() * sizeof(uint16_t));
+            clip.KeyValues.resize(size_t(clipHeader.keyCount) * 3);
+            file.read(reinterpret_cast<char*>(clip.KeyValues.data()), clip.KeyValues.size() * sizeof(uint16_t));
+            if (!file) return nullptr;
+
+            clip.Channels.resize(channels.size());
+            for (size_t c = 0; c < channels.size(); ++c) {
+                const CompiledAnimationChannel& cc = channels[c];
+                if (cc.keyCount == 0 || uint64_t(cc.firstKey) + cc.keyCount > clipHeader.keyCount ||
+                    clip.KeyFrames[cc.firstKey] != 0) {
+                    return nullptr;
+                }
+                clip.Channels[c].FirstKey = cc.firstKey;
+                clip.Channels[c].KeyCount = cc.keyCount;
+                clip.Channels[c].Min = glm::vec3(cc.min[0], cc.min[1], cc.min[2]);
+                clip.Channels[c].Extent = glm::vec3(cc.extent[0], cc.extent[1], cc.extent[2]);
+            }
+        }
+
+        return set;
+    }
+
 } // namespace Engine
 
 
@@ -203,6 +321,16 @@ xresource::loader<Engine::ResourceGUID::mesh_type_guid_v>::Load(
     //validate magic number
     if (strncmp(meshHeader.magic, "MSH", 3) != 0) return nullptr;
 
+    // Counts must fit in the rest of the file before anything is sized from them
+    const uint64_t vertexBytes = (meshHeader.hasPositions ? sizeof(glm::vec3) : 0) + (meshHeader.hasNormals ? sizeof(glm::vec3) : 0) +
+        (meshHeader.hasColors ? sizeof(glm::vec3) : 0) + (meshHeader.hasTexCoords ? sizeof(glm::vec2) : 0);
+    const uint64_t indexBytes = meshHeader.indexSize == 2 ? sizeof(uint16_t) : sizeof(uint32_t);
+    if ((vertexBytes == 0 && meshHeader.vertexCount > 0) || !Engine::fitsInFile(file,
+            uint64_t(meshHeader.vertexCount) * vertexBytes + uint64_t(meshHeader.indexCount) * indexBytes, 1)) {
+        LOG_WARNING("MeshLoader - Vertex or index count past the end of the file: ", compiled_path);
+        return nullptr;
+    }
+
     // Create mesh resource
     auto mesh = std::make_unique<data_type>();
     // Prepare interleaved vertex data
@@ -287,6 +415,59 @@ xresource::loader<Engine::ResourceGUID::mesh_type_guid_v>::Load(
         return nullptr;
     }
 
+    // Read collision section (if baked); a bad section only loses the collision data
+    if (meshHeader.hasCollision) {
+        Engine::CompiledCollisionData colHeader;
+        file.read(reinterpret_cast<char*>(&colHeader), sizeof(colHeader));
+
+        // Every count is checked against the bytes left before it sizes a buffer
+        auto checkCount = [&file](uint64_t count, uint64_t elementSize) {
+            if (file && !Engine::fitsInFile(file, count, elementSize))
+                file.setstate(std::ios::failbit);
+            return bool(file);
+        };
+
+        if (file && strncmp(colHeader.magic, "COL", 3) == 0 && checkCount(colHeader.hullCount, sizeof(uint32_t))) {
+            std::vector<uint32_t> hullVertexCounts(colHeader.hullCount);
+            file.read(reinterpret_cast<char*>(hullVertexCounts.data()),
+                colHeader.hullCount * sizeof(uint32_t));
+
+            mesh->collisionHulls.resize(file ? colHeader.hullCount : 0);
+            for (uint32_t h = 0; h < colHeader.hullCount && checkCount(hullVertexCounts[h], sizeof(glm::vec3)); ++h) {
+                mesh->collisionHulls[h].resize(hullVertexCounts[h]);
+                file.read(reinterpret_cast<char*>(mesh->collisionHulls[h].data()),
+                    hullVertexCounts[h] * sizeof(glm::vec3));
+            }
+
+            if (checkCount(colHeader.meshVertexCount, sizeof(glm::vec3))) {
+                mesh->collisionVertices.resize(colHeader.meshVertexCount);
+                file.read(reinterpret_cast<char*>(mesh->collisionVertices.data()),
+                    colHeader.meshVertexCount * sizeof(glm::vec3));
+            }
+
+            if (checkCount(colHeader.meshIndexCount, sizeof(uint32_t))) {
+                mesh->collisionIndices.resize(colHeader.meshIndexCount);
+                file.read(reinterpret_cast<char*>(mesh->collisionIndices.data()),
+                    colHeader.meshIndexCount * sizeof(uint32_t));
+            }
+        }
+
+        if (!file) {
+            LOG_WARNING("MeshLoader - Corrupt collision section, ignoring: ", compiled_path);
+            mesh->collisionHulls.clear();
+            mesh->collisionVertices.clear();
+            mesh->collisionIndices.clear();
+        }
+    }
+
+    // Read skeleton section (if baked); a bad section only loses the animation data
+    if (meshHeader.hasSkeleton && file) {
+        mesh->animation = Engine::readSkeletonSection(file, mesh->vertices, meshHeader.vertexCount);
+        if (!mesh->animation) {
+            LOG_WARNING("MeshLoader - Corrupt skeleton section, ignoring: ", compiled_path);
+        }
+    }
+
 #if 0
     // Convert to interleaved format for OpenGL
     // Format: pos(3) + normal(3) + color(3) + uv(2) = 11 floats per vertex
@@ -2,9 +2,13 @@
 #include "ResourceManager.h"
 #include "AssetManager.h"
 #include "ResourceData.h"
+#include "../Core/CVar.h"
 
 namespace Engine {
 
+	static CVar<int> s_ResourceCapacity("res.Capacity", 10000, 1, 1 << 24,
+		"Maximum number of resources the resource manager can hold", CVAR_RESTART);
+
 	ResourceManager::ResourceManager() {
 		//setType("ResourceManager");
 		m_resource_mgr = std::make_unique<xresource::mgr>();
@@ -21,7 +25,7 @@ namespace Engine {
 
         try {
             // Initialize the xresource manager
-            m_resource_mgr->Initiallize(10000); // Support up to 10,000 resources
+            m_resource_mgr->Initiallize(s_ResourceCapacity.Get());
 
             // Set this ResourceManager as user data for the xresource manager
             // This allows loaders to access ResourceManager methods
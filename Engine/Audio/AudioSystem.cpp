@@ -57,7 +57,7 @@ namespace Engine {
 
 	void AudioSystem::UpdateListenerPosition(Scene* scene) {
 		auto& registry = scene->GetRegistry();
-		auto listenerview = registry.view<ListenerComponent>();
+		auto listenerview = registry.view<ListenerComponent>(entt::exclude<InactiveComponent>);
 
 		for (auto entityHandle : listenerview) {
 			Entity entity(entityHandle, &registry);
@@ -97,7 +97,7 @@ namespace Engine {
 
 	void AudioSystem::ProcessAudioEntities(Scene* scene) {
 		auto& registry = scene->GetRegistry();
-		auto view = registry.view<AudioComponent>();
+		auto view = registry.view<AudioComponent>(entt::exclude<InactiveComponent>);
 
 		for (auto entityHandle : view) {
 			Entity entity(entityHandle, &registry);
@@ -106,7 +106,10 @@ namespace Engine {
 			TransformComponent* transform = entity.HasComponent<TransformComponent>() ? &entity.GetComponent<TransformComponent>() : nullptr;
 			RigidbodyComponent* rb = entity.HasComponent<RigidbodyComponent>() ? &entity.GetComponent<RigidbodyComponent>() : nullptr;
 
-			UpdateAudioComponentState(entity, audio, transform, rb);
+			// Far sounds that are already playing only refresh their 3D attributes on tick frames
+			const bool settled = audio.State == PlayState::PLAY && audio.Channel && !audio.IsDirty;
+			if (!settled || SimulationLOD::ShouldTick(registry.try_get<SimulationLODComponent>(entityHandle)))
+				UpdateAudioComponentState(entity, audio, transform, rb);
 
 			//check if the audio has already stop playing if so ensure the channel in the audiocomponet
 			//becomes a nullptr to prevent dangling.
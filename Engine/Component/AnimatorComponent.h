@@ -0,0 +1,100 @@
+/**
+ * @file AnimatorComponent.h
+ * @brief Animator component - plays and blends skeletal animation clips
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include "../Asset/ResourceTypes.h"
+#include "../Animation/AnimationData.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Engine {
+
+    /**
+     * @brief Animator component - evaluates a skeleton pose every frame
+     * @details Driven by AnimationSystem. Gameplay picks Clip (and optionally BlendClip with
+     *          a BlendWeight to cross-fade or mix two clips); the system advances the clip
+     *          times, decompresses and blends the clips, and fills ModelPose and
+     *          SkinningMatrices. With CpuSkinning set it also skins the mesh into
+     *          SkinnedPositions/SkinnedNormals; otherwise SkinningMatrices is meant to be
+     *          uploaded for skinning in the vertex shader.
+     *
+     *          Animations is bound by the AnimationSystem fetch callback (or set directly)
+     *          from the compiled mesh the entity renders.
+     */
+    struct AnimatorComponent {
+        /// Unique identifier for this component instance
+        xresource::instance_guid ComponentGUID;
+
+        // ----- Playback -----
+
+        /// Index of the playing clip in Animations->Clips (-1 = bind pose)
+        std::int32_t Clip;
+
+        /// Index of a second clip mixed in by BlendWeight (-1 = none)
+        std::int32_t BlendClip;
+
+        /// Weight of BlendClip in [0, 1]; 0 plays Clip only, 1 plays BlendClip only
+        float BlendWeight;
+
+        /// Playback rate multiplier (negative plays backwards)
+        float Speed;
+
+        /// Current time in Clip, in seconds
+        float Time;
+
+        /// Current time in BlendClip, in seconds
+        float BlendTime;
+
+        /// Wrap around at the end of a clip instead of holding the last frame
+        bool Loop;
+
+        /// Advance the clip times every frame
+        bool Playing;
+
+        /// Skin the mesh on the CPU into SkinnedPositions/SkinnedNormals
+        bool CpuSkinning;
+
+        // ----- Runtime (not serialized) -----
+
+        /// Skeleton, clips and skin of the animated mesh
+        std::shared_ptr<const AnimationSet> Animations;
+
+        /// Local joint poses after sampling and blending
+        std::vector<JointPose> LocalPose;
+
+        /// Model-space joint matrices
+        std::vector<glm::mat4> ModelPose;
+
+        /// ModelPose times the inverse bind matrices, one per joint
+        std::vector<glm::mat4> SkinningMatrices;
+
+        /// CPU-skinned mesh (CpuSkinning only)
+        std::vector<glm::vec3> SkinnedPositions;
+        std::vector<glm::vec3> SkinnedNormals;
+
+        // Default constructor
+        AnimatorComponent()
+            : ComponentGUID(xresource::instance_guid::GenerateGUIDCopy()),
+            Clip(0),
+            BlendClip(-1),
+            BlendWeight(0.0f),
+            Speed(1.0f),
+            Time(0.0f),
+            BlendTime(0.0f),
+            Loop(true),
+            Playing(true),
+            CpuSkinning(false) {
+        }
+    };
+
+} // namespace Engine
@@ -0,0 +1,133 @@
+/**
+ * @file CharacterControllerComponent.h
+ * @brief Character controller component - capsule movement for players and NPCs
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include "../Asset/ResourceTypes.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+
+namespace Engine {
+
+    /**
+     * @brief What the character is standing on after the last update
+     */
+    enum class CharacterGroundState : uint8_t {
+        OnGround,           ///< Standing on walkable ground
+        OnSteepGround,      ///< Touching ground steeper than MaxSlopeAngle, slides down
+        NotSupported,       ///< Touching something that does not hold it up
+        InAir               ///< Not touching anything
+    };
+
+    /**
+     * @brief Character controller component - moves an entity as a virtual capsule
+     * @details Driven by CharacterControllerSystem through Jolt's CharacterVirtual, which
+     *          sweeps the capsule against the physics world instead of simulating a body.
+     *          Gameplay writes DesiredVelocity (and Jump) every frame; the system handles
+     *          gravity, walking up steps, sticking to the floor on the way down and
+     *          refusing slopes steeper than MaxSlopeAngle, then writes the resulting
+     *          position back to the TransformComponent.
+     *
+     *          The TransformComponent position is the bottom of the capsule (the feet).
+     *          Writing it from code teleports the character.
+     * @note Do not combine with a RigidbodyComponent on the same entity.
+     */
+    struct CharacterControllerComponent {
+        /// Unique identifier for this component instance
+        xresource::instance_guid ComponentGUID;
+
+        // ----- Shape -----
+
+        /// Total capsule height in meters (including both caps)
+        float Height;
+
+        /// Capsule radius in meters
+        float Radius;
+
+        // ----- Movement -----
+
+        /// Steepest walkable slope in degrees
+        float MaxSlopeAngle;
+
+        /// Highest step the character walks up without jumping (0 = off)
+        float StepHeight;
+
+        /// How far down the character snaps to the floor when walking off ledges or down slopes (0 = off)
+        float StickToFloorDistance;
+
+        /// Mass in kilograms, used when pushing dynamic bodies
+        float Mass;
+
+        /// Maximum force the character can push other bodies with (N)
+        float MaxStrength;
+
+        /// Whether gravity affects this character
+        bool UseGravity;
+
+        /// Upwards speed applied when jumping (m/s)
+        float JumpSpeed;
+
+        // ----- Input (written by gameplay, read by the system) -----
+
+        /// Wanted horizontal velocity in world space; the vertical part is ignored
+        glm::vec3 DesiredVelocity;
+
+        /// Set to jump; consumed by the next update, which only jumps if the character is on the ground
+        bool Jump;
+
+        // ----- State (written by the system) -----
+
+        /// Ground contact after the last update
+        CharacterGroundState GroundState;
+
+        /// Normal of the supporting surface (valid unless InAir)
+        glm::vec3 GroundNormal;
+
+        /// Velocity after the last update in world space
+        glm::vec3 Velocity;
+
+        /**
+         * @brief Default constructor - a 1.8 m tall human-sized capsule
+         */
+        CharacterControllerComponent()
+            : ComponentGUID(xresource::instance_guid::GenerateGUIDCopy())
+            , Height(1.8f)
+            , Radius(0.3f)
+            , MaxSlopeAngle(45.0f)
+            , StepHeight(0.4f)
+            , StickToFloorDistance(0.5f)
+            , Mass(70.0f)
+            , MaxStrength(100.0f)
+            , UseGravity(true)
+            , JumpSpeed(5.0f)
+            , DesiredVelocity(0.0f)
+            , Jump(false)
+            , GroundState(CharacterGroundState::InAir)
+            , GroundNormal(0.0f, 1.0f, 0.0f)
+            , Velocity(0.0f) {
+        }
+
+        /**
+         * @brief Check if the character stands on walkable ground
+         * @return True if GroundState is OnGround
+         */
+        bool IsGrounded() const {
+            return GroundState == CharacterGroundState::OnGround;
+        }
+
+        /**
+         * @brief Request a jump on the next update
+         */
+        void RequestJump() {
+            Jump = true;
+        }
+    };
+
+} // namespace Engine
@@ -0,0 +1,133 @@
+/**
+ * @file JointComponent.h
+ * @brief Joint component - constrains a rigidbody to another one or to the world
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include "../Asset/ResourceTypes.h"
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+
+namespace Engine {
+
+    /**
+     * @brief Kind of joint
+     */
+    enum class JointType {
+        Fixed,              ///< Welds the bodies together
+        Hinge,              ///< Rotates around Axis (doors, wheels); limits in degrees
+        Slider,             ///< Moves along Axis without rotating (pistons, drawers); limits in meters
+        Distance,           ///< Keeps Anchor and ConnectedAnchor apart (ropes, chains); limits in meters
+        Cone                ///< Ball joint whose Axis stays within ConeAngle (ragdoll shoulders)
+    };
+
+    /**
+     * @brief Joint component - connects this entity's rigidbody to another entity's
+     * @details Mapped to a Jolt constraint by PhysicsSystem. The joint is created once
+     *          both bodies exist, from their poses at that moment, and rebuilt when a
+     *          setting changes or a body is recreated. A null ConnectedEntity attaches
+     *          the body to the world.
+     *
+     *          Anchor and Axis are in this entity's local space (scaled). ConnectedAnchor
+     *          is used by Distance joints only and is local to the connected entity, or
+     *          a world position when connected to the world.
+     *
+     *          A joint with BreakForce or BreakTorque above zero breaks when the solver
+     *          needs more than that to hold it: IsBroken is set and a break event is
+     *          reported. Clearing IsBroken rebuilds the joint.
+     * @note Requires a RigidbodyComponent on this entity (and on ConnectedEntity if set).
+     */
+    struct JointComponent {
+        /// Unique identifier for this component instance
+        xresource::instance_guid ComponentGUID;
+
+        /// Kind of joint
+        JointType Type;
+
+        /// Other body (entt::null = the world)
+        entt::entity ConnectedEntity;
+
+        /// Joint position in local space
+        glm::vec3 Anchor;
+
+        /// Distance joint end point on the connected entity (local space, or world if none)
+        glm::vec3 ConnectedAnchor;
+
+        /// Hinge/slider axis or cone twist axis in local space
+        glm::vec3 Axis;
+
+        /// Whether MinLimit/MaxLimit apply (Hinge, Slider, Distance)
+        bool UseLimits;
+
+        /// Lower limit: degrees (Hinge, -180..0) or meters (Slider <= 0, Distance >= 0)
+        float MinLimit;
+
+        /// Upper limit: degrees (Hinge, 0..180) or meters (Slider >= 0, Distance)
+        float MaxLimit;
+
+        /// Half angle of the cone in degrees (Cone)
+        float ConeAngle;
+
+        /// Force in newtons that breaks the joint (0 = unbreakable)
+        float BreakForce;
+
+        /// Torque in newton-meters that breaks the joint (0 = unbreakable)
+        float BreakTorque;
+
+        /// Set by PhysicsSystem when the joint breaks; clear it to rebuild the joint
+        bool IsBroken;
+
+        /**
+         * @brief Default constructor - an unbreakable fixed joint to the world
+         */
+        JointComponent()
+            : ComponentGUID(xresource::instance_guid::GenerateGUIDCopy())
+            , Type(JointType::Fixed)
+            , ConnectedEntity(entt::null)
+            , Anchor(0.0f)
+            , ConnectedAnchor(0.0f)
+            , Axis(0.0f, 1.0f, 0.0f)
+            , UseLimits(false)
+            , MinLimit(0.0f)
+            , MaxLimit(0.0f)
+            , ConeAngle(45.0f)
+            , BreakForce(0.0f)
+            , BreakTorque(0.0f)
+            , IsBroken(false) {
+        }
+
+        /**
+         * @brief Connect to another entity's rigidbody
+         * @param other Entity to connect to (entt::null = the world)
+         */
+        void Connect(entt::entity other) {
+            ConnectedEntity = other;
+        }
+
+        /**
+         * @brief Limit the joint's travel
+         * @param minLimit Lower limit (degrees or meters, see MinLimit)
+         * @param maxLimit Upper limit (degrees or meters, see MaxLimit)
+         */
+        void SetLimits(float minLimit, float maxLimit) {
+            UseLimits = true;
+            MinLimit = minLimit;
+            MaxLimit = maxLimit;
+        }
+
+        /**
+         * @brief Check if the joint can break
+         * @return True if a break force or torque is set
+         */
+        bool IsBreakable() const {
+            return BreakForce > 0.0f || BreakTorque > 0.0f;
+        }
+    };
+
+} // namespace Engine
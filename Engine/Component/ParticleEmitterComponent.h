@@ -0,0 +1,134 @@
+/**
+ * @file ParticleEmitterComponent.h
+ * @brief Particle emitter component - spawns and draws a pool of billboard particles
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include "../Asset/ResourceTypes.h"
+#include "../Particles/ParticleData.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+
+namespace Engine {
+
+    /**
+     * @brief Particle emitter component - one effect made of many particles
+     * @details Driven by ParticleSystem. Particles are not entities: they live in a
+     *          structure-of-arrays pool owned by the emitter, are simulated in world
+     *          space (moving the emitter does not drag live particles along), and are
+     *          drawn with one instanced draw per emitter, sorted back to front.
+     *
+     *          The emitter spawns from the TransformComponent position; Velocity is in
+     *          the emitter's local frame, so rotating the entity aims the effect.
+     */
+    struct ParticleEmitterComponent {
+        /// Unique identifier for this component instance
+        xresource::instance_guid ComponentGUID;
+
+        // ----- Emission -----
+
+        /// Spawn new particles (live ones finish their lifetime either way)
+        bool Emitting;
+
+        /// Particles spawned per second
+        float Rate;
+
+        /// Particles spawned at once when the emitter starts
+        std::uint32_t Burst;
+
+        /// Pool size; spawning stops while this many particles are alive
+        std::uint32_t MaxParticles;
+
+        /// Lifetime range in seconds, picked per particle
+        float LifetimeMin;
+        float LifetimeMax;
+
+        /// Spawn inside a sphere of this radius around the emitter
+        float SpawnRadius;
+
+        /// Initial velocity in the emitter's local frame (m/s)
+        glm::vec3 Velocity;
+
+        /// Random velocity added per axis, +-m/s
+        float Spread;
+
+        // ----- Simulation -----
+
+        /// Constant acceleration (m/s^2), world space
+        glm::vec3 Gravity;
+
+        /// Fraction of velocity lost per second
+        float Drag;
+
+        /// Collide with a plane (world space: dot(CollisionNormal, p) >= CollisionOffset)
+        bool Collide;
+        glm::vec3 CollisionNormal;
+        float CollisionOffset;
+
+        /// Normal velocity kept after a bounce, 0 = stick, 1 = perfectly elastic
+        float Restitution;
+
+        // ----- Appearance -----
+
+        /// Color over life, linear from start to end (RGBA in [0, 1])
+        glm::vec4 StartColor;
+        glm::vec4 EndColor;
+
+        /// Billboard size over life, linear from start to end (m)
+        float StartSize;
+        float EndSize;
+
+        /// Blend additively (fire, sparks) instead of alpha blending (smoke, dust)
+        bool Additive;
+
+        /// Sort back to front before drawing (additive effects are never sorted, order does not matter)
+        bool SortByDepth;
+
+        // ----- Runtime (not serialized) -----
+
+        /// Live particles, created by ParticleSystem on first update
+        std::shared_ptr<ParticlePool> Pool;
+
+        /// Fractional particles carried to the next frame
+        float SpawnAccumulator;
+
+        /// Whether Burst has been spawned since Emitting was last turned on
+        bool BurstDone;
+
+        // Default constructor
+        ParticleEmitterComponent()
+            : ComponentGUID(xresource::instance_guid::GenerateGUIDCopy()),
+            Emitting(true),
+            Rate(50.0f),
+            Burst(0),
+            MaxParticles(1000),
+            LifetimeMin(1.0f),
+            LifetimeMax(2.0f),
+            SpawnRadius(0.0f),
+            Velocity(0.0f, 2.0f, 0.0f),
+            Spread(0.5f),
+            Gravity(0.0f, -9.81f, 0.0f),
+            Drag(0.0f),
+            Collide(false),
+            CollisionNormal(0.0f, 1.0f, 0.0f),
+            CollisionOffset(0.0f),
+            Restitution(0.5f),
+            StartColor(1.0f, 1.0f, 1.0f, 1.0f),
+            EndColor(1.0f, 1.0f, 1.0f, 0.0f),
+            StartSize(0.1f),
+            EndSize(0.1f),
+            Additive(false),
+            SortByDepth(true),
+            SpawnAccumulator(0.0f),
+            BurstDone(false) {
+        }
+    };
+
+} // namespace Engine
@@ -0,0 +1,50 @@
+/**
+ * @file PooledComponent.h
+ * @brief Pooled component - marks entities owned by a PrefabPool
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include "../Asset/ResourceTypes.h"
+#include <cstdint>
+
+namespace Engine {
+
+    /**
+     * @brief Pooled component - links a recycled entity back to its prefab pool
+     * @note Runtime only, never serialized. Added by PrefabPool when an instance is created.
+     * @details Pooled entities are never destroyed by gameplay; they are released back
+     *          to their pool, reset to prefab defaults and parked until the next spawn.
+     */
+    struct PooledComponent {
+        /// Prefab this instance was created from (pool key)
+        xresource::instance_guid PrefabGUID;
+
+        /// Incremented every time the instance is handed out, lets callers detect reuse
+        std::uint32_t Generation;
+
+        PooledComponent()
+            : PrefabGUID(xresource::instance_guid{})
+            , Generation(0) {
+        }
+
+        explicit PooledComponent(xresource::instance_guid prefabGuid)
+            : PrefabGUID(prefabGuid)
+            , Generation(0) {
+        }
+    };
+
+    /**
+     * @brief Inactive tag - entity is alive but excluded from simulation and rendering
+     * @details Systems exclude this tag from their views (entt::exclude<InactiveComponent>).
+     *          PhysicsSystem keeps the body of an inactive entity out of the broadphase
+     *          instead of destroying it.
+     */
+    struct InactiveComponent {};
+
+} // namespace Engine
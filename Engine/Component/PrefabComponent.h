@@ -11,6 +11,9 @@
 #pragma once
 
 #include "../Asset/ResourceTypes.h"
+#include "../Serialization/Property.h"
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 #include <string>
 
@@ -21,7 +24,8 @@ namespace Engine {
      * @note This is an invisible component that marks an entity as a prefab instance
      * @details Stores information about which prefab this entity is an instance of,
      *          and tracks any modifications (overrides, additions, deletions) made to
-     *          the instance that differ from the original prefab.
+     *          the instance that differ from the original prefab. Overrides are computed
+     *          and applied by PrefabOverrides.
      */
     struct PrefabComponent {
         /// Unique identifier for this component instance
@@ -30,23 +34,30 @@ namespace Engine {
         /// Reference to the prefab resource this entity is an instance of
         xresource::instance_guid PrefabGUID;
 
-        /// Track added components (components not in original prefab)
-        std::vector<xresource::instance_guid> AddedComponents;
-
-        /// Track deleted components (components removed from prefab)
-        std::vector<xresource::instance_guid> DeletedComponents;
-
         /**
-         * @brief Represents a single overridden property in a prefab instance
+         * @brief A single property that differs from the prefab default
+         * @details Components and properties are keyed by HashReflectionName of their
+         *          reflected names; the value is stored as raw typed bytes in OverrideData.
          */
-        struct OverriddenProperty {
-            xresource::instance_guid ComponentGUID;  ///< Which component contains this property
-            std::string PropertyPath;                 ///< Which property (e.g., "Position.x")
-            std::string Value;                        ///< Serialized value of the override
+        struct PropertyOverride {
+            uint32_t ComponentHash;  ///< Reflected component type name hash
+            uint32_t PropertyHash;   ///< Reflected property name hash
+            PropertyType Type;       ///< Value type, checked before applying
+            uint32_t Offset;         ///< Byte offset of the value in OverrideData
+            uint32_t Size;           ///< Byte size of the value
         };
 
-        /// Track overridden properties (properties modified from prefab defaults)
-        std::vector<OverriddenProperty> OverriddenProperties;
+        /// Overridden properties (minimal diff against the prefab)
+        std::vector<PropertyOverride> Overrides;
+
+        /// Packed value bytes referenced by Overrides
+        std::vector<uint8_t> OverrideData;
+
+        /// Components present on the instance but not in the prefab (component name hashes)
+        std::vector<uint32_t> AddedComponents;
+
+        /// Prefab components removed from the instance (component name hashes)
+        std::vector<uint32_t> DeletedComponents;
 
         /**
          * @brief Default constructor - creates an invalid/unlinked prefab component
@@ -78,7 +89,7 @@ namespace Engine {
          * @return True if there are any overrides, additions, or deletions
          */
         bool HasModifications() const {
-            return !OverriddenProperties.empty() ||
+            return !Overrides.empty() ||
                 !AddedComponents.empty() ||
                 !DeletedComponents.empty();
         }
@@ -87,46 +98,64 @@ namespace Engine {
          * @brief Clear all local modifications (reset to prefab defaults)
          */
         void ClearModifications() {
-            OverriddenProperties.clear();
+            Overrides.clear();
+            OverrideData.clear();
             AddedComponents.clear();
             DeletedComponents.clear();
         }
 
         /**
-         * @brief Add a property override
-         * @param componentGuid GUID of the component containing the property
-         * @param propertyPath Path to the property (e.g., "Position.x")
-         * @param value Serialized value of the override
+         * @brief Find the override for a property
+         * @return Pointer to the override, or nullptr if the property is not overridden
+         */
+        const PropertyOverride* FindPropertyOverride(uint32_t componentHash, uint32_t propertyHash) const {
+            for (const auto& override : Overrides) {
+                if (override.ComponentHash == componentHash && override.PropertyHash == propertyHash) {
+                    return &override;
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Add or replace a property override
+         * @param componentHash Reflected component name hash
+         * @param propertyHash Reflected property name hash
+         * @param type Property value type
+         * @param data Raw value bytes
+         * @param size Number of value bytes
          */
-        void AddPropertyOverride(xresource::instance_guid componentGuid,
-            const std::string& propertyPath,
-            const std::string& value) {
-            // Check if this property is already overridden
-            for (auto& override : OverriddenProperties) {
-                if (override.ComponentGUID.m_Value == componentGuid.m_Value &&
-                    override.PropertyPath == propertyPath) {
-                    // Update existing override
-                    override.Value = value;
+        void SetPropertyOverride(uint32_t componentHash, uint32_t propertyHash,
+            PropertyType type, const uint8_t* data, uint32_t size) {
+            for (auto& override : Overrides) {
+                if (override.ComponentHash == componentHash && override.PropertyHash == propertyHash) {
+                    // Same size values are rewritten in place, otherwise moved to the end
+                    if (override.Size != size) {
+                        EraseOverrideBytes(override);
+                        override.Offset = static_cast<uint32_t>(OverrideData.size());
+                        override.Size = size;
+                        OverrideData.resize(OverrideData.size() + size);
+                    }
+                    override.Type = type;
+                    std::copy(data, data + size, OverrideData.begin() + override.Offset);
                     return;
                 }
             }
 
-            // Add new override
-            OverriddenProperties.push_back({ componentGuid, propertyPath, value });
+            uint32_t offset = static_cast<uint32_t>(OverrideData.size());
+            OverrideData.insert(OverrideData.end(), data, data + size);
+            Overrides.push_back({ componentHash, propertyHash, type, offset, size });
         }
 
         /**
          * @brief Remove a property override
-         * @param componentGuid GUID of the component containing the property
-         * @param propertyPath Path to the property
          * @return True if an override was removed
          */
-        bool RemovePropertyOverride(xresource::instance_guid componentGuid,
-            const std::string& propertyPath) {
-            for (auto it = OverriddenProperties.begin(); it != OverriddenProperties.end(); ++it) {
-                if (it->ComponentGUID.m_Value == componentGuid.m_Value &&
-                    it->PropertyPath == propertyPath) {
-                    OverriddenProperties.erase(it);
+        bool RemovePropertyOverride(uint32_t componentHash, uint32_t propertyHash) {
+            for (auto it = Overrides.begin(); it != Overrides.end(); ++it) {
+                if (it->ComponentHash == componentHash && it->PropertyHash == propertyHash) {
+                    EraseOverrideBytes(*it);
+                    Overrides.erase(it);
                     return true;
                 }
             }
@@ -135,58 +164,55 @@ namespace Engine {
 
         /**
          * @brief Mark a component as added (not in original prefab)
-         * @param componentGuid GUID of the added component
+         * @param componentHash Reflected component name hash
          */
-        void MarkComponentAdded(xresource::instance_guid componentGuid) {
-            // Check if already marked
-            for (const auto& guid : AddedComponents) {
-                if (guid.m_Value == componentGuid.m_Value) {
-                    return;
-                }
+        void MarkComponentAdded(uint32_t componentHash) {
+            if (!IsComponentAdded(componentHash)) {
+                AddedComponents.push_back(componentHash);
             }
-            AddedComponents.push_back(componentGuid);
         }
 
         /**
          * @brief Mark a component as deleted (removed from prefab)
-         * @param componentGuid GUID of the deleted component
+         * @param componentHash Reflected component name hash
          */
-        void MarkComponentDeleted(xresource::instance_guid componentGuid) {
-            // Check if already marked
-            for (const auto& guid : DeletedComponents) {
-                if (guid.m_Value == componentGuid.m_Value) {
-                    return;
-                }
+        void MarkComponentDeleted(uint32_t componentHash) {
+            if (!IsComponentDeleted(componentHash)) {
+                DeletedComponents.push_back(componentHash);
             }
-            DeletedComponents.push_back(componentGuid);
         }
 
         /**
          * @brief Check if a component was added to this instance
-         * @param componentGuid GUID of the component to check
-         * @return True if the component is marked as added
          */
-        bool IsComponentAdded(xresource::instance_guid componentGuid) const {
-            for (const auto& guid : AddedComponents) {
-                if (guid.m_Value == componentGuid.m_Value) {
-                    return true;
-                }
-            }
-            return false;
+        bool IsComponentAdded(uint32_t componentHash) const {
+            return std::find(AddedComponents.begin(), AddedComponents.end(), componentHash) != AddedComponents.end();
         }
 
         /**
          * @brief Check if a component was deleted from this instance
-         * @param componentGuid GUID of the component to check
-         * @return True if the component is marked as deleted
          */
-        bool IsComponentDeleted(xresource::instance_guid componentGuid) const {
-            for (const auto& guid : DeletedComponents) {
-                if (guid.m_Value == componentGuid.m_Value) {
-                    return true;
+        bool IsComponentDeleted(uint32_t componentHash) const {
+            return std::find(DeletedComponents.begin(), DeletedComponents.end(), componentHash) != DeletedComponents.end();
+        }
+
+    private:
+        /**
+         * @brief Drop an override's value bytes and close the gap
+         * @details Keeps OverrideData as large as the live values, however often an
+         *          override of varying size (a string) is edited or removed.
+         */
+        void EraseOverrideBytes(const PropertyOverride& removed) {
+            if (removed.Offset + removed.Size > OverrideData.size()) {
+                return;
+            }
+
+            OverrideData.erase(OverrideData.begin() + removed.Offset, OverrideData.begin() + removed.Offset + removed.Size);
+            for (auto& override : Overrides) {
+                if (&override != &removed && override.Offset > removed.Offset) {
+                    override.Offset -= removed.Size;
                 }
             }
-            return false;
         }
     };
 
@@ -0,0 +1,42 @@
+/**
+ * @file ReplicatedComponent.h
+ * @brief Replicated component - network identity of an entity
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace Engine {
+
+    /**
+     * @brief Replicated component - links an entity to its network id
+     * @note Runtime only, never serialized.
+     * @details On the sending side ReplicationServer adds it to every entity it
+     *          replicates; on the receiving side ReplicationClient adds it to the
+     *          entities it creates. The same NetId names the same entity on both ends.
+     */
+    struct ReplicatedComponent {
+        /// Id shared by sender and receiver (0 = not assigned)
+        std::uint32_t NetId;
+
+        /// Relative send priority, multiplies the distance-based relevance
+        float Priority;
+
+        ReplicatedComponent()
+            : NetId(0)
+            , Priority(1.0f) {
+        }
+
+        explicit ReplicatedComponent(std::uint32_t netId)
+            : NetId(netId)
+            , Priority(1.0f) {
+        }
+    };
+
+} // namespace Engine
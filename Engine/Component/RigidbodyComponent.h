@@ -15,6 +15,14 @@
 
 namespace Engine {
 
+    /**
+     * @brief How collisions are detected for a moving body
+     */
+    enum class RigidbodyMotionQuality {
+        Discrete,           ///< Collide at the end of each step (cheap, fast bodies can tunnel)
+        LinearCast          ///< Sweep the body along its velocity (continuous collision, for projectiles)
+    };
+
     /**
      * @brief Rigidbody component - defines physics properties for dynamic objects
      * @details Contains mass, velocity, and physics flags that control how an
@@ -37,14 +45,32 @@ namespace Engine {
         /// Current velocity in world space (units per second)
         glm::vec3 Velocity;
 
-        // Future fields (planned for Jolt Physics integration):
-        // glm::vec3 AngularVelocity;     // Rotation velocity
-        // float LinearDamping;            // Air resistance for linear motion
-        // float AngularDamping;           // Air resistance for rotation
-        // float Restitution;              // Bounciness (0 = no bounce, 1 = perfect bounce)
-        // float Friction;                 // Surface friction coefficient
-        // bool IsSleeping;                // Whether physics body is sleeping
-        // CollisionShape Shape;           // Collision shape type
+        /// Current angular velocity in world space (radians per second)
+        glm::vec3 AngularVelocity;
+
+        /// Air resistance for linear motion (fraction of velocity lost per second)
+        float LinearDamping;
+
+        /// Air resistance for rotation (fraction of angular velocity lost per second)
+        float AngularDamping;
+
+        /// Bounciness (0 = no bounce, 1 = perfect bounce)
+        float Restitution;
+
+        /// Surface friction coefficient (0 = ice, 1 = rubber)
+        float Friction;
+
+        /// Collision detection mode; LinearCast only where tunnelling matters
+        RigidbodyMotionQuality MotionQuality;
+
+        /// Whether the body may fall asleep when it comes to rest
+        bool AllowSleeping;
+
+        /// Merge the colliders of child entities without a rigidbody into this body's shape
+        bool CompoundChildren;
+
+        /// Whether the body is asleep (written by PhysicsSystem, read-only for gameplay)
+        bool IsSleeping;
 
         /**
          * @brief Default constructor - creates a standard dynamic rigidbody
@@ -54,7 +80,16 @@ namespace Engine {
             , Mass(1.0f)
             , IsKinematic(false)
             , UseGravity(true)
-            , Velocity(0.0f, 0.0f, 0.0f) {
+            , Velocity(0.0f, 0.0f, 0.0f)
+            , AngularVelocity(0.0f, 0.0f, 0.0f)
+            , LinearDamping(0.05f)
+            , AngularDamping(0.05f)
+            , Restitution(0.1f)
+            , Friction(0.6f)
+            , MotionQuality(RigidbodyMotionQuality::Discrete)
+            , AllowSleeping(true)
+            , CompoundChildren(false)
+            , IsSleeping(false) {
         }
 
         /**
@@ -66,7 +101,16 @@ namespace Engine {
             , Mass(mass)
             , IsKinematic(false)
             , UseGravity(true)
-            , Velocity(0.0f, 0.0f, 0.0f) {
+            , Velocity(0.0f, 0.0f, 0.0f)
+            , AngularVelocity(0.0f, 0.0f, 0.0f)
+            , LinearDamping(0.05f)
+            , AngularDamping(0.05f)
+            , Restitution(0.1f)
+            , Friction(0.6f)
+            , MotionQuality(RigidbodyMotionQuality::Discrete)
+            , AllowSleeping(true)
+            , CompoundChildren(false)
+            , IsSleeping(false) {
         }
 
         /**
@@ -133,6 +177,30 @@ namespace Engine {
             return Velocity;
         }
 
+        /**
+         * @brief Set the angular velocity
+         * @param angularVelocity New angular velocity in world space (radians per second)
+         */
+        void SetAngularVelocity(const glm::vec3& angularVelocity) {
+            AngularVelocity = angularVelocity;
+        }
+
+        /**
+         * @brief Get the angular velocity
+         * @return Current angular velocity in world space (radians per second)
+         */
+        const glm::vec3& GetAngularVelocity() const {
+            return AngularVelocity;
+        }
+
+        /**
+         * @brief Enable/disable continuous collision detection
+         * @param enabled True for LinearCast, false for Discrete
+         */
+        void SetContinuousCollision(bool enabled) {
+            MotionQuality = enabled ? RigidbodyMotionQuality::LinearCast : RigidbodyMotionQuality::Discrete;
+        }
+
         /**
          * @brief Add force to the velocity (impulse)
          * @param force Force vector to add
@@ -154,6 +222,7 @@ namespace Engine {
          */
         void Stop() {
             Velocity = glm::vec3(0.0f);
+            AngularVelocity = glm::vec3(0.0f);
         }
 
         /**
@@ -0,0 +1,66 @@
+/**
+ * @file SimulationLODComponent.h
+ * @brief Simulation level-of-detail state - how often an entity is simulated
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+
+namespace Engine {
+
+    /**
+     * @brief Per-entity simulation LOD state, written by SimulationLOD every frame
+     * @note Runtime only, never serialized. Added automatically to every entity with a
+     *       TransformComponent while simulation LOD is enabled.
+     * @details Systems that opt in to bucketed iteration check Tick (or
+     *          SimulationLOD::ShouldTick) and skip the entity on the other frames.
+     *          Poses are snapshotted on tick frames so TransformSystem can interpolate
+     *          between the last two ticks instead of stepping.
+     */
+    struct SimulationLODComponent {
+        /// Index of the distance bucket the entity currently sits in
+        std::uint8_t Bucket = 0;
+
+        /// Simulated every Interval frames (1 = every frame)
+        std::uint32_t Interval = 1;
+
+        /// Frame offset within the interval, spreads a bucket evenly across frames
+        std::uint32_t Phase = 0;
+
+        /// True on frames where bucketed systems should process the entity
+        bool Tick = true;
+
+        /// Time accumulated since the previous tick, valid on tick frames
+        float TickDelta = 0.0f;
+
+        /// Time accumulated since the last tick
+        float Accumulated = 0.0f;
+
+        /// Progress towards the next tick in [0, 1), used for interpolation
+        float Alpha = 0.0f;
+
+        /// Never bucket this entity (player, hero NPCs, cutscene actors)
+        bool AlwaysTick = false;
+
+        /// Blend the rendered pose between the last two ticks (root entities only)
+        bool Interpolate = true;
+
+        // Poses at the last two ticks
+        glm::vec3 PrevPosition = glm::vec3(0.0f);
+        glm::quat PrevRotation = glm::quat(1, 0, 0, 0);
+        glm::vec3 PrevScale = glm::vec3(1.0f);
+        glm::vec3 LastPosition = glm::vec3(0.0f);
+        glm::quat LastRotation = glm::quat(1, 0, 0, 0);
+        glm::vec3 LastScale = glm::vec3(1.0f);
+        bool HasPoses = false;
+    };
+
+} // namespace Engine
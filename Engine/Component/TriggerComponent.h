@@ -0,0 +1,98 @@
+/**
+ * @file TriggerComponent.h
+ * @brief Trigger component - volume that reports bodies entering and leaving it
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include "../Asset/ResourceTypes.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+
+namespace Engine {
+
+    /**
+     * @brief Shape of a trigger volume
+     */
+    enum class TriggerShape {
+        Box,                ///< Oriented box of HalfExtents
+        Sphere              ///< Sphere of Radius
+    };
+
+    /**
+     * @brief Trigger component - a volume that detects bodies without colliding with them
+     * @details Backed by a Jolt sensor body owned by PhysicsSystem, placed and oriented by
+     *          the TransformComponent (extents are multiplied by its scale). Dynamic
+     *          rigidbodies and character controllers are detected; static and kinematic
+     *          rigidbodies and other triggers are not. Enter and exit events are reported
+     *          once per physics step through PhysicsSystem::GetTriggerEvents() and the
+     *          trigger callback.
+     *
+     *          A body that falls asleep inside the volume still counts as inside. An idle
+     *          trigger costs nothing per step, so pickups and zones can be placed freely.
+     * @note Can live on the same entity as a RigidbodyComponent; the sensor is a separate body.
+     */
+    struct TriggerComponent {
+        /// Unique identifier for this component instance
+        xresource::instance_guid ComponentGUID;
+
+        /// Volume shape
+        TriggerShape Shape;
+
+        /// Box half size in meters (Box only)
+        glm::vec3 HalfExtents;
+
+        /// Sphere radius in meters (Sphere only)
+        float Radius;
+
+        /// Whether the trigger detects anything; disabling it reports exits for everything inside
+        bool Enabled;
+
+        /// Bodies currently inside (written by PhysicsSystem, read-only for gameplay)
+        uint32_t OverlapCount;
+
+        /**
+         * @brief Default constructor - a 1 m box
+         */
+        TriggerComponent()
+            : ComponentGUID(xresource::instance_guid::GenerateGUIDCopy())
+            , Shape(TriggerShape::Box)
+            , HalfExtents(0.5f, 0.5f, 0.5f)
+            , Radius(0.5f)
+            , Enabled(true)
+            , OverlapCount(0) {
+        }
+
+        /**
+         * @brief Make this a box trigger
+         * @param halfExtents Box half size in meters
+         */
+        void SetBox(const glm::vec3& halfExtents) {
+            Shape = TriggerShape::Box;
+            HalfExtents = halfExtents;
+        }
+
+        /**
+         * @brief Make this a sphere trigger
+         * @param radius Sphere radius in meters
+         */
+        void SetSphere(float radius) {
+            Shape = TriggerShape::Sphere;
+            Radius = radius;
+        }
+
+        /**
+         * @brief Check if anything is inside the volume
+         * @return True if at least one body overlaps it
+         */
+        bool IsOccupied() const {
+            return OverlapCount > 0;
+        }
+    };
+
+} // namespace Engine
@@ -1,20 +1,32 @@
 #include "Application.h"
 #include "Input.h"
+#include "InputRecording.h"
+#include "InputBackend.h"
+#include "CVar.h"
 #include "Utility/Logger.h"
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <tracy/Tracy.hpp>
-#include <sstream>
-#include <iomanip>
+#include <cstdio>
 
 namespace Engine {
 
+    SessionOptions Application::s_SessionOptions;
+
+    // Window size set by the application unless a config layer overrides it
+    static CVar<int> s_WindowWidth("win.Width", 1280, 64, 16384, "Initial window width", CVAR_RESTART);
+    static CVar<int> s_WindowHeight("win.Height", 720, 64, 16384, "Initial window height", CVAR_RESTART);
+    static CVar<int> s_VSync("r.VSync", -1, -1, 4, "Swap interval, -1 = 1 windowed / 0 headless");
+
     static void GLFWErrorCallback(int error, const char* description) {
         LOG_ERROR("GLFW Error (", error, "): ", description);
     }
 
     static void FramebufferSizeCallback(GLFWwindow* window, int width, int height) {
-        glViewport(0, 0, width, height);
+        // The context lives on the render thread in threaded mode
+        if (glfwGetCurrentContext() == window) {
+            glViewport(0, 0, width, height);
+        }
 
         Application* app = static_cast<Application*>(glfwGetWindowUserPointer(window));
         if (app) {
@@ -43,6 +55,11 @@ namespace Engine {
         LOG_INFO("  ", m_Name);
         LOG_INFO("===========================================");
 
+        if (s_SessionOptions.Headless) {
+            InitHeadless();
+            return;
+        }
+
         // Initialize GLFW
         glfwSetErrorCallback(GLFWErrorCallback);
 
@@ -59,6 +76,9 @@ namespace Engine {
         glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
         glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
 
+        if (s_WindowWidth.GetSource() != CVarSource::Default) m_WindowWidth = s_WindowWidth.Get();
+        if (s_WindowHeight.GetSource() != CVarSource::Default) m_WindowHeight = s_WindowHeight.Get();
+
         m_Window = glfwCreateWindow(m_WindowWidth, m_WindowHeight, m_Name.c_str(), nullptr, nullptr);
 
         if (!m_Window) {
@@ -70,7 +90,17 @@ namespace Engine {
         glfwSetWindowUserPointer(m_Window, this);
         glfwMakeContextCurrent(m_Window);
         glfwSetFramebufferSizeCallback(m_Window, FramebufferSizeCallback);
-        glfwSwapInterval(1); // VSync
+        // VSync: --vsync, else r.VSync, else off when headless (the frame limiter paces)
+        if (s_SessionOptions.SwapInterval >= 0) {
+            SetSwapInterval(s_SessionOptions.SwapInterval);
+        }
+        else {
+            SetSwapInterval(s_VSync.Get() >= 0 ? s_VSync.Get() : (s_SessionOptions.Headless ? 0 : 1));
+        }
+
+        // Retuning from the console applies on the next frame, on whichever thread owns the context
+        m_VSyncCallback = s_VSync.AddChangeCallback([this](const CVarBase&) { m_VSyncChanged = true; });
+        m_FramePacer.SetTargetFps(s_SessionOptions.TargetFps);
 
         // Initialize Renderer
         m_Renderer = std::make_unique<Renderer>(m_Editor_camera, m_Editor_light);
@@ -85,11 +115,30 @@ namespace Engine {
         m_Input->Init(m_Window);
         LOG_INFO("Input system initialized");
 
+        // Before the derived constructor so every seed it requests is recorded/replayed
+        BeginSession();
+
         // DO NOT call OnInit() here - it will be called in Run() instead!
 
         LOG_INFO("Application initialized successfully");
     }
 
+    void Application::InitHeadless() {
+        // No window and no GL context: packets are built as usual and handed to a
+        // render thread whose backend draws nothing
+        m_Renderer = std::make_unique<Renderer>(m_Editor_camera, m_Editor_light);
+        m_FramePipeline = std::make_unique<FramePipeline>(2);
+        m_SwapInterval = 0;
+        m_FramePacer.SetTargetFps(s_SessionOptions.TargetFps);
+
+        m_Input = std::make_unique<Input>();
+        m_Input->Init(std::make_unique<SyntheticInputBackend>());
+
+        BeginSession();
+
+        LOG_INFO("Application initialized headless (no window, null render backend)");
+    }
+
     void Application::Run() {
         LOG_INFO("Starting application...");
 
@@ -100,35 +149,57 @@ namespace Engine {
 
         LOG_INFO("Press ESC to exit");
 
-        m_LastFrameTime = (float)glfwGetTime();
+        // Hand the context over once OnInit() has uploaded its GPU resources
+        if (m_FramePipeline) {
+            if (m_Window) {
+                glfwMakeContextCurrent(nullptr);
+                m_RenderBackend = std::make_unique<GLRenderBackend>(*m_Renderer, m_Window);
+            }
+            else {
+                m_RenderBackend = std::make_unique<NullRenderBackend>();
+            }
+            m_RenderThread = std::make_unique<RenderThread>(*m_FramePipeline, *m_RenderBackend);
+            m_RenderThread->start();
+        }
+
+        // Discard the time spent in OnInit()
+        m_FramePacer.BeginFrame();
 
-        while (m_Running && !glfwWindowShouldClose(m_Window)) {
+        while (m_Running && (!m_Window || !glfwWindowShouldClose(m_Window))) {
             ZoneScoped;
             FrameMark;
 
-            // Calculate delta time
-            float time = (float)glfwGetTime();
-            Timestep timestep = time - m_LastFrameTime;
-            m_LastFrameTime = time;
-
-            // Update FPS counter and window title
-            m_FrameCount++;
-            m_FpsUpdateTimer += timestep;
+            // Calculate delta time (smoothed and clamped against hitches)
+            Timestep timestep = m_FramePacer.BeginFrame();
 
-            if (m_FpsUpdateTimer >= 0.25f) {
-                m_CurrentFPS = m_FrameCount / m_FpsUpdateTimer;
-                UpdateWindowTitle(m_CurrentFPS);
-
-                m_FrameCount = 0;
-                m_FpsUpdateTimer = 0.0f;
+            // Update window title with frame statistics
+            const double elapsed = m_FramePacer.GetElapsedSeconds();
+            if (m_Window && elapsed - m_TitleUpdateTime >= 0.25) {
+                UpdateWindowTitle();
+                m_TitleUpdateTime = elapsed;
             }
 
             // Poll events first to get latest input
-            {
+            if (m_Window) {
                 ZoneScopedN("Events");
                 glfwPollEvents();
             }
 
+            // Replay: input and delta time come from the log instead of the window and clock
+            if (m_Replayer) {
+                const RecordedFrame* frame = m_Replayer->NextFrame();
+                if (!frame) {
+                    LOG_INFO("Replay finished after ", m_Replayer->GetFrameCount(), " frames");
+                    Close();
+                    continue;
+                }
+
+                timestep = s_SessionOptions.FixedTimestep > 0.0f ? s_SessionOptions.FixedTimestep : frame->Timestep;
+                for (const auto& event : frame->Events) {
+                    m_ReplayInput->Push(event);
+                }
+            }
+
             // Update
             {
                 ZoneScopedN("Update");
@@ -140,8 +211,16 @@ namespace Engine {
                 OnUpdate(timestep);
             }
 
-            // Swap buffers
-            {
+            if (m_Recorder) {
+                m_Recorder->RecordFrame(timestep, m_Input->GetFrameEvents());
+            }
+
+            if (m_VSyncChanged.exchange(false)) {
+                SetSwapInterval(s_VSync.Get() >= 0 ? s_VSync.Get() : (s_SessionOptions.Headless ? 0 : 1));
+            }
+
+            // Swap buffers (the render thread presents its own frames)
+            if (!m_RenderThread) {
                 ZoneScopedN("Render");
                 glfwSwapBuffers(m_Window);
             }
@@ -151,8 +230,26 @@ namespace Engine {
                 LOG_INFO("ESC pressed - closing application");
                 Close();
             }
+
+            // Wait out the rest of the frame when a target rate is set
+            {
+                ZoneScopedN("FrameLimiter");
+                m_FramePacer.EndFrame();
+            }
         }
 
+        // Draw what is in flight, then take the context back for GPU cleanup
+        if (m_RenderThread) {
+            m_RenderThread->stop();
+            m_RenderThread.reset();
+            m_RenderBackend.reset();
+            if (m_Window) {
+                glfwMakeContextCurrent(m_Window);
+            }
+        }
+
+        EndSession();
+
         LOG_INFO("Calling OnShutdown()...");
         OnShutdown();
         LOG_INFO("OnShutdown() completed");
@@ -160,14 +257,94 @@ namespace Engine {
         LOG_INFO("Application loop ended");
     }
 
+    void Application::SetThreadedRendering(bool enabled, size_t buffer_count) {
+        if (m_RenderThread) {
+            LOG_WARNING("SetThreadedRendering() ignored - render thread already running");
+            return;
+        }
+
+        if (!enabled && !m_Window) {
+            LOG_WARNING("SetThreadedRendering(false) ignored - headless runs have no context to draw inline");
+            return;
+        }
+
+        if (enabled) {
+            m_FramePipeline = std::make_unique<FramePipeline>(buffer_count);
+            LOG_INFO("Threaded rendering enabled (", m_FramePipeline->buffer_count(), " frame packets)");
+        }
+        else {
+            m_FramePipeline.reset();
+        }
+    }
+
+    void Application::BeginSession() {
+        if (s_SessionOptions.IsReplaying()) {
+            m_Replayer = std::make_unique<InputReplayer>();
+            if (!m_Replayer->Load(s_SessionOptions.ReplayPath)) {
+                LOG_ERROR("Replay requested but the log could not be loaded, closing");
+                m_Replayer.reset();
+                Close();
+                return;
+            }
+
+            // Live window input is ignored for the whole replay
+            auto backend = std::make_unique<SyntheticInputBackend>();
+            m_ReplayInput = backend.get();
+            m_Input->Init(std::move(backend));
+            m_Input->SetCursorPosition(m_Replayer->GetInitialCursor());
+            return;
+        }
+
+        if (s_SessionOptions.IsRecording()) {
+            m_Recorder = std::make_unique<InputRecorder>();
+            if (!m_Recorder->Start(s_SessionOptions.RecordPath, m_Input->GetMousePosition())) {
+                m_Recorder.reset();
+            }
+        }
+    }
+
+    void Application::EndSession() {
+        if (m_Recorder) {
+            m_Recorder->Stop();
+            m_Recorder.reset();
+        }
+
+        if (m_Replayer) {
+            m_Replayer->Stop();
+            m_Replayer.reset();
+        }
+    }
+
     void Application::Close() {
         m_Running = false;
     }
 
-    void Application::UpdateWindowTitle(float fps) {
-        std::stringstream ss;
-        ss << m_Name << " | FPS: " << std::fixed << std::setprecision(1) << fps;
-        glfwSetWindowTitle(m_Window, ss.str().c_str());
+    void Application::SetSwapInterval(int interval) {
+        m_SwapInterval = interval < 0 ? 0 : interval;
+
+        // The render thread owns the context while it runs
+        if (m_RenderBackend) {
+            m_RenderBackend->set_swap_interval(m_SwapInterval);
+            return;
+        }
+
+        if (glfwGetCurrentContext() != m_Window) {
+            LOG_WARNING("SetSwapInterval(", m_SwapInterval, ") - window context is not current on this thread");
+            return;
+        }
+
+        glfwSwapInterval(m_SwapInterval);
+        LOG_INFO("Swap interval set to ", m_SwapInterval);
+    }
+
+    void Application::UpdateWindowTitle() {
+        const FrameStats& stats = m_FramePacer.GetStats();
+        const double averageMs = stats.GetAverageMs();
+
+        char title[256];
+        std::snprintf(title, sizeof(title), "%s | FPS: %.1f | %.2f ms (p99 %.2f ms)",
+            m_Name.c_str(), averageMs > 0.0 ? 1000.0 / averageMs : 0.0, averageMs, stats.GetPercentileMs(99.0));
+        glfwSetWindowTitle(m_Window, title);
     }
 
     void Application::Shutdown() {
@@ -175,6 +352,8 @@ namespace Engine {
 
         //OnShutdown();
 
+        s_VSync.RemoveChangeCallback(m_VSyncCallback);
+
         // Cleanup Input system
         m_Input.reset();
 
@@ -183,7 +362,9 @@ namespace Engine {
             m_Window = nullptr;
         }
 
-        glfwTerminate();
+        if (!s_SessionOptions.Headless) {
+            glfwTerminate();
+        }
 
         LOG_INFO("Application shutdown complete");
     }
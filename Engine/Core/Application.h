@@ -1,9 +1,16 @@
 #pragma once
 #include <string>
 #include <memory>
+#include <atomic>
+#include <cstdint>
 
 #include "../Graphics/Renderer.h"
+#include "../Graphics/FramePipeline.h"
+#include "../Graphics/RenderBackend.h"
+#include "../Graphics/RenderThread.h"
 #include "../Utility/Timestep.h"
+#include "SessionOptions.h"
+#include "FramePacer.h"
 
 // Forward declare GLFW types to avoid including GLFW in header
 struct GLFWwindow;
@@ -12,6 +19,9 @@ namespace Engine {
 
     // Forward declarations
     class Input;
+    class InputRecorder;
+    class InputReplayer;
+    class SyntheticInputBackend;
 
     /**
      * @brief Base application class - provides the core framework
@@ -27,6 +37,13 @@ namespace Engine {
         Application(const Application&) = delete;
         Application& operator=(const Application&) = delete;
 
+        /**
+         * @brief Set how the next Application runs (call before constructing it)
+         * @details Headless affects window creation, so it cannot change afterwards.
+         */
+        static void SetSessionOptions(const SessionOptions& options) { s_SessionOptions = options; }
+        static const SessionOptions& GetSessionOptions() { return s_SessionOptions; }
+
         /**
          * @brief Start the main application loop
          * @details Runs until window closes or Close() is called
@@ -57,12 +74,41 @@ namespace Engine {
             m_WindowHeight = height;
         }
 
+        /**
+         * @brief Frame limiter, timestep smoothing and frame-time statistics
+         */
+        FramePacer& GetFramePacer() { return m_FramePacer; }
+        const FramePacer& GetFramePacer() const { return m_FramePacer; }
+
+        /**
+         * @brief Set the swap interval (0 = VSync off, 1 = every vblank, ...)
+         * @details Applied to the window's context right away when rendering inline; with
+         *          threaded rendering it is handed to the render thread, which owns the
+         *          context, and takes effect before its next present.
+         */
+        void SetSwapInterval(int interval);
+        int GetSwapInterval() const { return m_SwapInterval; }
+
         /**
          * @brief Get the Input system
          */
         Input& GetInput() { return *m_Input; }
         const Input& GetInput() const { return *m_Input; }
 
+        /**
+         * @brief Draw on a dedicated render thread, one frame behind the simulation
+         * @details Must be called before Run(). The GL context then belongs to the
+         *          render thread, so nothing else may issue GL calls on the main thread
+         *          after OnInit() (the editor/ImGui does, keep it off in editor builds).
+         */
+        void SetThreadedRendering(bool enabled, size_t buffer_count = 2);
+        bool IsThreadedRendering() const { return m_FramePipeline != nullptr; }
+
+        /**
+         * @brief Pipeline the RenderSystem submits to, nullptr when rendering inline
+         */
+        FramePipeline* GetFramePipeline() { return m_FramePipeline.get(); }
+
     protected:
         /**
          * @brief Called once at startup
@@ -90,12 +136,18 @@ namespace Engine {
 
     private:
         void Init();
+        void InitHeadless();
         void Shutdown();
-        void UpdateWindowTitle(float fps);
+        void UpdateWindowTitle();
 
         GLFWwindow* m_Window = nullptr;
         bool m_Running = true;
-        float m_LastFrameTime = 0.0f;
+
+        // Frame timing
+        FramePacer m_FramePacer;
+        int m_SwapInterval = 1;
+        std::atomic<bool> m_VSyncChanged{ false };  // r.VSync edited, applied before the next swap
+        uint32_t m_VSyncCallback = 0;
 
         std::string m_Name;
         int m_WindowWidth;
@@ -104,15 +156,27 @@ namespace Engine {
         // Input system
         std::unique_ptr<Input> m_Input;
 
-        // FPS tracking
-        float m_FpsUpdateTimer = 0.0f;
-        int m_FrameCount = 0;
-        float m_CurrentFPS = 0.0f;
+        // Session recording / replay
+        void BeginSession();
+        void EndSession();
+
+        static SessionOptions s_SessionOptions;
+        std::unique_ptr<InputRecorder> m_Recorder;
+        std::unique_ptr<InputReplayer> m_Replayer;
+        SyntheticInputBackend* m_ReplayInput = nullptr; // Owned by m_Input
+
+        // Window title refresh (stats text)
+        double m_TitleUpdateTime = 0.0;
 
         // Editor 
         Camera3D m_Editor_camera;
         Light    m_Editor_light;
 
+        // Threaded rendering (unset when rendering inline)
+        std::unique_ptr<FramePipeline>   m_FramePipeline;
+        std::unique_ptr<RenderBackend>   m_RenderBackend;    // GL, or null when headless
+        std::unique_ptr<RenderThread>    m_RenderThread;
+
     };
 
 } // namespace Engine
\ No newline at end of file
@@ -0,0 +1,302 @@
+#include "CVar.h"
+#include "Utility/Logger.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace Engine {
+
+    namespace {
+        std::string Trim(const std::string& text) {
+            size_t begin = 0;
+            size_t end = text.size();
+            while (begin < end && std::isspace(static_cast<unsigned char>(text[begin]))) ++begin;
+            while (end > begin && std::isspace(static_cast<unsigned char>(text[end - 1]))) --end;
+            return text.substr(begin, end - begin);
+        }
+
+        /// Split "name = value" / "name=value"
+        bool SplitAssignment(const std::string& line, std::string& name, std::string& value) {
+            const size_t equals = line.find('=');
+            if (equals == std::string::npos)
+                return false;
+            name = Trim(line.substr(0, equals));
+            value = Trim(line.substr(equals + 1));
+            return !name.empty();
+        }
+    }
+
+    const char* CVarSourceName(CVarSource source) {
+        switch (source) {
+        case CVarSource::Default:     return "Default";
+        case CVarSource::File:        return "File";
+        case CVarSource::CommandLine: return "Command Line";
+        case CVarSource::Editor:      return "Editor";
+        default:                      return "Unknown";
+        }
+    }
+
+    // ===== CVarBase =====
+
+    CVarBase::CVarBase(const char* name, const char* description, uint32_t flags, CVarType type)
+        : m_Name(name)
+        , m_Description(description)
+        , m_Flags(flags)
+        , m_Type(type) {
+        CVarRegistry::Get().Register(this);
+    }
+
+    CVarBase::~CVarBase() {
+        CVarRegistry::Get().Unregister(this);
+    }
+
+    CVarSource CVarBase::GetSource() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        size_t top = 0;
+        for (size_t i = 0; i < Index(CVarSource::Count); ++i) {
+            if (m_LayerMask & (1u << i))
+                top = i;
+        }
+        return static_cast<CVarSource>(top);
+    }
+
+    bool CVarBase::GetLayerString(CVarSource source, std::string& out) const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if ((m_LayerMask & (1u << Index(source))) == 0)
+            return false;
+        out = FormatLayer(source);
+        return true;
+    }
+
+    bool CVarBase::SetFromString(const std::string& value, CVarSource source) {
+        if (source == CVarSource::Count)
+            return false;
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        if (!ParseLayer(value, source))
+            return false;
+        Commit(lock, Publish());
+        return true;
+    }
+
+    void CVarBase::ClearSource(CVarSource source) {
+        if (source == CVarSource::Default || source == CVarSource::Count)
+            return;
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_LayerMask &= ~(1u << Index(source));
+        Commit(lock, Publish());
+    }
+
+    uint32_t CVarBase::AddChangeCallback(ChangeCallback callback) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        const uint32_t handle = m_NextCallback++;
+        m_Callbacks.emplace_back(handle, std::move(callback));
+        return handle;
+    }
+
+    void CVarBase::RemoveChangeCallback(uint32_t handle) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Callbacks.erase(std::remove_if(m_Callbacks.begin(), m_Callbacks.end(),
+            [handle](const auto& entry) { return entry.first == handle; }), m_Callbacks.end());
+    }
+
+    void CVarBase::Commit(std::unique_lock<std::mutex>& lock, bool changed) {
+        if (!changed) {
+            lock.unlock();
+            return;
+        }
+
+        // Callbacks may read this CVar or add callbacks, run them unlocked
+        std::vector<ChangeCallback> callbacks;
+        callbacks.reserve(m_Callbacks.size());
+        for (const auto& entry : m_Callbacks)
+            callbacks.push_back(entry.second);
+        lock.unlock();
+
+        for (const auto& callback : callbacks)
+            callback(*this);
+    }
+
+    // ===== Parsing =====
+
+    namespace CVarDetail {
+
+        bool Parse(const std::string& text, bool& out) {
+            std::string lower = Trim(text);
+            std::transform(lower.begin(), lower.end(), lower.begin(),
+                [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+            if (lower == "1" || lower == "true" || lower == "on" || lower == "yes") { out = true; return true; }
+            if (lower == "0" || lower == "false" || lower == "off" || lower == "no") { out = false; return true; }
+            return false;
+        }
+
+        bool Parse(const std::string& text, int& out) {
+            const std::string trimmed = Trim(text);
+            char* end = nullptr;
+            long value = std::strtol(trimmed.c_str(), &end, 0);
+            if (trimmed.empty() || *end != '\0')
+                return false;
+            out = static_cast<int>(value);
+            return true;
+        }
+
+        bool Parse(const std::string& text, float& out) {
+            const std::string trimmed = Trim(text);
+            char* end = nullptr;
+            float value = std::strtof(trimmed.c_str(), &end);
+            if (trimmed.empty() || *end != '\0')
+                return false;
+            out = value;
+            return true;
+        }
+
+        bool Parse(const std::string& text, std::string& out) {
+            std::string trimmed = Trim(text);
+            if (trimmed.size() >= 2 && trimmed.front() == '"' && trimmed.back() == '"')
+                trimmed = trimmed.substr(1, trimmed.size() - 2);
+            out = std::move(trimmed);
+            return true;
+        }
+
+        std::string Format(bool value) { return value ? "1" : "0"; }
+        std::string Format(int value) { return std::to_string(value); }
+
+        std::string Format(float value) {
+            std::ostringstream oss;
+            oss << value;
+            return oss.str();
+        }
+
+        std::string Format(const std::string& value) { return value; }
+
+    } // namespace CVarDetail
+
+    // ===== CVarRegistry =====
+
+    void CVarRegistry::Register(CVarBase* cvar) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto [it, inserted] = m_CVars.emplace(cvar->GetName(), cvar);
+        if (!inserted) {
+            LOG_WARNING("CVar '", cvar->GetName(), "' registered twice, the later one is ignored by name lookups");
+        }
+    }
+
+    void CVarRegistry::Unregister(CVarBase* cvar) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_CVars.find(cvar->GetName());
+        if (it != m_CVars.end() && it->second == cvar)
+            m_CVars.erase(it);
+    }
+
+    CVarBase* CVarRegistry::Find(std::string_view name) const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_CVars.find(name);
+        return it != m_CVars.end() ? it->second : nullptr;
+    }
+
+    std::vector<CVarBase*> CVarRegistry::GetAll() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::vector<CVarBase*> all;
+        all.reserve(m_CVars.size());
+        for (const auto& entry : m_CVars)
+            all.push_back(entry.second);
+        return all;
+    }
+
+    bool CVarRegistry::Set(std::string_view name, const std::string& value, CVarSource source) {
+        CVarBase* cvar = Find(name);
+        if (!cvar) {
+            LOG_WARNING("Unknown CVar '", name, "'");
+            return false;
+        }
+
+        if (!cvar->SetFromString(value, source)) {
+            LOG_WARNING("CVar '", name, "': cannot parse '", value, "'");
+            return false;
+        }
+
+        if (cvar->GetFlags() & CVAR_RESTART) {
+            LOG_INFO("CVar ", name, " = ", value, " (", CVarSourceName(source), ", applies at startup)");
+        }
+        else {
+            LOG_INFO("CVar ", name, " = ", value, " (", CVarSourceName(source), ")");
+        }
+        return true;
+    }
+
+    bool CVarRegistry::LoadFile(const std::string& path) {
+        m_ConfigPath = path;
+
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            LOG_INFO("No config file at ", path, ", using defaults");
+            return true;
+        }
+
+        std::string line;
+        int lineNumber = 0;
+        while (std::getline(file, line)) {
+            ++lineNumber;
+
+            const size_t comment = line.find('#');
+            if (comment != std::string::npos)
+                line.erase(comment);
+            if (Trim(line).empty())
+                continue;
+
+            std::string name;
+            std::string value;
+            if (!SplitAssignment(line, name, value)) {
+                LOG_WARNING(path, ":", lineNumber, ": expected 'name = value'");
+                continue;
+            }
+
+            Set(name, value, CVarSource::File);
+        }
+
+        if (file.bad()) {
+            LOG_ERROR("Failed to read config file ", path);
+            return false;
+        }
+        return true;
+    }
+
+    bool CVarRegistry::SaveFile(const std::string& path) const {
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+        if (!file.is_open()) {
+            LOG_ERROR("Failed to write config file ", path);
+            return false;
+        }
+
+        file << "# Engine configuration (name = value)\n";
+        for (CVarBase* cvar : GetAll()) {
+            // Command line values are per run and not persisted
+            std::string value;
+            if (cvar->GetLayerString(CVarSource::Editor, value) || cvar->GetLayerString(CVarSource::File, value)) {
+                file << "\n# " << cvar->GetDescription() << "\n";
+                file << cvar->GetName() << " = " << value << "\n";
+            }
+        }
+
+        LOG_INFO("Config saved to ", path);
+        return true;
+    }
+
+    void CVarRegistry::ApplyCommandLine(const std::vector<std::string>& assignments) {
+        for (const std::string& assignment : assignments) {
+            std::string name;
+            std::string value;
+            if (!SplitAssignment(assignment, name, value)) {
+                LOG_WARNING("--cvar expects name=value, got ", assignment);
+                continue;
+            }
+            Set(name, value, CVarSource::CommandLine);
+        }
+    }
+
+} // namespace Engine
@@ -0,0 +1,343 @@
+#pragma once
+/**
+ * @file CVar.h
+ * @brief Typed configuration variables with layered sources
+ * @details A CVar is declared once, at namespace scope next to the code that uses it,
+ *          and registers itself during static initialization:
+ *
+ *          ```cpp
+ *          static CVar<int> s_MaxBodies("phys.MaxBodies", 8192, "Bodies the physics world can hold", CVAR_RESTART);
+ *          ...
+ *          mPhysics.Init(s_MaxBodies.Get(), ...);
+ *          ```
+ *
+ *          Its value is resolved from up to four layers, the highest one set wins:
+ *          Default < File (engine.cfg) < CommandLine (--cvar name=value) < Editor.
+ *          Get() on bool/int/float CVars is a relaxed atomic load and safe from any
+ *          thread; setting takes a lock and runs change callbacks on the setting thread.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+
+    /**
+     * @brief Where a value came from, in increasing priority
+     */
+    enum class CVarSource : uint8_t {
+        Default,
+        File,
+        CommandLine,
+        Editor,
+        Count
+    };
+
+    /**
+     * @brief Behaviour flags
+     */
+    enum CVarFlags : uint32_t {
+        CVAR_NONE = 0,
+        CVAR_RESTART = 1 << 0,      ///< Only read at startup, changes apply on the next run
+        CVAR_READ_ONLY = 1 << 1     ///< Not editable from the editor console
+    };
+
+    enum class CVarType : uint8_t {
+        Bool,
+        Int,
+        Float,
+        String
+    };
+
+    const char* CVarSourceName(CVarSource source);
+
+    /**
+     * @brief Type-erased part of a CVar, what the registry and console work with
+     */
+    class CVarBase {
+    public:
+        using ChangeCallback = std::function<void(const CVarBase&)>;
+
+        virtual ~CVarBase();
+
+        CVarBase(const CVarBase&) = delete;
+        CVarBase& operator=(const CVarBase&) = delete;
+
+        const std::string& GetName() const { return m_Name; }
+        const std::string& GetDescription() const { return m_Description; }
+        uint32_t GetFlags() const { return m_Flags; }
+        CVarType GetType() const { return m_Type; }
+
+        /**
+         * @brief Highest layer currently holding a value
+         */
+        CVarSource GetSource() const;
+
+        /**
+         * @brief Current value as text (bools as 0/1)
+         */
+        virtual std::string ToString() const = 0;
+
+        /**
+         * @brief Value of a single layer as text
+         * @return False if the layer is not set
+         */
+        bool GetLayerString(CVarSource source, std::string& out) const;
+
+        /**
+         * @brief Parse and set a layer
+         * @return False if the text does not parse as this CVar's type
+         */
+        bool SetFromString(const std::string& value, CVarSource source);
+
+        /**
+         * @brief Remove a layer (Default cannot be removed)
+         */
+        void ClearSource(CVarSource source);
+
+        /**
+         * @brief Call a function whenever the resolved value changes
+         * @return Handle for RemoveChangeCallback
+         */
+        uint32_t AddChangeCallback(ChangeCallback callback);
+        void RemoveChangeCallback(uint32_t handle);
+
+    protected:
+        CVarBase(const char* name, const char* description, uint32_t flags, CVarType type);
+
+        // Implemented per type, called with m_Mutex held
+        virtual bool ParseLayer(const std::string& value, CVarSource source) = 0;
+        virtual std::string FormatLayer(CVarSource source) const = 0;
+        virtual bool Publish() = 0;     ///< Resolve layers into the live value, true if it changed
+
+        /**
+         * @brief Run change callbacks if Publish() reported a change (lock released)
+         */
+        void Commit(std::unique_lock<std::mutex>& lock, bool changed);
+
+        static size_t Index(CVarSource source) { return static_cast<size_t>(source); }
+
+        mutable std::mutex m_Mutex;
+        uint32_t m_LayerMask = 1;       ///< Bit per CVarSource, Default always set
+
+    private:
+        std::string m_Name;
+        std::string m_Description;
+        uint32_t m_Flags;
+        CVarType m_Type;
+        std::vector<std::pair<uint32_t, ChangeCallback>> m_Callbacks;
+        uint32_t m_NextCallback = 1;
+    };
+
+    namespace CVarDetail {
+
+        template<typename T> struct TypeOf;
+        template<> struct TypeOf<bool> { static constexpr CVarType Value = CVarType::Bool; };
+        template<> struct TypeOf<int> { static constexpr CVarType Value = CVarType::Int; };
+        template<> struct TypeOf<float> { static constexpr CVarType Value = CVarType::Float; };
+        template<> struct TypeOf<std::string> { static constexpr CVarType Value = CVarType::String; };
+
+        bool Parse(const std::string& text, bool& out);
+        bool Parse(const std::string& text, int& out);
+        bool Parse(const std::string& text, float& out);
+        bool Parse(const std::string& text, std::string& out);
+
+        std::string Format(bool value);
+        std::string Format(int value);
+        std::string Format(float value);
+        std::string Format(const std::string& value);
+
+        /// Live value, lock-free for arithmetic types
+        template<typename T>
+        struct Storage {
+            std::atomic<T> Value;
+
+            explicit Storage(T value) : Value(value) {}
+            T Load() const { return Value.load(std::memory_order_relaxed); }
+            void Store(const T& value) { Value.store(value, std::memory_order_relaxed); }
+        };
+
+        /// Strings are not on hot paths; reads copy under a lock
+        template<>
+        struct Storage<std::string> {
+            mutable std::mutex Mutex;
+            std::string Value;
+
+            explicit Storage(std::string value) : Value(std::move(value)) {}
+            std::string Load() const { std::lock_guard<std::mutex> lock(Mutex); return Value; }
+            void Store(const std::string& value) { std::lock_guard<std::mutex> lock(Mutex); Value = value; }
+        };
+
+    } // namespace CVarDetail
+
+    /**
+     * @brief A typed configuration variable (bool, int, float or std::string)
+     */
+    template<typename T>
+    class CVar : public CVarBase {
+        static_assert(std::is_same_v<T, bool> || std::is_same_v<T, int> || std::is_same_v<T, float> ||
+            std::is_same_v<T, std::string>, "CVar supports bool, int, float and std::string");
+
+    public:
+        CVar(const char* name, T defaultValue, const char* description, uint32_t flags = CVAR_NONE)
+            : CVarBase(name, description, flags, CVarDetail::TypeOf<T>::Value)
+            , m_Value(defaultValue) {
+            m_Layers[Index(CVarSource::Default)] = std::move(defaultValue);
+        }
+
+        /**
+         * @brief Arithmetic CVar whose layers are clamped to [minValue, maxValue]
+         */
+        CVar(const char* name, T defaultValue, T minValue, T maxValue, const char* description, uint32_t flags = CVAR_NONE)
+            : CVar(name, defaultValue, description, flags) {
+            static_assert(!std::is_same_v<T, std::string>, "Strings have no range");
+            m_HasRange = true;
+            m_Min = minValue;
+            m_Max = maxValue;
+        }
+
+        /**
+         * @brief Current value (lock-free for arithmetic types)
+         */
+        T Get() const { return m_Value.Load(); }
+        operator T() const { return Get(); }
+
+        /**
+         * @brief Set a layer (the Editor layer by default)
+         */
+        void Set(T value, CVarSource source = CVarSource::Editor) {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Layers[Index(source)] = Clamp(std::move(value));
+            m_LayerMask |= 1u << Index(source);
+            Commit(lock, Publish());
+        }
+
+        T GetDefault() const {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Layers[Index(CVarSource::Default)];
+        }
+
+        bool HasRange() const { return m_HasRange; }
+        T GetMin() const { return m_Min; }
+        T GetMax() const { return m_Max; }
+
+        std::string ToString() const override { return CVarDetail::Format(Get()); }
+
+    protected:
+        bool ParseLayer(const std::string& value, CVarSource source) override {
+            T parsed{};
+            if (!CVarDetail::Parse(value, parsed))
+                return false;
+            m_Layers[Index(source)] = Clamp(std::move(parsed));
+            m_LayerMask |= 1u << Index(source);
+            return true;
+        }
+
+        std::string FormatLayer(CVarSource source) const override {
+            return CVarDetail::Format(m_Layers[Index(source)]);
+        }
+
+        bool Publish() override {
+            size_t top = 0;
+            for (size_t i = 0; i < Index(CVarSource::Count); ++i) {
+                if (m_LayerMask & (1u << i))
+                    top = i;
+            }
+
+            const T& resolved = m_Layers[top];
+            if (m_Value.Load() == resolved)
+                return false;
+            m_Value.Store(resolved);
+            return true;
+        }
+
+    private:
+        T Clamp(T value) const {
+            if constexpr (!std::is_same_v<T, std::string> && !std::is_same_v<T, bool>) {
+                if (m_HasRange)
+                    return value < m_Min ? m_Min : (m_Max < value ? m_Max : value);
+            }
+            return value;
+        }
+
+        CVarDetail::Storage<T> m_Value;
+        T m_Layers[static_cast<size_t>(CVarSource::Count)]{};
+        T m_Min{};
+        T m_Max{};
+        bool m_HasRange = false;
+    };
+
+    /**
+     * @brief Name lookup, config files and command line for all CVars
+     */
+    class CVarRegistry {
+    public:
+        static CVarRegistry& Get() {
+            static CVarRegistry instance;
+            return instance;
+        }
+
+        CVarRegistry(const CVarRegistry&) = delete;
+        CVarRegistry& operator=(const CVarRegistry&) = delete;
+
+        CVarBase* Find(std::string_view name) const;
+
+        /**
+         * @brief Every registered CVar, sorted by name
+         */
+        std::vector<CVarBase*> GetAll() const;
+
+        /**
+         * @brief Set a CVar by name from text
+         * @return False (and a warning) for unknown names or unparsable values
+         */
+        bool Set(std::string_view name, const std::string& value, CVarSource source);
+
+        /**
+         * @brief Read "name = value" lines ('#' starts a comment) into the File layer
+         * @return False if the file exists but could not be read; a missing file is not an error
+         */
+        bool LoadFile(const std::string& path);
+
+        /**
+         * @brief Write every CVar set from the file or editor back to a config file
+         */
+        bool SaveFile(const std::string& path) const;
+
+        /**
+         * @brief Apply "name=value" assignments to the CommandLine layer
+         */
+        void ApplyCommandLine(const std::vector<std::string>& assignments);
+
+        /**
+         * @brief Path given to the last LoadFile (where the console saves to)
+         */
+        const std::string& GetConfigPath() const { return m_ConfigPath; }
+
+    private:
+        friend class CVarBase;
+
+        CVarRegistry() = default;
+
+        void Register(CVarBase* cvar);
+        void Unregister(CVarBase* cvar);
+
+        mutable std::mutex m_Mutex;
+        std::map<std::string, CVarBase*, std::less<>> m_CVars;
+        std::string m_ConfigPath = "engine.cfg";
+    };
+
+} // namespace Engine
@@ -0,0 +1,169 @@
+#include "FramePacer.h"
+#include "Utility/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace Engine {
+
+    // ===== CLOCK =====
+
+    uint64_t FrameClock::NowNanoseconds() {
+        using namespace std::chrono;
+        return static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+    }
+
+    void FramePacerClock::SleepFor(uint64_t ns) {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(ns));
+    }
+
+    void FramePacerClock::Spin() {
+        std::this_thread::yield();
+    }
+
+    // ===== STATS =====
+
+    void FrameStats::Record(uint64_t frameNs) {
+        if (m_Count == WINDOW) {
+            m_TotalNs -= m_Samples[m_Next];
+        }
+        else {
+            m_Count++;
+        }
+
+        m_Samples[m_Next] = frameNs;
+        m_TotalNs += frameNs;
+        m_Next = (m_Next + 1) % WINDOW;
+    }
+
+    void FrameStats::Reset() {
+        m_Next = 0;
+        m_Count = 0;
+        m_TotalNs = 0;
+    }
+
+    double FrameStats::GetAverageMs() const {
+        return m_Count ? FrameClock::ToMilliseconds(m_TotalNs) / static_cast<double>(m_Count) : 0.0;
+    }
+
+    double FrameStats::GetMinMs() const {
+        if (!m_Count) return 0.0;
+        return FrameClock::ToMilliseconds(*std::min_element(m_Samples.begin(), m_Samples.begin() + m_Count));
+    }
+
+    double FrameStats::GetMaxMs() const {
+        if (!m_Count) return 0.0;
+        return FrameClock::ToMilliseconds(*std::max_element(m_Samples.begin(), m_Samples.begin() + m_Count));
+    }
+
+    double FrameStats::GetPercentileMs(double p) const {
+        if (!m_Count) return 0.0;
+
+        m_Scratch.assign(m_Samples.begin(), m_Samples.begin() + m_Count);
+
+        // Nearest-rank percentile
+        const double clamped = std::clamp(p, 0.0, 100.0);
+        const size_t rank = static_cast<size_t>(std::ceil(clamped / 100.0 * static_cast<double>(m_Count)));
+        const size_t index = rank ? std::min(rank - 1, m_Count - 1) : 0;
+        std::nth_element(m_Scratch.begin(), m_Scratch.begin() + index, m_Scratch.end());
+        return FrameClock::ToMilliseconds(m_Scratch[index]);
+    }
+
+    FrameStats::Histogram FrameStats::GetHistogram() const {
+        Histogram histogram{};
+        for (size_t i = 0; i < m_Count; ++i) {
+            const double ms = FrameClock::ToMilliseconds(m_Samples[i]);
+            const auto edge = std::lower_bound(HISTOGRAM_EDGES_MS.begin(), HISTOGRAM_EDGES_MS.end(), ms);
+            histogram[static_cast<size_t>(edge - HISTOGRAM_EDGES_MS.begin())]++;
+        }
+        return histogram;
+    }
+
+    // ===== PACER =====
+
+    FramePacer::FramePacer(const FramePacerSettings& settings)
+        : m_Clock(std::make_unique<FramePacerClock>()) {
+        SetSettings(settings);
+        m_StartNs = m_Clock->NowNanoseconds();
+        m_FrameStartNs = m_StartNs;
+    }
+
+    void FramePacer::SetClock(std::unique_ptr<FramePacerClock> clock) {
+        m_Clock = clock ? std::move(clock) : std::make_unique<FramePacerClock>();
+        m_StartNs = m_Clock->NowNanoseconds();
+        m_FrameStartNs = m_StartNs;
+    }
+
+    void FramePacer::SetSettings(const FramePacerSettings& settings) {
+        m_Settings = settings;
+        m_Settings.TargetFps = std::max(0.0, m_Settings.TargetFps);
+        m_Settings.SpinMs = std::max(0.0, m_Settings.SpinMs);
+        m_Settings.MaxTimestep = std::max(0.001f, m_Settings.MaxTimestep);
+        m_Settings.SmoothingFrames = std::clamp<uint32_t>(m_Settings.SmoothingFrames, 1, static_cast<uint32_t>(MAX_SMOOTHING));
+
+        m_HistoryNext = 0;
+        m_HistoryCount = 0;
+    }
+
+    void FramePacer::SetTargetFps(double fps) {
+        m_Settings.TargetFps = std::max(0.0, fps);
+        if (m_Settings.TargetFps > 0.0) {
+            LOG_INFO("Frame limiter: ", m_Settings.TargetFps, " fps");
+        }
+        else {
+            LOG_INFO("Frame limiter: unlimited");
+        }
+    }
+
+    Timestep FramePacer::BeginFrame() {
+        const uint64_t now = m_Clock->NowNanoseconds();
+        m_RawFrameNs = now - m_FrameStartNs;
+        m_FrameStartNs = now;
+
+        // The first frame has no previous one to measure against
+        if (m_FrameIndex++ == 0) {
+            return Timestep(0.0f);
+        }
+
+        m_Stats.Record(m_RawFrameNs);
+
+        // Clamp first so a single hitch does not leak into the following frames
+        const float delta = std::min(static_cast<float>(FrameClock::ToSeconds(m_RawFrameNs)), m_Settings.MaxTimestep);
+
+        m_History[m_HistoryNext] = delta;
+        m_HistoryNext = (m_HistoryNext + 1) % m_Settings.SmoothingFrames;
+        m_HistoryCount = std::min<size_t>(m_HistoryCount + 1, m_Settings.SmoothingFrames);
+
+        float sum = 0.0f;
+        for (size_t i = 0; i < m_HistoryCount; ++i) {
+            sum += m_History[i];
+        }
+        return Timestep(sum / static_cast<float>(m_HistoryCount));
+    }
+
+    void FramePacer::EndFrame() {
+        if (m_Settings.TargetFps <= 0.0) {
+            return;
+        }
+
+        const uint64_t periodNs = static_cast<uint64_t>(1e9 / m_Settings.TargetFps);
+        const uint64_t deadline = m_FrameStartNs + periodNs;
+        const uint64_t spinNs = static_cast<uint64_t>(m_Settings.SpinMs * 1e6);
+
+        const uint64_t now = m_Clock->NowNanoseconds();
+        if (now + spinNs < deadline) {
+            m_Clock->SleepFor(deadline - spinNs - now);
+        }
+
+        while (m_Clock->NowNanoseconds() < deadline) {
+            m_Clock->Spin();
+        }
+    }
+
+    double FramePacer::GetElapsedSeconds() const {
+        return FrameClock::ToSeconds(m_Clock->NowNanoseconds() - m_StartNs);
+    }
+
+} // namespace Engine
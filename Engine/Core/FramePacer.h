@@ -0,0 +1,171 @@
+#pragma once
+/**
+ * @file FramePacer.h
+ * @brief Monotonic frame clock, frame-rate limiter, timestep smoothing and frame statistics
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../Utility/Timestep.h"
+
+namespace Engine {
+
+    /**
+     * @brief Monotonic 64-bit nanosecond clock (does not lose precision with uptime)
+     */
+    class FrameClock {
+    public:
+        static uint64_t NowNanoseconds();
+
+        static double ToSeconds(uint64_t ns) { return static_cast<double>(ns) * 1e-9; }
+        static double ToMilliseconds(uint64_t ns) { return static_cast<double>(ns) * 1e-6; }
+    };
+
+    /**
+     * @brief Time source and waiting primitives of a FramePacer
+     * @details The default reads FrameClock and blocks the calling thread; tests and
+     *          tools substitute a clock they advance themselves.
+     */
+    class FramePacerClock {
+    public:
+        virtual ~FramePacerClock() = default;
+
+        virtual uint64_t NowNanoseconds() const { return FrameClock::NowNanoseconds(); }
+
+        /**
+         * @brief Coarse wait; may overshoot by up to a scheduler tick
+         */
+        virtual void SleepFor(uint64_t ns);
+
+        /**
+         * @brief One iteration of the spin at the end of a wait
+         */
+        virtual void Spin();
+    };
+
+    /**
+     * @brief Rolling window of raw frame times
+     * @details Percentiles are computed on demand from a copy, so recording a frame is O(1).
+     */
+    class FrameStats {
+    public:
+        static constexpr size_t WINDOW = 256;
+
+        // Upper bucket edges in milliseconds, the last bucket holds everything above
+        static constexpr std::array<double, 7> HISTOGRAM_EDGES_MS = { 4.2, 8.4, 11.2, 16.7, 33.4, 50.0, 100.0 };
+        using Histogram = std::array<uint32_t, HISTOGRAM_EDGES_MS.size() + 1>;
+
+        void Record(uint64_t frameNs);
+        void Reset();
+
+        size_t GetSampleCount() const { return m_Count; }
+
+        double GetAverageMs() const;
+        double GetMinMs() const;
+        double GetMaxMs() const;
+
+        /**
+         * @brief Frame time below which the given fraction of frames fall
+         * @param p Percentile in [0, 100] (e.g. 99 for the 1% worst frames)
+         */
+        double GetPercentileMs(double p) const;
+
+        /**
+         * @brief Frames per bucket of HISTOGRAM_EDGES_MS over the window
+         */
+        Histogram GetHistogram() const;
+
+    private:
+        std::array<uint64_t, WINDOW> m_Samples{};
+        size_t m_Next = 0;
+        size_t m_Count = 0;
+        uint64_t m_TotalNs = 0;
+
+        mutable std::vector<uint64_t> m_Scratch;
+    };
+
+    /**
+     * @brief Frame pacing settings
+     */
+    struct FramePacerSettings {
+        double TargetFps = 0.0;         ///< 0 = unlimited (VSync may still limit)
+        double SpinMs = 1.5;            ///< Final part of the wait that is spun instead of slept
+        float MaxTimestep = 0.1f;       ///< Clamp for hitches (debugger breaks, loads)
+        uint32_t SmoothingFrames = 4;   ///< Moving-average length for the timestep, 1 = off
+    };
+
+    /**
+     * @brief Measures frames and delivers them at a steady rate
+     * @details Call BeginFrame() at the top of the loop for the timestep, and
+     *          EndFrame() after presenting to wait out the rest of the target period.
+     *          Waiting sleeps until SpinMs before the deadline and spins the rest,
+     *          since OS sleeps overshoot by up to a scheduler tick.
+     */
+    class FramePacer {
+    public:
+        explicit FramePacer(const FramePacerSettings& settings = {});
+
+        void SetSettings(const FramePacerSettings& settings);
+        const FramePacerSettings& GetSettings() const { return m_Settings; }
+
+        void SetTargetFps(double fps);
+
+        /**
+         * @brief Replace the time source (nullptr restores the real clock)
+         * @details Restarts elapsed time and the current frame at the new clock's now.
+         */
+        void SetClock(std::unique_ptr<FramePacerClock> clock);
+
+        /**
+         * @brief Start a frame
+         * @return Smoothed, clamped simulation timestep
+         */
+        Timestep BeginFrame();
+
+        /**
+         * @brief Wait until the target frame period has elapsed since BeginFrame()
+         */
+        void EndFrame();
+
+        /**
+         * @brief Unsmoothed duration of the last frame
+         */
+        uint64_t GetRawFrameNs() const { return m_RawFrameNs; }
+
+        /**
+         * @brief Seconds since the pacer was created (64-bit based, double precision)
+         */
+        double GetElapsedSeconds() const;
+
+        uint64_t GetFrameIndex() const { return m_FrameIndex; }
+
+        const FrameStats& GetStats() const { return m_Stats; }
+        FrameStats& GetStats() { return m_Stats; }
+
+    private:
+        FramePacerSettings m_Settings;
+        FrameStats m_Stats;
+        std::unique_ptr<FramePacerClock> m_Clock;
+
+        uint64_t m_StartNs = 0;
+        uint64_t m_FrameStartNs = 0;
+        uint64_t m_RawFrameNs = 0;
+        uint64_t m_FrameIndex = 0;
+
+        // Ring of clamped deltas for the moving average
+        static constexpr size_t MAX_SMOOTHING = 32;
+        std::array<float, MAX_SMOOTHING> m_History{};
+        size_t m_HistoryNext = 0;
+        size_t m_HistoryCount = 0;
+    };
+
+} // namespace Engine
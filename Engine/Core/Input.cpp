@@ -4,60 +4,58 @@
 
 namespace Engine {
 
-    // Static instance pointer for callbacks
-    Input* Input::s_Instance = nullptr;
-
-    void Input::ScrollCallback(GLFWwindow* window, double xoffset, double yoffset) {
-        (void)window;
-        if (s_Instance) {
-            s_Instance->m_ScrollDelta.x += static_cast<float>(xoffset);
-            s_Instance->m_ScrollDelta.y += static_cast<float>(yoffset);
-            LOG_TRACE("Scroll callback: ", yoffset, " (accumulated: ", s_Instance->m_ScrollDelta.y, ")");
+    static_assert(GLFW_KEY_LAST < Input::MAX_KEYS, "Input::MAX_KEYS too small for GLFW key codes");
+    static_assert(GLFW_MOUSE_BUTTON_LAST < Input::MAX_MOUSE_BUTTONS, "Input::MAX_MOUSE_BUTTONS too small");
+
+    Input::~Input() {
+        if (m_Backend) {
+            m_Backend->Detach();
         }
     }
 
     void Input::Init(GLFWwindow* window) {
-        m_Window = window;
-        s_Instance = this;
+        Init(std::make_unique<GLFWInputBackend>(window));
+    }
 
-        // Set scroll callback
-        glfwSetScrollCallback(m_Window, ScrollCallback);
+    void Input::Init(std::unique_ptr<InputBackend> backend) {
+        if (m_Backend) {
+            m_Backend->Detach();
+        }
+
+        m_Backend = std::move(backend);
+        if (!m_Backend) {
+            LOG_ERROR("Input: Init called without a backend");
+            return;
+        }
+
+        m_Backend->Attach(m_Queue);
 
         // Get initial mouse position
-        double mouseX, mouseY;
-        glfwGetCursorPos(m_Window, &mouseX, &mouseY);
-        m_MousePosition = glm::vec2(static_cast<float>(mouseX), static_cast<float>(mouseY));
+        m_MousePosition = m_Backend->GetInitialCursorPosition();
         m_LastMousePosition = m_MousePosition;
 
         LOG_DEBUG("Input system initialized");
     }
 
     void Input::Update() {
-        if (!m_Window) return;
-
-        // Reset scroll delta at the START of update (before new events)
-        m_ScrollDelta = glm::vec2(0.0f);
-
-        // Make sure glfwPollEvents() is called BEFORE processing state transitions
-        // This ensures all callbacks (including scroll) are processed before we transition states
-        glfwPollEvents();
-
-        // Update keyboard states
-        for (auto& [key, state] : m_KeyStates) {
-            state.previous = state.current;
-            state.current = (glfwGetKey(m_Window, key) == GLFW_PRESS);
+        // Per-frame transitions and scroll start from zero, held state carries over
+        for (auto& state : m_KeyStates) {
+            state.Presses = 0;
+            state.Releases = 0;
         }
-
-        // Update mouse button states
-        for (auto& [button, state] : m_MouseButtonStates) {
-            state.previous = state.current;
-            state.current = (glfwGetMouseButton(m_Window, button) == GLFW_PRESS);
+        for (auto& state : m_MouseButtonStates) {
+            state.Presses = 0;
+            state.Releases = 0;
         }
+        m_ScrollDelta = glm::vec2(0.0f);
+        m_FrameEvents.clear();
 
-        // Update mouse position
-        double mouseX, mouseY;
-        glfwGetCursorPos(m_Window, &mouseX, &mouseY);
-        m_MousePosition = glm::vec2(static_cast<float>(mouseX), static_cast<float>(mouseY));
+        // Events were queued by the backend during glfwPollEvents() (called by Application)
+        InputEvent event;
+        while (m_Queue.Pop(event)) {
+            ApplyEvent(event);
+            m_FrameEvents.push_back(event);
+        }
 
         // Calculate mouse delta
         if (m_FirstMouseMove) {
@@ -66,70 +64,93 @@ namespace Engine {
         }
         m_MouseDelta = m_MousePosition - m_LastMousePosition;
         m_LastMousePosition = m_MousePosition;
+    }
 
-        // Note: Scroll delta is reset at the start and accumulated via callback
-        // Don't reset it here at the end!
+    void Input::ApplyEvent(const InputEvent& event) {
+        m_LastEventTime = event.Timestamp;
+
+        switch (event.Type) {
+        case InputEventType::Key:
+            if (event.Code >= 0 && event.Code < MAX_KEYS) {
+                ApplyButton(m_KeyStates[event.Code], event);
+            }
+            break;
+
+        case InputEventType::MouseButton:
+            if (event.Code >= 0 && event.Code < MAX_MOUSE_BUTTONS) {
+                ApplyButton(m_MouseButtonStates[event.Code], event);
+            }
+            break;
+
+        case InputEventType::CursorMove:
+            m_MousePosition = glm::vec2(event.X, event.Y);
+            break;
+
+        case InputEventType::Scroll:
+            m_ScrollDelta.x += event.X;
+            m_ScrollDelta.y += event.Y;
+            break;
+        }
     }
 
-    bool Input::IsKeyPressed(int key) const {
-        auto it = m_KeyStates.find(key);
-        if (it == m_KeyStates.end()) {
-            // First time checking - add to tracking
-            const_cast<Input*>(this)->m_KeyStates[key] = ButtonState{};
-            return glfwGetKey(m_Window, key) == GLFW_PRESS;
+    void Input::ApplyButton(ButtonState& state, const InputEvent& event) {
+        // Repeats do not change state
+        if (event.Action == InputAction::Repeat) {
+            return;
+        }
+
+        const bool down = (event.Action == InputAction::Press);
+        if (down == state.Down) {
+            return;
+        }
+
+        state.Down = down;
+        state.LastEventTime = event.Timestamp;
+        if (down) {
+            if (state.Presses < UINT8_MAX) state.Presses++;
+        }
+        else {
+            if (state.Releases < UINT8_MAX) state.Releases++;
         }
-        return it->second.current;
+    }
+
+    bool Input::IsKeyPressed(int key) const {
+        return key >= 0 && key < MAX_KEYS && m_KeyStates[key].Down;
     }
 
     bool Input::IsKeyJustPressed(int key) const {
-        auto it = m_KeyStates.find(key);
-        if (it == m_KeyStates.end()) {
-            const_cast<Input*>(this)->m_KeyStates[key] = ButtonState{};
-            return false;
-        }
-        return it->second.current && !it->second.previous;
+        return key >= 0 && key < MAX_KEYS && m_KeyStates[key].Presses > 0;
     }
 
     bool Input::IsKeyJustReleased(int key) const {
-        auto it = m_KeyStates.find(key);
-        if (it == m_KeyStates.end()) {
-            const_cast<Input*>(this)->m_KeyStates[key] = ButtonState{};
-            return false;
-        }
-        return !it->second.current && it->second.previous;
+        return key >= 0 && key < MAX_KEYS && m_KeyStates[key].Releases > 0;
+    }
+
+    double Input::GetKeyEventTime(int key) const {
+        return (key >= 0 && key < MAX_KEYS) ? m_KeyStates[key].LastEventTime : 0.0;
     }
 
     bool Input::IsMouseButtonPressed(int button) const {
-        auto it = m_MouseButtonStates.find(button);
-        if (it == m_MouseButtonStates.end()) {
-            const_cast<Input*>(this)->m_MouseButtonStates[button] = ButtonState{};
-            return glfwGetMouseButton(m_Window, button) == GLFW_PRESS;
-        }
-        return it->second.current;
+        return button >= 0 && button < MAX_MOUSE_BUTTONS && m_MouseButtonStates[button].Down;
     }
 
     bool Input::IsMouseButtonJustPressed(int button) const {
-        auto it = m_MouseButtonStates.find(button);
-        if (it == m_MouseButtonStates.end()) {
-            const_cast<Input*>(this)->m_MouseButtonStates[button] = ButtonState{};
-            return false;
-        }
-        return it->second.current && !it->second.previous;
+        return button >= 0 && button < MAX_MOUSE_BUTTONS && m_MouseButtonStates[button].Presses > 0;
     }
 
     bool Input::IsMouseButtonJustReleased(int button) const {
-        auto it = m_MouseButtonStates.find(button);
-        if (it == m_MouseButtonStates.end()) {
-            const_cast<Input*>(this)->m_MouseButtonStates[button] = ButtonState{};
-            return false;
-        }
-        return !it->second.current && it->second.previous;
+        return button >= 0 && button < MAX_MOUSE_BUTTONS && m_MouseButtonStates[button].Releases > 0;
+    }
+
+    double Input::GetMouseButtonEventTime(int button) const {
+        return (button >= 0 && button < MAX_MOUSE_BUTTONS) ? m_MouseButtonStates[button].LastEventTime : 0.0;
     }
 
     void Input::SetCursorVisible(bool visible) {
         m_CursorVisible = visible;
-        glfwSetInputMode(m_Window, GLFW_CURSOR,
-            visible ? GLFW_CURSOR_NORMAL : GLFW_CURSOR_DISABLED);
+        if (m_Backend) {
+            m_Backend->SetCursorVisible(visible);
+        }
 
         // Reset first mouse move when changing cursor mode
         m_FirstMouseMove = true;
@@ -138,10 +159,12 @@ namespace Engine {
     }
 
     void Input::SetCursorPosition(const glm::vec2& position) {
-        glfwSetCursorPos(m_Window, position.x, position.y);
+        if (m_Backend) {
+            m_Backend->SetCursorPosition(position);
+        }
         m_MousePosition = position;
         m_LastMousePosition = position;
         m_FirstMouseMove = true;
     }
 
-} // namespace Engine
\ No newline at end of file
+} // namespace Engine
@@ -1,6 +1,11 @@
 #pragma once
 #include <glm/glm.hpp>
-#include <unordered_map>
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "InputBackend.h"
+#include "InputEvent.h"
 
 // Forward declare GLFW types
 struct GLFWwindow;
@@ -9,12 +14,22 @@ namespace Engine {
 
     /**
      * @brief Input system - handles keyboard and mouse input
-     * @details Direct input handling without manager pattern
+     * @details Event driven: a backend pushes timestamped events into a queue and
+     *          Update() replays them into flat per-key state once per frame.
+     *          A key pressed and released within one frame still reports
+     *          IsKeyJustPressed and IsKeyJustReleased for that frame.
      */
     class Input {
     public:
+        // Fixed table sizes, indexed directly by GLFW key/button codes
+        static constexpr int MAX_KEYS = 512;
+        static constexpr int MAX_MOUSE_BUTTONS = 8;
+
         Input() = default;
-        ~Input() = default;
+        ~Input();
+
+        Input(const Input&) = delete;
+        Input& operator=(const Input&) = delete;
 
         /**
          * @brief Initialize with GLFW window
@@ -23,10 +38,21 @@ namespace Engine {
         void Init(GLFWwindow* window);
 
         /**
-         * @brief Update input states (call once per frame)
+         * @brief Initialize with any event source (synthetic input for headless runs)
+         * @param backend Backend to own and attach
+         */
+        void Init(std::unique_ptr<InputBackend> backend);
+
+        /**
+         * @brief Apply queued events to the key states (call once per frame, after polling)
          */
         void Update();
 
+        /**
+         * @brief Get the active event source
+         */
+        InputBackend* GetBackend() { return m_Backend.get(); }
+
         // ===== KEYBOARD =====
 
         /**
@@ -44,6 +70,11 @@ namespace Engine {
          */
         bool IsKeyJustReleased(int key) const;
 
+        /**
+         * @brief Time of the key's last press/release event (0 if never)
+         */
+        double GetKeyEventTime(int key) const;
+
         // ===== MOUSE =====
 
         /**
@@ -61,6 +92,11 @@ namespace Engine {
          */
         bool IsMouseButtonJustReleased(int button) const;
 
+        /**
+         * @brief Time of the button's last press/release event (0 if never)
+         */
+        double GetMouseButtonEventTime(int button) const;
+
         /**
          * @brief Get current mouse position
          */
@@ -91,32 +127,57 @@ namespace Engine {
          */
         void SetCursorPosition(const glm::vec2& position);
 
+        // ===== FRAME INFO =====
+
+        /**
+         * @brief Number of events applied by the last Update()
+         */
+        size_t GetFrameEventCount() const { return m_FrameEvents.size(); }
+
+        /**
+         * @brief Events applied by the last Update(), in arrival order (for recording)
+         */
+        const std::vector<InputEvent>& GetFrameEvents() const { return m_FrameEvents; }
+
+        /**
+         * @brief Timestamp of the newest event applied so far
+         */
+        double GetLastEventTime() const { return m_LastEventTime; }
+
+        /**
+         * @brief Events lost because the queue overflowed between two frames
+         */
+        size_t GetDroppedEventCount() const { return m_Queue.GetDroppedCount(); }
+
     private:
         // State tracking
         struct ButtonState {
-            bool current = false;
-            bool previous = false;
+            bool Down = false;          ///< Held at the end of the frame
+            uint8_t Presses = 0;        ///< Press events this frame
+            uint8_t Releases = 0;       ///< Release events this frame
+            double LastEventTime = 0.0;
         };
 
-        GLFWwindow* m_Window = nullptr;
+        void ApplyEvent(const InputEvent& event);
+        static void ApplyButton(ButtonState& state, const InputEvent& event);
+
+        std::unique_ptr<InputBackend> m_Backend;
+        InputEventQueue m_Queue;
 
         // States
-        std::unordered_map<int, ButtonState> m_KeyStates;
-        std::unordered_map<int, ButtonState> m_MouseButtonStates;
+        std::array<ButtonState, MAX_KEYS> m_KeyStates{};
+        std::array<ButtonState, MAX_MOUSE_BUTTONS> m_MouseButtonStates{};
 
         glm::vec2 m_MousePosition = glm::vec2(0.0f);
         glm::vec2 m_LastMousePosition = glm::vec2(0.0f);
         glm::vec2 m_MouseDelta = glm::vec2(0.0f);
         glm::vec2 m_ScrollDelta = glm::vec2(0.0f);
 
+        std::vector<InputEvent> m_FrameEvents;
+        double m_LastEventTime = 0.0;
+
         bool m_CursorVisible = true;
         bool m_FirstMouseMove = true;
-
-        // Static callback for scroll events
-        static void ScrollCallback(GLFWwindow* window, double xoffset, double yoffset);
-
-        // Instance pointer for callback
-        static Input* s_Instance;
     };
 
-} // namespace Engine
\ No newline at end of file
+} // namespace Engine
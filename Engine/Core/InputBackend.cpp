@@ -0,0 +1,116 @@
+#include "InputBackend.h"
+#include "Utility/Logger.h"
+#include <GLFW/glfw3.h>
+
+namespace Engine {
+
+    GLFWInputBackend* GLFWInputBackend::s_Instance = nullptr;
+
+    GLFWInputBackend::GLFWInputBackend(GLFWwindow* window)
+        : m_Window(window) {
+    }
+
+    GLFWInputBackend::~GLFWInputBackend() {
+        Detach();
+    }
+
+    void GLFWInputBackend::Attach(InputEventQueue& queue) {
+        InputBackend::Attach(queue);
+
+        if (!m_Window) {
+            LOG_ERROR("GLFWInputBackend: No window to attach to");
+            return;
+        }
+
+        if (s_Instance && s_Instance != this) {
+            LOG_WARNING("GLFWInputBackend: Replacing previously attached backend");
+        }
+        s_Instance = this;
+
+        glfwSetKeyCallback(m_Window, KeyCallback);
+        glfwSetMouseButtonCallback(m_Window, MouseButtonCallback);
+        glfwSetCursorPosCallback(m_Window, CursorPosCallback);
+        glfwSetScrollCallback(m_Window, ScrollCallback);
+    }
+
+    void GLFWInputBackend::Detach() {
+        // Callbacks stay installed (ImGui chains to them), they go quiet without an instance
+        if (s_Instance == this) {
+            s_Instance = nullptr;
+        }
+
+        InputBackend::Detach();
+    }
+
+    glm::vec2 GLFWInputBackend::GetInitialCursorPosition() const {
+        if (!m_Window) return glm::vec2(0.0f);
+
+        double mouseX, mouseY;
+        glfwGetCursorPos(m_Window, &mouseX, &mouseY);
+        return glm::vec2(static_cast<float>(mouseX), static_cast<float>(mouseY));
+    }
+
+    void GLFWInputBackend::SetCursorVisible(bool visible) {
+        if (!m_Window) return;
+        glfwSetInputMode(m_Window, GLFW_CURSOR,
+            visible ? GLFW_CURSOR_NORMAL : GLFW_CURSOR_DISABLED);
+    }
+
+    void GLFWInputBackend::SetCursorPosition(const glm::vec2& position) {
+        if (!m_Window) return;
+        // Fires the cursor callback, so the move reaches Input through the queue as well
+        glfwSetCursorPos(m_Window, position.x, position.y);
+    }
+
+    void GLFWInputBackend::KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+        (void)window;
+        (void)scancode;
+        if (!s_Instance || key == GLFW_KEY_UNKNOWN) return;
+
+        InputEvent event;
+        event.Timestamp = glfwGetTime();
+        event.Type = InputEventType::Key;
+        event.Action = static_cast<InputAction>(action);
+        event.Mods = static_cast<uint16_t>(mods);
+        event.Code = key;
+        s_Instance->Emit(event);
+    }
+
+    void GLFWInputBackend::MouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
+        (void)window;
+        if (!s_Instance) return;
+
+        InputEvent event;
+        event.Timestamp = glfwGetTime();
+        event.Type = InputEventType::MouseButton;
+        event.Action = static_cast<InputAction>(action);
+        event.Mods = static_cast<uint16_t>(mods);
+        event.Code = button;
+        s_Instance->Emit(event);
+    }
+
+    void GLFWInputBackend::CursorPosCallback(GLFWwindow* window, double x, double y) {
+        (void)window;
+        if (!s_Instance) return;
+
+        InputEvent event;
+        event.Timestamp = glfwGetTime();
+        event.Type = InputEventType::CursorMove;
+        event.X = static_cast<float>(x);
+        event.Y = static_cast<float>(y);
+        s_Instance->Emit(event);
+    }
+
+    void GLFWInputBackend::ScrollCallback(GLFWwindow* window, double xoffset, double yoffset) {
+        (void)window;
+        if (!s_Instance) return;
+
+        InputEvent event;
+        event.Timestamp = glfwGetTime();
+        event.Type = InputEventType::Scroll;
+        event.X = static_cast<float>(xoffset);
+        event.Y = static_cast<float>(yoffset);
+        s_Instance->Emit(event);
+    }
+
+} // namespace Engine
@@ -0,0 +1,134 @@
+#pragma once
+/**
+ * @file InputBackend.h
+ * @brief Sources of input events for the Input system
+ * @details GLFWInputBackend forwards window callbacks, SyntheticInputBackend lets
+ *          tools and headless runs inject events directly.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include <glm/glm.hpp>
+
+#include "InputEvent.h"
+
+// Forward declare GLFW types
+struct GLFWwindow;
+
+namespace Engine {
+
+    /**
+     * @brief Produces InputEvents into the queue it is attached to
+     */
+    class InputBackend {
+    public:
+        virtual ~InputBackend() = default;
+
+        /**
+         * @brief Start delivering events into the queue
+         */
+        virtual void Attach(InputEventQueue& queue) { m_Queue = &queue; }
+
+        /**
+         * @brief Stop delivering events
+         */
+        virtual void Detach() { m_Queue = nullptr; }
+
+        /**
+         * @brief Cursor position at attach time (no event has been seen yet)
+         */
+        virtual glm::vec2 GetInitialCursorPosition() const { return glm::vec2(0.0f); }
+
+        virtual void SetCursorVisible(bool visible) { (void)visible; }
+        virtual void SetCursorPosition(const glm::vec2& position) { (void)position; }
+
+    protected:
+        void Emit(const InputEvent& event) {
+            if (m_Queue) {
+                m_Queue->Push(event);
+            }
+        }
+
+        InputEventQueue* m_Queue = nullptr;
+    };
+
+    /**
+     * @brief Backend driven by GLFW key/button/cursor/scroll callbacks
+     * @details Callbacks are installed on Attach; install ImGui's afterwards so it
+     *          chains to these.
+     */
+    class GLFWInputBackend : public InputBackend {
+    public:
+        explicit GLFWInputBackend(GLFWwindow* window);
+        ~GLFWInputBackend() override;
+
+        void Attach(InputEventQueue& queue) override;
+        void Detach() override;
+
+        glm::vec2 GetInitialCursorPosition() const override;
+
+        void SetCursorVisible(bool visible) override;
+        void SetCursorPosition(const glm::vec2& position) override;
+
+    private:
+        static void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+        static void MouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+        static void CursorPosCallback(GLFWwindow* window, double x, double y);
+        static void ScrollCallback(GLFWwindow* window, double xoffset, double yoffset);
+
+        GLFWwindow* m_Window = nullptr;
+
+        // Window user pointer belongs to Application, so callbacks find the backend here
+        static GLFWInputBackend* s_Instance;
+    };
+
+    /**
+     * @brief Backend fed by hand (headless tests, tools, replay)
+     */
+    class SyntheticInputBackend : public InputBackend {
+    public:
+        void PushKey(int key, bool down, double timestamp = 0.0) {
+            InputEvent event;
+            event.Timestamp = timestamp;
+            event.Type = InputEventType::Key;
+            event.Action = down ? InputAction::Press : InputAction::Release;
+            event.Code = key;
+            Emit(event);
+        }
+
+        void PushMouseButton(int button, bool down, double timestamp = 0.0) {
+            InputEvent event;
+            event.Timestamp = timestamp;
+            event.Type = InputEventType::MouseButton;
+            event.Action = down ? InputAction::Press : InputAction::Release;
+            event.Code = button;
+            Emit(event);
+        }
+
+        void PushCursor(const glm::vec2& position, double timestamp = 0.0) {
+            InputEvent event;
+            event.Timestamp = timestamp;
+            event.Type = InputEventType::CursorMove;
+            event.X = position.x;
+            event.Y = position.y;
+            Emit(event);
+        }
+
+        void PushScroll(const glm::vec2& offset, double timestamp = 0.0) {
+            InputEvent event;
+            event.Timestamp = timestamp;
+            event.Type = InputEventType::Scroll;
+            event.X = offset.x;
+            event.Y = offset.y;
+            Emit(event);
+        }
+
+        void Push(const InputEvent& event) { Emit(event); }
+
+        void SetCursorPosition(const glm::vec2& position) override { PushCursor(position); }
+    };
+
+} // namespace Engine
@@ -0,0 +1,103 @@
+#pragma once
+/**
+ * @file InputEvent.h
+ * @brief Timestamped input events and the lock-free queue that carries them
+ * @details Window callbacks (or a synthetic backend) push events as they happen;
+ *          Input::Update() drains them once per frame, so presses that begin and
+ *          end between two frames are still observed.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine {
+
+    enum class InputEventType : uint8_t {
+        Key,            ///< Code = key, Action = press/release
+        MouseButton,    ///< Code = button, Action = press/release
+        CursorMove,     ///< X/Y = absolute cursor position
+        Scroll          ///< X/Y = scroll offset
+    };
+
+    enum class InputAction : uint8_t {
+        Release = 0,
+        Press = 1,
+        Repeat = 2
+    };
+
+    /**
+     * @brief One raw input event
+     */
+    struct InputEvent {
+        double Timestamp = 0.0;         ///< Seconds, same clock as the application loop
+        InputEventType Type = InputEventType::Key;
+        InputAction Action = InputAction::Release;
+        uint16_t Mods = 0;
+        int32_t Code = 0;
+        float X = 0.0f;
+        float Y = 0.0f;
+    };
+
+    /**
+     * @brief Bounded single-producer/single-consumer ring of input events
+     * @details Wait-free on both sides. When full, new events are dropped and counted
+     *          rather than blocking the window callback.
+     */
+    class InputEventQueue {
+    public:
+        static constexpr size_t CAPACITY = 1024;
+
+        /**
+         * @brief Producer side (window callbacks)
+         * @return false if the queue was full and the event was dropped
+         */
+        bool Push(const InputEvent& event) {
+            const size_t head = m_Head.load(std::memory_order_relaxed);
+            const size_t tail = m_Tail.load(std::memory_order_acquire);
+            if (head - tail >= CAPACITY) {
+                m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            m_Events[head & (CAPACITY - 1)] = event;
+            m_Head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Consumer side (Input::Update)
+         * @return false if the queue is empty
+         */
+        bool Pop(InputEvent& event) {
+            const size_t tail = m_Tail.load(std::memory_order_relaxed);
+            const size_t head = m_Head.load(std::memory_order_acquire);
+            if (tail == head) {
+                return false;
+            }
+
+            event = m_Events[tail & (CAPACITY - 1)];
+            m_Tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        size_t GetDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+    private:
+        static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+        std::array<InputEvent, CAPACITY> m_Events{};
+
+        // Separate cache lines so producer and consumer do not false-share
+        alignas(64) std::atomic<size_t> m_Head{ 0 };
+        alignas(64) std::atomic<size_t> m_Tail{ 0 };
+        std::atomic<size_t> m_Dropped{ 0 };
+    };
+
+} // namespace Engine
@@ -0,0 +1,239 @@
+#include "InputRecording.h"
+#include "Utility/Logger.h"
+#include "Utility/MathUtils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+namespace Engine {
+
+    namespace {
+        constexpr char     MAGIC[4] = { 'S', 'K', 'I', 'R' };
+        constexpr uint32_t VERSION = 2;
+        constexpr uint32_t FIRST_SEEDED_VERSION = 2;    ///< Version 1 logs have no start seed
+        constexpr std::streamoff FRAME_COUNT_OFFSET = 4 + 4 + 4 + 4;
+
+        template<typename T>
+        void Write(std::ostream& out, const T& value) {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template<typename T>
+        bool Read(std::istream& in, T& value) {
+            return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+
+        void WriteEvent(std::ostream& out, const InputEvent& event) {
+            Write(out, event.Timestamp);
+            Write(out, static_cast<uint8_t>(event.Type));
+            Write(out, static_cast<uint8_t>(event.Action));
+            Write(out, event.Mods);
+            Write(out, event.Code);
+            Write(out, event.X);
+            Write(out, event.Y);
+        }
+
+        bool ReadEvent(std::istream& in, InputEvent& event) {
+            uint8_t type = 0, action = 0;
+            if (!Read(in, event.Timestamp) || !Read(in, type) || !Read(in, action) ||
+                !Read(in, event.Mods) || !Read(in, event.Code) || !Read(in, event.X) || !Read(in, event.Y)) {
+                return false;
+            }
+            if (type > static_cast<uint8_t>(InputEventType::Scroll) || action > static_cast<uint8_t>(InputAction::Repeat)) {
+                return false;
+            }
+            event.Type = static_cast<InputEventType>(type);
+            event.Action = static_cast<InputAction>(action);
+            return true;
+        }
+    }
+
+    // ===== RECORDER =====
+
+    InputRecorder::~InputRecorder() {
+        Stop();
+    }
+
+    bool InputRecorder::Start(const std::string& path, const glm::vec2& initialCursor) {
+        Stop();
+
+        m_File.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_File.is_open()) {
+            LOG_ERROR("InputRecorder: Cannot open '", path, "' for writing");
+            return false;
+        }
+
+        m_Path = path;
+        m_FrameCount = 0;
+        m_StartSeed = std::random_device{}();
+        m_PendingSeeds.clear();
+
+        m_File.write(MAGIC, sizeof(MAGIC));
+        Write(m_File, VERSION);
+        Write(m_File, initialCursor.x);
+        Write(m_File, initialCursor.y);
+        Write(m_File, m_FrameCount);
+        Write(m_File, m_StartSeed);
+
+        // Whatever state the RNG was left in before the session is not part of it
+        MathUtils::setSeedFilter(nullptr);
+        MathUtils::seedRandom(m_StartSeed);
+
+        // Seeds are recorded as requested; the run itself is unaffected
+        MathUtils::setSeedFilter([this](unsigned int seed) {
+            m_PendingSeeds.push_back(seed);
+            return seed;
+        });
+
+        LOG_INFO("InputRecorder: Recording session to '", path, "'");
+        return true;
+    }
+
+    void InputRecorder::RecordFrame(float timestep, const std::vector<InputEvent>& events) {
+        if (!m_File.is_open()) return;
+
+        const uint16_t seedCount = static_cast<uint16_t>(std::min<size_t>(m_PendingSeeds.size(), UINT16_MAX));
+        const uint16_t eventCount = static_cast<uint16_t>(std::min<size_t>(events.size(), UINT16_MAX));
+
+        Write(m_File, timestep);
+        Write(m_File, seedCount);
+        Write(m_File, eventCount);
+        for (uint16_t i = 0; i < seedCount; ++i) {
+            Write(m_File, m_PendingSeeds[i]);
+        }
+        for (uint16_t i = 0; i < eventCount; ++i) {
+            WriteEvent(m_File, events[i]);
+        }
+
+        m_PendingSeeds.clear();
+        m_FrameCount++;
+    }
+
+    void InputRecorder::Stop() {
+        if (!m_File.is_open()) return;
+
+        MathUtils::setSeedFilter(nullptr);
+
+        m_File.seekp(FRAME_COUNT_OFFSET);
+        Write(m_File, m_FrameCount);
+        m_File.close();
+
+        LOG_INFO("InputRecorder: Wrote ", m_FrameCount, " frames to '", m_Path, "'");
+    }
+
+    // ===== REPLAYER =====
+
+    InputReplayer::~InputReplayer() {
+        Stop();
+    }
+
+    bool InputReplayer::Load(const std::string& path) {
+        Stop();
+        m_Frames.clear();
+        m_Seeds.clear();
+        m_Cursor = 0;
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            LOG_ERROR("InputReplayer: Cannot open '", path, "'");
+            return false;
+        }
+
+        char magic[4] = {};
+        uint32_t version = 0;
+        uint32_t frameCount = 0;
+        if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+            !Read(file, version) || !Read(file, m_InitialCursor.x) || !Read(file, m_InitialCursor.y) ||
+            !Read(file, frameCount)) {
+            LOG_ERROR("InputReplayer: '", path, "' is not a session log");
+            return false;
+        }
+
+        if (version == 0 || version > VERSION) {
+            LOG_ERROR("InputReplayer: '", path, "' has version ", version, ", expected up to ", VERSION);
+            return false;
+        }
+
+        const bool hasStartSeed = version >= FIRST_SEEDED_VERSION;
+        m_StartSeed = 0;
+        if (hasStartSeed && !Read(file, m_StartSeed)) {
+            LOG_ERROR("InputReplayer: '", path, "' is not a session log");
+            return false;
+        }
+        if (!hasStartSeed) {
+            LOG_WARNING("InputReplayer: '", path, "' has no start seed, random numbers drawn before the first recorded seed may diverge");
+        }
+
+        if (frameCount) {
+            m_Frames.reserve(frameCount);
+        }
+
+        // Read to EOF so logs from sessions that crashed are still usable
+        while (file.peek() != std::char_traits<char>::eof()) {
+            RecordedFrame frame;
+            uint16_t seedCount = 0, eventCount = 0;
+            if (!Read(file, frame.Timestep) || !Read(file, seedCount) || !Read(file, eventCount)) {
+                LOG_WARNING("InputReplayer: Truncated frame header after ", m_Frames.size(), " frames");
+                break;
+            }
+
+            frame.Seeds.resize(seedCount);
+            frame.Events.resize(eventCount);
+
+            bool ok = true;
+            for (auto& seed : frame.Seeds) {
+                ok = ok && Read(file, seed);
+            }
+            for (auto& event : frame.Events) {
+                ok = ok && ReadEvent(file, event);
+            }
+            if (!ok) {
+                LOG_WARNING("InputReplayer: Truncated frame after ", m_Frames.size(), " frames");
+                break;
+            }
+
+            m_Seeds.insert(m_Seeds.end(), frame.Seeds.begin(), frame.Seeds.end());
+            m_Frames.push_back(std::move(frame));
+        }
+
+        if (frameCount && frameCount != m_Frames.size()) {
+            LOG_WARNING("InputReplayer: Header lists ", frameCount, " frames, read ", m_Frames.size());
+        }
+
+        // Start from the RNG state the recording started from
+        if (hasStartSeed) {
+            MathUtils::seedRandom(m_StartSeed);
+        }
+
+        // Every seed request during the replay gets the recorded seed, in order
+        MathUtils::setSeedFilter([this](unsigned int requested) {
+            if (m_Seeds.empty()) {
+                LOG_WARNING("InputReplayer: Ran out of recorded seeds, replay may diverge");
+                return requested;
+            }
+            const uint32_t seed = m_Seeds.front();
+            m_Seeds.pop_front();
+            return static_cast<unsigned int>(seed);
+        });
+
+        m_Active = true;
+        LOG_INFO("InputReplayer: Loaded ", m_Frames.size(), " frames from '", path, "'");
+        return true;
+    }
+
+    const RecordedFrame* InputReplayer::NextFrame() {
+        if (!m_Active || m_Cursor >= m_Frames.size()) {
+            return nullptr;
+        }
+        return &m_Frames[m_Cursor++];
+    }
+
+    void InputReplayer::Stop() {
+        if (!m_Active) return;
+
+        MathUtils::setSeedFilter(nullptr);
+        m_Active = false;
+    }
+
+} // namespace Engine
@@ -0,0 +1,130 @@
+#pragma once
+/**
+ * @file InputRecording.h
+ * @brief Binary session log of input events, timesteps and RNG seeds
+ * @details A recorded session can be replayed frame by frame to reproduce a run
+ *          exactly (same input, same delta times, same random numbers), which is
+ *          what regression and performance comparisons need.
+ *
+ *          File layout (little endian):
+ *            header: "SKIR", u32 version, f32 cursorX, f32 cursorY, u32 frameCount,
+ *                    u32 startSeed (version 2+)
+ *            frame : f32 timestep, u16 seedCount, u16 eventCount,
+ *                    u32 seeds[seedCount], event[eventCount]
+ *            event : f64 timestamp, u8 type, u8 action, u16 mods, i32 code, f32 x, f32 y
+ *          frameCount is patched on Stop(); a log cut short by a crash is read to EOF.
+ *          The RNG is reseeded with startSeed when recording or replaying starts, so
+ *          whatever seeded it earlier in the process does not leak into the session.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "InputEvent.h"
+
+namespace Engine {
+
+    /**
+     * @brief Everything that happened in one recorded frame
+     */
+    struct RecordedFrame {
+        float Timestep = 0.0f;
+        std::vector<uint32_t> Seeds;        ///< RNG seeds requested during this frame, in order
+        std::vector<InputEvent> Events;     ///< Input events applied this frame, in order
+    };
+
+    /**
+     * @brief Streams frames to a session log while the game runs
+     */
+    class InputRecorder {
+    public:
+        InputRecorder() = default;
+        ~InputRecorder();
+
+        InputRecorder(const InputRecorder&) = delete;
+        InputRecorder& operator=(const InputRecorder&) = delete;
+
+        /**
+         * @brief Open the log, reseed the RNG with a fresh start seed and capture later seeds
+         * @return false if the file cannot be written
+         */
+        bool Start(const std::string& path, const glm::vec2& initialCursor);
+
+        /**
+         * @brief Append one frame (seeds captured since the previous frame are attached)
+         */
+        void RecordFrame(float timestep, const std::vector<InputEvent>& events);
+
+        /**
+         * @brief Finalize the header and close the file
+         */
+        void Stop();
+
+        bool IsRecording() const { return m_File.is_open(); }
+        uint32_t GetFrameCount() const { return m_FrameCount; }
+        uint32_t GetStartSeed() const { return m_StartSeed; }
+
+    private:
+        std::ofstream m_File;
+        std::string m_Path;
+        uint32_t m_FrameCount = 0;
+        uint32_t m_StartSeed = 0;
+        std::vector<uint32_t> m_PendingSeeds;
+    };
+
+    /**
+     * @brief Feeds a recorded session back frame by frame
+     * @details While active, every MathUtils::seedRandom call gets the next recorded
+     *          seed instead of the one it asked for.
+     */
+    class InputReplayer {
+    public:
+        InputReplayer() = default;
+        ~InputReplayer();
+
+        InputReplayer(const InputReplayer&) = delete;
+        InputReplayer& operator=(const InputReplayer&) = delete;
+
+        /**
+         * @brief Read a whole log, reseed the RNG as the recording did and take over seeding
+         * @return false if the file is missing or malformed
+         */
+        bool Load(const std::string& path);
+
+        /**
+         * @brief Next frame to play, nullptr once the log is exhausted
+         */
+        const RecordedFrame* NextFrame();
+
+        /**
+         * @brief Release RNG seeding
+         */
+        void Stop();
+
+        bool IsReplaying() const { return m_Active; }
+        bool IsFinished() const { return m_Cursor >= m_Frames.size(); }
+        size_t GetFrameCount() const { return m_Frames.size(); }
+        size_t GetCurrentFrame() const { return m_Cursor; }
+        glm::vec2 GetInitialCursor() const { return m_InitialCursor; }
+        uint32_t GetStartSeed() const { return m_StartSeed; }
+
+    private:
+        std::vector<RecordedFrame> m_Frames;
+        std::deque<uint32_t> m_Seeds;
+        size_t m_Cursor = 0;
+        glm::vec2 m_InitialCursor = glm::vec2(0.0f);
+        uint32_t m_StartSeed = 0;
+        bool m_Active = false;
+    };
+
+} // namespace Engine
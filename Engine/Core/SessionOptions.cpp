@@ -0,0 +1,90 @@
+#include "SessionOptions.h"
+#include "Utility/Logger.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace Engine {
+
+    SessionOptions SessionOptions::FromCommandLine(int argc, char** argv) {
+        SessionOptions options;
+
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            const bool hasValue = (i + 1 < argc);
+
+            if (std::strcmp(arg, "--record") == 0 && hasValue) {
+                options.RecordPath = argv[++i];
+            }
+            else if (std::strcmp(arg, "--replay") == 0 && hasValue) {
+                options.ReplayPath = argv[++i];
+            }
+            else if (std::strcmp(arg, "--fixed-timestep") == 0 && hasValue) {
+                options.FixedTimestep = static_cast<float>(std::atof(argv[++i]));
+            }
+            else if (std::strcmp(arg, "--timings") == 0 && hasValue) {
+                options.TimingReportPath = argv[++i];
+            }
+            else if (std::strcmp(arg, "--fps") == 0 && hasValue) {
+                options.TargetFps = std::atof(argv[++i]);
+            }
+            else if (std::strcmp(arg, "--vsync") == 0 && hasValue) {
+                options.SwapInterval = std::atoi(argv[++i]);
+            }
+            else if (std::strcmp(arg, "--net-serve") == 0 && hasValue) {
+                options.NetServePort = std::atoi(argv[++i]);
+            }
+            else if (std::strcmp(arg, "--net-connect") == 0 && hasValue) {
+                const std::string address = argv[++i];
+                const size_t colon = address.rfind(':');
+                if (colon == std::string::npos) {
+                    LOG_WARNING("--net-connect expects host:port, got ", address);
+                }
+                else {
+                    options.NetConnectHost = address.substr(0, colon);
+                    options.NetConnectPort = std::atoi(address.c_str() + colon + 1);
+                }
+            }
+            else if (std::strcmp(arg, "--config") == 0 && hasValue) {
+                options.ConfigPath = argv[++i];
+            }
+            else if (std::strcmp(arg, "--cvar") == 0 && hasValue) {
+                options.CVarOverrides.emplace_back(argv[++i]);
+            }
+            else if (std::strcmp(arg, "--headless") == 0) {
+                options.Headless = true;
+            }
+            else {
+                LOG_WARNING("Ignoring unknown command line argument: ", arg);
+            }
+        }
+
+        if (options.IsRecording() && options.IsReplaying()) {
+            LOG_WARNING("--record and --replay given together, recording is ignored");
+            options.RecordPath.clear();
+        }
+
+        if (options.NetServePort < 0 || options.NetServePort > 65535 ||
+            options.NetConnectPort < 0 || options.NetConnectPort > 65535) {
+            LOG_WARNING("Network port out of range, networking disabled");
+            options.NetServePort = 0;
+            options.NetConnectPort = 0;
+        }
+
+        if (options.IsNetServer() && options.IsNetClient()) {
+            LOG_WARNING("--net-serve and --net-connect given together, serving is ignored");
+            options.NetServePort = 0;
+        }
+
+        if (options.TargetFps < 0.0) {
+            options.TargetFps = 0.0;
+        }
+
+        if (options.FixedTimestep < 0.0f) {
+            options.FixedTimestep = 0.0f;
+        }
+
+        return options;
+    }
+
+} // namespace Engine
@@ -0,0 +1,54 @@
+#pragma once
+/**
+ * @file SessionOptions.h
+ * @brief Launch options for recording, replaying and profiling a session
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+    /**
+     * @brief How the Application loop should run this session
+     * @details Parsed from the command line:
+     *   --record <file>        write input/timestep/seed log
+     *   --replay <file>        drive the loop from a log (live input ignored)
+     *   --fixed-timestep <s>   replay with a constant delta instead of the recorded one
+     *   --headless             no window or GL context (null render backend)
+     *   --timings <file>       write per-system update timings (CSV) at shutdown
+     *   --fps <n>              frame limiter target (0 = unlimited)
+     *   --vsync <n>            swap interval (default 1, headless 0)
+ *   --net-serve <port>     replicate the scene to a client over UDP
+ *   --net-connect <h:port> mirror a server's scene instead of loading one
+ *   --config <file>        CVar config file (default engine.cfg)
+ *   --cvar <name=value>    override a CVar for this run (repeatable)
+     */
+    struct SessionOptions {
+        std::string RecordPath;
+        std::string ReplayPath;
+        std::string TimingReportPath;
+        std::string ConfigPath = "engine.cfg";
+        std::vector<std::string> CVarOverrides;
+        float FixedTimestep = 0.0f;     ///< 0 = use the recorded timestep
+        double TargetFps = 0.0;         ///< 0 = unlimited
+        int SwapInterval = -1;          ///< -1 = default for the mode
+        int NetServePort = 0;           ///< 0 = not serving
+        std::string NetConnectHost;
+        int NetConnectPort = 0;
+        bool Headless = false;
+
+        bool IsRecording() const { return !RecordPath.empty(); }
+        bool IsReplaying() const { return !ReplayPath.empty(); }
+        bool IsNetServer() const { return NetServePort > 0; }
+        bool IsNetClient() const { return NetConnectPort > 0; }
+
+        static SessionOptions FromCommandLine(int argc, char** argv);
+    };
+
+} // namespace Engine
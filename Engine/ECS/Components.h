@@ -6,10 +6,18 @@
 #include "../Component/CameraComponent.h"
 #include "../Component/MeshRendererComponent.h"
 #include "../Component/RigidbodyComponent.h"
+#include "../Component/CharacterControllerComponent.h"
+#include "../Component/TriggerComponent.h"
+#include "../Component/JointComponent.h"
+#include "../Component/AnimatorComponent.h"
+#include "../Component/ParticleEmitterComponent.h"
 #include "../Component/PrefabComponent.h"
+#include "../Component/PooledComponent.h"
 #include "../Component/AudioComponent.h"
 #include "../Component/ListenerComponent.h"
 #include "../Component/ReverbZoneComponent.h"
+#include "../Component/SimulationLODComponent.h"
+#include "../Component/ReplicatedComponent.h"
 
 namespace Engine {
     // All components are now defined in their respective headers
@@ -2,6 +2,8 @@
 #include "../Component/TagComponent.h"
 #include "../Component/TransformComponent.h"
 #include "../Component/PrefabComponent.h"
+#include "../Prefab/PrefabOverrides.h"
+#include "../Prefab/PrefabRegistry.h"
 #include "../Serialization/PrefabInstantiator.h"
 #include "../Serialization/SceneSerializer.h"
 #include "../Utility/Logger.h"
@@ -9,7 +11,26 @@
 namespace Engine {
 
     Scene::Scene(const std::string& name)
-        : m_Name(name) {
+        : m_Name(name)
+        , m_Tasks(m_Scheduler)
+        , m_PrefabPool(this) {
+        m_PrefabIndex.Connect(m_Registry);
+        m_Scheduler.Connect(m_Registry);
+        m_Tasks.Connect(m_Registry);
+
+        // Keep prefab instances in sync when a prefab asset is updated
+        m_PrefabChangeListener = PrefabRegistry::Get().AddChangeListener(
+            [this](xresource::instance_guid prefabGUID) {
+                PrefabOverrides::RefreshInstances(this, prefabGUID);
+                m_PrefabPool.OnPrefabChanged(prefabGUID);
+            });
+    }
+
+    Scene::~Scene() {
+        PrefabRegistry::Get().RemoveChangeListener(m_PrefabChangeListener);
+        m_Tasks.Disconnect(m_Registry);
+        m_Scheduler.Disconnect(m_Registry);
+        m_PrefabIndex.Disconnect(m_Registry);
     }
 
     Entity Scene::CreateEntity(const std::string& name) {
@@ -30,11 +51,17 @@ namespace Engine {
         }
 
         LOG_TRACE("Scene: Destroying entity (ID: ", static_cast<uint32_t>(entity), ")");
+        m_PrefabPool.OnEntityDestroyed(entity);
         m_Registry.destroy(entity);
     }
 
     void Scene::OnUpdate(float deltaTime) {
+        m_Tasks.BeginFrame();
+        m_Scheduler.Update(deltaTime);
+        m_SimulationLOD.Update(m_Registry, deltaTime);
         m_SystemRegistry.OnUpdate(this, deltaTime);
+        m_Tasks.ResumeReady();
+        m_Scheduler.FlushEndOfFrame();
     }
 
     bool Scene::SaveToFile(const std::string& filepath) {
@@ -79,4 +106,29 @@ namespace Engine {
         LOG_INFO("Scene: Unpacked prefab instance (Entity ID: ", static_cast<uint32_t>(entity), ")");
     }
 
+    void Scene::RecordPrefabOverrides(Entity entity) {
+        PrefabOverrides::Compute(this, entity);
+    }
+
+    Entity Scene::SpawnPrefab(
+        xresource::instance_guid prefabGUID,
+        const std::string& name) {
+
+        return m_PrefabPool.Spawn(prefabGUID, name);
+    }
+
+    bool Scene::DespawnPrefab(Entity entity) {
+        // A parked instance is gone as far as gameplay is concerned
+        if (!m_PrefabPool.Release(entity))
+            return false;
+
+        m_Scheduler.CancelAll(entity);
+        m_Tasks.CancelAll(entity);
+        return true;
+    }
+
+    uint32_t Scene::PrewarmPrefab(xresource::instance_guid prefabGUID, uint32_t count) {
+        return m_PrefabPool.Prewarm(prefabGUID, count);
+    }
+
 } // namespace Engine
\ No newline at end of file
@@ -1,6 +1,11 @@
 #pragma once
 #include "Entity.h"
 #include "ECS/SystemRegistry.h"
+#include "SimulationLOD.h"
+#include "Scheduler.h"
+#include "Task.h"
+#include "../Prefab/PrefabPool.h"
+#include "../Prefab/PrefabInstanceIndex.h"
 #include <entt/entt.hpp>
 #include <string>
 #include "../xresource_guid/include/xresource_guid.h"
@@ -17,7 +22,10 @@ namespace Engine {
     class Scene {
     public:
         Scene(const std::string& name = "Untitled Scene");
-        ~Scene() = default;
+        ~Scene();
+
+        Scene(const Scene&) = delete;
+        Scene& operator=(const Scene&) = delete;
 
         /**
          * @brief Create a new entity in this scene
@@ -94,6 +102,53 @@ namespace Engine {
          */
         void UnpackPrefabInstance(Entity entity);
 
+        /**
+         * @brief Recompute the override diff of a prefab instance
+         * @details Call after editing an instance; scene saves do this automatically.
+         * @param entity Prefab instance
+         */
+        void RecordPrefabOverrides(Entity entity);
+
+        // ===== PREFAB POOLING =====
+
+        /**
+         * @brief Spawn a pooled instance of an entity prefab
+         * @details Reuses a parked instance when one is available, otherwise instantiates
+         *          the prefab. Release with DespawnPrefab instead of DestroyEntity.
+         * @param prefabGUID GUID of the prefab to spawn
+         * @param name Optional name for the entity (overrides prefab name)
+         * @return The spawned entity
+         */
+        Entity SpawnPrefab(
+            xresource::instance_guid prefabGUID,
+            const std::string& name = ""
+        );
+
+        /**
+         * @brief Return a pooled instance to its pool (reset and parked, not destroyed)
+         * @param entity Entity returned by SpawnPrefab
+         * @return True if the entity was returned to its pool
+         */
+        bool DespawnPrefab(Entity entity);
+
+        /**
+         * @brief Pre-create parked instances of a prefab
+         * @param prefabGUID GUID of the prefab
+         * @param count Number of instances the pool should hold
+         * @return Number of instances created
+         */
+        uint32_t PrewarmPrefab(xresource::instance_guid prefabGUID, uint32_t count);
+
+        /**
+         * @brief Get the prefab pool (statistics, trimming)
+         */
+        PrefabPool& GetPrefabPool() { return m_PrefabPool; }
+
+        /**
+         * @brief Get the prefab GUID -> instances index of this scene
+         */
+        const PrefabInstanceIndex& GetPrefabInstanceIndex() const { return m_PrefabIndex; }
+
         // ===== SYSTEM MANAGEMENT =====
 
         /**
@@ -149,6 +204,31 @@ namespace Engine {
          */
         SystemRegistry& GetSystemRegistry() { return m_SystemRegistry; }
 
+        // ===== SIMULATION LOD =====
+
+        /**
+         * @brief Get the distance-based tick-rate scaler (settings, focus points, statistics)
+         * @details Updated at the start of OnUpdate, before any system runs.
+         */
+        SimulationLOD& GetSimulationLOD() { return m_SimulationLOD; }
+
+        // ===== SCHEDULER =====
+
+        /**
+         * @brief Get the timer and deferred-call service of this scene
+         * @details Timers advance with the scene delta at the start of OnUpdate; end-of-frame
+         *          calls run after every system. Entity-bound calls are cancelled when the
+         *          entity is destroyed or despawned.
+         */
+        Scheduler& GetScheduler() { return m_Scheduler; }
+
+        /**
+         * @brief Get the coroutine task runner of this scene
+         * @details Woken tasks resume once per frame, after every system ran. Tasks bound
+         *          to an entity are destroyed with it.
+         */
+        TaskRunner& GetTaskRunner() { return m_Tasks; }
+
         /**
          * @brief Initialize all systems
          * @details Called automatically when scene is loaded/created
@@ -168,7 +248,13 @@ namespace Engine {
     private:
         std::string m_Name;
         entt::registry m_Registry;
+        PrefabInstanceIndex m_PrefabIndex;
         SystemRegistry m_SystemRegistry;
+        SimulationLOD m_SimulationLOD;
+        Scheduler m_Scheduler;
+        TaskRunner m_Tasks;
+        PrefabPool m_PrefabPool;
+        uint32_t m_PrefabChangeListener = 0;
 
         friend class SceneSerializer;
     };
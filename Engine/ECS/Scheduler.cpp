@@ -0,0 +1,449 @@
+/**
+ * @file Scheduler.cpp
+ * @brief Timers and deferred calls for gameplay and engine code
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Scheduler.h"
+#include "../Utility/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+
+    namespace {
+        // Longest delay the four wheel levels can hold
+        constexpr std::uint64_t MAX_DELAY_TICKS = (1ull << 32) - 1;
+    }
+
+    Scheduler::Scheduler(double tickSeconds)
+        : m_TickSeconds(tickSeconds > 0.0 ? tickSeconds : 0.001) {
+        m_Slots.fill(NONE);
+    }
+
+    void Scheduler::Connect(entt::registry& registry) {
+        registry.on_destroy<entt::entity>().connect<&Scheduler::OnEntityDestroyed>(*this);
+    }
+
+    void Scheduler::Disconnect(entt::registry& registry) {
+        registry.on_destroy<entt::entity>().disconnect<&Scheduler::OnEntityDestroyed>(*this);
+    }
+
+    // ===== SCHEDULING =====
+
+    TimerHandle Scheduler::After(float seconds, Callback callback, entt::entity owner) {
+        if (!callback) {
+            LOG_WARNING("Scheduler::After - empty callback ignored");
+            return {};
+        }
+
+        std::uint32_t index = Allocate(std::move(callback), owner, NodeKind::TIMER);
+        m_Nodes[index].Expires = m_Now + ToTicks(seconds);
+        Insert(index);
+        m_PendingTimers++;
+        return MakeHandle(index);
+    }
+
+    TimerHandle Scheduler::Every(float interval, Callback callback, entt::entity owner, float firstDelay) {
+        if (!callback) {
+            LOG_WARNING("Scheduler::Every - empty callback ignored");
+            return {};
+        }
+
+        std::uint32_t index = Allocate(std::move(callback), owner, NodeKind::TIMER);
+        Node& node = m_Nodes[index];
+        node.Interval = ToTicks(interval);
+        node.Expires = m_Now + (firstDelay < 0.0f ? node.Interval : ToTicks(firstDelay));
+        Insert(index);
+        m_PendingTimers++;
+        return MakeHandle(index);
+    }
+
+    TimerHandle Scheduler::NextFrame(Callback callback, entt::entity owner) {
+        if (!callback) {
+            LOG_WARNING("Scheduler::NextFrame - empty callback ignored");
+            return {};
+        }
+
+        TimerHandle handle = MakeHandle(Allocate(std::move(callback), owner, NodeKind::NEXT_FRAME));
+        m_NextFrame.push_back(handle);
+        m_PendingDeferred++;
+        return handle;
+    }
+
+    TimerHandle Scheduler::EndOfFrame(Callback callback, entt::entity owner) {
+        if (!callback) {
+            LOG_WARNING("Scheduler::EndOfFrame - empty callback ignored");
+            return {};
+        }
+
+        TimerHandle handle = MakeHandle(Allocate(std::move(callback), owner, NodeKind::END_OF_FRAME));
+        m_EndOfFrame.push_back(handle);
+        m_PendingDeferred++;
+        return handle;
+    }
+
+    bool Scheduler::Cancel(TimerHandle handle) {
+        if (!Resolve(handle))
+            return false;
+        return CancelIndex(static_cast<std::uint32_t>((handle.Value & 0xFFFFFFFFull) - 1));
+    }
+
+    std::uint32_t Scheduler::CancelAll(entt::entity owner) {
+        auto it = m_OwnerHeads.find(owner);
+        if (it == m_OwnerHeads.end())
+            return 0;
+
+        std::uint32_t cancelled = 0;
+        std::uint32_t index = it->second;
+        while (index != NONE) {
+            // Read the link first, cancelling releases the node
+            std::uint32_t next = m_Nodes[index].OwnerNext;
+            if (CancelIndex(index))
+                cancelled++;
+            index = next;
+        }
+        return cancelled;
+    }
+
+    void Scheduler::Clear() {
+        for (std::uint32_t index = 0; index < m_Nodes.size(); ++index)
+            CancelIndex(index);
+
+        m_NextFrame.clear();
+        m_EndOfFrame.clear();
+    }
+
+    bool Scheduler::IsPending(TimerHandle handle) const {
+        const Node* node = Resolve(handle);
+        return node && (node->State == NodeState::PENDING || node->State == NodeState::FIRING);
+    }
+
+    float Scheduler::GetRemaining(TimerHandle handle) const {
+        const Node* node = Resolve(handle);
+        if (!node || node->Kind != NodeKind::TIMER || node->State != NodeState::PENDING)
+            return -1.0f;
+
+        double remaining = static_cast<double>(node->Expires - m_Now) * m_TickSeconds - m_Remainder;
+        return static_cast<float>(std::max(remaining, 0.0));
+    }
+
+    // ===== DRIVING =====
+
+    void Scheduler::Update(float deltaTime) {
+        if (!m_NextFrame.empty()) {
+            // Calls scheduled while these run wait for the next Update
+            m_Deferred.swap(m_NextFrame);
+            RunDeferred(m_Deferred);
+        }
+
+        m_Remainder += std::max(static_cast<double>(deltaTime), 0.0);
+        const double ticks = std::floor(m_Remainder / m_TickSeconds);
+        m_Remainder -= ticks * m_TickSeconds;
+
+        std::uint64_t count = static_cast<std::uint64_t>(ticks);
+        while (count > 0) {
+            // Nothing in the wheel: skip ahead instead of visiting empty slots
+            if (m_PendingTimers == 0) {
+                m_Now += count;
+                break;
+            }
+            Tick();
+            count--;
+        }
+    }
+
+    void Scheduler::FlushEndOfFrame() {
+        if (m_EndOfFrame.empty())
+            return;
+
+        m_Deferred.swap(m_EndOfFrame);
+        RunDeferred(m_Deferred);
+    }
+
+    SchedulerStats Scheduler::GetStats() const {
+        SchedulerStats stats;
+        stats.PendingTimers = m_PendingTimers;
+        stats.PendingDeferred = m_PendingDeferred;
+        stats.Fired = m_Fired;
+        stats.Cancelled = m_Cancelled;
+        return stats;
+    }
+
+    // ===== NODES =====
+
+    std::uint32_t Scheduler::Allocate(Callback&& callback, entt::entity owner, NodeKind kind) {
+        std::uint32_t index;
+        if (!m_FreeList.empty()) {
+            index = m_FreeList.back();
+            m_FreeList.pop_back();
+        }
+        else {
+            index = static_cast<std::uint32_t>(m_Nodes.size());
+            m_Nodes.emplace_back();
+        }
+
+        Node& node = m_Nodes[index];
+        node.Function = std::move(callback);
+        node.Expires = 0;
+        node.Interval = 0;
+        node.Sequence = m_NextSequence++;
+        node.Owner = owner;
+        node.Slot = NONE;
+        node.Prev = NONE;
+        node.Next = NONE;
+        node.OwnerPrev = NONE;
+        node.OwnerNext = NONE;
+        node.State = NodeState::PENDING;
+        node.Kind = kind;
+
+        if (owner != entt::null) {
+            auto [it, inserted] = m_OwnerHeads.try_emplace(owner, index);
+            if (!inserted) {
+                node.OwnerNext = it->second;
+                m_Nodes[it->second].OwnerPrev = index;
+                it->second = index;
+            }
+        }
+
+        return index;
+    }
+
+    void Scheduler::Release(std::uint32_t index) {
+        Node& node = m_Nodes[index];
+
+        Unlink(index);
+
+        if (node.Owner != entt::null) {
+            if (node.OwnerPrev != NONE) {
+                m_Nodes[node.OwnerPrev].OwnerNext = node.OwnerNext;
+            }
+            else if (node.OwnerNext != NONE) {
+                m_OwnerHeads[node.Owner] = node.OwnerNext;
+            }
+            else {
+                m_OwnerHeads.erase(node.Owner);
+            }
+
+            if (node.OwnerNext != NONE)
+                m_Nodes[node.OwnerNext].OwnerPrev = node.OwnerPrev;
+        }
+
+        if (node.Kind == NodeKind::TIMER)
+            m_PendingTimers--;
+        else
+            m_PendingDeferred--;
+
+        node.Function = nullptr;
+        node.Owner = entt::null;
+        node.OwnerPrev = NONE;
+        node.OwnerNext = NONE;
+        node.State = NodeState::FREE;
+
+        // Invalidates outstanding handles; skip 0 so a handle is never all zero bits
+        if (++node.Generation == 0)
+            node.Generation = 1;
+
+        m_FreeList.push_back(index);
+    }
+
+    bool Scheduler::CancelIndex(std::uint32_t index) {
+        Node& node = m_Nodes[index];
+
+        switch (node.State) {
+        case NodeState::PENDING:
+            // Deferred queues keep the stale handle, the generation check skips it
+            Release(index);
+            m_Cancelled++;
+            return true;
+
+        case NodeState::FIRING:
+            // Released by whoever is running it, once the callback returns
+            node.State = NodeState::CANCELLED;
+            m_Cancelled++;
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    TimerHandle Scheduler::MakeHandle(std::uint32_t index) const {
+        return TimerHandle{ (static_cast<std::uint64_t>(m_Nodes[index].Generation) << 32) | (static_cast<std::uint64_t>(index) + 1) };
+    }
+
+    Scheduler::Node* Scheduler::Resolve(TimerHandle handle) {
+        return const_cast<Node*>(static_cast<const Scheduler*>(this)->Resolve(handle));
+    }
+
+    const Scheduler::Node* Scheduler::Resolve(TimerHandle handle) const {
+        if (!handle)
+            return nullptr;
+
+        const std::uint64_t slot = handle.Value & 0xFFFFFFFFull;
+        if (slot == 0 || slot > m_Nodes.size())
+            return nullptr;
+
+        const Node& node = m_Nodes[slot - 1];
+        if (node.State == NodeState::FREE || node.Generation != static_cast<std::uint32_t>(handle.Value >> 32))
+            return nullptr;
+
+        return &node;
+    }
+
+    // ===== WHEEL =====
+
+    std::uint64_t Scheduler::ToTicks(float seconds) const {
+        // Round up so a timer never fires early; zero delay still waits one tick
+        const double ticks = std::ceil(std::max(static_cast<double>(seconds), 0.0) / m_TickSeconds);
+        if (ticks > static_cast<double>(MAX_DELAY_TICKS)) {
+            LOG_WARNING("Scheduler: delay of ", seconds, "s exceeds the wheel range, clamped");
+            return MAX_DELAY_TICKS;
+        }
+        return std::max<std::uint64_t>(static_cast<std::uint64_t>(ticks), 1);
+    }
+
+    void Scheduler::Insert(std::uint32_t index) {
+        Node& node = m_Nodes[index];
+
+        // Level is chosen by distance, slot by the absolute expiry tick
+        const std::uint64_t delta = node.Expires - m_Now;
+        std::uint32_t level = 0;
+        while (level + 1 < LEVELS && delta >= (1ull << (SLOT_BITS * (level + 1))))
+            level++;
+
+        const std::uint32_t slot = level * SLOTS + static_cast<std::uint32_t>((node.Expires >> (SLOT_BITS * level)) & SLOT_MASK);
+
+        node.Slot = slot;
+        node.Prev = NONE;
+        node.Next = m_Slots[slot];
+        if (node.Next != NONE)
+            m_Nodes[node.Next].Prev = index;
+        m_Slots[slot] = index;
+    }
+
+    void Scheduler::Unlink(std::uint32_t index) {
+        Node& node = m_Nodes[index];
+        if (node.Slot == NONE)
+            return;
+
+        if (node.Prev != NONE)
+            m_Nodes[node.Prev].Next = node.Next;
+        else
+            m_Slots[node.Slot] = node.Next;
+
+        if (node.Next != NONE)
+            m_Nodes[node.Next].Prev = node.Prev;
+
+        node.Slot = NONE;
+        node.Prev = NONE;
+        node.Next = NONE;
+    }
+
+    std::uint32_t Scheduler::Cascade(std::uint32_t level) {
+        const std::uint32_t slotIndex = static_cast<std::uint32_t>((m_Now >> (SLOT_BITS * level)) & SLOT_MASK);
+        const std::uint32_t slot = level * SLOTS + slotIndex;
+
+        // Redistribute the slot into finer levels now that it is within their range
+        std::uint32_t index = m_Slots[slot];
+        m_Slots[slot] = NONE;
+        while (index != NONE) {
+            std::uint32_t next = m_Nodes[index].Next;
+            m_Nodes[index].Slot = NONE;
+            Insert(index);
+            index = next;
+        }
+
+        return slotIndex;
+    }
+
+    void Scheduler::Tick() {
+        m_Now++;
+
+        if ((m_Now & SLOT_MASK) == 0) {
+            for (std::uint32_t level = 1; level < LEVELS; ++level) {
+                if (Cascade(level) != 0)
+                    break;
+            }
+        }
+
+        const std::uint32_t slot = static_cast<std::uint32_t>(m_Now & SLOT_MASK);
+        if (m_Slots[slot] == NONE)
+            return;
+
+        // Detach the whole slot first, callbacks may schedule into it
+        m_Running.clear();
+        std::uint32_t index = m_Slots[slot];
+        m_Slots[slot] = NONE;
+        while (index != NONE) {
+            Node& node = m_Nodes[index];
+            std::uint32_t next = node.Next;
+            node.Slot = NONE;
+            node.Prev = NONE;
+            node.Next = NONE;
+            m_Running.push_back(MakeHandle(index));
+            index = next;
+        }
+
+        // Same expiry tick, so scheduling order decides
+        std::sort(m_Running.begin(), m_Running.end(), [this](TimerHandle a, TimerHandle b) {
+            return Resolve(a)->Sequence < Resolve(b)->Sequence;
+        });
+
+        for (TimerHandle handle : m_Running) {
+            Node* node = Resolve(handle);
+            if (!node || node->State != NodeState::PENDING)
+                continue;
+
+            const std::uint32_t nodeIndex = static_cast<std::uint32_t>((handle.Value & 0xFFFFFFFFull) - 1);
+
+            // Move the callback out, scheduling from inside it may grow m_Nodes
+            node->State = NodeState::FIRING;
+            Callback callback = std::move(node->Function);
+            callback();
+            m_Fired++;
+
+            Node& fired = m_Nodes[nodeIndex];
+            if (fired.State == NodeState::FIRING && fired.Interval > 0) {
+                fired.Function = std::move(callback);
+                fired.State = NodeState::PENDING;
+                fired.Expires += fired.Interval;
+                fired.Sequence = m_NextSequence++;
+                Insert(nodeIndex);
+            }
+            else {
+                Release(nodeIndex);
+            }
+        }
+    }
+
+    void Scheduler::RunDeferred(std::vector<TimerHandle>& queue) {
+        for (TimerHandle handle : queue) {
+            Node* node = Resolve(handle);
+            if (!node || node->State != NodeState::PENDING)
+                continue;
+
+            const std::uint32_t nodeIndex = static_cast<std::uint32_t>((handle.Value & 0xFFFFFFFFull) - 1);
+
+            node->State = NodeState::FIRING;
+            Callback callback = std::move(node->Function);
+            callback();
+            m_Fired++;
+
+            Release(nodeIndex);
+        }
+
+        queue.clear();
+    }
+
+    void Scheduler::OnEntityDestroyed(entt::registry& registry, entt::entity entity) {
+        (void)registry;
+        CancelAll(entity);
+    }
+
+} // namespace Engine
@@ -0,0 +1,213 @@
+/**
+ * @file Scheduler.h
+ * @brief Timers and deferred calls for gameplay and engine code
+ * @details Timed callbacks live in a hierarchical timing wheel (4 levels of 256
+ *          slots), so scheduling, cancelling and advancing one tick are O(1) no
+ *          matter how many timers are pending. Firing order is by expiry tick, then
+ *          by scheduling order. Callbacks may be bound to an entity; they are
+ *          cancelled when that entity is destroyed or returned to its prefab pool.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include <entt/entt.hpp>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+    /**
+     * @brief Identifies a scheduled callback; stays safe to use after it fired
+     */
+    struct TimerHandle {
+        std::uint64_t Value = 0;
+
+        bool IsValid() const { return Value != 0; }
+        explicit operator bool() const { return IsValid(); }
+        bool operator==(const TimerHandle& other) const { return Value == other.Value; }
+    };
+
+    /**
+     * @brief Counters of the scheduler
+     */
+    struct SchedulerStats {
+        std::uint32_t PendingTimers = 0;     ///< Timers in the wheel
+        std::uint32_t PendingDeferred = 0;   ///< Next-frame and end-of-frame calls queued
+        std::uint64_t Fired = 0;             ///< Callbacks invoked since creation
+        std::uint64_t Cancelled = 0;         ///< Callbacks cancelled since creation
+    };
+
+    /**
+     * @brief Per-scene timer and deferred-call service
+     * @details Driven by Scene::OnUpdate:
+     *          - Update(dt) at the start of the frame runs next-frame calls, then every
+     *            timer that expired during dt;
+     *          - FlushEndOfFrame() after all systems ran runs end-of-frame calls.
+     *          Time is the scene delta, quantized to the tick resolution; a timer never
+     *          fires before its delay elapsed. Callbacks may schedule and cancel freely.
+     */
+    class Scheduler {
+    public:
+        using Callback = std::function<void()>;
+
+        /**
+         * @param tickSeconds Wheel resolution, defaults to one millisecond
+         */
+        explicit Scheduler(double tickSeconds = 0.001);
+
+        Scheduler(const Scheduler&) = delete;
+        Scheduler& operator=(const Scheduler&) = delete;
+
+        /**
+         * @brief Cancel callbacks bound to entities as they are destroyed
+         */
+        void Connect(entt::registry& registry);
+        void Disconnect(entt::registry& registry);
+
+        // ===== SCHEDULING =====
+
+        /**
+         * @brief Call once after a delay
+         * @param seconds Delay in scene time (0 fires on the next Update)
+         * @param callback Function to call
+         * @param owner Optional entity the call is bound to
+         */
+        TimerHandle After(float seconds, Callback callback, entt::entity owner = entt::null);
+
+        /**
+         * @brief Call repeatedly until cancelled
+         * @param interval Seconds between calls
+         * @param callback Function to call
+         * @param owner Optional entity the call is bound to
+         * @param firstDelay Delay before the first call, negative means one interval
+         */
+        TimerHandle Every(float interval, Callback callback, entt::entity owner = entt::null, float firstDelay = -1.0f);
+
+        /**
+         * @brief Call at the start of the next frame
+         */
+        TimerHandle NextFrame(Callback callback, entt::entity owner = entt::null);
+
+        /**
+         * @brief Call at the end of this frame, after every system ran
+         * @details Calls scheduled while end-of-frame calls run go to the next frame.
+         */
+        TimerHandle EndOfFrame(Callback callback, entt::entity owner = entt::null);
+
+        /**
+         * @brief Cancel a pending call (also stops a repeating timer from inside its callback)
+         * @return True if the call was still pending
+         */
+        bool Cancel(TimerHandle handle);
+
+        /**
+         * @brief Cancel every call bound to an entity
+         * @return Number of calls cancelled
+         */
+        std::uint32_t CancelAll(entt::entity owner);
+
+        /**
+         * @brief Cancel everything (scene unload)
+         */
+        void Clear();
+
+        bool IsPending(TimerHandle handle) const;
+
+        /**
+         * @brief Seconds until a timer fires, negative if it is not a pending timer
+         */
+        float GetRemaining(TimerHandle handle) const;
+
+        // ===== DRIVING =====
+
+        /**
+         * @brief Run next-frame calls and advance the wheel by deltaTime
+         */
+        void Update(float deltaTime);
+
+        /**
+         * @brief Run end-of-frame calls
+         */
+        void FlushEndOfFrame();
+
+        /**
+         * @brief Scene time accumulated by Update, in seconds
+         */
+        double GetTime() const { return static_cast<double>(m_Now) * m_TickSeconds + m_Remainder; }
+
+        double GetTickSeconds() const { return m_TickSeconds; }
+
+        SchedulerStats GetStats() const;
+
+    private:
+        static constexpr std::uint32_t LEVELS = 4;
+        static constexpr std::uint32_t SLOT_BITS = 8;
+        static constexpr std::uint32_t SLOTS = 1u << SLOT_BITS;
+        static constexpr std::uint32_t SLOT_MASK = SLOTS - 1;
+        static constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+        enum class NodeState : std::uint8_t { FREE, PENDING, FIRING, CANCELLED };
+        enum class NodeKind : std::uint8_t { TIMER, NEXT_FRAME, END_OF_FRAME };
+
+        struct Node {
+            Callback Function;
+            std::uint64_t Expires = 0;     ///< Tick the timer fires on
+            std::uint64_t Interval = 0;    ///< Ticks between repeats, 0 for one-shot
+            std::uint64_t Sequence = 0;    ///< Scheduling order, breaks ties
+            entt::entity Owner = entt::null;
+            std::uint32_t Generation = 1;
+            std::uint32_t Slot = NONE;     ///< Wheel slot (level * SLOTS + index), NONE if detached
+            std::uint32_t Prev = NONE;
+            std::uint32_t Next = NONE;
+            std::uint32_t OwnerPrev = NONE;
+            std::uint32_t OwnerNext = NONE;
+            NodeState State = NodeState::FREE;
+            NodeKind Kind = NodeKind::TIMER;
+        };
+
+        std::uint32_t Allocate(Callback&& callback, entt::entity owner, NodeKind kind);
+        void Release(std::uint32_t index);
+        bool CancelIndex(std::uint32_t index);
+        TimerHandle MakeHandle(std::uint32_t index) const;
+        Node* Resolve(TimerHandle handle);
+        const Node* Resolve(TimerHandle handle) const;
+
+        std::uint64_t ToTicks(float seconds) const;
+        void Insert(std::uint32_t index);
+        void Unlink(std::uint32_t index);
+        std::uint32_t Cascade(std::uint32_t level);
+        void Tick();
+        void RunDeferred(std::vector<TimerHandle>& queue);
+
+        void OnEntityDestroyed(entt::registry& registry, entt::entity entity);
+
+        std::vector<Node> m_Nodes;
+        std::vector<std::uint32_t> m_FreeList;
+        std::array<std::uint32_t, LEVELS * SLOTS> m_Slots;
+
+        std::vector<TimerHandle> m_NextFrame;
+        std::vector<TimerHandle> m_EndOfFrame;
+        std::vector<TimerHandle> m_Running;      ///< Timers being fired, reused between ticks
+        std::vector<TimerHandle> m_Deferred;     ///< Deferred calls being run
+
+        std::unordered_map<entt::entity, std::uint32_t> m_OwnerHeads;
+
+        double m_TickSeconds;
+        double m_Remainder = 0.0;
+        std::uint64_t m_Now = 0;
+        std::uint64_t m_NextSequence = 0;
+        std::uint32_t m_PendingTimers = 0;
+        std::uint32_t m_PendingDeferred = 0;
+        std::uint64_t m_Fired = 0;
+        std::uint64_t m_Cancelled = 0;
+    };
+
+} // namespace Engine
@@ -0,0 +1,170 @@
+/**
+ * @file SimulationLOD.cpp
+ * @brief Distance-based simulation level-of-detail (tick-rate buckets)
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "SimulationLOD.h"
+#include "../Component/TransformComponent.h"
+#include "../Component/CameraComponent.h"
+#include "../Component/ListenerComponent.h"
+#include "../Component/PooledComponent.h"
+#include "../Utility/Logger.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace Engine {
+
+    namespace {
+        glm::vec3 WorldPosition(const TransformComponent& transform) {
+            return transform.Parent == entt::null ? transform.Position : glm::vec3(transform.WorldTransform[3]);
+        }
+
+        // Stable per-entity offset so members of a bucket do not all tick on the same frame
+        std::uint32_t PhaseHash(entt::entity entity) {
+            std::uint32_t x = static_cast<std::uint32_t>(entt::to_entity(entity));
+            x ^= x >> 16;
+            x *= 0x7feb352dU;
+            x ^= x >> 15;
+            return x;
+        }
+    }
+
+    void SimulationLOD::SetSettings(const SimulationLODSettings& settings) {
+        m_Settings = settings;
+
+        if (m_Settings.Buckets.empty()) {
+            LOG_WARNING("SimulationLOD: No buckets configured, every entity ticks every frame");
+            m_Settings.Buckets.push_back({ std::numeric_limits<float>::max(), 1 });
+        }
+
+        if (m_Settings.Buckets.size() > MAX_BUCKETS) {
+            LOG_WARNING("SimulationLOD: ", m_Settings.Buckets.size(), " buckets configured, keeping the first ", MAX_BUCKETS);
+            m_Settings.Buckets.resize(MAX_BUCKETS);
+        }
+
+        for (auto& bucket : m_Settings.Buckets)
+            bucket.Interval = std::max<std::uint32_t>(bucket.Interval, 1);
+
+        m_Settings.Hysteresis = std::max(m_Settings.Hysteresis, 0.0f);
+    }
+
+    void SimulationLOD::Update(entt::registry& registry, float deltaTime) {
+        if (!m_Settings.Enabled || m_Settings.Buckets.empty()) {
+            // Drop stale state so every system falls back to full rate
+            if (m_WasEnabled)
+                registry.clear<SimulationLODComponent>();
+            m_WasEnabled = false;
+            m_Stats = SimulationLODStats{};
+            return;
+        }
+
+        m_WasEnabled = true;
+        GatherFocus(registry);
+
+        const std::size_t bucketCount = m_Settings.Buckets.size();
+        m_Stats.EntitiesPerBucket.assign(bucketCount, 0);
+        m_Stats.TickedPerBucket.assign(bucketCount, 0);
+        m_Stats.Entities = 0;
+        m_Stats.Ticked = 0;
+        m_Stats.FocusPoints = static_cast<std::uint32_t>(m_Focus.size());
+
+        auto view = registry.view<TransformComponent>(entt::exclude<InactiveComponent>);
+        for (auto entity : view) {
+            const auto& transform = view.get<TransformComponent>(entity);
+            auto& lod = registry.get_or_emplace<SimulationLODComponent>(entity);
+
+            // Without a focus point nothing is "far", keep everything in the nearest bucket
+            float nearestSq = 0.0f;
+            if (!m_Focus.empty()) {
+                const glm::vec3 position = WorldPosition(transform);
+                nearestSq = std::numeric_limits<float>::max();
+                for (const auto& focus : m_Focus) {
+                    const glm::vec3 d = position - focus;
+                    nearestSq = std::min(nearestSq, glm::dot(d, d));
+                }
+            }
+
+            lod.Bucket = lod.AlwaysTick ? 0 : SelectBucket(nearestSq, std::min<std::uint8_t>(lod.Bucket, static_cast<std::uint8_t>(bucketCount - 1)));
+
+            const std::uint32_t interval = lod.AlwaysTick ? 1 : m_Settings.Buckets[lod.Bucket].Interval;
+            if (interval != lod.Interval) {
+                lod.Interval = interval;
+                lod.Phase = PhaseHash(entity) % interval;
+            }
+
+            const std::uint32_t step = static_cast<std::uint32_t>((m_Frame + lod.Phase) % lod.Interval);
+            lod.Tick = step == 0;
+            lod.Alpha = static_cast<float>(step) / static_cast<float>(lod.Interval);
+            lod.Accumulated += deltaTime;
+
+            if (lod.Tick) {
+                lod.TickDelta = lod.Accumulated;
+                lod.Accumulated = 0.0f;
+
+                // The pose the last tick produced becomes the interpolation target
+                lod.PrevPosition = lod.HasPoses ? lod.LastPosition : transform.Position;
+                lod.PrevRotation = lod.HasPoses ? lod.LastRotation : transform.Rotation;
+                lod.PrevScale = lod.HasPoses ? lod.LastScale : transform.Scale;
+                lod.LastPosition = transform.Position;
+                lod.LastRotation = transform.Rotation;
+                lod.LastScale = transform.Scale;
+                lod.HasPoses = true;
+            }
+
+            m_Stats.Entities++;
+            m_Stats.EntitiesPerBucket[lod.Bucket]++;
+            if (lod.Tick) {
+                m_Stats.Ticked++;
+                m_Stats.TickedPerBucket[lod.Bucket]++;
+            }
+        }
+
+        m_Frame++;
+    }
+
+    void SimulationLOD::GatherFocus(entt::registry& registry) {
+        m_Focus.assign(m_ExternalFocus.begin(), m_ExternalFocus.end());
+
+        auto listeners = registry.view<ListenerComponent, TransformComponent>(entt::exclude<InactiveComponent>);
+        for (auto entity : listeners) {
+            if (listeners.get<ListenerComponent>(entity).Active)
+                m_Focus.push_back(WorldPosition(listeners.get<TransformComponent>(entity)));
+        }
+
+        auto cameras = registry.view<CameraComponent, TransformComponent>(entt::exclude<InactiveComponent>);
+        for (auto entity : cameras) {
+            if (cameras.get<CameraComponent>(entity).Enabled)
+                m_Focus.push_back(WorldPosition(cameras.get<TransformComponent>(entity)));
+        }
+    }
+
+    std::uint8_t SimulationLOD::SelectBucket(float distanceSq, std::uint8_t current) const {
+        const auto& buckets = m_Settings.Buckets;
+        const float margin = m_Settings.Hysteresis;
+
+        std::uint8_t target = 0;
+        while (target + 1u < buckets.size() && distanceSq > buckets[target].MaxDistance * buckets[target].MaxDistance)
+            target++;
+
+        // Only leave the current bucket once the edge has been crossed by the margin
+        if (target > current) {
+            const float edge = buckets[current].MaxDistance + margin;
+            if (distanceSq <= edge * edge)
+                return current;
+        }
+        else if (target < current) {
+            const float edge = std::max(buckets[current - 1].MaxDistance - margin, 0.0f);
+            if (distanceSq >= edge * edge)
+                return current;
+        }
+
+        return target;
+    }
+
+} // namespace Engine
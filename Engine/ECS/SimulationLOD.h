@@ -0,0 +1,122 @@
+/**
+ * @file SimulationLOD.h
+ * @brief Distance-based simulation level-of-detail (tick-rate buckets)
+ * @details Entities are sorted into buckets by distance to the nearest focus point
+ *          (enabled cameras, active listeners and any external focus). Each bucket
+ *          ticks every Nth frame; an entity's phase within the interval is derived
+ *          from its id so a bucket's work is spread evenly over the N frames.
+ *          Systems opt in per entity through SimulationLOD::ShouldTick.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include "../Component/SimulationLODComponent.h"
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+    /**
+     * @brief One distance band and its tick interval
+     */
+    struct SimulationLODBucket {
+        float MaxDistance;       ///< Upper bound of the band (world units)
+        std::uint32_t Interval;  ///< Tick every Interval frames
+    };
+
+    /**
+     * @brief Simulation LOD configuration
+     */
+    struct SimulationLODSettings {
+        bool Enabled = true;
+
+        /// Ordered nearest first; the last bucket catches everything beyond
+        std::vector<SimulationLODBucket> Buckets = {
+            { 40.0f, 1 },
+            { 100.0f, 2 },
+            { 250.0f, 4 },
+            { 1.0e30f, 8 },
+        };
+
+        /// Distance an entity must cross past a band edge before changing bucket
+        float Hysteresis = 5.0f;
+    };
+
+    /**
+     * @brief Counters of the last SimulationLOD::Update
+     */
+    struct SimulationLODStats {
+        std::vector<std::uint32_t> EntitiesPerBucket;
+        std::vector<std::uint32_t> TickedPerBucket;
+        std::uint32_t Entities = 0;
+        std::uint32_t Ticked = 0;
+        std::uint32_t FocusPoints = 0;
+    };
+
+    /**
+     * @brief Assigns entities to update buckets and decides which ones tick this frame
+     * @details Owned by Scene and updated at the start of Scene::OnUpdate, before any
+     *          system runs. Writes a SimulationLODComponent on every entity with a
+     *          TransformComponent.
+     */
+    class SimulationLOD {
+    public:
+        /// Hard limit on the number of buckets
+        static constexpr std::size_t MAX_BUCKETS = 8;
+
+        /**
+         * @brief Reassign buckets and compute this frame's tick flags
+         * @param registry Scene registry
+         * @param deltaTime Frame time in seconds
+         */
+        void Update(entt::registry& registry, float deltaTime);
+
+        /**
+         * @brief Whether a bucketed system should process an entity this frame
+         * @param lod The entity's LOD state, nullptr if it has none (always ticks)
+         */
+        static bool ShouldTick(const SimulationLODComponent* lod) {
+            return !lod || lod->Tick;
+        }
+
+        /**
+         * @brief Time to simulate for an entity on a tick frame
+         * @details Bucketed systems that integrate over time use this instead of the
+         *          frame delta so skipped frames are not lost.
+         */
+        static float TickDelta(const SimulationLODComponent* lod, float frameDelta) {
+            return lod ? lod->TickDelta : frameDelta;
+        }
+
+        /**
+         * @brief Add focus points that are not cameras or listeners (e.g. the editor camera)
+         * @details Cleared by ClearExternalFocus, not every frame.
+         */
+        void AddExternalFocus(const glm::vec3& position) { m_ExternalFocus.push_back(position); }
+        void ClearExternalFocus() { m_ExternalFocus.clear(); }
+
+        void SetSettings(const SimulationLODSettings& settings);
+        const SimulationLODSettings& GetSettings() const { return m_Settings; }
+
+        const SimulationLODStats& GetStats() const { return m_Stats; }
+
+    private:
+        void GatherFocus(entt::registry& registry);
+        std::uint8_t SelectBucket(float distanceSq, std::uint8_t current) const;
+
+        SimulationLODSettings m_Settings;
+        SimulationLODStats m_Stats;
+        std::vector<glm::vec3> m_ExternalFocus;
+        std::vector<glm::vec3> m_Focus;
+        std::uint64_t m_Frame = 0;
+        bool m_WasEnabled = false;
+    };
+
+} // namespace Engine
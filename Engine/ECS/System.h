@@ -1,10 +1,24 @@
 #pragma once
 #include "../Utility/Timestep.h"
+#include <cstdint>
 
 namespace Engine {
 
     // Forward declaration to avoid circular dependency
     class Scene;
+    class SystemRegistry;
+
+    /**
+     * @brief Wall-clock cost of a system's OnUpdate, filled in by the SystemRegistry
+     */
+    struct SystemTiming {
+        uint64_t Calls = 0;
+        double LastMs = 0.0;
+        double TotalMs = 0.0;
+        double MaxMs = 0.0;
+
+        double GetAverageMs() const { return Calls ? TotalMs / static_cast<double>(Calls) : 0.0; }
+    };
 
     /**
      * @brief Base class for all game systems
@@ -93,8 +107,19 @@ namespace Engine {
             m_Enabled = enabled;
         }
 
+        /**
+         * @brief Get update timings measured by the owning SystemRegistry
+         */
+        const SystemTiming& GetTiming() const {
+            return m_Timing;
+        }
+
     protected:
         bool m_Enabled = true;
+
+    private:
+        friend class SystemRegistry;
+        SystemTiming m_Timing;
     };
 
 } // namespace Engine
\ No newline at end of file
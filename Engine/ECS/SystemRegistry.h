@@ -4,6 +4,9 @@
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <string>
 
 namespace Engine {
 
@@ -126,13 +129,55 @@ namespace Engine {
          * @param ts Time elapsed since last frame
          */
         void OnUpdate(Scene* scene, Timestep ts) {
+            using Clock = std::chrono::steady_clock;
+
             for (auto& system : m_Systems) {
                 if (system->IsEnabled()) {
+                    const auto start = Clock::now();
                     system->OnUpdate(scene, ts);
+                    const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+                    SystemTiming& timing = system->m_Timing;
+                    timing.Calls++;
+                    timing.LastMs = ms;
+                    timing.TotalMs += ms;
+                    timing.MaxMs = std::max(timing.MaxMs, ms);
                 }
             }
         }
 
+        /**
+         * @brief Zero the update timings of every system
+         */
+        void ResetTimings() {
+            for (auto& system : m_Systems) {
+                system->m_Timing = SystemTiming{};
+            }
+        }
+
+        /**
+         * @brief Write per-system update timings as CSV (for comparing replayed sessions)
+         * @param path Output file
+         * @return False if the file could not be written
+         */
+        bool WriteTimingReport(const std::string& path) const {
+            std::ofstream file(path, std::ios::trunc);
+            if (!file.is_open()) {
+                LOG_ERROR("Cannot write system timing report: ", path);
+                return false;
+            }
+
+            file << "system,priority,calls,total_ms,avg_ms,max_ms\n";
+            for (const auto& system : m_Systems) {
+                const SystemTiming& timing = system->GetTiming();
+                file << system->GetName() << ',' << system->GetPriority() << ',' << timing.Calls << ','
+                     << timing.TotalMs << ',' << timing.GetAverageMs() << ',' << timing.MaxMs << '\n';
+            }
+
+            LOG_INFO("System timing report written to ", path);
+            return true;
+        }
+
         /**
          * @brief Shutdown all systems
          * @param scene The scene being shut down
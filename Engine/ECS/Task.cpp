@@ -0,0 +1,385 @@
+/**
+ * @file Task.cpp
+ * @brief C++20 coroutine tasks for gameplay sequences
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Task.h"
+#include "../Utility/Logger.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace Engine {
+
+    void Task::promise_type::unhandled_exception() noexcept {
+        // Gameplay code does not use exceptions; an escaping one is a bug
+        LOG_CRITICAL("Task: unhandled exception escaped a coroutine");
+        std::terminate();
+    }
+
+    TaskRunner::TaskRunner(Scheduler& scheduler)
+        : m_Scheduler(scheduler) {
+    }
+
+    TaskRunner::~TaskRunner() {
+        Clear();
+    }
+
+    void TaskRunner::Connect(entt::registry& registry) {
+        m_Registry = &registry;
+        registry.on_destroy<entt::entity>().connect<&TaskRunner::OnEntityDestroyed>(*this);
+    }
+
+    void TaskRunner::Disconnect(entt::registry& registry) {
+        registry.on_destroy<entt::entity>().disconnect<&TaskRunner::OnEntityDestroyed>(*this);
+        m_Registry = nullptr;
+    }
+
+    TaskHandle TaskRunner::Spawn(Task task, entt::entity owner) {
+        Task::Handle root = task.Release();
+        if (!root) {
+            LOG_WARNING("TaskRunner::Spawn - empty task ignored");
+            return {};
+        }
+
+        if (owner != entt::null && m_Registry && !m_Registry->valid(owner)) {
+            LOG_WARNING("TaskRunner::Spawn - owner entity ", static_cast<uint32_t>(owner), " is not valid, task dropped");
+            root.destroy();
+            return {};
+        }
+
+        std::uint32_t index;
+        if (!m_FreeList.empty()) {
+            index = m_FreeList.back();
+            m_FreeList.pop_back();
+        }
+        else {
+            index = static_cast<std::uint32_t>(m_Records.size());
+            m_Records.emplace_back();
+        }
+
+        Record& record = m_Records[index];
+        record.Root = root;
+        record.Suspended = root;
+        record.Owner = owner;
+        record.Timer = {};
+        record.Waiters.clear();
+        record.Wait = WaitKind::NONE;
+        record.Alive = true;
+        record.Running = false;
+        record.Cancelled = false;
+
+        TaskHandle handle{ (static_cast<std::uint64_t>(record.Generation) << 32) | (static_cast<std::uint64_t>(index) + 1) };
+        root.promise().Runner = this;
+        root.promise().Id = handle;
+
+        if (owner != entt::null)
+            m_Owned[owner].push_back(handle);
+
+        m_Alive++;
+        m_Spawned++;
+
+        // Run to the first suspension right away, like calling a function
+        Resume(handle);
+        return handle;
+    }
+
+    bool TaskRunner::Cancel(TaskHandle handle) {
+        Record* record = Resolve(handle);
+        if (!record || record->Cancelled)
+            return false;
+
+        m_Cancelled++;
+
+        // Cannot destroy a frame that is executing, Resume finishes it once it suspends
+        if (record->Running) {
+            record->Cancelled = true;
+            return true;
+        }
+
+        Finish(IndexOf(handle));
+        return true;
+    }
+
+    std::uint32_t TaskRunner::CancelAll(entt::entity owner) {
+        auto it = m_Owned.find(owner);
+        if (it == m_Owned.end())
+            return 0;
+
+        // Finish edits the list, work on a copy
+        std::vector<TaskHandle> owned = it->second;
+
+        std::uint32_t cancelled = 0;
+        for (TaskHandle handle : owned) {
+            if (Cancel(handle))
+                cancelled++;
+        }
+        return cancelled;
+    }
+
+    void TaskRunner::Clear() {
+        for (std::uint32_t index = 0; index < m_Records.size(); ++index) {
+            const Record& record = m_Records[index];
+            if (!record.Alive)
+                continue;
+            Cancel(TaskHandle{ (static_cast<std::uint64_t>(record.Generation) << 32) | (static_cast<std::uint64_t>(index) + 1) });
+        }
+
+        m_Ready.clear();
+        m_NextFrame.clear();
+        m_ContactWaiters.clear();
+        m_AssetRequests.clear();
+    }
+
+    bool TaskRunner::IsAlive(TaskHandle handle) const {
+        return Resolve(handle) != nullptr;
+    }
+
+    // ===== DRIVING =====
+
+    void TaskRunner::ResumeReady() {
+        m_ResumedLastFrame = 0;
+
+        // Asset loads are synchronous, so only a few are serviced per frame
+        for (std::uint32_t serviced = 0; serviced < m_AssetLoadsPerFrame && !m_AssetRequests.empty();) {
+            AssetRequest request = std::move(m_AssetRequests.front());
+            m_AssetRequests.pop_front();
+
+            const Record* record = Resolve(request.Id);
+            if (!record || record->Wait != WaitKind::ASSET)
+                continue;
+
+            request.Load();
+            Wake(request.Id, WaitKind::ASSET);
+            serviced++;
+        }
+
+        // Next-frame waits queued before this frame started are due
+        auto due = std::find_if(m_NextFrame.begin(), m_NextFrame.end(),
+            [this](const FrameWake& wake) { return wake.Frame >= m_Frame; });
+        for (auto it = m_NextFrame.begin(); it != due; ++it)
+            Wake(it->Id, WaitKind::NEXT_FRAME);
+        m_NextFrame.erase(m_NextFrame.begin(), due);
+
+        // Resuming can wake more tasks (a finished task releases its waiters)
+        while (!m_Ready.empty()) {
+            m_Batch.swap(m_Ready);
+            for (TaskHandle handle : m_Batch)
+                Resume(handle);
+            m_Batch.clear();
+        }
+    }
+
+    void TaskRunner::NotifyContact(entt::entity a, entt::entity b) {
+        if (m_ContactWaiters.empty())
+            return;
+
+        WakeContactWaiters(a, b, false);
+        WakeContactWaiters(b, a, false);
+    }
+
+    TaskRunnerStats TaskRunner::GetStats() const {
+        TaskRunnerStats stats;
+        stats.Alive = m_Alive;
+        stats.ResumedLastFrame = m_ResumedLastFrame;
+        stats.PendingAssetLoads = static_cast<std::uint32_t>(m_AssetRequests.size());
+        stats.Spawned = m_Spawned;
+        stats.Cancelled = m_Cancelled;
+        return stats;
+    }
+
+    // ===== AWAITABLE HOOKS =====
+
+    void TaskRunner::SuspendUntilNextFrame(Task::Handle handle) {
+        if (BeginWait(handle, WaitKind::NEXT_FRAME))
+            m_NextFrame.push_back({ handle.promise().Id, m_Frame });
+    }
+
+    void TaskRunner::SuspendFor(Task::Handle handle, float seconds) {
+        Record* record = BeginWait(handle, WaitKind::TIMER);
+        if (!record)
+            return;
+
+        TaskHandle id = handle.promise().Id;
+        record->Timer = m_Scheduler.After(seconds, [this, id]() { Wake(id, WaitKind::TIMER); }, record->Owner);
+    }
+
+    bool TaskRunner::SuspendUntilDone(Task::Handle handle, TaskHandle target) {
+        const TaskHandle id = handle.promise().Id;
+
+        Record* awaited = Resolve(target);
+        if (!awaited)
+            return false;
+
+        if (target == id) {
+            LOG_WARNING("TaskRunner: a task cannot wait for itself, continuing");
+            return false;
+        }
+
+        awaited->Waiters.push_back(id);
+        BeginWait(handle, WaitKind::TASK);
+        return true;
+    }
+
+    void TaskRunner::SuspendUntilContact(Task::Handle handle, entt::entity self, entt::entity other, entt::entity* hit) {
+        if (!BeginWait(handle, WaitKind::CONTACT))
+            return;
+
+        *hit = entt::null;
+
+        // An entity that is already gone will never touch anything
+        if (self == entt::null || (m_Registry && !m_Registry->valid(self))) {
+            Wake(handle.promise().Id, WaitKind::CONTACT);
+            return;
+        }
+
+        m_ContactWaiters[self].push_back({ handle.promise().Id, other, hit });
+    }
+
+    void TaskRunner::SuspendUntilLoaded(Task::Handle handle, std::function<void()> load) {
+        if (BeginWait(handle, WaitKind::ASSET))
+            m_AssetRequests.push_back({ handle.promise().Id, std::move(load) });
+    }
+
+    // ===== INTERNALS =====
+
+    TaskRunner::Record* TaskRunner::Resolve(TaskHandle handle) {
+        return const_cast<Record*>(static_cast<const TaskRunner*>(this)->Resolve(handle));
+    }
+
+    const TaskRunner::Record* TaskRunner::Resolve(TaskHandle handle) const {
+        if (!handle)
+            return nullptr;
+
+        const std::uint64_t slot = handle.Value & 0xFFFFFFFFull;
+        if (slot == 0 || slot > m_Records.size())
+            return nullptr;
+
+        const Record& record = m_Records[slot - 1];
+        if (!record.Alive || record.Generation != static_cast<std::uint32_t>(handle.Value >> 32))
+            return nullptr;
+
+        return &record;
+    }
+
+    TaskRunner::Record* TaskRunner::BeginWait(Task::Handle handle, WaitKind kind) {
+        Record* record = Resolve(handle.promise().Id);
+        if (!record) {
+            LOG_ERROR("TaskRunner: awaiting from a task that is not running on this runner");
+            return nullptr;
+        }
+
+        record->Suspended = handle;
+        record->Wait = kind;
+        return record;
+    }
+
+    void TaskRunner::Wake(TaskHandle handle, WaitKind kind) {
+        Record* record = Resolve(handle);
+        if (!record || record->Wait != kind)
+            return;
+
+        // Cleared here so a second wake source cannot queue it twice
+        record->Wait = WaitKind::NONE;
+        m_Ready.push_back(handle);
+    }
+
+    void TaskRunner::Resume(TaskHandle handle) {
+        Record* record = Resolve(handle);
+        if (!record || record->Running || record->Cancelled)
+            return;
+
+        const std::uint32_t index = IndexOf(handle);
+
+        record->Running = true;
+        record->Wait = WaitKind::NONE;
+        record->Suspended.resume();
+        m_ResumedLastFrame++;
+
+        // Spawning from inside the task may have grown m_Records
+        Record& resumed = m_Records[index];
+        resumed.Running = false;
+
+        if (resumed.Root.done() || resumed.Cancelled)
+            Finish(index);
+    }
+
+    void TaskRunner::Finish(std::uint32_t index) {
+        Record& record = m_Records[index];
+
+        m_Scheduler.Cancel(record.Timer);
+
+        if (record.Owner != entt::null) {
+            const TaskHandle handle{ (static_cast<std::uint64_t>(record.Generation) << 32) | (static_cast<std::uint64_t>(index) + 1) };
+            auto it = m_Owned.find(record.Owner);
+            if (it != m_Owned.end()) {
+                auto& owned = it->second;
+                owned.erase(std::remove(owned.begin(), owned.end(), handle), owned.end());
+                if (owned.empty())
+                    m_Owned.erase(it);
+            }
+        }
+
+        Task::Handle root = record.Root;
+        std::vector<TaskHandle> waiters = std::move(record.Waiters);
+
+        // Retire the record before destroying the frame; destructors of its locals
+        // must not be able to reach it again. Pending wakes fail the generation check.
+        record.Root = {};
+        record.Suspended = {};
+        record.Owner = entt::null;
+        record.Timer = {};
+        record.Waiters.clear();
+        record.Wait = WaitKind::NONE;
+        record.Alive = false;
+        record.Running = false;
+        record.Cancelled = false;
+        if (++record.Generation == 0)
+            record.Generation = 1;
+        m_FreeList.push_back(index);
+        m_Alive--;
+
+        root.destroy();
+
+        for (TaskHandle waiter : waiters)
+            Wake(waiter, WaitKind::TASK);
+    }
+
+    void TaskRunner::WakeContactWaiters(entt::entity self, entt::entity other, bool destroyed) {
+        auto it = m_ContactWaiters.find(self);
+        if (it == m_ContactWaiters.end())
+            return;
+
+        auto& waiters = it->second;
+        waiters.erase(std::remove_if(waiters.begin(), waiters.end(), [&](const ContactWaiter& waiter) {
+            const Record* record = Resolve(waiter.Id);
+            if (!record || record->Wait != WaitKind::CONTACT)
+                return true;  // Stale: task finished or cancelled
+
+            if (!destroyed && waiter.Other != entt::null && waiter.Other != other)
+                return false;
+
+            *waiter.Hit = destroyed ? entt::null : other;
+            Wake(waiter.Id, WaitKind::CONTACT);
+            return true;
+        }), waiters.end());
+
+        if (waiters.empty())
+            m_ContactWaiters.erase(it);
+    }
+
+    void TaskRunner::OnEntityDestroyed(entt::registry& registry, entt::entity entity) {
+        (void)registry;
+
+        CancelAll(entity);
+
+        // Tasks owned by someone else but waiting on this entity resume with a null hit
+        WakeContactWaiters(entity, entt::null, true);
+    }
+
+} // namespace Engine
@@ -0,0 +1,379 @@
+/**
+ * @file Task.h
+ * @brief C++20 coroutine tasks for gameplay sequences
+ * @details A Task is a coroutine returning Task. Spawn it on the scene's TaskRunner,
+ *          optionally bound to an owner entity, and write the sequence linearly:
+ *
+ *          ```cpp
+ *          Task OpenDoor(Scene* scene, Entity door) {
+ *              co_await WaitSeconds{ 2.0f };
+ *              door.GetComponent<AudioComponent>().State = PlayState::PLAY;
+ *              Entity crate = scene->SpawnPrefab(cratePrefab);
+ *              co_await WaitForContact{ crate };    // until it lands
+ *              co_await Shake(door);                // runs a child Task to completion
+ *          }
+ *
+ *          scene->GetTaskRunner().Spawn(OpenDoor(scene, door), door);
+ *          ```
+ *
+ *          A suspended task is only touched again by whatever wakes it (a scheduler
+ *          timer, a contact, an asset load...), so it costs nothing per frame. Woken
+ *          tasks are resumed together once per frame on the main thread. When the owner
+ *          entity is destroyed the task frame is destroyed with it and never resumes.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include "Scheduler.h"
+#include <entt/entt.hpp>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+
+    class TaskRunner;
+
+    /**
+     * @brief Identifies a spawned task; stays safe to use after the task finished
+     */
+    struct TaskHandle {
+        std::uint64_t Value = 0;
+
+        bool IsValid() const { return Value != 0; }
+        explicit operator bool() const { return IsValid(); }
+        bool operator==(const TaskHandle& other) const { return Value == other.Value; }
+    };
+
+    /**
+     * @brief Coroutine return type for gameplay tasks
+     * @details Lazily started: nothing runs until the task is spawned on a TaskRunner or
+     *          awaited from another task. Awaiting a Task runs it as a child of the
+     *          awaiting task (same owner, cancelled together) and resumes the parent
+     *          when it completes.
+     */
+    class Task {
+    public:
+        struct promise_type {
+            TaskRunner* Runner = nullptr;           ///< Set when spawned or awaited
+            TaskHandle Id;                          ///< Root task this frame belongs to
+            std::coroutine_handle<> Continuation;   ///< Parent awaiting this child
+
+            Task get_return_object() noexcept {
+                return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept { return {}; }
+
+            struct FinalAwaiter {
+                bool await_ready() const noexcept { return false; }
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+                    std::coroutine_handle<> continuation = handle.promise().Continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+                void await_resume() const noexcept {}
+            };
+
+            FinalAwaiter final_suspend() noexcept { return {}; }
+
+            void return_void() noexcept {}
+
+            void unhandled_exception() noexcept;
+        };
+
+        using Handle = std::coroutine_handle<promise_type>;
+
+        Task() = default;
+        explicit Task(Handle handle) : m_Handle(handle) {}
+
+        ~Task() {
+            if (m_Handle)
+                m_Handle.destroy();
+        }
+
+        Task(Task&& other) noexcept : m_Handle(std::exchange(other.m_Handle, {})) {}
+
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                if (m_Handle)
+                    m_Handle.destroy();
+                m_Handle = std::exchange(other.m_Handle, {});
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        bool IsValid() const { return static_cast<bool>(m_Handle); }
+
+        /**
+         * @brief Give up ownership of the coroutine frame (used by TaskRunner::Spawn)
+         */
+        Handle Release() { return std::exchange(m_Handle, {}); }
+
+        /**
+         * @brief Run this task as a child of the awaiting task
+         */
+        auto operator co_await() && noexcept {
+            struct Awaiter {
+                Handle Child;
+
+                bool await_ready() const noexcept { return !Child || Child.done(); }
+
+                std::coroutine_handle<> await_suspend(Handle parent) noexcept {
+                    promise_type& child = Child.promise();
+                    child.Runner = parent.promise().Runner;
+                    child.Id = parent.promise().Id;
+                    child.Continuation = parent;
+                    return Child;
+                }
+
+                void await_resume() const noexcept {}
+            };
+            return Awaiter{ m_Handle };
+        }
+
+    private:
+        Handle m_Handle;
+    };
+
+    // ===== AWAITABLES =====
+
+    /**
+     * @brief Resume in next frame's task batch
+     */
+    struct WaitNextFrame {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(Task::Handle handle);
+        void await_resume() const noexcept {}
+    };
+
+    /**
+     * @brief Resume once a delay of scene time elapsed (backed by a Scheduler timer)
+     */
+    struct WaitSeconds {
+        float Seconds = 0.0f;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(Task::Handle handle);
+        void await_resume() const noexcept {}
+    };
+
+    /**
+     * @brief Resume when another spawned task finishes (completed or cancelled)
+     * @details Does not suspend if the task already finished.
+     */
+    struct WaitForTask {
+        TaskHandle Target;
+
+        bool await_ready() const noexcept { return !Target; }
+        bool await_suspend(Task::Handle handle);
+        void await_resume() const noexcept {}
+    };
+
+    /**
+     * @brief Resume when a physics body of Self starts touching another body
+     * @details Returns the entity that was hit, or entt::null if Self was destroyed
+     *          while waiting.
+     */
+    struct WaitForContact {
+        entt::entity Self = entt::null;
+        entt::entity Other = entt::null;   ///< Only this entity counts, null for any
+        entt::entity Hit = entt::null;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(Task::Handle handle);
+        entt::entity await_resume() const noexcept { return Hit; }
+    };
+
+    /**
+     * @brief Counters of a TaskRunner
+     */
+    struct TaskRunnerStats {
+        std::uint32_t Alive = 0;              ///< Spawned tasks not yet finished
+        std::uint32_t ResumedLastFrame = 0;   ///< Resumptions in the last batch
+        std::uint32_t PendingAssetLoads = 0;  ///< Asset requests waiting for a frame slot
+        std::uint64_t Spawned = 0;
+        std::uint64_t Cancelled = 0;
+    };
+
+    /**
+     * @brief Per-scene owner and scheduler of coroutine tasks
+     * @details Driven by Scene::OnUpdate: BeginFrame() first, ResumeReady() after every
+     *          system ran, so resumed gameplay code sees this frame's simulation results.
+     *          Tasks run on the main thread only.
+     */
+    class TaskRunner {
+    public:
+        explicit TaskRunner(Scheduler& scheduler);
+        ~TaskRunner();
+
+        TaskRunner(const TaskRunner&) = delete;
+        TaskRunner& operator=(const TaskRunner&) = delete;
+
+        /**
+         * @brief Destroy tasks whose owner entity is destroyed
+         */
+        void Connect(entt::registry& registry);
+        void Disconnect(entt::registry& registry);
+
+        /**
+         * @brief Take ownership of a task and run it up to its first suspension
+         * @param task Task to run
+         * @param owner Optional entity the task lives and dies with
+         * @return Handle to cancel or await the task
+         */
+        TaskHandle Spawn(Task task, entt::entity owner = entt::null);
+
+        /**
+         * @brief Destroy a task; it never resumes again
+         * @details A task cancelling itself is destroyed once it suspends.
+         * @return True if the task was still alive
+         */
+        bool Cancel(TaskHandle handle);
+
+        /**
+         * @brief Cancel every task owned by an entity
+         * @return Number of tasks cancelled
+         */
+        std::uint32_t CancelAll(entt::entity owner);
+
+        /**
+         * @brief Cancel every task (scene unload)
+         */
+        void Clear();
+
+        bool IsAlive(TaskHandle handle) const;
+
+        // ===== DRIVING =====
+
+        /**
+         * @brief Start a new frame (tasks that wait for the next frame become due)
+         */
+        void BeginFrame() { m_Frame++; }
+
+        /**
+         * @brief Resume every woken task, once per frame
+         */
+        void ResumeReady();
+
+        /**
+         * @brief Report that two entities' bodies started touching (called by physics)
+         */
+        void NotifyContact(entt::entity a, entt::entity b);
+
+        /**
+         * @brief True while a task waits for a contact, lets physics skip reporting
+         */
+        bool HasContactWaiters() const { return !m_ContactWaiters.empty(); }
+
+        /**
+         * @brief Maximum asset loads serviced per frame for waiting tasks
+         */
+        void SetAssetLoadsPerFrame(std::uint32_t count) { m_AssetLoadsPerFrame = count > 0 ? count : 1; }
+
+        TaskRunnerStats GetStats() const;
+
+        // ===== AWAITABLE HOOKS =====
+        // Called from the awaitables' await_suspend; not meant for gameplay code.
+
+        void SuspendUntilNextFrame(Task::Handle handle);
+        void SuspendFor(Task::Handle handle, float seconds);
+        bool SuspendUntilDone(Task::Handle handle, TaskHandle target);
+        void SuspendUntilContact(Task::Handle handle, entt::entity self, entt::entity other, entt::entity* hit);
+        void SuspendUntilLoaded(Task::Handle handle, std::function<void()> load);
+
+    private:
+        enum class WaitKind : std::uint8_t { NONE, NEXT_FRAME, TIMER, TASK, CONTACT, ASSET };
+
+        struct Record {
+            Task::Handle Root;
+            std::coroutine_handle<> Suspended;    ///< Innermost frame to resume
+            entt::entity Owner = entt::null;
+            TimerHandle Timer;
+            std::vector<TaskHandle> Waiters;      ///< Tasks awaiting this one
+            std::uint32_t Generation = 1;
+            WaitKind Wait = WaitKind::NONE;
+            bool Alive = false;
+            bool Running = false;
+            bool Cancelled = false;
+        };
+
+        struct FrameWake {
+            TaskHandle Id;
+            std::uint64_t Frame;
+        };
+
+        struct ContactWaiter {
+            TaskHandle Id;
+            entt::entity Other;
+            entt::entity* Hit;
+        };
+
+        struct AssetRequest {
+            TaskHandle Id;
+            std::function<void()> Load;
+        };
+
+        Record* Resolve(TaskHandle handle);
+        const Record* Resolve(TaskHandle handle) const;
+        static std::uint32_t IndexOf(TaskHandle handle) { return static_cast<std::uint32_t>((handle.Value & 0xFFFFFFFFull) - 1); }
+
+        Record* BeginWait(Task::Handle handle, WaitKind kind);
+        void Wake(TaskHandle handle, WaitKind kind);
+        void Resume(TaskHandle handle);
+        void Finish(std::uint32_t index);
+        void WakeContactWaiters(entt::entity self, entt::entity other, bool destroyed);
+
+        void OnEntityDestroyed(entt::registry& registry, entt::entity entity);
+
+        Scheduler& m_Scheduler;
+        entt::registry* m_Registry = nullptr;
+
+        std::vector<Record> m_Records;
+        std::vector<std::uint32_t> m_FreeList;
+        std::unordered_map<entt::entity, std::vector<TaskHandle>> m_Owned;
+
+        std::vector<TaskHandle> m_Ready;
+        std::vector<TaskHandle> m_Batch;
+        std::vector<FrameWake> m_NextFrame;
+        std::unordered_map<entt::entity, std::vector<ContactWaiter>> m_ContactWaiters;
+        std::deque<AssetRequest> m_AssetRequests;
+
+        std::uint64_t m_Frame = 0;
+        std::uint32_t m_AssetLoadsPerFrame = 4;
+        std::uint32_t m_Alive = 0;
+        std::uint32_t m_ResumedLastFrame = 0;
+        std::uint64_t m_Spawned = 0;
+        std::uint64_t m_Cancelled = 0;
+    };
+
+    // ===== AWAITABLE IMPLEMENTATION =====
+
+    inline void WaitNextFrame::await_suspend(Task::Handle handle) {
+        handle.promise().Runner->SuspendUntilNextFrame(handle);
+    }
+
+    inline void WaitSeconds::await_suspend(Task::Handle handle) {
+        handle.promise().Runner->SuspendFor(handle, Seconds);
+    }
+
+    inline bool WaitForTask::await_suspend(Task::Handle handle) {
+        return handle.promise().Runner->SuspendUntilDone(handle, Target);
+    }
+
+    inline void WaitForContact::await_suspend(Task::Handle handle) {
+        handle.promise().Runner->SuspendUntilContact(handle, Self, Other, &Hit);
+    }
+
+} // namespace Engine
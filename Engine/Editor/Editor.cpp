@@ -13,6 +13,8 @@
 #include "../Component/TagComponent.h"
 #include "../Component/TransformComponent.h"
 #include "../Serialization/SceneSerializer.h"
+#include "../World/WorldPartitionBuilder.h"
+#include "../Core/CVar.h"
 
 // Include other necessary headers
 #include <GLFW/glfw3.h>
@@ -27,6 +29,22 @@ namespace Engine
 	void Editor::SetScene(Engine::Scene* scene)
 	{
 		m_Scene = scene;
+		m_SelectedEntity = Entity();
+		m_Hierarchy.Attach(scene ? &scene->GetRegistry() : nullptr);
+		m_Inspector.Invalidate();
+		m_History.SetScene(scene);
+	}
+
+	void Editor::undo()
+	{
+		if (m_History.Undo())
+			m_Inspector.Invalidate();
+	}
+
+	void Editor::redo()
+	{
+		if (m_History.Redo())
+			m_Inspector.Invalidate();
 	}
 
 	void Editor::OnInit(GLuint texhandle)
@@ -82,6 +100,18 @@ namespace Engine
 
 		displayTopMenu();
 
+		// Editor shortcuts (skipped while a text field owns the keyboard)
+		if (!io->WantTextInput)
+		{
+			if (ImGui::IsKeyPressed(ImGuiKey_GraveAccent, false))
+				consoleWindow = !consoleWindow;
+
+			if (ImGui::IsKeyChordPressed(ImGuiMod_Ctrl | ImGuiKey_Z))
+				undo();
+			else if (ImGui::IsKeyChordPressed(ImGuiMod_Ctrl | ImGuiKey_Y))
+				redo();
+		}
+
 		renderViewport();
 
 		// Panel Logic
@@ -93,6 +123,8 @@ namespace Engine
 
 		displayPerformanceProfilePanel(ts);
 
+		displayConsolePanel();
+
 		//Complete Imgui rendering for the frame
 		CompleteFrame();
 	}
@@ -109,6 +141,8 @@ namespace Engine
 				{
 					if (m_Scene)
 					{
+						// Scene switches are not undoable, drop history referring to the old entities
+						m_History.Clear();
 						m_Scene->GetRegistry().clear();
 						currScenePath = "";
 						isNewScene = true;
@@ -152,6 +186,20 @@ namespace Engine
 				if (ImGui::IsItemHovered())
 					ImGui::SetTooltip("Save scene as a new file.");
 
+				// --------------- Build World Partition -------------------
+				if (ImGui::MenuItem("Build World Partition", nullptr, false, m_Scene && !currScenePath.empty()))
+				{
+					// Cells go next to the scene file, in a folder named after it
+					std::filesystem::path scenePath(currScenePath);
+					std::filesystem::path worldDir = scenePath.parent_path() / scenePath.stem();
+					if (WorldPartitionBuilder::Build(m_Scene, worldDir.string(), 64.0f))
+						LOG_INFO("World partition built to: ", worldDir.string());
+					else
+						LOG_ERROR("Failed to build world partition for: ", currScenePath);
+				}
+				if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+					ImGui::SetTooltip("Split the saved scene into streamable cells.");
+
 				ImGui::Separator();
 
 				// ====================== Script Section ==========================
@@ -192,8 +240,10 @@ namespace Engine
 
 			if (ImGui::BeginMenu("Edit"))
 			{
-				if (ImGui::MenuItem("Undo", "Ctrl+Z", false, false)) {}  // Disabled for now
-				if (ImGui::MenuItem("Redo", "Ctrl+Y", false, false)) {}  // Disabled for now
+				std::string undoLabel = m_History.CanUndo() ? "Undo " + m_History.GetUndoName() : "Undo";
+				std::string redoLabel = m_History.CanRedo() ? "Redo " + m_History.GetRedoName() : "Redo";
+				if (ImGui::MenuItem(undoLabel.c_str(), "Ctrl+Z", false, m_History.CanUndo())) { undo(); }
+				if (ImGui::MenuItem(redoLabel.c_str(), "Ctrl+Y", false, m_History.CanRedo())) { redo(); }
 				ImGui::Separator();
 				if (ImGui::MenuItem("Cut", "Ctrl+X", false, false)) {}
 				if (ImGui::MenuItem("Copy", "Ctrl+C", false, false)) {}
@@ -206,6 +256,7 @@ namespace Engine
 				ImGui::MenuItem("Hierarchy", NULL, &hierachyWindow);
 				ImGui::MenuItem("Properties", NULL, &inspectorWindow);
 				ImGui::MenuItem("Performance Profile", NULL, &performanceProfileWindow);
+				ImGui::MenuItem("Console", "`", &consoleWindow);
 				ImGui::EndMenu();
 			}
 
@@ -232,59 +283,8 @@ namespace Engine
 
 		if (ImGui::Begin("Properties", &inspectorWindow))
 		{
-			if (m_SelectedEntity)
-			{
-				// Display entity name (TagComponent)
-				if (m_SelectedEntity.HasComponent<TagComponent>())
-				{
-					auto& tag = m_SelectedEntity.GetComponent<TagComponent>();
-					char buffer[256];
-					strncpy_s(buffer, sizeof(buffer), tag.Tag.c_str(), _TRUNCATE);
-					if (ImGui::InputText("Name", buffer, sizeof(buffer)))
-					{
-						tag.Tag = std::string(buffer);
-					}
-				}
-
-				ImGui::Separator();
-
-				// Display TransformComponent
-				if (m_SelectedEntity.HasComponent<TransformComponent>())
-				{
-					if (ImGui::CollapsingHeader("Transform", ImGuiTreeNodeFlags_DefaultOpen))
-					{
-						auto& transform = m_SelectedEntity.GetComponent<TransformComponent>();
-
-						// Position
-						glm::vec3 position = transform.Position;
-						if (ImGui::DragFloat3("Position", &position.x, 0.1f))
-						{
-							transform.SetPosition(position);
-						}
-
-						// Rotation (in degrees)
-						glm::vec3 rotation = glm::degrees(glm::eulerAngles(transform.Rotation));
-						if (ImGui::DragFloat3("Rotation", &rotation.x, 1.0f))
-						{
-							// Convert back to quaternion
-							transform.SetRotation(rotation);
-						}
-
-						// Scale
-						glm::vec3 scale = transform.Scale;
-						if (ImGui::DragFloat3("Scale", &scale.x, 0.1f, 0.001f))
-						{
-							transform.SetScale(scale);
-						}
-					}
-				}
-
-				// Display other components...
-			}
-			else
-			{
-				ImGui::Text("No entity selected");
-			}
+			// Every registered component, layout rebuilt only when the selection changes
+			m_Inspector.Draw(m_Scene, m_SelectedEntity);
 		}
 		ImGui::End();
 	}
@@ -302,45 +302,87 @@ namespace Engine
 				auto entity = m_Scene->CreateEntity("New Entity");
 				entity.AddComponent<TagComponent>("New Entity");
 				entity.AddComponent<TransformComponent>();
+				m_History.RecordCreateEntity(entity);
 			}
 
 			ImGui::Separator();
 
-			// List all entities
+			// List entities as a tree, only the rows scrolled into view are submitted
 			if (m_Scene)
 			{
-				auto view = m_Scene->GetRegistry().view<TagComponent>();
+				auto& registry = m_Scene->GetRegistry();
+				const auto& rows = m_Hierarchy.GetRows();
 
-				for (auto entityHandle : view)
-				{
-					Entity entity(entityHandle, &m_Scene->GetRegistry());
-					auto& tag = entity.GetComponent<TagComponent>();
+				ImGui::Text("Entities: %zu", m_Hierarchy.GetEntityCount());
+				ImGui::BeginChild("HierarchyRows");
+
+				const float indent = ImGui::GetStyle().IndentSpacing;
+				Entity pendingDelete{};
 
-					ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
-					if (m_SelectedEntity == entity)
+				ImGuiListClipper clipper;
+				clipper.Begin(static_cast<int>(rows.size()));
+				while (clipper.Step())
+				{
+					for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
 					{
-						flags |= ImGuiTreeNodeFlags_Selected;
-					}
+						const auto& row = rows[i];
+						if (!registry.valid(row.Handle))
+							continue;
 
-					ImGui::TreeNodeEx((void*)(uint64_t)(uint32_t)entity, flags, "%s", tag.Tag.c_str());
+						Entity entity(row.Handle, &registry);
+						auto& tag = entity.GetComponent<TagComponent>();
 
-					if (ImGui::IsItemClicked())
-					{
-						m_SelectedEntity = entity;
-					}
+						ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanAvailWidth
+							| ImGuiTreeNodeFlags_NoTreePushOnOpen;
+						if (!row.HasChildren)
+						{
+							flags |= ImGuiTreeNodeFlags_Leaf;
+						}
+						if (m_SelectedEntity == entity)
+						{
+							flags |= ImGuiTreeNodeFlags_Selected;
+						}
 
-					// Right-click context menu
-					if (ImGui::BeginPopupContextItem())
-					{
-						if (ImGui::MenuItem("Delete Entity"))
+						if (row.Depth > 0)
+							ImGui::Indent(indent * row.Depth);
+
+						ImGui::SetNextItemOpen(row.Expanded);
+						ImGui::TreeNodeEx((void*)(uint64_t)(uint32_t)entity, flags, "%s", tag.Tag.c_str());
+
+						// Expansion changes take effect when the rows are rebuilt next frame
+						if (ImGui::IsItemToggledOpen())
 						{
-							m_Scene->DestroyEntity(entity);
-							if (m_SelectedEntity == entity)
+							m_Hierarchy.SetExpanded(row.Handle, !row.Expanded);
+						}
+						else if (ImGui::IsItemClicked())
+						{
+							m_SelectedEntity = entity;
+						}
+
+						// Right-click context menu
+						if (ImGui::BeginPopupContextItem())
+						{
+							if (ImGui::MenuItem("Delete Entity"))
 							{
-								m_SelectedEntity = Entity();
+								pendingDelete = entity;
 							}
+							ImGui::EndPopup();
 						}
-						ImGui::EndPopup();
+
+						if (row.Depth > 0)
+							ImGui::Unindent(indent * row.Depth);
+					}
+				}
+				clipper.End();
+				ImGui::EndChild();
+
+				// Deferred so the rows stay valid while they are drawn
+				if (pendingDelete)
+				{
+					m_History.DestroyEntity(pendingDelete);
+					if (m_SelectedEntity == pendingDelete)
+					{
+						m_SelectedEntity = Entity();
 					}
 				}
 			}
@@ -427,6 +469,7 @@ namespace Engine
 						{
 							if (m_Scene)
 							{
+								m_History.Clear();
 								m_Scene->GetRegistry().clear();
 								m_Scene->LoadFromFile(filePath);
 								currScenePath = filePath; // update curr file path
@@ -654,6 +697,151 @@ namespace Engine
 		ImGui::NewFrame();
 	}
 
+	void Editor::displayConsolePanel()
+	{
+		if (!consoleWindow)
+			return;
+
+		ImGui::SetNextWindowSize(ImVec2(640, 360), ImGuiCond_FirstUseEver);
+		if (!ImGui::Begin("Console", &consoleWindow))
+		{
+			ImGui::End();
+			return;
+		}
+
+		CVarRegistry& cvars = CVarRegistry::Get();
+
+		// ========================= Command input =============================
+		ImGui::SetNextItemWidth(-120.0f);
+		bool submit = ImGui::InputTextWithHint("##command", "name value", consoleCommand, sizeof(consoleCommand),
+			ImGuiInputTextFlags_EnterReturnsTrue);
+		ImGui::SameLine();
+		submit |= ImGui::Button("Set");
+		ImGui::SameLine();
+		if (ImGui::Button("Save"))
+			cvars.SaveFile(cvars.GetConfigPath());
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip("Write file and editor values to %s", cvars.GetConfigPath().c_str());
+
+		if (submit && consoleCommand[0] != '\0')
+		{
+			// Accept "name value" and "name = value"
+			std::string command = consoleCommand;
+			size_t split = command.find_first_of(" =");
+			if (split == std::string::npos)
+			{
+				if (CVarBase* cvar = cvars.Find(command))
+					LOG_INFO(cvar->GetName(), " = ", cvar->ToString(), " (", CVarSourceName(cvar->GetSource()), ") - ", cvar->GetDescription());
+				else
+					LOG_WARNING("Unknown CVar '", command, "'");
+			}
+			else
+			{
+				size_t valueStart = command.find_first_not_of(" =", split);
+				cvars.Set(command.substr(0, split), valueStart == std::string::npos ? "" : command.substr(valueStart), CVarSource::Editor);
+			}
+			consoleCommand[0] = '\0';
+			ImGui::SetKeyboardFocusHere(-1);
+		}
+
+		ImGui::SetNextItemWidth(-1.0f);
+		ImGui::InputTextWithHint("##filter", "Filter", consoleFilter, sizeof(consoleFilter));
+		ImGui::Separator();
+
+		// ========================= CVar table =============================
+		const ImGuiTableFlags tableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV |
+			ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable;
+		if (ImGui::BeginTable("##cvars", 4, tableFlags))
+		{
+			ImGui::TableSetupScrollFreeze(0, 1);
+			ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch, 0.35f);
+			ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthStretch, 0.35f);
+			ImGui::TableSetupColumn("Source", ImGuiTableColumnFlags_WidthStretch, 0.2f);
+			ImGui::TableSetupColumn("", ImGuiTableColumnFlags_WidthFixed, 50.0f);
+			ImGui::TableHeadersRow();
+
+			for (CVarBase* cvar : cvars.GetAll())
+			{
+				if (consoleFilter[0] != '\0' && cvar->GetName().find(consoleFilter) == std::string::npos)
+					continue;
+
+				ImGui::PushID(cvar->GetName().c_str());
+				ImGui::TableNextRow();
+
+				const bool restart = (cvar->GetFlags() & CVAR_RESTART) != 0;
+				const bool readOnly = (cvar->GetFlags() & CVAR_READ_ONLY) != 0;
+
+				ImGui::TableSetColumnIndex(0);
+				ImGui::TextUnformatted(cvar->GetName().c_str());
+				if (ImGui::IsItemHovered())
+					ImGui::SetTooltip("%s%s", cvar->GetDescription().c_str(), restart ? "\n(applies after restart)" : "");
+
+				ImGui::TableSetColumnIndex(1);
+				ImGui::SetNextItemWidth(-1.0f);
+				ImGui::BeginDisabled(readOnly);
+				switch (cvar->GetType())
+				{
+				case CVarType::Bool:
+				{
+					auto* typed = static_cast<CVar<bool>*>(cvar);
+					bool value = typed->Get();
+					if (ImGui::Checkbox("##value", &value))
+						typed->Set(value, CVarSource::Editor);
+					break;
+				}
+				case CVarType::Int:
+				{
+					auto* typed = static_cast<CVar<int>*>(cvar);
+					int value = typed->Get();
+					if (ImGui::InputInt("##value", &value, 1, 100, ImGuiInputTextFlags_EnterReturnsTrue))
+						typed->Set(value, CVarSource::Editor);
+					break;
+				}
+				case CVarType::Float:
+				{
+					auto* typed = static_cast<CVar<float>*>(cvar);
+					float value = typed->Get();
+					if (ImGui::InputFloat("##value", &value, 0.0f, 0.0f, "%.4g", ImGuiInputTextFlags_EnterReturnsTrue))
+						typed->Set(value, CVarSource::Editor);
+					break;
+				}
+				case CVarType::String:
+				{
+					auto* typed = static_cast<CVar<std::string>*>(cvar);
+					char buffer[256];
+					std::snprintf(buffer, sizeof(buffer), "%s", typed->Get().c_str());
+					if (ImGui::InputText("##value", buffer, sizeof(buffer), ImGuiInputTextFlags_EnterReturnsTrue))
+						typed->Set(buffer, CVarSource::Editor);
+					break;
+				}
+				}
+				ImGui::EndDisabled();
+
+				ImGui::TableSetColumnIndex(2);
+				const CVarSource source = cvar->GetSource();
+				ImGui::TextUnformatted(CVarSourceName(source));
+				if (restart)
+				{
+					ImGui::SameLine();
+					ImGui::TextDisabled("(restart)");
+				}
+
+				// Reset drops the editor layer, falling back to command line/file/default
+				ImGui::TableSetColumnIndex(3);
+				ImGui::BeginDisabled(source != CVarSource::Editor);
+				if (ImGui::SmallButton("Reset"))
+					cvar->ClearSource(CVarSource::Editor);
+				ImGui::EndDisabled();
+
+				ImGui::PopID();
+			}
+
+			ImGui::EndTable();
+		}
+
+		ImGui::End();
+	}
+
 	void Editor::renderViewport()
 	{
 		// TODO: Get Texture from Graphics
@@ -732,6 +920,7 @@ namespace Engine
 					//LOG_DEBUG("This is in", fullPath);
 					// clear current scene
 					auto& registry = m_Scene->GetRegistry();
+					m_History.Clear();
 					registry.clear();
 
 					// load the selected scene file
@@ -30,6 +30,9 @@
 #include "../Utility/Timestep.h"
 #include "../Utility/Logger.h"
 #include "../Utility/AssetPath.h"
+#include "HierarchyModel.h"
+#include "ReflectionInspector.h"
+#include "EditorHistory.h"
 
 namespace Engine
 {
@@ -47,11 +50,19 @@ namespace Engine
 		Entity m_SelectedEntity{};
 		GLuint m_FBOTextureHandle;
 
+		// Cached hierarchy rows and inspector layout (rebuilt on change only)
+		HierarchyModel m_Hierarchy;
+		ReflectionInspector m_Inspector;
+
+		// Undo/redo log of editor operations
+		EditorHistory m_History;
+
 		// ImGui Window functionality
 		bool inspectorWindow = true;
 		bool hierachyWindow = true;
 		bool assetsWindow = true;
 		bool performanceProfileWindow = true;
+		bool consoleWindow = false;
 
 		// ImGui Top Menu Panel
 		bool openScenePanel = false; // for top menu open file 
@@ -64,6 +75,8 @@ namespace Engine
 		std::string currScenePath{}; // to store current scene path 
 		char saveAsDefaultSceneName[128] = {}; // default new scene path (in SaveAsScenePanel)
 		int selectedResourcesIndex = -1; // for the selected index in the assets browser
+		char consoleFilter[64] = {}; // CVar console name filter
+		char consoleCommand[256] = {}; // CVar console "name value" input
 
 
 		// Helper struct to get resources folder/files 
@@ -77,10 +90,10 @@ namespace Engine
 
 	public:
 		// Default contructor 
-		Editor(GLFWwindow* window) : m_Window(window), io(nullptr), m_Scene(nullptr) {};
+		Editor(GLFWwindow* window) : m_Window(window), io(nullptr), m_Scene(nullptr) { m_Inspector.SetHistory(&m_History); };
 
-		// Deconstuctor
-		~Editor() = default;
+		// Deconstuctor (stops listening to the scene registry)
+		~Editor() { m_Hierarchy.Attach(nullptr); }
 
 		// Delected copy constructor
 		Editor(const Editor&) = delete;
@@ -102,6 +115,10 @@ namespace Engine
 		// display top menu 
 		void displayTopMenu();
 
+		// undo/redo the last editor operation
+		void undo();
+		void redo();
+
 		// display properties list
 		void displayPropertiesPanel();
 
@@ -114,6 +131,9 @@ namespace Engine
 		// display performance profile
 		void displayPerformanceProfilePanel(Timestep ts);
 
+		// display CVar console (view and tune configuration variables)
+		void displayConsolePanel();
+
 		// Render Viewport
 		void renderViewport();
 
@@ -0,0 +1,467 @@
+/**
+* @file EditorHistory.cpp
+* @brief Implementation of the undo/redo transaction log for editor operations.
+* @author
+* @date 2025
+* Copyright (C) 2025 DigiPen Institute of Technology.
+* Reproduction or disclosure of this file or its contents without the
+* prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+
+// Include Header Files
+#include "EditorHistory.h"
+#include "../Component/TransformComponent.h"
+#include "../Serialization/ReflectionRegistry.h"
+#include "../Utility/Logger.h"
+
+// Include Standard Headers
+#include <algorithm>
+
+namespace Engine
+{
+	namespace
+	{
+		const uint32_t PREFAB_COMPONENT_HASH = HashReflectionName("PrefabComponent");
+		const std::string EMPTY_NAME{};
+	}
+
+	EditorHistory::EditorHistory(size_t capacity)
+		: m_Capacity(std::max<size_t>(capacity, 1))
+	{
+	}
+
+	void EditorHistory::SetScene(Scene* scene)
+	{
+		m_Scene = scene;
+		Clear();
+	}
+
+	void EditorHistory::SetCapacity(size_t capacity)
+	{
+		m_Capacity = std::max<size_t>(capacity, 1);
+		while (m_Undo.size() > m_Capacity)
+			m_Undo.pop_front();
+	}
+
+	void EditorHistory::RecordPropertyChange(Entity entity, const ComponentMetadata& meta, const PropertyBase& property,
+		const std::vector<uint8_t>& before)
+	{
+		if (!m_Scene || !entity)
+			return;
+
+		void* component = meta.Get(m_Scene->GetRegistry(), entity);
+		if (!component)
+			return;
+
+		PropertyDelta delta;
+		delta.Handle = entity;
+		delta.ComponentHash = meta.GetNameHash();
+		delta.PropertyHash = property.GetNameHash();
+		delta.Before = before;
+		property.WriteBinary(component, delta.After);
+
+		// Merge into the running drag on the same property, keeping its original Before
+		Transaction* target = m_OpenTransaction ? &*m_OpenTransaction : (m_Undo.empty() ? nullptr : &m_Undo.back());
+		if (m_Coalescing && target && !target->Operations.empty())
+		{
+			if (auto* last = std::get_if<PropertyDelta>(&target->Operations.back());
+				last && last->Handle == delta.Handle && last->ComponentHash == delta.ComponentHash &&
+				last->PropertyHash == delta.PropertyHash)
+			{
+				last->After = std::move(delta.After);
+				m_Redo.clear();
+				return;
+			}
+		}
+
+		if (delta.Before == delta.After)
+			return;
+
+		Push(std::move(delta), "Edit " + meta.GetName() + "." + property.GetName());
+		m_Coalescing = true;
+	}
+
+	void EditorHistory::RecordCreateEntity(Entity entity)
+	{
+		if (!m_Scene || !entity)
+			return;
+
+		EntityLifetime lifetime = CaptureEntity(entity);
+		lifetime.Created = true;
+		Push(std::move(lifetime), "Create Entity");
+	}
+
+	void EditorHistory::DestroyEntity(Entity entity)
+	{
+		if (!m_Scene || !entity)
+			return;
+
+		EntityLifetime lifetime = CaptureEntity(entity);
+		lifetime.Created = false;
+		Push(std::move(lifetime), "Delete Entity");
+
+		DestroyTree(entity);
+	}
+
+	void EditorHistory::RecordAddComponent(Entity entity, const ComponentMetadata& meta)
+	{
+		if (!m_Scene || !entity)
+			return;
+
+		ComponentLifetime lifetime;
+		lifetime.Added = true;
+		lifetime.Handle = entity;
+		lifetime.Component = CaptureComponent(entity, meta);
+		Push(std::move(lifetime), "Add " + meta.GetName());
+	}
+
+	void EditorHistory::RemoveComponent(Entity entity, const ComponentMetadata& meta)
+	{
+		if (!m_Scene || !entity)
+			return;
+
+		ComponentLifetime lifetime;
+		lifetime.Added = false;
+		lifetime.Handle = entity;
+		lifetime.Component = CaptureComponent(entity, meta);
+		Push(std::move(lifetime), "Remove " + meta.GetName());
+
+		meta.Remove(m_Scene->GetRegistry(), entity);
+	}
+
+	void EditorHistory::BeginTransaction(const std::string& name)
+	{
+		if (m_TransactionDepth++ == 0)
+		{
+			m_OpenTransaction = Transaction{ name, {} };
+			m_Coalescing = false;
+		}
+	}
+
+	void EditorHistory::EndTransaction()
+	{
+		if (m_TransactionDepth == 0)
+		{
+			LOG_WARNING("EditorHistory: EndTransaction without BeginTransaction");
+			return;
+		}
+
+		if (--m_TransactionDepth > 0)
+			return;
+
+		Transaction transaction = std::move(*m_OpenTransaction);
+		m_OpenTransaction.reset();
+
+		if (transaction.Operations.empty())
+			return;
+
+		m_Undo.push_back(std::move(transaction));
+		while (m_Undo.size() > m_Capacity)
+			m_Undo.pop_front();
+	}
+
+	bool EditorHistory::Undo()
+	{
+		if (!m_Scene || m_Undo.empty() || m_OpenTransaction)
+			return false;
+
+		m_Coalescing = false;
+
+		Transaction transaction = std::move(m_Undo.back());
+		m_Undo.pop_back();
+
+		for (auto it = transaction.Operations.rbegin(); it != transaction.Operations.rend(); ++it)
+			Apply(*it, true);
+
+		LOG_DEBUG("EditorHistory: Undo '", transaction.Name, "'");
+		m_Redo.push_back(std::move(transaction));
+		return true;
+	}
+
+	bool EditorHistory::Redo()
+	{
+		if (!m_Scene || m_Redo.empty() || m_OpenTransaction)
+			return false;
+
+		m_Coalescing = false;
+
+		Transaction transaction = std::move(m_Redo.back());
+		m_Redo.pop_back();
+
+		for (const auto& operation : transaction.Operations)
+			Apply(operation, false);
+
+		LOG_DEBUG("EditorHistory: Redo '", transaction.Name, "'");
+		m_Undo.push_back(std::move(transaction));
+		while (m_Undo.size() > m_Capacity)
+			m_Undo.pop_front();
+		return true;
+	}
+
+	const std::string& EditorHistory::GetUndoName() const
+	{
+		return m_Undo.empty() ? EMPTY_NAME : m_Undo.back().Name;
+	}
+
+	const std::string& EditorHistory::GetRedoName() const
+	{
+		return m_Redo.empty() ? EMPTY_NAME : m_Redo.back().Name;
+	}
+
+	void EditorHistory::Clear()
+	{
+		m_Undo.clear();
+		m_Redo.clear();
+		m_OpenTransaction.reset();
+		m_TransactionDepth = 0;
+		m_Coalescing = false;
+	}
+
+	void EditorHistory::Push(Operation operation, const std::string& name)
+	{
+		m_Redo.clear();
+
+		if (m_OpenTransaction)
+		{
+			m_OpenTransaction->Operations.push_back(std::move(operation));
+			return;
+		}
+
+		m_Coalescing = false;
+		m_Undo.push_back(Transaction{ name, {} });
+		m_Undo.back().Operations.push_back(std::move(operation));
+		while (m_Undo.size() > m_Capacity)
+			m_Undo.pop_front();
+	}
+
+	void EditorHistory::Apply(const Operation& operation, bool undo)
+	{
+		auto& registry = m_Scene->GetRegistry();
+
+		if (const auto* delta = std::get_if<PropertyDelta>(&operation))
+		{
+			const ComponentMetadata* meta = ReflectionRegistry::Get().GetMetadataByHash(delta->ComponentHash);
+			const PropertyBase* property = meta ? meta->FindProperty(delta->PropertyHash) : nullptr;
+			void* component = (property && registry.valid(delta->Handle)) ? meta->Get(registry, delta->Handle) : nullptr;
+			if (!component)
+			{
+				LOG_WARNING("EditorHistory: Property target no longer exists, skipping");
+				return;
+			}
+
+			const auto& value = undo ? delta->Before : delta->After;
+			property->ReadBinary(component, value.data(), value.size());
+		}
+		else if (const auto* entity = std::get_if<EntityLifetime>(&operation))
+		{
+			const bool shouldExist = entity->Created != undo;
+			if (shouldExist)
+			{
+				RestoreEntity(*entity);
+			}
+			else if (!entity->Entities.empty() && registry.valid(entity->Entities.front().Handle))
+			{
+				DestroyTree(entity->Entities.front().Handle);
+			}
+		}
+		else if (const auto* component = std::get_if<ComponentLifetime>(&operation))
+		{
+			if (!registry.valid(component->Handle))
+				return;
+
+			const bool shouldExist = component->Added != undo;
+			if (shouldExist)
+			{
+				RestoreComponent(component->Handle, component->Component);
+			}
+			else if (const auto* meta = ReflectionRegistry::Get().GetMetadataByHash(component->Component.ComponentHash))
+			{
+				meta->Remove(registry, component->Handle);
+			}
+		}
+	}
+
+	EditorHistory::ComponentState EditorHistory::CaptureComponent(entt::entity entity, const ComponentMetadata& meta) const
+	{
+		ComponentState state;
+		state.ComponentHash = meta.GetNameHash();
+
+		void* component = meta.Get(m_Scene->GetRegistry(), entity);
+		if (!component)
+			return state;
+
+		state.Properties.reserve(meta.GetProperties().size());
+		for (const auto& property : meta.GetProperties())
+		{
+			PropertyValue value;
+			value.PropertyHash = property->GetNameHash();
+			property->WriteBinary(component, value.Value);
+			state.Properties.push_back(std::move(value));
+		}
+		return state;
+	}
+
+	void EditorHistory::RestoreComponent(entt::entity entity, const ComponentState& state) const
+	{
+		const ComponentMetadata* meta = ReflectionRegistry::Get().GetMetadataByHash(state.ComponentHash);
+		if (!meta)
+			return;
+
+		void* component = meta->Emplace(m_Scene->GetRegistry(), entity);
+		if (!component)
+			return;
+
+		for (const auto& value : state.Properties)
+		{
+			if (const PropertyBase* property = meta->FindProperty(value.PropertyHash))
+				property->ReadBinary(component, value.Value.data(), value.Value.size());
+		}
+	}
+
+	EditorHistory::EntityState EditorHistory::CaptureEntityState(entt::entity entity) const
+	{
+		auto& registry = m_Scene->GetRegistry();
+
+		EntityState state;
+		state.Handle = entity;
+
+		for (const auto& [typeIndex, meta] : ReflectionRegistry::Get().GetAllMetadata())
+		{
+			if (meta->GetNameHash() == PREFAB_COMPONENT_HASH || !meta->Get(registry, entity))
+				continue;
+			state.Components.push_back(CaptureComponent(entity, *meta));
+		}
+
+		// Stable order so replay does not depend on registry hash-map iteration
+		std::sort(state.Components.begin(), state.Components.end(),
+			[](const ComponentState& a, const ComponentState& b) { return a.ComponentHash < b.ComponentHash; });
+
+		if (const auto* prefab = registry.try_get<PrefabComponent>(entity))
+			state.Prefab = *prefab;
+
+		if (const auto* transform = registry.try_get<TransformComponent>(entity))
+		{
+			state.Parent = transform->Parent;
+			for (entt::entity child : transform->Children)
+			{
+				if (registry.valid(child))
+					state.Children.push_back(child);
+			}
+		}
+
+		return state;
+	}
+
+	EditorHistory::EntityLifetime EditorHistory::CaptureEntity(entt::entity entity) const
+	{
+		auto& registry = m_Scene->GetRegistry();
+
+		EntityLifetime snapshot;
+		snapshot.Entities.push_back(CaptureEntityState(entity));
+
+		// Breadth first, so every parent is restored before its children
+		for (size_t i = 0; i < snapshot.Entities.size(); ++i)
+		{
+			const std::vector<entt::entity> children = snapshot.Entities[i].Children;
+			for (entt::entity child : children)
+				snapshot.Entities.push_back(CaptureEntityState(child));
+		}
+
+		const entt::entity parent = snapshot.Entities.front().Parent;
+		if (const auto* parentTransform = registry.valid(parent) ? registry.try_get<TransformComponent>(parent) : nullptr)
+		{
+			const auto& siblings = parentTransform->Children;
+			snapshot.SiblingIndex = static_cast<size_t>(std::find(siblings.begin(), siblings.end(), entity) - siblings.begin());
+		}
+
+		return snapshot;
+	}
+
+	void EditorHistory::RestoreEntity(const EntityLifetime& snapshot) const
+	{
+		auto& registry = m_Scene->GetRegistry();
+		if (snapshot.Entities.empty())
+			return;
+
+		for (const EntityState& state : snapshot.Entities)
+		{
+			if (registry.valid(state.Handle))
+			{
+				LOG_WARNING("EditorHistory: Entity ", static_cast<uint32_t>(state.Handle), " already exists, skipping restore");
+				return;
+			}
+		}
+
+		for (const EntityState& state : snapshot.Entities)
+		{
+			// Same identifier, so later deltas and the links below keep working
+			entt::entity handle = registry.create(state.Handle);
+			if (handle != state.Handle)
+			{
+				LOG_WARNING("EditorHistory: Could not reuse entity id ", static_cast<uint32_t>(state.Handle),
+					", restored as ", static_cast<uint32_t>(handle));
+			}
+
+			for (const auto& component : state.Components)
+				RestoreComponent(handle, component);
+
+			if (state.Prefab)
+				registry.emplace<PrefabComponent>(handle, *state.Prefab);
+
+			if (auto* transform = registry.try_get<TransformComponent>(handle))
+			{
+				transform->Parent = state.Parent;
+				transform->Children = state.Children;
+			}
+		}
+
+		// Hook the subtree back under its parent, where it was among its siblings
+		const EntityState& root = snapshot.Entities.front();
+		auto* rootTransform = registry.try_get<TransformComponent>(root.Handle);
+		if (!rootTransform || root.Parent == entt::null)
+			return;
+
+		auto* parentTransform = registry.valid(root.Parent) ? registry.try_get<TransformComponent>(root.Parent) : nullptr;
+		if (!parentTransform)
+		{
+			LOG_WARNING("EditorHistory: Parent of entity ", static_cast<uint32_t>(root.Handle), " no longer exists, restored as a root");
+			rootTransform->Parent = entt::null;
+			return;
+		}
+
+		auto& siblings = parentTransform->Children;
+		if (std::find(siblings.begin(), siblings.end(), root.Handle) == siblings.end())
+			siblings.insert(siblings.begin() + static_cast<std::ptrdiff_t>(std::min(snapshot.SiblingIndex, siblings.size())), root.Handle);
+	}
+
+	void EditorHistory::DestroyTree(entt::entity entity) const
+	{
+		auto& registry = m_Scene->GetRegistry();
+
+		if (const auto* transform = registry.try_get<TransformComponent>(entity))
+		{
+			if (auto* parentTransform = registry.valid(transform->Parent) ? registry.try_get<TransformComponent>(transform->Parent) : nullptr)
+			{
+				auto& siblings = parentTransform->Children;
+				siblings.erase(std::remove(siblings.begin(), siblings.end(), entity), siblings.end());
+			}
+		}
+
+		// Children first, so no live entity is left pointing at a destroyed parent
+		std::vector<entt::entity> tree{ entity };
+		for (size_t i = 0; i < tree.size(); ++i)
+		{
+			if (const auto* transform = registry.try_get<TransformComponent>(tree[i]))
+			{
+				for (entt::entity child : transform->Children)
+				{
+					if (registry.valid(child))
+						tree.push_back(child);
+				}
+			}
+		}
+		for (auto it = tree.rbegin(); it != tree.rend(); ++it)
+			m_Scene->DestroyEntity(Entity(*it, &registry));
+	}
+
+} // end of Engine
@@ -0,0 +1,185 @@
+#pragma once
+/**
+ * @file EditorHistory.h
+ * @brief Declaration of the undo/redo transaction log for editor operations.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#ifndef SK_EDITOR_HISTORY_H
+#define SK_EDITOR_HISTORY_H
+
+// Include Standard Headers
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+// Include other necessary headers
+#include "../ECS/Scene.h"
+#include "../Component/PrefabComponent.h"
+#include "../Serialization/Property.h"
+
+namespace Engine
+{
+	/**
+	* @class EditorHistory
+	* @brief Bounded undo/redo log of reversible editor operations on a Scene.
+	* @details Operations are stored as compact deltas keyed by reflection name hashes:
+	*          property changes keep the before/after value bytes, entity and component
+	*          creation/destruction keep a snapshot of every reflected property.
+	*          Destroying an entity destroys its children with it; both snapshots keep
+	*          the (unreflected) parent links so undo puts the subtree back in place.
+	*          Consecutive changes to the same property (a drag) are coalesced into one
+	*          transaction until CloseCoalescing() is called. Has no ImGui dependency, so
+	*          it can be driven headlessly against any Scene.
+	*/
+	class EditorHistory
+	{
+	public:
+		explicit EditorHistory(size_t capacity = 256);
+		~EditorHistory() = default;
+
+		EditorHistory(const EditorHistory&) = delete;
+		EditorHistory& operator=(const EditorHistory&) = delete;
+
+		// Target scene (clears the history)
+		void SetScene(Scene* scene);
+
+		// Maximum number of undoable transactions, oldest are dropped first
+		void SetCapacity(size_t capacity);
+		size_t GetCapacity() const { return m_Capacity; }
+
+		// ===== RECORDING =====
+
+		/**
+		* @brief Record a property change that was already applied to the component
+		* @param entity Edited entity
+		* @param meta Component metadata
+		* @param property Edited property
+		* @param before Value bytes before the change (PropertyBase::WriteBinary)
+		*/
+		void RecordPropertyChange(Entity entity, const ComponentMetadata& meta, const PropertyBase& property,
+			const std::vector<uint8_t>& before);
+
+		// Stop merging property changes into the last transaction (end of a drag)
+		void CloseCoalescing() { m_Coalescing = false; }
+
+		// Record an entity that was just created
+		void RecordCreateEntity(Entity entity);
+
+		// Snapshot, record and destroy an entity and its children
+		void DestroyEntity(Entity entity);
+
+		// Record a component that was just added
+		void RecordAddComponent(Entity entity, const ComponentMetadata& meta);
+
+		// Snapshot, record and remove a component
+		void RemoveComponent(Entity entity, const ComponentMetadata& meta);
+
+		/**
+		* @brief Group every operation recorded until EndTransaction into one undo step
+		*/
+		void BeginTransaction(const std::string& name);
+		void EndTransaction();
+
+		// ===== REPLAY =====
+
+		bool Undo();
+		bool Redo();
+
+		bool CanUndo() const { return !m_Undo.empty(); }
+		bool CanRedo() const { return !m_Redo.empty(); }
+
+		// Name of the step Undo()/Redo() would revert/replay (empty if none)
+		const std::string& GetUndoName() const;
+		const std::string& GetRedoName() const;
+
+		// Drop every transaction (scene load, new scene)
+		void Clear();
+
+		size_t GetUndoCount() const { return m_Undo.size(); }
+		size_t GetRedoCount() const { return m_Redo.size(); }
+
+	private:
+		struct PropertyValue
+		{
+			uint32_t PropertyHash = 0;
+			std::vector<uint8_t> Value;
+		};
+
+		struct ComponentState
+		{
+			uint32_t ComponentHash = 0;
+			std::vector<PropertyValue> Properties;
+		};
+
+		struct PropertyDelta
+		{
+			entt::entity Handle = entt::null;
+			uint32_t ComponentHash = 0;
+			uint32_t PropertyHash = 0;
+			std::vector<uint8_t> Before;
+			std::vector<uint8_t> After;
+		};
+
+		struct EntityState
+		{
+			entt::entity Handle = entt::null;
+			std::vector<ComponentState> Components;
+			std::optional<PrefabComponent> Prefab;  ///< Link and overrides are not reflected
+			entt::entity Parent = entt::null;       ///< TransformComponent links are not reflected either
+			std::vector<entt::entity> Children;
+		};
+
+		struct EntityLifetime
+		{
+			bool Created = false;       ///< True: created by the operation, false: destroyed
+			std::vector<EntityState> Entities;  ///< The entity, then its descendants, parents first
+			size_t SiblingIndex = 0;    ///< Position of the entity in its parent's Children
+		};
+
+		struct ComponentLifetime
+		{
+			bool Added = false;    ///< True: added by the operation, false: removed
+			entt::entity Handle = entt::null;
+			ComponentState Component;
+		};
+
+		using Operation = std::variant<PropertyDelta, EntityLifetime, ComponentLifetime>;
+
+		struct Transaction
+		{
+			std::string Name;
+			std::vector<Operation> Operations;
+		};
+
+		void Push(Operation operation, const std::string& name);
+		void Apply(const Operation& operation, bool undo);
+
+		ComponentState CaptureComponent(entt::entity entity, const ComponentMetadata& meta) const;
+		void RestoreComponent(entt::entity entity, const ComponentState& state) const;
+		EntityState CaptureEntityState(entt::entity entity) const;
+		EntityLifetime CaptureEntity(entt::entity entity) const;
+		void RestoreEntity(const EntityLifetime& snapshot) const;
+		void DestroyTree(entt::entity entity) const;
+
+		Scene* m_Scene = nullptr;
+		size_t m_Capacity;
+		std::deque<Transaction> m_Undo;
+		std::vector<Transaction> m_Redo;
+
+		std::optional<Transaction> m_OpenTransaction;
+		uint32_t m_TransactionDepth = 0;
+		bool m_Coalescing = false;
+	};
+
+} // end of Engine
+
+#endif // SK_EDITOR_HISTORY_H
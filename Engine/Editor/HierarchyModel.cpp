@@ -0,0 +1,206 @@
+/**
+* @file HierarchyModel.cpp
+* @brief Implementation of the cached scene hierarchy used by the editor hierarchy panel.
+* @author
+* @date 2025
+* Copyright (C) 2025 DigiPen Institute of Technology.
+* Reproduction or disclosure of this file or its contents without the
+* prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+
+// Include Header Files
+#include "HierarchyModel.h"
+#include "../Component/TagComponent.h"
+#include "../Component/TransformComponent.h"
+#include "../Component/PooledComponent.h"
+
+// Include Standard Headers
+#include <algorithm>
+#include <utility>
+
+namespace Engine
+{
+	void HierarchyModel::Attach(entt::registry* registry)
+	{
+		if (m_Registry == registry)
+			return;
+
+		if (m_Registry)
+		{
+			m_Registry->on_construct<TagComponent>().disconnect<&HierarchyModel::OnChanged>(*this);
+			m_Registry->on_destroy<TagComponent>().disconnect<&HierarchyModel::OnDestroyed>(*this);
+			m_Registry->on_construct<TransformComponent>().disconnect<&HierarchyModel::OnChanged>(*this);
+			m_Registry->on_update<TransformComponent>().disconnect<&HierarchyModel::OnChanged>(*this);
+			m_Registry->on_destroy<TransformComponent>().disconnect<&HierarchyModel::OnChanged>(*this);
+			m_Registry->on_construct<InactiveComponent>().disconnect<&HierarchyModel::OnToggled>(*this);
+			m_Registry->on_destroy<InactiveComponent>().disconnect<&HierarchyModel::OnToggled>(*this);
+		}
+
+		m_Registry = registry;
+		m_Expanded.clear();
+		m_Toggled.clear();
+		m_Rows.clear();
+		m_EntityCount = 0;
+		m_Dirty = true;
+
+		if (m_Registry)
+		{
+			m_Registry->on_construct<TagComponent>().connect<&HierarchyModel::OnChanged>(*this);
+			m_Registry->on_destroy<TagComponent>().connect<&HierarchyModel::OnDestroyed>(*this);
+			m_Registry->on_construct<TransformComponent>().connect<&HierarchyModel::OnChanged>(*this);
+			m_Registry->on_update<TransformComponent>().connect<&HierarchyModel::OnChanged>(*this);
+			m_Registry->on_destroy<TransformComponent>().connect<&HierarchyModel::OnChanged>(*this);
+			m_Registry->on_construct<InactiveComponent>().connect<&HierarchyModel::OnToggled>(*this);
+			m_Registry->on_destroy<InactiveComponent>().connect<&HierarchyModel::OnToggled>(*this);
+		}
+	}
+
+	void HierarchyModel::SetExpanded(entt::entity entity, bool expanded)
+	{
+		if (expanded)
+			m_Expanded.insert(entity);
+		else
+			m_Expanded.erase(entity);
+
+		m_Dirty = true;
+	}
+
+	const std::vector<HierarchyModel::Row>& HierarchyModel::GetRows()
+	{
+		if (!m_Dirty && !m_Toggled.empty() && !PatchToggled())
+			m_Dirty = true;
+
+		if (m_Dirty)
+		{
+			Rebuild();
+			m_Dirty = false;
+		}
+		return m_Rows;
+	}
+
+	void HierarchyModel::OnDestroyed(entt::registry&, entt::entity entity)
+	{
+		// Entity ids are recycled, do not let a new entity inherit the expand state
+		m_Expanded.erase(entity);
+		m_Dirty = true;
+	}
+
+	bool HierarchyModel::PatchToggled()
+	{
+		auto& registry = *m_Registry;
+		for (entt::entity entity : m_Toggled)
+		{
+			if (!registry.valid(entity))
+				return false;
+			if (!registry.all_of<TagComponent>(entity))
+				continue;
+
+			// Only a childless root keeps the rest of the tree as it is
+			const auto* transform = registry.try_get<TransformComponent>(entity);
+			if (transform)
+			{
+				if (!transform->Children.empty())
+					return false;
+				if (registry.valid(transform->Parent) && registry.all_of<TagComponent>(transform->Parent)
+					&& !registry.all_of<InactiveComponent>(transform->Parent))
+					return false;
+			}
+
+			// Roots are listed in creation order, find the entity's row or where it goes
+			size_t index = m_Rows.size();
+			bool found = false;
+			for (size_t i = 0; i < m_Rows.size(); ++i)
+			{
+				if (m_Rows[i].Depth != 0)
+					continue;
+				if (m_Rows[i].Handle == entity)
+				{
+					index = i;
+					found = true;
+					break;
+				}
+				if (entt::to_integral(m_Rows[i].Handle) > entt::to_integral(entity))
+				{
+					index = i;
+					break;
+				}
+			}
+
+			const bool listed = !registry.all_of<InactiveComponent>(entity);
+			if (listed && !found)
+			{
+				m_Rows.insert(m_Rows.begin() + index, Row{ entity, 0u, false, false });
+				m_EntityCount++;
+			}
+			else if (!listed && found)
+			{
+				m_Rows.erase(m_Rows.begin() + index);
+				m_EntityCount--;
+			}
+		}
+
+		m_Toggled.clear();
+		return true;
+	}
+
+	void HierarchyModel::Rebuild()
+	{
+		m_Toggled.clear();
+		m_Rows.clear();
+		m_EntityCount = 0;
+
+		if (!m_Registry)
+			return;
+
+		auto& registry = *m_Registry;
+		auto isListed = [&registry](entt::entity entity)
+			{
+				return registry.valid(entity)
+					&& registry.all_of<TagComponent>(entity)
+					&& !registry.all_of<InactiveComponent>(entity);
+			};
+
+		// Roots: listed entities without a (listed) parent, in creation order
+		std::vector<entt::entity> roots;
+		auto view = registry.view<TagComponent>(entt::exclude<InactiveComponent>);
+		roots.reserve(view.size_hint());
+		for (auto entity : view)
+		{
+			m_EntityCount++;
+			const auto* transform = registry.try_get<TransformComponent>(entity);
+			if (!transform || !isListed(transform->Parent))
+				roots.push_back(entity);
+		}
+		std::sort(roots.begin(), roots.end(), [](entt::entity a, entt::entity b)
+			{
+				return entt::to_integral(a) < entt::to_integral(b);
+			});
+
+		// Iterative depth-first walk, collapsed subtrees are skipped entirely
+		std::vector<std::pair<entt::entity, uint32_t>> stack;
+		for (auto it = roots.rbegin(); it != roots.rend(); ++it)
+			stack.emplace_back(*it, 0u);
+
+		while (!stack.empty())
+		{
+			auto [entity, depth] = stack.back();
+			stack.pop_back();
+
+			const auto* transform = registry.try_get<TransformComponent>(entity);
+			const bool hasChildren = transform && std::any_of(transform->Children.begin(), transform->Children.end(), isListed);
+			const bool expanded = hasChildren && m_Expanded.count(entity) > 0;
+
+			m_Rows.push_back(Row{ entity, depth, hasChildren, expanded });
+
+			if (expanded)
+			{
+				for (auto child = transform->Children.rbegin(); child != transform->Children.rend(); ++child)
+				{
+					if (isListed(*child))
+						stack.emplace_back(*child, depth + 1);
+				}
+			}
+		}
+	}
+
+} // end of Engine
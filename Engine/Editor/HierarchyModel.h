@@ -0,0 +1,88 @@
+#pragma once
+/**
+ * @file HierarchyModel.h
+ * @brief Declaration of the cached scene hierarchy used by the editor hierarchy panel.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#ifndef SK_HIERARCHY_MODEL_H
+#define SK_HIERARCHY_MODEL_H
+
+// Include Standard Headers
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+// Include other necessary headers
+#include <entt/entt.hpp>
+
+namespace Engine
+{
+	/**
+	* @class HierarchyModel
+	* @brief Flattened, cached view of the entity tree built from TransformComponent parent links.
+	* @details The row list is only rebuilt after a registry change notification (entity created,
+	*          destroyed, re-parented) or an expand/collapse, so drawing costs nothing per frame beyond
+	*          the rows that are actually visible. Pooled instances being parked or re-spawned only
+	*          patch their own row, since a busy pool toggles them every frame.
+	*/
+	class HierarchyModel
+	{
+	public:
+		/**
+		* @brief One visible line of the hierarchy
+		*/
+		struct Row
+		{
+			entt::entity Handle = entt::null;
+			uint32_t Depth = 0;
+			bool HasChildren = false;
+			bool Expanded = false;
+		};
+
+		HierarchyModel() = default;
+		~HierarchyModel() = default;
+
+		HierarchyModel(const HierarchyModel&) = delete;
+		HierarchyModel& operator=(const HierarchyModel&) = delete;
+
+		// Listen to a registry (nullptr detaches from the current one)
+		void Attach(entt::registry* registry);
+
+		// Force a rebuild on next access (e.g. after re-parenting)
+		void MarkDirty() { m_Dirty = true; }
+
+		// Expand or collapse the children of an entity
+		void SetExpanded(entt::entity entity, bool expanded);
+
+		// Visible rows, depth-first, rebuilt lazily
+		const std::vector<Row>& GetRows();
+
+		// Number of entities listed (including collapsed ones)
+		size_t GetEntityCount() const { return m_EntityCount; }
+
+	private:
+		void OnChanged(entt::registry&, entt::entity) { m_Dirty = true; }
+		void OnDestroyed(entt::registry& registry, entt::entity entity);
+		void OnToggled(entt::registry&, entt::entity entity) { m_Toggled.push_back(entity); }
+
+		void Rebuild();
+
+		// Add or remove the rows of parked/re-spawned entities, false if that needs a rebuild
+		bool PatchToggled();
+
+		entt::registry* m_Registry = nullptr;
+		std::vector<Row> m_Rows;
+		std::unordered_set<entt::entity> m_Expanded;
+		std::vector<entt::entity> m_Toggled;
+		size_t m_EntityCount = 0;
+		bool m_Dirty = true;
+	};
+
+} // end of Engine
+
+#endif // SK_HIERARCHY_MODEL_H
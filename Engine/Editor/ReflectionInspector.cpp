@@ -0,0 +1,317 @@
+/**
+* @file ReflectionInspector.cpp
+* @brief Implementation of the reflection-driven component inspector used by the properties panel.
+* @author
+* @date 2025
+* Copyright (C) 2025 DigiPen Institute of Technology.
+* Reproduction or disclosure of this file or its contents without the
+* prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+
+// Include Header Files
+#include "ReflectionInspector.h"
+#include "../Component/PrefabComponent.h"
+#include "../Serialization/ReflectionRegistry.h"
+
+// Include Standard Headers
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+
+// Include other necessary headers
+#include "imgui.h"
+#include <glm/gtc/quaternion.hpp>
+
+namespace Engine
+{
+	namespace
+	{
+		const uint32_t TAG_COMPONENT_HASH = HashReflectionName("TagComponent");
+		const uint32_t TRANSFORM_COMPONENT_HASH = HashReflectionName("TransformComponent");
+		const uint32_t PREFAB_COMPONENT_HASH = HashReflectionName("PrefabComponent");
+		const uint32_t SCALE_PROPERTY_HASH = HashReflectionName("Scale");
+
+		// A zero or negative scale collapses or mirrors the mesh and its collider
+		constexpr float MIN_TRANSFORM_SCALE = 0.001f;
+
+		// Tag and Transform first, everything else alphabetical
+		int SectionOrder(const ComponentMetadata* meta)
+		{
+			if (meta->GetNameHash() == TAG_COMPONENT_HASH) return 0;
+			if (meta->GetNameHash() == TRANSFORM_COMPONENT_HASH) return 1;
+			return 2;
+		}
+
+		bool SectionLess(const ComponentMetadata* a, const ComponentMetadata* b)
+		{
+			const int orderA = SectionOrder(a);
+			const int orderB = SectionOrder(b);
+			return orderA != orderB ? orderA < orderB : a->GetName() < b->GetName();
+		}
+
+		// "TransformComponent" -> "Transform"
+		std::string DisplayName(const std::string& componentName)
+		{
+			constexpr std::string_view suffix = "Component";
+			if (componentName.size() > suffix.size() &&
+				componentName.compare(componentName.size() - suffix.size(), suffix.size(), suffix) == 0)
+				return componentName.substr(0, componentName.size() - suffix.size());
+			return componentName;
+		}
+
+		template<typename T>
+		bool ReadScratch(const std::vector<uint8_t>& scratch, T& value)
+		{
+			if (scratch.size() != sizeof(T))
+				return false;
+			std::memcpy(&value, scratch.data(), sizeof(T));
+			return true;
+		}
+	}
+
+	void ReflectionInspector::Draw(Scene* scene, Entity entity)
+	{
+		if (!scene || !entity || !scene->GetRegistry().valid(entity))
+		{
+			m_Entity = entt::null;
+			ImGui::Text("No entity selected");
+			return;
+		}
+
+		auto& registry = scene->GetRegistry();
+		if (m_LayoutDirty || m_Entity != static_cast<entt::entity>(entity))
+			RebuildLayout(registry, entity);
+
+		const bool isPrefabInstance = registry.all_of<PrefabComponent>(entity);
+		bool recordOverrides = false;
+
+		for (const auto& section : m_Sections)
+		{
+			void* component = section.Meta->Get(registry, entity);
+			if (!component)
+			{
+				// Removed behind our back, pick it up next frame
+				m_LayoutDirty = true;
+				continue;
+			}
+
+			ImGui::PushID(section.Meta);
+			const bool open = ImGui::CollapsingHeader(section.Header.c_str(), ImGuiTreeNodeFlags_DefaultOpen);
+
+			bool removeComponent = false;
+			if (section.Meta->GetNameHash() != TAG_COMPONENT_HASH &&
+				section.Meta->GetNameHash() != TRANSFORM_COMPONENT_HASH &&
+				ImGui::BeginPopupContextItem())
+			{
+				if (ImGui::MenuItem("Remove Component"))
+					removeComponent = true;
+				ImGui::EndPopup();
+			}
+
+			if (open && !removeComponent)
+			{
+				if (section.Properties.empty())
+					ImGui::TextDisabled("No editable properties");
+
+				for (const PropertyBase* property : section.Properties)
+				{
+					ImGui::PushID(property);
+					if (DrawProperty(*property, component) && m_History)
+						m_History->RecordPropertyChange(entity, *section.Meta, *property, m_Scratch);
+
+					// Diff once per finished edit rather than every drag step
+					if (ImGui::IsItemDeactivatedAfterEdit())
+					{
+						if (m_History)
+							m_History->CloseCoalescing();
+						recordOverrides = isPrefabInstance;
+					}
+					ImGui::PopID();
+				}
+			}
+			ImGui::PopID();
+
+			if (removeComponent)
+			{
+				if (m_History)
+					m_History->RemoveComponent(entity, *section.Meta);
+				else
+					section.Meta->Remove(registry, entity);
+				m_LayoutDirty = true;
+				recordOverrides = isPrefabInstance;
+				break;
+			}
+		}
+
+		ImGui::Separator();
+		if (DrawAddComponent(registry, entity))
+			recordOverrides = isPrefabInstance;
+
+		if (recordOverrides)
+			scene->RecordPrefabOverrides(entity);
+	}
+
+	void ReflectionInspector::RebuildLayout(entt::registry& registry, entt::entity entity)
+	{
+		m_Entity = entity;
+		m_Sections.clear();
+		m_Addable.clear();
+		m_TransformScale = nullptr;
+
+		std::vector<const ComponentMetadata*> present;
+		for (const auto& [typeIndex, meta] : ReflectionRegistry::Get().GetAllMetadata())
+		{
+			if (meta->GetNameHash() == PREFAB_COMPONENT_HASH)
+				continue;
+
+			if (meta->Get(registry, entity))
+				present.push_back(meta.get());
+			else
+				m_Addable.push_back(meta.get());
+		}
+
+		std::sort(present.begin(), present.end(), SectionLess);
+		std::sort(m_Addable.begin(), m_Addable.end(), SectionLess);
+
+		m_Sections.reserve(present.size());
+		for (const ComponentMetadata* meta : present)
+		{
+			Section section;
+			section.Meta = meta;
+			section.Header = DisplayName(meta->GetName());
+			for (const auto& property : meta->GetProperties())
+			{
+				section.Properties.push_back(property.get());
+				if (meta->GetNameHash() == TRANSFORM_COMPONENT_HASH && property->GetNameHash() == SCALE_PROPERTY_HASH)
+					m_TransformScale = property.get();
+			}
+			m_Sections.push_back(std::move(section));
+		}
+
+		m_LayoutDirty = false;
+	}
+
+	bool ReflectionInspector::DrawProperty(const PropertyBase& property, void* component)
+	{
+		m_Scratch.clear();
+		property.WriteBinary(component, m_Scratch);
+
+		const char* label = property.GetName().c_str();
+		bool changed = false;
+
+		auto commit = [&](const void* value, size_t size)
+			{
+				changed = property.ReadBinary(component, static_cast<const uint8_t*>(value), size);
+			};
+
+		switch (property.GetType())
+		{
+		case PropertyType::Bool:
+		{
+			bool value;
+			if (ReadScratch(m_Scratch, value) && ImGui::Checkbox(label, &value))
+				commit(&value, sizeof(value));
+			break;
+		}
+		case PropertyType::U32:
+		{
+			uint32_t value;
+			if (ReadScratch(m_Scratch, value) && ImGui::DragScalar(label, ImGuiDataType_U32, &value, 1.0f))
+				commit(&value, sizeof(value));
+			break;
+		}
+		case PropertyType::Int:
+		{
+			int value;
+			if (ReadScratch(m_Scratch, value) && ImGui::DragInt(label, &value))
+				commit(&value, sizeof(value));
+			break;
+		}
+		case PropertyType::Float:
+		{
+			float value;
+			if (ReadScratch(m_Scratch, value) && ImGui::DragFloat(label, &value, 0.1f))
+				commit(&value, sizeof(value));
+			break;
+		}
+		case PropertyType::String:
+		{
+			char buffer[256];
+			const size_t length = std::min(m_Scratch.size(), sizeof(buffer) - 1);
+			std::memcpy(buffer, m_Scratch.data(), length);
+			buffer[length] = '\0';
+			if (ImGui::InputText(label, buffer, sizeof(buffer)))
+				commit(buffer, std::strlen(buffer));
+			break;
+		}
+		case PropertyType::Vec2:
+		{
+			glm::vec2 value;
+			if (ReadScratch(m_Scratch, value) && ImGui::DragFloat2(label, &value.x, 0.1f))
+				commit(&value, sizeof(value));
+			break;
+		}
+		case PropertyType::Vec3:
+		{
+			glm::vec3 value;
+			if (&property == m_TransformScale)
+			{
+				if (ReadScratch(m_Scratch, value) && ImGui::DragFloat3(label, &value.x, 0.1f, MIN_TRANSFORM_SCALE, FLT_MAX,
+					"%.3f", ImGuiSliderFlags_AlwaysClamp))
+					commit(&value, sizeof(value));
+			}
+			else if (ReadScratch(m_Scratch, value) && ImGui::DragFloat3(label, &value.x, 0.1f))
+				commit(&value, sizeof(value));
+			break;
+		}
+		case PropertyType::Vec4:
+		{
+			glm::vec4 value;
+			if (ReadScratch(m_Scratch, value) && ImGui::DragFloat4(label, &value.x, 0.1f))
+				commit(&value, sizeof(value));
+			break;
+		}
+		case PropertyType::Quat:
+		{
+			glm::quat value;
+			if (ReadScratch(m_Scratch, value) && ImGui::DragFloat4(label, &value[0], 0.01f))
+				commit(&value, sizeof(value));
+			break;
+		}
+		case PropertyType::Entity:
+		{
+			uint32_t value;
+			if (ReadScratch(m_Scratch, value))
+				ImGui::LabelText(label, "%u", value);
+			break;
+		}
+		}
+
+		return changed;
+	}
+
+	bool ReflectionInspector::DrawAddComponent(entt::registry& registry, entt::entity entity)
+	{
+		bool added = false;
+		if (ImGui::Button("Add Component"))
+			ImGui::OpenPopup("AddComponentPopup");
+
+		if (ImGui::BeginPopup("AddComponentPopup"))
+		{
+			for (const ComponentMetadata* meta : m_Addable)
+			{
+				if (ImGui::MenuItem(DisplayName(meta->GetName()).c_str()))
+				{
+					meta->Emplace(registry, entity);
+					if (m_History)
+						m_History->RecordAddComponent(Entity(entity, &registry), *meta);
+					m_LayoutDirty = true;
+					added = true;
+				}
+			}
+			ImGui::EndPopup();
+		}
+		return added;
+	}
+
+} // end of Engine
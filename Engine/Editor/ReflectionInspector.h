@@ -0,0 +1,79 @@
+#pragma once
+/**
+ * @file ReflectionInspector.h
+ * @brief Declaration of the reflection-driven component inspector used by the properties panel.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#ifndef SK_REFLECTION_INSPECTOR_H
+#define SK_REFLECTION_INSPECTOR_H
+
+// Include Standard Headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Include other necessary headers
+#include "../ECS/Scene.h"
+#include "../Serialization/Property.h"
+#include "EditorHistory.h"
+
+namespace Engine
+{
+	/**
+	* @class ReflectionInspector
+	* @brief Draws every registered component of an entity from ReflectionRegistry metadata.
+	* @details The widget layout (which components, which properties, in which order) is built once
+	*          per selection and reused every frame; values are read and written through the typed
+	*          binary property helpers.
+	*/
+	class ReflectionInspector
+	{
+	public:
+		ReflectionInspector() = default;
+		~ReflectionInspector() = default;
+
+		ReflectionInspector(const ReflectionInspector&) = delete;
+		ReflectionInspector& operator=(const ReflectionInspector&) = delete;
+
+		// Draw the components of an entity into the current ImGui window
+		void Draw(Scene* scene, Entity entity);
+
+		// Rebuild the layout on next draw (component added/removed outside the inspector)
+		void Invalidate() { m_LayoutDirty = true; }
+
+		// Record edits into an undo history (nullptr edits without recording)
+		void SetHistory(EditorHistory* history) { m_History = history; }
+
+	private:
+		struct Section
+		{
+			const ComponentMetadata* Meta = nullptr;
+			std::string Header;
+			std::vector<const PropertyBase*> Properties;
+		};
+
+		void RebuildLayout(entt::registry& registry, entt::entity entity);
+
+		// Draw one property widget, returns true if the value was changed (old value left in m_Scratch)
+		bool DrawProperty(const PropertyBase& property, void* component);
+
+		// Draw the "Add Component" button/popup, returns true if a component was added
+		bool DrawAddComponent(entt::registry& registry, entt::entity entity);
+
+		EditorHistory* m_History = nullptr;
+		entt::entity m_Entity = entt::null;
+		std::vector<Section> m_Sections;
+		std::vector<const ComponentMetadata*> m_Addable;
+		const PropertyBase* m_TransformScale = nullptr;	// Clamped to a positive minimum
+		std::vector<uint8_t> m_Scratch;
+		bool m_LayoutDirty = true;
+	};
+
+} // end of Engine
+
+#endif // SK_REFLECTION_INSPECTOR_H
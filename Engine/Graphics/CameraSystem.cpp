@@ -9,7 +9,7 @@ namespace Engine {
 
 		(void)ts;
 
-		auto camView = scene->GetRegistry().view<CameraComponent, TransformComponent>();
+		auto camView = scene->GetRegistry().view<CameraComponent, TransformComponent>(entt::exclude<InactiveComponent>);
 		for (auto cam : camView) {
 
 			auto& camera = camView.get<CameraComponent>(cam);
@@ -0,0 +1,391 @@
+/**
+ * @file DebugDraw.cpp
+ * @brief Immediate-mode debug drawing of lines, shapes and text anchors
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "../Graphics/DebugDraw.h"
+#include "../Core/CVar.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <mutex>
+
+#include <glm/gtc/constants.hpp>
+
+namespace {
+
+	Engine::CVar<int> s_DebugDraw("r.DebugDraw", 1, 0, 1, "Draw queued debug lines, shapes and text");
+
+	constexpr int DEPTH = 0;   // Queue index of depth-tested lines
+	constexpr int OVERLAY = 1; // Queue index of lines drawn on top
+
+	struct TimedText
+	{
+		Engine::DebugText text;
+		float             remaining;
+	};
+
+	/**
+	 * @brief Lines of one depth mode; timed lines carry one lifetime per line (vertex pair)
+	 */
+	struct LineQueue
+	{
+		std::vector<Engine::DebugVertex> frame;
+		std::vector<Engine::DebugVertex> timed;
+		std::vector<float>               lifetimes;
+	};
+
+	/**
+	 * @brief Queue of one producer thread, only contended while collect() drains it
+	 */
+	struct ThreadBuffer
+	{
+		std::mutex                     mutex;
+		LineQueue                      lines[2];
+		std::vector<Engine::DebugText> frame_texts;
+		std::vector<TimedText>         timed_texts;
+	};
+
+	struct DebugDrawState
+	{
+		std::mutex                                 buffers_mutex;
+		std::vector<std::unique_ptr<ThreadBuffer>> buffers;   // One per live thread that has drawn
+		ThreadBuffer                               retired;   // Left over by threads that exited
+
+		std::mutex                       collect_mutex;
+		std::vector<ThreadBuffer*>       drain;               // Buffers of this collect, reused
+		std::vector<Engine::DebugVertex> persistent[2];
+		std::vector<float>               lifetimes[2];
+		std::vector<TimedText>           persistent_texts;
+		Engine::DebugDrawStats           stats;
+	};
+
+	DebugDrawState& state() {
+		static DebugDrawState s;
+		return s;
+	}
+
+	template<typename T>
+	void append(std::vector<T>& to, std::vector<T>& from) {
+		std::move(from.begin(), from.end(), std::back_inserter(to));
+		from.clear();
+	}
+
+	/**
+	 * @brief Keep what an exiting thread queued for the next collect, then drop its buffer
+	 */
+	void retire_buffer(ThreadBuffer* buffer) {
+
+		DebugDrawState& s = state();
+		std::lock_guard lock(s.buffers_mutex);
+		{
+			std::lock_guard buffer_lock(buffer->mutex);
+			std::lock_guard retired_lock(s.retired.mutex);
+			for (int q = DEPTH; q <= OVERLAY; ++q) {
+				append(s.retired.lines[q].frame, buffer->lines[q].frame);
+				append(s.retired.lines[q].timed, buffer->lines[q].timed);
+				append(s.retired.lines[q].lifetimes, buffer->lines[q].lifetimes);
+			}
+			append(s.retired.frame_texts, buffer->frame_texts);
+			append(s.retired.timed_texts, buffer->timed_texts);
+		}
+
+		std::erase_if(s.buffers, [buffer](std::unique_ptr<ThreadBuffer> const& b) { return b.get() == buffer; });
+	}
+
+	/**
+	 * @brief Registers the calling thread's buffer on first use and retires it at thread exit
+	 */
+	struct LocalBuffer
+	{
+		ThreadBuffer* buffer = nullptr;
+
+		~LocalBuffer() {
+			if (buffer) { retire_buffer(buffer); }
+		}
+	};
+
+	ThreadBuffer& local_buffer() {
+		thread_local LocalBuffer local;
+		if (!local.buffer) {
+			DebugDrawState& s = state();
+			std::lock_guard lock(s.buffers_mutex);
+			s.buffers.push_back(std::make_unique<ThreadBuffer>());
+			local.buffer = s.buffers.back().get();
+		}
+		return *local.buffer;
+	}
+
+	/**
+	 * @brief Generate lines straight into this thread's frame or timed queue
+	 */
+	template<typename Generate>
+	void queue_lines(float duration, bool depth_test, Generate&& generate) {
+
+		ThreadBuffer& buffer = local_buffer();
+		std::lock_guard lock(buffer.mutex);
+
+		LineQueue& lines = buffer.lines[depth_test ? DEPTH : OVERLAY];
+		if (duration <= 0.0f) {
+			generate(lines.frame);
+			return;
+		}
+
+		const size_t first = lines.timed.size();
+		generate(lines.timed);
+		lines.lifetimes.resize(lines.lifetimes.size() + (lines.timed.size() - first) / 2, duration);
+	}
+
+	/**
+	 * @brief Subtract dt from each line's lifetime and compact out the expired ones
+	 */
+	void age_lines(std::vector<Engine::DebugVertex>& vertices, std::vector<float>& lifetimes, float dt) {
+
+		size_t kept = 0;
+		for (size_t i = 0; i < lifetimes.size(); ++i) {
+			const float remaining = lifetimes[i] - dt;
+			if (remaining <= 0.0f) { continue; }
+
+			lifetimes[kept] = remaining;
+			vertices[2 * kept] = vertices[2 * i];
+			vertices[2 * kept + 1] = vertices[2 * i + 1];
+			++kept;
+		}
+
+		lifetimes.resize(kept);
+		vertices.resize(2 * kept);
+	}
+
+	/**
+	 * @brief Unit vector perpendicular to n
+	 */
+	glm::vec3 any_perpendicular(glm::vec3 const& n) {
+		const glm::vec3 axis = std::abs(n.x) < 0.9f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+		return glm::normalize(glm::cross(n, axis));
+	}
+
+}
+
+namespace Engine {
+
+	namespace DebugGeometry {
+
+		void line(std::vector<DebugVertex>& out, glm::vec3 const& a, glm::vec3 const& b, std::uint32_t color) {
+			out.push_back({ a, color });
+			out.push_back({ b, color });
+		}
+
+		void box(std::vector<DebugVertex>& out, glm::vec3 const& center, glm::vec3 const& half_extents, glm::quat const& rotation, std::uint32_t color) {
+
+			// Corner i has +x when bit 0 is set, +y for bit 1, +z for bit 2
+			glm::vec3 corners[8];
+			for (int i = 0; i < 8; ++i) {
+				const glm::vec3 sign((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f, (i & 4) ? 1.0f : -1.0f);
+				corners[i] = center + rotation * (sign * half_extents);
+			}
+
+			// Every pair of corners differing in exactly one bit is an edge
+			for (int i = 0; i < 8; ++i) {
+				for (int bit = 1; bit < 8; bit <<= 1) {
+					if (!(i & bit)) { line(out, corners[i], corners[i | bit], color); }
+				}
+			}
+		}
+
+		void circle(std::vector<DebugVertex>& out, glm::vec3 const& center, glm::vec3 const& normal, float radius, std::uint32_t color, int segments) {
+
+			segments = std::max(segments, 3);
+			const glm::vec3 n = glm::normalize(normal);
+			const glm::vec3 u = any_perpendicular(n) * radius;
+			const glm::vec3 v = glm::cross(n, u);
+
+			glm::vec3 previous = center + u;
+			for (int i = 1; i <= segments; ++i) {
+				const float angle = glm::two_pi<float>() * static_cast<float>(i) / static_cast<float>(segments);
+				const glm::vec3 point = center + u * std::cos(angle) + v * std::sin(angle);
+				line(out, previous, point, color);
+				previous = point;
+			}
+		}
+
+		void sphere(std::vector<DebugVertex>& out, glm::vec3 const& center, float radius, std::uint32_t color, int segments) {
+			circle(out, center, glm::vec3(1.0f, 0.0f, 0.0f), radius, color, segments);
+			circle(out, center, glm::vec3(0.0f, 1.0f, 0.0f), radius, color, segments);
+			circle(out, center, glm::vec3(0.0f, 0.0f, 1.0f), radius, color, segments);
+		}
+
+		void frustum(std::vector<DebugVertex>& out, glm::mat4 const& view_projection, std::uint32_t color) {
+
+			// Unproject the NDC cube, corners numbered like box()
+			const glm::mat4 inverse = glm::inverse(view_projection);
+			glm::vec3 corners[8];
+			for (int i = 0; i < 8; ++i) {
+				const glm::vec4 ndc((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f, (i & 4) ? 1.0f : -1.0f, 1.0f);
+				const glm::vec4 world = inverse * ndc;
+				corners[i] = glm::vec3(world) / world.w;
+			}
+
+			for (int i = 0; i < 8; ++i) {
+				for (int bit = 1; bit < 8; bit <<= 1) {
+					if (!(i & bit)) { line(out, corners[i], corners[i | bit], color); }
+				}
+			}
+		}
+
+		void cross(std::vector<DebugVertex>& out, glm::vec3 const& center, float size, std::uint32_t color) {
+			const float h = 0.5f * size;
+			line(out, center - glm::vec3(h, 0.0f, 0.0f), center + glm::vec3(h, 0.0f, 0.0f), color);
+			line(out, center - glm::vec3(0.0f, h, 0.0f), center + glm::vec3(0.0f, h, 0.0f), color);
+			line(out, center - glm::vec3(0.0f, 0.0f, h), center + glm::vec3(0.0f, 0.0f, h), color);
+		}
+
+		bool project(glm::mat4 const& view_projection, glm::vec2 const& viewport_size, glm::vec3 const& position, glm::vec2& out_pixels) {
+
+			const glm::vec4 clip = view_projection * glm::vec4(position, 1.0f);
+			if (clip.w <= 0.0f) { return false; }
+
+			const glm::vec2 ndc = glm::vec2(clip) / clip.w;
+			out_pixels = glm::vec2((ndc.x * 0.5f + 0.5f) * viewport_size.x, (0.5f - ndc.y * 0.5f) * viewport_size.y);
+			return true;
+		}
+	}
+
+	bool DebugDraw::enabled() { return s_DebugDraw.Get() != 0; }
+
+	void DebugDraw::line(glm::vec3 const& a, glm::vec3 const& b, std::uint32_t color, float duration, bool depth_test) {
+		if (!enabled()) { return; }
+		queue_lines(duration, depth_test, [&](std::vector<DebugVertex>& out) { DebugGeometry::line(out, a, b, color); });
+	}
+
+	void DebugDraw::box(glm::vec3 const& center, glm::vec3 const& half_extents, glm::quat const& rotation, std::uint32_t color, float duration, bool depth_test) {
+		if (!enabled()) { return; }
+		queue_lines(duration, depth_test, [&](std::vector<DebugVertex>& out) { DebugGeometry::box(out, center, half_extents, rotation, color); });
+	}
+
+	void DebugDraw::aabb(glm::vec3 const& min, glm::vec3 const& max, std::uint32_t color, float duration, bool depth_test) {
+		box(0.5f * (min + max), 0.5f * (max - min), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), color, duration, depth_test);
+	}
+
+	void DebugDraw::sphere(glm::vec3 const& center, float radius, std::uint32_t color, float duration, bool depth_test) {
+		if (!enabled()) { return; }
+		queue_lines(duration, depth_test, [&](std::vector<DebugVertex>& out) { DebugGeometry::sphere(out, center, radius, color); });
+	}
+
+	void DebugDraw::frustum(glm::mat4 const& view_projection, std::uint32_t color, float duration, bool depth_test) {
+		if (!enabled()) { return; }
+		queue_lines(duration, depth_test, [&](std::vector<DebugVertex>& out) { DebugGeometry::frustum(out, view_projection, color); });
+	}
+
+	void DebugDraw::text(glm::vec3 const& position, std::string_view text, std::uint32_t color, float duration, float height) {
+		if (!enabled()) { return; }
+		queue_lines(duration, false, [&](std::vector<DebugVertex>& out) { DebugGeometry::cross(out, position, height * 0.5f, color); });
+
+		ThreadBuffer& buffer = local_buffer();
+		std::lock_guard lock(buffer.mutex);
+
+		DebugText entry{ position, color, height, std::string(text) };
+		if (duration <= 0.0f) {
+			buffer.frame_texts.push_back(std::move(entry));
+		}
+		else {
+			buffer.timed_texts.push_back({ std::move(entry), duration });
+		}
+	}
+
+	void DebugDraw::collect(DebugDrawList& out, float dt) {
+
+		DebugDrawState& s = state();
+		std::lock_guard lock(s.collect_mutex);
+
+		out.clear();
+
+		// Age what earlier frames kept before adding this frame's timed primitives
+		for (int q = DEPTH; q <= OVERLAY; ++q) {
+			age_lines(s.persistent[q], s.lifetimes[q], dt);
+		}
+		std::erase_if(s.persistent_texts, [dt](TimedText& t) { t.remaining -= dt; return t.remaining <= 0.0f; });
+
+		// Held until the buffers are drained, so an exiting thread cannot free its buffer meanwhile
+		std::lock_guard buffers_lock(s.buffers_mutex);
+		s.drain.clear();
+		s.drain.push_back(&s.retired);
+		for (auto const& buffer : s.buffers) { s.drain.push_back(buffer.get()); }
+
+		// Depth-tested range first, then the overlay range
+		for (int q = DEPTH; q <= OVERLAY; ++q) {
+			for (ThreadBuffer* buffer : s.drain) {
+				std::lock_guard buffer_lock(buffer->mutex);
+				LineQueue& lines = buffer->lines[q];
+
+				out.vertices.insert(out.vertices.end(), lines.frame.begin(), lines.frame.end());
+				s.persistent[q].insert(s.persistent[q].end(), lines.timed.begin(), lines.timed.end());
+				s.lifetimes[q].insert(s.lifetimes[q].end(), lines.lifetimes.begin(), lines.lifetimes.end());
+				lines.frame.clear();
+				lines.timed.clear();
+				lines.lifetimes.clear();
+			}
+			out.vertices.insert(out.vertices.end(), s.persistent[q].begin(), s.persistent[q].end());
+
+			if (q == DEPTH) {
+				out.depth_vertices = static_cast<std::uint32_t>(out.vertices.size());
+			}
+		}
+
+		for (ThreadBuffer* buffer : s.drain) {
+			std::lock_guard buffer_lock(buffer->mutex);
+			std::move(buffer->frame_texts.begin(), buffer->frame_texts.end(), std::back_inserter(out.texts));
+			std::move(buffer->timed_texts.begin(), buffer->timed_texts.end(), std::back_inserter(s.persistent_texts));
+			buffer->frame_texts.clear();
+			buffer->timed_texts.clear();
+		}
+		for (TimedText const& t : s.persistent_texts) {
+			out.texts.push_back(t.text);
+		}
+
+		s.stats.lines = static_cast<std::uint32_t>(out.vertices.size() / 2);
+		s.stats.persistent_lines = static_cast<std::uint32_t>((s.persistent[DEPTH].size() + s.persistent[OVERLAY].size()) / 2);
+		s.stats.texts = static_cast<std::uint32_t>(out.texts.size());
+		s.stats.thread_buffers = static_cast<std::uint32_t>(s.buffers.size());
+	}
+
+	void DebugDraw::clear() {
+
+		DebugDrawState& s = state();
+		std::lock_guard lock(s.collect_mutex);
+		std::lock_guard buffers_lock(s.buffers_mutex);
+
+		auto clear_buffer = [](ThreadBuffer& buffer) {
+			std::lock_guard buffer_lock(buffer.mutex);
+			for (LineQueue& lines : buffer.lines) {
+				lines.frame.clear();
+				lines.timed.clear();
+				lines.lifetimes.clear();
+			}
+			buffer.frame_texts.clear();
+			buffer.timed_texts.clear();
+		};
+
+		clear_buffer(s.retired);
+		for (auto const& buffer : s.buffers) { clear_buffer(*buffer); }
+
+		for (int q = DEPTH; q <= OVERLAY; ++q) {
+			s.persistent[q].clear();
+			s.lifetimes[q].clear();
+		}
+		s.persistent_texts.clear();
+	}
+
+	DebugDrawStats DebugDraw::stats() {
+		DebugDrawState& s = state();
+		std::lock_guard lock(s.collect_mutex);
+		return s.stats;
+	}
+
+}
@@ -0,0 +1,192 @@
+/**
+ * @file DebugDraw.h
+ * @brief Immediate-mode debug drawing of lines, shapes and text anchors
+ * @details Any thread may queue primitives; each thread appends to its own buffer,
+ *          so producers never contend with each other. Once per frame the RenderSystem
+ *          merges all buffers into a DebugDrawList carried by the FramePacket, and the
+ *          renderer draws it as one line list (one draw with depth test, one without).
+ *          Primitives with a duration are kept and redrawn until it runs out.
+ *          Nothing in here touches OpenGL, so geometry can be generated and checked
+ *          without a context.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace Engine {
+
+	/**
+	 * @brief Pack a color as RGBA8 (red in the lowest byte, the vertex attribute layout)
+	 */
+	constexpr std::uint32_t debug_color(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a = 255) {
+		return static_cast<std::uint32_t>(r) | (static_cast<std::uint32_t>(g) << 8) |
+			(static_cast<std::uint32_t>(b) << 16) | (static_cast<std::uint32_t>(a) << 24);
+	}
+
+	namespace DebugColors {
+		inline constexpr std::uint32_t White   = debug_color(255, 255, 255);
+		inline constexpr std::uint32_t Red     = debug_color(255, 64, 64);
+		inline constexpr std::uint32_t Green   = debug_color(64, 255, 64);
+		inline constexpr std::uint32_t Blue    = debug_color(64, 128, 255);
+		inline constexpr std::uint32_t Yellow  = debug_color(255, 230, 64);
+		inline constexpr std::uint32_t Cyan    = debug_color(64, 230, 255);
+		inline constexpr std::uint32_t Magenta = debug_color(255, 64, 255);
+		inline constexpr std::uint32_t Orange  = debug_color(255, 160, 32);
+	}
+
+	/**
+	 * @brief Line-list vertex, uploaded as is (position at 0, normalized RGBA8 at 12)
+	 */
+	struct DebugVertex
+	{
+		glm::vec3     position;
+		std::uint32_t color;
+	};
+
+	static_assert(sizeof(DebugVertex) == 16, "DebugVertex must stay tightly packed for upload");
+
+	/**
+	 * @brief Text anchored at a world position, for an overlay to project and print
+	 */
+	struct DebugText
+	{
+		glm::vec3     position;
+		std::uint32_t color = DebugColors::White;
+		float         height = 0.25f;   ///< World-space size hint
+		std::string   text;
+	};
+
+	/**
+	 * @brief Everything queued for one frame, merged from all threads
+	 */
+	struct DebugDrawList
+	{
+		std::vector<DebugVertex> vertices;          ///< Line list: depth-tested lines, then overlay lines
+		std::uint32_t            depth_vertices = 0; ///< Vertices in the depth-tested range
+		std::vector<DebugText>   texts;
+
+		/**
+		 * @brief Clear contents for reuse, keeping allocations
+		 */
+		void clear() {
+			vertices.clear();
+			depth_vertices = 0;
+			texts.clear();
+		}
+
+		bool empty() const { return vertices.empty() && texts.empty(); }
+	};
+
+	/**
+	 * @brief Counters of the last DebugDraw::collect
+	 */
+	struct DebugDrawStats
+	{
+		std::uint32_t lines = 0;            ///< Lines in the list (persistent included)
+		std::uint32_t persistent_lines = 0; ///< Of which timed (duration > 0) and still alive
+		std::uint32_t texts = 0;
+		std::uint32_t thread_buffers = 0;   ///< Live threads that have drawn (a buffer is dropped when its thread exits)
+	};
+
+	/**
+	 * @brief Line-list geometry generators, shared by DebugDraw and usable on their own
+	 */
+	namespace DebugGeometry {
+
+		/** @brief Segments used for circles and spheres */
+		inline constexpr int circle_segments = 24;
+
+		void line(std::vector<DebugVertex>& out, glm::vec3 const& a, glm::vec3 const& b, std::uint32_t color);
+
+		/**
+		 * @brief 12 edges of an oriented box
+		 */
+		void box(std::vector<DebugVertex>& out, glm::vec3 const& center, glm::vec3 const& half_extents, glm::quat const& rotation, std::uint32_t color);
+
+		/**
+		 * @brief Circle of the given radius around a normal
+		 */
+		void circle(std::vector<DebugVertex>& out, glm::vec3 const& center, glm::vec3 const& normal, float radius, std::uint32_t color, int segments = circle_segments);
+
+		/**
+		 * @brief Three axis-aligned great circles
+		 */
+		void sphere(std::vector<DebugVertex>& out, glm::vec3 const& center, float radius, std::uint32_t color, int segments = circle_segments);
+
+		/**
+		 * @brief 12 edges of the volume clipped by a view-projection matrix (OpenGL clip space)
+		 */
+		void frustum(std::vector<DebugVertex>& out, glm::mat4 const& view_projection, std::uint32_t color);
+
+		/**
+		 * @brief Three short axis lines marking a point
+		 */
+		void cross(std::vector<DebugVertex>& out, glm::vec3 const& center, float size, std::uint32_t color);
+
+		/**
+		 * @brief Project a world position to viewport pixels (origin top-left)
+		 * @return false when the point is behind the camera
+		 */
+		bool project(glm::mat4 const& view_projection, glm::vec2 const& viewport_size, glm::vec3 const& position, glm::vec2& out_pixels);
+	}
+
+	/**
+	 * @brief Thread-safe immediate-mode debug draw API
+	 * @details A duration of 0 draws for the next collected frame only; a positive
+	 *          duration keeps the primitive for that many seconds of collect() time.
+	 *          depth_test = false draws on top of the scene. Calls are cheap no-ops
+	 *          while the r.DebugDraw CVar is 0.
+	 */
+	class DebugDraw {
+
+	public:
+		static void line(glm::vec3 const& a, glm::vec3 const& b, std::uint32_t color = DebugColors::White, float duration = 0.0f, bool depth_test = true);
+
+		static void box(glm::vec3 const& center, glm::vec3 const& half_extents, glm::quat const& rotation, std::uint32_t color = DebugColors::White, float duration = 0.0f, bool depth_test = true);
+
+		/**
+		 * @brief Axis-aligned box from its bounds
+		 */
+		static void aabb(glm::vec3 const& min, glm::vec3 const& max, std::uint32_t color = DebugColors::White, float duration = 0.0f, bool depth_test = true);
+
+		static void sphere(glm::vec3 const& center, float radius, std::uint32_t color = DebugColors::White, float duration = 0.0f, bool depth_test = true);
+
+		/**
+		 * @brief Volume seen by a camera, e.g. camera.getPerspective(aspect) * camera.getLookAt()
+		 */
+		static void frustum(glm::mat4 const& view_projection, std::uint32_t color = DebugColors::Yellow, float duration = 0.0f, bool depth_test = true);
+
+		/**
+		 * @brief Text anchored at a position; the anchor itself is marked with a small cross
+		 */
+		static void text(glm::vec3 const& position, std::string_view text, std::uint32_t color = DebugColors::White, float duration = 0.0f, float height = 0.25f);
+
+		/**
+		 * @brief Merge every thread's queue and the persistent primitives into a list
+		 * @param out Receives the frame's primitives (cleared first)
+		 * @param dt Seconds since the last collect, used to age persistent primitives
+		 */
+		static void collect(DebugDrawList& out, float dt);
+
+		/**
+		 * @brief Drop everything queued or persisting
+		 */
+		static void clear();
+
+		static DebugDrawStats stats();
+
+		static bool enabled();
+	};
+
+}
@@ -0,0 +1,60 @@
+/**
+ * @file FramePacket.h
+ * @brief Immutable snapshot of everything the renderer needs for one frame
+ * @details Produced by the RenderSystem on the simulation thread and consumed by
+ *          the render backend, possibly on another thread. Holds copies only, never
+ *          references into the ECS registry.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+
+#include <vector>
+
+#include "../Graphics/DrawItem.h"
+#include "../Graphics/Camera.h"
+#include "../Graphics/Light.h"
+#include "../Graphics/DebugDraw.h"
+#include "../Particles/ParticleData.h"
+#include "../Component/CameraComponent.h"
+
+namespace Engine {
+
+	/**
+	 * @brief Draw items, cameras and lights of a single frame
+	 * @details Vectors keep their capacity between frames, so a recycled packet does
+	 *          not allocate once the scene size is stable.
+	 */
+	struct FramePacket
+	{
+		u64                          frame_index = 0;
+
+		std::vector<DrawItem>        draw_items;
+		std::vector<CameraComponent> cameras;
+
+		// Editor view, copied so the simulation thread may keep moving the live camera
+		Camera3D                     editor_camera;
+		Light                        editor_light;
+
+		// Debug lines and text queued by any thread up to this frame
+		DebugDrawList                debug;
+
+		// Particle billboards, one instance range per emitter
+		ParticleDrawList             particles;
+
+		/**
+		 * @brief Clear contents for reuse, keeping allocations
+		 */
+		void reset() {
+			frame_index = 0;
+			draw_items.clear();
+			cameras.clear();
+			debug.clear();
+			particles.Clear();
+		}
+	};
+
+}
@@ -0,0 +1,158 @@
+/**
+ * @file FramePipeline.cpp
+ * @brief Double/triple-buffered handoff of frame packets between simulation and render
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "../Graphics/FramePipeline.h"
+#include "../Utility/Logger.h"
+
+#include <algorithm>
+
+namespace Engine {
+
+	FramePipeline::FramePipeline(size_t buffer_count)
+		: m_packets(std::clamp<size_t>(buffer_count, 2, 3))
+		, m_states(m_packets.size(), SlotState::FREE) {
+	}
+
+	FramePacket* FramePipeline::begin_write() {
+
+		std::unique_lock lock(m_mutex);
+
+		if (m_write_slot != SIZE_MAX) {
+			LOG_WARNING("FramePipeline::begin_write() - previous packet was never submitted, reusing it");
+			m_packets[m_write_slot].reset();
+			m_packets[m_write_slot].frame_index = m_next_frame;
+			return &m_packets[m_write_slot];
+		}
+
+		auto find_free = [this]() {
+			return std::find(m_states.begin(), m_states.end(), SlotState::FREE);
+		};
+
+		if (find_free() == m_states.end() && !m_stopped) {
+			m_stats.producer_waits++;
+			m_slot_freed.wait(lock, [&]() { return m_stopped || find_free() != m_states.end(); });
+		}
+
+		if (m_stopped) {
+			return nullptr;
+		}
+
+		m_write_slot = static_cast<size_t>(find_free() - m_states.begin());
+		m_states[m_write_slot] = SlotState::WRITING;
+
+		FramePacket& packet = m_packets[m_write_slot];
+		packet.reset();
+		packet.frame_index = m_next_frame;
+		return &packet;
+	}
+
+	void FramePipeline::submit() {
+
+		{
+			std::lock_guard lock(m_mutex);
+
+			if (m_write_slot == SIZE_MAX) {
+				LOG_WARNING("FramePipeline::submit() - no packet being written");
+				return;
+			}
+
+			m_states[m_write_slot] = SlotState::READY;
+			m_ready.push_back(m_write_slot);
+			m_write_slot = SIZE_MAX;
+			m_next_frame++;
+			m_stats.submitted++;
+		}
+
+		m_packet_ready.notify_one();
+	}
+
+	const FramePacket* FramePipeline::acquire_read() {
+
+		std::unique_lock lock(m_mutex);
+
+		if (m_ready.empty() && !m_stopped) {
+			m_stats.consumer_waits++;
+			m_packet_ready.wait(lock, [&]() { return m_stopped || !m_ready.empty(); });
+		}
+
+		return acquire_locked();
+	}
+
+	const FramePacket* FramePipeline::try_acquire_read() {
+
+		std::lock_guard lock(m_mutex);
+		return acquire_locked();
+	}
+
+	const FramePacket* FramePipeline::acquire_locked() {
+
+		if (m_read_slot != SIZE_MAX) {
+			LOG_WARNING("FramePipeline - previous packet was never released");
+			return nullptr;
+		}
+
+		// Drain what was submitted before a stop, then report the end
+		if (m_ready.empty()) {
+			return nullptr;
+		}
+
+		m_read_slot = m_ready.front();
+		m_ready.pop_front();
+		m_states[m_read_slot] = SlotState::READING;
+		return &m_packets[m_read_slot];
+	}
+
+	void FramePipeline::release() {
+
+		{
+			std::lock_guard lock(m_mutex);
+
+			if (m_read_slot == SIZE_MAX) {
+				LOG_WARNING("FramePipeline::release() - no packet being read");
+				return;
+			}
+
+			m_states[m_read_slot] = SlotState::FREE;
+			m_read_slot = SIZE_MAX;
+			m_stats.consumed++;
+		}
+
+		m_slot_freed.notify_one();
+	}
+
+	void FramePipeline::stop() {
+
+		{
+			std::lock_guard lock(m_mutex);
+			m_stopped = true;
+		}
+
+		m_slot_freed.notify_all();
+		m_packet_ready.notify_all();
+	}
+
+	void FramePipeline::restart() {
+
+		std::lock_guard lock(m_mutex);
+
+		std::fill(m_states.begin(), m_states.end(), SlotState::FREE);
+		m_ready.clear();
+		m_write_slot = SIZE_MAX;
+		m_read_slot = SIZE_MAX;
+		m_stopped = false;
+	}
+
+	FramePipelineStats FramePipeline::stats() const {
+
+		std::lock_guard lock(m_mutex);
+		return m_stats;
+	}
+
+}
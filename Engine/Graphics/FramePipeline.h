@@ -0,0 +1,116 @@
+/**
+ * @file FramePipeline.h
+ * @brief Double/triple-buffered handoff of frame packets between simulation and render
+ * @details The producer fills a free packet and submits it; the consumer acquires
+ *          submitted packets in order and releases them once drawn. With N buffers the
+ *          simulation can run at most N-1 frames ahead of the GPU submission.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "../Graphics/FramePacket.h"
+
+namespace Engine {
+
+	/**
+	 * @brief Counters describing pipeline behaviour
+	 */
+	struct FramePipelineStats
+	{
+		u64 submitted = 0;       ///< Packets handed to the consumer
+		u64 consumed = 0;        ///< Packets released by the consumer
+		u64 producer_waits = 0;  ///< BeginWrite calls that had to wait for a free buffer
+		u64 consumer_waits = 0;  ///< AcquireRead calls that had to wait for a packet
+	};
+
+	/**
+	 * @brief Fixed ring of FramePackets with explicit write/read ownership
+	 * @details Each buffer is owned by exactly one side at a time:
+	 *          free -> (BeginWrite) writing -> (Submit) ready -> (AcquireRead) reading -> (Release) free.
+	 *          Thread-safe for one producer and one consumer.
+	 */
+	class FramePipeline {
+
+	public:
+		/**
+		 * @param buffer_count Number of packets, clamped to [2, 3]
+		 */
+		explicit FramePipeline(size_t buffer_count = 2);
+
+		FramePipeline(const FramePipeline&) = delete;
+		FramePipeline& operator=(const FramePipeline&) = delete;
+
+		/**
+		 * @brief Get a free packet to fill (blocks while all buffers are in flight)
+		 * @return Cleared packet, or nullptr once the pipeline is stopped
+		 */
+		FramePacket* begin_write();
+
+		/**
+		 * @brief Hand the packet obtained from begin_write to the consumer
+		 */
+		void submit();
+
+		/**
+		 * @brief Get the oldest submitted packet (blocks until one is available)
+		 * @return Packet, or nullptr once the pipeline is stopped and drained
+		 */
+		const FramePacket* acquire_read();
+
+		/**
+		 * @brief Non-blocking acquire_read
+		 * @return Packet, or nullptr if nothing is ready
+		 */
+		const FramePacket* try_acquire_read();
+
+		/**
+		 * @brief Return the packet obtained from acquire_read to the producer
+		 */
+		void release();
+
+		/**
+		 * @brief Wake both sides and make further waits return nullptr
+		 */
+		void stop();
+
+		/**
+		 * @brief Re-arm after stop, dropping any in-flight packets
+		 */
+		void restart();
+
+		size_t buffer_count() const { return m_packets.size(); }
+
+		FramePipelineStats stats() const;
+
+	private:
+		enum class SlotState : u8 { FREE, WRITING, READY, READING };
+
+		const FramePacket* acquire_locked();
+
+		std::vector<FramePacket> m_packets;
+		std::vector<SlotState>   m_states;
+		std::deque<size_t>       m_ready;      // Submitted slots, oldest first
+
+		size_t m_write_slot = SIZE_MAX;
+		size_t m_read_slot  = SIZE_MAX;
+		u64    m_next_frame = 0;
+		bool   m_stopped    = false;
+
+		FramePipelineStats m_stats;
+
+		mutable std::mutex      m_mutex;
+		std::condition_variable m_slot_freed;
+		std::condition_variable m_packet_ready;
+	};
+
+}
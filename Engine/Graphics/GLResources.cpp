@@ -118,6 +118,10 @@ namespace Engine {
 		glVertexArrayAttribBinding(handle, attrib, binding);
 	}
 
+	void VAO::binding_divisor(GLuint binding, GLuint divisor) const {
+		glVertexArrayBindingDivisor(handle, binding, divisor);
+	}
+
 	void VAO::bind_element_buffer(const VBO& ebo) const {
 		glVertexArrayElementBuffer(handle, ebo.id());
 	}
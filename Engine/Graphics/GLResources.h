@@ -192,6 +192,15 @@ namespace Engine {
 		 */
 		void attrib_binding(GLuint attrib, GLuint binding) const;
 
+		/**
+		 * @brief Sets how often a binding point advances to its next element.
+		 * @details 0 advances per vertex, 1 per instance (instanced attributes).
+		 *          Calls glVertexArrayBindingDivisor.
+		 * @param binding The binding point index.
+		 * @param divisor Instances drawn per element, 0 for per-vertex data.
+		 */
+		void binding_divisor(GLuint binding, GLuint divisor) const;
+
 		/**
 		 * @brief Binds an element buffer (index buffer) to this VAO.
 		 * @details Associates an EBO for indexed drawing. Calls glVertexArrayElementBuffer.
@@ -0,0 +1,51 @@
+/**
+ * @file RenderBackend.cpp
+ * @brief OpenGL render backend used by the render thread
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "../Graphics/RenderBackend.h"
+#include "../Graphics/Renderer.h"
+#include "../Utility/Logger.h"
+
+#include <GLFW/glfw3.h>
+
+namespace Engine {
+
+	GLRenderBackend::GLRenderBackend(Renderer& renderer, GLFWwindow* window)
+		: m_renderer(renderer), m_window(window) {
+	}
+
+	void GLRenderBackend::on_thread_attach() {
+		// A GL context is current on at most one thread, the main thread released it
+		glfwMakeContextCurrent(m_window);
+	}
+
+	void GLRenderBackend::render(const FramePacket& packet) {
+		m_renderer.render_frame(packet);
+	}
+
+	void GLRenderBackend::present() {
+		// Only the thread owning the context may change its swap interval
+		const int interval = m_pending_swap_interval.exchange(-1, std::memory_order_acquire);
+		if (interval >= 0) {
+			glfwSwapInterval(interval);
+			LOG_INFO("Swap interval set to ", interval, " on the render thread");
+		}
+
+		glfwSwapBuffers(m_window);
+	}
+
+	void GLRenderBackend::set_swap_interval(int interval) {
+		m_pending_swap_interval.store(interval < 0 ? 0 : interval, std::memory_order_release);
+	}
+
+	void GLRenderBackend::on_thread_detach() {
+		glfwMakeContextCurrent(nullptr);
+	}
+
+}
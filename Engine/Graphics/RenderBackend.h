@@ -0,0 +1,102 @@
+/**
+ * @file RenderBackend.h
+ * @brief Consumer side of the frame pipeline: turns FramePackets into pixels
+ * @details The render thread only talks to this interface, so the GL renderer can
+ *          be swapped for a null backend when running without a window.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+
+#include <atomic>
+
+#include "../Graphics/FramePacket.h"
+
+struct GLFWwindow;
+
+namespace Engine {
+
+	class Renderer;
+
+	/**
+	 * @brief Draws packets on whichever thread owns the backend
+	 */
+	class RenderBackend {
+
+	public:
+		virtual ~RenderBackend() = default;
+
+		/**
+		 * @brief Called on the render thread before the first frame (bind context etc.)
+		 */
+		virtual void on_thread_attach() {}
+
+		/**
+		 * @brief Draw one frame
+		 */
+		virtual void render(const FramePacket& packet) = 0;
+
+		/**
+		 * @brief Show the frame that was just drawn
+		 */
+		virtual void present() {}
+
+		/**
+		 * @brief Request a new swap interval (0 = VSync off, 1 = every vblank, ...)
+		 * @details Callable from any thread; the backend applies it on its own thread
+		 *          before the next present.
+		 */
+		virtual void set_swap_interval(int interval) { (void)interval; }
+
+		/**
+		 * @brief Called on the render thread after the last frame (release context etc.)
+		 */
+		virtual void on_thread_detach() {}
+	};
+
+	/**
+	 * @brief Backend that draws nothing, only counts what it was given (headless runs)
+	 */
+	class NullRenderBackend : public RenderBackend {
+
+	public:
+		void render(const FramePacket& packet) override {
+			m_frames++;
+			m_draw_items += packet.draw_items.size();
+			m_last_frame = packet.frame_index;
+		}
+
+		u64 frames() const { return m_frames; }
+		u64 draw_items() const { return m_draw_items; }
+		u64 last_frame() const { return m_last_frame; }
+
+	private:
+		u64 m_frames = 0;
+		u64 m_draw_items = 0;
+		u64 m_last_frame = 0;
+	};
+
+	/**
+	 * @brief OpenGL backend: owns the window's context while the render thread runs
+	 */
+	class GLRenderBackend : public RenderBackend {
+
+	public:
+		GLRenderBackend(Renderer& renderer, GLFWwindow* window);
+
+		void on_thread_attach() override;
+		void render(const FramePacket& packet) override;
+		void present() override;
+		void set_swap_interval(int interval) override;
+		void on_thread_detach() override;
+
+	private:
+		Renderer& m_renderer;
+		GLFWwindow* m_window;
+		std::atomic<int> m_pending_swap_interval{ -1 };	// -1 = unchanged
+	};
+
+}
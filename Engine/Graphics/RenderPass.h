@@ -26,7 +26,7 @@ namespace Engine {
 	/**
 	 * @brief Categories of render passes for different rendering techniques
 	 */
-	enum class PassType : uint8_t {GEOMETRY, FULLSCREEN, DEBUGGING};
+	enum class PassType : uint8_t {GEOMETRY, FULLSCREEN, DEBUGGING, PARTICLES};
 
 	/**
 	 * @brief Complete configuration for a single render pass
@@ -2,21 +2,39 @@
 #include "../ECS/Scene.h"
 #include "../Component/TransformComponent.h"
 #include "../Component/MeshRendererComponent.h"
+#include "../Particles/ParticleSystem.h"
 
 namespace Engine {
 
-	RenderSystem::RenderSystem(Renderer& renderer_ref) : System(), renderer(renderer_ref) {
-		m_drawitems.reserve(1000);
+	RenderSystem::RenderSystem(Renderer& renderer_ref, FramePipeline* pipeline)
+		: System(), renderer(renderer_ref), m_pipeline(pipeline) {
+		m_packet.draw_items.reserve(1000);
 	}
 
 	void RenderSystem::OnUpdate(Scene* scene, Timestep ts) {
 
-		(void)ts;
+		// Threaded: fill a free packet and hand it over, the render thread draws it later
+		if (m_pipeline) {
+			FramePacket* packet = m_pipeline->begin_write();
+			if (!packet) { return; } // Pipeline stopped (shutting down)
 
-		m_drawitems.clear();
-		m_cameralist.clear();
+			build_packet(scene, *packet, ts.GetSeconds());
+			m_pipeline->submit();
+			return;
+		}
+
+		// Inline: draw right away on this thread
+		build_packet(scene, m_packet, ts.GetSeconds());
+		renderer.render_frame(m_packet);
+	}
+
+	void RenderSystem::build_packet(Scene* scene, FramePacket& packet, float dt) {
+
+		packet.draw_items.clear();
+		packet.cameras.clear();
 
-		auto view = scene->GetRegistry().view<TransformComponent, MeshRendererComponent>();
+		auto view = scene->GetRegistry().view<TransformComponent, MeshRendererComponent>(entt::exclude<InactiveComponent>);
+		packet.draw_items.reserve(view.size_hint());
 
 		for (auto entity : view) {
 			auto& renderable = view.get<MeshRendererComponent>(entity);
@@ -25,7 +43,7 @@ namespace Engine {
 			// Only render visible meshes
 			if (renderable.Visible)
 			{
-				m_drawitems.push_back({
+				packet.draw_items.push_back({
 					renderable.MeshType,
 					renderable.Material,
 					renderable.Texture,
@@ -35,22 +53,33 @@ namespace Engine {
 		}
 
 		// Save all enabled cameras
-		auto camView = scene->GetRegistry().view<CameraComponent, TransformComponent>();
+		auto camView = scene->GetRegistry().view<CameraComponent, TransformComponent>(entt::exclude<InactiveComponent>);
 		for (auto cam : camView) {
 
 			auto& camera = camView.get<CameraComponent>(cam);
 			if (camera.Enabled) {
-				m_cameralist.emplace_back(camera);
+				packet.cameras.emplace_back(camera);
 			}
 
 		}
-		
-		std::span<DrawItem> drawitem_span(m_drawitems.data(), m_drawitems.size());
-		std::span<CameraComponent> cameralist_span(m_cameralist.data(), m_cameralist.size());
-		renderer.render_frame(drawitem_span, cameralist_span);
+
+		// Copies, so editor input may move the live camera while this packet is drawn
+		packet.editor_camera = renderer.getEditorCamera();
+		packet.editor_light = renderer.getEditorLight();
+
+		// Billboards sorted for the view this packet is drawn from
+		if (ParticleSystem* particles = scene->GetSystem<ParticleSystem>()) {
+			particles->BuildDrawList(scene, packet.editor_camera.getLookAt(), packet.particles);
+		}
+		else {
+			packet.particles.Clear();
+		}
+
+		// Merge what every thread drew since the last packet
+		DebugDraw::collect(packet.debug, dt);
 	}
 
 	int RenderSystem::GetPriority() const { return 101; }
 
 	const char* RenderSystem::GetName() const { return "RenderSystem"; }
-}
\ No newline at end of file
+}
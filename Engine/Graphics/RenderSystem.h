@@ -4,21 +4,32 @@
 
 #include "../Graphics/Renderer.h" // Dependency injection
 #include "../Graphics/DrawItem.h"
+#include "../Graphics/FramePacket.h"
+#include "../Graphics/FramePipeline.h"
 
 namespace Engine {
 
 	class RenderSystem : public System {
 	public:
-		RenderSystem(Renderer& renderer_ref);
+		/**
+		 * @param renderer_ref Renderer owned by the Application
+		 * @param pipeline When set, packets are submitted to the render thread instead of drawn inline
+		 */
+		RenderSystem(Renderer& renderer_ref, FramePipeline* pipeline = nullptr);
 
 		void OnUpdate(Scene* scene, Timestep ts) override;
 		int  GetPriority() const override;
 		const char* GetName() const override;
 
 	private:
+		/**
+		 * @brief Copy everything the renderer needs out of the registry
+		 */
+		void build_packet(Scene* scene, FramePacket& packet, float dt);
+
 		Renderer& renderer; // Holds a reference to the renderer -> which is owned by the Application class
-		std::vector<DrawItem> m_drawitems;
-		std::vector<CameraComponent> m_cameralist;
+		FramePipeline* m_pipeline; // Not owned, nullptr for inline rendering
+		FramePacket m_packet; // Reused packet for inline rendering
 	};
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,65 @@
+/**
+ * @file RenderThread.cpp
+ * @brief Dedicated thread that drains the frame pipeline into a render backend
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "../Graphics/RenderThread.h"
+#include "../Utility/Logger.h"
+
+#include <tracy/Tracy.hpp>
+
+namespace Engine {
+
+	RenderThread::RenderThread(FramePipeline& pipeline, RenderBackend& backend)
+		: m_pipeline(pipeline), m_backend(backend) {
+	}
+
+	RenderThread::~RenderThread() {
+		stop();
+	}
+
+	void RenderThread::start() {
+
+		if (m_thread.joinable()) {
+			LOG_WARNING("RenderThread::start() - already running");
+			return;
+		}
+
+		m_pipeline.restart();
+		m_thread = std::thread(&RenderThread::loop, this);
+		LOG_INFO("Render thread started");
+	}
+
+	void RenderThread::stop() {
+
+		if (!m_thread.joinable()) { return; }
+
+		m_pipeline.stop();
+		m_thread.join();
+		LOG_INFO("Render thread stopped after ", m_frames.load(), " frames");
+	}
+
+	void RenderThread::loop() {
+
+		tracy::SetThreadName("Render");
+		m_backend.on_thread_attach();
+
+		while (const FramePacket* packet = m_pipeline.acquire_read()) {
+			ZoneScopedN("RenderThread");
+
+			m_backend.render(*packet);
+			m_backend.present();
+			m_pipeline.release();
+
+			m_frames.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		m_backend.on_thread_detach();
+	}
+
+}
@@ -0,0 +1,60 @@
+/**
+ * @file RenderThread.h
+ * @brief Dedicated thread that drains the frame pipeline into a render backend
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#include "../Graphics/FramePipeline.h"
+#include "../Graphics/RenderBackend.h"
+
+namespace Engine {
+
+	/**
+	 * @brief Renders frame N while the simulation builds frame N+1
+	 * @details Loop: acquire packet -> render -> present -> release. Stops when the
+	 *          pipeline is stopped and every submitted packet has been drawn.
+	 */
+	class RenderThread {
+
+	public:
+		RenderThread(FramePipeline& pipeline, RenderBackend& backend);
+		~RenderThread();
+
+		RenderThread(const RenderThread&) = delete;
+		RenderThread& operator=(const RenderThread&) = delete;
+
+		/**
+		 * @brief Launch the thread (the backend attaches on it)
+		 */
+		void start();
+
+		/**
+		 * @brief Stop the pipeline, drain it and join
+		 */
+		void stop();
+
+		bool running() const { return m_thread.joinable(); }
+
+		/**
+		 * @brief Number of frames presented so far
+		 */
+		u64 frames_rendered() const { return m_frames.load(std::memory_order_relaxed); }
+
+	private:
+		void loop();
+
+		FramePipeline& m_pipeline;
+		RenderBackend& m_backend;
+		std::thread    m_thread;
+		std::atomic<u64> m_frames{ 0 };
+	};
+
+}
@@ -15,17 +15,22 @@
 #include "../Graphics/Renderer.h"
 #include "../Utility/Logger.h"
 #include "../Utility/AssetPath.h"
+#include "../Core/CVar.h"
 
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/matrix_decompose.hpp>
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+#include <cstddef>
+
 #pragma region NAMESPACE
 
 namespace {
 
-	// Testing values
-	constexpr int width = 1280, height = 720;
+	// Size of the offscreen target the scene is rendered into (shown in the editor viewport)
+	Engine::CVar<int> s_RenderWidth("r.Width", 1280, 16, 16384, "Scene render target width", Engine::CVAR_RESTART);
+	Engine::CVar<int> s_RenderHeight("r.Height", 720, 16, 16384, "Scene render target height", Engine::CVAR_RESTART);
 
 	inline std::vector<Engine::ShaderProgram> loadShaderPrograms(std::vector<std::pair<std::string, std::string>> shaders) {
 
@@ -62,12 +67,16 @@ namespace {
 		std::string vertex_debug_path{ Engine::getAssetFilePath("Sources/Shaders/debug.vert")};
 		std::string fragment_debug_path{ Engine::getAssetFilePath("Sources/Shaders/debug.frag")};
 
+		std::string vertex_particle_path{ Engine::getAssetFilePath("Sources/Shaders/particle.vert")};
+		std::string fragment_particle_path{ Engine::getAssetFilePath("Sources/Shaders/particle.frag")};
+
 		
 
 		// Pair vertex and fragment shader files
 		std::vector<std::pair<std::string, std::string>> shader_files{
 			std::make_pair(vertex_obj_path, fragment_obj_path),
-			std::make_pair(vertex_debug_path, fragment_debug_path)
+			std::make_pair(vertex_debug_path, fragment_debug_path),
+			std::make_pair(vertex_particle_path, fragment_particle_path)
 		};
 
 		shd = loadShaderPrograms(shader_files);
@@ -144,6 +153,9 @@ namespace Engine {
 			LOG_ERROR("Renderer::setup() - Failed to create framebuffer!");
 		}
 
+		const int width = s_RenderWidth.Get();
+		const int height = s_RenderHeight.Get();
+
 		// Allocate storage for a texture on the GPU, this texture will be attached to the framebuffer
 		auto fp_tex = Texture::alloc_storage_on_gpu(width, height);
 		if (fp_tex.has_value()) {
@@ -170,7 +182,8 @@ namespace Engine {
 		{
 			.pass_name = "First Pass",
 			.fbo_handle = 0,
-			.shdpgm_handle = 0
+			.shdpgm_handle = 0,
+			.view_port = { 0, 0, width, height }
 
 			// Leave the rest as default settings
 		};
@@ -199,19 +212,63 @@ namespace Engine {
 
 		}
 
+		// Particles: depth tested against the scene but not written, so overlapping
+		// billboards blend with each other in sorted order
+		RenderPass particle_pass
+		{
+			.pass_name = "Particle Pass",
+			.fbo_handle = 0,
+			.shdpgm_handle = 2,
+			.view_port = { 0, 0, width, height },
+			.clear_color = false,
+			.clear_depth = false,
+			.depth_write = false,
+			.blending = true,
+			.culling = false,
+			.passtype = PassType::PARTICLES
+		};
+
+		m_passes.push_back(particle_pass);
+
 		RenderPass debug_pass
 		{
 			.pass_name = "Debug Pass",
 			.fbo_handle = 0,
 			.shdpgm_handle = 1,
+			.view_port = { 0, 0, width, height },
 			.clear_color = false,
 			.clear_depth = false,
 			.depth_write = false,
+			.blending = true,
 			.culling = false,
 			.passtype = PassType::DEBUGGING
 		};
 
-		//m_passes.push_back(debug_pass);
+		m_passes.push_back(debug_pass);
+
+		// Debug lines: position and normalized RGBA8 color interleaved in one buffer,
+		// whose storage is allocated on first use by draw_debug
+		m_debug_vao.create();
+		m_debug_vao.enable_attrib(0);
+		m_debug_vao.attrib_format(0, 3, GL_FLOAT, false, offsetof(DebugVertex, position));
+		m_debug_vao.attrib_binding(0, 0);
+		m_debug_vao.enable_attrib(1);
+		m_debug_vao.attrib_format(1, 4, GL_UNSIGNED_BYTE, true, offsetof(DebugVertex, color));
+		m_debug_vao.attrib_binding(1, 0);
+
+		// Particle instances: position, size and RGBA8 color, advanced once per instance;
+		// the quad corners come from gl_VertexID in particle.vert
+		m_particle_vao.create();
+		m_particle_vao.enable_attrib(0);
+		m_particle_vao.attrib_format(0, 3, GL_FLOAT, false, offsetof(ParticleInstance, Position));
+		m_particle_vao.attrib_binding(0, 0);
+		m_particle_vao.enable_attrib(1);
+		m_particle_vao.attrib_format(1, 1, GL_FLOAT, false, offsetof(ParticleInstance, Size));
+		m_particle_vao.attrib_binding(1, 0);
+		m_particle_vao.enable_attrib(2);
+		m_particle_vao.attrib_format(2, 4, GL_UNSIGNED_BYTE, true, offsetof(ParticleInstance, Color));
+		m_particle_vao.attrib_binding(2, 0);
+		m_particle_vao.binding_divisor(0, 1);
 
 #if 0
 #pragma region TEXTURE_LOAD_TEMP
@@ -322,23 +379,115 @@ namespace Engine {
 		//}
 
 		// For rendering from editor's camera
-		glm::mat4 v = editor_camera.getLookAt(); // Editor camera view transform
-		for (const auto& pass : m_passes) {
+		render_passes(draw_items, editor_camera, editor_light, nullptr, nullptr);
+	}
+
+	void Renderer::render_frame(const FramePacket& packet) {
+
+		// Packet copies are used so the live editor camera can move while this frame draws
+		Light light = packet.editor_light;
+		render_passes(packet.draw_items, packet.editor_camera, light, &packet.debug, &packet.particles);
+	}
+
+	void Renderer::render_passes(std::span<const DrawItem> draw_items, Camera3D const& camera, Light& light,
+		DebugDrawList const* debug, ParticleDrawList const* particles) {
 
-			if (!isDebug && (pass.passtype == PassType::DEBUGGING)) { continue; }
+		glm::mat4 v = camera.getLookAt(); // Camera view transform
+		for (const auto& pass : m_passes) {
 
 			// Get camera perspective transform
-			glm::mat4 p = editor_camera.getPerspective(pass.view_port.z / pass.view_port.w);
+			glm::mat4 p = camera.getPerspective(pass.view_port.z / pass.view_port.w);
+
+			// The debugging pass draws the frame's debug lines over the scene, skipped when there are none
+			if (pass.passtype == PassType::DEBUGGING) {
+				if (!debug || debug->vertices.empty()) { continue; }
+
+				beginFrame(pass);
+				draw_debug(pass, *debug, v, p);
+				endFrame(pass);
+				continue;
+			}
+
+			// The particle pass draws every emitter's billboards, skipped when there are none
+			if (pass.passtype == PassType::PARTICLES) {
+				if (!particles || particles->Instances.empty()) { continue; }
+
+				beginFrame(pass);
+				draw_particles(pass, *particles, v, p);
+				endFrame(pass);
+				continue;
+			}
 
 			// Begin drawing frame
 			beginFrame(pass); 
-			draw(pass, draw_items, v, p);
+			draw(pass, draw_items, v, p, light);
 			endFrame(pass); 
 		}
+	}
+
+	void Renderer::draw_debug(RenderPass const& pass, DebugDrawList const& debug, const glm::mat4 v, const glm::mat4 p) {
+
+		const size_t count = debug.vertices.size();
+		const size_t depth_count = std::min<size_t>(debug.depth_vertices, count);
+
+		// Immutable storage cannot grow, so a larger frame gets a new buffer
+		if (count > m_debug_capacity) {
+			m_debug_capacity = std::max(count, 2 * m_debug_capacity);
+			m_debug_vbo.create();
+			m_debug_vbo.storage(static_cast<GLsizeiptr>(m_debug_capacity * sizeof(DebugVertex)), nullptr, GL_DYNAMIC_STORAGE_BIT);
+			m_debug_vao.bind_vertex_buffer(0, m_debug_vbo, 0, sizeof(DebugVertex));
+		}
+		m_debug_vbo.sub_data(0, static_cast<GLsizeiptr>(count * sizeof(DebugVertex)), debug.vertices.data());
+
+		auto& prog = m_gl.m_shader_storage[pass.shdpgm_handle];
+		prog.setUniform("V", v);
+		prog.setUniform("P", p);
+
+		glLineWidth(1.0f);
+		m_debug_vao.bind();
+
+		if (depth_count > 0) {
+			glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(depth_count));
+		}
+		if (count > depth_count) {
+			glDisable(GL_DEPTH_TEST);
+			glDrawArrays(GL_LINES, static_cast<GLint>(depth_count), static_cast<GLsizei>(count - depth_count));
+		}
+
+		glBindVertexArray(0);
+	}
+
+	void Renderer::draw_particles(RenderPass const& pass, ParticleDrawList const& particles, const glm::mat4 v, const glm::mat4 p) {
+
+		const size_t count = particles.Instances.size();
+
+		// Immutable storage cannot grow, so a larger frame gets a new buffer
+		if (count > m_particle_capacity) {
+			m_particle_capacity = std::max(count, 2 * m_particle_capacity);
+			m_particle_vbo.create();
+			m_particle_vbo.storage(static_cast<GLsizeiptr>(m_particle_capacity * sizeof(ParticleInstance)), nullptr, GL_DYNAMIC_STORAGE_BIT);
+			m_particle_vao.bind_vertex_buffer(0, m_particle_vbo, 0, sizeof(ParticleInstance));
+		}
+		m_particle_vbo.sub_data(0, static_cast<GLsizeiptr>(count * sizeof(ParticleInstance)), particles.Instances.data());
+
+		auto& prog = m_gl.m_shader_storage[pass.shdpgm_handle];
+		prog.setUniform("V", v);
+		prog.setUniform("P", p);
+
+		m_particle_vao.bind();
+
+		// One draw per emitter, its batch addressed through the base instance
+		for (const ParticleBatch& batch : particles.Batches) {
+			glBlendFunc(GL_SRC_ALPHA, batch.Additive ? GL_ONE : GL_ONE_MINUS_SRC_ALPHA);
+			glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, 4,
+				static_cast<GLsizei>(batch.Count), static_cast<GLuint>(batch.First));
+		}
 
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		glBindVertexArray(0);
 	}
 
-	void Renderer::draw(RenderPass const& pass, std::span<const DrawItem> draw_items, const glm::mat4 v, const glm::mat4 p) {
+	void Renderer::draw(RenderPass const& pass, std::span<const DrawItem> draw_items, const glm::mat4 v, const glm::mat4 p, Light& light) {
 
 
 		auto& prog = m_gl.m_shader_storage[pass.shdpgm_handle];
@@ -346,10 +495,10 @@ namespace Engine {
 		prog.setUniform("V", v);					// View transform
 		prog.setUniform("P", p);					// Perspective transform
 
-		prog.setUniform("light.position", editor_light.getLightPos());      // Position
-		prog.setUniform("light.La", editor_light.getLightAmbient());        // Ambient
-		prog.setUniform("light.Ld", editor_light.getLightDiffuse());        // Diffuse
-		prog.setUniform("light.Ls", editor_light.getLightSpecular());       // Specular
+		prog.setUniform("light.position", light.getLightPos());      // Position
+		prog.setUniform("light.La", light.getLightAmbient());        // Ambient
+		prog.setUniform("light.Ld", light.getLightDiffuse());        // Diffuse
+		prog.setUniform("light.Ls", light.getLightSpecular());       // Specular
 
 
 #pragma region SET_UNIFORM_TEMP
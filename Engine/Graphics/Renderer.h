@@ -28,6 +28,9 @@
 // For Camera component
 #include "Component/CameraComponent.h"
 
+// For frame snapshots handed over from the simulation thread
+#include "Graphics/FramePacket.h"
+
 namespace Engine {
 
 	/**
@@ -50,6 +53,12 @@ namespace Engine {
 		 */
 		void render_frame(std::span<const DrawItem> draw_items, std::span<const CameraComponent> camera_list);
 
+		/**
+		 * @brief Renders a frame entirely from a packet (safe on the render thread)
+		 * @param packet Snapshot produced by the RenderSystem, including the editor camera/light
+		 */
+		void render_frame(const FramePacket& packet);
+
 		/**
 		 * @brief Retrieves the OpenGL texture handle for ImGui rendering
 		 * @return GLuint handle to the first texture in storage
@@ -82,6 +91,8 @@ namespace Engine {
 
 		inline Camera3D& getEditorCamera() { return editor_camera; }
 
+		inline Light& getEditorLight() { return editor_light; }
+
 	private:
 		/**
 		 * @brief Prepares the rendering context for a specific render pass
@@ -94,7 +105,29 @@ namespace Engine {
 		 * @param pass The active render pass configuration
 		 * @param draw_items Collection of objects to draw
 		 */
-		void draw(RenderPass const& pass, std::span<const DrawItem> draw_items, const glm::mat4 v, const glm::mat4 p);
+		void draw(RenderPass const& pass, std::span<const DrawItem> draw_items, const glm::mat4 v, const glm::mat4 p, Light& light);
+
+		/**
+		 * @brief Uploads the frame's debug lines and draws them
+		 * @details One draw for the depth-tested range and one with depth testing off
+		 *          for the overlay range, from a single dynamic vertex buffer.
+		 */
+		void draw_debug(RenderPass const& pass, DebugDrawList const& debug, const glm::mat4 v, const glm::mat4 p);
+
+		/**
+		 * @brief Uploads the frame's particle instances and draws them
+		 * @details One instanced draw of a camera-facing quad per emitter, from a single
+		 *          dynamic instance buffer (each batch starts at its base instance).
+		 */
+		void draw_particles(RenderPass const& pass, ParticleDrawList const& particles, const glm::mat4 v, const glm::mat4 p);
+
+		/**
+		 * @brief Runs every render pass from the given view
+		 * @param debug Debug lines to draw in the debugging pass, or nullptr for none
+		 * @param particles Billboards to draw in the particle pass, or nullptr for none
+		 */
+		void render_passes(std::span<const DrawItem> draw_items, Camera3D const& camera, Light& light,
+			DebugDrawList const* debug, ParticleDrawList const* particles);
 
 		/**
 		 * @brief Finalizes the render pass and performs cleanup
@@ -110,6 +143,16 @@ namespace Engine {
 
 		// Temporary object
 		GraphicsLoader m_gl;
+
+		// Debug line buffer, regrown (never shrunk) when a frame has more vertices than it holds
+		VAO    m_debug_vao;
+		VBO    m_debug_vbo;
+		size_t m_debug_capacity = 0;
+
+		// Particle instance buffer, regrown the same way
+		VAO    m_particle_vao;
+		VBO    m_particle_vbo;
+		size_t m_particle_capacity = 0;
 	};
 
 }
\ No newline at end of file
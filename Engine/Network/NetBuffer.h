@@ -0,0 +1,131 @@
+/**
+ * @file NetBuffer.h
+ * @brief Byte writer/reader for network packets (varints, zigzag)
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+#ifndef __NET_BUFFER_H__
+#define __NET_BUFFER_H__
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Engine {
+
+    /**
+     * @brief Appends packet data to a byte vector
+     * @details Integers are written as LEB128 varints so small values (ids, deltas,
+     *          masks) cost one byte. Signed values are zigzag encoded first.
+     */
+    class NetWriter {
+    public:
+        explicit NetWriter(std::vector<uint8_t>& out) : m_Out(out) {}
+
+        void WriteU8(uint8_t value) { m_Out.push_back(value); }
+
+        void WriteVarU32(uint32_t value) {
+            while (value >= 0x80) {
+                m_Out.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            m_Out.push_back(static_cast<uint8_t>(value));
+        }
+
+        void WriteVarI32(int32_t value) {
+            WriteVarU32((static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31));
+        }
+
+        void WriteU32(uint32_t value) {
+            for (int i = 0; i < 4; ++i)
+                m_Out.push_back(static_cast<uint8_t>(value >> (i * 8)));
+        }
+
+        void WriteFloat(float value) {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            WriteU32(bits);
+        }
+
+        void WriteBytes(const void* data, size_t size) {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            m_Out.insert(m_Out.end(), bytes, bytes + size);
+        }
+
+        size_t Size() const { return m_Out.size(); }
+
+    private:
+        std::vector<uint8_t>& m_Out;
+    };
+
+    /**
+     * @brief Reads what NetWriter wrote
+     * @details Reading past the end or a malformed varint puts the reader in a failed
+     *          state; every later read returns 0. Check IsValid() once at the end.
+     */
+    class NetReader {
+    public:
+        NetReader(const uint8_t* data, size_t size) : m_Data(data), m_Size(size) {}
+
+        uint8_t ReadU8() {
+            if (m_Pos >= m_Size) { m_Failed = true; return 0; }
+            return m_Data[m_Pos++];
+        }
+
+        uint32_t ReadVarU32() {
+            uint32_t value = 0;
+            for (int shift = 0; shift < 35; shift += 7) {
+                uint8_t byte = ReadU8();
+                if (m_Failed) return 0;
+                value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) return value;
+            }
+            m_Failed = true;
+            return 0;
+        }
+
+        int32_t ReadVarI32() {
+            uint32_t value = ReadVarU32();
+            return static_cast<int32_t>((value >> 1) ^ (~(value & 1) + 1));
+        }
+
+        uint32_t ReadU32() {
+            if (m_Pos + 4 > m_Size) { m_Failed = true; return 0; }
+            uint32_t value = 0;
+            for (int i = 0; i < 4; ++i)
+                value |= static_cast<uint32_t>(m_Data[m_Pos++]) << (i * 8);
+            return value;
+        }
+
+        float ReadFloat() {
+            uint32_t bits = ReadU32();
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        bool ReadBytes(void* out, size_t size) {
+            if (m_Pos + size > m_Size) { m_Failed = true; return false; }
+            std::memcpy(out, m_Data + m_Pos, size);
+            m_Pos += size;
+            return true;
+        }
+
+        bool IsValid() const { return !m_Failed; }
+        bool AtEnd() const { return m_Pos == m_Size; }
+
+    private:
+        const uint8_t* m_Data;
+        size_t m_Size;
+        size_t m_Pos = 0;
+        bool m_Failed = false;
+    };
+
+} // namespace Engine
+
+#endif // __NET_BUFFER_H__
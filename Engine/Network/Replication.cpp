@@ -0,0 +1,750 @@
+/**
+ * @file Replication.cpp
+ * @brief Snapshot capture, delta encoding and application
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Replication.h"
+#include "NetBuffer.h"
+#include "../ECS/Scene.h"
+#include "../ECS/Entity.h"
+#include "../Component/TransformComponent.h"
+#include "../Component/ReplicatedComponent.h"
+#include "../Component/PooledComponent.h"
+#include "../Serialization/ReflectionRegistry.h"
+#include "../Utility/Logger.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+namespace Engine {
+
+    namespace {
+        enum PacketType : uint8_t {
+            PACKET_SNAPSHOT = 1,
+            PACKET_ACK = 2
+        };
+
+        enum RecordOp : uint8_t {
+            OP_UPDATE = 0,      ///< Delta against the client's copy
+            OP_CREATE = 1,      ///< Full state, client had nothing
+            OP_DESTROY = 2
+        };
+
+        /// Received states kept by the client for baselines still in flight
+        constexpr size_t CLIENT_HISTORY = 64;
+
+        bool IsFloatType(PropertyType type) {
+            return type == PropertyType::Float || type == PropertyType::Vec2 || type == PropertyType::Vec3 ||
+                type == PropertyType::Vec4 || type == PropertyType::Quat;
+        }
+
+        uint32_t HashCombine(uint32_t hash, uint32_t value) {
+            for (int i = 0; i < 4; ++i) {
+                hash ^= (value >> (i * 8)) & 0xFF;
+                hash *= 16777619u;
+            }
+            return hash;
+        }
+
+        /// Raw float bits do not shrink as varints, send them as plain words
+        bool IsRawFloat(const ReplicationSchema::Field& field) {
+            return field.Precision <= 0.0f && IsFloatType(field.Property->GetType());
+        }
+    }
+
+    // ===== SCHEMA =====
+
+    bool ReplicationSchema::Build() {
+        m_Components.clear();
+        m_LaneCount = 0;
+        m_StringCount = 0;
+
+        std::vector<ComponentMetadata*> replicated;
+        for (const auto& [type, metadata] : ReflectionRegistry::Get().GetAllMetadata()) {
+            (void)type;
+            if (metadata->IsReplicated())
+                replicated.push_back(metadata.get());
+        }
+
+        std::sort(replicated.begin(), replicated.end(), [](const ComponentMetadata* a, const ComponentMetadata* b) {
+            return a->GetNameHash() < b->GetNameHash();
+        });
+
+        if (replicated.size() > MAX_COMPONENTS) {
+            LOG_WARNING("ReplicationSchema: more than ", MAX_COMPONENTS, " replicated components, extra ones ignored");
+            replicated.resize(MAX_COMPONENTS);
+        }
+
+        uint32_t hash = 2166136261u;
+        for (ComponentMetadata* metadata : replicated) {
+            Component component;
+            component.Metadata = metadata;
+            hash = HashCombine(hash, metadata->GetNameHash());
+
+            for (const auto& property : metadata->GetProperties()) {
+                if (!property->IsReplicated())
+                    continue;
+
+                if (component.Fields.size() == MAX_PROPERTIES) {
+                    LOG_WARNING("ReplicationSchema: ", metadata->GetName(), " has more than ", MAX_PROPERTIES,
+                        " replicated properties, extra ones ignored");
+                    break;
+                }
+
+                Field field;
+                field.Property = property.get();
+
+                switch (property->GetType()) {
+                case PropertyType::Bool:   field.ByteSize = sizeof(bool); field.LaneCount = 1; break;
+                case PropertyType::U32:
+                case PropertyType::Int:
+                case PropertyType::Float:  field.ByteSize = 4;  field.LaneCount = 1; break;
+                case PropertyType::Vec2:   field.ByteSize = 8;  field.LaneCount = 2; break;
+                case PropertyType::Vec3:   field.ByteSize = 12; field.LaneCount = 3; break;
+                case PropertyType::Vec4:
+                case PropertyType::Quat:   field.ByteSize = 16; field.LaneCount = 4; break;
+                case PropertyType::String: field.LaneCount = 0; break;
+                case PropertyType::Entity:
+                    // Entity ids are local to each registry
+                    LOG_WARNING("ReplicationSchema: entity property ", metadata->GetName(), ".",
+                        property->GetName(), " cannot be replicated, skipped");
+                    continue;
+                }
+
+                if (field.LaneCount == 0) {
+                    field.Lane = m_StringCount++;
+                }
+                else {
+                    field.Lane = m_LaneCount;
+                    m_LaneCount += field.LaneCount;
+                    if (IsFloatType(property->GetType()))
+                        field.Precision = property->GetReplicationPrecision();
+                }
+
+                uint32_t precisionBits;
+                std::memcpy(&precisionBits, &field.Precision, sizeof(precisionBits));
+                hash = HashCombine(hash, property->GetNameHash());
+                hash = HashCombine(hash, static_cast<uint32_t>(property->GetType()));
+                hash = HashCombine(hash, precisionBits);
+
+                component.Fields.push_back(field);
+            }
+
+            m_Components.push_back(std::move(component));
+        }
+
+        m_Hash = hash;
+
+        if (m_Components.empty()) {
+            LOG_WARNING("ReplicationSchema: no replicated properties registered");
+            return false;
+        }
+
+        LOG_INFO("ReplicationSchema: ", m_Components.size(), " components, ", m_LaneCount, " lanes, ",
+            m_StringCount, " strings");
+        return true;
+    }
+
+    EntitySnapshot ReplicationSchema::MakeEmpty() const {
+        EntitySnapshot snapshot;
+        snapshot.Lanes.assign(m_LaneCount, 0);
+        snapshot.Strings.assign(m_StringCount, std::string());
+        return snapshot;
+    }
+
+    void ReplicationSchema::Capture(entt::registry& registry, entt::entity entity, EntitySnapshot& out) const {
+        out.ComponentMask = 0;
+        out.Lanes.assign(m_LaneCount, 0);
+        out.Strings.assign(m_StringCount, std::string());
+
+        std::vector<uint8_t> bytes;
+        for (size_t i = 0; i < m_Components.size(); ++i) {
+            const Component& component = m_Components[i];
+            void* instance = component.Metadata->Get(registry, entity);
+            if (!instance)
+                continue;
+
+            out.ComponentMask |= 1u << i;
+
+            for (const Field& field : component.Fields) {
+                bytes.clear();
+                field.Property->WriteBinary(instance, bytes);
+
+                if (field.LaneCount == 0) {
+                    out.Strings[field.Lane].assign(bytes.begin(), bytes.end());
+                    continue;
+                }
+
+                if (bytes.size() != field.ByteSize)
+                    continue;
+
+                if (field.Property->GetType() == PropertyType::Bool) {
+                    out.Lanes[field.Lane] = bytes[0] != 0 ? 1 : 0;
+                    continue;
+                }
+
+                for (uint32_t lane = 0; lane < field.LaneCount; ++lane) {
+                    if (field.Precision > 0.0f) {
+                        float value;
+                        std::memcpy(&value, bytes.data() + lane * 4, sizeof(value));
+                        double quantized = std::round(static_cast<double>(value) / field.Precision);
+                        quantized = std::clamp(quantized, static_cast<double>(INT_MIN), static_cast<double>(INT_MAX));
+                        out.Lanes[field.Lane + lane] = std::isfinite(quantized) ? static_cast<int32_t>(quantized) : 0;
+                    }
+                    else {
+                        std::memcpy(&out.Lanes[field.Lane + lane], bytes.data() + lane * 4, 4);
+                    }
+                }
+            }
+        }
+    }
+
+    bool ReplicationSchema::FieldDiffers(const Field& field, const EntitySnapshot& a, const EntitySnapshot& b) const {
+        if (field.LaneCount == 0)
+            return a.Strings[field.Lane] != b.Strings[field.Lane];
+
+        return !std::equal(a.Lanes.begin() + field.Lane, a.Lanes.begin() + field.Lane + field.LaneCount,
+            b.Lanes.begin() + field.Lane);
+    }
+
+    void ReplicationSchema::Apply(entt::registry& registry, entt::entity entity, const EntitySnapshot& snapshot,
+        const EntitySnapshot* previous) const {
+
+        std::vector<uint8_t> bytes;
+        for (size_t i = 0; i < m_Components.size(); ++i) {
+            const Component& component = m_Components[i];
+            const uint32_t bit = 1u << i;
+            const bool has = (snapshot.ComponentMask & bit) != 0;
+            const bool had = previous && (previous->ComponentMask & bit) != 0;
+
+            if (!has) {
+                if (had)
+                    component.Metadata->Remove(registry, entity);
+                continue;
+            }
+
+            void* instance = component.Metadata->Emplace(registry, entity);
+            if (!instance)
+                continue;
+
+            for (const Field& field : component.Fields) {
+                if (had && !FieldDiffers(field, snapshot, *previous))
+                    continue;
+
+                if (field.LaneCount == 0) {
+                    const std::string& value = snapshot.Strings[field.Lane];
+                    field.Property->ReadBinary(instance, reinterpret_cast<const uint8_t*>(value.data()), value.size());
+                    continue;
+                }
+
+                bytes.assign(field.ByteSize, 0);
+                if (field.Property->GetType() == PropertyType::Bool) {
+                    bool value = snapshot.Lanes[field.Lane] != 0;
+                    std::memcpy(bytes.data(), &value, sizeof(value));
+                }
+                else {
+                    for (uint32_t lane = 0; lane < field.LaneCount; ++lane) {
+                        if (field.Precision > 0.0f) {
+                            float value = static_cast<float>(snapshot.Lanes[field.Lane + lane] * static_cast<double>(field.Precision));
+                            std::memcpy(bytes.data() + lane * 4, &value, sizeof(value));
+                        }
+                        else {
+                            std::memcpy(bytes.data() + lane * 4, &snapshot.Lanes[field.Lane + lane], 4);
+                        }
+                    }
+                }
+
+                field.Property->ReadBinary(instance, bytes.data(), bytes.size());
+            }
+        }
+    }
+
+    void ReplicationSchema::Write(NetWriter& writer, const EntitySnapshot& snapshot, const EntitySnapshot* baseline) const {
+        writer.WriteVarU32(snapshot.ComponentMask);
+
+        for (size_t i = 0; i < m_Components.size(); ++i) {
+            const uint32_t bit = 1u << i;
+            if ((snapshot.ComponentMask & bit) == 0)
+                continue;
+
+            const Component& component = m_Components[i];
+            const bool delta = baseline && (baseline->ComponentMask & bit) != 0;
+
+            uint32_t changed = 0;
+            if (delta) {
+                for (size_t f = 0; f < component.Fields.size(); ++f) {
+                    if (FieldDiffers(component.Fields[f], snapshot, *baseline))
+                        changed |= 1u << f;
+                }
+                writer.WriteVarU32(changed);
+            }
+
+            for (size_t f = 0; f < component.Fields.size(); ++f) {
+                if (delta && (changed & (1u << f)) == 0)
+                    continue;
+
+                const Field& field = component.Fields[f];
+                if (field.LaneCount == 0) {
+                    const std::string& value = snapshot.Strings[field.Lane];
+                    writer.WriteVarU32(static_cast<uint32_t>(value.size()));
+                    writer.WriteBytes(value.data(), value.size());
+                    continue;
+                }
+
+                for (uint32_t lane = field.Lane; lane < field.Lane + field.LaneCount; ++lane) {
+                    if (delta) {
+                        // Wrapping difference, small for quantized or integer values
+                        uint32_t difference = static_cast<uint32_t>(snapshot.Lanes[lane]) - static_cast<uint32_t>(baseline->Lanes[lane]);
+                        writer.WriteVarI32(static_cast<int32_t>(difference));
+                    }
+                    else if (IsRawFloat(field)) {
+                        writer.WriteU32(static_cast<uint32_t>(snapshot.Lanes[lane]));
+                    }
+                    else {
+                        writer.WriteVarI32(snapshot.Lanes[lane]);
+                    }
+                }
+            }
+        }
+    }
+
+    bool ReplicationSchema::Read(NetReader& reader, EntitySnapshot& inOut, bool hasBaseline) const {
+        if (!hasBaseline)
+            inOut = MakeEmpty();
+
+        const uint32_t baseMask = hasBaseline ? inOut.ComponentMask : 0;
+        const uint32_t mask = reader.ReadVarU32();
+
+        for (size_t i = 0; i < m_Components.size(); ++i) {
+            const uint32_t bit = 1u << i;
+            const Component& component = m_Components[i];
+
+            if ((mask & bit) == 0) {
+                // Absent components capture as zeros, keep both ends comparable
+                for (const Field& field : component.Fields) {
+                    if (field.LaneCount == 0)
+                        inOut.Strings[field.Lane].clear();
+                    else
+                        std::fill(inOut.Lanes.begin() + field.Lane, inOut.Lanes.begin() + field.Lane + field.LaneCount, 0);
+                }
+                continue;
+            }
+
+            const bool delta = (baseMask & bit) != 0;
+            const uint32_t changed = delta ? reader.ReadVarU32() : ~0u;
+
+            for (size_t f = 0; f < component.Fields.size(); ++f) {
+                if ((changed & (1u << f)) == 0)
+                    continue;
+
+                const Field& field = component.Fields[f];
+                if (field.LaneCount == 0) {
+                    uint32_t size = reader.ReadVarU32();
+                    if (!reader.IsValid() || size > 65535)
+                        return false;
+                    std::string& value = inOut.Strings[field.Lane];
+                    value.resize(size);
+                    if (size > 0 && !reader.ReadBytes(value.data(), size))
+                        return false;
+                    continue;
+                }
+
+                for (uint32_t lane = field.Lane; lane < field.Lane + field.LaneCount; ++lane) {
+                    if (delta) {
+                        uint32_t difference = static_cast<uint32_t>(reader.ReadVarI32());
+                        inOut.Lanes[lane] = static_cast<int32_t>(static_cast<uint32_t>(inOut.Lanes[lane]) + difference);
+                    }
+                    else if (IsRawFloat(field)) {
+                        inOut.Lanes[lane] = static_cast<int32_t>(reader.ReadU32());
+                    }
+                    else {
+                        inOut.Lanes[lane] = reader.ReadVarI32();
+                    }
+                }
+            }
+        }
+
+        inOut.ComponentMask = mask & ((m_Components.size() >= 32) ? ~0u : ((1u << m_Components.size()) - 1));
+        return reader.IsValid();
+    }
+
+    // ===== SERVER =====
+
+    ReplicationServer::ReplicationServer(const ReplicationSettings& settings)
+        : m_Settings(settings) {
+    }
+
+    size_t ReplicationServer::AddConnection(std::unique_ptr<NetTransport> transport) {
+        Connection connection;
+        connection.Transport = std::move(transport);
+        m_Connections.push_back(std::move(connection));
+        m_Stats.Connections = static_cast<uint32_t>(m_Connections.size());
+        return m_Connections.size() - 1;
+    }
+
+    void ReplicationServer::Update(Scene* scene, float dt) {
+        if (!scene || m_Connections.empty())
+            return;
+
+        if (!m_Schema.IsBuilt() && !m_Schema.Build())
+            return;
+
+        for (Connection& connection : m_Connections)
+            ReceiveAcks(connection);
+
+        const float interval = m_Settings.SendRate > 0.0f ? 1.0f / m_Settings.SendRate : 0.0f;
+        m_Accumulator += dt;
+        if (m_Accumulator < interval)
+            return;
+
+        // Never burst to catch up after a hitch
+        m_Accumulator = std::min(m_Accumulator - interval, interval);
+
+        m_Tick++;
+        m_Stats.Ticks++;
+        m_Stats.LastPacketBytes = 0;
+        m_Stats.LastEntitiesSent = 0;
+        m_Stats.LastEntitiesDeferred = 0;
+
+        Capture(scene->GetRegistry());
+
+        for (Connection& connection : m_Connections)
+            SendSnapshot(connection);
+    }
+
+    void ReplicationServer::ReceiveAcks(Connection& connection) {
+        while (connection.Transport->Receive(m_Packet)) {
+            NetReader reader(m_Packet.data(), m_Packet.size());
+            if (reader.ReadU8() != PACKET_ACK)
+                continue;
+
+            uint32_t tick = reader.ReadVarU32();
+            glm::vec3 view;
+            view.x = reader.ReadFloat();
+            view.y = reader.ReadFloat();
+            view.z = reader.ReadFloat();
+
+            if (!reader.IsValid() || tick > m_Tick)
+                continue;
+
+            // Acks can arrive out of order, keep the newest
+            if (tick > connection.AckedTick) {
+                connection.AckedTick = tick;
+                connection.View = view;
+            }
+        }
+    }
+
+    void ReplicationServer::Capture(entt::registry& registry) {
+        if (m_Settings.AutoReplicate) {
+            std::vector<entt::entity> untagged;
+            for (auto entity : registry.view<TransformComponent>(entt::exclude<ReplicatedComponent>))
+                untagged.push_back(entity);
+            for (auto entity : untagged)
+                registry.emplace<ReplicatedComponent>(entity);
+        }
+
+        m_Current.clear();
+        m_Positions.clear();
+        m_Weights.clear();
+
+        // Pooled instances waiting for reuse are not part of the world
+        auto view = registry.view<ReplicatedComponent>(entt::exclude<InactiveComponent>);
+        for (auto entity : view) {
+            auto& replicated = view.get<ReplicatedComponent>(entity);
+            if (replicated.NetId == 0)
+                replicated.NetId = m_NextNetId++;
+
+            m_Schema.Capture(registry, entity, m_Current[replicated.NetId]);
+
+            const auto* transform = registry.try_get<TransformComponent>(entity);
+            m_Positions[replicated.NetId] = transform ? glm::vec3(transform->WorldTransform[3]) : glm::vec3(0.0f);
+            m_Weights[replicated.NetId] = replicated.Priority;
+        }
+
+        m_Stats.ReplicatedEntities = static_cast<uint32_t>(m_Current.size());
+    }
+
+    void ReplicationServer::SendSnapshot(Connection& connection) {
+        // Baseline: the newest state this client confirmed
+        const ReplicationState* baseline = nullptr;
+        if (connection.AckedTick != 0) {
+            for (const SentState& sent : connection.History) {
+                if (sent.Tick == connection.AckedTick) {
+                    baseline = &sent.State;
+                    break;
+                }
+            }
+        }
+
+        auto isRelevant = [&](uint32_t netId) {
+            if (m_Settings.RelevancyDistance <= 0.0f)
+                return true;
+            return glm::distance(m_Positions[netId], connection.View) <= m_Settings.RelevancyDistance;
+        };
+
+        SentState next;
+        next.Tick = m_Tick;
+        m_Candidates.clear();
+
+        for (const auto& [netId, snapshot] : m_Current) {
+            if (!isRelevant(netId))
+                continue;
+
+            const EntitySnapshot* base = nullptr;
+            if (baseline) {
+                auto it = baseline->find(netId);
+                if (it != baseline->end())
+                    base = &it->second;
+            }
+
+            if (base && *base == snapshot) {
+                next.State.emplace(netId, snapshot);
+                connection.Priority.erase(netId);
+                continue;
+            }
+
+            // Accumulate so far-away entities still get through eventually
+            const float distance = glm::distance(m_Positions[netId], connection.View);
+            const float relevance = m_Settings.PriorityDistance / (m_Settings.PriorityDistance + distance);
+            float& priority = connection.Priority[netId];
+            priority += std::max(m_Weights[netId], 0.0f) * relevance + 1e-4f;
+            m_Candidates.push_back({ netId, priority });
+        }
+
+        std::sort(m_Candidates.begin(), m_Candidates.end(), [](const Candidate& a, const Candidate& b) {
+            return a.Priority != b.Priority ? a.Priority > b.Priority : a.NetId < b.NetId;
+        });
+
+        m_Packet.clear();
+        uint32_t records = 0;
+
+        // Destroys are tiny and always fit
+        if (baseline) {
+            NetWriter writer(m_Packet);
+            for (const auto& [netId, snapshot] : *baseline) {
+                (void)snapshot;
+                if (m_Current.count(netId) == 0 || !isRelevant(netId)) {
+                    writer.WriteVarU32(netId);
+                    writer.WriteU8(OP_DESTROY);
+                    records++;
+                }
+            }
+        }
+
+        for (const Candidate& candidate : m_Candidates) {
+            const EntitySnapshot& snapshot = m_Current[candidate.NetId];
+            const EntitySnapshot* base = nullptr;
+            if (baseline) {
+                auto it = baseline->find(candidate.NetId);
+                if (it != baseline->end())
+                    base = &it->second;
+            }
+
+            m_Record.clear();
+            NetWriter writer(m_Record);
+            writer.WriteVarU32(candidate.NetId);
+            writer.WriteU8(base ? OP_UPDATE : OP_CREATE);
+            m_Schema.Write(writer, snapshot, base);
+
+            if (records > 0 && m_Packet.size() + m_Record.size() > m_Settings.BytesPerTick) {
+                // Client keeps its old copy until this entity wins a later tick
+                if (base)
+                    next.State.emplace(candidate.NetId, *base);
+                m_Stats.LastEntitiesDeferred++;
+                continue;
+            }
+
+            m_Packet.insert(m_Packet.end(), m_Record.begin(), m_Record.end());
+            next.State.emplace(candidate.NetId, snapshot);
+            connection.Priority.erase(candidate.NetId);
+            records++;
+        }
+
+        for (auto it = connection.Priority.begin(); it != connection.Priority.end();) {
+            if (m_Current.count(it->first) == 0)
+                it = connection.Priority.erase(it);
+            else
+                ++it;
+        }
+
+        std::vector<uint8_t> packet;
+        packet.reserve(m_Packet.size() + 16);
+        NetWriter header(packet);
+        header.WriteU8(PACKET_SNAPSHOT);
+        header.WriteU32(m_Schema.GetHash());
+        header.WriteVarU32(m_Tick);
+        header.WriteVarU32(baseline ? connection.AckedTick : 0);
+        header.WriteVarU32(records);
+        header.WriteBytes(m_Packet.data(), m_Packet.size());
+
+        connection.Transport->Send(packet.data(), packet.size());
+
+        connection.History.push_back(std::move(next));
+        while (connection.History.size() > std::max<uint32_t>(m_Settings.HistorySize, 1))
+            connection.History.pop_front();
+
+        m_Stats.LastPacketBytes = std::max(m_Stats.LastPacketBytes, static_cast<uint32_t>(packet.size()));
+        m_Stats.LastEntitiesSent += records;
+        m_Stats.TotalBytes += packet.size();
+        m_Stats.TotalEntityRecords += records;
+    }
+
+    // ===== CLIENT =====
+
+    ReplicationClient::ReplicationClient(std::unique_ptr<NetTransport> transport)
+        : m_Transport(std::move(transport)) {
+    }
+
+    entt::entity ReplicationClient::FindEntity(uint32_t netId) const {
+        auto it = m_Entities.find(netId);
+        return it != m_Entities.end() ? it->second : entt::entity{ entt::null };
+    }
+
+    void ReplicationClient::Update(Scene* scene) {
+        if (!scene || !m_Transport)
+            return;
+
+        if (!m_Schema.IsBuilt() && !m_Schema.Build())
+            return;
+
+        while (m_Transport->Receive(m_Packet)) {
+            m_Stats.TotalBytes += m_Packet.size();
+            if (!ReadSnapshot(m_Packet))
+                m_Stats.PacketsDropped++;
+        }
+
+        if (m_HasNewState) {
+            ApplyState(scene, m_History.back().State);
+            m_HasNewState = false;
+            m_Stats.Ticks++;
+            SendAck();
+        }
+    }
+
+    bool ReplicationClient::ReadSnapshot(const std::vector<uint8_t>& packet) {
+        NetReader reader(packet.data(), packet.size());
+        if (reader.ReadU8() != PACKET_SNAPSHOT)
+            return false;
+
+        if (reader.ReadU32() != m_Schema.GetHash()) {
+            if (!m_WarnedSchema) {
+                LOG_WARNING("ReplicationClient: server replicates a different schema, snapshots ignored");
+                m_WarnedSchema = true;
+            }
+            return false;
+        }
+
+        const uint32_t tick = reader.ReadVarU32();
+        const uint32_t baselineTick = reader.ReadVarU32();
+        const uint32_t count = reader.ReadVarU32();
+        if (!reader.IsValid())
+            return false;
+
+        // Older than what we have, a newer snapshot already superseded it
+        if (tick <= m_LastTick)
+            return true;
+
+        ReceivedState received;
+        received.Tick = tick;
+
+        if (baselineTick != 0) {
+            auto it = std::find_if(m_History.begin(), m_History.end(),
+                [baselineTick](const ReceivedState& state) { return state.Tick == baselineTick; });
+            if (it == m_History.end())
+                return false;
+            received.State = it->State;
+        }
+
+        for (uint32_t i = 0; i < count; ++i) {
+            const uint32_t netId = reader.ReadVarU32();
+            const uint8_t op = reader.ReadU8();
+            if (!reader.IsValid())
+                return false;
+
+            if (op == OP_DESTROY) {
+                received.State.erase(netId);
+                continue;
+            }
+
+            auto it = received.State.find(netId);
+            if (op == OP_UPDATE && it == received.State.end())
+                return false;
+
+            EntitySnapshot& snapshot = received.State[netId];
+            if (!m_Schema.Read(reader, snapshot, op == OP_UPDATE))
+                return false;
+        }
+
+        if (!reader.IsValid())
+            return false;
+
+        m_Stats.LastPacketBytes = static_cast<uint32_t>(packet.size());
+        m_Stats.LastEntitiesSent = count;
+        m_Stats.TotalEntityRecords += count;
+
+        m_History.push_back(std::move(received));
+        while (m_History.size() > CLIENT_HISTORY)
+            m_History.pop_front();
+
+        m_LastTick = tick;
+        m_HasNewState = true;
+        return true;
+    }
+
+    void ReplicationClient::ApplyState(Scene* scene, const ReplicationState& state) {
+        entt::registry& registry = scene->GetRegistry();
+
+        for (const auto& [netId, snapshot] : state) {
+            const EntitySnapshot* previous = nullptr;
+
+            auto found = m_Entities.find(netId);
+            if (found == m_Entities.end() || !registry.valid(found->second)) {
+                Entity created = scene->CreateEntity("Replicated " + std::to_string(netId));
+                registry.emplace_or_replace<ReplicatedComponent>(created, netId);
+                m_Entities[netId] = created;
+                found = m_Entities.find(netId);
+            }
+            else {
+                auto applied = m_Applied.find(netId);
+                if (applied != m_Applied.end())
+                    previous = &applied->second;
+            }
+
+            m_Schema.Apply(registry, found->second, snapshot, previous);
+        }
+
+        for (auto it = m_Entities.begin(); it != m_Entities.end();) {
+            if (state.count(it->first) == 0) {
+                if (registry.valid(it->second))
+                    scene->DestroyEntity(Entity(it->second, &registry));
+                it = m_Entities.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+
+        m_Applied = state;
+        m_Stats.ReplicatedEntities = static_cast<uint32_t>(m_Entities.size());
+    }
+
+    void ReplicationClient::SendAck() {
+        std::vector<uint8_t> packet;
+        NetWriter writer(packet);
+        writer.WriteU8(PACKET_ACK);
+        writer.WriteVarU32(m_LastTick);
+        writer.WriteFloat(m_View.x);
+        writer.WriteFloat(m_View.y);
+        writer.WriteFloat(m_View.z);
+        m_Transport->Send(packet.data(), packet.size());
+    }
+
+} // namespace Engine
@@ -0,0 +1,283 @@
+/**
+ * @file Replication.h
+ * @brief Server-to-client state replication with delta compression
+ * @details The server snapshots every entity carrying a ReplicatedComponent and
+ *          sends each client only what changed relative to the last state that
+ *          client acknowledged (its baseline). Packets are unreliable: a lost
+ *          snapshot is simply superseded by the next one, which is still encoded
+ *          against the last baseline the client confirmed.
+ *
+ *          What gets replicated is declared in reflection (see
+ *          ComponentMetadata::Replicate in ComponentRegistry.cpp), so components
+ *          opt in per property without any network code of their own.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+#ifndef __REPLICATION_H__
+#define __REPLICATION_H__
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+
+#include "Transport.h"
+
+namespace Engine {
+
+    class Scene;
+    class ComponentMetadata;
+    class PropertyBase;
+    class NetWriter;
+    class NetReader;
+
+    /**
+     * @brief Replicated state of one entity, flattened into 32-bit lanes
+     * @details Each replicated numeric property owns a fixed range of lanes (floats
+     *          possibly quantized), so deltas are per-lane integer differences.
+     *          Strings live apart and are resent whole when they change.
+     */
+    struct EntitySnapshot {
+        uint32_t ComponentMask = 0;         ///< Bit i = schema component i present
+        std::vector<int32_t> Lanes;
+        std::vector<std::string> Strings;
+
+        bool operator==(const EntitySnapshot& other) const {
+            return ComponentMask == other.ComponentMask && Lanes == other.Lanes && Strings == other.Strings;
+        }
+        bool operator!=(const EntitySnapshot& other) const { return !(*this == other); }
+    };
+
+    /// Replicated world state keyed by NetId
+    using ReplicationState = std::unordered_map<uint32_t, EntitySnapshot>;
+
+    /**
+     * @brief Layout of replicated components and properties, built from reflection
+     * @details Components are ordered by name hash so both ends agree on the layout
+     *          as long as they run the same build; the layout hash travels in every
+     *          snapshot to reject mismatched peers.
+     */
+    class ReplicationSchema {
+    public:
+        static constexpr uint32_t MAX_COMPONENTS = 32;
+        static constexpr uint32_t MAX_PROPERTIES = 32;     ///< Per component
+
+        struct Field {
+            const PropertyBase* Property = nullptr;
+            uint32_t Lane = 0;              ///< First lane, or string slot
+            uint32_t LaneCount = 0;         ///< 0 for strings
+            uint32_t ByteSize = 0;          ///< Size of the binary value
+            float Precision = 0.0f;         ///< Float quantization step, 0 = exact bits
+        };
+
+        struct Component {
+            ComponentMetadata* Metadata = nullptr;
+            std::vector<Field> Fields;
+        };
+
+        /**
+         * @brief Collect replicated properties from the ReflectionRegistry
+         * @return False if nothing is marked replicated
+         */
+        bool Build();
+
+        bool IsBuilt() const { return !m_Components.empty(); }
+        uint32_t GetHash() const { return m_Hash; }
+        const std::vector<Component>& GetComponents() const { return m_Components; }
+
+        /**
+         * @brief Read an entity's replicated properties into a snapshot
+         */
+        void Capture(entt::registry& registry, entt::entity entity, EntitySnapshot& out) const;
+
+        /**
+         * @brief Write a snapshot onto an entity
+         * @param previous Last snapshot applied to this entity, only differing
+         *        properties are written (nullptr writes everything)
+         */
+        void Apply(entt::registry& registry, entt::entity entity, const EntitySnapshot& snapshot,
+            const EntitySnapshot* previous) const;
+
+        /**
+         * @brief Encode the components of a snapshot
+         * @param baseline Encode as a delta against this (nullptr for full state)
+         */
+        void Write(NetWriter& writer, const EntitySnapshot& snapshot, const EntitySnapshot* baseline) const;
+
+        /**
+         * @brief Decode what Write produced
+         * @param inOut Holds the baseline (or is reset for full state) and receives the result
+         */
+        bool Read(NetReader& reader, EntitySnapshot& inOut, bool hasBaseline) const;
+
+        /**
+         * @brief An empty snapshot sized for this schema
+         */
+        EntitySnapshot MakeEmpty() const;
+
+    private:
+        bool FieldDiffers(const Field& field, const EntitySnapshot& a, const EntitySnapshot& b) const;
+
+        std::vector<Component> m_Components;
+        uint32_t m_LaneCount = 0;
+        uint32_t m_StringCount = 0;
+        uint32_t m_Hash = 0;
+    };
+
+    /**
+     * @brief Server-side replication policy
+     */
+    struct ReplicationSettings {
+        float SendRate = 30.0f;             ///< Snapshots per second per client
+        uint32_t BytesPerTick = 1200;       ///< Packet budget, lower priority entities wait
+        float RelevancyDistance = 0.0f;     ///< Entities further from the client's view are not sent, 0 = all
+        float PriorityDistance = 25.0f;     ///< Priority halves at this distance from the view
+        bool AutoReplicate = true;          ///< Replicate every entity with a TransformComponent
+        uint32_t HistorySize = 64;          ///< Sent states kept per client for baselines
+    };
+
+    /**
+     * @brief Bandwidth counters
+     */
+    struct ReplicationStats {
+        uint32_t Connections = 0;
+        uint32_t ReplicatedEntities = 0;
+        uint32_t LastPacketBytes = 0;       ///< Largest packet of the last tick
+        uint32_t LastEntitiesSent = 0;      ///< Entity records in the last tick
+        uint32_t LastEntitiesDeferred = 0;  ///< Changed but left out by the budget
+        uint64_t Ticks = 0;
+        uint64_t TotalBytes = 0;
+        uint64_t TotalEntityRecords = 0;
+        uint64_t PacketsDropped = 0;        ///< Client: no baseline or malformed
+
+        float BytesPerEntity() const {
+            return TotalEntityRecords ? static_cast<float>(TotalBytes) / static_cast<float>(TotalEntityRecords) : 0.0f;
+        }
+    };
+
+    /**
+     * @brief Sends scene state to connected clients
+     */
+    class ReplicationServer {
+    public:
+        explicit ReplicationServer(const ReplicationSettings& settings = {});
+
+        /**
+         * @brief Add a client
+         * @return Connection index
+         */
+        size_t AddConnection(std::unique_ptr<NetTransport> transport);
+
+        /**
+         * @brief Read acks and, at SendRate, send a snapshot to every client
+         */
+        void Update(Scene* scene, float dt);
+
+        void SetSettings(const ReplicationSettings& settings) { m_Settings = settings; }
+        const ReplicationSettings& GetSettings() const { return m_Settings; }
+        const ReplicationStats& GetStats() const { return m_Stats; }
+        const ReplicationSchema& GetSchema() const { return m_Schema; }
+
+    private:
+        struct SentState {
+            uint32_t Tick = 0;
+            ReplicationState State;
+        };
+
+        struct Connection {
+            std::unique_ptr<NetTransport> Transport;
+            uint32_t AckedTick = 0;
+            glm::vec3 View{ 0.0f };
+            std::deque<SentState> History;
+            std::unordered_map<uint32_t, float> Priority;   ///< Accumulated while not sent
+        };
+
+        struct Candidate {
+            uint32_t NetId;
+            float Priority;
+        };
+
+        void ReceiveAcks(Connection& connection);
+        void Capture(entt::registry& registry);
+        void SendSnapshot(Connection& connection);
+
+        ReplicationSettings m_Settings;
+        ReplicationSchema m_Schema;
+        std::vector<Connection> m_Connections;
+
+        ReplicationState m_Current;
+        std::unordered_map<uint32_t, glm::vec3> m_Positions;
+        std::unordered_map<uint32_t, float> m_Weights;
+
+        std::vector<Candidate> m_Candidates;
+        std::vector<uint8_t> m_Packet;
+        std::vector<uint8_t> m_Record;
+
+        uint32_t m_Tick = 0;
+        uint32_t m_NextNetId = 1;
+        float m_Accumulator = 0.0f;
+        ReplicationStats m_Stats;
+    };
+
+    /**
+     * @brief Receives snapshots and mirrors them into a scene
+     * @details Entities are created on first sight, updated property by property
+     *          and destroyed when they leave the server's (relevant) state. Only
+     *          the newest snapshot received in a frame is applied.
+     */
+    class ReplicationClient {
+    public:
+        explicit ReplicationClient(std::unique_ptr<NetTransport> transport);
+
+        void Update(Scene* scene);
+
+        /**
+         * @brief Where this client looks from (sent with acks, drives relevancy)
+         */
+        void SetViewPosition(const glm::vec3& position) { m_View = position; }
+
+        /**
+         * @brief Local entity for a NetId (entt::null if not replicated here)
+         */
+        entt::entity FindEntity(uint32_t netId) const;
+
+        uint32_t GetLastTick() const { return m_LastTick; }
+        const ReplicationStats& GetStats() const { return m_Stats; }
+
+    private:
+        struct ReceivedState {
+            uint32_t Tick = 0;
+            ReplicationState State;
+        };
+
+        bool ReadSnapshot(const std::vector<uint8_t>& packet);
+        void ApplyState(Scene* scene, const ReplicationState& state);
+        void SendAck();
+
+        std::unique_ptr<NetTransport> m_Transport;
+        ReplicationSchema m_Schema;
+        std::deque<ReceivedState> m_History;
+        ReplicationState m_Applied;
+        std::unordered_map<uint32_t, entt::entity> m_Entities;
+        std::vector<uint8_t> m_Packet;
+
+        glm::vec3 m_View{ 0.0f };
+        uint32_t m_LastTick = 0;
+        bool m_HasNewState = false;
+        bool m_WarnedSchema = false;
+        ReplicationStats m_Stats;
+    };
+
+} // namespace Engine
+
+#endif // __REPLICATION_H__
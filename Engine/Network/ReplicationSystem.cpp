@@ -0,0 +1,38 @@
+/**
+ * @file ReplicationSystem.cpp
+ * @brief Replication driver system
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "ReplicationSystem.h"
+#include "../World/WorldStreamingSystem.h"
+
+namespace Engine {
+
+    ReplicationSystem::ReplicationSystem(std::unique_ptr<ReplicationServer> server)
+        : m_Server(std::move(server)) {
+    }
+
+    ReplicationSystem::ReplicationSystem(std::unique_ptr<ReplicationClient> client)
+        : m_Client(std::move(client)) {
+    }
+
+    void ReplicationSystem::OnUpdate(Scene* scene, Timestep ts) {
+        if (m_Server) {
+            m_Server->Update(scene, ts.GetSeconds());
+            return;
+        }
+
+        if (m_Client) {
+            glm::vec3 view;
+            if (WorldStreamingSystem::FindFocus(scene, view))
+                m_Client->SetViewPosition(view);
+            m_Client->Update(scene);
+        }
+    }
+
+} // namespace Engine
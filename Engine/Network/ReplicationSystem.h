@@ -0,0 +1,51 @@
+/**
+ * @file ReplicationSystem.h
+ * @brief Drives a ReplicationServer or ReplicationClient from the scene update
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+#ifndef __REPLICATION_SYSTEM_H__
+#define __REPLICATION_SYSTEM_H__
+
+#include <memory>
+
+#include "../ECS/System.h"
+#include "Replication.h"
+
+namespace Engine {
+
+    /**
+     * @brief Sends or receives replicated state every frame
+     * @details As a server it runs late (after simulation and transforms) so the
+     *          snapshot holds this frame's results. As a client it runs first so
+     *          received state is transformed and drawn in the same frame; the
+     *          client's view position is its listener or camera.
+     */
+    class ReplicationSystem : public System {
+    public:
+        explicit ReplicationSystem(std::unique_ptr<ReplicationServer> server);
+        explicit ReplicationSystem(std::unique_ptr<ReplicationClient> client);
+
+        void OnUpdate(Scene* scene, Timestep ts) override;
+        int  GetPriority() const override { return m_Server ? 95 : 0; }
+        const char* GetName() const override { return "ReplicationSystem"; }
+
+        bool IsServer() const { return m_Server != nullptr; }
+        ReplicationServer* GetServer() { return m_Server.get(); }
+        ReplicationClient* GetClient() { return m_Client.get(); }
+
+        const ReplicationStats& GetStats() const { return m_Server ? m_Server->GetStats() : m_Client->GetStats(); }
+
+    private:
+        std::unique_ptr<ReplicationServer> m_Server;
+        std::unique_ptr<ReplicationClient> m_Client;
+    };
+
+} // namespace Engine
+
+#endif // __REPLICATION_SYSTEM_H__
@@ -0,0 +1,244 @@
+/**
+ * @file Transport.cpp
+ * @brief Loopback and UDP datagram transports
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Transport.h"
+#include "../Utility/Logger.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+
+namespace Engine {
+
+    namespace {
+        /// Largest datagram accepted; replication packets stay well below it
+        constexpr size_t MAX_DATAGRAM = 2048;
+
+#ifdef _WIN32
+        using SocketType = SOCKET;
+
+        bool StartSockets() {
+            static bool started = [] {
+                WSADATA data;
+                return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+            }();
+            return started;
+        }
+
+        void CloseSocket(SocketType socket) { closesocket(socket); }
+
+        bool WouldBlock() {
+            int error = WSAGetLastError();
+            return error == WSAEWOULDBLOCK || error == WSAECONNRESET;
+        }
+
+        bool SetNonBlocking(SocketType socket) {
+            u_long mode = 1;
+            return ioctlsocket(socket, FIONBIO, &mode) == 0;
+        }
+#else
+        using SocketType = int;
+
+        bool StartSockets() { return true; }
+
+        void CloseSocket(SocketType socket) { close(socket); }
+
+        bool WouldBlock() {
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == ECONNREFUSED;
+        }
+
+        bool SetNonBlocking(SocketType socket) {
+            int flags = fcntl(socket, F_GETFL, 0);
+            return flags >= 0 && fcntl(socket, F_SETFL, flags | O_NONBLOCK) == 0;
+        }
+#endif
+
+        static_assert(sizeof(sockaddr_in) <= 32, "peer storage too small");
+    }
+
+    // ===== LOOPBACK =====
+
+    std::pair<std::unique_ptr<LoopbackTransport>, std::unique_ptr<LoopbackTransport>> LoopbackTransport::CreatePair() {
+        auto aToB = std::make_shared<Channel>();
+        auto bToA = std::make_shared<Channel>();
+
+        std::unique_ptr<LoopbackTransport> a(new LoopbackTransport(bToA, aToB));
+        std::unique_ptr<LoopbackTransport> b(new LoopbackTransport(aToB, bToA));
+        return { std::move(a), std::move(b) };
+    }
+
+    bool LoopbackTransport::Send(const uint8_t* data, size_t size) {
+        if (m_PacketLoss > 0.0f) {
+            // xorshift32, fixed seed so lossy runs are reproducible
+            m_Random ^= m_Random << 13;
+            m_Random ^= m_Random >> 17;
+            m_Random ^= m_Random << 5;
+            if (static_cast<float>(m_Random) / 4294967296.0f < m_PacketLoss)
+                return true;    // silently lost, like a real network
+        }
+
+        std::lock_guard<std::mutex> lock(m_Outgoing->Mutex);
+        m_Outgoing->Packets.emplace_back(data, data + size);
+        return true;
+    }
+
+    bool LoopbackTransport::Receive(std::vector<uint8_t>& out) {
+        std::lock_guard<std::mutex> lock(m_Incoming->Mutex);
+        if (m_Incoming->Packets.empty())
+            return false;
+
+        out = std::move(m_Incoming->Packets.front());
+        m_Incoming->Packets.pop_front();
+        return true;
+    }
+
+    // ===== UDP =====
+
+    UdpTransport::UdpTransport() = default;
+
+    UdpTransport::~UdpTransport() {
+        Close();
+    }
+
+    bool UdpTransport::Open() {
+        Close();
+
+        if (!StartSockets()) {
+            LOG_ERROR("UdpTransport: socket library failed to start");
+            return false;
+        }
+
+        SocketType socket = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (static_cast<intptr_t>(socket) == INVALID) {
+            LOG_ERROR("UdpTransport: failed to create socket");
+            return false;
+        }
+
+        if (!SetNonBlocking(socket)) {
+            LOG_ERROR("UdpTransport: failed to make socket non-blocking");
+            CloseSocket(socket);
+            return false;
+        }
+
+        m_Socket = static_cast<intptr_t>(socket);
+        return true;
+    }
+
+    bool UdpTransport::Listen(uint16_t port) {
+        if (!Open())
+            return false;
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(port);
+
+        if (bind(static_cast<SocketType>(m_Socket), reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            LOG_ERROR("UdpTransport: failed to bind port ", port);
+            Close();
+            return false;
+        }
+
+        m_HasPeer = false;
+        LOG_INFO("UdpTransport: listening on port ", port);
+        return true;
+    }
+
+    bool UdpTransport::Connect(const std::string& host, uint16_t port) {
+        if (!Open())
+            return false;
+
+        addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_DGRAM;
+
+        addrinfo* result = nullptr;
+        if (getaddrinfo(host.c_str(), nullptr, &hints, &result) != 0 || !result) {
+            LOG_ERROR("UdpTransport: cannot resolve host ", host);
+            Close();
+            return false;
+        }
+
+        sockaddr_in address{};
+        std::memcpy(&address, result->ai_addr, sizeof(address));
+        address.sin_port = htons(port);
+        freeaddrinfo(result);
+
+        std::memcpy(m_Peer, &address, sizeof(address));
+        m_HasPeer = true;
+        LOG_INFO("UdpTransport: sending to ", host, ":", port);
+        return true;
+    }
+
+    void UdpTransport::Close() {
+        if (m_Socket != INVALID) {
+            CloseSocket(static_cast<SocketType>(m_Socket));
+            m_Socket = INVALID;
+        }
+        m_HasPeer = false;
+    }
+
+    bool UdpTransport::Send(const uint8_t* data, size_t size) {
+        if (m_Socket == INVALID || !m_HasPeer || size > MAX_DATAGRAM)
+            return false;
+
+        auto sent = sendto(static_cast<SocketType>(m_Socket), reinterpret_cast<const char*>(data),
+            static_cast<int>(size), 0, reinterpret_cast<const sockaddr*>(m_Peer), sizeof(sockaddr_in));
+        return sent == static_cast<decltype(sent)>(size);
+    }
+
+    bool UdpTransport::Receive(std::vector<uint8_t>& out) {
+        if (m_Socket == INVALID)
+            return false;
+
+        out.resize(MAX_DATAGRAM);
+        sockaddr_in from{};
+        socklen_t fromSize = sizeof(from);
+
+        while (true) {
+            auto received = recvfrom(static_cast<SocketType>(m_Socket), reinterpret_cast<char*>(out.data()),
+                static_cast<int>(out.size()), 0, reinterpret_cast<sockaddr*>(&from), &fromSize);
+
+            if (received < 0) {
+                if (!WouldBlock())
+                    LOG_WARNING("UdpTransport: receive failed");
+                out.clear();
+                return false;
+            }
+
+            if (!m_HasPeer) {
+                std::memcpy(m_Peer, &from, sizeof(from));
+                m_HasPeer = true;
+                LOG_INFO("UdpTransport: peer connected");
+            }
+            else if (std::memcmp(m_Peer, &from, sizeof(from)) != 0) {
+                continue;   // only one peer per transport
+            }
+
+            out.resize(static_cast<size_t>(received));
+            return true;
+        }
+    }
+
+} // namespace Engine
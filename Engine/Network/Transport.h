@@ -0,0 +1,126 @@
+/**
+ * @file Transport.h
+ * @brief Unreliable datagram transports for replication
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+#ifndef __TRANSPORT_H__
+#define __TRANSPORT_H__
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+
+    /**
+     * @brief One end of an unreliable, unordered datagram link
+     * @details Packets may be dropped, duplicated or reordered; replication copes
+     *          with all three. Send and Receive never block.
+     */
+    class NetTransport {
+    public:
+        virtual ~NetTransport() = default;
+
+        /**
+         * @brief Queue a datagram to the peer
+         * @return False if the transport is closed or the packet was rejected
+         */
+        virtual bool Send(const uint8_t* data, size_t size) = 0;
+
+        /**
+         * @brief Pop the next received datagram
+         * @return False if nothing is pending
+         */
+        virtual bool Receive(std::vector<uint8_t>& out) = 0;
+
+        virtual bool IsOpen() const = 0;
+    };
+
+    /**
+     * @brief In-process transport pair, for running server and client in one process
+     * @details Optional packet loss lets tests exercise the baseline/ack logic
+     *          without a network. Drops use a fixed-seed generator so runs repeat.
+     */
+    class LoopbackTransport : public NetTransport {
+    public:
+        /**
+         * @brief Create two connected ends (first sends to second and vice versa)
+         */
+        static std::pair<std::unique_ptr<LoopbackTransport>, std::unique_ptr<LoopbackTransport>> CreatePair();
+
+        bool Send(const uint8_t* data, size_t size) override;
+        bool Receive(std::vector<uint8_t>& out) override;
+        bool IsOpen() const override { return true; }
+
+        /**
+         * @brief Fraction of packets sent from this end that are dropped (0..1)
+         */
+        void SetPacketLoss(float loss) { m_PacketLoss = loss; }
+
+    private:
+        struct Channel {
+            std::mutex Mutex;
+            std::deque<std::vector<uint8_t>> Packets;
+        };
+
+        LoopbackTransport(std::shared_ptr<Channel> incoming, std::shared_ptr<Channel> outgoing)
+            : m_Incoming(std::move(incoming)), m_Outgoing(std::move(outgoing)) {}
+
+        std::shared_ptr<Channel> m_Incoming;
+        std::shared_ptr<Channel> m_Outgoing;
+        float m_PacketLoss = 0.0f;
+        uint32_t m_Random = 0x9E3779B9u;
+    };
+
+    /**
+     * @brief Non-blocking UDP socket talking to a single peer
+     * @details The listening side learns its peer from the first datagram it
+     *          receives, so a server only serves one client per transport.
+     */
+    class UdpTransport : public NetTransport {
+    public:
+        UdpTransport();
+        ~UdpTransport() override;
+
+        UdpTransport(const UdpTransport&) = delete;
+        UdpTransport& operator=(const UdpTransport&) = delete;
+
+        /**
+         * @brief Bind to a local port and wait for a peer
+         */
+        bool Listen(uint16_t port);
+
+        /**
+         * @brief Open a socket that sends to host:port
+         */
+        bool Connect(const std::string& host, uint16_t port);
+
+        void Close();
+
+        bool Send(const uint8_t* data, size_t size) override;
+        bool Receive(std::vector<uint8_t>& out) override;
+        bool IsOpen() const override { return m_Socket != INVALID; }
+
+    private:
+        static constexpr intptr_t INVALID = -1;
+
+        bool Open();
+
+        intptr_t m_Socket = INVALID;
+        uint8_t m_Peer[32] = {};        ///< sockaddr_in of the peer
+        bool m_HasPeer = false;
+    };
+
+} // namespace Engine
+
+#endif // __TRANSPORT_H__
@@ -0,0 +1,162 @@
+/**
+ * @file ParticleData.h
+ * @brief Particle pools, simulation parameters and draw lists
+ * @details Particles are stored structure-of-arrays so the update kernels stream
+ *          each attribute and process four particles per SSE instruction. Nothing
+ *          in here touches OpenGL, so pools can be simulated, sorted and checked
+ *          without a context.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace Engine {
+
+    /// Particles per SIMD lane group; pool capacities are rounded up to a multiple of it
+    inline constexpr std::uint32_t PARTICLE_SIMD_WIDTH = 4;
+
+    /// Bounds of the depth sort's bucket count; the largest keeps one range's counters in L2
+    inline constexpr std::uint32_t PARTICLE_SORT_MIN_BUCKETS = 256;
+    inline constexpr std::uint32_t PARTICLE_SORT_MAX_BUCKETS = 1u << 14;
+
+    /// Per-particle attributes of a pool: nine float arrays, then Color
+    inline constexpr std::uint32_t PARTICLE_ATTRIBUTE_COUNT = 10;
+
+    /**
+     * @brief Live particles of one emitter, structure-of-arrays
+     * @details Particles [0, Count) are in use. Dead particles are removed by
+     *          swapping the last one into their slot, so order is not stable.
+     *          Capacity is fixed by Reserve; spawning never reallocates.
+     */
+    struct ParticlePool {
+        std::vector<float> PosX, PosY, PosZ;
+        std::vector<float> VelX, VelY, VelZ;
+        std::vector<float> Age;                 ///< Seconds since spawn
+        std::vector<float> InvLifetime;         ///< 1 / lifetime; dead once Age * InvLifetime >= 1
+        std::vector<float> Size;                ///< Billboard size, from size over life
+        std::vector<std::uint32_t> Color;       ///< RGBA8 (red in the lowest byte), from color over life
+
+        // Sorting scratch, reused between frames
+        std::vector<float> Depth;
+        std::vector<std::uint32_t> Order;       ///< Particle index per draw position, far to near
+        std::vector<std::uint32_t> SortKeys;
+        std::vector<std::uint32_t> SortCounts;  ///< Bucket counters of a single-range sort
+
+        std::uint32_t Count = 0;
+        std::uint32_t Capacity = 0;
+
+        /**
+         * @brief Resize every attribute for capacity particles (rounded up to the SIMD width)
+         * @details Live particles past the new capacity are dropped.
+         */
+        void Reserve(std::uint32_t capacity) {
+            capacity = (capacity + PARTICLE_SIMD_WIDTH - 1u) / PARTICLE_SIMD_WIDTH * PARTICLE_SIMD_WIDTH;
+            for (std::vector<float>* a : { &PosX, &PosY, &PosZ, &VelX, &VelY, &VelZ, &Age, &InvLifetime, &Size, &Depth }) {
+                a->resize(capacity);
+            }
+            for (std::vector<std::uint32_t>* a : { &Color, &Order, &SortKeys }) {
+                a->resize(capacity);
+            }
+            Capacity = capacity;
+            if (Count > Capacity) Count = Capacity;
+        }
+
+        void Clear() { Count = 0; }
+    };
+
+    /**
+     * @brief Nearest and farthest view depth of a set of particles
+     */
+    struct ParticleDepthSpan {
+        float Near = std::numeric_limits<float>::max();
+        float Far = std::numeric_limits<float>::lowest();
+
+        void Merge(const ParticleDepthSpan& other) {
+            Near = std::min(Near, other.Near);
+            Far = std::max(Far, other.Far);
+        }
+    };
+
+    /**
+     * @brief Collision plane: points p with dot(Normal, p) < Offset are inside and pushed out
+     */
+    struct ParticlePlane {
+        glm::vec3 Normal = glm::vec3(0.0f, 1.0f, 0.0f);    ///< Unit length
+        float Offset = 0.0f;
+    };
+
+    /**
+     * @brief Everything the update kernel needs for one emitter and step
+     */
+    struct ParticleSimParams {
+        float DeltaTime = 0.0f;
+        glm::vec3 Gravity = glm::vec3(0.0f);
+        float Drag = 0.0f;                      ///< Fraction of velocity lost per second
+
+        const ParticlePlane* Planes = nullptr;
+        std::uint32_t PlaneCount = 0;
+        float Restitution = 0.5f;               ///< Normal velocity kept after a bounce
+
+        glm::vec4 StartColor = glm::vec4(1.0f);
+        glm::vec4 EndColor = glm::vec4(1.0f);
+        float StartSize = 1.0f;
+        float EndSize = 1.0f;
+    };
+
+    /**
+     * @brief Initial state of newly spawned particles
+     */
+    struct ParticleSpawnParams {
+        glm::vec3 Origin = glm::vec3(0.0f);
+        float Radius = 0.0f;                    ///< Spawn inside a sphere of this radius
+        glm::vec3 Velocity = glm::vec3(0.0f);
+        float Spread = 0.0f;                    ///< Random velocity added per axis, +-m/s
+        float LifetimeMin = 1.0f;
+        float LifetimeMax = 1.0f;
+        glm::vec4 Color = glm::vec4(1.0f);
+        float Size = 1.0f;
+    };
+
+    /**
+     * @brief Per-instance vertex data of one billboard
+     */
+    struct ParticleInstance {
+        glm::vec3 Position;
+        float Size;
+        std::uint32_t Color;                    ///< RGBA8
+    };
+
+    /**
+     * @brief Instance range of one emitter, drawn with one instanced draw
+     */
+    struct ParticleBatch {
+        std::uint32_t First = 0;
+        std::uint32_t Count = 0;
+        bool Additive = false;
+    };
+
+    /**
+     * @brief Every emitter's billboards of a frame, sorted back to front per emitter
+     */
+    struct ParticleDrawList {
+        std::vector<ParticleInstance> Instances;
+        std::vector<ParticleBatch> Batches;
+
+        void Clear() {
+            Instances.clear();
+            Batches.clear();
+        }
+    };
+
+} // namespace Engine
@@ -0,0 +1,416 @@
+/**
+ * @file ParticleKernels.cpp
+ * @brief Particle spawning, simulation, compaction, depth sorting and instance output
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "ParticleKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PARTICLES_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace Engine {
+
+    namespace Particles {
+
+        namespace {
+
+            /**
+             * @brief Small, fast, seedable generator (PCG-style xorshift-multiply)
+             */
+            struct Random {
+                std::uint64_t State;
+
+                explicit Random(std::uint64_t seed) : State(seed * 0x9E3779B97F4A7C15ull + 0x632BE59BD9B4E019ull) {}
+
+                std::uint32_t Next() {
+                    State ^= State >> 12;
+                    State ^= State << 25;
+                    State ^= State >> 27;
+                    return static_cast<std::uint32_t>((State * 0x2545F4914F6CDD1Dull) >> 32);
+                }
+
+                /// Uniform in [0, 1)
+                float Unit() { return static_cast<float>(Next() >> 8) * (1.0f / 16777216.0f); }
+
+                /// Uniform in [-1, 1)
+                float Signed() { return Unit() * 2.0f - 1.0f; }
+            };
+
+            /**
+             * @brief One particle of the update kernel, shared by the scalar path and SIMD tails
+             */
+            void SimulateOne(ParticlePool& pool, std::uint32_t i, const ParticleSimParams& params) {
+                const float dt = params.DeltaTime;
+                const float damping = std::max(0.0f, 1.0f - params.Drag * dt);
+
+                const float age = pool.Age[i] + dt;
+                pool.Age[i] = age;
+
+                glm::vec3 v(pool.VelX[i], pool.VelY[i], pool.VelZ[i]);
+                v = v * damping + params.Gravity * dt;
+                glm::vec3 p = glm::vec3(pool.PosX[i], pool.PosY[i], pool.PosZ[i]) + v * dt;
+
+                for (std::uint32_t k = 0; k < params.PlaneCount; ++k) {
+                    const ParticlePlane& plane = params.Planes[k];
+                    const float d = glm::dot(plane.Normal, p) - plane.Offset;
+                    if (d < 0.0f) {
+                        p -= plane.Normal * d;
+                        const float vn = glm::dot(plane.Normal, v);
+                        if (vn < 0.0f) {
+                            v -= plane.Normal * ((1.0f + params.Restitution) * vn);
+                        }
+                    }
+                }
+
+                pool.PosX[i] = p.x; pool.PosY[i] = p.y; pool.PosZ[i] = p.z;
+                pool.VelX[i] = v.x; pool.VelY[i] = v.y; pool.VelZ[i] = v.z;
+
+                const float t = std::clamp(age * pool.InvLifetime[i], 0.0f, 1.0f);
+                pool.Size[i] = params.StartSize + (params.EndSize - params.StartSize) * t;
+                pool.Color[i] = PackColor(params.StartColor + (params.EndColor - params.StartColor) * t);
+            }
+
+        } // namespace
+
+        std::uint32_t PackColor(const glm::vec4& color) {
+            const glm::vec4 c = glm::clamp(color, glm::vec4(0.0f), glm::vec4(1.0f)) * 255.0f + 0.5f;
+            return static_cast<std::uint32_t>(c.r) | (static_cast<std::uint32_t>(c.g) << 8) |
+                (static_cast<std::uint32_t>(c.b) << 16) | (static_cast<std::uint32_t>(c.a) << 24);
+        }
+
+        void Spawn(ParticlePool& pool, std::uint32_t begin, std::uint32_t end,
+            const ParticleSpawnParams& params, std::uint32_t seed) {
+            end = std::min(end, pool.Capacity);
+            Random rng((static_cast<std::uint64_t>(seed) << 32) | begin);
+
+            const std::uint32_t color = PackColor(params.Color);
+            const float lifetimeRange = std::max(0.0f, params.LifetimeMax - params.LifetimeMin);
+
+            for (std::uint32_t i = begin; i < end; ++i) {
+                glm::vec3 offset(0.0f);
+                if (params.Radius > 0.0f) {
+                    // Rejection sample the unit ball
+                    do {
+                        offset = glm::vec3(rng.Signed(), rng.Signed(), rng.Signed());
+                    } while (glm::dot(offset, offset) > 1.0f);
+                    offset *= params.Radius;
+                }
+                const glm::vec3 p = params.Origin + offset;
+                const glm::vec3 v = params.Velocity +
+                    glm::vec3(rng.Signed(), rng.Signed(), rng.Signed()) * params.Spread;
+                const float lifetime = std::max(1e-3f, params.LifetimeMin + rng.Unit() * lifetimeRange);
+
+                pool.PosX[i] = p.x; pool.PosY[i] = p.y; pool.PosZ[i] = p.z;
+                pool.VelX[i] = v.x; pool.VelY[i] = v.y; pool.VelZ[i] = v.z;
+                pool.Age[i] = 0.0f;
+                pool.InvLifetime[i] = 1.0f / lifetime;
+                pool.Size[i] = params.Size;
+                pool.Color[i] = color;
+            }
+        }
+
+        void SimulateScalar(ParticlePool& pool, std::uint32_t begin, std::uint32_t end, const ParticleSimParams& params) {
+            end = std::min(end, pool.Capacity);
+            for (std::uint32_t i = begin; i < end; ++i) {
+                SimulateOne(pool, i, params);
+            }
+        }
+
+#if defined(PARTICLES_SSE)
+
+        void Simulate(ParticlePool& pool, std::uint32_t begin, std::uint32_t end, const ParticleSimParams& params) {
+            end = std::min(end, pool.Capacity);
+            const std::uint32_t simdEnd = begin + (end > begin ? (end - begin) / 4u * 4u : 0u);
+
+            const __m128 dt = _mm_set1_ps(params.DeltaTime);
+            const __m128 damping = _mm_set1_ps(std::max(0.0f, 1.0f - params.Drag * params.DeltaTime));
+            const __m128 gx = _mm_set1_ps(params.Gravity.x * params.DeltaTime);
+            const __m128 gy = _mm_set1_ps(params.Gravity.y * params.DeltaTime);
+            const __m128 gz = _mm_set1_ps(params.Gravity.z * params.DeltaTime);
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 bounce = _mm_set1_ps(1.0f + params.Restitution);
+
+            const __m128 size0 = _mm_set1_ps(params.StartSize);
+            const __m128 sizeD = _mm_set1_ps(params.EndSize - params.StartSize);
+
+            // Colors in [0, 255] so the lerp result converts straight to bytes
+            const glm::vec4 c0 = glm::clamp(params.StartColor, glm::vec4(0.0f), glm::vec4(1.0f)) * 255.0f;
+            const glm::vec4 c1 = glm::clamp(params.EndColor, glm::vec4(0.0f), glm::vec4(1.0f)) * 255.0f;
+            const __m128 r0 = _mm_set1_ps(c0.r), rD = _mm_set1_ps(c1.r - c0.r);
+            const __m128 g0 = _mm_set1_ps(c0.g), gD = _mm_set1_ps(c1.g - c0.g);
+            const __m128 b0 = _mm_set1_ps(c0.b), bD = _mm_set1_ps(c1.b - c0.b);
+            const __m128 a0 = _mm_set1_ps(c0.a), aD = _mm_set1_ps(c1.a - c0.a);
+
+            float* px = pool.PosX.data(); float* py = pool.PosY.data(); float* pz = pool.PosZ.data();
+            float* vx = pool.VelX.data(); float* vy = pool.VelY.data(); float* vz = pool.VelZ.data();
+            float* ages = pool.Age.data();
+            const float* invLife = pool.InvLifetime.data();
+            float* sizes = pool.Size.data();
+            std::uint32_t* colors = pool.Color.data();
+
+            for (std::uint32_t i = begin; i < simdEnd; i += 4) {
+                const __m128 age = _mm_add_ps(_mm_loadu_ps(ages + i), dt);
+                _mm_storeu_ps(ages + i, age);
+
+                // Drag, then gravity, then explicit Euler on position
+                __m128 velX = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vx + i), damping), gx);
+                __m128 velY = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vy + i), damping), gy);
+                __m128 velZ = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vz + i), damping), gz);
+                __m128 posX = _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(velX, dt));
+                __m128 posY = _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(velY, dt));
+                __m128 posZ = _mm_add_ps(_mm_loadu_ps(pz + i), _mm_mul_ps(velZ, dt));
+
+                // Planes: push penetrating particles back to the surface and reflect
+                // the approaching part of their velocity; lanes outside are masked off
+                for (std::uint32_t k = 0; k < params.PlaneCount; ++k) {
+                    const ParticlePlane& plane = params.Planes[k];
+                    const __m128 nx = _mm_set1_ps(plane.Normal.x);
+                    const __m128 ny = _mm_set1_ps(plane.Normal.y);
+                    const __m128 nz = _mm_set1_ps(plane.Normal.z);
+
+                    __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, posX), _mm_mul_ps(ny, posY)), _mm_mul_ps(nz, posZ));
+                    d = _mm_sub_ps(d, _mm_set1_ps(plane.Offset));
+                    const __m128 inside = _mm_cmplt_ps(d, zero);
+                    if (_mm_movemask_ps(inside) == 0) continue;
+
+                    const __m128 push = _mm_and_ps(inside, d);
+                    posX = _mm_sub_ps(posX, _mm_mul_ps(nx, push));
+                    posY = _mm_sub_ps(posY, _mm_mul_ps(ny, push));
+                    posZ = _mm_sub_ps(posZ, _mm_mul_ps(nz, push));
+
+                    const __m128 vn = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, velX), _mm_mul_ps(ny, velY)), _mm_mul_ps(nz, velZ));
+                    const __m128 hit = _mm_and_ps(inside, _mm_cmplt_ps(vn, zero));
+                    const __m128 reflect = _mm_and_ps(hit, _mm_mul_ps(bounce, vn));
+                    velX = _mm_sub_ps(velX, _mm_mul_ps(nx, reflect));
+                    velY = _mm_sub_ps(velY, _mm_mul_ps(ny, reflect));
+                    velZ = _mm_sub_ps(velZ, _mm_mul_ps(nz, reflect));
+                }
+
+                _mm_storeu_ps(px + i, posX); _mm_storeu_ps(py + i, posY); _mm_storeu_ps(pz + i, posZ);
+                _mm_storeu_ps(vx + i, velX); _mm_storeu_ps(vy + i, velY); _mm_storeu_ps(vz + i, velZ);
+
+                // Size and color over life
+                const __m128 t = _mm_min_ps(_mm_max_ps(_mm_mul_ps(age, _mm_loadu_ps(invLife + i)), zero), one);
+                _mm_storeu_ps(sizes + i, _mm_add_ps(size0, _mm_mul_ps(sizeD, t)));
+
+                const __m128i r = _mm_cvtps_epi32(_mm_add_ps(r0, _mm_mul_ps(rD, t)));
+                const __m128i g = _mm_cvtps_epi32(_mm_add_ps(g0, _mm_mul_ps(gD, t)));
+                const __m128i b = _mm_cvtps_epi32(_mm_add_ps(b0, _mm_mul_ps(bD, t)));
+                const __m128i a = _mm_cvtps_epi32(_mm_add_ps(a0, _mm_mul_ps(aD, t)));
+                const __m128i rgba = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)),
+                    _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(a, 24)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(colors + i), rgba);
+            }
+
+            for (std::uint32_t i = simdEnd; i < end; ++i) {
+                SimulateOne(pool, i, params);
+            }
+        }
+
+        ParticleDepthSpan ComputeDepths(ParticlePool& pool, std::uint32_t begin, std::uint32_t end,
+            const glm::vec3& eye, const glm::vec3& forward) {
+            const std::uint32_t simdEnd = begin + (end - begin) / 4u * 4u;
+
+            const __m128 fx = _mm_set1_ps(forward.x);
+            const __m128 fy = _mm_set1_ps(forward.y);
+            const __m128 fz = _mm_set1_ps(forward.z);
+            const __m128 bias = _mm_set1_ps(glm::dot(forward, eye));
+            __m128 nearest = _mm_set1_ps(std::numeric_limits<float>::max());
+            __m128 farthest = _mm_set1_ps(std::numeric_limits<float>::lowest());
+
+            for (std::uint32_t i = begin; i < simdEnd; i += 4) {
+                __m128 d = _mm_mul_ps(fx, _mm_loadu_ps(pool.PosX.data() + i));
+                d = _mm_add_ps(d, _mm_mul_ps(fy, _mm_loadu_ps(pool.PosY.data() + i)));
+                d = _mm_add_ps(d, _mm_mul_ps(fz, _mm_loadu_ps(pool.PosZ.data() + i)));
+                d = _mm_sub_ps(d, bias);
+                _mm_storeu_ps(pool.Depth.data() + i, d);
+                nearest = _mm_min_ps(nearest, d);
+                farthest = _mm_max_ps(farthest, d);
+            }
+
+            alignas(16) float lanes[2][4];
+            _mm_store_ps(lanes[0], nearest);
+            _mm_store_ps(lanes[1], farthest);
+            ParticleDepthSpan span;
+            for (int k = 0; k < 4; ++k) {
+                span.Near = std::min(span.Near, lanes[0][k]);
+                span.Far = std::max(span.Far, lanes[1][k]);
+            }
+
+            for (std::uint32_t i = simdEnd; i < end; ++i) {
+                const float d = glm::dot(forward, glm::vec3(pool.PosX[i], pool.PosY[i], pool.PosZ[i]) - eye);
+                pool.Depth[i] = d;
+                span.Near = std::min(span.Near, d);
+                span.Far = std::max(span.Far, d);
+            }
+            return span;
+        }
+
+        bool HasSimdParticles() { return true; }
+
+#else
+
+        void Simulate(ParticlePool& pool, std::uint32_t begin, std::uint32_t end, const ParticleSimParams& params) {
+            SimulateScalar(pool, begin, end, params);
+        }
+
+        ParticleDepthSpan ComputeDepths(ParticlePool& pool, std::uint32_t begin, std::uint32_t end,
+            const glm::vec3& eye, const glm::vec3& forward) {
+            ParticleDepthSpan span;
+            for (std::uint32_t i = begin; i < end; ++i) {
+                const float d = glm::dot(forward, glm::vec3(pool.PosX[i], pool.PosY[i], pool.PosZ[i]) - eye);
+                pool.Depth[i] = d;
+                span.Near = std::min(span.Near, d);
+                span.Far = std::max(span.Far, d);
+            }
+            return span;
+        }
+
+        bool HasSimdParticles() { return false; }
+
+#endif
+
+        std::uint32_t Compact(ParticlePool& pool) {
+            const std::uint32_t before = pool.Count;
+            std::uint32_t count = before;
+
+            std::uint32_t i = 0;
+            while (i < count) {
+                if (pool.Age[i] * pool.InvLifetime[i] < 1.0f) {
+                    ++i;
+                    continue;
+                }
+
+                // Dead: move the last particle here and check it next
+                const std::uint32_t last = --count;
+                if (i != last) {
+                    pool.PosX[i] = pool.PosX[last]; pool.PosY[i] = pool.PosY[last]; pool.PosZ[i] = pool.PosZ[last];
+                    pool.VelX[i] = pool.VelX[last]; pool.VelY[i] = pool.VelY[last]; pool.VelZ[i] = pool.VelZ[last];
+                    pool.Age[i] = pool.Age[last];
+                    pool.InvLifetime[i] = pool.InvLifetime[last];
+                    pool.Size[i] = pool.Size[last];
+                    pool.Color[i] = pool.Color[last];
+                }
+            }
+
+            pool.Count = count;
+            return before - count;
+        }
+
+        std::uint32_t SortBucketCount(std::uint32_t count) {
+            std::uint32_t buckets = PARTICLE_SORT_MIN_BUCKETS;
+            while (buckets < PARTICLE_SORT_MAX_BUCKETS && buckets < count * 4u) {
+                buckets <<= 1;
+            }
+            return buckets;
+        }
+
+        void CountSortKeys(ParticlePool& pool, std::uint32_t begin, std::uint32_t end,
+            const ParticleDepthSpan& span, std::uint32_t buckets, std::uint32_t* counts) {
+            const float last = static_cast<float>(buckets - 1u);
+            const float scale = span.Far > span.Near ? last / (span.Far - span.Near) : 0.0f;
+            const float* depth = pool.Depth.data();
+            std::uint32_t* keys = pool.SortKeys.data();
+
+            for (std::uint32_t i = begin; i < end; ++i) {
+                // Far first; clamped so rounding stays in range and NaN lands in bucket 0
+                const float t = std::min((span.Far - depth[i]) * scale, last);
+                const std::uint32_t key = t > 0.0f ? static_cast<std::uint32_t>(t) : 0u;
+                keys[i] = key;
+                ++counts[key];
+            }
+        }
+
+        void PrefixSortCounts(std::uint32_t* counts, std::uint32_t buckets, std::uint32_t rangeCount) {
+            // Bucket-major, then range order: keeps the sort stable across ranges
+            std::uint32_t sum = 0;
+            for (std::uint32_t b = 0; b < buckets; ++b) {
+                for (std::uint32_t r = 0; r < rangeCount; ++r) {
+                    std::uint32_t& slot = counts[r * buckets + b];
+                    const std::uint32_t n = slot;
+                    slot = sum;
+                    sum += n;
+                }
+            }
+        }
+
+        void ScatterSortKeys(ParticlePool& pool, std::uint32_t begin, std::uint32_t end, std::uint32_t* offsets) {
+            const std::uint32_t* keys = pool.SortKeys.data();
+            std::uint32_t* order = pool.Order.data();
+            for (std::uint32_t i = begin; i < end; ++i) {
+                order[offsets[keys[i]]++] = i;
+            }
+        }
+
+        void SortBackToFront(ParticlePool& pool, const ParticleDepthSpan& span) {
+            const std::uint32_t buckets = SortBucketCount(pool.Count);
+            pool.SortCounts.assign(buckets, 0u);
+            CountSortKeys(pool, 0, pool.Count, span, buckets, pool.SortCounts.data());
+            PrefixSortCounts(pool.SortCounts.data(), buckets, 1);
+            ScatterSortKeys(pool, 0, pool.Count, pool.SortCounts.data());
+        }
+
+        void WriteInstances(const ParticlePool& pool, const std::uint32_t* order, std::uint32_t begin, std::uint32_t end,
+            ParticleInstance* out) {
+            for (std::uint32_t k = begin; k < end; ++k) {
+                const std::uint32_t i = order ? order[k] : k;
+                out[k].Position = glm::vec3(pool.PosX[i], pool.PosY[i], pool.PosZ[i]);
+                out[k].Size = pool.Size[i];
+                out[k].Color = pool.Color[i];
+            }
+        }
+
+        namespace {
+            constexpr std::vector<float> ParticlePool::* FLOAT_ATTRIBUTES[PARTICLE_ATTRIBUTE_COUNT - 1] = {
+                &ParticlePool::PosX, &ParticlePool::PosY, &ParticlePool::PosZ,
+                &ParticlePool::VelX, &ParticlePool::VelY, &ParticlePool::VelZ,
+                &ParticlePool::Age, &ParticlePool::InvLifetime, &ParticlePool::Size,
+            };
+
+            template <typename T>
+            void Gather(const T* src, const std::uint32_t* order, std::uint32_t begin, std::uint32_t end, T* dst) {
+                for (std::uint32_t k = begin; k < end; ++k) {
+                    dst[k] = src[order[k]];
+                }
+            }
+        }
+
+        void GatherAttribute(ParticlePool& pool, std::uint32_t attribute, std::uint32_t begin, std::uint32_t end) {
+            if (attribute < PARTICLE_ATTRIBUTE_COUNT - 1) {
+                Gather((pool.*FLOAT_ATTRIBUTES[attribute]).data(), pool.Order.data(), begin, end, pool.Depth.data());
+            }
+            else {
+                Gather(pool.Color.data(), pool.Order.data(), begin, end, pool.SortKeys.data());
+            }
+        }
+
+        void SwapGathered(ParticlePool& pool, std::uint32_t attribute) {
+            if (attribute < PARTICLE_ATTRIBUTE_COUNT - 1) {
+                (pool.*FLOAT_ATTRIBUTES[attribute]).swap(pool.Depth);
+            }
+            else {
+                pool.Color.swap(pool.SortKeys);
+            }
+        }
+
+        void ApplyOrder(ParticlePool& pool) {
+            for (std::uint32_t a = 0; a < PARTICLE_ATTRIBUTE_COUNT; ++a) {
+                GatherAttribute(pool, a, 0, pool.Count);
+                SwapGathered(pool, a);
+            }
+        }
+    }
+
+} // namespace Engine
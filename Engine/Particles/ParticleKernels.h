@@ -0,0 +1,142 @@
+/**
+ * @file ParticleKernels.h
+ * @brief Particle spawning, simulation, compaction, depth sorting and instance output
+ * @details Stateless building blocks used by ParticleSystem. Spawn and Simulate work
+ *          on index ranges, so one pool can be split across worker threads as long as
+ *          the ranges do not overlap. Per emitter and frame:
+ *          Simulate (live range) + Spawn (new range) -> Compact, then at draw time
+ *          ComputeDepths -> SortBackToFront -> WriteInstances in pool.Order. A large
+ *          pool is sorted in ranges instead: ComputeDepths and CountSortKeys per range,
+ *          PrefixSortCounts once, then ScatterSortKeys and WriteInstances per range.
+ *          Every few frames ApplyOrder moves the pool itself into draw order.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "ParticleData.h"
+
+namespace Engine {
+
+    namespace Particles {
+
+        /**
+         * @brief Pack a [0, 1] color as RGBA8 (red in the lowest byte)
+         */
+        std::uint32_t PackColor(const glm::vec4& color);
+
+        /**
+         * @brief Initialize particles [begin, end) of a pool
+         * @param seed Random stream; the same seed and range always produce the same particles
+         */
+        void Spawn(ParticlePool& pool, std::uint32_t begin, std::uint32_t end,
+            const ParticleSpawnParams& params, std::uint32_t seed);
+
+        /**
+         * @brief Step particles [begin, end): age, gravity and drag, plane collisions,
+         *        then color and size over life
+         * @details SSE, four particles at a time; a remainder of fewer than four is
+         *          stepped one at a time, so nothing outside [begin, end) is touched.
+         */
+        void Simulate(ParticlePool& pool, std::uint32_t begin, std::uint32_t end, const ParticleSimParams& params);
+
+        /**
+         * @brief Reference implementation of Simulate, one particle at a time
+         */
+        void SimulateScalar(ParticlePool& pool, std::uint32_t begin, std::uint32_t end, const ParticleSimParams& params);
+
+        /**
+         * @brief Whether Simulate and ComputeDepths use SSE in this build
+         */
+        bool HasSimdParticles();
+
+        /**
+         * @brief Remove dead particles by moving the last live particle into their slots
+         * @return Number of particles removed
+         */
+        std::uint32_t Compact(ParticlePool& pool);
+
+        /**
+         * @brief View depth of particles [begin, end) into pool.Depth
+         * @param eye Camera position
+         * @param forward Unit view direction
+         * @return Nearest and farthest depth of the range
+         */
+        ParticleDepthSpan ComputeDepths(ParticlePool& pool, std::uint32_t begin, std::uint32_t end,
+            const glm::vec3& eye, const glm::vec3& forward);
+
+        /**
+         * @brief Sort buckets for count particles: about four per particle, so few
+         *        share one, within [PARTICLE_SORT_MIN_BUCKETS, PARTICLE_SORT_MAX_BUCKETS]
+         */
+        std::uint32_t SortBucketCount(std::uint32_t count);
+
+        /**
+         * @brief Bucket of particles [begin, end) into pool.SortKeys, counted into counts
+         * @param span Depth span of the whole pool (every range merged)
+         * @param buckets SortBucketCount(pool.Count)
+         * @param counts buckets zeroed counters of this range
+         */
+        void CountSortKeys(ParticlePool& pool, std::uint32_t begin, std::uint32_t end,
+            const ParticleDepthSpan& span, std::uint32_t buckets, std::uint32_t* counts);
+
+        /**
+         * @brief Turn the counters of consecutive ranges into each range's first slot per bucket
+         * @param counts rangeCount arrays of buckets counters, in range order
+         */
+        void PrefixSortCounts(std::uint32_t* counts, std::uint32_t buckets, std::uint32_t rangeCount);
+
+        /**
+         * @brief Place particles [begin, end) into pool.Order
+         * @param offsets This range's counters after PrefixSortCounts; advanced as slots fill
+         */
+        void ScatterSortKeys(ParticlePool& pool, std::uint32_t begin, std::uint32_t end, std::uint32_t* offsets);
+
+        /**
+         * @brief Order live particles far to near by pool.Depth into pool.Order, on this thread
+         * @details One stable counting-sort pass over depths quantized linearly across
+         *          span. Particles closer than span / SortBucketCount keep pool order,
+         *          which is invisible on billboards. The pool itself is not reordered;
+         *          see ApplyOrder.
+         * @param span ComputeDepths result for [0, pool.Count)
+         */
+        void SortBackToFront(ParticlePool& pool, const ParticleDepthSpan& span);
+
+        /**
+         * @brief Write billboards [begin, end) of the draw order to out[begin, end)
+         * @param order Particle index per instance, or nullptr for pool order
+         * @param out At least end instances
+         */
+        void WriteInstances(const ParticlePool& pool, const std::uint32_t* order, std::uint32_t begin, std::uint32_t end,
+            ParticleInstance* out);
+
+        /**
+         * @brief Gather attribute [begin, end) of the draw order into scratch
+         * @details Depth holds a float attribute and SortKeys holds Color, so call after
+         *          the frame's instances are written. Ranges may run on different threads.
+         * @param attribute Below PARTICLE_ATTRIBUTE_COUNT
+         */
+        void GatherAttribute(ParticlePool& pool, std::uint32_t attribute, std::uint32_t begin, std::uint32_t end);
+
+        /**
+         * @brief Swap a fully gathered attribute into the pool
+         */
+        void SwapGathered(ParticlePool& pool, std::uint32_t attribute);
+
+        /**
+         * @brief Permute every attribute into pool.Order, on this thread
+         * @details Particles move little between frames and the sort is stable, so a pool
+         *          left in draw order keeps the next frames' order close to sequential and
+         *          WriteInstances reads memory mostly in order. Too costly to run every
+         *          frame; the order goes stale and is rebuilt by the next sort.
+         */
+        void ApplyOrder(ParticlePool& pool);
+    }
+
+} // namespace Engine
@@ -0,0 +1,405 @@
+/**
+ * @file ParticleSystem.cpp
+ * @brief Particle effects - spawning, simulation, depth sorting and draw lists
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "ParticleSystem.h"
+#include "ParticleKernels.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/JobSystem.h>
+
+#include <tracy/Tracy.hpp>
+
+#include "../Core/CVar.h"
+#include "../ECS/SimulationLOD.h"
+#include "../Physics/PhysicsSystem.h"
+
+namespace Engine {
+
+    // Particles per job; big enough to amortize a job, small enough that one large
+    // emitter still spreads across every worker
+    static CVar<int> sParticleBatchSize("particles.BatchSize", 16384, 256, 1 << 20,
+        "Particles per job when spawning, simulating and sorting");
+
+    // Reordering a pool costs a few sorts but keeps the following frames' instance
+    // writes close to sequential; emitters take turns so the cost is spread out
+    static CVar<int> sParticleReorderInterval("particles.ReorderInterval", 4, 0, 240,
+        "Frames between moving a sorted emitter's pool into draw order (0 = never)");
+
+    namespace {
+
+        /**
+         * @brief Rotation part of a world matrix, without its scale
+         */
+        glm::mat3 ExtractRotation(const glm::mat4& world) {
+            glm::mat3 rotation(world);
+            for (int c = 0; c < 3; ++c) {
+                const float len = glm::length(rotation[c]);
+                rotation[c] = len > 0.0f ? rotation[c] / len : glm::vec3(0.0f);
+            }
+            return rotation;
+        }
+
+        std::uint32_t HashSeed(std::uint32_t entity, std::uint32_t frame) {
+            std::uint32_t h = entity * 0x9E3779B1u ^ (frame + 0x7F4A7C15u) * 0x85EBCA6Bu;
+            h ^= h >> 16;
+            h *= 0x7FEB352Du;
+            h ^= h >> 15;
+            return h;
+        }
+
+    } // namespace
+
+    void ParticleSystem::OnInit(Scene* scene) {
+        // Optional: without physics everything runs on this thread
+        m_PhysicsSystem = scene ? scene->GetSystem<PhysicsSystem>() : nullptr;
+    }
+
+    void ParticleSystem::OnShutdown(Scene* scene) {
+        (void)scene;
+        m_Staged.clear();
+        m_Planes.clear();
+        m_Ranges.clear();
+        m_DrawEmitters.clear();
+        m_DrawRanges.clear();
+        m_SortEmitters.clear();
+        m_SortRanges.clear();
+        m_SortCounts.clear();
+        m_ReorderEmitters.clear();
+        m_ReorderRanges.clear();
+        m_PhysicsSystem = nullptr;
+    }
+
+    void ParticleSystem::Dispatch(const char* name, std::uint32_t count, const std::function<void(std::uint32_t)>& fn) {
+        JPH::JobSystem* jobs = m_PhysicsSystem ? m_PhysicsSystem->GetJobSystem() : nullptr;
+        if (count <= 1u || !jobs) {
+            for (std::uint32_t i = 0; i < count; ++i) {
+                fn(i);
+            }
+            return;
+        }
+
+        JPH::JobSystem::Barrier* barrier = jobs->CreateBarrier();
+        for (std::uint32_t i = 0; i < count; ++i) {
+            JPH::JobHandle job = jobs->CreateJob(name, JPH::Color::sOrange, [&fn, i]() { fn(i); });
+            barrier->AddJob(job);
+        }
+        jobs->WaitForJobs(barrier);
+        jobs->DestroyBarrier(barrier);
+    }
+
+    /**
+     * @brief Update all emitters for this frame
+     * @details
+     * 1) Stage emitters: pools, spawn counts and parameters (main thread).
+     * 2) Simulate live ranges and spawn new ranges in parallel; they never overlap.
+     * 3) Compact every pool in parallel, one job per emitter.
+     */
+    void ParticleSystem::OnUpdate(Scene* scene, Timestep ts) {
+        if (!scene || !IsEnabled()) return;
+        ZoneScopedN("Particles");
+
+        const float dt = ts.GetSeconds();
+        auto& reg = scene->GetRegistry();
+        ++m_Frame;
+
+        m_Staged.clear();
+        m_Planes.clear();
+        m_Ranges.clear();
+
+        std::uint32_t spawned = 0;
+
+        reg.view<TransformComponent, ParticleEmitterComponent>(entt::exclude<InactiveComponent>).each(
+            [&](entt::entity e, TransformComponent& transform, ParticleEmitterComponent& emitter) {
+                // A copied component (duplicate, pooled prefab defaults) must not share live particles
+                if (!emitter.Pool || emitter.Pool.use_count() > 1) {
+                    emitter.Pool = std::make_shared<ParticlePool>();
+                }
+                ParticlePool& pool = *emitter.Pool;
+
+                const std::uint32_t capacity = std::max(1u, emitter.MaxParticles);
+                if (pool.Capacity < capacity || pool.Capacity >= capacity + PARTICLE_SIMD_WIDTH) {
+                    pool.Reserve(capacity);
+                }
+
+                const SimulationLODComponent* lod = reg.try_get<SimulationLODComponent>(e);
+                if (!SimulationLOD::ShouldTick(lod)) return;
+                const float step = SimulationLOD::TickDelta(lod, dt);
+
+                std::uint32_t spawnCount = 0;
+                if (emitter.Emitting) {
+                    emitter.SpawnAccumulator += std::max(0.0f, emitter.Rate) * step;
+                    const float whole = std::floor(emitter.SpawnAccumulator);
+                    emitter.SpawnAccumulator -= whole;
+                    spawnCount = static_cast<std::uint32_t>(whole);
+                    if (!emitter.BurstDone) {
+                        spawnCount += emitter.Burst;
+                        emitter.BurstDone = true;
+                    }
+                }
+                else {
+                    emitter.SpawnAccumulator = 0.0f;
+                    emitter.BurstDone = false;
+                }
+                spawnCount = std::min(spawnCount, capacity - std::min(capacity, pool.Count));
+
+                if (pool.Count == 0 && spawnCount == 0) return;
+
+                StagedEmitter staged;
+                staged.Pool = &pool;
+                staged.LiveCount = pool.Count;
+                staged.SpawnCount = spawnCount;
+                staged.Seed = HashSeed(static_cast<std::uint32_t>(e), m_Frame);
+
+                staged.Sim.DeltaTime = step;
+                staged.Sim.Gravity = emitter.Gravity;
+                staged.Sim.Drag = std::max(0.0f, emitter.Drag);
+                staged.Sim.Restitution = std::clamp(emitter.Restitution, 0.0f, 1.0f);
+                staged.Sim.StartColor = emitter.StartColor;
+                staged.Sim.EndColor = emitter.EndColor;
+                staged.Sim.StartSize = emitter.StartSize;
+                staged.Sim.EndSize = emitter.EndSize;
+
+                staged.FirstPlane = static_cast<std::uint32_t>(m_Planes.size());
+                if (emitter.Collide) {
+                    const float len = glm::length(emitter.CollisionNormal);
+                    if (len > 0.0f) {
+                        m_Planes.push_back({ emitter.CollisionNormal / len, emitter.CollisionOffset / len });
+                    }
+                    m_Planes.insert(m_Planes.end(), m_CollisionPlanes.begin(), m_CollisionPlanes.end());
+                }
+                staged.Sim.PlaneCount = static_cast<std::uint32_t>(m_Planes.size()) - staged.FirstPlane;
+
+                const glm::mat4& world = transform.WorldTransform;
+                staged.Spawn.Origin = glm::vec3(world[3]);
+                staged.Spawn.Radius = std::max(0.0f, emitter.SpawnRadius);
+                staged.Spawn.Velocity = ExtractRotation(world) * emitter.Velocity;
+                staged.Spawn.Spread = std::max(0.0f, emitter.Spread);
+                staged.Spawn.LifetimeMin = emitter.LifetimeMin;
+                staged.Spawn.LifetimeMax = std::max(emitter.LifetimeMin, emitter.LifetimeMax);
+                staged.Spawn.Color = emitter.StartColor;
+                staged.Spawn.Size = emitter.StartSize;
+
+                // Reserve the new slots now; the spawn jobs fill them
+                pool.Count += spawnCount;
+                spawned += spawnCount;
+                m_Staged.push_back(staged);
+            }
+        );
+
+        const auto start = std::chrono::steady_clock::now();
+
+        // Cut every emitter into ranges; chunk starts stay on SIMD groups
+        const std::uint32_t chunk = std::max(PARTICLE_SIMD_WIDTH,
+            static_cast<std::uint32_t>(sParticleBatchSize.Get()) / PARTICLE_SIMD_WIDTH * PARTICLE_SIMD_WIDTH);
+        for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(m_Staged.size()); ++i) {
+            StagedEmitter& staged = m_Staged[i];
+            staged.Sim.Planes = staged.Sim.PlaneCount > 0 ? m_Planes.data() + staged.FirstPlane : nullptr;
+
+            for (std::uint32_t b = 0; b < staged.LiveCount; b += chunk) {
+                m_Ranges.push_back({ i, b, std::min(staged.LiveCount, b + chunk), false });
+            }
+            const std::uint32_t spawnEnd = staged.LiveCount + staged.SpawnCount;
+            for (std::uint32_t b = staged.LiveCount; b < spawnEnd; b += chunk) {
+                m_Ranges.push_back({ i, b, std::min(spawnEnd, b + chunk), true });
+            }
+        }
+
+        Dispatch("ParticleUpdate", static_cast<std::uint32_t>(m_Ranges.size()), [this](std::uint32_t r) {
+            const WorkRange& range = m_Ranges[r];
+            StagedEmitter& staged = m_Staged[range.Emitter];
+            if (range.Spawn) {
+                Particles::Spawn(*staged.Pool, range.Begin, range.End, staged.Spawn, staged.Seed);
+            }
+            else {
+                Particles::Simulate(*staged.Pool, range.Begin, range.End, staged.Sim);
+            }
+        });
+
+        std::atomic<std::uint32_t> killed{ 0 };
+        Dispatch("ParticleCompact", static_cast<std::uint32_t>(m_Staged.size()), [this, &killed](std::uint32_t i) {
+            killed.fetch_add(Particles::Compact(*m_Staged[i].Pool), std::memory_order_relaxed);
+        });
+
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::uint32_t alive = 0;
+        for (const StagedEmitter& staged : m_Staged) {
+            alive += staged.Pool->Count;
+        }
+
+        m_Stats.Emitters = static_cast<std::uint32_t>(m_Staged.size());
+        m_Stats.Alive = alive;
+        m_Stats.Spawned = spawned;
+        m_Stats.Killed = killed.load(std::memory_order_relaxed);
+        m_Stats.Jobs = static_cast<std::uint32_t>(m_Ranges.size());
+        m_Stats.SimulateMs = ms;
+        m_Stats.ParticlesPerMs = ms > 0.0 ? static_cast<double>(alive) / ms : 0.0;
+    }
+
+    /**
+     * @brief Build the frame's billboards
+     * @details Emitters with a single range are sorted and written by one job each.
+     *          Larger sorted emitters are split across jobs phase by phase: depths,
+     *          key counts per range, one prefix per emitter, scatter, then instances.
+     *          Sorted emitters due a reorder then gather their pools attribute by attribute.
+     */
+    void ParticleSystem::BuildDrawList(Scene* scene, const glm::mat4& view, ParticleDrawList& out) {
+        // Instances are resized rather than cleared, so a stable particle count does not
+        // pay for constructing every element again each frame
+        out.Batches.clear();
+        m_DrawEmitters.clear();
+        m_DrawRanges.clear();
+        m_SortEmitters.clear();
+        m_SortRanges.clear();
+        m_ReorderEmitters.clear();
+        m_ReorderRanges.clear();
+        if (!scene) {
+            out.Instances.clear();
+            return;
+        }
+        ZoneScopedN("ParticleDrawList");
+
+        const auto start = std::chrono::steady_clock::now();
+
+        // Ranges are no smaller than a job's worth, and a sorted emitter gets no more
+        // ranges than can run at once, which bounds its bucket counters
+        JPH::JobSystem* jobs = m_PhysicsSystem ? m_PhysicsSystem->GetJobSystem() : nullptr;
+        const std::uint32_t maxRanges = jobs ? static_cast<std::uint32_t>(std::max(1, jobs->GetMaxConcurrency())) : 1u;
+        const std::uint32_t chunk = static_cast<std::uint32_t>(sParticleBatchSize.Get());
+        const std::uint32_t reorderInterval = static_cast<std::uint32_t>(sParticleReorderInterval.Get());
+        ++m_DrawFrame;
+
+        std::uint32_t total = 0;
+        scene->GetRegistry().view<ParticleEmitterComponent>(entt::exclude<InactiveComponent>).each(
+            [&](ParticleEmitterComponent& emitter) {
+                if (!emitter.Pool || emitter.Pool->Count == 0) return;
+
+                ParticleBatch batch;
+                batch.First = total;
+                batch.Count = emitter.Pool->Count;
+                batch.Additive = emitter.Additive;
+                out.Batches.push_back(batch);
+
+                DrawEmitter draw{ emitter.Pool.get(), total, emitter.SortByDepth && !emitter.Additive };
+                draw.FirstRange = static_cast<std::uint32_t>(m_DrawRanges.size());
+                draw.RangeCount = std::clamp(batch.Count / chunk, 1u, maxRanges);
+
+                const std::uint32_t emitterIndex = static_cast<std::uint32_t>(m_DrawEmitters.size());
+                for (std::uint32_t r = 0; r < draw.RangeCount; ++r) {
+                    const std::uint64_t begin = static_cast<std::uint64_t>(batch.Count) * r / draw.RangeCount;
+                    const std::uint64_t end = static_cast<std::uint64_t>(batch.Count) * (r + 1) / draw.RangeCount;
+                    m_DrawRanges.push_back({ emitterIndex, static_cast<std::uint32_t>(begin), static_cast<std::uint32_t>(end), {} });
+                    if (draw.Sort && draw.RangeCount > 1) {
+                        m_SortRanges.push_back(draw.FirstRange + r);
+                    }
+                }
+                if (draw.Sort && draw.RangeCount > 1) {
+                    m_SortEmitters.push_back(emitterIndex);
+                }
+                if (draw.Sort && reorderInterval > 0 && (m_DrawFrame + emitterIndex) % reorderInterval == 0) {
+                    m_ReorderEmitters.push_back(emitterIndex);
+                    for (std::uint32_t r = 0; r < draw.RangeCount; ++r) {
+                        m_ReorderRanges.push_back(draw.FirstRange + r);
+                    }
+                }
+
+                m_DrawEmitters.push_back(draw);
+                total += batch.Count;
+            }
+        );
+        out.Instances.resize(total);
+
+        // Camera position and view direction out of the view matrix
+        const glm::vec3 eye = glm::vec3(glm::inverse(view)[3]);
+        const glm::vec3 forward = -glm::vec3(view[0][2], view[1][2], view[2][2]);
+
+        Dispatch("ParticleSort", static_cast<std::uint32_t>(m_DrawRanges.size()), [&](std::uint32_t r) {
+            DrawRange& range = m_DrawRanges[r];
+            const DrawEmitter& draw = m_DrawEmitters[range.Emitter];
+            ParticlePool& pool = *draw.Pool;
+            ParticleInstance* instances = out.Instances.data() + draw.First;
+
+            if (!draw.Sort) {
+                Particles::WriteInstances(pool, nullptr, range.Begin, range.End, instances);
+            }
+            else if (draw.RangeCount == 1) {
+                Particles::SortBackToFront(pool, Particles::ComputeDepths(pool, 0, pool.Count, eye, forward));
+                Particles::WriteInstances(pool, pool.Order.data(), 0, pool.Count, instances);
+            }
+            else {
+                range.Span = Particles::ComputeDepths(pool, range.Begin, range.End, eye, forward);
+            }
+        });
+
+        if (!m_SortEmitters.empty()) {
+            std::uint32_t counters = 0;
+            for (std::uint32_t e : m_SortEmitters) {
+                DrawEmitter& draw = m_DrawEmitters[e];
+                draw.Span = ParticleDepthSpan{};
+                for (std::uint32_t r = 0; r < draw.RangeCount; ++r) {
+                    draw.Span.Merge(m_DrawRanges[draw.FirstRange + r].Span);
+                }
+                draw.Buckets = Particles::SortBucketCount(draw.Pool->Count);
+                draw.FirstCount = counters;
+                counters += draw.RangeCount * draw.Buckets;
+            }
+            m_SortCounts.assign(counters, 0u);
+
+            auto counts = [this](const DrawRange& range) {
+                const DrawEmitter& draw = m_DrawEmitters[range.Emitter];
+                return m_SortCounts.data() + draw.FirstCount + (&range - &m_DrawRanges[draw.FirstRange]) * draw.Buckets;
+            };
+
+            Dispatch("ParticleSortCount", static_cast<std::uint32_t>(m_SortRanges.size()), [&](std::uint32_t i) {
+                const DrawRange& range = m_DrawRanges[m_SortRanges[i]];
+                const DrawEmitter& draw = m_DrawEmitters[range.Emitter];
+                Particles::CountSortKeys(*draw.Pool, range.Begin, range.End, draw.Span, draw.Buckets, counts(range));
+            });
+
+            Dispatch("ParticleSortPrefix", static_cast<std::uint32_t>(m_SortEmitters.size()), [&](std::uint32_t i) {
+                const DrawEmitter& draw = m_DrawEmitters[m_SortEmitters[i]];
+                Particles::PrefixSortCounts(m_SortCounts.data() + draw.FirstCount, draw.Buckets, draw.RangeCount);
+            });
+
+            Dispatch("ParticleSortScatter", static_cast<std::uint32_t>(m_SortRanges.size()), [&](std::uint32_t i) {
+                const DrawRange& range = m_DrawRanges[m_SortRanges[i]];
+                Particles::ScatterSortKeys(*m_DrawEmitters[range.Emitter].Pool, range.Begin, range.End, counts(range));
+            });
+
+            Dispatch("ParticleInstances", static_cast<std::uint32_t>(m_SortRanges.size()), [&](std::uint32_t i) {
+                const DrawRange& range = m_DrawRanges[m_SortRanges[i]];
+                const DrawEmitter& draw = m_DrawEmitters[range.Emitter];
+                Particles::WriteInstances(*draw.Pool, draw.Pool->Order.data(), range.Begin, range.End,
+                    out.Instances.data() + draw.First);
+            });
+        }
+
+        // One attribute at a time, so the sort scratch is the only gather buffer
+        for (std::uint32_t a = 0; a < PARTICLE_ATTRIBUTE_COUNT && !m_ReorderEmitters.empty(); ++a) {
+            Dispatch("ParticleReorder", static_cast<std::uint32_t>(m_ReorderRanges.size()), [&](std::uint32_t i) {
+                const DrawRange& range = m_DrawRanges[m_ReorderRanges[i]];
+                Particles::GatherAttribute(*m_DrawEmitters[range.Emitter].Pool, a, range.Begin, range.End);
+            });
+            for (std::uint32_t e : m_ReorderEmitters) {
+                Particles::SwapGathered(*m_DrawEmitters[e].Pool, a);
+            }
+        }
+
+        m_Stats.Drawn = total;
+        m_Stats.SortMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+} // namespace Engine
@@ -0,0 +1,150 @@
+/**
+ * @file ParticleSystem.h
+ * @brief Particle effects - spawning, simulation, depth sorting and draw lists
+ * @details Emitters are components; their particles live in per-emitter SoA pools,
+ *          not in the registry. Each frame the emitters are staged on the main thread,
+ *          then every pool is cut into fixed-size ranges that are simulated (and the
+ *          new particles spawned) on the PhysicsSystem job system, inline without one.
+ *          Dead particles are compacted per emitter in a second round of jobs.
+ *          The RenderSystem asks for a draw list each frame, which sorts every emitter
+ *          back to front and lays out one instance range per emitter.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include "../ECS/Scene.h"
+#include "../ECS/System.h"
+#include "../ECS/Components.h"
+#include "ParticleData.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Engine {
+
+    class PhysicsSystem;
+
+    /**
+     * @brief Particle cost counters (last frame unless noted)
+     */
+    struct ParticleStats {
+        std::uint32_t Emitters = 0;         ///< Emitters updated
+        std::uint32_t Alive = 0;            ///< Particles alive after the update
+        std::uint32_t Spawned = 0;          ///< Particles spawned this frame
+        std::uint32_t Killed = 0;           ///< Particles that died this frame
+        std::uint32_t Jobs = 0;             ///< Ranges the update was split into
+        std::uint32_t Drawn = 0;            ///< Instances in the last draw list
+        double SimulateMs = 0.0;            ///< Wall time of spawn + simulate + compact
+        double SortMs = 0.0;                ///< Wall time of the last draw list (depth, sort, instances)
+        double ParticlesPerMs = 0.0;        ///< Alive / SimulateMs
+    };
+
+    /**
+     * @class ParticleSystem
+     * @brief ECS system that updates every ParticleEmitterComponent
+     */
+    class ParticleSystem final : public System {
+    public:
+        void OnInit(Scene* scene) override;
+        void OnUpdate(Scene* scene, Timestep ts) override;
+        void OnShutdown(Scene* scene) override;
+
+        int GetPriority() const override { return 30; }
+        const char* GetName() const override { return "ParticleSystem"; }
+
+        /**
+         * @brief Add a plane every emitter with Collide set also collides with (e.g. the ground)
+         */
+        void AddCollisionPlane(const ParticlePlane& plane) { m_CollisionPlanes.push_back(plane); }
+        void ClearCollisionPlanes() { m_CollisionPlanes.clear(); }
+
+        /**
+         * @brief Build the frame's billboards: one batch per emitter, sorted back to front
+         * @param scene Scene whose emitters to draw
+         * @param view Camera view matrix the sort depth is measured along
+         * @param out Cleared and filled
+         */
+        void BuildDrawList(Scene* scene, const glm::mat4& view, ParticleDrawList& out);
+
+        const ParticleStats& GetStats() const { return m_Stats; }
+
+    private:
+        /**
+         * @brief One emitter's work for this frame
+         */
+        struct StagedEmitter {
+            ParticlePool* Pool = nullptr;
+            ParticleSimParams Sim;
+            ParticleSpawnParams Spawn;
+            std::uint32_t FirstPlane = 0;   ///< Into m_Planes
+            std::uint32_t LiveCount = 0;    ///< Particles simulated
+            std::uint32_t SpawnCount = 0;   ///< Particles spawned after them
+            std::uint32_t Seed = 0;
+        };
+
+        /**
+         * @brief A range of one emitter's pool, simulated or spawned by one job
+         */
+        struct WorkRange {
+            std::uint32_t Emitter;
+            std::uint32_t Begin;
+            std::uint32_t End;
+            bool Spawn;
+        };
+
+        /**
+         * @brief One emitter of the draw list being built
+         */
+        struct DrawEmitter {
+            ParticlePool* Pool;
+            std::uint32_t First;            ///< First instance in the draw list
+            bool Sort;
+            std::uint32_t FirstRange;       ///< Into m_DrawRanges
+            std::uint32_t RangeCount;
+            std::uint32_t Buckets = 0;      ///< Sort buckets, when sorted in ranges
+            std::uint32_t FirstCount = 0;   ///< Into m_SortCounts, RangeCount * Buckets counters
+            ParticleDepthSpan Span;
+        };
+
+        /**
+         * @brief A range of one emitter's particles, sorted and written by one job
+         */
+        struct DrawRange {
+            std::uint32_t Emitter;
+            std::uint32_t Begin;
+            std::uint32_t End;
+            ParticleDepthSpan Span;
+        };
+
+        /**
+         * @brief Run fn(0..count-1) on the job system and wait, inline for one item or no jobs
+         */
+        void Dispatch(const char* name, std::uint32_t count, const std::function<void(std::uint32_t)>& fn);
+
+        PhysicsSystem* m_PhysicsSystem = nullptr;
+
+        std::vector<ParticlePlane> m_CollisionPlanes;
+
+        std::vector<StagedEmitter> m_Staged;
+        std::vector<ParticlePlane> m_Planes;        ///< Planes of all staged emitters
+        std::vector<WorkRange> m_Ranges;
+        std::vector<DrawEmitter> m_DrawEmitters;
+        std::vector<DrawRange> m_DrawRanges;
+        std::vector<std::uint32_t> m_SortEmitters;  ///< Emitters sorted across several ranges
+        std::vector<std::uint32_t> m_SortRanges;    ///< Their ranges
+        std::vector<std::uint32_t> m_SortCounts;
+        std::vector<std::uint32_t> m_ReorderEmitters; ///< Sorted emitters whose pool is put in draw order this frame
+        std::vector<std::uint32_t> m_ReorderRanges;   ///< Their ranges
+        std::uint32_t m_DrawFrame = 0;
+        std::uint32_t m_Frame = 0;
+
+        ParticleStats m_Stats;
+    };
+
+} // namespace Engine
@@ -0,0 +1,374 @@
+/*****************************************************************************/
+/*!
+\file       CharacterControllerSystem.cpp
+\date       2025
+\brief      Character controllers on Jolt CharacterVirtual:
+            - Agent lifecycle mirroring ECS (create/rebuild/release)
+            - Input staging on the main thread, movement in job batches
+            - Velocity model: ground velocity + desired horizontal speed,
+              jump on ground, gravity while airborne
+            - Transform/ground-state write back
+
+(C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+*/
+/*****************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/JobSystem.h>
+#include <Jolt/Physics/Collision/Shape/CapsuleShape.h>
+#include <Jolt/Physics/Collision/Shape/RotatedTranslatedShape.h>
+
+#include <tracy/Tracy.hpp>
+
+#include "CharacterControllerSystem.h"
+#include "PhysicsSystem.h"
+#include "../Core/CVar.h"
+#include "../Utility/Logger.h"
+
+namespace Engine
+{
+    /**************************************************************************
+     * @brief
+     * Batching tuning. Small batches balance better across workers; each
+     * batch owns a temp allocator, so the count also bounds memory use.
+     **************************************************************************/
+    static CVar<int> sCharacterBatchSize("phys.CharacterBatchSize", 32, 1, 4096,
+        "Characters per job when updating character controllers");
+    static CVar<int> sCharacterTempKB("phys.CharacterTempKB", 512, 64, 65536,
+        "Temp allocator size per character batch in KB", CVAR_RESTART);
+
+    /**************************************************************************
+     * @brief
+     * Vertical speed (relative to the ground) under which a grounded
+     * character is still considered to be moving towards the ground.
+     **************************************************************************/
+    static constexpr float GROUND_SEPARATION_SPEED = 0.1f;
+
+    /**************************************************************************
+     * @brief
+     * Map Jolt's ground state onto the component enum.
+     **************************************************************************/
+    static CharacterGroundState ToGroundState(JPH::CharacterBase::EGroundState s)
+    {
+        switch (s)
+        {
+        case JPH::CharacterBase::EGroundState::OnGround:      return CharacterGroundState::OnGround;
+        case JPH::CharacterBase::EGroundState::OnSteepGround: return CharacterGroundState::OnSteepGround;
+        case JPH::CharacterBase::EGroundState::NotSupported:  return CharacterGroundState::NotSupported;
+        default:                                              return CharacterGroundState::InAir;
+        }
+    }
+
+    /**************************************************************************
+     * @brief
+     * Locate the physics world. Characters need it for every query.
+     *
+     * @param scene
+     * Scene the system belongs to.
+     **************************************************************************/
+    void CharacterControllerSystem::OnInit(Scene *scene)
+    {
+        mPhysicsSystem = scene->GetSystem<PhysicsSystem>();
+        if (!mPhysicsSystem)
+        {
+            LOG_WARNING("CharacterControllerSystem: no PhysicsSystem in the scene, character controllers are disabled");
+            SetEnabled(false);
+        }
+    }
+
+    /**************************************************************************
+     * @brief
+     * Release all characters. Runs before PhysicsSystem::OnShutdown
+     * (reverse priority order) so the world is still alive.
+     **************************************************************************/
+    void CharacterControllerSystem::OnShutdown(Scene * /*scene*/)
+    {
+        mActive.clear();
+        mActiveIds.clear();
+        mAgents.clear();
+        mBatchAllocators.clear();
+        mPhysicsSystem = nullptr;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Move all characters for this frame.
+     *
+     * Pipeline per frame:
+     * 1) Match agents to current ECS (create/rebuild/release).
+     * 2) Stage input and settings per agent; detect teleports.
+     * 3) Update agents in batches on the job system and wait.
+     * 4) Write position, velocity and ground state back to ECS.
+     *
+     * @param scene
+     * Scene whose characters are updated.
+     * @param dt
+     * Delta time in seconds.
+     **************************************************************************/
+    void CharacterControllerSystem::OnUpdate(Scene *scene, Timestep dt)
+    {
+        if (!IsEnabled() || !mPhysicsSystem) return;
+        ZoneScopedN("CharacterControllers");
+
+        float const step = dt.GetSeconds();
+        if (step <= 0.0f) return;
+
+        RefreshAgents(scene);
+
+        auto &reg = scene->GetRegistry();
+
+        // Stage phase: copy everything jobs need out of the registry.
+        mActive.clear();
+        mActiveIds.clear();
+        reg.view<TransformComponent, CharacterControllerComponent>(entt::exclude<InactiveComponent>).each(
+            [&](EntityID e, TransformComponent &tc, CharacterControllerComponent &cc)
+            {
+                SimulationLODComponent const *lod = reg.try_get<SimulationLODComponent>(e);
+                if (!SimulationLOD::ShouldTick(lod)) return;
+                auto it = mAgents.find(e);
+                if (it == mAgents.end()) return;
+                Agent &agent = it->second;
+                JPH::CharacterVirtual &ch = *agent.character;
+
+                // Moved from code since last frame: teleport.
+                if (tc.Position != agent.lastPosition)
+                {
+                    ch.SetPosition(ToJPHRVec3(tc.Position));
+                    ch.SetLinearVelocity(JPH::Vec3::sZero());
+                }
+
+                ch.SetMaxSlopeAngle(glm::radians(cc.MaxSlopeAngle));
+                ch.SetMass(std::max(0.0001f, cc.Mass));
+                ch.SetMaxStrength(std::max(0.0f, cc.MaxStrength));
+
+                agent.update.mWalkStairsStepUp = JPH::Vec3(0.0f, std::max(0.0f, cc.StepHeight), 0.0f);
+                agent.update.mStickToFloorStepDown = JPH::Vec3(0.0f, -std::max(0.0f, cc.StickToFloorDistance), 0.0f);
+                agent.desiredVelocity = cc.DesiredVelocity;
+                agent.jumpSpeed = cc.JumpSpeed;
+                agent.jump = cc.Jump;
+                agent.useGravity = cc.UseGravity;
+                agent.step = SimulationLOD::TickDelta(lod, step);
+                cc.Jump = false;
+
+                mActive.push_back(&agent);
+                mActiveIds.push_back(e);
+            }
+        );
+
+        auto const start = std::chrono::steady_clock::now();
+
+        // Batched update. Queries only read the world (body pushes go through
+        // the locking BodyInterface), so batches are independent.
+        std::uint32_t const count = static_cast<std::uint32_t>(mActive.size());
+        std::uint32_t const batchSize = static_cast<std::uint32_t>(sCharacterBatchSize.Get());
+        std::uint32_t const batches = (count + batchSize - 1u) / batchSize;
+
+        while (mBatchAllocators.size() < batches)
+            mBatchAllocators.push_back(std::make_unique<JPH::TempAllocatorImpl>(std::uint32_t(sCharacterTempKB.Get()) * 1024u));
+
+        JPH::JobSystem *jobs = mPhysicsSystem->GetJobSystem();
+        if (batches == 1u || !jobs)
+        {
+            for (std::uint32_t b = 0; b < batches; ++b)
+            {
+                std::uint32_t const end = std::min(count, (b + 1u) * batchSize);
+                for (std::uint32_t i = b * batchSize; i < end; ++i)
+                    UpdateAgent(*mActive[i], mActive[i]->step, *mBatchAllocators[b]);
+            }
+        }
+        else if (batches > 1u)
+        {
+            JPH::JobSystem::Barrier *barrier = jobs->CreateBarrier();
+            for (std::uint32_t b = 0; b < batches; ++b)
+            {
+                std::uint32_t const begin = b * batchSize;
+                std::uint32_t const end = std::min(count, begin + batchSize);
+                JPH::TempAllocator *allocator = mBatchAllocators[b].get();
+                JPH::JobHandle job = jobs->CreateJob("CharacterBatch", JPH::Color::sGreen,
+                    [this, begin, end, allocator]()
+                    {
+                        for (std::uint32_t i = begin; i < end; ++i)
+                            UpdateAgent(*mActive[i], mActive[i]->step, *allocator);
+                    });
+                barrier->AddJob(job);
+            }
+            jobs->WaitForJobs(barrier);
+            jobs->DestroyBarrier(barrier);
+        }
+
+        double const ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        mStats.Characters = count;
+        mStats.Batches = batches;
+        mStats.UpdateMs = ms;
+        mStats.MicrosPerCharacter = count ? ms * 1000.0 / double(count) : 0.0;
+        mStats.PeakMs = std::max(mStats.PeakMs, ms);
+
+        // Pull phase: results back into ECS.
+        JPH::BodyInterface &bodies = mPhysicsSystem->GetJoltSystem().GetBodyInterface();
+        for (std::size_t i = 0; i < mActive.size(); ++i)
+        {
+            Agent &agent = *mActive[i];
+            JPH::CharacterVirtual const &ch = *agent.character;
+            auto &tc = reg.get<TransformComponent>(mActiveIds[i]);
+            auto &cc = reg.get<CharacterControllerComponent>(mActiveIds[i]);
+
+            JPH::RVec3 const p = ch.GetPosition();
+            tc.Position = glm::vec3(static_cast<float>(p.GetX()), static_cast<float>(p.GetY()), static_cast<float>(p.GetZ()));
+
+            // The inner body is teleported along and would otherwise fall
+            // asleep, and sleeping bodies are not tested against triggers.
+            if (tc.Position != agent.lastPosition && !ch.GetInnerBodyID().IsInvalid())
+                bodies.ActivateBody(ch.GetInnerBodyID());
+            agent.lastPosition = tc.Position;
+
+            cc.Velocity = ToGLM(ch.GetLinearVelocity());
+            cc.GroundState = ToGroundState(ch.GetGroundState());
+            cc.GroundNormal = ToGLM(ch.GetGroundNormal());
+        }
+    }
+
+    /**************************************************************************
+     * @brief
+     * Ensure agents exist exactly for eligible entities.
+     *
+     * Pooled (inactive) entities keep their agent so respawning is cheap;
+     * it is only skipped by the update. A changed Height/Radius rebuilds
+     * the character at its current position.
+     *
+     * @param scene
+     * Scene to scan.
+     **************************************************************************/
+    void CharacterControllerSystem::RefreshAgents(Scene *scene)
+    {
+        auto &reg = scene->GetRegistry();
+        mStats.Created = 0;
+
+        reg.view<TransformComponent, CharacterControllerComponent>().each(
+            [&](EntityID e, TransformComponent &tc, CharacterControllerComponent &cc)
+            {
+                auto it = mAgents.find(e);
+                if (it == mAgents.end())
+                {
+                    if (!CreateCharacter(mAgents[e], e, tc, cc)) mAgents.erase(e);
+                    return;
+                }
+                if (it->second.height != cc.Height || it->second.radius != cc.Radius)
+                    CreateCharacter(it->second, e, tc, cc);
+            }
+        );
+
+        for (auto it = mAgents.begin(); it != mAgents.end();)
+        {
+            if (reg.valid(it->first) && reg.all_of<TransformComponent, CharacterControllerComponent>(it->first))
+                ++it;
+            else
+                it = mAgents.erase(it);
+        }
+    }
+
+    /**************************************************************************
+     * @brief
+     * Build the capsule and CharacterVirtual for an entity.
+     *
+     * The capsule is offset upwards so the character position (and the
+     * Transform) sits at the feet. Contacts below the lower sphere's
+     * center count as support.
+     *
+     * @return
+     * False if the shape could not be built (agent left unchanged).
+     **************************************************************************/
+    bool CharacterControllerSystem::CreateCharacter(Agent &agent, EntityID e, TransformComponent const &tc, CharacterControllerComponent const &cc)
+    {
+        float const radius = std::max(0.01f, cc.Radius);
+        float const halfCylinder = std::max(0.0f, 0.5f * cc.Height - radius);
+
+        JPH::RefConst<JPH::Shape> capsule = new JPH::CapsuleShape(halfCylinder, radius);
+        JPH::RotatedTranslatedShapeSettings offset(JPH::Vec3(0.0f, halfCylinder + radius, 0.0f), JPH::Quat::sIdentity(), capsule);
+        JPH::ShapeSettings::ShapeResult result = offset.Create();
+        if (result.HasError())
+        {
+            LOG_ERROR("CharacterControllerSystem: failed to build capsule: ", result.GetError().c_str());
+            return false;
+        }
+
+        JPH::Ref<JPH::CharacterVirtualSettings> settings = new JPH::CharacterVirtualSettings();
+        settings->mShape = result.Get();
+        settings->mMaxSlopeAngle = glm::radians(cc.MaxSlopeAngle);
+        settings->mMass = std::max(0.0001f, cc.Mass);
+        settings->mMaxStrength = std::max(0.0f, cc.MaxStrength);
+        settings->mSupportingVolume = JPH::Plane(JPH::Vec3::sAxisY(), -radius);
+
+        // Kinematic twin of the capsule so trigger volumes see the character;
+        // its layer pairs with sensors only (see Layers::CHARACTER).
+        settings->mInnerBodyShape = settings->mShape;
+        settings->mInnerBodyLayer = Layers::CHARACTER;
+
+        // Keep the old position when rebuilding (the Transform may lag by a frame).
+        JPH::RVec3 const position = agent.character ? agent.character->GetPosition() : ToJPHRVec3(tc.Position);
+        JPH::Vec3 const velocity = agent.character ? agent.character->GetLinearVelocity() : JPH::Vec3::sZero();
+
+        agent.character = new JPH::CharacterVirtual(settings, position, JPH::Quat::sIdentity(),
+            static_cast<JPH::uint64>(entt::to_integral(e)), &mPhysicsSystem->GetJoltSystem());
+        agent.character->SetLinearVelocity(velocity);
+        agent.height = cc.Height;
+        agent.radius = cc.Radius;
+        agent.lastPosition = glm::vec3(static_cast<float>(position.GetX()), static_cast<float>(position.GetY()), static_cast<float>(position.GetZ()));
+        ++mStats.Created;
+        return true;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Compute the new velocity and move one character.
+     *
+     * Follows the usual CharacterVirtual recipe: inherit the ground's
+     * velocity while grounded (plus jump), keep the vertical speed while
+     * airborne, add gravity and the desired horizontal velocity, then let
+     * ExtendedUpdate resolve collisions, stairs and floor sticking.
+     **************************************************************************/
+    void CharacterControllerSystem::UpdateAgent(Agent &agent, float dt, JPH::TempAllocator &allocator) const
+    {
+        JPH::CharacterVirtual &ch = *agent.character;
+        JPH::PhysicsSystem &world = mPhysicsSystem->GetJoltSystem();
+
+        ch.UpdateGroundVelocity();
+
+        JPH::Vec3 const up = ch.GetUp();
+        JPH::Vec3 const verticalVelocity = up.Dot(ch.GetLinearVelocity()) * up;
+        JPH::Vec3 const groundVelocity = ch.GetGroundVelocity();
+        bool const towardsGround = (verticalVelocity - groundVelocity).Dot(up) < GROUND_SEPARATION_SPEED;
+
+        JPH::Vec3 velocity;
+        if (ch.GetGroundState() == JPH::CharacterBase::EGroundState::OnGround && towardsGround)
+        {
+            velocity = groundVelocity;
+            if (agent.jump)
+                velocity += agent.jumpSpeed * up;
+        }
+        else
+        {
+            velocity = verticalVelocity;
+        }
+
+        JPH::Vec3 const gravity = agent.useGravity ? world.GetGravity() : JPH::Vec3::sZero();
+        velocity += gravity * dt;
+
+        JPH::Vec3 desired = ToJPHVec3(agent.desiredVelocity);
+        desired -= up.Dot(desired) * up;
+        velocity += desired;
+
+        ch.SetLinearVelocity(velocity);
+
+        ch.ExtendedUpdate(dt, gravity, agent.update,
+            JPH::DefaultBroadPhaseLayerFilter(mPhysicsSystem->GetObjectVsBroadPhaseLayerFilter(), Layers::MOVING),
+            JPH::DefaultObjectLayerFilter(mPhysicsSystem->GetObjectLayerPairFilter(), Layers::MOVING),
+            JPH::BodyFilter(),
+            JPH::ShapeFilter(),
+            allocator);
+    }
+} // namespace Engine
@@ -0,0 +1,191 @@
+/*****************************************************************************/
+/*!
+\file       CharacterControllerSystem.h
+\date       2025
+\brief      Character controllers on Jolt CharacterVirtual.
+
+            Provides:
+            - One CharacterVirtual per (Transform, CharacterController) entity,
+              created, rebuilt on shape changes and released with the entity
+            - Per-frame movement with gravity, jumping, step-up, stick-to-floor
+              and slope limits (CharacterVirtual::ExtendedUpdate)
+            - Batched updates spread across the PhysicsSystem job system
+            - Update cost counters for crowd budgeting
+
+            Runs after PhysicsSystem so characters collide with this frame's
+            body poses. Characters do not collide with each other, which is
+            what allows the batches to run in parallel.
+
+(C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+*/
+/*****************************************************************************/
+#pragma once
+
+// --- STL (alphabetical) ---
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// --- glm (alphabetical) ---
+#include <glm/glm.hpp>
+
+// --- Jolt (alphabetical) ---
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/TempAllocator.h>
+#include <Jolt/Physics/Character/CharacterVirtual.h>
+
+// --- Engine (alphabetical) ---
+#include "../ECS/Components.h"
+#include "../ECS/Scene.h"
+#include "../ECS/System.h"
+
+namespace Engine
+{
+    class PhysicsSystem;
+
+    /**************************************************************************
+     * @brief
+     * Character update counters (last frame unless noted).
+     **************************************************************************/
+    struct CharacterControllerStats
+    {
+        std::uint32_t Characters{};        //!< Characters updated
+        std::uint32_t Batches{};           //!< Jobs the update was split into
+        std::uint32_t Created{};           //!< CharacterVirtuals created or rebuilt
+        double        UpdateMs{};          //!< Wall time of the batched update
+        double        MicrosPerCharacter{}; //!< UpdateMs / Characters, in microseconds
+        double        PeakMs{};            //!< Largest UpdateMs since start
+    };
+
+    /**************************************************************************
+     * @brief
+     * Moves CharacterControllerComponent entities through the physics world.
+     **************************************************************************/
+    class CharacterControllerSystem final : public System
+    {
+    public:
+        /**********************************************************************
+         * @brief
+         * System name for diagnostics.
+         **********************************************************************/
+        char const *GetName() const override { return "CharacterControllerSystem"; }
+
+        /**********************************************************************
+         * @brief
+         * Runs right after PhysicsSystem (10).
+         **********************************************************************/
+        int GetPriority() const override { return 11; }
+
+        /**********************************************************************
+         * @brief
+         * Find the PhysicsSystem; the system disables itself without one.
+         *
+         * @param scene
+         * Scene the system belongs to.
+         **********************************************************************/
+        void OnInit(Scene *scene) override;
+
+        /**********************************************************************
+         * @brief
+         * Create/release characters, move them and write back transforms.
+         *
+         * @param scene
+         * Scene whose characters are updated.
+         * @param dt
+         * Delta time wrapper.
+         **********************************************************************/
+        void OnUpdate(Scene *scene, Timestep dt) override;
+
+        /**********************************************************************
+         * @brief
+         * Release every character (before PhysicsSystem shuts down).
+         *
+         * @param scene
+         * Unused (kept for symmetry).
+         **********************************************************************/
+        void OnShutdown(Scene *scene) override;
+
+        /**********************************************************************
+         * @brief
+         * Update cost counters.
+         **********************************************************************/
+        CharacterControllerStats const &GetStats() const { return mStats; }
+
+    private:
+        using EntityID = entt::entity;
+
+        /**********************************************************************
+         * @brief
+         * Per-entity character plus the input staged for this frame, so
+         * batch jobs never touch the registry.
+         **********************************************************************/
+        struct Agent
+        {
+            JPH::Ref<JPH::CharacterVirtual> character;
+            float     height{};              //!< Shape the character was built with
+            float     radius{};
+            glm::vec3 lastPosition{};        //!< Position written back last frame (teleport detection)
+
+            // Staged input
+            JPH::CharacterVirtual::ExtendedUpdateSettings update;
+            glm::vec3 desiredVelocity{};
+            float     jumpSpeed{};
+            bool      jump{};
+            bool      useGravity{};
+            float     step{};                //!< Seconds to move this frame; longer on LOD-bucketed ticks
+        };
+
+        PhysicsSystem *mPhysicsSystem{};
+        std::unordered_map<EntityID, Agent> mAgents;
+
+        std::vector<Agent *>  mActive;       //!< Agents updated this frame, in batch order
+        std::vector<EntityID> mActiveIds;    //!< Entities matching mActive
+
+        std::vector<std::unique_ptr<JPH::TempAllocatorImpl>> mBatchAllocators;  //!< One per batch
+
+        CharacterControllerStats mStats;
+
+        /**********************************************************************
+         * @brief
+         * Create characters for new entities, rebuild those whose shape
+         * changed and drop those whose entity no longer qualifies.
+         *
+         * @param scene
+         * Scene to scan.
+         **********************************************************************/
+        void RefreshAgents(Scene *scene);
+
+        /**********************************************************************
+         * @brief
+         * Create (or rebuild) the CharacterVirtual for an entity.
+         *
+         * @param agent
+         * Agent to fill.
+         * @param e
+         * Entity identifier (stored as user data).
+         * @param tc
+         * Transform giving the start position.
+         * @param cc
+         * Controller settings.
+         * @return
+         * False if the shape could not be built.
+         **********************************************************************/
+        bool CreateCharacter(Agent &agent, EntityID e, TransformComponent const &tc, CharacterControllerComponent const &cc);
+
+        /**********************************************************************
+         * @brief
+         * Move one agent (called from job threads).
+         *
+         * @param agent
+         * Agent to move.
+         * @param dt
+         * Step in seconds.
+         * @param allocator
+         * Temp allocator owned by the calling batch.
+         **********************************************************************/
+        void UpdateAgent(Agent &agent, float dt, JPH::TempAllocator &allocator) const;
+    };
+} // namespace Engine
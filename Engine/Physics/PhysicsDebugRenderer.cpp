@@ -0,0 +1,50 @@
+/*****************************************************************************/
+/*!
+\file       PhysicsDebugRenderer.cpp
+\date       2025
+\brief      Jolt debug renderer feeding the engine's DebugDraw queues.
+
+(C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+*/
+/*****************************************************************************/
+
+#include "PhysicsDebugRenderer.h"
+
+#ifdef JPH_DEBUG_RENDERER
+
+#include "../Graphics/DebugDraw.h"
+
+namespace Engine
+{
+    /**************************************************************************
+     * @brief
+     * Jolt position to glm (double-precision builds are narrowed).
+     **************************************************************************/
+    static inline glm::vec3 ToGLMPosition(JPH::RVec3Arg p)
+    {
+        return glm::vec3(static_cast<float>(p.GetX()), static_cast<float>(p.GetY()), static_cast<float>(p.GetZ()));
+    }
+
+    /**************************************************************************
+     * @brief
+     * Queue a depth-tested line; Jolt's Color has DebugDraw's RGBA8 layout.
+     **************************************************************************/
+    void PhysicsDebugRenderer::DrawLine(JPH::RVec3Arg from, JPH::RVec3Arg to, JPH::ColorArg color)
+    {
+        DebugDraw::line(ToGLMPosition(from), ToGLMPosition(to), color.GetUInt32());
+    }
+
+    /**************************************************************************
+     * @brief
+     * Queue a text anchor.
+     **************************************************************************/
+    void PhysicsDebugRenderer::DrawText3D(JPH::RVec3Arg position, JPH::string_view const &text, JPH::ColorArg color, float height)
+    {
+        DebugDraw::text(ToGLMPosition(position), text, color.GetUInt32(), 0.0f, height);
+    }
+
+} // namespace Engine
+
+#endif // JPH_DEBUG_RENDERER
@@ -0,0 +1,47 @@
+/*****************************************************************************/
+/*!
+\file       PhysicsDebugRenderer.h
+\date       2025
+\brief      Jolt debug renderer feeding the engine's DebugDraw queues.
+
+            Provides:
+            - PhysicsDebugRenderer: a JPH::DebugRendererSimple whose lines and
+              text go to DebugDraw, so body shapes, constraints and bounds
+              drawn by Jolt show up in the renderer's debugging pass
+
+            Only available when Jolt is built with JPH_DEBUG_RENDERER (Debug
+            and Release configurations); elsewhere this header is empty.
+
+(C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+*/
+/*****************************************************************************/
+#pragma once
+
+// --- Jolt (alphabetical) ---
+#include <Jolt/Jolt.h>
+
+#ifdef JPH_DEBUG_RENDERER
+
+#include <Jolt/Renderer/DebugRendererSimple.h>
+
+namespace Engine
+{
+    /**************************************************************************
+     * @brief
+     * Jolt DebugRenderer that queues into DebugDraw for the current frame.
+     *
+     * Triangles are drawn as their three edges (DebugRendererSimple's
+     * fallback); bodies should be drawn with mDrawShapeWireframe set.
+     **************************************************************************/
+    class PhysicsDebugRenderer final : public JPH::DebugRendererSimple
+    {
+    public:
+        void DrawLine(JPH::RVec3Arg from, JPH::RVec3Arg to, JPH::ColorArg color) override;
+        void DrawText3D(JPH::RVec3Arg position, JPH::string_view const &text, JPH::ColorArg color, float height) override;
+    };
+
+} // namespace Engine
+
+#endif // JPH_DEBUG_RENDERER
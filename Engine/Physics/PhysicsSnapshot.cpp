@@ -0,0 +1,368 @@
+/*****************************************************************************/
+/*!
+\file       PhysicsSnapshot.cpp
+\date       2025
+\brief      Physics world snapshots:
+            - In-memory Jolt state stream
+            - Snapshot ring with keyframes and XOR/zero-run deltas
+
+(C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+*/
+/*****************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include "PhysicsSnapshot.h"
+#include "../Utility/Logger.h"
+
+namespace Engine
+{
+    /**************************************************************************
+     * @brief
+     * Load word w of a byte buffer; bytes past the end read as zero.
+     **************************************************************************/
+    static inline std::uint64_t LoadWord(std::vector<std::uint8_t> const &bytes, std::size_t w)
+    {
+        std::uint64_t x = 0u;
+        std::size_t const offset = w * sizeof(x);
+        if (offset < bytes.size())
+            std::memcpy(&x, bytes.data() + offset, std::min(sizeof(x), bytes.size() - offset));
+        return x;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Store word w of a byte buffer; bytes past the end are dropped.
+     **************************************************************************/
+    static inline void StoreWord(std::vector<std::uint8_t> &bytes, std::size_t w, std::uint64_t x)
+    {
+        std::size_t const offset = w * sizeof(x);
+        std::memcpy(bytes.data() + offset, &x, std::min(sizeof(x), bytes.size() - offset));
+    }
+
+    /**************************************************************************
+     * @brief
+     * Append a plain value to a byte buffer.
+     **************************************************************************/
+    template<typename T>
+    static inline void Append(std::vector<std::uint8_t> &out, T const &value)
+    {
+        std::size_t const at = out.size();
+        out.resize(at + sizeof(T));
+        std::memcpy(out.data() + at, &value, sizeof(T));
+    }
+
+    void SnapshotStream::WriteBytes(void const *data, size_t size)
+    {
+        std::size_t const at = mBytes.size();
+        mBytes.resize(at + size);
+        std::memcpy(mBytes.data() + at, data, size);
+    }
+
+    void SnapshotStream::ReadBytes(void *out, size_t size)
+    {
+        if (mRead + size > mBytes.size())
+        {
+            std::memset(out, 0, size);
+            mFailed = true;
+            return;
+        }
+        std::memcpy(out, mBytes.data() + mRead, size);
+        mRead += size;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Size the ring and drop its contents.
+     *
+     * @param capacity
+     * Frames kept (at least 1).
+     * @param keyframeInterval
+     * Frames per keyframe (at least 1).
+     **************************************************************************/
+    void PhysicsSnapshotRing::Reset(std::uint32_t capacity, std::uint32_t keyframeInterval)
+    {
+        mEntries.clear();
+        mEntries.resize(std::max(1u, capacity));
+        mHead = 0u;
+        mCount = 0u;
+        mKeyframeInterval = std::max(1u, keyframeInterval);
+        mRebased = 0u;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Store a frame, as a keyframe or as a delta against the newest
+     * frame's keyframe.
+     *
+     * @param frame
+     * Frame number.
+     * @param raw
+     * Uncompressed Jolt state.
+     * @param topology
+     * Bodies and joints the state refers to (copied).
+     * @return
+     * Bytes stored after compression.
+     **************************************************************************/
+    std::size_t PhysicsSnapshotRing::Push(std::uint64_t frame, std::vector<std::uint8_t> const &raw, PhysicsSnapshotTopology const &topology)
+    {
+        std::uint32_t const capacity = Capacity();
+
+        // Newer frames are stale once an older one is saved again (rollback).
+        while (mCount > 0u)
+        {
+            std::uint32_t const newest = (mHead + capacity - 1u) % capacity;
+            if (mEntries[newest].frame < frame) break;
+            mEntries[newest].live = false;
+            mHead = newest;
+            --mCount;
+        }
+
+        // The oldest frame is about to be overwritten; keep its deltas decodable.
+        if (mCount == capacity && mEntries[mHead].keyframe)
+            RebaseDependents(mHead);
+
+        Entry const *key = nullptr;
+        if (mCount > 0u)
+        {
+            Entry const &newest = mEntries[(mHead + capacity - 1u) % capacity];
+            key = newest.keyframe ? &newest : KeyOf(newest);
+        }
+
+        Entry &entry = mEntries[mHead];
+        bool const keyframe = key == nullptr || key == &entry || frame - key->frame >= mKeyframeInterval;
+
+        entry.frame = frame;
+        entry.rawSize = raw.size();
+        entry.live = true;
+        entry.keyframe = keyframe;
+        if (keyframe)
+        {
+            entry.keyFrame = frame;
+            entry.keySlot = mHead;
+            entry.data.assign(raw.begin(), raw.end());
+        }
+        else
+        {
+            entry.keyFrame = key->frame;
+            entry.keySlot = static_cast<std::uint32_t>(key - mEntries.data());
+            EncodeDelta(raw, key->data, entry.data);
+        }
+        entry.topology.bodies.assign(topology.bodies.begin(), topology.bodies.end());
+        entry.topology.joints.assign(topology.joints.begin(), topology.joints.end());
+
+        mHead = (mHead + 1u) % capacity;
+        mCount = std::min(mCount + 1u, capacity);
+        return entry.data.size();
+    }
+
+    /**************************************************************************
+     * @brief
+     * Decode a frame's state: its keyframe with its delta applied.
+     *
+     * @param frame
+     * Frame number.
+     * @param raw
+     * Receives the uncompressed state.
+     * @return
+     * Topology of the frame, or nullptr if it is not available.
+     **************************************************************************/
+    PhysicsSnapshotTopology const *PhysicsSnapshotRing::Decode(std::uint64_t frame, std::vector<std::uint8_t> &raw) const
+    {
+        Entry const *entry = Find(frame);
+        if (entry == nullptr) return nullptr;
+
+        if (entry->keyframe)
+        {
+            raw.assign(entry->data.begin(), entry->data.end());
+            return &entry->topology;
+        }
+
+        Entry const *key = KeyOf(*entry);
+        if (key == nullptr) return nullptr;
+
+        raw.assign(key->data.begin(), key->data.end());
+        raw.resize(entry->rawSize, 0u);
+        ApplyDelta(entry->data, raw);
+        return &entry->topology;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Check if a frame can be decoded.
+     **************************************************************************/
+    bool PhysicsSnapshotRing::Has(std::uint64_t frame) const
+    {
+        Entry const *entry = Find(frame);
+        return entry != nullptr && (entry->keyframe || KeyOf(*entry) != nullptr);
+    }
+
+    /**************************************************************************
+     * @brief
+     * Fill the ring counters of a stats struct.
+     **************************************************************************/
+    void PhysicsSnapshotRing::GetStats(PhysicsSnapshotStats &stats) const
+    {
+        stats.Stored = mCount;
+        stats.Rebased = mRebased;
+        stats.Keyframes = 0u;
+        stats.RingBytes = 0u;
+        for (Entry const &entry : mEntries)
+        {
+            if (!entry.live) continue;
+            stats.Keyframes += entry.keyframe ? 1u : 0u;
+            stats.RingBytes += entry.data.size();
+        }
+    }
+
+    /**************************************************************************
+     * @brief
+     * Find a live frame, newest first.
+     **************************************************************************/
+    PhysicsSnapshotRing::Entry const *PhysicsSnapshotRing::Find(std::uint64_t frame) const
+    {
+        std::uint32_t const capacity = Capacity();
+        for (std::uint32_t i = 0u; i < mCount; ++i)
+        {
+            Entry const &entry = mEntries[(mHead + capacity - 1u - i) % capacity];
+            if (entry.frame == frame) return &entry;
+            if (entry.frame < frame) break;
+        }
+        return nullptr;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Keyframe of a delta, or nullptr if it was overwritten or dropped.
+     **************************************************************************/
+    PhysicsSnapshotRing::Entry const *PhysicsSnapshotRing::KeyOf(Entry const &entry) const
+    {
+        Entry const &key = mEntries[entry.keySlot];
+        return key.live && key.keyframe && key.frame == entry.keyFrame ? &key : nullptr;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Make the deltas of a keyframe independent of it before it is
+     * overwritten: the oldest one becomes a keyframe and the others are
+     * re-encoded against it.
+     *
+     * Deltas directly follow their keyframe in the ring, so the scan stops
+     * at the first frame with another keyframe.
+     *
+     * @param keySlot
+     * Slot of the keyframe (the oldest live frame).
+     **************************************************************************/
+    void PhysicsSnapshotRing::RebaseDependents(std::uint32_t keySlot)
+    {
+        std::uint32_t const capacity = Capacity();
+        Entry const &oldKey = mEntries[keySlot];
+        Entry *newKey = nullptr;
+        std::uint32_t newKeySlot = keySlot;
+        std::uint32_t rebased = 0u;
+
+        for (std::uint32_t i = 1u; i < mCount; ++i)
+        {
+            std::uint32_t const slot = (keySlot + i) % capacity;
+            Entry &entry = mEntries[slot];
+            if (entry.keyframe || entry.keySlot != keySlot || entry.keyFrame != oldKey.frame) break;
+
+            mRebaseRaw.assign(oldKey.data.begin(), oldKey.data.end());
+            mRebaseRaw.resize(entry.rawSize, 0u);
+            ApplyDelta(entry.data, mRebaseRaw);
+
+            if (newKey == nullptr)
+            {
+                newKey = &entry;
+                newKeySlot = slot;
+                entry.keyframe = true;
+                entry.keyFrame = entry.frame;
+                entry.keySlot = slot;
+                entry.data.swap(mRebaseRaw);
+            }
+            else
+            {
+                EncodeDelta(mRebaseRaw, newKey->data, mRebaseDelta);
+                entry.keyFrame = newKey->frame;
+                entry.keySlot = newKeySlot;
+                entry.data.swap(mRebaseDelta);
+                ++rebased;
+            }
+        }
+
+        if (newKey == nullptr) return;
+
+        if (mRebased == 0u)
+            LOG_DEBUG("PhysicsSnapshotRing: ring wrapped, deltas of overwritten keyframes are rebased (frame ", newKey->frame, " promoted)");
+        mRebased += rebased + 1u;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Encode raw ^ key as (zero words, literal words, literals...) runs.
+     *
+     * Bodies at rest and static parts of the state produce long zero runs,
+     * so a frame typically costs a small fraction of its keyframe.
+     *
+     * @param raw
+     * State to encode.
+     * @param key
+     * Keyframe state (read as zero-padded or truncated to raw's size;
+     * contacts make the state size vary between frames).
+     * @param out
+     * Receives the encoded delta (capacity reused).
+     **************************************************************************/
+    void PhysicsSnapshotRing::EncodeDelta(std::vector<std::uint8_t> const &raw, std::vector<std::uint8_t> const &key, std::vector<std::uint8_t> &out)
+    {
+        out.clear();
+        std::size_t const words = (raw.size() + sizeof(std::uint64_t) - 1u) / sizeof(std::uint64_t);
+
+        std::size_t w = 0u;
+        while (w < words)
+        {
+            std::size_t const zeroStart = w;
+            while (w < words && LoadWord(raw, w) == LoadWord(key, w)) ++w;
+            std::size_t const literalStart = w;
+            while (w < words && LoadWord(raw, w) != LoadWord(key, w)) ++w;
+
+            Append(out, static_cast<std::uint32_t>(literalStart - zeroStart));
+            Append(out, static_cast<std::uint32_t>(w - literalStart));
+            for (std::size_t i = literalStart; i < w; ++i)
+                Append(out, LoadWord(raw, i) ^ LoadWord(key, i));
+        }
+    }
+
+    /**************************************************************************
+     * @brief
+     * Apply an encoded delta to a copy of its keyframe, in place.
+     *
+     * @param delta
+     * Encoded delta.
+     * @param raw
+     * Keyframe state resized to the frame's size on input, decoded state
+     * on output.
+     **************************************************************************/
+    void PhysicsSnapshotRing::ApplyDelta(std::vector<std::uint8_t> const &delta, std::vector<std::uint8_t> &raw)
+    {
+        std::size_t at = 0u, w = 0u;
+        while (at + 2u * sizeof(std::uint32_t) <= delta.size())
+        {
+            std::uint32_t zeros = 0u, literals = 0u;
+            std::memcpy(&zeros, delta.data() + at, sizeof(zeros));
+            std::memcpy(&literals, delta.data() + at + sizeof(zeros), sizeof(literals));
+            at += sizeof(zeros) + sizeof(literals);
+
+            w += zeros;
+            for (std::uint32_t i = 0u; i < literals; ++i, ++w, at += sizeof(std::uint64_t))
+            {
+                std::uint64_t x = 0u;
+                std::memcpy(&x, delta.data() + at, sizeof(x));
+                StoreWord(raw, w, LoadWord(raw, w) ^ x);
+            }
+        }
+    }
+
+} // namespace Engine
@@ -0,0 +1,211 @@
+/*****************************************************************************/
+/*!
+\file       PhysicsSnapshot.h
+\date       2025
+\brief      Physics world snapshots for rollback and replay.
+
+            Provides:
+            - SnapshotStream: a reusable in-memory Jolt StateRecorder
+            - SnapshotBodyFilter: skips static bodies, which never change
+            - PhysicsSnapshotRing: a fixed-size ring of per-frame world
+              states, delta-compressed against the latest keyframe
+
+            A delta stores the words that changed since its keyframe as
+            (zero run, literal run) pairs over the XOR of both states, so
+            restoring any frame is one keyframe copy plus one pass over its
+            delta. Slot buffers keep their capacity when overwritten, so a
+            warmed-up ring does not allocate.
+
+(C) 2025 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+*/
+/*****************************************************************************/
+#pragma once
+
+// --- STL (alphabetical) ---
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// --- Jolt (alphabetical) ---
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Body/Body.h>
+#include <Jolt/Physics/Body/BodyID.h>
+#include <Jolt/Physics/StateRecorder.h>
+
+// --- EnTT ---
+#include <entt/entt.hpp>
+
+namespace Engine
+{
+    /**************************************************************************
+     * @brief
+     * In-memory Jolt state stream. Clear() keeps the buffer's capacity.
+     **************************************************************************/
+    class SnapshotStream final : public JPH::StateRecorder
+    {
+    public:
+        void WriteBytes(void const *data, size_t size) override;
+        void ReadBytes(void *out, size_t size) override;
+        bool IsEOF() const override { return mRead >= mBytes.size(); }
+        bool IsFailed() const override { return mFailed; }
+
+        /**********************************************************************
+         * @brief
+         * Drop the contents (capacity is kept) and rewind.
+         **********************************************************************/
+        void Clear() { mBytes.clear(); Rewind(); }
+
+        /**********************************************************************
+         * @brief
+         * Read again from the start.
+         **********************************************************************/
+        void Rewind() { mRead = 0u; mFailed = false; }
+
+        std::vector<std::uint8_t>       &Bytes() { return mBytes; }
+        std::vector<std::uint8_t> const &Bytes() const { return mBytes; }
+
+    private:
+        std::vector<std::uint8_t> mBytes;
+        size_t                    mRead{};
+        bool                      mFailed{};
+    };
+
+    /**************************************************************************
+     * @brief
+     * Save only bodies that can move; static bodies (level geometry,
+     * trigger sensors) would otherwise dominate every snapshot.
+     **************************************************************************/
+    class SnapshotBodyFilter final : public JPH::StateRecorderFilter
+    {
+    public:
+        bool ShouldSaveBody(JPH::Body const &body) const override { return !body.IsStatic(); }
+    };
+
+    /**************************************************************************
+     * @brief
+     * What a snapshot expects to find in the world when restored.
+     **************************************************************************/
+    struct PhysicsSnapshotTopology
+    {
+        std::vector<std::pair<entt::entity, JPH::BodyID>> bodies;  //!< mBodyOf at save time
+        std::vector<std::uint64_t>                        joints;  //!< Sorted constraint serials
+    };
+
+    /**************************************************************************
+     * @brief
+     * Snapshot memory and timing counters.
+     **************************************************************************/
+    struct PhysicsSnapshotStats
+    {
+        std::uint32_t Stored{};          //!< Frames in the ring
+        std::uint32_t Keyframes{};       //!< Of which keyframes
+        std::size_t   LastRawBytes{};    //!< Size of the last saved state
+        std::size_t   LastStoredBytes{}; //!< Its size after delta compression
+        std::size_t   RingBytes{};       //!< Compressed bytes held by the ring
+        std::uint64_t Rebased{};         //!< Deltas re-encoded because their keyframe was overwritten
+        double        SaveMs{};          //!< Wall time of the last save
+        double        RestoreMs{};       //!< Wall time of the last restore
+    };
+
+    /**************************************************************************
+     * @brief
+     * Fixed-capacity ring of per-frame physics states.
+     *
+     * Frames are pushed in increasing order; pushing a frame at or before
+     * the newest one first drops the newer frames (they are stale after a
+     * rollback). A keyframe is stored every keyframeInterval frames; the
+     * frames in between are deltas against it.
+     * Before a keyframe is overwritten, its oldest delta is promoted to a
+     * keyframe and the other deltas are re-encoded against it, so every
+     * frame in the ring stays decodable.
+     **************************************************************************/
+    class PhysicsSnapshotRing
+    {
+    public:
+        /**********************************************************************
+         * @brief
+         * Size the ring and drop its contents.
+         *
+         * @param capacity
+         * Frames kept.
+         * @param keyframeInterval
+         * Frames per keyframe (1 = no delta compression).
+         **********************************************************************/
+        void Reset(std::uint32_t capacity, std::uint32_t keyframeInterval);
+
+        /**********************************************************************
+         * @brief
+         * Store a frame.
+         *
+         * @param frame
+         * Frame number.
+         * @param raw
+         * Uncompressed Jolt state.
+         * @param topology
+         * Bodies and joints the state refers to (copied).
+         * @return
+         * Bytes stored after compression.
+         **********************************************************************/
+        std::size_t Push(std::uint64_t frame, std::vector<std::uint8_t> const &raw, PhysicsSnapshotTopology const &topology);
+
+        /**********************************************************************
+         * @brief
+         * Decode a frame's state.
+         *
+         * @param frame
+         * Frame number.
+         * @param raw
+         * Receives the uncompressed state.
+         * @return
+         * Topology of the frame, or nullptr if it is not available.
+         **********************************************************************/
+        PhysicsSnapshotTopology const *Decode(std::uint64_t frame, std::vector<std::uint8_t> &raw) const;
+
+        /**********************************************************************
+         * @brief
+         * Check if a frame can be decoded.
+         **********************************************************************/
+        bool Has(std::uint64_t frame) const;
+
+        /**********************************************************************
+         * @brief
+         * Fill the ring counters of a stats struct.
+         **********************************************************************/
+        void GetStats(PhysicsSnapshotStats &stats) const;
+
+        std::uint32_t Capacity() const { return static_cast<std::uint32_t>(mEntries.size()); }
+
+    private:
+        struct Entry
+        {
+            std::uint64_t             frame{};
+            std::uint64_t             keyFrame{};  //!< Frame of the keyframe (== frame for keyframes)
+            std::uint32_t             keySlot{};   //!< Slot of the keyframe
+            std::size_t               rawSize{};
+            bool                      live{};
+            bool                      keyframe{};
+            std::vector<std::uint8_t> data;        //!< Raw state (keyframe) or encoded delta
+            PhysicsSnapshotTopology   topology;
+        };
+
+        Entry const *Find(std::uint64_t frame) const;
+        Entry const *KeyOf(Entry const &entry) const;
+
+        void RebaseDependents(std::uint32_t keySlot);
+
+        static void EncodeDelta(std::vector<std::uint8_t> const &raw, std::vector<std::uint8_t> const &key, std::vector<std::uint8_t> &out);
+        static void ApplyDelta(std::vector<std::uint8_t> const &delta, std::vector<std::uint8_t> &raw);
+
+        std::vector<Entry> mEntries;
+        std::uint32_t      mHead{};   //!< Next slot to write
+        std::uint32_t      mCount{};  //!< Live entries, newest at mHead - 1
+        std::uint32_t      mKeyframeInterval{ 1u };
+        std::uint64_t      mRebased{};
+        std::vector<std::uint8_t> mRebaseRaw;    //!< Scratch for rebasing
+        std::vector<std::uint8_t> mRebaseDelta;  //!< Scratch for rebasing
+    };
+
+} // namespace Engine
@@ -12,6 +12,8 @@
             - Mesh collider support (triangle mesh / convex hull) with
               scaled-shape wrapping and shape caching
             - Rotation helpers supporting glm::quat and Euler-deg vec3
+            - Trigger volumes as static sensor bodies with enter/exit
+              events built from per-thread contact buffers
 
             Units: meters, kilograms, seconds. Coordinate system must match
             project-wide convention used by TransformComponent.
@@ -23,6 +25,7 @@ written consent of DigiPen Institute of Technology is prohibited.
 /*****************************************************************************/
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstdarg>
 #include <cstdio>
@@ -32,10 +35,52 @@ written consent of DigiPen Institute of Technology is prohibited.
 #include <unordered_set>
 #include <vector>
 
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Constraints/ConeConstraint.h>
+#include <Jolt/Physics/Constraints/DistanceConstraint.h>
+#include <Jolt/Physics/Constraints/FixedConstraint.h>
+#include <Jolt/Physics/Constraints/HingeConstraint.h>
+#include <Jolt/Physics/Constraints/SliderConstraint.h>
+
 #include "PhysicsSystem.h"
+#include "../Asset/ResourceData.h"
+#include "../Core/CVar.h"
+#include "../Graphics/DebugDraw.h"
+#include "../Utility/Logger.h"
 
 namespace Engine
 {
+    /**************************************************************************
+     * @brief
+     * World bootstrap tuning, read once in OnInit.
+     **************************************************************************/
+    static CVar<int> sTempAllocatorMB("phys.TempAllocatorMB", 64, 1, 4096,
+        "Jolt per-step temp allocator size in MB (release builds)", CVAR_RESTART);
+    static CVar<int> sWorkerThreads("phys.WorkerThreads", -1, -1, 256,
+        "Jolt job system worker threads, -1 = hardware threads - 1", CVAR_RESTART);
+    static CVar<int> sMaxBodies("phys.MaxBodies", 8192, 1, 1 << 20,
+        "Maximum rigid bodies in the physics world", CVAR_RESTART);
+    static CVar<int> sMaxBodyPairs("phys.MaxBodyPairs", 32768, 1, 1 << 22,
+        "Maximum broadphase body pairs per step", CVAR_RESTART);
+    static CVar<int> sMaxContactConstraints("phys.MaxContactConstraints", 16384, 1, 1 << 22,
+        "Maximum contact constraints per step", CVAR_RESTART);
+
+    /**************************************************************************
+     * @brief
+     * Snapshot ring sizing, read once in OnInit.
+     **************************************************************************/
+    static CVar<int> sSnapshotFrames("phys.SnapshotFrames", 64, 1, 4096,
+        "Frames of physics state kept for rollback", CVAR_RESTART);
+    static CVar<int> sSnapshotKeyframeInterval("phys.SnapshotKeyframeInterval", 8, 1, 256,
+        "Frames per full snapshot; the ones in between are stored as deltas", CVAR_RESTART);
+
+    /**************************************************************************
+     * @brief
+     * Debug drawing through Jolt's DebugRenderer, checked every frame.
+     **************************************************************************/
+    static CVar<int> sDebugDraw("phys.DebugDraw", 0, 0, 3,
+        "Draw physics: 1 = body shapes, 2 = + constraints, 3 = + bounding boxes");
+
     /**************************************************************************
      * @brief
      * Default half-extent for fallback box shapes (meters).
@@ -127,17 +172,18 @@ namespace Engine
 #ifdef _DEBUG
             mTempAllocator = new JPH::TempAllocatorMalloc();
 #else
-            mTempAllocator = new JPH::TempAllocatorImpl(64u * 1024u * 1024u);
+            mTempAllocator = new JPH::TempAllocatorImpl(uint32_t(sTempAllocatorMB.Get()) * 1024u * 1024u);
 #endif
 
         unsigned const hw = std::max(1u, std::thread::hardware_concurrency());
-        mJobSystem = new JPH::JobSystemThreadPool(2048, 8, int(hw > 1u ? hw - 1u : 1u));
+        int const workers = sWorkerThreads.Get() >= 0 ? sWorkerThreads.Get() : int(hw > 1u ? hw - 1u : 1u);
+        mJobSystem = new JPH::JobSystemThreadPool(2048, 8, workers);
 
-        // World capacity tuning (safe defaults; adjust per project scale).
-        uint32_t const cMaxBodies = 8192u;
+        // World capacity tuning (phys.* CVars; adjust per project scale).
+        uint32_t const cMaxBodies = uint32_t(sMaxBodies.Get());
         uint32_t const cNumBodyMutexes = 0u;
-        uint32_t const cMaxBodyPairs = 32768u;
-        uint32_t const cMaxContactConstraints = 16384u;
+        uint32_t const cMaxBodyPairs = uint32_t(sMaxBodyPairs.Get());
+        uint32_t const cMaxContactConstraints = uint32_t(sMaxContactConstraints.Get());
 
         mPhysics.Init(
             cMaxBodies,
@@ -150,9 +196,20 @@ namespace Engine
         );
 
         mPhysics.SetGravity(JPH::Vec3(0.0f, -9.81f, 0.0f));
+        mPhysics.SetContactListener(&mContactRecorder);
         mBodyInterface = &mPhysics.GetBodyInterface();
 
+        // Flat per-body tables for trigger bookkeeping (BodyID index < cMaxBodies).
+        mContactRecorder.ResetSensors(cMaxBodies);
+        mContactRecorder.ResetThreadSlots();
+        mTriggerSlotOfBody.assign(cMaxBodies, NO_TRIGGER);
+
+        mSnapshots.Reset(uint32_t(sSnapshotFrames.Get()), uint32_t(sSnapshotKeyframeInterval.Get()));
+
+        ReleaseStaleJoints(scene);
         BuildOrRefreshBodies(scene);
+        CreatePendingJoints(scene);
+        BuildOrRefreshTriggers(scene);
     }
 
     /**************************************************************************
@@ -167,6 +224,15 @@ namespace Engine
      **************************************************************************/
     void PhysicsSystem::OnShutdown(Scene * /*scene*/)
     {
+        // Constraints reference bodies, so they go first.
+        for (JointSlot const &slot : mJoints)
+        {
+            if (slot.constraint) mPhysics.RemoveConstraint(slot.constraint);
+        }
+        mJoints.clear();
+        mJointSlotOfEntity.clear();
+        mJointBreaks.clear();
+
         for (auto const &kv : mBodyOf)
         {
             JPH::BodyID const id = kv.second;
@@ -175,7 +241,29 @@ namespace Engine
         }
         mBodyOf.clear();
 
+        // Parked bodies are already out of the broadphase.
+        for (auto const &kv : mParkedBodyOf)
+            mBodyInterface->DestroyBody(kv.second);
+        mParkedBodyOf.clear();
+        mSyncOf.clear();
+
+        for (TriggerSlot const &slot : mTriggers)
+        {
+            mBodyInterface->RemoveBody(slot.body);
+            mBodyInterface->DestroyBody(slot.body);
+        }
+        mTriggers.clear();
+        mTriggerSlotOfEntity.clear();
+        mTriggerSlotOfBody.clear();
+        mDormantOverlaps.clear();
+        mTriggerEvents.clear();
+
         mShapeCache.clear();
+        mSnapshots.Reset(1u, 1u);
+
+#ifdef JPH_DEBUG_RENDERER
+        mDebugRenderer.reset();
+#endif
 
         delete mJobSystem;     mJobSystem = nullptr;
         delete mTempAllocator; mTempAllocator = nullptr;
@@ -190,11 +278,15 @@ namespace Engine
      * Step simulation and synchronize transforms/velocities with ECS.
      *
      * Pipeline per frame:
-     * 1) Ensure body map matches current ECS (create/destroy as needed).
+     * 1) Ensure body map matches current ECS (create/destroy as needed),
+     *    with joints released before and created after the bodies.
      * 2) Push kinematic poses (authoritative from Transform) and
      *    push dynamic linear velocities from Rigidbody to Jolt.
      * 3) Step the world once using provided TempAllocator and JobSystem.
-     * 4) Pull back dynamic states into ECS (position/rotation/velocity).
+     * 4) Break overloaded joints; turn contacts into queries/task
+     *    wake-ups and trigger events.
+     * 5) Pull back dynamic states into ECS (position/rotation/velocity).
+     * 6) Queue debug drawing of the world when phys.DebugDraw is set.
      *
      * @param scene
      * Scene whose registry is mirrored.
@@ -205,62 +297,174 @@ namespace Engine
     {
         if (!IsEnabled()) return;
 
+        mTriggerEvents.clear();
+        mJointBreaks.clear();
+
+        ReleaseStaleJoints(scene);
         BuildOrRefreshBodies(scene);
+        CreatePendingJoints(scene);
+        BuildOrRefreshTriggers(scene);
 
         auto &reg = scene->GetRegistry();
 
-        // Push phase: kinematics (pose) and dynamics (velocity).
+        // Bodies in a low tick-rate bucket keep simulating in Jolt every step; only
+        // their ECS sync is skipped between ticks (TransformSystem interpolates).
+        auto const shouldSync = [&](EntityID e)
+            {
+                return SimulationLOD::ShouldTick(reg.try_get<SimulationLODComponent>(e));
+            };
+
+        // Push phase: changed material settings, kinematics (pose) and dynamics (velocity).
         reg.view<TransformComponent, RigidbodyComponent>().each(
             [&](EntityID e, TransformComponent &tc, RigidbodyComponent &rb)
             {
+                if (!shouldSync(e)) return;
                 auto it = mBodyOf.find(e);
                 if (it == mBodyOf.end()) return;
                 JPH::BodyID const id = it->second;
 
+                BodySync &sync = mSyncOf[e];
+
+                if (rb.CompoundChildren || sync.compound)
+                    RefreshCompoundShape(scene, e, id, tc, rb, sync);
+
+                BodyMaterial const material = ToBodyMaterial(rb);
+                if (!(sync.material == material))
+                {
+                    ApplyBodyMaterial(id, material);
+                    sync.material = material;
+                }
+
                 if (rb.IsKinematic)
                 {
-                    mBodyInterface->SetPositionAndRotation(
-                        id,
-                        ToJPHRVec3(tc.Position),
-                        ToJPHRotation(tc.Rotation),
-                        JPH::EActivation::DontActivate
-                    );
+                    if (tc.Position != sync.position || tc.Rotation != sync.rotation)
+                    {
+                        mBodyInterface->SetPositionAndRotation(
+                            id,
+                            ToJPHRVec3(tc.Position),
+                            ToJPHRotation(tc.Rotation),
+                            JPH::EActivation::DontActivate
+                        );
+                    }
                 }
-                else
+                else if (rb.Velocity != sync.velocity || rb.AngularVelocity != sync.angularVelocity)
                 {
-                    mBodyInterface->SetLinearVelocity(id, ToJPHVec3(rb.Velocity));
+                    mBodyInterface->SetLinearAndAngularVelocity(id, ToJPHVec3(rb.Velocity), ToJPHVec3(rb.AngularVelocity));
                 }
             }
         );
 
         // Simulation step (single substep).
+        auto const stepStart = std::chrono::steady_clock::now();
         mPhysics.Update(dt.GetSeconds(), 1, mTempAllocator, mJobSystem);
+        mStats.StepMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stepStart).count();
+        mStats.PeakStepMs = std::max(mStats.PeakStepMs, mStats.StepMs);
+        mStats.Bodies = static_cast<std::uint32_t>(mBodyOf.size());
+        mStats.SensorThreadBuffers = mContactRecorder.GetThreadBuffersInUse();
+        mStats.MicrosPerJoint = mStats.Joints > 0u ? mStats.StepMs * 1000.0 / mStats.Joints : 0.0;
+
+        BreakOverloadedJoints(scene, dt.GetSeconds());
+
+        // New contacts: keep for queries and wake tasks waiting on them.
+        mContactRecorder.Drain(mContactsBegun);
+        TaskRunner &tasks = scene->GetTaskRunner();
+        if (tasks.HasContactWaiters())
+        {
+            for (PhysicsContact const &c : mContactsBegun)
+                tasks.NotifyContact(c.a, c.b);
+        }
 
-        // Pull phase: write back transform and velocity for dynamics.
+        ProcessSensorContacts();
+        DispatchTriggerEvents(scene);
+
+        // Pull phase: write back transform, velocity for dynamics and sleep state.
         reg.view<TransformComponent, RigidbodyComponent>().each(
             [&](EntityID e, TransformComponent &tc, RigidbodyComponent &rb)
             {
+                if (!shouldSync(e)) return;
                 auto it = mBodyOf.find(e);
                 if (it == mBodyOf.end()) return;
-                JPH::BodyID const id = it->second;
+                PullBody(e, it->second, tc, rb);
+            }
+        );
+
+        DrawDebug();
+    }
+
+    /**************************************************************************
+     * @brief
+     * Queue the world to DebugDraw as set by phys.DebugDraw.
+     *
+     * Shapes are drawn in wireframe, which DebugDraw turns into lines;
+     * static level geometry is included, so level 1 can get heavy on large
+     * meshes.
+     **************************************************************************/
+    void PhysicsSystem::DrawDebug()
+    {
+#ifdef JPH_DEBUG_RENDERER
+        int const mode = sDebugDraw.Get();
+        if (mode <= 0 || !DebugDraw::enabled()) return;
 
-                JPH::RVec3 p{}; JPH::Quat q{};
-                mBodyInterface->GetPositionAndRotation(id, p, q);
+        if (!mDebugRenderer) mDebugRenderer = std::make_unique<PhysicsDebugRenderer>();
 
-                tc.Position = glm::vec3(
-                    static_cast<float>(p.GetX()),
-                    static_cast<float>(p.GetY()),
-                    static_cast<float>(p.GetZ())
-                );
-                FromJPHRotation(q, tc.Rotation);
+        JPH::BodyManager::DrawSettings settings;
+        settings.mDrawShapeWireframe = true;
+        settings.mDrawBoundingBox = mode >= 3;
+        mPhysics.DrawBodies(settings, mDebugRenderer.get());
 
-                if (!rb.IsKinematic)
-                {
-                    JPH::Vec3 v = mBodyInterface->GetLinearVelocity(id);
-                    rb.Velocity = glm::vec3(v.GetX(), v.GetY(), v.GetZ());
-                }
-            }
+        if (mode >= 2)
+        {
+            mPhysics.DrawConstraints(mDebugRenderer.get());
+            mPhysics.DrawConstraintLimits(mDebugRenderer.get());
+        }
+
+        mDebugRenderer->NextFrame();
+#endif
+    }
+
+    /**************************************************************************
+     * @brief
+     * Write a body's state back to its Transform and Rigidbody.
+     *
+     * Dynamic bodies also get their velocities; the written values are
+     * recorded in the sync mirror so the next push only sends edits.
+     *
+     * @param e
+     * Entity identifier.
+     * @param id
+     * Its body.
+     * @param tc
+     * Transform to write.
+     * @param rb
+     * Rigidbody to write.
+     **************************************************************************/
+    void PhysicsSystem::PullBody(EntityID e, JPH::BodyID id, TransformComponent &tc, RigidbodyComponent &rb)
+    {
+        JPH::RVec3 p{}; JPH::Quat q{};
+        mBodyInterface->GetPositionAndRotation(id, p, q);
+
+        tc.Position = glm::vec3(
+            static_cast<float>(p.GetX()),
+            static_cast<float>(p.GetY()),
+            static_cast<float>(p.GetZ())
         );
+        FromJPHRotation(q, tc.Rotation);
+
+        if (!rb.IsKinematic)
+        {
+            JPH::Vec3 v{}, w{};
+            mBodyInterface->GetLinearAndAngularVelocity(id, v, w);
+            rb.Velocity = ToGLM(v);
+            rb.AngularVelocity = ToGLM(w);
+        }
+
+        rb.IsSleeping = !mBodyInterface->IsActive(id);
+
+        BodySync &sync = mSyncOf[e];
+        sync.position = tc.Position;
+        sync.rotation = tc.Rotation;
+        sync.velocity = rb.Velocity;
+        sync.angularVelocity = rb.AngularVelocity;
     }
 
     /**************************************************************************
@@ -269,6 +473,10 @@ namespace Engine
      *
      * Creates bodies for any (Transform,Rigidbody) entity not yet mirrored.
      * Destroys bodies for entities that no longer have the required pair.
+     * Pooled entities that were deactivated keep their body, parked outside
+     * the broadphase, and get it back when they are spawned again; one
+     * released and re-spawned between two steps is parked and unparked on
+     * the spot so its body moves to the new pose.
      *
      * @param scene
      * Scene to scan for eligible entities.
@@ -280,16 +488,27 @@ namespace Engine
         std::unordered_set<EntityID> seen;
         seen.reserve(mBodyOf.size() + 128u);
 
-        // Track all current eligible entities and create bodies when missing.
-        reg.view<TransformComponent, RigidbodyComponent>().each(
+        // Track all current eligible entities; reuse parked bodies, else create.
+        reg.view<TransformComponent, RigidbodyComponent>(entt::exclude<InactiveComponent>).each(
             [&](EntityID e, TransformComponent &, RigidbodyComponent &)
             {
                 seen.insert(e);
-                if (mBodyOf.find(e) == mBodyOf.end()) CreateBodyFor(scene, e);
+                auto const *pooled = reg.try_get<PooledComponent>(e);
+                if (mBodyOf.find(e) != mBodyOf.end())
+                {
+                    // Released and spawned again since the last step: the body never
+                    // left the broadphase and still has its previous life's pose
+                    if (!pooled || mSyncOf[e].generation == pooled->Generation) return;
+                    ParkBodyFor(e);
+                }
+                if (mParkedBodyOf.find(e) != mParkedBodyOf.end()) UnparkBodyFor(scene, e);
+                else CreateBodyFor(scene, e);
+                if (pooled && mBodyOf.find(e) != mBodyOf.end()) mSyncOf[e].generation = pooled->Generation;
             }
         );
 
-        // Compute difference: remove bodies whose entities are no longer eligible.
+        // Compute difference: park bodies of deactivated pooled entities and
+        // remove bodies whose entities are no longer eligible.
         std::vector<EntityID> to_remove;
         to_remove.reserve(mBodyOf.size());
         for (auto const &kv : mBodyOf)
@@ -298,9 +517,28 @@ namespace Engine
 
         for (EntityID e : to_remove)
         {
+            if (reg.valid(e) && reg.all_of<InactiveComponent, TransformComponent, RigidbodyComponent>(e))
+            {
+                ParkBodyFor(e);
+                continue;
+            }
             DestroyBodyFor(e);
             mBodyOf.erase(e);
         }
+
+        // Parked bodies whose entity was destroyed (or trimmed from its pool).
+        for (auto it = mParkedBodyOf.begin(); it != mParkedBodyOf.end();)
+        {
+            EntityID const e = it->first;
+            if (reg.valid(e) && reg.all_of<InactiveComponent, TransformComponent, RigidbodyComponent>(e))
+            {
+                ++it;
+                continue;
+            }
+            mBodyInterface->DestroyBody(it->second);
+            mSyncOf.erase(e);
+            it = mParkedBodyOf.erase(it);
+        }
     }
 
     /**************************************************************************
@@ -310,7 +548,8 @@ namespace Engine
      * Resolution order:
      * 1) Custom callback `mMakeEntityShape(scene,e,tc,rb)` if provided.
      * 2) Mesh-driven shape via `mFetchMeshInfo(scene,e,info)`:
-     *    - ConvexHull (preferred if `info.preferConvex` or body is dynamic)
+     *    - ConvexHull (preferred if `info.preferConvex` or body is dynamic),
+     *      or a StaticCompound of ConvexHulls when `info.hulls` is filled
      *    - Triangle Mesh (static/kinematic only; `doubleSided` respected)
      *    Shapes are cached per `CacheKey` (mesh key + flags). If `info.scale`
      *    != (1,1,1) a ScaledShape wrapper is returned.
@@ -323,12 +562,15 @@ namespace Engine
      * @param tc
      * Transform component (read-only).
      * @param rb
-     * Rigidbody component (read-only).
+     * Rigidbody component (read-only; the compound root's for children).
+     * @param fallbackBox
+     * Whether to fall back to the box (false for compound children,
+     * which are skipped when they have no collider).
      *
      * @return
-     * Ref-counted JPH::Shape pointer. Never null (falls back to box).
+     * Ref-counted JPH::Shape pointer. Null only without fallbackBox.
      **************************************************************************/
-    JPH::Ref<JPH::Shape> PhysicsSystem::MakeShapeForEntity(Scene *scene, EntityID e, TransformComponent const &tc, RigidbodyComponent const &rb)
+    JPH::Ref<JPH::Shape> PhysicsSystem::MakeShapeForEntity(Scene *scene, EntityID e, TransformComponent const &tc, RigidbodyComponent const &rb, bool fallbackBox)
     {
         if (mMakeEntityShape)
         {
@@ -338,10 +580,12 @@ namespace Engine
         if (mFetchMeshInfo)
         {
             MeshBuildInfo info;
-            if (mFetchMeshInfo(scene, e, info) && !info.vertices.empty() && info.indices.size() >= 3)
+            bool fetched = mFetchMeshInfo(scene, e, info);
+            bool useConvex = info.preferConvex || !rb.IsKinematic;
+            bool useHulls = useConvex && !info.hulls.empty();
+            if (fetched && (useHulls || (!info.vertices.empty() && info.indices.size() >= 3)))
             {
-                bool useConvex = info.preferConvex || !rb.IsKinematic;
-                std::uint8_t kind = useConvex ? 1u : 0u;
+                std::uint8_t kind = useHulls ? 2u : (useConvex ? 1u : 0u);
                 std::uint8_t ds = info.doubleSided ? 1u : 0u;
 
                 CacheKey key{ info.key, kind, ds };
@@ -355,7 +599,36 @@ namespace Engine
 
                 JPH::Ref<JPH::Shape> base;
 
-                if (useConvex)
+                if (useHulls)
+                {
+                    // Baked decomposition: one hull per piece, all in mesh space
+                    JPH::Array<JPH::Ref<JPH::Shape>> pieces;
+                    for (auto const &piece : info.hulls)
+                    {
+                        JPH::Array<JPH::Vec3> pts; pts.resize(piece.size());
+                        for (size_t i = 0; i < piece.size(); ++i)
+                            pts[i] = JPH::Vec3(piece[i].x, piece[i].y, piece[i].z);
+
+                        JPH::ConvexHullShapeSettings hull(pts);
+                        hull.mMaxConvexRadius = 0.0f;
+                        auto res = hull.Create();
+                        if (!res.HasError()) pieces.push_back(res.Get());
+                    }
+
+                    if (pieces.size() == 1)
+                    {
+                        base = pieces[0];
+                    }
+                    else if (!pieces.empty())
+                    {
+                        JPH::StaticCompoundShapeSettings compound;
+                        for (auto const &piece : pieces)
+                            compound.AddShape(JPH::Vec3::sZero(), JPH::Quat::sIdentity(), piece);
+                        auto res = compound.Create();
+                        if (!res.HasError()) base = res.Get();
+                    }
+                }
+                else if (useConvex)
                 {
                     JPH::Array<JPH::Vec3> pts; pts.resize(info.vertices.size());
                     for (size_t i = 0; i < info.vertices.size(); ++i)
@@ -400,17 +673,245 @@ namespace Engine
             }
         }
 
+        if (!fallbackBox) return nullptr;
         return JPH::Ref<JPH::Shape>(new JPH::BoxShape(JPH::Vec3::sReplicate(DEFAULT_HALF_EXT)));
     }
 
+    /**************************************************************************
+     * @brief
+     * Shape of a new body, compound for CompoundChildren rigidbodies.
+     *
+     * @param scene
+     * Scene handle.
+     * @param e
+     * Entity identifier.
+     * @param tc
+     * Transform (read-only).
+     * @param rb
+     * Rigidbody (read-only).
+     * @param parts
+     * Receives the merged children (empty for plain bodies).
+     * @return
+     * Ref-counted shape (never null).
+     **************************************************************************/
+    JPH::Ref<JPH::Shape> PhysicsSystem::MakeBodyShape(Scene *scene, EntityID e, TransformComponent const &tc, RigidbodyComponent const &rb, std::vector<CompoundPart> &parts)
+    {
+        parts.clear();
+        if (!rb.CompoundChildren) return MakeShapeForEntity(scene, e, tc, rb);
+
+        GatherCompoundParts(scene, e, tc, parts);
+        return BuildCompoundShape(scene, e, tc, rb, parts);
+    }
+
+    /**************************************************************************
+     * @brief
+     * Collect a compound root's child colliders.
+     *
+     * Walks TransformComponent::Children depth first. Children with their
+     * own Rigidbody stay separate bodies and inactive children are left
+     * out, both with their subtrees. Triggers and character controllers
+     * are not colliders, but their children can be. Child transforms are
+     * local to their parent; they are chained down to the root body, whose
+     * scale (and every ancestor's) is carried in CompoundPart::scale.
+     *
+     * @param scene
+     * Scene handle.
+     * @param root
+     * Compound root entity.
+     * @param tc
+     * Root Transform.
+     * @param parts
+     * Receives the children.
+     **************************************************************************/
+    void PhysicsSystem::GatherCompoundParts(Scene *scene, EntityID root, TransformComponent const &tc, std::vector<CompoundPart> &parts) const
+    {
+        auto &reg = scene->GetRegistry();
+        parts.clear();
+
+        struct Frame
+        {
+            EntityID  entity;
+            glm::vec3 position;
+            glm::quat rotation;
+            glm::vec3 scale;
+        };
+        std::vector<Frame> stack;
+        stack.push_back(Frame{ root, glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), tc.Scale });
+
+        while (!stack.empty())
+        {
+            Frame const parent = stack.back();
+            stack.pop_back();
+
+            auto const &children = reg.get<TransformComponent>(parent.entity).Children;
+            for (auto it = children.rbegin(); it != children.rend(); ++it)
+            {
+                EntityID const child = *it;
+                if (!reg.valid(child) || reg.any_of<RigidbodyComponent, InactiveComponent>(child)) continue;
+                auto const *ctc = reg.try_get<TransformComponent>(child);
+                if (ctc == nullptr) continue;
+
+                Frame const frame{
+                    child,
+                    parent.position + parent.rotation * (parent.scale * ctc->Position),
+                    glm::normalize(parent.rotation * ctc->Rotation),
+                    parent.scale * ctc->Scale
+                };
+
+                if (!reg.any_of<TriggerComponent, CharacterControllerComponent>(child))
+                    parts.push_back(CompoundPart{ child, frame.position, frame.rotation, parent.scale });
+
+                stack.push_back(frame);
+            }
+        }
+    }
+
+    /**************************************************************************
+     * @brief
+     * Build a StaticCompoundShape from a root's own shape and its parts.
+     *
+     * The root contributes its own collider only if it has one (an empty
+     * root object adds nothing). Parts without a collider are skipped.
+     * Child shapes come from the same callbacks as bodies, in the child's
+     * own space, and are wrapped in a ScaledShape for their ancestors'
+     * scale (exact for uniform scale; non-uniform scale on a rotated child
+     * is approximated, as Jolt shapes cannot shear).
+     *
+     * @return
+     * Compound shape, or the root's plain shape if no part has one.
+     **************************************************************************/
+    JPH::Ref<JPH::Shape> PhysicsSystem::BuildCompoundShape(Scene *scene, EntityID root, TransformComponent const &tc, RigidbodyComponent const &rb, std::vector<CompoundPart> const &parts)
+    {
+        auto &reg = scene->GetRegistry();
+        JPH::StaticCompoundShapeSettings compound;
+
+        if (JPH::Ref<JPH::Shape> own = MakeShapeForEntity(scene, root, tc, rb, false))
+            compound.AddShape(JPH::Vec3::sZero(), JPH::Quat::sIdentity(), own);
+
+        for (CompoundPart const &part : parts)
+        {
+            JPH::Ref<JPH::Shape> shape = MakeShapeForEntity(scene, part.entity, reg.get<TransformComponent>(part.entity), rb, false);
+            if (!shape) continue;
+            if (part.scale != glm::vec3(1.0f))
+                shape = new JPH::ScaledShape(shape, ToJPHVec3(part.scale));
+            compound.AddShape(ToJPHVec3(part.position), ToJPHQuat(part.rotation), shape);
+        }
+
+        if (compound.mSubShapes.empty()) return MakeShapeForEntity(scene, root, tc, rb);
+
+        auto res = compound.Create();
+        if (res.HasError())
+        {
+            LOG_WARNING("PhysicsSystem: compound shape failed, using the root's own shape: ", res.GetError().c_str());
+            return MakeShapeForEntity(scene, root, tc, rb);
+        }
+        return res.Get();
+    }
+
+    /**************************************************************************
+     * @brief
+     * Rebuild a body's shape after CompoundChildren or its children changed.
+     *
+     * Runs in the push phase for compound bodies (and bodies that just
+     * stopped being one). The children are gathered every frame but the
+     * shape is only rebuilt when the child set or a relative pose differs
+     * from the one it was built from.
+     *
+     * @param scene
+     * Scene handle.
+     * @param e
+     * Entity identifier.
+     * @param id
+     * Its body.
+     * @param tc
+     * Transform (read-only).
+     * @param rb
+     * Rigidbody (read-only).
+     * @param sync
+     * The body's sync state (parts are updated).
+     **************************************************************************/
+    void PhysicsSystem::RefreshCompoundShape(Scene *scene, EntityID e, JPH::BodyID id, TransformComponent const &tc, RigidbodyComponent const &rb, BodySync &sync)
+    {
+        if (!rb.CompoundChildren)
+        {
+            sync.compound = false;
+            sync.parts.clear();
+            ApplyShape(id, MakeShapeForEntity(scene, e, tc, rb), rb.Mass);
+            return;
+        }
+
+        GatherCompoundParts(scene, e, tc, mCompoundScratch);
+        if (sync.compound && mCompoundScratch == sync.parts) return;
+
+        sync.compound = true;
+        sync.parts.swap(mCompoundScratch);
+        ApplyShape(id, BuildCompoundShape(scene, e, tc, rb, sync.parts), rb.Mass);
+    }
+
+    /**************************************************************************
+     * @brief
+     * Replace a body's shape, keeping the Rigidbody mass.
+     *
+     * Jolt keeps the body's placement; the inertia is recomputed from the
+     * new shape and scaled to the mass, as at creation.
+     *
+     * @param id
+     * Body to update.
+     * @param shape
+     * New shape.
+     * @param mass
+     * Rigidbody mass in kilograms.
+     **************************************************************************/
+    void PhysicsSystem::ApplyShape(JPH::BodyID id, JPH::Shape const *shape, float mass)
+    {
+        mBodyInterface->SetShape(id, shape, false, JPH::EActivation::Activate);
+
+        JPH::BodyLockWrite lock(mPhysics.GetBodyLockInterface(), id);
+        if (!lock.Succeeded()) return;
+
+        if (JPH::MotionProperties *mp = lock.GetBody().GetMotionPropertiesUnchecked())
+        {
+            JPH::MassProperties massProperties = shape->GetMassProperties();
+            massProperties.ScaleToMass(std::max(0.0001f, mass));
+            mp->SetMassProperties(JPH::EAllowedDOFs::All, massProperties);
+        }
+    }
+
+    bool FillMeshBuildInfo(MeshResource const &mesh, std::uint64_t key, MeshBuildInfo &info)
+    {
+        info.key = key;
+        info.hulls = mesh.collisionHulls;
+
+        if (!mesh.collisionIndices.empty())
+        {
+            info.vertices = mesh.collisionVertices;
+            info.indices.assign(mesh.collisionIndices.begin(), mesh.collisionIndices.end());
+        }
+        else
+        {
+            // Render layout: pos(3) + normal(3) + color(3) + uv(2)
+            constexpr size_t stride = 11;
+            info.vertices.resize(mesh.vertices.size() / stride);
+            for (size_t i = 0; i < info.vertices.size(); ++i)
+            {
+                info.vertices[i] = glm::vec3(mesh.vertices[i * stride + 0],
+                                             mesh.vertices[i * stride + 1],
+                                             mesh.vertices[i * stride + 2]);
+            }
+            info.indices.assign(mesh.indices.begin(), mesh.indices.end());
+        }
+
+        return !info.hulls.empty() || (!info.vertices.empty() && info.indices.size() >= 3);
+    }
+
     /**************************************************************************
      * @brief
      * Create and register a Jolt body for the given entity.
      *
-     * Uses MakeShapeForEntity() to obtain a shape. Configures mass properties,
-     * friction, restitution, and motion type/object layer via helper
-     * translators (see header). Initializes velocity for dynamics, and applies
-     * gravity factor according to RigidbodyComponent::UseGravity.
+     * Uses MakeBodyShape() to obtain a shape. Configures mass properties,
+     * motion type/object layer and the Rigidbody material (friction,
+     * restitution, damping, gravity factor, sleeping, motion quality) via
+     * helper translators (see header). Initializes velocities for dynamics.
      *
      * @param scene
      * Scene handle (for shape callbacks).
@@ -423,7 +924,8 @@ namespace Engine
         auto &tc = reg.get<TransformComponent>(e);
         auto &rb = reg.get<RigidbodyComponent>(e);
 
-        JPH::Ref<JPH::Shape> shape = MakeShapeForEntity(scene, e, tc, rb);
+        std::vector<CompoundPart> parts;
+        JPH::Ref<JPH::Shape> shape = MakeBodyShape(scene, e, tc, rb, parts);
 
         JPH::BodyCreationSettings settings(
             shape,
@@ -433,28 +935,90 @@ namespace Engine
             ToObjectLayer(rb)
         );
 
+        BodyMaterial const material = ToBodyMaterial(rb);
+
         settings.mOverrideMassProperties = JPH::EOverrideMassProperties::CalculateInertia;
         settings.mMassPropertiesOverride.mMass = std::max(0.0001f, rb.Mass);
-        settings.mFriction = 0.6f;
-        settings.mRestitution = 0.1f;
+        settings.mFriction = material.friction;
+        settings.mRestitution = material.restitution;
+        settings.mLinearDamping = material.linearDamping;
+        settings.mAngularDamping = material.angularDamping;
+        settings.mGravityFactor = material.useGravity ? 1.0f : 0.0f;
+        settings.mAllowSleeping = material.allowSleeping;
+        settings.mMotionQuality = ToMotionQuality(material.quality);
+        settings.mUserData = static_cast<JPH::uint64>(entt::to_integral(e));
 
         JPH::BodyID const id = mBodyInterface->CreateAndAddBody(settings, JPH::EActivation::Activate);
 
         if (!rb.IsKinematic)
         {
-            mBodyInterface->SetLinearVelocity(id, ToJPHVec3(rb.Velocity));
+            mBodyInterface->SetLinearAndAngularVelocity(id, ToJPHVec3(rb.Velocity), ToJPHVec3(rb.AngularVelocity));
         }
 
-        if (!rb.UseGravity)
+        mBodyOf.emplace(e, id);
+
+        BodySync &sync = mSyncOf[e];
+        sync.material = material;
+        sync.position = tc.Position;
+        sync.rotation = tc.Rotation;
+        sync.velocity = rb.Velocity;
+        sync.angularVelocity = rb.AngularVelocity;
+        sync.compound = rb.CompoundChildren;
+        sync.parts = std::move(parts);
+    }
+
+    /**************************************************************************
+     * @brief
+     * Gather (and sanitize) the material/motion settings of a Rigidbody.
+     *
+     * @param rb
+     * Rigidbody component.
+     * @return
+     * Settings with negative values clamped to what Jolt accepts.
+     **************************************************************************/
+    PhysicsSystem::BodyMaterial PhysicsSystem::ToBodyMaterial(RigidbodyComponent const &rb)
+    {
+        BodyMaterial m;
+        m.friction = std::max(0.0f, rb.Friction);
+        m.restitution = std::clamp(rb.Restitution, 0.0f, 1.0f);
+        m.linearDamping = std::max(0.0f, rb.LinearDamping);
+        m.angularDamping = std::max(0.0f, rb.AngularDamping);
+        m.useGravity = rb.UseGravity;
+        m.allowSleeping = rb.AllowSleeping;
+        m.quality = rb.MotionQuality;
+        return m;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Push changed Rigidbody settings to an existing body.
+     *
+     * @param id
+     * Body to update.
+     * @param m
+     * Settings to apply.
+     **************************************************************************/
+    void PhysicsSystem::ApplyBodyMaterial(JPH::BodyID id, BodyMaterial const &m)
+    {
         {
             JPH::BodyLockWrite lock(mPhysics.GetBodyLockInterface(), id);
-            if (lock.Succeeded())
+            if (!lock.Succeeded()) return;
+
+            JPH::Body &body = lock.GetBody();
+            body.SetFriction(m.friction);
+            body.SetRestitution(m.restitution);
+            if (JPH::MotionProperties *mp = body.GetMotionPropertiesUnchecked())
             {
-                lock.GetBody().GetMotionProperties()->SetGravityFactor(0.0f);
+                mp->SetLinearDamping(m.linearDamping);
+                mp->SetAngularDamping(m.angularDamping);
+                mp->SetGravityFactor(m.useGravity ? 1.0f : 0.0f);
             }
+            if (!body.IsStatic())
+                body.SetAllowSleeping(m.allowSleeping);
         }
 
-        mBodyOf.emplace(e, id);
+        // Goes through the body manager (CCD bookkeeping), so outside the lock.
+        mBodyInterface->SetMotionQuality(id, ToMotionQuality(m.quality));
     }
 
     /**************************************************************************
@@ -472,5 +1036,1017 @@ namespace Engine
         JPH::BodyID const id = it->second;
         mBodyInterface->RemoveBody(id);
         mBodyInterface->DestroyBody(id);
+        mSyncOf.erase(e);
+    }
+
+    /**************************************************************************
+     * @brief
+     * Take a pooled entity's body out of the broadphase without destroying it.
+     *
+     * The body keeps its shape and mass properties; it is zeroed and moved
+     * from mBodyOf to mParkedBodyOf so push/pull loops skip it.
+     *
+     * @param e
+     * Entity identifier whose body should be parked.
+     **************************************************************************/
+    void PhysicsSystem::ParkBodyFor(EntityID e)
+    {
+        auto it = mBodyOf.find(e);
+        if (it == mBodyOf.end()) return;
+
+        JPH::BodyID const id = it->second;
+        mBodyInterface->SetLinearAndAngularVelocity(id, JPH::Vec3::sZero(), JPH::Vec3::sZero());
+        mBodyInterface->RemoveBody(id);
+
+        mParkedBodyOf.emplace(e, id);
+        mBodyOf.erase(it);
+    }
+
+    /**************************************************************************
+     * @brief
+     * Return a parked body to the broadphase for a respawned pooled entity.
+     *
+     * Pose comes from the Transform (the spawner has usually just placed it),
+     * velocities from the Rigidbody (reset to prefab defaults on release).
+     *
+     * @param scene
+     * Scene handle used to read Transform/Rigidbody.
+     * @param e
+     * Entity identifier whose body should be restored.
+     **************************************************************************/
+    void PhysicsSystem::UnparkBodyFor(Scene *scene, EntityID e)
+    {
+        auto it = mParkedBodyOf.find(e);
+        if (it == mParkedBodyOf.end()) return;
+
+        auto &reg = scene->GetRegistry();
+        auto &tc = reg.get<TransformComponent>(e);
+        auto &rb = reg.get<RigidbodyComponent>(e);
+
+        JPH::BodyID const id = it->second;
+        mBodyInterface->SetPositionAndRotation(
+            id,
+            ToJPHRVec3(tc.Position),
+            ToJPHRotation(tc.Rotation),
+            JPH::EActivation::DontActivate
+        );
+        mBodyInterface->AddBody(id, JPH::EActivation::Activate);
+
+        if (!rb.IsKinematic)
+        {
+            mBodyInterface->SetLinearAndAngularVelocity(id, ToJPHVec3(rb.Velocity), ToJPHVec3(rb.AngularVelocity));
+        }
+
+        BodySync &sync = mSyncOf[e];
+        sync.position = tc.Position;
+        sync.rotation = tc.Rotation;
+        sync.velocity = rb.Velocity;
+        sync.angularVelocity = rb.AngularVelocity;
+
+        mBodyOf.emplace(e, id);
+        mParkedBodyOf.erase(it);
+    }
+
+    /**************************************************************************
+     * @brief
+     * Gather the constraint-relevant settings of a JointComponent.
+     *
+     * @param joint
+     * Joint component.
+     * @return
+     * Settings compared against the ones a constraint was built from.
+     **************************************************************************/
+    PhysicsSystem::JointSettings PhysicsSystem::ToJointSettings(JointComponent const &joint)
+    {
+        JointSettings s;
+        s.type = joint.Type;
+        s.connected = joint.ConnectedEntity;
+        s.anchor = joint.Anchor;
+        s.connectedAnchor = joint.ConnectedAnchor;
+        s.axis = joint.Axis;
+        s.useLimits = joint.UseLimits;
+        s.minLimit = joint.MinLimit;
+        s.maxLimit = joint.MaxLimit;
+        s.coneAngle = joint.ConeAngle;
+        s.breakForce = joint.BreakForce;
+        s.breakTorque = joint.BreakTorque;
+        return s;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Track JointComponents and remove stale constraints in one batch.
+     *
+     * Runs before BuildOrRefreshBodies: a constraint keeps pointers to its
+     * bodies, so it must leave the world before either body is destroyed
+     * or parked. Released joints stay pending and are rebuilt by
+     * CreatePendingJoints once their bodies exist again.
+     *
+     * @param scene
+     * Scene to scan.
+     **************************************************************************/
+    void PhysicsSystem::ReleaseStaleJoints(Scene *scene)
+    {
+        auto &reg = scene->GetRegistry();
+        std::uint32_t const pass = ++mJointPass;
+
+        // Same eligibility rule as BuildOrRefreshBodies.
+        auto const keepsBody = [&](EntityID e)
+            {
+                return reg.valid(e) && reg.all_of<TransformComponent, RigidbodyComponent>(e) && !reg.all_of<InactiveComponent>(e);
+            };
+
+        JPH::Array<JPH::Ref<JPH::Constraint>> released;
+
+        reg.view<JointComponent>().each(
+            [&](EntityID e, JointComponent &joint)
+            {
+                JointSettings const settings = ToJointSettings(joint);
+
+                std::uint32_t const entityIndex = static_cast<std::uint32_t>(entt::to_entity(e));
+                std::uint32_t const index = entityIndex < mJointSlotOfEntity.size() ? mJointSlotOfEntity[entityIndex] : NO_JOINT;
+                if (index == NO_JOINT || mJoints[index].entity != e)
+                {
+                    if (entityIndex >= mJointSlotOfEntity.size())
+                        mJointSlotOfEntity.resize(entityIndex + 1u, NO_JOINT);
+                    mJointSlotOfEntity[entityIndex] = static_cast<std::uint32_t>(mJoints.size());
+
+                    JointSlot slot;
+                    slot.entity = e;
+                    slot.settings = settings;
+                    slot.pass = pass;
+                    mJoints.push_back(std::move(slot));
+                    return;
+                }
+
+                JointSlot &slot = mJoints[index];
+                slot.pass = pass;
+                if (!slot.constraint) { slot.settings = settings; return; }
+
+                bool const keep = !joint.IsBroken && slot.settings == settings && keepsBody(e) &&
+                    (settings.connected == entt::null || keepsBody(settings.connected));
+                if (keep) return;
+
+                released.push_back(slot.constraint.GetPtr());
+                slot.constraint = nullptr;
+                slot.settings = settings;
+            }
+        );
+
+        // Back to front so the slot swapped into a hole was already checked.
+        for (std::uint32_t i = static_cast<std::uint32_t>(mJoints.size()); i-- > 0u;)
+        {
+            if (mJoints[i].pass == pass) continue;
+
+            JointSlot &slot = mJoints[i];
+            if (slot.constraint) released.push_back(slot.constraint.GetPtr());
+
+            // A recycled entity index may already point at a newer entity's slot.
+            std::uint32_t &slotOfGone = mJointSlotOfEntity[static_cast<std::uint32_t>(entt::to_entity(slot.entity))];
+            if (slotOfGone == i) slotOfGone = NO_JOINT;
+
+            std::uint32_t const last = static_cast<std::uint32_t>(mJoints.size()) - 1u;
+            if (i != last)
+            {
+                slot = std::move(mJoints[last]);
+                mJointSlotOfEntity[static_cast<std::uint32_t>(entt::to_entity(slot.entity))] = i;
+            }
+            mJoints.pop_back();
+        }
+
+        if (released.empty()) return;
+
+        JPH::Array<JPH::Constraint *> batch;
+        batch.reserve(released.size());
+        for (JPH::Ref<JPH::Constraint> const &c : released)
+            batch.push_back(c.GetPtr());
+        mPhysics.RemoveConstraints(batch.data(), static_cast<int>(batch.size()));
+    }
+
+    /**************************************************************************
+     * @brief
+     * Create the constraints of pending joints in one batch.
+     *
+     * A joint waits until its entity and its connected entity (if any)
+     * both have a body, so load order and late spawns do not matter.
+     * Broken joints wait until IsBroken is cleared.
+     *
+     * @param scene
+     * Scene handle used to read Transforms.
+     **************************************************************************/
+    void PhysicsSystem::CreatePendingJoints(Scene *scene)
+    {
+        auto &reg = scene->GetRegistry();
+
+        JPH::Array<JPH::Constraint *> batch;
+        std::uint32_t active = 0u, pending = 0u;
+
+        for (JointSlot &slot : mJoints)
+        {
+            if (slot.constraint) { ++active; continue; }
+            if (reg.get<JointComponent>(slot.entity).IsBroken) continue;
+            ++pending;
+
+            auto own = mBodyOf.find(slot.entity);
+            if (own == mBodyOf.end()) continue;
+
+            JPH::BodyID other;  // Invalid = the world
+            if (slot.settings.connected != entt::null)
+            {
+                auto it = mBodyOf.find(slot.settings.connected);
+                if (it == mBodyOf.end() || it->second == own->second) continue;
+                other = it->second;
+            }
+
+            slot.constraint = MakeJointConstraint(scene, slot, other, own->second);
+            if (!slot.constraint) continue;
+            slot.constraint->SetUserData(++mJointSerial);  // Identifies it in snapshots
+
+            batch.push_back(slot.constraint.GetPtr());
+            ++active;
+            --pending;
+        }
+
+        mStats.Joints = active;
+        mStats.PendingJoints = pending;
+
+        if (batch.empty()) return;
+
+        mPhysics.AddConstraints(batch.data(), static_cast<int>(batch.size()));
+        for (JPH::Constraint *c : batch)
+            mBodyInterface->ActivateConstraint(static_cast<JPH::TwoBodyConstraint *>(c));
+    }
+
+    /**************************************************************************
+     * @brief
+     * Build the Jolt constraint of a joint in world space.
+     *
+     * Anchors and axes are taken from the entity's Transform (scale
+     * applied to anchors), so the joint holds the bodies in the relative
+     * pose they have at creation. The joint's own body is Jolt's body 2,
+     * so hinge angles and slider offsets measure its motion relative to
+     * the connected body. Limits are sanitized to what each Jolt
+     * constraint accepts.
+     *
+     * @param scene
+     * Scene handle used to read Transforms.
+     * @param slot
+     * Joint to build.
+     * @param body1
+     * Body of the connected entity (invalid = world).
+     * @param body2
+     * Body of the joint's entity.
+     * @return
+     * Constraint, not yet added to the world (null if Jolt refused it).
+     **************************************************************************/
+    JPH::Ref<JPH::TwoBodyConstraint> PhysicsSystem::MakeJointConstraint(Scene *scene, JointSlot const &slot, JPH::BodyID body1, JPH::BodyID body2)
+    {
+        auto &reg = scene->GetRegistry();
+        JointSettings const &s = slot.settings;
+
+        auto const toWorld = [](TransformComponent const &tc, glm::vec3 const &local)
+            {
+                return ToJPHRVec3(tc.Position) + ToJPHRotation(tc.Rotation) * ToJPHVec3(tc.Scale * local);
+            };
+
+        TransformComponent const &tc = reg.get<TransformComponent>(slot.entity);
+        JPH::RVec3 const point = toWorld(tc, s.anchor);
+        JPH::Vec3 axis = ToJPHRotation(tc.Rotation) * ToJPHVec3(s.axis);
+        axis = axis.IsNearZero() ? JPH::Vec3::sAxisY() : axis.Normalized();
+        JPH::Vec3 const normal = axis.GetNormalizedPerpendicular();
+
+        JPH::Ref<JPH::TwoBodyConstraintSettings> settings;
+        switch (s.type)
+        {
+        case JointType::Fixed:
+        {
+            auto *fixed = new JPH::FixedConstraintSettings();
+            fixed->mAutoDetectPoint = true;
+            settings = fixed;
+            break;
+        }
+        case JointType::Hinge:
+        {
+            auto *hinge = new JPH::HingeConstraintSettings();
+            hinge->mPoint1 = hinge->mPoint2 = point;
+            hinge->mHingeAxis1 = hinge->mHingeAxis2 = axis;
+            hinge->mNormalAxis1 = hinge->mNormalAxis2 = normal;
+            if (s.useLimits)
+            {
+                hinge->mLimitsMin = std::clamp(glm::radians(s.minLimit), -glm::pi<float>(), 0.0f);
+                hinge->mLimitsMax = std::clamp(glm::radians(s.maxLimit), 0.0f, glm::pi<float>());
+            }
+            settings = hinge;
+            break;
+        }
+        case JointType::Slider:
+        {
+            auto *slider = new JPH::SliderConstraintSettings();
+            slider->mPoint1 = slider->mPoint2 = point;
+            slider->SetSliderAxis(axis);
+            if (s.useLimits)
+            {
+                slider->mLimitsMin = std::min(0.0f, s.minLimit);
+                slider->mLimitsMax = std::max(0.0f, s.maxLimit);
+            }
+            settings = slider;
+            break;
+        }
+        case JointType::Distance:
+        {
+            auto *distance = new JPH::DistanceConstraintSettings();
+            distance->mPoint1 = s.connected != entt::null
+                ? toWorld(reg.get<TransformComponent>(s.connected), s.connectedAnchor)
+                : ToJPHRVec3(s.connectedAnchor);
+            distance->mPoint2 = point;
+            if (s.useLimits)
+            {
+                distance->mMinDistance = std::max(0.0f, s.minLimit);
+                distance->mMaxDistance = std::max(distance->mMinDistance, s.maxLimit);
+            }
+            settings = distance;
+            break;
+        }
+        case JointType::Cone:
+        {
+            auto *cone = new JPH::ConeConstraintSettings();
+            cone->mPoint1 = cone->mPoint2 = point;
+            cone->mTwistAxis1 = cone->mTwistAxis2 = axis;
+            cone->mHalfConeAngle = glm::radians(std::clamp(s.coneAngle, 0.0f, 180.0f));
+            settings = cone;
+            break;
+        }
+        }
+
+        if (!settings) return nullptr;
+        return mBodyInterface->CreateConstraint(settings, body1, body2);
+    }
+
+    /**************************************************************************
+     * @brief
+     * Break joints that needed more than their BreakForce/BreakTorque.
+     *
+     * The solver's accumulated impulses of the last step are divided by
+     * the step length to get the force (N) and torque (N m) the joint
+     * applied. Broken joints are removed in one batch, flagged on their
+     * component and reported through events and the break callback.
+     *
+     * @param scene
+     * Scene whose JointComponents are updated.
+     * @param dt
+     * Step length in seconds.
+     **************************************************************************/
+    void PhysicsSystem::BreakOverloadedJoints(Scene *scene, float dt)
+    {
+        if (dt <= 0.0f) return;
+        float const invDt = 1.0f / dt;
+
+        JPH::Array<JPH::Ref<JPH::Constraint>> broken;
+
+        for (JointSlot &slot : mJoints)
+        {
+            JointSettings const &s = slot.settings;
+            if (!slot.constraint || (s.breakForce <= 0.0f && s.breakTorque <= 0.0f)) continue;
+
+            float force = 0.0f, torque = 0.0f;
+            JPH::TwoBodyConstraint const *c = slot.constraint.GetPtr();
+            switch (s.type)
+            {
+            case JointType::Fixed:
+            {
+                auto const *fixed = static_cast<JPH::FixedConstraint const *>(c);
+                force = fixed->GetTotalLambdaPosition().Length();
+                torque = fixed->GetTotalLambdaRotation().Length();
+                break;
+            }
+            case JointType::Hinge:
+            {
+                auto const *hinge = static_cast<JPH::HingeConstraint const *>(c);
+                JPH::Vector<2> const r = hinge->GetTotalLambdaRotation();
+                force = hinge->GetTotalLambdaPosition().Length();
+                torque = std::sqrt(r[0] * r[0] + r[1] * r[1]) + std::abs(hinge->GetTotalLambdaRotationLimits());
+                break;
+            }
+            case JointType::Slider:
+            {
+                auto const *slider = static_cast<JPH::SliderConstraint const *>(c);
+                JPH::Vector<2> const p = slider->GetTotalLambdaPosition();
+                force = std::sqrt(p[0] * p[0] + p[1] * p[1]) + std::abs(slider->GetTotalLambdaPositionLimits());
+                torque = slider->GetTotalLambdaRotation().Length();
+                break;
+            }
+            case JointType::Distance:
+                force = std::abs(static_cast<JPH::DistanceConstraint const *>(c)->GetTotalLambdaPosition());
+                break;
+            case JointType::Cone:
+            {
+                auto const *cone = static_cast<JPH::ConeConstraint const *>(c);
+                force = cone->GetTotalLambdaPosition().Length();
+                torque = std::abs(cone->GetTotalLambdaRotation());
+                break;
+            }
+            }
+
+            bool const overloaded = (s.breakForce > 0.0f && force * invDt > s.breakForce) ||
+                (s.breakTorque > 0.0f && torque * invDt > s.breakTorque);
+            if (!overloaded) continue;
+
+            broken.push_back(slot.constraint.GetPtr());
+            slot.constraint = nullptr;
+            mJointBreaks.push_back(JointBreakEvent{ slot.entity, s.connected });
+        }
+
+        if (broken.empty()) return;
+
+        JPH::Array<JPH::Constraint *> batch;
+        batch.reserve(broken.size());
+        for (JPH::Ref<JPH::Constraint> const &c : broken)
+            batch.push_back(c.GetPtr());
+        mPhysics.RemoveConstraints(batch.data(), static_cast<int>(batch.size()));
+        mStats.Joints -= static_cast<std::uint32_t>(broken.size());
+
+        auto &reg = scene->GetRegistry();
+        for (JointBreakEvent const &ev : mJointBreaks)
+            reg.get<JointComponent>(ev.entity).IsBroken = true;
+
+        if (!mJointBreakCallback) return;
+        for (JointBreakEvent const &ev : mJointBreaks)
+            mJointBreakCallback(scene, ev);
+    }
+
+    /**************************************************************************
+     * @brief
+     * Mirror enabled (Transform,Trigger) entities to static sensor bodies.
+     *
+     * Moved triggers are repositioned and resized ones get a new shape on
+     * the same body, so overlaps survive both. Triggers that were disabled,
+     * deactivated (pooled) or removed lose their body and report exits.
+     * Static sensors only detect awake bodies and never run collision
+     * detection themselves, so an idle trigger costs nothing per step.
+     *
+     * @param scene
+     * Scene to scan.
+     **************************************************************************/
+    void PhysicsSystem::BuildOrRefreshTriggers(Scene *scene)
+    {
+        auto &reg = scene->GetRegistry();
+        std::uint32_t const pass = ++mTriggerPass;
+
+        reg.view<TransformComponent, TriggerComponent>(entt::exclude<InactiveComponent>).each(
+            [&](EntityID e, TransformComponent &tc, TriggerComponent &trigger)
+            {
+                if (!trigger.Enabled) return;
+
+                std::uint32_t const entityIndex = static_cast<std::uint32_t>(entt::to_entity(e));
+                std::uint32_t const index = entityIndex < mTriggerSlotOfEntity.size() ? mTriggerSlotOfEntity[entityIndex] : NO_TRIGGER;
+                if (index == NO_TRIGGER || mTriggers[index].entity != e)
+                {
+                    CreateTriggerFor(e, tc, trigger);
+                    return;
+                }
+
+                TriggerSlot &slot = mTriggers[index];
+                slot.pass = pass;
+
+                if (slot.shape != trigger.Shape || slot.halfExtents != trigger.HalfExtents ||
+                    slot.radius != trigger.Radius || slot.scale != tc.Scale)
+                {
+                    slot.shape = trigger.Shape;
+                    slot.halfExtents = trigger.HalfExtents;
+                    slot.radius = trigger.Radius;
+                    slot.scale = tc.Scale;
+                    mBodyInterface->SetShape(slot.body, MakeTriggerShape(slot.shape, slot.halfExtents, slot.radius, slot.scale),
+                        false, JPH::EActivation::DontActivate);
+                }
+
+                if (slot.position != tc.Position || slot.rotation != tc.Rotation)
+                {
+                    slot.position = tc.Position;
+                    slot.rotation = tc.Rotation;
+                    mBodyInterface->SetPositionAndRotation(slot.body, ToJPHRVec3(tc.Position), ToJPHRotation(tc.Rotation),
+                        JPH::EActivation::DontActivate);
+                }
+            }
+        );
+
+        // Back to front so the slot swapped into a hole was already checked.
+        for (std::uint32_t i = static_cast<std::uint32_t>(mTriggers.size()); i-- > 0u;)
+        {
+            if (mTriggers[i].pass != pass)
+                DestroyTriggerSlot(i);
+        }
+    }
+
+    /**************************************************************************
+     * @brief
+     * Create the sensor body of a trigger and register its slot.
+     *
+     * @param e
+     * Entity identifier (stored as body user data).
+     * @param tc
+     * Transform (pose and scale).
+     * @param trigger
+     * Trigger settings.
+     **************************************************************************/
+    void PhysicsSystem::CreateTriggerFor(EntityID e, TransformComponent const &tc, TriggerComponent const &trigger)
+    {
+        TriggerSlot slot;
+        slot.entity = e;
+        slot.shape = trigger.Shape;
+        slot.halfExtents = trigger.HalfExtents;
+        slot.radius = trigger.Radius;
+        slot.scale = tc.Scale;
+        slot.position = tc.Position;
+        slot.rotation = tc.Rotation;
+        slot.pass = mTriggerPass;
+
+        JPH::BodyCreationSettings settings(
+            MakeTriggerShape(slot.shape, slot.halfExtents, slot.radius, slot.scale),
+            ToJPHRVec3(tc.Position),
+            ToJPHRotation(tc.Rotation),
+            JPH::EMotionType::Static,
+            Layers::SENSOR
+        );
+        settings.mIsSensor = true;
+        settings.mUserData = static_cast<JPH::uint64>(entt::to_integral(e));
+
+        slot.body = mBodyInterface->CreateAndAddBody(settings, JPH::EActivation::DontActivate);
+        if (slot.body.IsInvalid()) return;  // Out of bodies (phys.MaxBodies)
+
+        std::uint32_t const index = static_cast<std::uint32_t>(mTriggers.size());
+        mContactRecorder.SetSensor(slot.body, true);
+        std::uint32_t const entityIndex = static_cast<std::uint32_t>(entt::to_entity(e));
+        if (entityIndex >= mTriggerSlotOfEntity.size())
+            mTriggerSlotOfEntity.resize(entityIndex + 1u, NO_TRIGGER);
+        mTriggerSlotOfBody[slot.body.GetIndex()] = index;
+        mTriggerSlotOfEntity[entityIndex] = index;
+        mTriggers.push_back(std::move(slot));
+    }
+
+    /**************************************************************************
+     * @brief
+     * Destroy a trigger's sensor body and free its slot.
+     *
+     * Everything still inside gets an exit event. Jolt reports the lost
+     * contacts during the next step; they no longer match a slot (the body
+     * ID's sequence number differs even if its index is reused) and are
+     * dropped.
+     *
+     * @param index
+     * Slot index; the last slot is moved into it.
+     **************************************************************************/
+    void PhysicsSystem::DestroyTriggerSlot(std::uint32_t index)
+    {
+        TriggerSlot &slot = mTriggers[index];
+
+        for (TriggerOverlap const &o : slot.overlaps)
+            mTriggerEvents.push_back(TriggerEvent{ slot.entity, o.entity, TriggerEventType::Exit });
+
+        mBodyInterface->RemoveBody(slot.body);
+        mBodyInterface->DestroyBody(slot.body);
+        mContactRecorder.SetSensor(slot.body, false);
+        mTriggerSlotOfBody[slot.body.GetIndex()] = NO_TRIGGER;
+        mTriggerSlotOfEntity[static_cast<std::uint32_t>(entt::to_entity(slot.entity))] = NO_TRIGGER;
+
+        std::uint32_t const last = static_cast<std::uint32_t>(mTriggers.size()) - 1u;
+        if (index != last)
+        {
+            slot = std::move(mTriggers[last]);
+            mTriggerSlotOfBody[slot.body.GetIndex()] = index;
+            mTriggerSlotOfEntity[static_cast<std::uint32_t>(entt::to_entity(slot.entity))] = index;
+        }
+        mTriggers.pop_back();
+    }
+
+    /**************************************************************************
+     * @brief
+     * Look up the slot of a sensor body through the flat BodyID table.
+     *
+     * @param sensor
+     * Body ID as reported by the contact listener.
+     * @return
+     * Slot, or nullptr if the body is not a live trigger.
+     **************************************************************************/
+    PhysicsSystem::TriggerSlot *PhysicsSystem::FindTriggerSlot(JPH::BodyID sensor)
+    {
+        std::uint32_t const i = sensor.GetIndex();
+        if (i >= mTriggerSlotOfBody.size() || mTriggerSlotOfBody[i] == NO_TRIGGER) return nullptr;
+        TriggerSlot &slot = mTriggers[mTriggerSlotOfBody[i]];
+        return slot.body == sensor ? &slot : nullptr;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Build enter/exit events from the sensor contacts of the last step.
+     *
+     * The per-thread buffers are merged and sorted by (sensor, body) so all
+     * changes of a pair are adjacent; their sum is the net change of live
+     * sub-shape contacts. A pair enters when it goes from none to some and
+     * exits when it goes back to none, so several sub-shapes, or a contact
+     * lost and found within one step, produce at most one event.
+     *
+     * Jolt drops the contacts of a body that falls asleep. Such a body is
+     * kept as a dormant overlap instead of exiting; it exits if it is
+     * removed, or if it wakes up and a full step passes without it touching
+     * the trigger again.
+     **************************************************************************/
+    void PhysicsSystem::ProcessSensorContacts()
+    {
+        mSensorContacts.clear();
+        mContactRecorder.DrainSensorContacts(mSensorContacts);
+
+        auto const findOverlap = [](TriggerSlot &slot, JPH::BodyID body) -> TriggerOverlap *
+            {
+                for (TriggerOverlap &o : slot.overlaps)
+                    if (o.body == body) return &o;
+                return nullptr;
+            };
+        auto const exitOverlap = [&](TriggerSlot &slot, TriggerOverlap &o)
+            {
+                mTriggerEvents.push_back(TriggerEvent{ slot.entity, o.entity, TriggerEventType::Exit });
+                o = slot.overlaps.back();
+                slot.overlaps.pop_back();
+            };
+
+        if (!mSensorContacts.empty())
+        {
+            std::sort(mSensorContacts.begin(), mSensorContacts.end(),
+                [](SensorContact const &a, SensorContact const &b)
+                {
+                    if (a.sensor != b.sensor) return a.sensor < b.sensor;
+                    return a.other < b.other;
+                });
+
+            for (std::size_t i = 0; i < mSensorContacts.size();)
+            {
+                JPH::BodyID const sensor = mSensorContacts[i].sensor;
+                JPH::BodyID const other = mSensorContacts[i].other;
+                std::int32_t delta = 0;
+                for (; i < mSensorContacts.size() && mSensorContacts[i].sensor == sensor && mSensorContacts[i].other == other; ++i)
+                    delta += mSensorContacts[i].delta;
+
+                TriggerSlot *slot = delta != 0 ? FindTriggerSlot(sensor) : nullptr;
+                if (!slot) continue;
+
+                TriggerOverlap *o = findOverlap(*slot, other);
+                if (delta > 0)
+                {
+                    if (o)
+                    {
+                        // Already inside (or asleep inside): just more contacts.
+                        o->contacts += delta;
+                        o->dormant = false;
+                        continue;
+                    }
+                    TriggerOverlap overlap;
+                    overlap.body = other;
+                    overlap.entity = static_cast<EntityID>(mBodyInterface->GetUserData(other));
+                    overlap.contacts = delta;
+                    slot->overlaps.push_back(overlap);
+                    mTriggerEvents.push_back(TriggerEvent{ slot->entity, overlap.entity, TriggerEventType::Enter });
+                }
+                else if (o)
+                {
+                    o->contacts = std::max(0, o->contacts + delta);
+                    if (o->contacts > 0 || o->dormant) continue;
+
+                    if (mBodyInterface->IsAdded(other) && !mBodyInterface->IsActive(other))
+                    {
+                        o->dormant = true;
+                        o->wokeSeen = false;
+                        mDormantOverlaps.emplace_back(sensor, other);
+                    }
+                    else
+                    {
+                        exitOverlap(*slot, *o);
+                    }
+                }
+            }
+        }
+
+        // Re-check bodies asleep inside a trigger (usually none).
+        for (std::size_t i = 0; i < mDormantOverlaps.size();)
+        {
+            auto const [sensor, other] = mDormantOverlaps[i];
+            TriggerSlot *slot = FindTriggerSlot(sensor);
+            TriggerOverlap *o = slot ? findOverlap(*slot, other) : nullptr;
+
+            bool keep = false;
+            if (o && o->dormant)
+            {
+                if (!mBodyInterface->IsAdded(other))
+                    exitOverlap(*slot, *o);
+                else if (!mBodyInterface->IsActive(other))
+                    keep = true;
+                else if (!o->wokeSeen)
+                    keep = o->wokeSeen = true;
+                else
+                    exitOverlap(*slot, *o);
+            }
+
+            if (keep)
+            {
+                ++i;
+                continue;
+            }
+            mDormantOverlaps[i] = mDormantOverlaps.back();
+            mDormantOverlaps.pop_back();
+        }
+    }
+
+    /**************************************************************************
+     * @brief
+     * Deliver this step's trigger events to the ECS.
+     *
+     * OverlapCount is updated first for all events, so callbacks see the
+     * final state of the step. Enters also wake tasks waiting for a contact
+     * between the trigger and the body.
+     *
+     * @param scene
+     * Scene whose registry holds the TriggerComponents.
+     **************************************************************************/
+    void PhysicsSystem::DispatchTriggerEvents(Scene *scene)
+    {
+        if (mTriggerEvents.empty()) return;
+
+        auto &reg = scene->GetRegistry();
+        for (TriggerEvent const &ev : mTriggerEvents)
+        {
+            if (!reg.valid(ev.trigger)) continue;
+            auto *trigger = reg.try_get<TriggerComponent>(ev.trigger);
+            if (!trigger) continue;
+            if (ev.type == TriggerEventType::Enter) ++trigger->OverlapCount;
+            else if (trigger->OverlapCount > 0u) --trigger->OverlapCount;
+        }
+
+        TaskRunner &tasks = scene->GetTaskRunner();
+        if (tasks.HasContactWaiters())
+        {
+            for (TriggerEvent const &ev : mTriggerEvents)
+                if (ev.type == TriggerEventType::Enter)
+                    tasks.NotifyContact(ev.trigger, ev.other);
+        }
+
+        if (mTriggerCallback)
+        {
+            for (TriggerEvent const &ev : mTriggerEvents)
+                mTriggerCallback(scene, ev);
+        }
+    }
+
+    /**************************************************************************
+     * @brief
+     * Build a trigger's sensor shape, scaled by the Transform.
+     *
+     * Sizes are clamped to a millimetre so a zero extent still yields a
+     * valid shape. Box sensors use no convex radius (exact corners).
+     **************************************************************************/
+    JPH::Ref<JPH::Shape> PhysicsSystem::MakeTriggerShape(TriggerShape shape, glm::vec3 const &halfExtents, float radius, glm::vec3 const &scale)
+    {
+        constexpr float MIN_SIZE = 0.001f;
+        glm::vec3 const s = glm::abs(scale);
+
+        if (shape == TriggerShape::Sphere)
+        {
+            float const r = std::max(MIN_SIZE, radius * std::max(s.x, std::max(s.y, s.z)));
+            return JPH::Ref<JPH::Shape>(new JPH::SphereShape(r));
+        }
+
+        glm::vec3 const h = glm::max(halfExtents * s, glm::vec3(MIN_SIZE));
+        return JPH::Ref<JPH::Shape>(new JPH::BoxShape(ToJPHVec3(h), 0.0f));
+    }
+
+    /**************************************************************************
+     * @brief
+     * Save the world state of a frame into the snapshot ring.
+     *
+     * Static bodies are left out (they never move). Along with the Jolt
+     * state the frame records which entity owned which body and which
+     * joints existed, so a restore can check the world still matches.
+     *
+     * @param frame
+     * Frame number (increasing).
+     * @return
+     * True if saved.
+     **************************************************************************/
+    bool PhysicsSystem::SaveState(std::uint64_t frame)
+    {
+        if (mBodyInterface == nullptr) return false;
+        auto const start = std::chrono::steady_clock::now();
+
+        mSnapshotStream.Clear();
+        mPhysics.SaveState(mSnapshotStream, JPH::EStateRecorderState::All, &mSnapshotFilter);
+
+        mSnapshotTopology.bodies.clear();
+        for (auto const &kv : mBodyOf)
+            mSnapshotTopology.bodies.emplace_back(kv.first, kv.second);
+
+        mSnapshotTopology.joints.clear();
+        for (JointSlot const &slot : mJoints)
+        {
+            if (slot.constraint) mSnapshotTopology.joints.push_back(slot.constraint->GetUserData());
+        }
+        std::sort(mSnapshotTopology.joints.begin(), mSnapshotTopology.joints.end());
+
+        mSnapshotStats.LastRawBytes = mSnapshotStream.Bytes().size();
+        mSnapshotStats.LastStoredBytes = mSnapshots.Push(frame, mSnapshotStream.Bytes(), mSnapshotTopology);
+        mSnapshots.GetStats(mSnapshotStats);
+        mSnapshotStats.SaveMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return true;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Rewind the world to a saved frame.
+     *
+     * Jolt restores bodies and constraints in place, so every body and
+     * joint of the frame must still exist; this is checked before anything
+     * is touched. Joints and bodies created after the frame are removed
+     * first (joints before bodies), which also puts the remaining
+     * constraints back at the indices they were saved with.
+     *
+     * @param scene
+     * Scene whose components receive the restored state.
+     * @param frame
+     * Frame to restore.
+     * @return
+     * True if restored.
+     **************************************************************************/
+    bool PhysicsSystem::RestoreState(Scene *scene, std::uint64_t frame)
+    {
+        if (mBodyInterface == nullptr) return false;
+        auto const start = std::chrono::steady_clock::now();
+
+        PhysicsSnapshotTopology const *topology = mSnapshots.Decode(frame, mSnapshotStream.Bytes());
+        if (topology == nullptr)
+        {
+            LOG_WARNING("PhysicsSystem: frame ", frame, " is not in the snapshot ring");
+            return false;
+        }
+
+        for (auto const &[e, id] : topology->bodies)
+        {
+            auto it = mBodyOf.find(e);
+            if (it == mBodyOf.end() || it->second != id)
+            {
+                LOG_WARNING("PhysicsSystem: cannot restore frame ", frame, ", a body saved in it was destroyed");
+                return false;
+            }
+        }
+
+        auto const savedJoint = [&](JointSlot const &slot)
+            {
+                return std::binary_search(topology->joints.begin(), topology->joints.end(), slot.constraint->GetUserData());
+            };
+
+        std::size_t savedJoints = 0u;
+        for (JointSlot const &slot : mJoints)
+        {
+            if (slot.constraint && savedJoint(slot)) ++savedJoints;
+        }
+        if (savedJoints != topology->joints.size())
+        {
+            LOG_WARNING("PhysicsSystem: cannot restore frame ", frame, ", a joint saved in it was removed or broken");
+            return false;
+        }
+
+        // Joints created since the frame go back to pending.
+        JPH::Array<JPH::Ref<JPH::Constraint>> released;
+        for (JointSlot &slot : mJoints)
+        {
+            if (!slot.constraint || savedJoint(slot)) continue;
+            released.push_back(slot.constraint.GetPtr());
+            slot.constraint = nullptr;
+        }
+        if (!released.empty())
+        {
+            JPH::Array<JPH::Constraint *> batch;
+            batch.reserve(released.size());
+            for (JPH::Ref<JPH::Constraint> const &c : released)
+                batch.push_back(c.GetPtr());
+            mPhysics.RemoveConstraints(batch.data(), static_cast<int>(batch.size()));
+        }
+
+        // Bodies created since the frame are destroyed (saved entities all have a body, see above).
+        if (mBodyOf.size() != topology->bodies.size())
+        {
+            mRestoreKeep.assign(mRestoreKeep.size(), 0u);
+            for (auto const &entry : topology->bodies)
+            {
+                std::uint32_t const index = static_cast<std::uint32_t>(entt::to_entity(entry.first));
+                if (index >= mRestoreKeep.size()) mRestoreKeep.resize(index + 1u, 0u);
+                mRestoreKeep[index] = 1u;
+            }
+
+            for (auto it = mBodyOf.begin(); it != mBodyOf.end();)
+            {
+                std::uint32_t const index = static_cast<std::uint32_t>(entt::to_entity(it->first));
+                if (index < mRestoreKeep.size() && mRestoreKeep[index] != 0u)
+                {
+                    ++it;
+                    continue;
+                }
+                DestroyBodyFor(it->first);
+                it = mBodyOf.erase(it);
+            }
+        }
+
+        mSnapshotStream.Rewind();
+        if (!mPhysics.RestoreState(mSnapshotStream))
+        {
+            LOG_ERROR("PhysicsSystem: restoring frame ", frame, " failed, the physics world may be inconsistent");
+            return false;
+        }
+
+        auto &reg = scene->GetRegistry();
+        for (auto const &[e, id] : topology->bodies)
+        {
+            auto *tc = reg.try_get<TransformComponent>(e);
+            auto *rb = reg.try_get<RigidbodyComponent>(e);
+            if (tc != nullptr && rb != nullptr) PullBody(e, id, *tc, *rb);
+        }
+
+        mSnapshotStats.RestoreMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return true;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Hash the state of all non-static bodies (FNV-1a over Jolt's saved
+     * body state: poses, velocities, sleep state).
+     *
+     * @return
+     * 64-bit state hash.
+     **************************************************************************/
+    std::uint64_t PhysicsSystem::ComputeStateHash()
+    {
+        mSnapshotStream.Clear();
+        mPhysics.SaveState(mSnapshotStream, JPH::EStateRecorderState::Bodies, &mSnapshotFilter);
+
+        std::uint64_t hash = 14695981039346656037ull;
+        for (std::uint8_t b : mSnapshotStream.Bytes())
+        {
+            hash ^= b;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /**************************************************************************
+     * @brief
+     * Simulate, rewind, simulate again and compare state hashes.
+     *
+     * Only the Jolt world steps; ECS components, joints breaking and
+     * contact events are left out, so a mismatch points at the physics
+     * input itself (e.g. bodies added in a different order, or a build
+     * without JPH_CROSS_PLATFORM_DETERMINISTIC when comparing machines).
+     *
+     * @param frames
+     * Steps to simulate (twice).
+     * @param dt
+     * Step length in seconds.
+     * @return
+     * True if both runs matched.
+     **************************************************************************/
+    bool PhysicsSystem::CheckDeterminism(std::uint32_t frames, float dt)
+    {
+        if (mBodyInterface == nullptr || frames == 0u) return true;
+
+        SnapshotStream origin;
+        mPhysics.SaveState(origin);
+
+        std::vector<std::uint64_t> hashes;
+        hashes.reserve(frames);
+        for (std::uint32_t i = 0u; i < frames; ++i)
+        {
+            mPhysics.Update(dt, 1, mTempAllocator, mJobSystem);
+            hashes.push_back(ComputeStateHash());
+        }
+
+        origin.Rewind();
+        mPhysics.RestoreState(origin);
+
+        std::uint32_t diverged = frames;
+        for (std::uint32_t i = 0u; i < frames && diverged == frames; ++i)
+        {
+            mPhysics.Update(dt, 1, mTempAllocator, mJobSystem);
+            if (ComputeStateHash() != hashes[i]) diverged = i;
+        }
+
+        origin.Rewind();
+        mPhysics.RestoreState(origin);
+
+        // Contacts reported by the check steps belong to no real frame.
+        std::vector<PhysicsContact> contacts;
+        mContactRecorder.Drain(contacts);
+        std::vector<SensorContact> sensorContacts;
+        mContactRecorder.DrainSensorContacts(sensorContacts);
+
+        if (diverged < frames)
+        {
+            LOG_WARNING("PhysicsSystem: determinism check failed, resimulation diverged at step ", diverged + 1u, " of ", frames);
+            return false;
+        }
+        return true;
     }
 } // namespace Engine
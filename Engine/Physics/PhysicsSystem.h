@@ -8,10 +8,15 @@
 
             Provides:
             - Broadphase/object layer definitions and filters
+            - Contact and trigger (sensor) event recording
+            - Joint (constraint) mirroring with break events
+            - World snapshots for rollback and determinism checks
+            - Debug drawing of bodies and constraints (phys.DebugDraw)
             - GLM <-> Jolt math conversion helpers (+ Euler-deg support)
             - Mesh-driven collider construction contract (callbacks + DTO)
             - PhysicsSystem ECS bridge: world bootstrap, body mirroring,
-              shape caching, kinematic/dynamic sync, and lifecycle control
+              shape caching, compound bodies from child colliders,
+              kinematic/dynamic sync, and lifecycle control
 
             Units: meters, kilograms, seconds. Coordinate system must match
             TransformComponent usage engine-wide.
@@ -25,9 +30,13 @@ written consent of DigiPen Institute of Technology is prohibited.
 
 // --- STL (alphabetical) ---
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
@@ -44,15 +53,20 @@ written consent of DigiPen Institute of Technology is prohibited.
 #include <Jolt/Core/Factory.h>
 #include <Jolt/Core/JobSystemThreadPool.h>
 #include <Jolt/Core/TempAllocator.h>
+#include <Jolt/Physics/Body/Body.h>
 #include <Jolt/Physics/Body/BodyCreationSettings.h>
 #include <Jolt/Physics/Body/BodyInterface.h>
 #include <Jolt/Physics/Body/MotionProperties.h>
 #include <Jolt/Physics/Collision/BroadPhase/BroadPhaseLayer.h>
+#include <Jolt/Physics/Collision/ContactListener.h>
 #include <Jolt/Physics/Collision/ObjectLayer.h>
 #include <Jolt/Physics/Collision/Shape/BoxShape.h>
 #include <Jolt/Physics/Collision/Shape/ConvexHullShape.h>
 #include <Jolt/Physics/Collision/Shape/MeshShape.h>
 #include <Jolt/Physics/Collision/Shape/ScaledShape.h>
+#include <Jolt/Physics/Collision/Shape/SphereShape.h>
+#include <Jolt/Physics/Collision/Shape/StaticCompoundShape.h>
+#include <Jolt/Physics/Constraints/TwoBodyConstraint.h>
 #include <Jolt/Physics/PhysicsSystem.h>
 #include <Jolt/RegisterTypes.h>
 
@@ -60,6 +74,8 @@ written consent of DigiPen Institute of Technology is prohibited.
 #include "../ECS/Components.h"
 #include "../ECS/Scene.h"
 #include "../ECS/System.h"
+#include "PhysicsDebugRenderer.h"
+#include "PhysicsSnapshot.h"
 
 namespace Engine
 {
@@ -72,7 +88,9 @@ namespace Engine
     {
         static constexpr JPH::ObjectLayer NON_MOVING{ 0 };  //!< Static / Kinematic
         static constexpr JPH::ObjectLayer MOVING{ 1 };      //!< Dynamic
-        static constexpr JPH::ObjectLayer NUM_LAYERS{ 2 };
+        static constexpr JPH::ObjectLayer SENSOR{ 2 };      //!< Trigger volumes (static sensor bodies)
+        static constexpr JPH::ObjectLayer CHARACTER{ 3 };   //!< Character presence bodies, only seen by sensors
+        static constexpr JPH::ObjectLayer NUM_LAYERS{ 4 };
     }
 
     /**************************************************************************
@@ -82,39 +100,47 @@ namespace Engine
      * Mapping:
      *  - NON_MOVING -> BP 0
      *  - MOVING     -> BP 1
+     *  - SENSOR     -> BP 2
+     *  - CHARACTER  -> BP 1
      *
      * Rationale:
-     *  Avoid static-static pairs at BP; permit dynamic against both.
+     *  Avoid static-static pairs at BP; permit dynamic against both. Sensors
+     *  get their own bin so only the layers that can trigger them visit it.
      **************************************************************************/
     class BPLayerInterfaceImpl final : public JPH::BroadPhaseLayerInterface
     {
     public:
         BPLayerInterfaceImpl()
-            : mObjectToBroadPhase{ JPH::BroadPhaseLayer{ 0 }, JPH::BroadPhaseLayer{ 1 } },
-            mNumBroadPhaseLayers{ 2u }
+            : mObjectToBroadPhase{ JPH::BroadPhaseLayer{ 0 }, JPH::BroadPhaseLayer{ 1 }, JPH::BroadPhaseLayer{ 2 }, JPH::BroadPhaseLayer{ 1 } },
+            mNumBroadPhaseLayers{ 3u }
         {}
         JPH::uint GetNumBroadPhaseLayers() const override { return mNumBroadPhaseLayers; }
         JPH::BroadPhaseLayer GetBroadPhaseLayer(JPH::ObjectLayer layer) const override { return mObjectToBroadPhase[layer]; }
 #if defined(JPH_EXTERNAL_PROFILE) || defined(JPH_PROFILE_ENABLED)
         const char *GetBroadPhaseLayerName(JPH::BroadPhaseLayer layer) const override
         {
-            switch (layer.GetValue()) { case 0: return "NON_MOVING"; case 1: return "MOVING"; default: return "UNKNOWN"; }
+            switch (layer.GetValue()) { case 0: return "NON_MOVING"; case 1: return "MOVING"; case 2: return "SENSOR"; default: return "UNKNOWN"; }
         }
 #endif
     private:
-        JPH::BroadPhaseLayer mObjectToBroadPhase[2];
+        JPH::BroadPhaseLayer mObjectToBroadPhase[Layers::NUM_LAYERS];
         JPH::uint            mNumBroadPhaseLayers{};
     };
 
     /**************************************************************************
      * @brief
      * Object-layer pair filter for narrowphase. Disables static-static.
+     * Sensors only pair with dynamic and character bodies; character bodies
+     * only exist to be seen by sensors.
      **************************************************************************/
     class ObjectLayerPairFilterImpl final : public JPH::ObjectLayerPairFilter
     {
     public:
         bool ShouldCollide(JPH::ObjectLayer a, JPH::ObjectLayer b) const override
         {
+            if (a == Layers::SENSOR) return b == Layers::MOVING || b == Layers::CHARACTER;
+            if (b == Layers::SENSOR) return a == Layers::MOVING || a == Layers::CHARACTER;
+            if (a == Layers::CHARACTER || b == Layers::CHARACTER) return false;
             if (a == Layers::NON_MOVING && b == Layers::NON_MOVING) return false;
             return true;
         }
@@ -126,7 +152,9 @@ namespace Engine
      *
      * Policy:
      *  - NON_MOVING vs BP: only MOVING bin (1)
-     *  - MOVING     vs BP: both bins (0 and 1)
+     *  - MOVING     vs BP: all bins (0, 1 and 2)
+     *  - SENSOR     vs BP: only MOVING bin (1)
+     *  - CHARACTER  vs BP: only SENSOR bin (2)
      **************************************************************************/
     class ObjectVsBroadPhaseLayerFilterImpl final : public JPH::ObjectVsBroadPhaseLayerFilter
     {
@@ -137,12 +165,281 @@ namespace Engine
             switch (layer)
             {
             case Layers::NON_MOVING: return b == 1u;
-            case Layers::MOVING:     return (b == 0u) || (b == 1u);
+            case Layers::MOVING:     return b <= 2u;
+            case Layers::SENSOR:     return b == 1u;
+            case Layers::CHARACTER:  return b == 2u;
             default:                 return false;
             }
         }
     };
 
+    /**************************************************************************
+     * @brief
+     * Pair of entities whose bodies started touching during a step.
+     **************************************************************************/
+    struct PhysicsContact
+    {
+        entt::entity a{ entt::null };
+        entt::entity b{ entt::null };
+    };
+
+    /**************************************************************************
+     * @brief
+     * Raw sensor contact change recorded during a step: +1 when a sub-shape
+     * pair between a sensor and another body appears, -1 when it goes away.
+     **************************************************************************/
+    struct SensorContact
+    {
+        JPH::BodyID   sensor;
+        JPH::BodyID   other;
+        std::int32_t  delta{};
+    };
+
+    /**************************************************************************
+     * @brief
+     * Contact listener collecting new contacts for the main thread.
+     *
+     * Jolt calls it from its worker threads during the step; pairs are keyed
+     * by the entity stored in each body's user data (set by CreateBodyFor)
+     * and drained on the main thread after the step.
+     *
+     * Sensor pairs are kept apart: they go to per-thread buffers (no lock,
+     * no sharing between workers) and are turned into trigger enter/exit
+     * events by PhysicsSystem. Buffers belong to the recorder and are handed
+     * out again by ResetThreadSlots, so recreated job systems reuse them. OnContactRemoved cannot touch the bodies, so
+     * sensors are recognised there through a flat table indexed by BodyID
+     * index, which is only written between steps.
+     **************************************************************************/
+    class ContactRecorder final : public JPH::ContactListener
+    {
+    public:
+        void OnContactAdded(JPH::Body const &b1, JPH::Body const &b2, JPH::ContactManifold const &, JPH::ContactSettings &) override
+        {
+            if (b1.IsSensor() || b2.IsSensor())
+            {
+                bool const first = b1.IsSensor();
+                RecordSensorContact(first ? b1.GetID() : b2.GetID(), first ? b2.GetID() : b1.GetID(), 1);
+                return;
+            }
+
+            PhysicsContact c{ static_cast<entt::entity>(b1.GetUserData()), static_cast<entt::entity>(b2.GetUserData()) };
+            std::lock_guard<std::mutex> lock(mMutex);
+            mAdded.push_back(c);
+        }
+
+        void OnContactRemoved(JPH::SubShapeIDPair const &pair) override
+        {
+            JPH::BodyID const id1 = pair.GetBody1ID();
+            JPH::BodyID const id2 = pair.GetBody2ID();
+            if (IsSensorBody(id1))      RecordSensorContact(id1, id2, -1);
+            else if (IsSensorBody(id2)) RecordSensorContact(id2, id1, -1);
+        }
+
+        /**********************************************************************
+         * @brief
+         * Move the contacts recorded since the last drain into out.
+         **********************************************************************/
+        void Drain(std::vector<PhysicsContact> &out)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            out.swap(mAdded);
+            mAdded.clear();
+        }
+
+        /**********************************************************************
+         * @brief
+         * Append the sensor contacts recorded since the last drain to out
+         * (main thread, outside the step).
+         **********************************************************************/
+        void DrainSensorContacts(std::vector<SensorContact> &out)
+        {
+            unsigned const used = GetThreadBuffersInUse();
+            for (unsigned i = 0; i < used; ++i)
+            {
+                std::vector<SensorContact> &buf = mSensorContacts[i].contacts;
+                out.insert(out.end(), buf.begin(), buf.end());
+                buf.clear();
+            }
+
+            std::lock_guard<std::mutex> lock(mMutex);
+            out.insert(out.end(), mSensorOverflow.begin(), mSensorOverflow.end());
+            mSensorOverflow.clear();
+        }
+
+        /**********************************************************************
+         * @brief
+         * Size the sensor table for the world's body capacity.
+         **********************************************************************/
+        void ResetSensors(std::uint32_t maxBodies) { mIsSensor.assign(maxBodies, 0u); }
+
+        /**********************************************************************
+         * @brief
+         * Threads holding a sensor buffer since the last ResetThreadSlots.
+         **********************************************************************/
+        unsigned GetThreadBuffersInUse() const
+        {
+            return std::min(mNextThreadSlot.load(std::memory_order_acquire), MAX_THREAD_BUFFERS);
+        }
+
+        /**********************************************************************
+         * @brief
+         * Release every thread's buffer claim (main thread, no step running).
+         * Call when the job system is (re)created; its workers claim again.
+         * Contacts not drained yet are kept.
+         **********************************************************************/
+        void ResetThreadSlots()
+        {
+            for (ThreadSensorContacts &buf : mSensorContacts)
+                buf.owner.store(std::thread::id{}, std::memory_order_relaxed);
+            mNextThreadSlot.store(0u, std::memory_order_release);
+            mGeneration = sNextGeneration.fetch_add(1u, std::memory_order_relaxed) + 1u;
+        }
+
+        /**********************************************************************
+         * @brief
+         * Mark or unmark a body as a sensor (main thread, between steps).
+         **********************************************************************/
+        void SetSensor(JPH::BodyID id, bool sensor)
+        {
+            std::uint32_t const i = id.GetIndex();
+            if (i < mIsSensor.size()) mIsSensor[i] = sensor ? 1u : 0u;
+        }
+
+    private:
+        static constexpr unsigned MAX_THREAD_BUFFERS = 64;
+
+        /**********************************************************************
+         * @brief
+         * One buffer per thread, on its own cache line.
+         **********************************************************************/
+        struct alignas(64) ThreadSensorContacts
+        {
+            std::atomic<std::thread::id> owner{};   //!< Claiming thread, none if free
+            std::vector<SensorContact>   contacts;
+        };
+
+        bool IsSensorBody(JPH::BodyID id) const
+        {
+            std::uint32_t const i = id.GetIndex();
+            return i < mIsSensor.size() && mIsSensor[i] != 0u;
+        }
+
+        /**********************************************************************
+         * @brief
+         * Buffer of the calling thread, claimed on its first contact since the
+         * last ResetThreadSlots; MAX_THREAD_BUFFERS if all are taken.
+         **********************************************************************/
+        unsigned ThreadSlot()
+        {
+            // The last lookup is cached per thread; a thread stepping several
+            // worlds (a waiting main thread runs jobs) finds its claim again.
+            thread_local std::uint64_t cachedGeneration = 0u;
+            thread_local unsigned      cachedSlot = 0u;
+            if (cachedGeneration == mGeneration) return cachedSlot;
+
+            std::thread::id const self = std::this_thread::get_id();
+            unsigned const used = std::min(mNextThreadSlot.load(std::memory_order_acquire), MAX_THREAD_BUFFERS);
+            unsigned slot = MAX_THREAD_BUFFERS;
+            for (unsigned i = 0; i < used && slot == MAX_THREAD_BUFFERS; ++i)
+                if (mSensorContacts[i].owner.load(std::memory_order_relaxed) == self) slot = i;
+
+            if (slot == MAX_THREAD_BUFFERS)
+            {
+                if (used == MAX_THREAD_BUFFERS) return MAX_THREAD_BUFFERS;  // Not cached: retried after a reset
+                slot = mNextThreadSlot.fetch_add(1u, std::memory_order_acq_rel);
+                if (slot >= MAX_THREAD_BUFFERS) return MAX_THREAD_BUFFERS;
+                mSensorContacts[slot].owner.store(self, std::memory_order_relaxed);
+            }
+            cachedGeneration = mGeneration;
+            cachedSlot = slot;
+            return slot;
+        }
+
+        void RecordSensorContact(JPH::BodyID sensor, JPH::BodyID other, std::int32_t delta)
+        {
+            // More threads than buffers fall back to the lock.
+            unsigned const slot = ThreadSlot();
+            if (slot < MAX_THREAD_BUFFERS)
+            {
+                mSensorContacts[slot].contacts.push_back(SensorContact{ sensor, other, delta });
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mMutex);
+            mSensorOverflow.push_back(SensorContact{ sensor, other, delta });
+        }
+
+        // Tells recorders and resets apart in the per-thread cache; never reused
+        static inline std::atomic<std::uint64_t> sNextGeneration{ 0u };
+
+        std::atomic<unsigned>       mNextThreadSlot{ 0u };
+        std::uint64_t               mGeneration{ sNextGeneration.fetch_add(1u, std::memory_order_relaxed) + 1u };
+
+        std::mutex                  mMutex;
+        std::vector<PhysicsContact> mAdded;
+
+        std::array<ThreadSensorContacts, MAX_THREAD_BUFFERS> mSensorContacts;
+        std::vector<SensorContact>  mSensorOverflow;
+        std::vector<std::uint8_t>   mIsSensor;  //!< By BodyID index
+    };
+
+    /**************************************************************************
+     * @brief
+     * Whether a body entered or left a trigger.
+     **************************************************************************/
+    enum class TriggerEventType : std::uint8_t
+    {
+        Enter,
+        Exit
+    };
+
+    /**************************************************************************
+     * @brief
+     * A body entering or leaving a TriggerComponent volume during a step.
+     **************************************************************************/
+    struct TriggerEvent
+    {
+        entt::entity     trigger{ entt::null };
+        entt::entity     other{ entt::null };
+        TriggerEventType type{ TriggerEventType::Enter };
+    };
+
+    /**************************************************************************
+     * @brief
+     * Trigger event callback, called on the main thread after each step.
+     **************************************************************************/
+    using TriggerEventFn = std::function<void(Scene *, TriggerEvent const &)>;
+
+    /**************************************************************************
+     * @brief
+     * A JointComponent that broke during a step.
+     **************************************************************************/
+    struct JointBreakEvent
+    {
+        entt::entity entity{ entt::null };     //!< Entity owning the JointComponent
+        entt::entity connected{ entt::null };  //!< Its ConnectedEntity (null = world)
+    };
+
+    /**************************************************************************
+     * @brief
+     * Joint break callback, called on the main thread after each step.
+     **************************************************************************/
+    using JointBreakFn = std::function<void(Scene *, JointBreakEvent const &)>;
+
+    /**************************************************************************
+     * @brief
+     * Per-step physics cost, for profiling and benchmark scenes.
+     **************************************************************************/
+    struct PhysicsStats
+    {
+        std::uint32_t Bodies{};         //!< Bodies in the world (excluding triggers)
+        std::uint32_t Joints{};         //!< Constraints in the world
+        std::uint32_t PendingJoints{};  //!< Joints waiting for a body (not broken)
+        double        StepMs{};         //!< Wall time of the Jolt step
+        double        MicrosPerJoint{}; //!< StepMs / Joints, in microseconds (joint-heavy scenes)
+        double        PeakStepMs{};     //!< Largest StepMs since start
+        std::uint32_t SensorThreadBuffers{};  //!< Threads that recorded trigger contacts lock-free
+    };
+
     /**************************************************************************
      * @brief
      * Convert GLM/Jolt math types (position/rotation helpers).
@@ -199,6 +496,8 @@ namespace Engine
      * Fields:
      *  - vertices: model-space vertex positions
      *  - indices:  triangle index buffer (3*i .. 3*i+2)
+     *  - hulls:    optional baked convex decomposition; when present, convex
+     *              colliders are a compound of these instead of one hull
      *  - scale:    non-uniform scaling to apply (via ScaledShape)
      *  - doubleSided: if true, triangle mesh is treated as double-sided
      *  - preferConvex: hint to build a convex hull (over triangle mesh)
@@ -208,6 +507,7 @@ namespace Engine
     {
         std::vector<glm::vec3>     vertices;
         std::vector<std::uint32_t> indices;
+        std::vector<std::vector<glm::vec3>> hulls;
         glm::vec3                  scale{ 1.0f, 1.0f, 1.0f };
         bool                       doubleSided{};
         bool                       preferConvex{};
@@ -220,6 +520,26 @@ namespace Engine
      **************************************************************************/
     using FetchMeshInfoFn = std::function<bool(Scene *, entt::entity, MeshBuildInfo &)>;
 
+    struct MeshResource;
+
+    /**************************************************************************
+     * @brief
+     * Fill a MeshBuildInfo from a loaded mesh, for FetchMeshInfo callbacks.
+     * Uses the collision data baked by the asset compiler when present
+     * (convex pieces and/or simplified triangle mesh) and the render
+     * vertices otherwise.
+     *
+     * @param mesh
+     * Loaded mesh resource.
+     * @param key
+     * Stable shape-cache key (e.g. the mesh GUID).
+     * @param info
+     * Receives vertices, indices, hulls and key; scale/flags are untouched.
+     * @return
+     * False if the mesh has no usable geometry.
+     **************************************************************************/
+    bool FillMeshBuildInfo(MeshResource const &mesh, std::uint64_t key, MeshBuildInfo &info);
+
     /**************************************************************************
      * @brief
      * Physics system bridging ECS and Jolt.
@@ -227,6 +547,8 @@ namespace Engine
      * Responsibilities:
      *  - Bootstraps Jolt world (allocators, job system, filters, gravity)
      *  - Mirrors (Transform, Rigidbody) entities to Jolt bodies
+     *  - Mirrors (Transform, Trigger) entities to static sensor bodies and
+     *    reports enter/exit events once per step
      *  - Supports mesh/convex colliders via callbacks and a shape cache
      *  - Push/pull loop for kinematic poses and dynamic velocities
      **************************************************************************/
@@ -293,6 +615,131 @@ namespace Engine
          **********************************************************************/
         void SetFetchMeshInfoCallback(FetchMeshInfoFn fn) { mFetchMeshInfo = std::move(fn); }
 
+        /**********************************************************************
+         * @brief
+         * Contacts that began during the last step (one entry per new
+         * sub-shape pair, so a pair can appear more than once).
+         **********************************************************************/
+        std::vector<PhysicsContact> const &GetContactsBegun() const { return mContactsBegun; }
+
+        /**********************************************************************
+         * @brief
+         * Trigger enter/exit events of the last step, one per body pair and
+         * change (a body touching a trigger with several sub-shapes enters
+         * once).
+         **********************************************************************/
+        std::vector<TriggerEvent> const &GetTriggerEvents() const { return mTriggerEvents; }
+
+        /**********************************************************************
+         * @brief
+         * Install a callback run for each trigger event after the step,
+         * once TriggerComponent::OverlapCount is up to date.
+         *
+         * @param fn
+         * Callback to set (moved in).
+         **********************************************************************/
+        void SetTriggerCallback(TriggerEventFn fn) { mTriggerCallback = std::move(fn); }
+
+        /**********************************************************************
+         * @brief
+         * Joints that broke during the last step.
+         **********************************************************************/
+        std::vector<JointBreakEvent> const &GetJointBreakEvents() const { return mJointBreaks; }
+
+        /**********************************************************************
+         * @brief
+         * Install a callback run for each joint that breaks, after
+         * JointComponent::IsBroken is set.
+         *
+         * @param fn
+         * Callback to set (moved in).
+         **********************************************************************/
+        void SetJointBreakCallback(JointBreakFn fn) { mJointBreakCallback = std::move(fn); }
+
+        /**********************************************************************
+         * @brief
+         * Cost of the last step.
+         **********************************************************************/
+        PhysicsStats const &GetStats() const { return mStats; }
+
+        /**********************************************************************
+         * @brief
+         * Save the world state of a frame into the snapshot ring (the last
+         * phys.SnapshotFrames frames are kept). Call between updates.
+         * Saving a frame at or before the newest saved one drops the newer
+         * ones, so resimulation after a rollback simply saves again.
+         *
+         * @param frame
+         * Frame number (increasing).
+         * @return
+         * True if saved.
+         **********************************************************************/
+        bool SaveState(std::uint64_t frame);
+
+        /**********************************************************************
+         * @brief
+         * Rewind the world to a saved frame: Jolt bodies, contacts and
+         * constraints, the entity -> body mapping and the Transform/
+         * Rigidbody mirror. Bodies and joints created since that frame are
+         * removed (and rebuilt on the next update if their entities still
+         * qualify). Trigger overlaps are not rewound.
+         *
+         * @param scene
+         * Scene whose components receive the restored state.
+         * @param frame
+         * Frame to restore.
+         * @return
+         * False, with the world untouched, if the frame is not stored or a
+         * body or joint saved in it no longer exists.
+         **********************************************************************/
+        bool RestoreState(Scene *scene, std::uint64_t frame);
+
+        /**********************************************************************
+         * @brief
+         * Check if a frame can be restored.
+         **********************************************************************/
+        bool HasState(std::uint64_t frame) const { return mSnapshots.Has(frame); }
+
+        /**********************************************************************
+         * @brief
+         * Hash of the state of all non-static bodies, to compare runs (or
+         * peers) frame by frame.
+         **********************************************************************/
+        std::uint64_t ComputeStateHash();
+
+        /**********************************************************************
+         * @brief
+         * Determinism self-check: simulate a number of steps from the
+         * current state, rewind, simulate them again and compare state
+         * hashes step by step. The world is rewound afterwards, so the
+         * check has no lasting effect.
+         *
+         * @param frames
+         * Steps to simulate (twice).
+         * @param dt
+         * Step length in seconds.
+         * @return
+         * True if both runs matched.
+         **********************************************************************/
+        bool CheckDeterminism(std::uint32_t frames, float dt);
+
+        /**********************************************************************
+         * @brief
+         * Snapshot memory use and save/restore cost.
+         **********************************************************************/
+        PhysicsSnapshotStats const &GetSnapshotStats() const { return mSnapshotStats; }
+
+        /**********************************************************************
+         * @brief
+         * Jolt world and step resources, for systems that run their own
+         * queries against it (e.g. CharacterControllerSystem). Valid between
+         * OnInit and OnShutdown.
+         **********************************************************************/
+        JPH::PhysicsSystem &GetJoltSystem() { return mPhysics; }
+        JPH::JobSystem *GetJobSystem() const { return mJobSystem; }
+        ObjectVsBroadPhaseLayerFilterImpl const &GetObjectVsBroadPhaseLayerFilter() const { return mObjVsBPLayerFilter; }
+        ObjectLayerPairFilterImpl const &GetObjectLayerPairFilter() const { return mObjPairFilter; }
+
     private:
         using EntityID = entt::entity;
 
@@ -307,8 +754,168 @@ namespace Engine
         ObjectVsBroadPhaseLayerFilterImpl mObjVsBPLayerFilter;
         ObjectLayerPairFilterImpl         mObjPairFilter;
 
+        // --- Contact reporting ---
+        ContactRecorder             mContactRecorder;
+        std::vector<PhysicsContact> mContactsBegun;  //!< Drained after each step
+
         // --- ECS <-> Jolt mapping ---
         std::unordered_map<EntityID, JPH::BodyID> mBodyOf;
+        std::unordered_map<EntityID, JPH::BodyID> mParkedBodyOf;  //!< Pooled (inactive) entities, bodies out of broadphase
+
+        /**********************************************************************
+         * @brief
+         * Rigidbody material/motion settings as applied to a body.
+         **********************************************************************/
+        struct BodyMaterial
+        {
+            float                  friction{};
+            float                  restitution{};
+            float                  linearDamping{};
+            float                  angularDamping{};
+            bool                   useGravity{};
+            bool                   allowSleeping{};
+            RigidbodyMotionQuality quality{};
+            bool operator==(BodyMaterial const &o) const = default;
+        };
+
+        /**********************************************************************
+         * @brief
+         * A child collider merged into a compound body: its pose relative
+         * to the body and the scale of its ancestors (root included).
+         **********************************************************************/
+        struct CompoundPart
+        {
+            EntityID  entity{ entt::null };
+            glm::vec3 position{};
+            glm::quat rotation{};
+            glm::vec3 scale{};
+            bool operator==(CompoundPart const &o) const = default;
+        };
+
+        /**********************************************************************
+         * @brief
+         * What the ECS and the body last agreed on. The push phase only
+         * touches a body when gameplay changed something since, so resting
+         * bodies are not locked every frame and can fall asleep (re-setting
+         * a kinematic pose resets its sleep timer and keeps everything on it
+         * awake).
+         **********************************************************************/
+        struct BodySync
+        {
+            BodyMaterial              material;
+            glm::vec3                 position{};
+            glm::quat                 rotation{};
+            glm::vec3                 velocity{};
+            glm::vec3                 angularVelocity{};
+            std::uint32_t             generation{};  //!< PooledComponent::Generation the body was placed for
+            bool                      compound{};  //!< Shape merges child colliders
+            std::vector<CompoundPart> parts;       //!< Children in the shape (compound only)
+        };
+
+        std::unordered_map<EntityID, BodySync> mSyncOf;  //!< Per mirrored or parked body
+        std::vector<CompoundPart>              mCompoundScratch;
+
+        /**********************************************************************
+         * @brief
+         * A body inside a trigger. contacts counts live sub-shape pairs;
+         * dormant means Jolt dropped them because the body fell asleep
+         * inside, which is not an exit.
+         **********************************************************************/
+        struct TriggerOverlap
+        {
+            JPH::BodyID  body;
+            EntityID     entity{ entt::null };
+            std::int32_t contacts{};
+            bool         dormant{};
+            bool         wokeSeen{};  //!< Dormant body seen awake once without re-entering
+        };
+
+        /**********************************************************************
+         * @brief
+         * A trigger's sensor body, the settings it was built from and what
+         * is inside it. Slots are packed; the overlap list is usually tiny.
+         **********************************************************************/
+        struct TriggerSlot
+        {
+            EntityID                    entity{ entt::null };
+            JPH::BodyID                 body;
+            TriggerShape                shape{};
+            glm::vec3                   halfExtents{};
+            float                       radius{};
+            glm::vec3                   scale{};
+            glm::vec3                   position{};
+            glm::quat                   rotation{};
+            std::uint32_t               pass{};  //!< Last refresh that saw the entity
+            std::vector<TriggerOverlap> overlaps;
+        };
+
+        static constexpr std::uint32_t NO_TRIGGER = ~0u;
+        static constexpr std::uint32_t NO_JOINT = ~0u;
+
+        // --- Triggers ---
+        std::vector<TriggerSlot>                     mTriggers;
+        std::vector<std::uint32_t>                   mTriggerSlotOfEntity;  //!< Entity index -> slot
+        std::vector<std::uint32_t>                   mTriggerSlotOfBody;    //!< BodyID index -> slot
+        std::vector<SensorContact>                   mSensorContacts;       //!< Scratch, drained each step
+        std::vector<std::pair<JPH::BodyID, JPH::BodyID>> mDormantOverlaps;  //!< (sensor, body) to re-check
+        std::vector<TriggerEvent>                    mTriggerEvents;        //!< Last step's events
+        std::uint32_t                                mTriggerPass{};
+        TriggerEventFn                               mTriggerCallback;
+
+        /**********************************************************************
+         * @brief
+         * JointComponent settings a constraint was built from; any change
+         * rebuilds the constraint.
+         **********************************************************************/
+        struct JointSettings
+        {
+            JointType type{};
+            EntityID  connected{ entt::null };
+            glm::vec3 anchor{};
+            glm::vec3 connectedAnchor{};
+            glm::vec3 axis{};
+            bool      useLimits{};
+            float     minLimit{};
+            float     maxLimit{};
+            float     coneAngle{};
+            float     breakForce{};
+            float     breakTorque{};
+            bool operator==(JointSettings const &o) const = default;
+        };
+
+        /**********************************************************************
+         * @brief
+         * A JointComponent and its constraint (null while pending or broken).
+         **********************************************************************/
+        struct JointSlot
+        {
+            EntityID                         entity{ entt::null };
+            JointSettings                    settings;
+            JPH::Ref<JPH::TwoBodyConstraint> constraint;
+            std::uint32_t                    pass{};  //!< Last refresh that saw the component
+        };
+
+        // --- Joints ---
+        std::vector<JointSlot>       mJoints;
+        std::vector<std::uint32_t>   mJointSlotOfEntity;  //!< Entity index -> slot
+        std::vector<JointBreakEvent> mJointBreaks;        //!< Last step's breaks
+        std::uint32_t                mJointPass{};
+        JointBreakFn                 mJointBreakCallback;
+
+        PhysicsStats                 mStats;
+
+        // --- Snapshots ---
+        PhysicsSnapshotRing       mSnapshots;
+        SnapshotStream            mSnapshotStream;    //!< Scratch for save/restore/hash
+        SnapshotBodyFilter        mSnapshotFilter;
+        PhysicsSnapshotTopology   mSnapshotTopology;  //!< Scratch for save
+        PhysicsSnapshotStats      mSnapshotStats;
+        std::vector<std::uint8_t> mRestoreKeep;       //!< Entity index -> body kept by a restore
+        std::uint64_t             mJointSerial{};     //!< Last constraint serial (constraint user data)
+
+#ifdef JPH_DEBUG_RENDERER
+        std::unique_ptr<PhysicsDebugRenderer> mDebugRenderer;  //!< Created on first debug draw
+#endif
 
         /**********************************************************************
          * @brief
@@ -317,7 +924,7 @@ namespace Engine
         struct CacheKey
         {
             std::uint64_t key{};
-            std::uint8_t  kind{};  //!< 0 = tri-mesh, 1 = convex
+            std::uint8_t  kind{};  //!< 0 = tri-mesh, 1 = convex, 2 = compound of baked hulls
             std::uint8_t  ds{};    //!< 0 = single-sided, 1 = double-sided
             bool operator==(CacheKey const &o) const { return key == o.key && kind == o.kind && ds == o.ds; }
         };
@@ -366,12 +973,48 @@ namespace Engine
          **********************************************************************/
         static JPH::ObjectLayer ToObjectLayer(RigidbodyComponent const &rb) { return rb.IsKinematic ? Layers::NON_MOVING : Layers::MOVING; }
 
+        /**********************************************************************
+         * @brief
+         * Translate Rigidbody motion quality to Jolt.
+         *
+         * @param quality
+         * Component setting.
+         * @return
+         * Discrete or LinearCast (continuous collision detection).
+         **********************************************************************/
+        static JPH::EMotionQuality ToMotionQuality(RigidbodyMotionQuality quality) { return quality == RigidbodyMotionQuality::LinearCast ? JPH::EMotionQuality::LinearCast : JPH::EMotionQuality::Discrete; }
+
+        /**********************************************************************
+         * @brief
+         * Gather the material/motion settings of a Rigidbody.
+         *
+         * @param rb
+         * Rigidbody component.
+         * @return
+         * Settings to compare against BodySync::material.
+         **********************************************************************/
+        static BodyMaterial ToBodyMaterial(RigidbodyComponent const &rb);
+
+        /**********************************************************************
+         * @brief
+         * Apply friction, restitution, damping, gravity factor, sleeping and
+         * motion quality to an existing body.
+         *
+         * @param id
+         * Body to update.
+         * @param m
+         * Settings to apply.
+         **********************************************************************/
+        void ApplyBodyMaterial(JPH::BodyID id, BodyMaterial const &m);
+
         /**********************************************************************
          * @brief
          * Ensure Jolt bodies exist precisely for eligible entities.
          *
          * Creates new bodies for (Transform,Rigidbody) entities without one
          * and destroys bodies for entities that are no longer eligible.
+         * Entities tagged InactiveComponent (pooled) have their body parked
+         * outside the broadphase instead, and re-added when reactivated.
          *
          * @param scene
          * Scene to scan.
@@ -398,6 +1041,181 @@ namespace Engine
          **********************************************************************/
         void DestroyBodyFor(EntityID e);
 
+        /**********************************************************************
+         * @brief
+         * Remove an entity's body from the broadphase but keep it alive so
+         * the next spawn of the pooled entity skips body creation.
+         *
+         * @param e
+         * Entity identifier (must be in mBodyOf).
+         **********************************************************************/
+        void ParkBodyFor(EntityID e);
+
+        /**********************************************************************
+         * @brief
+         * Re-add a parked body at the entity's current pose and velocity.
+         *
+         * @param scene
+         * Scene handle used to read Transform/Rigidbody.
+         * @param e
+         * Entity identifier (must be in mParkedBodyOf).
+         **********************************************************************/
+        void UnparkBodyFor(Scene *scene, EntityID e);
+
+        /**********************************************************************
+         * @brief
+         * Track JointComponents and take out, in one batch, the constraints
+         * that must go before bodies are refreshed: their settings changed,
+         * they were marked broken, or one of their bodies is about to be
+         * destroyed or parked.
+         *
+         * @param scene
+         * Scene to scan.
+         **********************************************************************/
+        void ReleaseStaleJoints(Scene *scene);
+
+        /**********************************************************************
+         * @brief
+         * Create, in one batch, the constraints of joints whose bodies all
+         * exist (after bodies are refreshed).
+         *
+         * @param scene
+         * Scene handle used to read Transforms.
+         **********************************************************************/
+        void CreatePendingJoints(Scene *scene);
+
+        /**********************************************************************
+         * @brief
+         * Build the Jolt constraint of a joint from the bodies' current
+         * poses.
+         *
+         * @param scene
+         * Scene handle used to read Transforms.
+         * @param slot
+         * Joint to build.
+         * @param body1
+         * Body of the connected entity (invalid = world).
+         * @param body2
+         * Body of the joint's entity.
+         * @return
+         * Constraint, not yet added to the world.
+         **********************************************************************/
+        JPH::Ref<JPH::TwoBodyConstraint> MakeJointConstraint(Scene *scene, JointSlot const &slot, JPH::BodyID body1, JPH::BodyID body2);
+
+        /**********************************************************************
+         * @brief
+         * Break the joints whose last-step force or torque exceeded their
+         * limits, then report them.
+         *
+         * @param scene
+         * Scene whose JointComponents are updated.
+         * @param dt
+         * Step length in seconds (impulse -> force).
+         **********************************************************************/
+        void BreakOverloadedJoints(Scene *scene, float dt);
+
+        /**********************************************************************
+         * @brief
+         * Write a body's state back to its Transform and Rigidbody, and
+         * record it in the sync mirror.
+         *
+         * @param e
+         * Entity identifier (must be in mBodyOf).
+         * @param id
+         * Its body.
+         * @param tc
+         * Transform to write.
+         * @param rb
+         * Rigidbody to write.
+         **********************************************************************/
+        void PullBody(EntityID e, JPH::BodyID id, TransformComponent &tc, RigidbodyComponent &rb);
+
+        /**********************************************************************
+         * @brief
+         * Queue the world's bodies (and constraints) to DebugDraw as set by
+         * phys.DebugDraw. No-op without JPH_DEBUG_RENDERER.
+         **********************************************************************/
+        void DrawDebug();
+
+        /**********************************************************************
+         * @brief
+         * Gather the constraint-relevant settings of a JointComponent.
+         **********************************************************************/
+        static JointSettings ToJointSettings(JointComponent const &joint);
+
+        /**********************************************************************
+         * @brief
+         * Ensure sensor bodies exist precisely for enabled triggers, and
+         * follow changes to their transform and shape.
+         *
+         * @param scene
+         * Scene to scan.
+         **********************************************************************/
+        void BuildOrRefreshTriggers(Scene *scene);
+
+        /**********************************************************************
+         * @brief
+         * Create a static sensor body for a trigger and give it a slot.
+         *
+         * @param e
+         * Entity identifier.
+         * @param tc
+         * Transform (pose and scale).
+         * @param trigger
+         * Trigger settings.
+         **********************************************************************/
+        void CreateTriggerFor(EntityID e, TransformComponent const &tc, TriggerComponent const &trigger);
+
+        /**********************************************************************
+         * @brief
+         * Destroy a trigger's sensor body, reporting an exit for everything
+         * still inside, and pack the slot array.
+         *
+         * @param slot
+         * Slot index.
+         **********************************************************************/
+        void DestroyTriggerSlot(std::uint32_t slot);
+
+        /**********************************************************************
+         * @brief
+         * Slot of a sensor body, or nullptr if the body is not (or no longer)
+         * a trigger.
+         **********************************************************************/
+        TriggerSlot *FindTriggerSlot(JPH::BodyID sensor);
+
+        /**********************************************************************
+         * @brief
+         * Turn the sensor contacts of the last step into enter/exit events.
+         **********************************************************************/
+        void ProcessSensorContacts();
+
+        /**********************************************************************
+         * @brief
+         * Update OverlapCount, wake contact waiters and run the trigger
+         * callback for this step's events.
+         *
+         * @param scene
+         * Scene whose TriggerComponents are updated.
+         **********************************************************************/
+        void DispatchTriggerEvents(Scene *scene);
+
+        /**********************************************************************
+         * @brief
+         * Build the sensor shape of a trigger.
+         *
+         * @param shape
+         * Box or sphere.
+         * @param halfExtents
+         * Box half size.
+         * @param radius
+         * Sphere radius.
+         * @param scale
+         * Transform scale (sphere uses the largest axis).
+         * @return
+         * Ref-counted shape.
+         **********************************************************************/
+        static JPH::Ref<JPH::Shape> MakeTriggerShape(TriggerShape shape, glm::vec3 const &halfExtents, float radius, glm::vec3 const &scale);
+
         /**********************************************************************
          * @brief
          * Construct or retrieve a cached collider shape for an entity.
@@ -416,9 +1234,69 @@ namespace Engine
          * Transform (read-only).
          * @param rb
          * Rigidbody (read-only).
+         * @param fallbackBox
+         * Return a unit box when neither callback yields a shape.
+         * @return
+         * Ref-counted shape (null only when fallbackBox is false).
+         **********************************************************************/
+        JPH::Ref<JPH::Shape> MakeShapeForEntity(Scene *scene, EntityID e, TransformComponent const &tc, RigidbodyComponent const &rb, bool fallbackBox = true);
+
+        /**********************************************************************
+         * @brief
+         * Shape of a new body: the entity's own shape, or for a
+         * CompoundChildren rigidbody a compound of its child colliders.
+         *
+         * @param scene
+         * Scene handle.
+         * @param e
+         * Entity identifier.
+         * @param tc
+         * Transform (read-only).
+         * @param rb
+         * Rigidbody (read-only).
+         * @param parts
+         * Receives the merged children (empty for plain bodies).
          * @return
-         * Ref-counted shape (never null; falls back to box).
+         * Ref-counted shape (never null).
+         **********************************************************************/
+        JPH::Ref<JPH::Shape> MakeBodyShape(Scene *scene, EntityID e, TransformComponent const &tc, RigidbodyComponent const &rb, std::vector<CompoundPart> &parts);
+
+        /**********************************************************************
+         * @brief
+         * Collect the descendants of a compound root that have no
+         * rigidbody of their own, with poses relative to the root body.
+         *
+         * @param scene
+         * Scene handle.
+         * @param root
+         * Compound root entity.
+         * @param tc
+         * Root Transform (its scale applies to the children).
+         * @param parts
+         * Receives the children, depth first.
+         **********************************************************************/
+        void GatherCompoundParts(Scene *scene, EntityID root, TransformComponent const &tc, std::vector<CompoundPart> &parts) const;
+
+        /**********************************************************************
+         * @brief
+         * Build a StaticCompoundShape from a root's own shape and its parts.
+         *
+         * @return
+         * Compound shape, or the root's plain shape if no part has one.
+         **********************************************************************/
+        JPH::Ref<JPH::Shape> BuildCompoundShape(Scene *scene, EntityID root, TransformComponent const &tc, RigidbodyComponent const &rb, std::vector<CompoundPart> const &parts);
+
+        /**********************************************************************
+         * @brief
+         * Rebuild a body's shape when CompoundChildren was toggled or its
+         * set of children or their local transforms changed.
+         **********************************************************************/
+        void RefreshCompoundShape(Scene *scene, EntityID e, JPH::BodyID id, TransformComponent const &tc, RigidbodyComponent const &rb, BodySync &sync);
+
+        /**********************************************************************
+         * @brief
+         * Replace a body's shape, keeping the Rigidbody mass.
          **********************************************************************/
-        JPH::Ref<JPH::Shape> MakeShapeForEntity(Scene *scene, EntityID e, TransformComponent const &tc, RigidbodyComponent const &rb);
+        void ApplyShape(JPH::BodyID id, JPH::Shape const *shape, float mass);
     };
 } // namespace Engine
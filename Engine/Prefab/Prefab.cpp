@@ -21,10 +21,12 @@ namespace Engine {
 
     void Prefab::SetEntityData(const std::string& jsonData) {
         m_EntityData = jsonData;
+        m_Revision++;
     }
 
     void Prefab::SetSceneData(const std::string& jsonData) {
         m_SceneData = jsonData;
+        m_Revision++;
     }
 
 } // namespace Engine
\ No newline at end of file
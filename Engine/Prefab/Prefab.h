@@ -12,6 +12,7 @@
 #ifndef __PREFAB_H__
 #define __PREFAB_H__
 
+#include <cstdint>
 #include <string>
 #include <memory>
 #include "../xresource_guid/include/xresource_guid.h"
@@ -60,6 +61,12 @@ namespace Engine {
         const std::string& GetSourcePath() const { return m_SourcePath; }
         void SetSourcePath(const std::string& path) { m_SourcePath = path; }
 
+        // Incremented whenever entity/scene data changes (invalidates cached defaults)
+        uint32_t GetRevision() const { return m_Revision; }
+
+        // Invalidate cached defaults without new data (a nested prefab changed)
+        void MarkDirty() { m_Revision++; }
+
     private:
         xresource::instance_guid m_GUID;
         PrefabType m_Type;
@@ -72,6 +79,8 @@ namespace Engine {
 
         // For scene prefabs - track the root entity
         xresource::instance_guid m_RootEntityGUID;
+
+        uint32_t m_Revision = 0;
     };
 
 } // namespace Engine
@@ -0,0 +1,62 @@
+/**
+ * @file PrefabInstanceIndex.cpp
+ * @brief Implementation of PrefabInstanceIndex
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "PrefabInstanceIndex.h"
+#include "../Component/PrefabComponent.h"
+
+#include <algorithm>
+
+namespace Engine {
+
+    void PrefabInstanceIndex::Connect(entt::registry& registry) {
+        registry.on_construct<PrefabComponent>().connect<&PrefabInstanceIndex::OnConstruct>(*this);
+        registry.on_destroy<PrefabComponent>().connect<&PrefabInstanceIndex::OnDestroy>(*this);
+    }
+
+    void PrefabInstanceIndex::Disconnect(entt::registry& registry) {
+        registry.on_construct<PrefabComponent>().disconnect<&PrefabInstanceIndex::OnConstruct>(*this);
+        registry.on_destroy<PrefabComponent>().disconnect<&PrefabInstanceIndex::OnDestroy>(*this);
+        m_Instances.clear();
+    }
+
+    const std::vector<entt::entity>& PrefabInstanceIndex::GetInstances(xresource::instance_guid prefabGUID) const {
+        static const std::vector<entt::entity> s_Empty;
+        auto it = m_Instances.find(prefabGUID);
+        return (it != m_Instances.end()) ? it->second : s_Empty;
+    }
+
+    void PrefabInstanceIndex::OnConstruct(entt::registry& registry, entt::entity entity) {
+        const auto& prefabComp = registry.get<PrefabComponent>(entity);
+        if (!prefabComp.IsValid()) {
+            return;
+        }
+        m_Instances[prefabComp.PrefabGUID].push_back(entity);
+    }
+
+    void PrefabInstanceIndex::OnDestroy(entt::registry& registry, entt::entity entity) {
+        const auto& prefabComp = registry.get<PrefabComponent>(entity);
+        auto it = m_Instances.find(prefabComp.PrefabGUID);
+        if (it == m_Instances.end()) {
+            return;
+        }
+
+        // Swap-remove, instance order is irrelevant
+        auto& instances = it->second;
+        auto pos = std::find(instances.begin(), instances.end(), entity);
+        if (pos != instances.end()) {
+            *pos = instances.back();
+            instances.pop_back();
+        }
+        if (instances.empty()) {
+            m_Instances.erase(it);
+        }
+    }
+
+} // namespace Engine
@@ -0,0 +1,63 @@
+/**
+ * @file PrefabInstanceIndex.h
+ * @brief Reverse index from prefab GUID to the instances in a scene
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+#ifndef __PREFAB_INSTANCE_INDEX_H__
+#define __PREFAB_INSTANCE_INDEX_H__
+
+#include "../Asset/ResourceTypes.h"
+#include <entt/entt.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+    /**
+     * @brief Tracks which entities instantiate which prefab
+     * @details Kept up to date through EnTT construct/destroy signals on PrefabComponent,
+     *          so a prefab change only visits its own instances instead of the whole scene.
+     */
+    class PrefabInstanceIndex {
+    public:
+        PrefabInstanceIndex() = default;
+
+        PrefabInstanceIndex(const PrefabInstanceIndex&) = delete;
+        PrefabInstanceIndex& operator=(const PrefabInstanceIndex&) = delete;
+
+        /**
+         * @brief Connect to the PrefabComponent signals of a registry
+         */
+        void Connect(entt::registry& registry);
+
+        /**
+         * @brief Disconnect from the registry signals
+         */
+        void Disconnect(entt::registry& registry);
+
+        /**
+         * @brief Get the instances of a prefab (empty if none)
+         */
+        const std::vector<entt::entity>& GetInstances(xresource::instance_guid prefabGUID) const;
+
+        /**
+         * @brief Number of prefabs with at least one instance
+         */
+        size_t GetPrefabCount() const { return m_Instances.size(); }
+
+    private:
+        void OnConstruct(entt::registry& registry, entt::entity entity);
+        void OnDestroy(entt::registry& registry, entt::entity entity);
+
+        std::unordered_map<xresource::instance_guid, std::vector<entt::entity>> m_Instances;
+    };
+
+} // namespace Engine
+
+#endif // __PREFAB_INSTANCE_INDEX_H__
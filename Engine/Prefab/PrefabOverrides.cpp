@@ -0,0 +1,529 @@
+/**
+ * @file PrefabOverrides.cpp
+ * @brief Implementation of PrefabOverrides
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "PrefabOverrides.h"
+#include "PrefabRegistry.h"
+#include "../ECS/Scene.h"
+#include "../Component/PrefabComponent.h"
+#include "../Serialization/PrefabInstantiator.h"
+#include "../Serialization/ReflectionRegistry.h"
+#include "../Utility/Logger.h"
+
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+    namespace {
+
+        constexpr uint8_t OVERRIDE_FORMAT_VERSION = 1;
+
+        const uint32_t PREFAB_COMPONENT_HASH = HashReflectionName("PrefabComponent");
+
+        /**
+         * @brief What changed between two revisions of a prefab's reference instance
+         */
+        struct PrefabPatch {
+            std::vector<std::pair<const ComponentMetadata*, const PropertyBase*>> Properties;
+            std::vector<const ComponentMetadata*> AddedComponents;
+            std::vector<const ComponentMetadata*> RemovedComponents;
+
+            /// No previous revision to diff against: compare every property
+            bool FullRefresh = false;
+
+            bool IsEmpty() const {
+                return !FullRefresh && Properties.empty() && AddedComponents.empty() && RemovedComponents.empty();
+            }
+        };
+
+        /**
+         * @brief Reference instances of entity prefabs, kept in a private scene
+         */
+        struct DefaultsCache {
+            struct Entry {
+                entt::entity Handle = entt::null;
+                uint32_t Revision = 0;
+                PrefabPatch Patch;  ///< Changes introduced by the current revision
+            };
+
+            Scene DefaultsScene{ "PrefabDefaults" };
+            std::unordered_map<xresource::instance_guid, Entry> Entries;
+        };
+
+        DefaultsCache& GetDefaultsCache() {
+            static DefaultsCache cache;
+            return cache;
+        }
+
+        // ----- Binary helpers -----
+
+        template<typename T>
+        void WritePod(std::vector<uint8_t>& out, const T& value) {
+            const size_t offset = out.size();
+            out.resize(offset + sizeof(T));
+            std::memcpy(out.data() + offset, &value, sizeof(T));
+        }
+
+        template<typename T>
+        bool ReadPod(const std::vector<uint8_t>& in, size_t& cursor, T& value) {
+            if (cursor + sizeof(T) > in.size()) return false;
+            std::memcpy(&value, in.data() + cursor, sizeof(T));
+            cursor += sizeof(T);
+            return true;
+        }
+
+        const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+        std::string Base64Encode(const std::vector<uint8_t>& data) {
+            std::string out;
+            out.reserve(((data.size() + 2) / 3) * 4);
+
+            size_t i = 0;
+            for (; i + 2 < data.size(); i += 3) {
+                uint32_t n = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+                out.push_back(BASE64_CHARS[(n >> 18) & 63]);
+                out.push_back(BASE64_CHARS[(n >> 12) & 63]);
+                out.push_back(BASE64_CHARS[(n >> 6) & 63]);
+                out.push_back(BASE64_CHARS[n & 63]);
+            }
+            if (i < data.size()) {
+                uint32_t n = data[i] << 16;
+                if (i + 1 < data.size()) n |= data[i + 1] << 8;
+                out.push_back(BASE64_CHARS[(n >> 18) & 63]);
+                out.push_back(BASE64_CHARS[(n >> 12) & 63]);
+                out.push_back(i + 1 < data.size() ? BASE64_CHARS[(n >> 6) & 63] : '=');
+                out.push_back('=');
+            }
+            return out;
+        }
+
+        bool Base64Decode(const std::string& text, std::vector<uint8_t>& out) {
+            auto decodeChar = [](char c) -> int {
+                if (c >= 'A' && c <= 'Z') return c - 'A';
+                if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+                if (c >= '0' && c <= '9') return c - '0' + 52;
+                if (c == '+') return 62;
+                if (c == '/') return 63;
+                return -1;
+            };
+
+            if (text.size() % 4 != 0) return false;
+            out.clear();
+            out.reserve(text.size() / 4 * 3);
+
+            for (size_t i = 0; i < text.size(); i += 4) {
+                int v[4];
+                int padding = 0;
+                for (int k = 0; k < 4; ++k) {
+                    char c = text[i + k];
+                    if (c == '=') { v[k] = 0; padding++; continue; }
+                    v[k] = decodeChar(c);
+                    if (v[k] < 0) return false;
+                }
+                uint32_t n = (v[0] << 18) | (v[1] << 12) | (v[2] << 6) | v[3];
+                out.push_back(static_cast<uint8_t>((n >> 16) & 0xFF));
+                if (padding < 2) out.push_back(static_cast<uint8_t>((n >> 8) & 0xFF));
+                if (padding < 1) out.push_back(static_cast<uint8_t>(n & 0xFF));
+            }
+            return true;
+        }
+
+        /**
+         * @brief Resolves (component, property) hashes to reflection data, memoized
+         */
+        class PropertyResolver {
+        public:
+            struct Resolved {
+                const ComponentMetadata* Component = nullptr;
+                const PropertyBase* Property = nullptr;
+            };
+
+            const Resolved& Resolve(uint32_t componentHash, uint32_t propertyHash) {
+                uint64_t key = (static_cast<uint64_t>(componentHash) << 32) | propertyHash;
+                auto it = m_Cache.find(key);
+                if (it != m_Cache.end()) return it->second;
+
+                Resolved resolved;
+                resolved.Component = ReflectionRegistry::Get().GetMetadataByHash(componentHash);
+                if (resolved.Component) {
+                    resolved.Property = resolved.Component->FindProperty(propertyHash);
+                }
+                return m_Cache.emplace(key, resolved).first->second;
+            }
+
+        private:
+            std::unordered_map<uint64_t, Resolved> m_Cache;
+        };
+
+        void ApplyWithResolver(entt::registry& registry, entt::entity entity,
+            const PrefabComponent& prefabComp, PropertyResolver& resolver) {
+
+            for (uint32_t componentHash : prefabComp.DeletedComponents) {
+                if (const ComponentMetadata* meta = ReflectionRegistry::Get().GetMetadataByHash(componentHash)) {
+                    meta->Remove(registry, entity);
+                }
+            }
+
+            for (const auto& override : prefabComp.Overrides) {
+                const auto& resolved = resolver.Resolve(override.ComponentHash, override.PropertyHash);
+                if (!resolved.Property) {
+                    LOG_WARNING("PrefabOverrides: Unknown property in override (component 0x",
+                        std::hex, override.ComponentHash, ", property 0x", override.PropertyHash, std::dec, ")");
+                    continue;
+                }
+                if (resolved.Property->GetType() != override.Type) {
+                    LOG_WARNING("PrefabOverrides: Type mismatch for override '", resolved.Property->GetName(), "'");
+                    continue;
+                }
+
+                void* component = resolved.Component->Get(registry, entity);
+                if (!component) {
+                    continue;
+                }
+
+                if (override.Offset + override.Size > prefabComp.OverrideData.size() ||
+                    !resolved.Property->ReadBinary(component, prefabComp.OverrideData.data() + override.Offset, override.Size)) {
+                    LOG_WARNING("PrefabOverrides: Malformed value for override '", resolved.Property->GetName(), "'");
+                }
+            }
+        }
+
+        /**
+         * @brief Bring the reference instance of a prefab up to date
+         * @details When the prefab revision changed, the new reference instance is
+         *          diffed against the previous one and the result stored as the entry patch.
+         * @return Cache entry, or nullptr if the prefab is missing or not an entity prefab
+         */
+        const DefaultsCache::Entry* RefreshDefaults(xresource::instance_guid prefabGUID) {
+            auto prefab = PrefabRegistry::Get().GetPrefab(prefabGUID);
+            if (!prefab || prefab->GetType() != PrefabType::Entity) {
+                return nullptr;
+            }
+
+            DefaultsCache& cache = GetDefaultsCache();
+            auto& registry = cache.DefaultsScene.GetRegistry();
+
+            entt::entity previous = entt::null;
+            auto it = cache.Entries.find(prefabGUID);
+            if (it != cache.Entries.end()) {
+                if (it->second.Revision == prefab->GetRevision() && registry.valid(it->second.Handle)) {
+                    return &it->second;
+                }
+                previous = it->second.Handle;
+            }
+
+            Entity defaults = PrefabInstantiator::InstantiateEntityPrefab(&cache.DefaultsScene, prefabGUID);
+            if (!defaults) {
+                return nullptr;
+            }
+
+            // Reference instances are not instances: keep them out of refresh passes
+            defaults.RemoveComponent<PrefabComponent>();
+
+            DefaultsCache::Entry& entry = cache.Entries[prefabGUID];
+            entry.Handle = defaults;
+            entry.Revision = prefab->GetRevision();
+            entry.Patch = PrefabPatch{};
+
+            // Diff the old reference instance against the new one so instances only
+            // receive what actually changed in the prefab
+            if (previous == entt::null || !registry.valid(previous)) {
+                entry.Patch.FullRefresh = true;
+                return &entry;
+            }
+
+            for (const auto& [typeIndex, meta] : ReflectionRegistry::Get().GetAllMetadata()) {
+                if (meta->GetNameHash() == PREFAB_COMPONENT_HASH) {
+                    continue;
+                }
+
+                void* before = meta->Get(registry, previous);
+                void* after = meta->Get(registry, defaults);
+
+                if (after && !before) {
+                    entry.Patch.AddedComponents.push_back(meta.get());
+                }
+                else if (before && !after) {
+                    entry.Patch.RemovedComponents.push_back(meta.get());
+                }
+                else if (before && after) {
+                    for (const auto& property : meta->GetProperties()) {
+                        if (!property->Equals(before, after)) {
+                            entry.Patch.Properties.emplace_back(meta.get(), property.get());
+                        }
+                    }
+                }
+            }
+
+            registry.destroy(previous);
+            return &entry;
+        }
+
+    } // namespace
+
+    bool PrefabOverrides::Compute(Scene* scene, Entity instance) {
+        if (!scene || !instance.HasComponent<PrefabComponent>()) {
+            LOG_WARNING("PrefabOverrides: Entity is not a prefab instance");
+            return false;
+        }
+
+        auto& prefabComp = instance.GetComponent<PrefabComponent>();
+        Entity defaults = GetPrefabDefaults(prefabComp.PrefabGUID);
+        if (!defaults) {
+            return false;
+        }
+
+        auto& registry = scene->GetRegistry();
+        auto& defaultsRegistry = GetDefaultsCache().DefaultsScene.GetRegistry();
+
+        prefabComp.ClearModifications();
+
+        std::vector<uint8_t> value;
+        for (const auto& [typeIndex, meta] : ReflectionRegistry::Get().GetAllMetadata()) {
+            if (meta->GetNameHash() == PREFAB_COMPONENT_HASH) {
+                continue;
+            }
+
+            void* current = meta->Get(registry, instance);
+            void* original = meta->Get(defaultsRegistry, defaults);
+
+            if (current && !original) {
+                prefabComp.MarkComponentAdded(meta->GetNameHash());
+                continue;
+            }
+            if (!current && original) {
+                prefabComp.MarkComponentDeleted(meta->GetNameHash());
+                continue;
+            }
+            if (!current) {
+                continue;
+            }
+
+            for (const auto& property : meta->GetProperties()) {
+                if (property->Equals(current, original)) {
+                    continue;
+                }
+
+                value.clear();
+                property->WriteBinary(current, value);
+                prefabComp.SetPropertyOverride(meta->GetNameHash(), property->GetNameHash(),
+                    property->GetType(), value.data(), static_cast<uint32_t>(value.size()));
+            }
+        }
+
+        return true;
+    }
+
+    void PrefabOverrides::Apply(Scene* scene, Entity instance) {
+        if (!scene || !instance.HasComponent<PrefabComponent>()) {
+            LOG_WARNING("PrefabOverrides: Entity is not a prefab instance");
+            return;
+        }
+
+        PropertyResolver resolver;
+        ApplyWithResolver(scene->GetRegistry(), instance, instance.GetComponent<PrefabComponent>(), resolver);
+    }
+
+    size_t PrefabOverrides::ApplyAll(Scene* scene) {
+        if (!scene) {
+            return 0;
+        }
+
+        auto& registry = scene->GetRegistry();
+        PropertyResolver resolver;
+        size_t count = 0;
+
+        for (auto [entity, prefabComp] : registry.view<PrefabComponent>().each()) {
+            if (!prefabComp.HasModifications()) {
+                continue;
+            }
+            ApplyWithResolver(registry, entity, prefabComp, resolver);
+            count++;
+        }
+
+        LOG_DEBUG("PrefabOverrides: Applied overrides to ", count, " instance(s)");
+        return count;
+    }
+
+    size_t PrefabOverrides::RefreshInstances(Scene* scene, xresource::instance_guid prefabGUID) {
+        if (!scene) {
+            return 0;
+        }
+
+        const auto* entry = RefreshDefaults(prefabGUID);
+        if (!entry || entry->Patch.IsEmpty()) {
+            return 0;
+        }
+
+        const auto& instances = scene->GetPrefabInstanceIndex().GetInstances(prefabGUID);
+        if (instances.empty()) {
+            return 0;
+        }
+
+        const PrefabPatch& patch = entry->Patch;
+        auto& registry = scene->GetRegistry();
+        auto& defaultsRegistry = GetDefaultsRegistry();
+        const entt::entity defaults = entry->Handle;
+
+        auto copyProperty = [&](const ComponentMetadata* meta, const PropertyBase* property,
+            const PrefabComponent& prefabComp, void* current) {
+            if (prefabComp.FindPropertyOverride(meta->GetNameHash(), property->GetNameHash())) {
+                return;
+            }
+            void* original = meta->Get(defaultsRegistry, defaults);
+            if (original && !property->Equals(current, original)) {
+                property->CopyValue(current, original);
+            }
+        };
+
+        for (entt::entity entity : instances) {
+            const auto& prefabComp = registry.get<PrefabComponent>(entity);
+
+            for (const ComponentMetadata* meta : patch.RemovedComponents) {
+                // Instance-added components are kept
+                if (!prefabComp.IsComponentAdded(meta->GetNameHash())) {
+                    meta->Remove(registry, entity);
+                }
+            }
+
+            for (const ComponentMetadata* meta : patch.AddedComponents) {
+                if (prefabComp.IsComponentDeleted(meta->GetNameHash()) || meta->Get(registry, entity)) {
+                    continue;
+                }
+                void* current = meta->Emplace(registry, entity);
+                for (const auto& property : meta->GetProperties()) {
+                    copyProperty(meta, property.get(), prefabComp, current);
+                }
+            }
+
+            if (patch.FullRefresh) {
+                for (const auto& [typeIndex, meta] : ReflectionRegistry::Get().GetAllMetadata()) {
+                    if (meta->GetNameHash() == PREFAB_COMPONENT_HASH) continue;
+                    void* current = meta->Get(registry, entity);
+                    if (!current) continue;
+                    for (const auto& property : meta->GetProperties()) {
+                        copyProperty(meta.get(), property.get(), prefabComp, current);
+                    }
+                }
+                continue;
+            }
+
+            for (const auto& [meta, property] : patch.Properties) {
+                if (void* current = meta->Get(registry, entity)) {
+                    copyProperty(meta, property, prefabComp, current);
+                }
+            }
+        }
+
+        LOG_INFO("PrefabOverrides: Patched ", instances.size(), " instance(s) of prefab (GUID: 0x",
+            std::hex, prefabGUID.m_Value, std::dec, ", ", patch.Properties.size(), " property change(s))");
+        return instances.size();
+    }
+
+    std::string PrefabOverrides::Encode(const PrefabComponent& prefabComponent) {
+        std::vector<uint8_t> data;
+        data.reserve(16 + prefabComponent.Overrides.size() * 16 + prefabComponent.OverrideData.size());
+
+        WritePod(data, OVERRIDE_FORMAT_VERSION);
+
+        WritePod(data, static_cast<uint32_t>(prefabComponent.Overrides.size()));
+        for (const auto& override : prefabComponent.Overrides) {
+            WritePod(data, override.ComponentHash);
+            WritePod(data, override.PropertyHash);
+            WritePod(data, static_cast<uint8_t>(override.Type));
+            WritePod(data, override.Size);
+            data.insert(data.end(),
+                prefabComponent.OverrideData.begin() + override.Offset,
+                prefabComponent.OverrideData.begin() + override.Offset + override.Size);
+        }
+
+        WritePod(data, static_cast<uint32_t>(prefabComponent.AddedComponents.size()));
+        for (uint32_t hash : prefabComponent.AddedComponents) WritePod(data, hash);
+
+        WritePod(data, static_cast<uint32_t>(prefabComponent.DeletedComponents.size()));
+        for (uint32_t hash : prefabComponent.DeletedComponents) WritePod(data, hash);
+
+        return Base64Encode(data);
+    }
+
+    bool PrefabOverrides::Decode(const std::string& encoded, PrefabComponent& prefabComponent) {
+        prefabComponent.ClearModifications();
+
+        std::vector<uint8_t> data;
+        if (!Base64Decode(encoded, data)) {
+            LOG_ERROR("PrefabOverrides: Override data is not valid base64");
+            return false;
+        }
+
+        size_t cursor = 0;
+        uint8_t version = 0;
+        if (!ReadPod(data, cursor, version) || version != OVERRIDE_FORMAT_VERSION) {
+            LOG_ERROR("PrefabOverrides: Unsupported override data version ", static_cast<int>(version));
+            return false;
+        }
+
+        auto fail = [&]() {
+            LOG_ERROR("PrefabOverrides: Truncated override data");
+            prefabComponent.ClearModifications();
+            return false;
+        };
+
+        uint32_t count = 0;
+        if (!ReadPod(data, cursor, count)) return fail();
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t componentHash = 0, propertyHash = 0, size = 0;
+            uint8_t type = 0;
+            if (!ReadPod(data, cursor, componentHash) || !ReadPod(data, cursor, propertyHash) ||
+                !ReadPod(data, cursor, type) || !ReadPod(data, cursor, size) ||
+                cursor + size > data.size()) {
+                return fail();
+            }
+            prefabComponent.SetPropertyOverride(componentHash, propertyHash,
+                static_cast<PropertyType>(type), data.data() + cursor, size);
+            cursor += size;
+        }
+
+        if (!ReadPod(data, cursor, count)) return fail();
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t hash = 0;
+            if (!ReadPod(data, cursor, hash)) return fail();
+            prefabComponent.MarkComponentAdded(hash);
+        }
+
+        if (!ReadPod(data, cursor, count)) return fail();
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t hash = 0;
+            if (!ReadPod(data, cursor, hash)) return fail();
+            prefabComponent.MarkComponentDeleted(hash);
+        }
+
+        return true;
+    }
+
+    Entity PrefabOverrides::GetPrefabDefaults(xresource::instance_guid prefabGUID) {
+        const auto* entry = RefreshDefaults(prefabGUID);
+        if (!entry) {
+            return Entity();
+        }
+        return Entity(entry->Handle, &GetDefaultsRegistry());
+    }
+
+    entt::registry& PrefabOverrides::GetDefaultsRegistry() {
+        return GetDefaultsCache().DefaultsScene.GetRegistry();
+    }
+
+    void PrefabOverrides::ClearDefaultsCache() {
+        DefaultsCache& cache = GetDefaultsCache();
+        cache.DefaultsScene.GetRegistry().clear();
+        cache.Entries.clear();
+    }
+
+} // namespace Engine
@@ -0,0 +1,99 @@
+/**
+ * @file PrefabOverrides.h
+ * @brief Property-level diffs between prefab instances and their prefab
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+#ifndef __PREFAB_OVERRIDES_H__
+#define __PREFAB_OVERRIDES_H__
+
+#include "../Asset/ResourceTypes.h"
+#include "../ECS/Entity.h"
+#include <cstddef>
+#include <string>
+
+namespace Engine {
+
+    // Forward declarations
+    class Scene;
+    struct PrefabComponent;
+
+    /**
+     * @brief Computes, stores and applies prefab instance overrides
+     * @details Diffs are computed per reflected property (ReflectionRegistry) against a
+     *          cached reference instance of the prefab, and stored on PrefabComponent as
+     *          typed binary values. Only entity prefabs are supported.
+     */
+    class PrefabOverrides {
+    public:
+        /**
+         * @brief Rebuild the override set of an instance from its current state
+         * @param scene Scene containing the instance
+         * @param instance Entity with PrefabComponent
+         * @return True if the diff was computed (prefab found)
+         */
+        static bool Compute(Scene* scene, Entity instance);
+
+        /**
+         * @brief Apply the stored overrides of one instance
+         * @param scene Scene containing the instance
+         * @param instance Entity with PrefabComponent
+         */
+        static void Apply(Scene* scene, Entity instance);
+
+        /**
+         * @brief Apply stored overrides of every prefab instance in a scene
+         * @details Reflection lookups are resolved once per distinct property.
+         * @param scene Scene to process
+         * @return Number of instances processed
+         */
+        static size_t ApplyAll(Scene* scene);
+
+        /**
+         * @brief Bring instances of a changed prefab up to date, keeping their overrides
+         * @details The previous and new reference instances are diffed once per prefab
+         *          revision; only that patch is applied to the instances found through the
+         *          scene's PrefabInstanceIndex, skipping overridden properties.
+         * @param scene Scene to process
+         * @param prefabGUID GUID of the prefab that changed
+         * @return Number of instances updated
+         */
+        static size_t RefreshInstances(Scene* scene, xresource::instance_guid prefabGUID);
+
+        /**
+         * @brief Encode the override set of a PrefabComponent (binary, base64 text)
+         */
+        static std::string Encode(const PrefabComponent& prefabComponent);
+
+        /**
+         * @brief Decode an override set produced by Encode into a PrefabComponent
+         * @return False if the data is malformed (component left without overrides)
+         */
+        static bool Decode(const std::string& encoded, PrefabComponent& prefabComponent);
+
+        /**
+         * @brief Get the cached reference instance of an entity prefab
+         * @details Rebuilt automatically when the prefab revision changes.
+         * @return Invalid entity if the prefab is missing or not an entity prefab
+         */
+        static Entity GetPrefabDefaults(xresource::instance_guid prefabGUID);
+
+        /**
+         * @brief Registry holding the cached reference instances
+         */
+        static entt::registry& GetDefaultsRegistry();
+
+        /**
+         * @brief Drop every cached reference instance
+         */
+        static void ClearDefaultsCache();
+    };
+
+} // namespace Engine
+
+#endif // __PREFAB_OVERRIDES_H__
@@ -0,0 +1,379 @@
+/**
+ * @file PrefabPool.cpp
+ * @brief Implementation of PrefabPool
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "PrefabPool.h"
+#include "../ECS/Scene.h"
+#include "../ECS/Components.h"
+#include "PrefabOverrides.h"
+#include "../Serialization/PrefabInstantiator.h"
+#include "../Utility/Logger.h"
+
+#include <algorithm>
+#include <optional>
+#include <tuple>
+
+namespace Engine {
+
+    namespace {
+
+        /**
+         * @brief Copy of the prefab-default value of every known component type
+         * @details Captured once from a freshly instantiated entity; restoring it is a
+         *          plain component copy, no JSON involved.
+         */
+        template<typename... Ts>
+        struct ComponentSnapshot {
+            std::tuple<std::optional<Ts>...> Values;
+
+            void Capture(entt::registry& registry, entt::entity entity) {
+                ((std::get<std::optional<Ts>>(Values) = registry.all_of<Ts>(entity)
+                    ? std::optional<Ts>(registry.get<Ts>(entity))
+                    : std::nullopt), ...);
+            }
+
+            void Restore(entt::registry& registry, entt::entity entity) const {
+                (RestoreOne<Ts>(registry, entity), ...);
+            }
+
+        private:
+            template<typename T>
+            void RestoreOne(entt::registry& registry, entt::entity entity) const {
+                const auto& value = std::get<std::optional<T>>(Values);
+                if (value) {
+                    registry.emplace_or_replace<T>(entity, *value);
+                }
+                else if (registry.all_of<T>(entity)) {
+                    registry.remove<T>(entity);
+                }
+            }
+        };
+
+        using PrefabDefaults = ComponentSnapshot<
+            TagComponent,
+            TransformComponent,
+            CameraComponent,
+            MeshRendererComponent,
+            RigidbodyComponent,
+            CharacterControllerComponent,
+            TriggerComponent,
+            JointComponent,
+            AnimatorComponent,
+            ParticleEmitterComponent,
+            AudioComponent,
+            ListenerComponent,
+            ReverbZoneComponent
+        >;
+
+    } // namespace
+
+    struct PrefabPool::Pool {
+        PrefabDefaults Defaults;
+        bool HasDefaults = false;
+
+        /// Storage ids present on the prefab (anything else is stripped on release)
+        std::vector<entt::id_type> Composition;
+
+        /// Parked instances, LIFO so recently used entities stay warm in cache
+        std::vector<entt::entity> Free;
+
+        PrefabPoolStats Stats;
+    };
+
+    PrefabPool::PrefabPool(Scene* scene)
+        : m_Scene(scene) {
+    }
+
+    PrefabPool::~PrefabPool() = default;
+
+    Entity PrefabPool::Spawn(xresource::instance_guid prefabGUID, const std::string& name) {
+        Pool& pool = GetOrCreatePool(prefabGUID);
+        auto& registry = m_Scene->GetRegistry();
+
+        entt::entity handle = entt::null;
+        while (!pool.Free.empty()) {
+            entt::entity candidate = pool.Free.back();
+            pool.Free.pop_back();
+
+            // Skip entries destroyed behind our back
+            if (registry.valid(candidate) && registry.all_of<InactiveComponent>(candidate)) {
+                handle = candidate;
+                break;
+            }
+        }
+
+        Entity entity;
+        if (handle != entt::null) {
+            entity = Entity(handle, &registry);
+            registry.remove<InactiveComponent>(handle);
+
+            if (auto* reverb = registry.try_get<ReverbZoneComponent>(handle)) {
+                if (reverb->ReverbZone) reverb->ReverbZone->setActive(true);
+            }
+
+            pool.Stats.Hits++;
+        }
+        else {
+            entity = CreateInstance(pool, prefabGUID);
+            if (!entity) {
+                return Entity();
+            }
+            pool.Stats.Misses++;
+        }
+
+        auto& pooled = registry.get<PooledComponent>(entity);
+        pooled.Generation++;
+
+        if (!name.empty() && entity.HasComponent<TagComponent>()) {
+            entity.GetComponent<TagComponent>().Tag = name;
+        }
+
+        pool.Stats.Active++;
+        pool.Stats.Available = static_cast<uint32_t>(pool.Free.size());
+        pool.Stats.Peak = std::max(pool.Stats.Peak, pool.Stats.Active);
+
+        return entity;
+    }
+
+    bool PrefabPool::Release(Entity entity) {
+        if (!entity) {
+            LOG_WARNING("PrefabPool: Attempted to release invalid entity");
+            return false;
+        }
+
+        auto& registry = m_Scene->GetRegistry();
+        auto* pooled = registry.try_get<PooledComponent>(entity);
+        if (!pooled) {
+            LOG_WARNING("PrefabPool: Entity is not a pooled instance (ID: ", static_cast<uint32_t>(entity), ")");
+            return false;
+        }
+
+        if (registry.all_of<InactiveComponent>(entity)) {
+            LOG_WARNING("PrefabPool: Entity already released (ID: ", static_cast<uint32_t>(entity), ")");
+            return false;
+        }
+
+        auto it = m_Pools.find(pooled->PrefabGUID);
+        if (it == m_Pools.end()) {
+            LOG_ERROR("PrefabPool: No pool for prefab (GUID: 0x",
+                std::hex, pooled->PrefabGUID.m_Value, std::dec, ")");
+            return false;
+        }
+
+        Pool& pool = *it->second;
+        Park(pool, entity);
+
+        if (pool.Stats.Active > 0) pool.Stats.Active--;
+        pool.Stats.Available = static_cast<uint32_t>(pool.Free.size());
+        return true;
+    }
+
+    uint32_t PrefabPool::Prewarm(xresource::instance_guid prefabGUID, uint32_t count) {
+        Pool& pool = GetOrCreatePool(prefabGUID);
+        pool.Stats.PrewarmCount = std::max(pool.Stats.PrewarmCount, count);
+
+        uint32_t created = 0;
+        pool.Free.reserve(count);
+
+        while (pool.Stats.Active + pool.Free.size() < count) {
+            Entity entity = CreateInstance(pool, prefabGUID);
+            if (!entity) {
+                break;
+            }
+            Park(pool, entity);
+            created++;
+        }
+
+        pool.Stats.Available = static_cast<uint32_t>(pool.Free.size());
+
+        LOG_INFO("PrefabPool: Prewarmed ", created, " instance(s) (GUID: 0x",
+            std::hex, prefabGUID.m_Value, std::dec, ", available: ", pool.Stats.Available, ")");
+
+        return created;
+    }
+
+    void PrefabPool::Trim(xresource::instance_guid prefabGUID, uint32_t keep) {
+        auto it = m_Pools.find(prefabGUID);
+        if (it == m_Pools.end()) {
+            return;
+        }
+
+        Pool& pool = *it->second;
+        auto& registry = m_Scene->GetRegistry();
+
+        while (pool.Free.size() > keep) {
+            entt::entity handle = pool.Free.back();
+            pool.Free.pop_back();
+            if (registry.valid(handle)) {
+                registry.destroy(handle);
+            }
+        }
+
+        pool.Stats.Available = static_cast<uint32_t>(pool.Free.size());
+    }
+
+    void PrefabPool::OnEntityDestroyed(entt::entity entity) {
+        auto& registry = m_Scene->GetRegistry();
+        auto* pooled = registry.try_get<PooledComponent>(entity);
+        if (!pooled) {
+            return;
+        }
+
+        auto it = m_Pools.find(pooled->PrefabGUID);
+        if (it == m_Pools.end()) {
+            return;
+        }
+
+        Pool& pool = *it->second;
+        if (registry.all_of<InactiveComponent>(entity)) {
+            pool.Free.erase(std::remove(pool.Free.begin(), pool.Free.end(), entity), pool.Free.end());
+            pool.Stats.Available = static_cast<uint32_t>(pool.Free.size());
+        }
+        else if (pool.Stats.Active > 0) {
+            pool.Stats.Active--;
+        }
+    }
+
+    void PrefabPool::OnPrefabChanged(xresource::instance_guid prefabGUID) {
+        auto it = m_Pools.find(prefabGUID);
+        if (it == m_Pools.end() || !it->second->HasDefaults) {
+            return;
+        }
+
+        // Storage ids are type hashes, so the composition carries over between registries
+        Entity reference = PrefabOverrides::GetPrefabDefaults(prefabGUID);
+        if (reference) {
+            CaptureDefaults(*it->second, PrefabOverrides::GetDefaultsRegistry(), reference);
+        }
+    }
+
+    void PrefabPool::Clear() {
+        m_Pools.clear();
+    }
+
+    bool PrefabPool::IsPooled(entt::entity entity) const {
+        const auto& registry = m_Scene->GetRegistry();
+        return registry.valid(entity) && registry.all_of<PooledComponent>(entity);
+    }
+
+    PrefabPoolStats PrefabPool::GetStats(xresource::instance_guid prefabGUID) const {
+        auto it = m_Pools.find(prefabGUID);
+        if (it == m_Pools.end()) {
+            return PrefabPoolStats{};
+        }
+        return it->second->Stats;
+    }
+
+    std::vector<std::pair<xresource::instance_guid, PrefabPoolStats>> PrefabPool::GetAllStats() const {
+        std::vector<std::pair<xresource::instance_guid, PrefabPoolStats>> result;
+        result.reserve(m_Pools.size());
+        for (const auto& [guid, pool] : m_Pools) {
+            result.emplace_back(guid, pool->Stats);
+        }
+        return result;
+    }
+
+    PrefabPool::Pool& PrefabPool::GetOrCreatePool(xresource::instance_guid prefabGUID) {
+        auto it = m_Pools.find(prefabGUID);
+        if (it == m_Pools.end()) {
+            it = m_Pools.emplace(prefabGUID, std::make_unique<Pool>()).first;
+        }
+        return *it->second;
+    }
+
+    Entity PrefabPool::CreateInstance(Pool& pool, xresource::instance_guid prefabGUID) {
+        Entity entity = PrefabInstantiator::InstantiateEntityPrefab(m_Scene, prefabGUID);
+        if (!entity) {
+            LOG_ERROR("PrefabPool: Failed to instantiate prefab (GUID: 0x",
+                std::hex, prefabGUID.m_Value, std::dec, ")");
+            return Entity();
+        }
+
+        auto& registry = m_Scene->GetRegistry();
+
+        // First instance defines the defaults every recycled instance is reset to
+        if (!pool.HasDefaults) {
+            CaptureDefaults(pool, registry, entity);
+        }
+
+        registry.emplace<PooledComponent>(entity, prefabGUID);
+        pool.Stats.Created++;
+
+        return entity;
+    }
+
+    void PrefabPool::CaptureDefaults(Pool& pool, entt::registry& registry, entt::entity entity) {
+        pool.Defaults.Capture(registry, entity);
+        pool.Composition.clear();
+        for (auto [id, storage] : registry.storage()) {
+            if (storage.contains(entity)) {
+                pool.Composition.push_back(id);
+            }
+        }
+        pool.Composition.push_back(entt::type_id<PrefabComponent>().hash());
+        pool.Composition.push_back(entt::type_id<PooledComponent>().hash());
+        pool.Composition.push_back(entt::type_id<InactiveComponent>().hash());
+        pool.HasDefaults = true;
+    }
+
+    void PrefabPool::Park(Pool& pool, entt::entity entity) {
+        auto& registry = m_Scene->GetRegistry();
+
+        // Release runtime handles the default snapshot would otherwise overwrite
+        if (auto* audio = registry.try_get<AudioComponent>(entity)) {
+            if (audio->Channel) {
+                audio->Channel->stop();
+                audio->Channel = nullptr;
+            }
+        }
+
+        FMOD::Reverb3D* reverbZone = nullptr;
+        if (auto* reverb = registry.try_get<ReverbZoneComponent>(entity)) {
+            reverbZone = reverb->ReverbZone;
+            if (reverbZone) reverbZone->setActive(false);
+        }
+
+        // Detach from any runtime parent so the hierarchy does not keep a parked child
+        if (auto* transform = registry.try_get<TransformComponent>(entity)) {
+            entt::entity parent = transform->Parent;
+            if (parent != entt::null && registry.valid(parent)) {
+                if (auto* parentTransform = registry.try_get<TransformComponent>(parent)) {
+                    auto& children = parentTransform->Children;
+                    children.erase(std::remove(children.begin(), children.end(), entity), children.end());
+                }
+            }
+        }
+
+        // Strip components added at runtime, then restore prefab defaults
+        for (auto [id, storage] : registry.storage()) {
+            if (storage.contains(entity) &&
+                std::find(pool.Composition.begin(), pool.Composition.end(), id) == pool.Composition.end()) {
+                storage.remove(entity);
+            }
+        }
+
+        pool.Defaults.Restore(registry, entity);
+
+        if (auto* reverb = registry.try_get<ReverbZoneComponent>(entity)) {
+            reverb->ReverbZone = reverbZone;
+            reverb->IsDirty = true;
+        }
+
+        if (auto* transform = registry.try_get<TransformComponent>(entity)) {
+            transform->IsDirty = true;
+        }
+
+        if (!registry.all_of<InactiveComponent>(entity)) {
+            registry.emplace<InactiveComponent>(entity);
+        }
+
+        pool.Free.push_back(entity);
+    }
+
+} // namespace Engine
@@ -0,0 +1,152 @@
+/**
+ * @file PrefabPool.h
+ * @brief Per-scene pool of recycled entity prefab instances
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+#ifndef __PREFAB_POOL_H__
+#define __PREFAB_POOL_H__
+
+#include "../Asset/ResourceTypes.h"
+#include "../ECS/Entity.h"
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+    // Forward declarations
+    class Scene;
+
+    /**
+     * @brief Usage counters for a single prefab pool
+     */
+    struct PrefabPoolStats {
+        uint32_t Active = 0;        ///< Instances currently handed out
+        uint32_t Available = 0;     ///< Parked instances ready for reuse
+        uint32_t Peak = 0;          ///< Highest Active count seen
+        uint32_t Created = 0;       ///< Instances ever built through PrefabInstantiator
+        uint32_t Hits = 0;          ///< Spawns served from the free list
+        uint32_t Misses = 0;        ///< Spawns that had to instantiate a new entity
+        uint32_t PrewarmCount = 0;  ///< Largest prewarm request (saved with the scene)
+    };
+
+    /**
+     * @brief Recycles entity prefab instances to avoid per-spawn deserialization
+     * @details Each pool is keyed by prefab GUID. The first instance of a prefab is built
+     *          through PrefabInstantiator and its components are snapshotted as the
+     *          prefab defaults. Released instances are reset to that snapshot, tagged
+     *          with InactiveComponent (which parks their physics body) and pushed onto
+     *          a free list, so Spawn() is a hash lookup plus a pop.
+     */
+    class PrefabPool {
+    public:
+        explicit PrefabPool(Scene* scene);
+        ~PrefabPool();
+
+        PrefabPool(const PrefabPool&) = delete;
+        PrefabPool& operator=(const PrefabPool&) = delete;
+
+        /**
+         * @brief Hand out an instance of a prefab, reusing a parked one when possible
+         * @param prefabGUID GUID of the entity prefab
+         * @param name Optional name for the entity (overrides prefab name)
+         * @return The active instance, or an invalid entity if the prefab could not be built
+         */
+        Entity Spawn(xresource::instance_guid prefabGUID, const std::string& name = "");
+
+        /**
+         * @brief Return an instance to its pool
+         * @param entity Entity previously returned by Spawn()
+         * @return True if the entity was pooled and is now parked
+         */
+        bool Release(Entity entity);
+
+        /**
+         * @brief Build parked instances ahead of time (e.g. on level load)
+         * @param prefabGUID GUID of the entity prefab
+         * @param count Number of instances the pool should hold in total
+         * @return Number of instances created by this call
+         */
+        uint32_t Prewarm(xresource::instance_guid prefabGUID, uint32_t count);
+
+        /**
+         * @brief Destroy parked instances until at most keep remain
+         * @param prefabGUID GUID of the entity prefab
+         * @param keep Number of parked instances to keep
+         */
+        void Trim(xresource::instance_guid prefabGUID, uint32_t keep = 0);
+
+        /**
+         * @brief Keep counters correct when a pooled entity is destroyed outright
+         * @param entity Entity about to be destroyed
+         */
+        void OnEntityDestroyed(entt::entity entity);
+
+        /**
+         * @brief Recapture the reset defaults after the prefab asset changed
+         * @details Parked instances are patched like any other instance; only the
+         *          snapshot used on release needs refreshing.
+         * @param prefabGUID GUID of the prefab that changed
+         */
+        void OnPrefabChanged(xresource::instance_guid prefabGUID);
+
+        /**
+         * @brief Forget every pool without touching the registry
+         * @details Call before the registry is cleared (scene load, new scene)
+         */
+        void Clear();
+
+        /**
+         * @brief Check if an entity is owned by a pool
+         */
+        bool IsPooled(entt::entity entity) const;
+
+        /**
+         * @brief Get counters for a single prefab pool (zeroed if unknown)
+         */
+        PrefabPoolStats GetStats(xresource::instance_guid prefabGUID) const;
+
+        /**
+         * @brief Get counters for every pool
+         */
+        std::vector<std::pair<xresource::instance_guid, PrefabPoolStats>> GetAllStats() const;
+
+    private:
+        struct Pool;
+
+        /**
+         * @brief Find or create the pool for a prefab
+         */
+        Pool& GetOrCreatePool(xresource::instance_guid prefabGUID);
+
+        /**
+         * @brief Instantiate a fresh entity for a pool, capturing defaults on first use
+         */
+        Entity CreateInstance(Pool& pool, xresource::instance_guid prefabGUID);
+
+        /**
+         * @brief Capture reset defaults and composition from a prefab-default entity
+         */
+        void CaptureDefaults(Pool& pool, entt::registry& registry, entt::entity entity);
+
+        /**
+         * @brief Reset a released instance to prefab defaults and park it
+         */
+        void Park(Pool& pool, entt::entity entity);
+
+        Scene* m_Scene;
+        std::unordered_map<xresource::instance_guid, std::unique_ptr<Pool>> m_Pools;
+    };
+
+} // namespace Engine
+
+#endif // __PREFAB_POOL_H__
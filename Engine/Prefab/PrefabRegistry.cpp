@@ -11,6 +11,13 @@
 #include "PrefabRegistry.h"
 #include "../Utility/Logger.h"
 
+#include <rapidjson/document.h>
+
+#include <algorithm>
+#include <charconv>
+#include <deque>
+#include <unordered_set>
+
 namespace Engine {
 
     void PrefabRegistry::RegisterPrefab(std::shared_ptr<Prefab> prefab) {
@@ -29,11 +36,148 @@ namespace Engine {
 
         m_Prefabs[guid] = prefab;
         m_PrefabsByName[prefab->GetName()] = guid;
+        IndexDependencies(*prefab);
 
         LOG_INFO("PrefabRegistry: Registered prefab '", prefab->GetName(),
             "' (GUID: 0x", std::hex, guid.m_Value, std::dec, ")");
     }
 
+    void PrefabRegistry::UpdatePrefab(std::shared_ptr<Prefab> prefab) {
+        if (!prefab) {
+            LOG_ERROR("PrefabRegistry: Attempted to update null prefab");
+            return;
+        }
+
+        xresource::instance_guid guid = prefab->GetGUID();
+        auto it = m_Prefabs.find(guid);
+        if (it == m_Prefabs.end()) {
+            RegisterPrefab(prefab);
+            return;
+        }
+
+        auto& existing = it->second;
+        if (existing != prefab) {
+            if (existing->GetName() != prefab->GetName()) {
+                m_PrefabsByName.erase(existing->GetName());
+                m_PrefabsByName[prefab->GetName()] = guid;
+                existing->SetName(prefab->GetName());
+            }
+            existing->SetType(prefab->GetType());
+            existing->SetSourcePath(prefab->GetSourcePath());
+            existing->SetRootEntityGUID(prefab->GetRootEntityGUID());
+            if (prefab->GetType() == PrefabType::Entity) {
+                existing->SetEntityData(prefab->GetEntityData());
+            }
+            else {
+                existing->SetSceneData(prefab->GetSceneData());
+            }
+        }
+
+        RemoveDependencies(guid);
+        IndexDependencies(*existing);
+
+        // Prefabs nesting this one (transitively) are stale too; bump their revision
+        // so cached defaults rebuild, and report them after the prefab they depend on
+        std::vector<xresource::instance_guid> changed{ guid };
+        std::unordered_set<xresource::instance_guid> visited{ guid };
+        for (size_t i = 0; i < changed.size(); i++) {
+            for (const auto& dependent : GetDependents(changed[i])) {
+                if (!visited.insert(dependent).second) {
+                    continue;
+                }
+                if (auto dependentPrefab = GetPrefab(dependent)) {
+                    dependentPrefab->MarkDirty();
+                    changed.push_back(dependent);
+                }
+            }
+        }
+
+        LOG_INFO("PrefabRegistry: Updated prefab '", existing->GetName(),
+            "' (GUID: 0x", std::hex, guid.m_Value, std::dec, ", ", changed.size() - 1, " dependent(s))");
+
+        // Copy so listeners may subscribe/unsubscribe while being notified; one removed
+        // meanwhile (its Scene destroyed by an earlier callback) is not called again
+        auto listeners = m_ChangeListeners;
+        for (const auto& changedGUID : changed) {
+            for (const auto& [handle, callback] : listeners) {
+                auto stillListening = [handle = handle](const auto& listener) { return listener.first == handle; };
+                if (std::any_of(m_ChangeListeners.begin(), m_ChangeListeners.end(), stillListening)) {
+                    callback(changedGUID);
+                }
+            }
+        }
+    }
+
+    const std::vector<xresource::instance_guid>& PrefabRegistry::GetDependents(xresource::instance_guid guid) const {
+        static const std::vector<xresource::instance_guid> s_Empty;
+        auto it = m_Dependents.find(guid);
+        return (it != m_Dependents.end()) ? it->second : s_Empty;
+    }
+
+    void PrefabRegistry::IndexDependencies(const Prefab& prefab) {
+        const std::string& data = (prefab.GetType() == PrefabType::Entity)
+            ? prefab.GetEntityData()
+            : prefab.GetSceneData();
+        if (data.empty()) {
+            return;
+        }
+
+        ::rapidjson::Document doc;
+        doc.Parse(data.c_str());
+        if (doc.HasParseError() || !doc.IsObject()) {
+            return;
+        }
+
+        auto addReference = [&](const ::rapidjson::Value& entityObj) {
+            if (!entityObj.IsObject() || !entityObj.HasMember("Prefab") || !entityObj["Prefab"].IsString()) {
+                return;
+            }
+            const ::rapidjson::Value& value = entityObj["Prefab"];
+            uint64_t referencedValue = 0;
+            const auto [end, error] = std::from_chars(value.GetString(), value.GetString() + value.GetStringLength(), referencedValue);
+            if (error != std::errc{} || end != value.GetString() + value.GetStringLength() || referencedValue == 0) {
+                LOG_WARNING("PrefabRegistry: Prefab '", prefab.GetName(), "' references an invalid prefab GUID '",
+                    value.GetString(), "', dependency skipped");
+                return;
+            }
+            xresource::instance_guid referenced{ referencedValue };
+            auto& dependents = m_Dependents[referenced];
+            if (std::find(dependents.begin(), dependents.end(), prefab.GetGUID()) == dependents.end()) {
+                dependents.push_back(prefab.GetGUID());
+            }
+        };
+
+        if (prefab.GetType() == PrefabType::Entity) {
+            addReference(doc);
+        }
+        else if (doc.HasMember("Entities") && doc["Entities"].IsArray()) {
+            for (const auto& entityObj : doc["Entities"].GetArray()) {
+                addReference(entityObj);
+            }
+        }
+    }
+
+    void PrefabRegistry::RemoveDependencies(xresource::instance_guid guid) {
+        for (auto it = m_Dependents.begin(); it != m_Dependents.end();) {
+            auto& dependents = it->second;
+            dependents.erase(std::remove(dependents.begin(), dependents.end(), guid), dependents.end());
+            it = dependents.empty() ? m_Dependents.erase(it) : std::next(it);
+        }
+    }
+
+    uint32_t PrefabRegistry::AddChangeListener(ChangeCallback callback) {
+        uint32_t handle = m_NextListenerHandle++;
+        m_ChangeListeners.emplace_back(handle, std::move(callback));
+        return handle;
+    }
+
+    void PrefabRegistry::RemoveChangeListener(uint32_t handle) {
+        m_ChangeListeners.erase(
+            std::remove_if(m_ChangeListeners.begin(), m_ChangeListeners.end(),
+                [handle](const auto& entry) { return entry.first == handle; }),
+            m_ChangeListeners.end());
+    }
+
     void PrefabRegistry::UnregisterPrefab(xresource::instance_guid guid) {
         auto it = m_Prefabs.find(guid);
         if (it == m_Prefabs.end()) {
@@ -44,6 +188,7 @@ namespace Engine {
         std::string name = it->second->GetName();
         m_PrefabsByName.erase(name);
         m_Prefabs.erase(it);
+        RemoveDependencies(guid);
 
         LOG_INFO("PrefabRegistry: Unregistered prefab '", name, "'");
     }
@@ -72,6 +217,7 @@ namespace Engine {
         LOG_INFO("PrefabRegistry: Clearing all prefabs (", m_Prefabs.size(), " prefabs)");
         m_Prefabs.clear();
         m_PrefabsByName.clear();
+        m_Dependents.clear();
     }
 
 } // namespace Engine
\ No newline at end of file
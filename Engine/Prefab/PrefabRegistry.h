@@ -13,9 +13,12 @@
 #define __PREFAB_REGISTRY_H__
 
 #include "Prefab.h"
+#include <cstdint>
+#include <functional>
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Engine {
 
@@ -25,6 +28,8 @@ namespace Engine {
      */
     class PrefabRegistry {
     public:
+        using ChangeCallback = std::function<void(xresource::instance_guid)>;
+
         static PrefabRegistry& Get() {
             static PrefabRegistry instance;
             return instance;
@@ -39,6 +44,36 @@ namespace Engine {
          */
         void RegisterPrefab(std::shared_ptr<Prefab> prefab);
 
+        /**
+         * @brief Replace the data of a registered prefab and notify listeners
+         * @details The registered Prefab object is updated in place so existing
+         *          shared pointers see the new data. Registers the prefab if unknown.
+         * @param prefab Prefab carrying the new data (matched by GUID)
+         */
+        void UpdatePrefab(std::shared_ptr<Prefab> prefab);
+
+        /**
+         * @brief Get the prefabs that nest or derive from a prefab (direct only)
+         * @param guid GUID of the referenced prefab
+         * @return GUIDs of the referencing prefabs (empty if none)
+         */
+        const std::vector<xresource::instance_guid>& GetDependents(xresource::instance_guid guid) const;
+
+        /**
+         * @brief Subscribe to prefab data changes
+         * @details Prefabs that reference an updated prefab are reported as well,
+         *          after it, in dependency order.
+         * @param callback Called with the GUID of every updated prefab
+         * @return Handle for RemoveChangeListener
+         */
+        uint32_t AddChangeListener(ChangeCallback callback);
+
+        /**
+         * @brief Unsubscribe from prefab data changes
+         * @param handle Handle returned by AddChangeListener
+         */
+        void RemoveChangeListener(uint32_t handle);
+
         /**
          * @brief Unregister a prefab from the registry
          * @param guid GUID of the prefab to unregister
@@ -83,8 +118,24 @@ namespace Engine {
         PrefabRegistry() = default;
         ~PrefabRegistry() = default;
 
+        /**
+         * @brief Record which prefabs this prefab references ("Prefab" members in its data)
+         */
+        void IndexDependencies(const Prefab& prefab);
+
+        /**
+         * @brief Drop every reference edge originating from a prefab
+         */
+        void RemoveDependencies(xresource::instance_guid guid);
+
         std::unordered_map<xresource::instance_guid, std::shared_ptr<Prefab>> m_Prefabs;
         std::unordered_map<std::string, xresource::instance_guid> m_PrefabsByName;
+
+        /// Referenced prefab -> prefabs referencing it
+        std::unordered_map<xresource::instance_guid, std::vector<xresource::instance_guid>> m_Dependents;
+
+        std::vector<std::pair<uint32_t, ChangeCallback>> m_ChangeListeners;
+        uint32_t m_NextListenerHandle = 1;
     };
 
 } // namespace Engine
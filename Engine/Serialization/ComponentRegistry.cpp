@@ -15,6 +15,11 @@
 #include "../Component/CameraComponent.h"
 #include "../Component/MeshRendererComponent.h"
 #include "../Component/RigidbodyComponent.h"
+#include "../Component/CharacterControllerComponent.h"
+#include "../Component/TriggerComponent.h"
+#include "../Component/JointComponent.h"
+#include "../Component/AnimatorComponent.h"
+#include "../Component/ParticleEmitterComponent.h"
 #include "../Component/PrefabComponent.h"
 #include "../Component/AudioComponent.h"
 #include "../Component/ListenerComponent.h"
@@ -210,6 +215,409 @@ namespace Engine {
                 [](const RigidbodyComponent& c) { return c.Velocity; },
                 [](RigidbodyComponent& c, const glm::vec3& v) { c.Velocity = v; }
             );
+            meta.AddProperty<RigidbodyComponent, glm::vec3>(
+                "AngularVelocity",
+                PropertyType::Vec3,
+                [](const RigidbodyComponent& c) { return c.AngularVelocity; },
+                [](RigidbodyComponent& c, const glm::vec3& v) { c.AngularVelocity = v; }
+            );
+            meta.AddProperty<RigidbodyComponent, float>(
+                "LinearDamping",
+                PropertyType::Float,
+                [](const RigidbodyComponent& c) { return c.LinearDamping; },
+                [](RigidbodyComponent& c, const float& v) { c.LinearDamping = v; }
+            );
+            meta.AddProperty<RigidbodyComponent, float>(
+                "AngularDamping",
+                PropertyType::Float,
+                [](const RigidbodyComponent& c) { return c.AngularDamping; },
+                [](RigidbodyComponent& c, const float& v) { c.AngularDamping = v; }
+            );
+            meta.AddProperty<RigidbodyComponent, float>(
+                "Restitution",
+                PropertyType::Float,
+                [](const RigidbodyComponent& c) { return c.Restitution; },
+                [](RigidbodyComponent& c, const float& v) { c.Restitution = v; }
+            );
+            meta.AddProperty<RigidbodyComponent, float>(
+                "Friction",
+                PropertyType::Float,
+                [](const RigidbodyComponent& c) { return c.Friction; },
+                [](RigidbodyComponent& c, const float& v) { c.Friction = v; }
+            );
+            meta.AddProperty<RigidbodyComponent, RigidbodyMotionQuality>(
+                "MotionQuality",
+                PropertyType::Int,
+                [](const RigidbodyComponent& c) { return c.MotionQuality; },
+                [](RigidbodyComponent& c, const RigidbodyMotionQuality& v) { c.MotionQuality = v; }
+            );
+            meta.AddProperty<RigidbodyComponent, bool>(
+                "AllowSleeping",
+                PropertyType::Bool,
+                [](const RigidbodyComponent& c) { return c.AllowSleeping; },
+                [](RigidbodyComponent& c, const bool& v) { c.AllowSleeping = v; }
+            );
+            meta.AddProperty<RigidbodyComponent, bool>(
+                "CompoundChildren",
+                PropertyType::Bool,
+                [](const RigidbodyComponent& c) { return c.CompoundChildren; },
+                [](RigidbodyComponent& c, const bool& v) { c.CompoundChildren = v; }
+            );
+        }
+
+        // Register CharacterControllerComponent
+        {
+            auto& meta = REGISTER_COMPONENT(CharacterControllerComponent);
+            meta.AddProperty<CharacterControllerComponent, float>(
+                "Height",
+                PropertyType::Float,
+                [](const CharacterControllerComponent& c) { return c.Height; },
+                [](CharacterControllerComponent& c, const float& v) { c.Height = v; }
+            );
+            meta.AddProperty<CharacterControllerComponent, float>(
+                "Radius",
+                PropertyType::Float,
+                [](const CharacterControllerComponent& c) { return c.Radius; },
+                [](CharacterControllerComponent& c, const float& v) { c.Radius = v; }
+            );
+            meta.AddProperty<CharacterControllerComponent, float>(
+                "MaxSlopeAngle",
+                PropertyType::Float,
+                [](const CharacterControllerComponent& c) { return c.MaxSlopeAngle; },
+                [](CharacterControllerComponent& c, const float& v) { c.MaxSlopeAngle = v; }
+            );
+            meta.AddProperty<CharacterControllerComponent, float>(
+                "StepHeight",
+                PropertyType::Float,
+                [](const CharacterControllerComponent& c) { return c.StepHeight; },
+                [](CharacterControllerComponent& c, const float& v) { c.StepHeight = v; }
+            );
+            meta.AddProperty<CharacterControllerComponent, float>(
+                "StickToFloorDistance",
+                PropertyType::Float,
+                [](const CharacterControllerComponent& c) { return c.StickToFloorDistance; },
+                [](CharacterControllerComponent& c, const float& v) { c.StickToFloorDistance = v; }
+            );
+            meta.AddProperty<CharacterControllerComponent, float>(
+                "Mass",
+                PropertyType::Float,
+                [](const CharacterControllerComponent& c) { return c.Mass; },
+                [](CharacterControllerComponent& c, const float& v) { c.Mass = v; }
+            );
+            meta.AddProperty<CharacterControllerComponent, float>(
+                "MaxStrength",
+                PropertyType::Float,
+                [](const CharacterControllerComponent& c) { return c.MaxStrength; },
+                [](CharacterControllerComponent& c, const float& v) { c.MaxStrength = v; }
+            );
+            meta.AddProperty<CharacterControllerComponent, bool>(
+                "UseGravity",
+                PropertyType::Bool,
+                [](const CharacterControllerComponent& c) { return c.UseGravity; },
+                [](CharacterControllerComponent& c, const bool& v) { c.UseGravity = v; }
+            );
+            meta.AddProperty<CharacterControllerComponent, float>(
+                "JumpSpeed",
+                PropertyType::Float,
+                [](const CharacterControllerComponent& c) { return c.JumpSpeed; },
+                [](CharacterControllerComponent& c, const float& v) { c.JumpSpeed = v; }
+            );
+        }
+
+        // Register TriggerComponent
+        {
+            auto& meta = REGISTER_COMPONENT(TriggerComponent);
+            meta.AddProperty<TriggerComponent, TriggerShape>(
+                "Shape",
+                PropertyType::Int,
+                [](const TriggerComponent& c) { return c.Shape; },
+                [](TriggerComponent& c, const TriggerShape& v) { c.Shape = v; }
+            );
+            meta.AddProperty<TriggerComponent, glm::vec3>(
+                "HalfExtents",
+                PropertyType::Vec3,
+                [](const TriggerComponent& c) { return c.HalfExtents; },
+                [](TriggerComponent& c, const glm::vec3& v) { c.HalfExtents = v; }
+            );
+            meta.AddProperty<TriggerComponent, float>(
+                "Radius",
+                PropertyType::Float,
+                [](const TriggerComponent& c) { return c.Radius; },
+                [](TriggerComponent& c, const float& v) { c.Radius = v; }
+            );
+            meta.AddProperty<TriggerComponent, bool>(
+                "Enabled",
+                PropertyType::Bool,
+                [](const TriggerComponent& c) { return c.Enabled; },
+                [](TriggerComponent& c, const bool& v) { c.Enabled = v; }
+            );
+        }
+
+        // Register JointComponent
+        {
+            auto& meta = REGISTER_COMPONENT(JointComponent);
+            meta.AddProperty<JointComponent, JointType>(
+                "Type",
+                PropertyType::Int,
+                [](const JointComponent& c) { return c.Type; },
+                [](JointComponent& c, const JointType& v) { c.Type = v; }
+            );
+            meta.AddProperty<JointComponent, entt::entity>(
+                "ConnectedEntity",
+                PropertyType::Entity,
+                [](const JointComponent& c) { return c.ConnectedEntity; },
+                [](JointComponent& c, const entt::entity& v) { c.ConnectedEntity = v; }
+            );
+            meta.AddProperty<JointComponent, glm::vec3>(
+                "Anchor",
+                PropertyType::Vec3,
+                [](const JointComponent& c) { return c.Anchor; },
+                [](JointComponent& c, const glm::vec3& v) { c.Anchor = v; }
+            );
+            meta.AddProperty<JointComponent, glm::vec3>(
+                "ConnectedAnchor",
+                PropertyType::Vec3,
+                [](const JointComponent& c) { return c.ConnectedAnchor; },
+                [](JointComponent& c, const glm::vec3& v) { c.ConnectedAnchor = v; }
+            );
+            meta.AddProperty<JointComponent, glm::vec3>(
+                "Axis",
+                PropertyType::Vec3,
+                [](const JointComponent& c) { return c.Axis; },
+                [](JointComponent& c, const glm::vec3& v) { c.Axis = v; }
+            );
+            meta.AddProperty<JointComponent, bool>(
+                "UseLimits",
+                PropertyType::Bool,
+                [](const JointComponent& c) { return c.UseLimits; },
+                [](JointComponent& c, const bool& v) { c.UseLimits = v; }
+            );
+            meta.AddProperty<JointComponent, float>(
+                "MinLimit",
+                PropertyType::Float,
+                [](const JointComponent& c) { return c.MinLimit; },
+                [](JointComponent& c, const float& v) { c.MinLimit = v; }
+            );
+            meta.AddProperty<JointComponent, float>(
+                "MaxLimit",
+                PropertyType::Float,
+                [](const JointComponent& c) { return c.MaxLimit; },
+                [](JointComponent& c, const float& v) { c.MaxLimit = v; }
+            );
+            meta.AddProperty<JointComponent, float>(
+                "ConeAngle",
+                PropertyType::Float,
+                [](const JointComponent& c) { return c.ConeAngle; },
+                [](JointComponent& c, const float& v) { c.ConeAngle = v; }
+            );
+            meta.AddProperty<JointComponent, float>(
+                "BreakForce",
+                PropertyType::Float,
+                [](const JointComponent& c) { return c.BreakForce; },
+                [](JointComponent& c, const float& v) { c.BreakForce = v; }
+            );
+            meta.AddProperty<JointComponent, float>(
+                "BreakTorque",
+                PropertyType::Float,
+                [](const JointComponent& c) { return c.BreakTorque; },
+                [](JointComponent& c, const float& v) { c.BreakTorque = v; }
+            );
+            meta.AddProperty<JointComponent, bool>(
+                "IsBroken",
+                PropertyType::Bool,
+                [](const JointComponent& c) { return c.IsBroken; },
+                [](JointComponent& c, const bool& v) { c.IsBroken = v; }
+            );
+        }
+
+        // Register AnimatorComponent
+        {
+            auto& meta = REGISTER_COMPONENT(AnimatorComponent);
+            meta.AddProperty<AnimatorComponent, std::int32_t>(
+                "Clip",
+                PropertyType::Int,
+                [](const AnimatorComponent& c) { return c.Clip; },
+                [](AnimatorComponent& c, const std::int32_t& v) { c.Clip = v; }
+            );
+            meta.AddProperty<AnimatorComponent, std::int32_t>(
+                "BlendClip",
+                PropertyType::Int,
+                [](const AnimatorComponent& c) { return c.BlendClip; },
+                [](AnimatorComponent& c, const std::int32_t& v) { c.BlendClip = v; }
+            );
+            meta.AddProperty<AnimatorComponent, float>(
+                "BlendWeight",
+                PropertyType::Float,
+                [](const AnimatorComponent& c) { return c.BlendWeight; },
+                [](AnimatorComponent& c, const float& v) { c.BlendWeight = v; }
+            );
+            meta.AddProperty<AnimatorComponent, float>(
+                "Speed",
+                PropertyType::Float,
+                [](const AnimatorComponent& c) { return c.Speed; },
+                [](AnimatorComponent& c, const float& v) { c.Speed = v; }
+            );
+            meta.AddProperty<AnimatorComponent, float>(
+                "Time",
+                PropertyType::Float,
+                [](const AnimatorComponent& c) { return c.Time; },
+                [](AnimatorComponent& c, const float& v) { c.Time = v; }
+            );
+            meta.AddProperty<AnimatorComponent, float>(
+                "BlendTime",
+                PropertyType::Float,
+                [](const AnimatorComponent& c) { return c.BlendTime; },
+                [](AnimatorComponent& c, const float& v) { c.BlendTime = v; }
+            );
+            meta.AddProperty<AnimatorComponent, bool>(
+                "Loop",
+                PropertyType::Bool,
+                [](const AnimatorComponent& c) { return c.Loop; },
+                [](AnimatorComponent& c, const bool& v) { c.Loop = v; }
+            );
+            meta.AddProperty<AnimatorComponent, bool>(
+                "Playing",
+                PropertyType::Bool,
+                [](const AnimatorComponent& c) { return c.Playing; },
+                [](AnimatorComponent& c, const bool& v) { c.Playing = v; }
+            );
+            meta.AddProperty<AnimatorComponent, bool>(
+                "CpuSkinning",
+                PropertyType::Bool,
+                [](const AnimatorComponent& c) { return c.CpuSkinning; },
+                [](AnimatorComponent& c, const bool& v) { c.CpuSkinning = v; }
+            );
+        }
+
+        // Register ParticleEmitterComponent
+        {
+            auto& meta = REGISTER_COMPONENT(ParticleEmitterComponent);
+            meta.AddProperty<ParticleEmitterComponent, bool>(
+                "Emitting",
+                PropertyType::Bool,
+                [](const ParticleEmitterComponent& c) { return c.Emitting; },
+                [](ParticleEmitterComponent& c, const bool& v) { c.Emitting = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, float>(
+                "Rate",
+                PropertyType::Float,
+                [](const ParticleEmitterComponent& c) { return c.Rate; },
+                [](ParticleEmitterComponent& c, const float& v) { c.Rate = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, u32>(
+                "Burst",
+                PropertyType::U32,
+                [](const ParticleEmitterComponent& c) { return c.Burst; },
+                [](ParticleEmitterComponent& c, const u32& v) { c.Burst = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, u32>(
+                "MaxParticles",
+                PropertyType::U32,
+                [](const ParticleEmitterComponent& c) { return c.MaxParticles; },
+                [](ParticleEmitterComponent& c, const u32& v) { c.MaxParticles = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, float>(
+                "LifetimeMin",
+                PropertyType::Float,
+                [](const ParticleEmitterComponent& c) { return c.LifetimeMin; },
+                [](ParticleEmitterComponent& c, const float& v) { c.LifetimeMin = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, float>(
+                "LifetimeMax",
+                PropertyType::Float,
+                [](const ParticleEmitterComponent& c) { return c.LifetimeMax; },
+                [](ParticleEmitterComponent& c, const float& v) { c.LifetimeMax = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, float>(
+                "SpawnRadius",
+                PropertyType::Float,
+                [](const ParticleEmitterComponent& c) { return c.SpawnRadius; },
+                [](ParticleEmitterComponent& c, const float& v) { c.SpawnRadius = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, glm::vec3>(
+                "Velocity",
+                PropertyType::Vec3,
+                [](const ParticleEmitterComponent& c) { return c.Velocity; },
+                [](ParticleEmitterComponent& c, const glm::vec3& v) { c.Velocity = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, float>(
+                "Spread",
+                PropertyType::Float,
+                [](const ParticleEmitterComponent& c) { return c.Spread; },
+                [](ParticleEmitterComponent& c, const float& v) { c.Spread = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, glm::vec3>(
+                "Gravity",
+                PropertyType::Vec3,
+                [](const ParticleEmitterComponent& c) { return c.Gravity; },
+                [](ParticleEmitterComponent& c, const glm::vec3& v) { c.Gravity = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, float>(
+                "Drag",
+                PropertyType::Float,
+                [](const ParticleEmitterComponent& c) { return c.Drag; },
+                [](ParticleEmitterComponent& c, const float& v) { c.Drag = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, bool>(
+                "Collide",
+                PropertyType::Bool,
+                [](const ParticleEmitterComponent& c) { return c.Collide; },
+                [](ParticleEmitterComponent& c, const bool& v) { c.Collide = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, glm::vec3>(
+                "CollisionNormal",
+                PropertyType::Vec3,
+                [](const ParticleEmitterComponent& c) { return c.CollisionNormal; },
+                [](ParticleEmitterComponent& c, const glm::vec3& v) { c.CollisionNormal = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, float>(
+                "CollisionOffset",
+                PropertyType::Float,
+                [](const ParticleEmitterComponent& c) { return c.CollisionOffset; },
+                [](ParticleEmitterComponent& c, const float& v) { c.CollisionOffset = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, float>(
+                "Restitution",
+                PropertyType::Float,
+                [](const ParticleEmitterComponent& c) { return c.Restitution; },
+                [](ParticleEmitterComponent& c, const float& v) { c.Restitution = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, glm::vec4>(
+                "StartColor",
+                PropertyType::Vec4,
+                [](const ParticleEmitterComponent& c) { return c.StartColor; },
+                [](ParticleEmitterComponent& c, const glm::vec4& v) { c.StartColor = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, glm::vec4>(
+                "EndColor",
+                PropertyType::Vec4,
+                [](const ParticleEmitterComponent& c) { return c.EndColor; },
+                [](ParticleEmitterComponent& c, const glm::vec4& v) { c.EndColor = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, float>(
+                "StartSize",
+                PropertyType::Float,
+                [](const ParticleEmitterComponent& c) { return c.StartSize; },
+                [](ParticleEmitterComponent& c, const float& v) { c.StartSize = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, float>(
+                "EndSize",
+                PropertyType::Float,
+                [](const ParticleEmitterComponent& c) { return c.EndSize; },
+                [](ParticleEmitterComponent& c, const float& v) { c.EndSize = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, bool>(
+                "Additive",
+                PropertyType::Bool,
+                [](const ParticleEmitterComponent& c) { return c.Additive; },
+                [](ParticleEmitterComponent& c, const bool& v) { c.Additive = v; }
+            );
+            meta.AddProperty<ParticleEmitterComponent, bool>(
+                "SortByDepth",
+                PropertyType::Bool,
+                [](const ParticleEmitterComponent& c) { return c.SortByDepth; },
+                [](ParticleEmitterComponent& c, const bool& v) { c.SortByDepth = v; }
+            );
         }
 
         //Register AudioComponent
@@ -357,6 +765,29 @@ namespace Engine {
             );
         }
 
+        // Network replicated state: what a remote Scene needs to show the entity.
+        // Precision is the quantization step of float lanes (see Network/Replication.h).
+        {
+            auto& registry = ReflectionRegistry::Get();
+            const struct { const char* Component; const char* Property; float Precision; } replicated[] = {
+                { "TagComponent", "Tag", 0.0f },
+                { "TransformComponent", "Position", 0.001f },
+                { "TransformComponent", "Rotation", 0.01f },
+                { "TransformComponent", "Scale", 0.001f },
+                { "MeshRendererComponent", "Visible", 0.0f },
+                { "MeshRendererComponent", "MeshType", 0.0f },
+                { "MeshRendererComponent", "Material", 0.0f },
+                { "MeshRendererComponent", "Texture", 0.0f },
+            };
+
+            for (const auto& entry : replicated) {
+                ComponentMetadata* meta = registry.GetMetadata(entry.Component);
+                if (!meta || !meta->Replicate(entry.Property, entry.Precision)) {
+                    LOG_WARNING("Cannot replicate ", entry.Component, ".", entry.Property, ": not registered");
+                }
+            }
+        }
+
         LOG_INFO("Component reflection registration complete");
         LOG_INFO("  - Registered 7 component types");
     }
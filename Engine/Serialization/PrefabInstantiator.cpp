@@ -10,12 +10,18 @@
 
 #include "PrefabInstantiator.h"
 #include "../Prefab/PrefabRegistry.h"
+#include "../Prefab/PrefabOverrides.h"
 #include "../Component/PrefabComponent.h"
 #include "../Component/TagComponent.h"
 #include "../Component/TransformComponent.h"
 #include "../Component/CameraComponent.h"
 #include "../Component/MeshRendererComponent.h"
 #include "../Component/RigidbodyComponent.h"
+#include "../Component/CharacterControllerComponent.h"
+#include "../Component/TriggerComponent.h"
+#include "../Component/JointComponent.h"
+#include "../Component/AnimatorComponent.h"
+#include "../Component/ParticleEmitterComponent.h"
 #include "../Component/AudioComponent.h"
 #include "../Component/ListenerComponent.h"
 #include "../Component/ReverbZoneComponent.h"
@@ -25,8 +31,26 @@
 #include <rapidjson/writer.h>
 #include <rapidjson/stringbuffer.h>
 
+#include <algorithm>
+#include <charconv>
+#include <vector>
+
 namespace Engine {
 
+    namespace {
+
+        /**
+         * @brief GUIDs of the entity prefabs currently being instantiated
+         * @details Nested prefabs and variants instantiate recursively; a GUID showing
+         *          up twice on this stack means the prefab references itself.
+         */
+        std::vector<uint64_t>& GetInstantiationStack() {
+            static std::vector<uint64_t> s_Stack;
+            return s_Stack;
+        }
+
+    } // namespace
+
     Entity PrefabInstantiator::InstantiateEntityPrefab(
         Scene* scene,
         xresource::instance_guid prefabGUID,
@@ -50,14 +74,29 @@ namespace Engine {
             return Entity();
         }
 
+        auto& stack = GetInstantiationStack();
+        if (std::find(stack.begin(), stack.end(), prefabGUID.m_Value) != stack.end()) {
+            LOG_ERROR("PrefabInstantiator: Cyclic prefab reference detected (GUID: 0x",
+                std::hex, prefabGUID.m_Value, std::dec, ")");
+            return Entity();
+        }
+
         // Deserialize entity from prefab data
+        stack.push_back(prefabGUID.m_Value);
         Entity entity = DeserializeEntity(scene, prefab->GetEntityData(), entityId);
+        stack.pop_back();
 
         if (!entity) {
             LOG_ERROR("PrefabInstantiator: Failed to deserialize entity from prefab");
             return Entity();
         }
 
+        // A variant starts as an instance of its base prefab; re-tag it so the
+        // instance index sees it under this prefab
+        if (entity.HasComponent<PrefabComponent>()) {
+            entity.RemoveComponent<PrefabComponent>();
+        }
+
         // Add PrefabComponent to mark this as a prefab instance
         entity.AddComponent<PrefabComponent>(prefabGUID);
 
@@ -114,7 +153,7 @@ namespace Engine {
             // Deserialize entity
             Entity entity = DeserializeEntity(scene, entityJson);
             if (entity) {
-                // Add PrefabComponent
+                // Add PrefabComponent (nested entity prefab instances keep their own)
                 entity.AddComponent<PrefabComponent>(prefabGUID);
 
                 // Track root entity (first entity)
@@ -136,26 +175,9 @@ namespace Engine {
             return;
         }
 
-        const auto& prefabComp = entity.GetComponent<PrefabComponent>();
-
-        // Apply property overrides
-        for (const auto& override : prefabComp.OverriddenProperties) {
-            // Find component by GUID and apply override
-            // This is a simplified version - full implementation would need
-            // to iterate through all components and match by GUID
-            LOG_DEBUG("PrefabInstantiator: Applying override - Property: ",
-                override.PropertyPath, ", Value: ", override.Value);
-        }
-
-        // Handle added components
-        // (Components not in original prefab - already added during instantiation)
-
-        // Handle deleted components
-        for (const auto& deletedGUID : prefabComp.DeletedComponents) {
-            // Remove component with matching GUID
-            LOG_DEBUG("PrefabInstantiator: Removing deleted component (GUID: 0x",
-                std::hex, deletedGUID.m_Value, std::dec, ")");
-        }
+        // Added components live on the entity itself; overrides and deletions
+        // are replayed from the typed diff stored on the PrefabComponent
+        PrefabOverrides::Apply(scene, entity);
     }
 
     Entity PrefabInstantiator::DeserializeEntity(
@@ -173,7 +195,28 @@ namespace Engine {
 
         // Create entity with specific ID or auto-generate
         Entity entity;
-        if (entityId != entt::null) {
+        if (doc.HasMember("Prefab") && doc["Prefab"].IsString()) {
+            // Nested prefab instance or variant: start from the referenced prefab,
+            // replay its overrides, then add the components listed below
+            const ::rapidjson::Value& value = doc["Prefab"];
+            uint64_t nestedValue = 0;
+            const auto [end, error] = std::from_chars(value.GetString(), value.GetString() + value.GetStringLength(), nestedValue);
+            if (error != std::errc{} || end != value.GetString() + value.GetStringLength() || nestedValue == 0) {
+                LOG_WARNING("PrefabInstantiator: Invalid nested prefab GUID '", value.GetString(), "', entity skipped");
+                return Entity();
+            }
+            xresource::instance_guid nestedGUID{ nestedValue };
+            entity = InstantiateEntityPrefab(scene, nestedGUID, entityId);
+            if (!entity) {
+                return Entity();
+            }
+
+            if (doc.HasMember("Overrides") && doc["Overrides"].IsString() &&
+                PrefabOverrides::Decode(doc["Overrides"].GetString(), entity.GetComponent<PrefabComponent>())) {
+                PrefabOverrides::Apply(scene, entity);
+            }
+        }
+        else if (entityId != entt::null) {
             // Create entity with specific ID
             auto& registry = scene->GetRegistry();
             entity = Entity(registry.create(entityId), &registry);
@@ -298,6 +341,239 @@ namespace Engine {
                 const auto& vel = properties["Velocity"];
                 comp.Velocity = glm::vec3(vel[0].GetFloat(), vel[1].GetFloat(), vel[2].GetFloat());
             }
+            if (properties.HasMember("AngularVelocity") && properties["AngularVelocity"].IsArray()) {
+                const auto& angVel = properties["AngularVelocity"];
+                comp.AngularVelocity = glm::vec3(angVel[0].GetFloat(), angVel[1].GetFloat(), angVel[2].GetFloat());
+            }
+            if (properties.HasMember("LinearDamping")) {
+                comp.LinearDamping = properties["LinearDamping"].GetFloat();
+            }
+            if (properties.HasMember("AngularDamping")) {
+                comp.AngularDamping = properties["AngularDamping"].GetFloat();
+            }
+            if (properties.HasMember("Restitution")) {
+                comp.Restitution = properties["Restitution"].GetFloat();
+            }
+            if (properties.HasMember("Friction")) {
+                comp.Friction = properties["Friction"].GetFloat();
+            }
+            if (properties.HasMember("MotionQuality")) {
+                comp.MotionQuality = static_cast<RigidbodyMotionQuality>(properties["MotionQuality"].GetInt());
+            }
+            if (properties.HasMember("AllowSleeping")) {
+                comp.AllowSleeping = properties["AllowSleeping"].GetBool();
+            }
+            if (properties.HasMember("CompoundChildren")) {
+                comp.CompoundChildren = properties["CompoundChildren"].GetBool();
+            }
+        }
+        else if (componentType == "CharacterControllerComponent") {
+            auto& comp = entity.AddComponent<CharacterControllerComponent>();
+
+            if (properties.HasMember("ComponentGUID")) {
+                uint64_t guidValue = std::stoull(properties["ComponentGUID"].GetString());
+                comp.ComponentGUID = xresource::instance_guid{ guidValue };
+            }
+            if (properties.HasMember("Height")) {
+                comp.Height = properties["Height"].GetFloat();
+            }
+            if (properties.HasMember("Radius")) {
+                comp.Radius = properties["Radius"].GetFloat();
+            }
+            if (properties.HasMember("MaxSlopeAngle")) {
+                comp.MaxSlopeAngle = properties["MaxSlopeAngle"].GetFloat();
+            }
+            if (properties.HasMember("StepHeight")) {
+                comp.StepHeight = properties["StepHeight"].GetFloat();
+            }
+            if (properties.HasMember("StickToFloorDistance")) {
+                comp.StickToFloorDistance = properties["StickToFloorDistance"].GetFloat();
+            }
+            if (properties.HasMember("Mass")) {
+                comp.Mass = properties["Mass"].GetFloat();
+            }
+            if (properties.HasMember("MaxStrength")) {
+                comp.MaxStrength = properties["MaxStrength"].GetFloat();
+            }
+            if (properties.HasMember("UseGravity")) {
+                comp.UseGravity = properties["UseGravity"].GetBool();
+            }
+            if (properties.HasMember("JumpSpeed")) {
+                comp.JumpSpeed = properties["JumpSpeed"].GetFloat();
+            }
+        }
+        else if (componentType == "TriggerComponent") {
+            auto& comp = entity.AddComponent<TriggerComponent>();
+
+            if (properties.HasMember("ComponentGUID")) {
+                uint64_t guidValue = std::stoull(properties["ComponentGUID"].GetString());
+                comp.ComponentGUID = xresource::instance_guid{ guidValue };
+            }
+            if (properties.HasMember("Shape")) {
+                comp.Shape = static_cast<TriggerShape>(properties["Shape"].GetInt());
+            }
+            if (properties.HasMember("HalfExtents") && properties["HalfExtents"].IsArray()) {
+                const auto& ext = properties["HalfExtents"];
+                comp.HalfExtents = glm::vec3(ext[0].GetFloat(), ext[1].GetFloat(), ext[2].GetFloat());
+            }
+            if (properties.HasMember("Radius")) {
+                comp.Radius = properties["Radius"].GetFloat();
+            }
+            if (properties.HasMember("Enabled")) {
+                comp.Enabled = properties["Enabled"].GetBool();
+            }
+        }
+        else if (componentType == "JointComponent") {
+            auto& comp = entity.AddComponent<JointComponent>();
+
+            if (properties.HasMember("ComponentGUID")) {
+                uint64_t guidValue = std::stoull(properties["ComponentGUID"].GetString());
+                comp.ComponentGUID = xresource::instance_guid{ guidValue };
+            }
+            if (properties.HasMember("Type")) {
+                comp.Type = static_cast<JointType>(properties["Type"].GetInt());
+            }
+            if (properties.HasMember("Anchor") && properties["Anchor"].IsArray()) {
+                const auto& vec = properties["Anchor"];
+                comp.Anchor = glm::vec3(vec[0].GetFloat(), vec[1].GetFloat(), vec[2].GetFloat());
+            }
+            if (properties.HasMember("ConnectedAnchor") && properties["ConnectedAnchor"].IsArray()) {
+                const auto& vec = properties["ConnectedAnchor"];
+                comp.ConnectedAnchor = glm::vec3(vec[0].GetFloat(), vec[1].GetFloat(), vec[2].GetFloat());
+            }
+            if (properties.HasMember("Axis") && properties["Axis"].IsArray()) {
+                const auto& vec = properties["Axis"];
+                comp.Axis = glm::vec3(vec[0].GetFloat(), vec[1].GetFloat(), vec[2].GetFloat());
+            }
+            if (properties.HasMember("UseLimits")) {
+                comp.UseLimits = properties["UseLimits"].GetBool();
+            }
+            if (properties.HasMember("MinLimit")) {
+                comp.MinLimit = properties["MinLimit"].GetFloat();
+            }
+            if (properties.HasMember("MaxLimit")) {
+                comp.MaxLimit = properties["MaxLimit"].GetFloat();
+            }
+            if (properties.HasMember("ConeAngle")) {
+                comp.ConeAngle = properties["ConeAngle"].GetFloat();
+            }
+            if (properties.HasMember("BreakForce")) {
+                comp.BreakForce = properties["BreakForce"].GetFloat();
+            }
+            if (properties.HasMember("BreakTorque")) {
+                comp.BreakTorque = properties["BreakTorque"].GetFloat();
+            }
+        }
+        else if (componentType == "AnimatorComponent") {
+            auto& comp = entity.AddComponent<AnimatorComponent>();
+
+            if (properties.HasMember("ComponentGUID")) {
+                uint64_t guidValue = std::stoull(properties["ComponentGUID"].GetString());
+                comp.ComponentGUID = xresource::instance_guid{ guidValue };
+            }
+            if (properties.HasMember("Clip")) {
+                comp.Clip = properties["Clip"].GetInt();
+            }
+            if (properties.HasMember("BlendClip")) {
+                comp.BlendClip = properties["BlendClip"].GetInt();
+            }
+            if (properties.HasMember("BlendWeight")) {
+                comp.BlendWeight = properties["BlendWeight"].GetFloat();
+            }
+            if (properties.HasMember("Speed")) {
+                comp.Speed = properties["Speed"].GetFloat();
+            }
+            if (properties.HasMember("Time")) {
+                comp.Time = properties["Time"].GetFloat();
+            }
+            if (properties.HasMember("BlendTime")) {
+                comp.BlendTime = properties["BlendTime"].GetFloat();
+            }
+            if (properties.HasMember("Loop")) {
+                comp.Loop = properties["Loop"].GetBool();
+            }
+            if (properties.HasMember("Playing")) {
+                comp.Playing = properties["Playing"].GetBool();
+            }
+            if (properties.HasMember("CpuSkinning")) {
+                comp.CpuSkinning = properties["CpuSkinning"].GetBool();
+            }
+        }
+        else if (componentType == "ParticleEmitterComponent") {
+            auto& comp = entity.AddComponent<ParticleEmitterComponent>();
+
+            if (properties.HasMember("ComponentGUID")) {
+                uint64_t guidValue = std::stoull(properties["ComponentGUID"].GetString());
+                comp.ComponentGUID = xresource::instance_guid{ guidValue };
+            }
+            if (properties.HasMember("Emitting")) {
+                comp.Emitting = properties["Emitting"].GetBool();
+            }
+            if (properties.HasMember("Rate")) {
+                comp.Rate = properties["Rate"].GetFloat();
+            }
+            if (properties.HasMember("Burst")) {
+                comp.Burst = properties["Burst"].GetUint();
+            }
+            if (properties.HasMember("MaxParticles")) {
+                comp.MaxParticles = properties["MaxParticles"].GetUint();
+            }
+            if (properties.HasMember("LifetimeMin")) {
+                comp.LifetimeMin = properties["LifetimeMin"].GetFloat();
+            }
+            if (properties.HasMember("LifetimeMax")) {
+                comp.LifetimeMax = properties["LifetimeMax"].GetFloat();
+            }
+            if (properties.HasMember("SpawnRadius")) {
+                comp.SpawnRadius = properties["SpawnRadius"].GetFloat();
+            }
+            if (properties.HasMember("Velocity") && properties["Velocity"].IsArray()) {
+                const auto& vec = properties["Velocity"];
+                comp.Velocity = glm::vec3(vec[0].GetFloat(), vec[1].GetFloat(), vec[2].GetFloat());
+            }
+            if (properties.HasMember("Spread")) {
+                comp.Spread = properties["Spread"].GetFloat();
+            }
+            if (properties.HasMember("Gravity") && properties["Gravity"].IsArray()) {
+                const auto& vec = properties["Gravity"];
+                comp.Gravity = glm::vec3(vec[0].GetFloat(), vec[1].GetFloat(), vec[2].GetFloat());
+            }
+            if (properties.HasMember("Drag")) {
+                comp.Drag = properties["Drag"].GetFloat();
+            }
+            if (properties.HasMember("Collide")) {
+                comp.Collide = properties["Collide"].GetBool();
+            }
+            if (properties.HasMember("CollisionNormal") && properties["CollisionNormal"].IsArray()) {
+                const auto& vec = properties["CollisionNormal"];
+                comp.CollisionNormal = glm::vec3(vec[0].GetFloat(), vec[1].GetFloat(), vec[2].GetFloat());
+            }
+            if (properties.HasMember("CollisionOffset")) {
+                comp.CollisionOffset = properties["CollisionOffset"].GetFloat();
+            }
+            if (properties.HasMember("Restitution")) {
+                comp.Restitution = properties["Restitution"].GetFloat();
+            }
+            if (properties.HasMember("StartColor") && properties["StartColor"].IsArray()) {
+                const auto& vec = properties["StartColor"];
+                comp.StartColor = glm::vec4(vec[0].GetFloat(), vec[1].GetFloat(), vec[2].GetFloat(), vec[3].GetFloat());
+            }
+            if (properties.HasMember("EndColor") && properties["EndColor"].IsArray()) {
+                const auto& vec = properties["EndColor"];
+                comp.EndColor = glm::vec4(vec[0].GetFloat(), vec[1].GetFloat(), vec[2].GetFloat(), vec[3].GetFloat());
+            }
+            if (properties.HasMember("StartSize")) {
+                comp.StartSize = properties["StartSize"].GetFloat();
+            }
+            if (properties.HasMember("EndSize")) {
+                comp.EndSize = properties["EndSize"].GetFloat();
+            }
+            if (properties.HasMember("Additive")) {
+                comp.Additive = properties["Additive"].GetBool();
+            }
+            if (properties.HasMember("SortByDepth")) {
+                comp.SortByDepth = properties["SortByDepth"].GetBool();
+            }
         }
         else if (componentType == "AudioComponent") {
             auto& comp = entity.AddComponent<AudioComponent>();
@@ -14,9 +14,17 @@
 #include "../Component/CameraComponent.h"
 #include "../Component/MeshRendererComponent.h"
 #include "../Component/RigidbodyComponent.h"
+#include "../Component/CharacterControllerComponent.h"
+#include "../Component/TriggerComponent.h"
+#include "../Component/JointComponent.h"
+#include "../Component/AnimatorComponent.h"
+#include "../Component/ParticleEmitterComponent.h"
 #include "../Component/AudioComponent.h"
 #include "../Component/ListenerComponent.h"
 #include "../Component/ReverbZoneComponent.h"
+#include "../Component/PrefabComponent.h"
+#include "../Prefab/PrefabOverrides.h"
+#include "../Prefab/PrefabRegistry.h"
 #include "../Utility/Logger.h"
 
 #include <rapidjson/document.h>
@@ -66,6 +74,13 @@ namespace Engine {
         auto prefab = std::make_shared<Prefab>(PrefabType::Scene);
         prefab->SetName(name);
 
+        // Refresh override diffs so nested prefab instances are stored as references
+        for (Entity entity : entities) {
+            if (entity && entity.HasComponent<PrefabComponent>()) {
+                PrefabOverrides::Compute(scene, entity);
+            }
+        }
+
         // Serialize all entities
         std::string sceneData = SerializeEntities(entities, scene->GetRegistry());
         prefab->SetSceneData(sceneData);
@@ -210,11 +225,31 @@ namespace Engine {
         // Entity ID
         doc.AddMember("ID", static_cast<uint32_t>(entity), allocator);
 
+        // Instances of entity prefabs are written as a reference plus their recorded
+        // override diff (nested prefab / variant); only added components follow in full
+        const PrefabComponent* prefabComp = nullptr;
+        if (entity.HasComponent<PrefabComponent>()) {
+            const auto& instance = entity.GetComponent<PrefabComponent>();
+            auto nested = PrefabRegistry::Get().GetPrefab(instance.PrefabGUID);
+            if (nested && nested->GetType() == PrefabType::Entity) {
+                prefabComp = &instance;
+
+                std::string guidString = std::to_string(instance.PrefabGUID.m_Value);
+                std::string overrides = PrefabOverrides::Encode(instance);
+                doc.AddMember("Prefab", rapidjson::Value(guidString.c_str(), allocator), allocator);
+                doc.AddMember("Overrides", rapidjson::Value(overrides.c_str(), allocator), allocator);
+            }
+        }
+
+        auto shouldSerialize = [prefabComp](const char* reflectedName) {
+            return !prefabComp || prefabComp->IsComponentAdded(HashReflectionName(reflectedName));
+        };
+
         // Components array
         rapidjson::Value componentsArray(rapidjson::kArrayType);
 
         // Serialize TagComponent
-        if (entity.HasComponent<TagComponent>()) {
+        if (entity.HasComponent<TagComponent>() && shouldSerialize("TagComponent")) {
             const auto& tag = entity.GetComponent<TagComponent>();
             rapidjson::Value componentObj(rapidjson::kObjectType);
             componentObj.AddMember("Type", "TagComponent", allocator);
@@ -229,7 +264,7 @@ namespace Engine {
         }
 
         // Serialize TransformComponent
-        if (entity.HasComponent<TransformComponent>()) {
+        if (entity.HasComponent<TransformComponent>() && shouldSerialize("TransformComponent")) {
             const auto& transform = entity.GetComponent<TransformComponent>();
             rapidjson::Value componentObj(rapidjson::kObjectType);
             componentObj.AddMember("Type", "TransformComponent", allocator);
@@ -260,7 +295,7 @@ namespace Engine {
         }
 
         // Serialize CameraComponent
-        if (entity.HasComponent<CameraComponent>()) {
+        if (entity.HasComponent<CameraComponent>() && shouldSerialize("CameraComponent")) {
             const auto& camera = entity.GetComponent<CameraComponent>();
             rapidjson::Value componentObj(rapidjson::kObjectType);
             componentObj.AddMember("Type", "CameraComponent", allocator);
@@ -278,7 +313,7 @@ namespace Engine {
         }
 
         // Serialize MeshRendererComponent
-        if (entity.HasComponent<MeshRendererComponent>()) {
+        if (entity.HasComponent<MeshRendererComponent>() && shouldSerialize("MeshRendererComponent")) {
             const auto& mesh = entity.GetComponent<MeshRendererComponent>();
             rapidjson::Value componentObj(rapidjson::kObjectType);
             componentObj.AddMember("Type", "MeshRendererComponent", allocator);
@@ -300,7 +335,7 @@ namespace Engine {
         }
 
         // Serialize RigidbodyComponent
-        if (entity.HasComponent<RigidbodyComponent>()) {
+        if (entity.HasComponent<RigidbodyComponent>() && shouldSerialize("RigidbodyComponent")) {
             const auto& rb = entity.GetComponent<RigidbodyComponent>();
             rapidjson::Value componentObj(rapidjson::kObjectType);
             componentObj.AddMember("Type", "RigidbodyComponent", allocator);
@@ -318,12 +353,202 @@ namespace Engine {
             velArray.PushBack(rb.Velocity.z, allocator);
             propertiesObj.AddMember("Velocity", velArray, allocator);
 
+            rapidjson::Value angVelArray(rapidjson::kArrayType);
+            angVelArray.PushBack(rb.AngularVelocity.x, allocator);
+            angVelArray.PushBack(rb.AngularVelocity.y, allocator);
+            angVelArray.PushBack(rb.AngularVelocity.z, allocator);
+            propertiesObj.AddMember("AngularVelocity", angVelArray, allocator);
+
+            propertiesObj.AddMember("LinearDamping", rb.LinearDamping, allocator);
+            propertiesObj.AddMember("AngularDamping", rb.AngularDamping, allocator);
+            propertiesObj.AddMember("Restitution", rb.Restitution, allocator);
+            propertiesObj.AddMember("Friction", rb.Friction, allocator);
+            propertiesObj.AddMember("MotionQuality", static_cast<int>(rb.MotionQuality), allocator);
+            propertiesObj.AddMember("AllowSleeping", rb.AllowSleeping, allocator);
+            propertiesObj.AddMember("CompoundChildren", rb.CompoundChildren, allocator);
+
+            componentObj.AddMember("Properties", propertiesObj, allocator);
+            componentsArray.PushBack(componentObj, allocator);
+        }
+
+        // Serialize CharacterControllerComponent
+        if (entity.HasComponent<CharacterControllerComponent>() && shouldSerialize("CharacterControllerComponent")) {
+            const auto& cc = entity.GetComponent<CharacterControllerComponent>();
+            rapidjson::Value componentObj(rapidjson::kObjectType);
+            componentObj.AddMember("Type", "CharacterControllerComponent", allocator);
+
+            rapidjson::Value propertiesObj(rapidjson::kObjectType);
+            propertiesObj.AddMember("ComponentGUID",
+                rapidjson::Value(std::to_string(cc.ComponentGUID.m_Value).c_str(), allocator), allocator);
+            propertiesObj.AddMember("Height", cc.Height, allocator);
+            propertiesObj.AddMember("Radius", cc.Radius, allocator);
+            propertiesObj.AddMember("MaxSlopeAngle", cc.MaxSlopeAngle, allocator);
+            propertiesObj.AddMember("StepHeight", cc.StepHeight, allocator);
+            propertiesObj.AddMember("StickToFloorDistance", cc.StickToFloorDistance, allocator);
+            propertiesObj.AddMember("Mass", cc.Mass, allocator);
+            propertiesObj.AddMember("MaxStrength", cc.MaxStrength, allocator);
+            propertiesObj.AddMember("UseGravity", cc.UseGravity, allocator);
+            propertiesObj.AddMember("JumpSpeed", cc.JumpSpeed, allocator);
+
+            componentObj.AddMember("Properties", propertiesObj, allocator);
+            componentsArray.PushBack(componentObj, allocator);
+        }
+
+        // Serialize TriggerComponent
+        if (entity.HasComponent<TriggerComponent>() && shouldSerialize("TriggerComponent")) {
+            const auto& trigger = entity.GetComponent<TriggerComponent>();
+            rapidjson::Value componentObj(rapidjson::kObjectType);
+            componentObj.AddMember("Type", "TriggerComponent", allocator);
+
+            rapidjson::Value propertiesObj(rapidjson::kObjectType);
+            propertiesObj.AddMember("ComponentGUID",
+                rapidjson::Value(std::to_string(trigger.ComponentGUID.m_Value).c_str(), allocator), allocator);
+            propertiesObj.AddMember("Shape", static_cast<int>(trigger.Shape), allocator);
+
+            rapidjson::Value extArray(rapidjson::kArrayType);
+            extArray.PushBack(trigger.HalfExtents.x, allocator);
+            extArray.PushBack(trigger.HalfExtents.y, allocator);
+            extArray.PushBack(trigger.HalfExtents.z, allocator);
+            propertiesObj.AddMember("HalfExtents", extArray, allocator);
+
+            propertiesObj.AddMember("Radius", trigger.Radius, allocator);
+            propertiesObj.AddMember("Enabled", trigger.Enabled, allocator);
+
+            componentObj.AddMember("Properties", propertiesObj, allocator);
+            componentsArray.PushBack(componentObj, allocator);
+        }
+
+        // Serialize JointComponent (the connected entity is scene-local and not saved)
+        if (entity.HasComponent<JointComponent>() && shouldSerialize("JointComponent")) {
+            const auto& joint = entity.GetComponent<JointComponent>();
+            rapidjson::Value componentObj(rapidjson::kObjectType);
+            componentObj.AddMember("Type", "JointComponent", allocator);
+
+            rapidjson::Value propertiesObj(rapidjson::kObjectType);
+            propertiesObj.AddMember("ComponentGUID",
+                rapidjson::Value(std::to_string(joint.ComponentGUID.m_Value).c_str(), allocator), allocator);
+            propertiesObj.AddMember("Type", static_cast<int>(joint.Type), allocator);
+
+            rapidjson::Value anchorArray(rapidjson::kArrayType);
+            anchorArray.PushBack(joint.Anchor.x, allocator);
+            anchorArray.PushBack(joint.Anchor.y, allocator);
+            anchorArray.PushBack(joint.Anchor.z, allocator);
+            propertiesObj.AddMember("Anchor", anchorArray, allocator);
+
+            rapidjson::Value connectedAnchorArray(rapidjson::kArrayType);
+            connectedAnchorArray.PushBack(joint.ConnectedAnchor.x, allocator);
+            connectedAnchorArray.PushBack(joint.ConnectedAnchor.y, allocator);
+            connectedAnchorArray.PushBack(joint.ConnectedAnchor.z, allocator);
+            propertiesObj.AddMember("ConnectedAnchor", connectedAnchorArray, allocator);
+
+            rapidjson::Value axisArray(rapidjson::kArrayType);
+            axisArray.PushBack(joint.Axis.x, allocator);
+            axisArray.PushBack(joint.Axis.y, allocator);
+            axisArray.PushBack(joint.Axis.z, allocator);
+            propertiesObj.AddMember("Axis", axisArray, allocator);
+
+            propertiesObj.AddMember("UseLimits", joint.UseLimits, allocator);
+            propertiesObj.AddMember("MinLimit", joint.MinLimit, allocator);
+            propertiesObj.AddMember("MaxLimit", joint.MaxLimit, allocator);
+            propertiesObj.AddMember("ConeAngle", joint.ConeAngle, allocator);
+            propertiesObj.AddMember("BreakForce", joint.BreakForce, allocator);
+            propertiesObj.AddMember("BreakTorque", joint.BreakTorque, allocator);
+
+            componentObj.AddMember("Properties", propertiesObj, allocator);
+            componentsArray.PushBack(componentObj, allocator);
+        }
+
+        // Serialize AnimatorComponent
+        if (entity.HasComponent<AnimatorComponent>() && shouldSerialize("AnimatorComponent")) {
+            const auto& animator = entity.GetComponent<AnimatorComponent>();
+            rapidjson::Value componentObj(rapidjson::kObjectType);
+            componentObj.AddMember("Type", "AnimatorComponent", allocator);
+
+            rapidjson::Value propertiesObj(rapidjson::kObjectType);
+            propertiesObj.AddMember("ComponentGUID",
+                rapidjson::Value(std::to_string(animator.ComponentGUID.m_Value).c_str(), allocator), allocator);
+            propertiesObj.AddMember("Clip", animator.Clip, allocator);
+            propertiesObj.AddMember("BlendClip", animator.BlendClip, allocator);
+            propertiesObj.AddMember("BlendWeight", animator.BlendWeight, allocator);
+            propertiesObj.AddMember("Speed", animator.Speed, allocator);
+            propertiesObj.AddMember("Time", animator.Time, allocator);
+            propertiesObj.AddMember("BlendTime", animator.BlendTime, allocator);
+            propertiesObj.AddMember("Loop", animator.Loop, allocator);
+            propertiesObj.AddMember("Playing", animator.Playing, allocator);
+            propertiesObj.AddMember("CpuSkinning", animator.CpuSkinning, allocator);
+
+            componentObj.AddMember("Properties", propertiesObj, allocator);
+            componentsArray.PushBack(componentObj, allocator);
+        }
+
+        // Serialize ParticleEmitterComponent
+        if (entity.HasComponent<ParticleEmitterComponent>() && shouldSerialize("ParticleEmitterComponent")) {
+            const auto& emitter = entity.GetComponent<ParticleEmitterComponent>();
+            rapidjson::Value componentObj(rapidjson::kObjectType);
+            componentObj.AddMember("Type", "ParticleEmitterComponent", allocator);
+
+            rapidjson::Value propertiesObj(rapidjson::kObjectType);
+            propertiesObj.AddMember("ComponentGUID",
+                rapidjson::Value(std::to_string(emitter.ComponentGUID.m_Value).c_str(), allocator), allocator);
+            propertiesObj.AddMember("Emitting", emitter.Emitting, allocator);
+            propertiesObj.AddMember("Rate", emitter.Rate, allocator);
+            propertiesObj.AddMember("Burst", emitter.Burst, allocator);
+            propertiesObj.AddMember("MaxParticles", emitter.MaxParticles, allocator);
+            propertiesObj.AddMember("LifetimeMin", emitter.LifetimeMin, allocator);
+            propertiesObj.AddMember("LifetimeMax", emitter.LifetimeMax, allocator);
+            propertiesObj.AddMember("SpawnRadius", emitter.SpawnRadius, allocator);
+
+            rapidjson::Value velocityArray(rapidjson::kArrayType);
+            velocityArray.PushBack(emitter.Velocity.x, allocator);
+            velocityArray.PushBack(emitter.Velocity.y, allocator);
+            velocityArray.PushBack(emitter.Velocity.z, allocator);
+            propertiesObj.AddMember("Velocity", velocityArray, allocator);
+
+            propertiesObj.AddMember("Spread", emitter.Spread, allocator);
+
+            rapidjson::Value gravityArray(rapidjson::kArrayType);
+            gravityArray.PushBack(emitter.Gravity.x, allocator);
+            gravityArray.PushBack(emitter.Gravity.y, allocator);
+            gravityArray.PushBack(emitter.Gravity.z, allocator);
+            propertiesObj.AddMember("Gravity", gravityArray, allocator);
+
+            propertiesObj.AddMember("Drag", emitter.Drag, allocator);
+            propertiesObj.AddMember("Collide", emitter.Collide, allocator);
+
+            rapidjson::Value collisionNormalArray(rapidjson::kArrayType);
+            collisionNormalArray.PushBack(emitter.CollisionNormal.x, allocator);
+            collisionNormalArray.PushBack(emitter.CollisionNormal.y, allocator);
+            collisionNormalArray.PushBack(emitter.CollisionNormal.z, allocator);
+            propertiesObj.AddMember("CollisionNormal", collisionNormalArray, allocator);
+
+            propertiesObj.AddMember("CollisionOffset", emitter.CollisionOffset, allocator);
+            propertiesObj.AddMember("Restitution", emitter.Restitution, allocator);
+
+            rapidjson::Value startColorArray(rapidjson::kArrayType);
+            startColorArray.PushBack(emitter.StartColor.x, allocator);
+            startColorArray.PushBack(emitter.StartColor.y, allocator);
+            startColorArray.PushBack(emitter.StartColor.z, allocator);
+            startColorArray.PushBack(emitter.StartColor.w, allocator);
+            propertiesObj.AddMember("StartColor", startColorArray, allocator);
+
+            rapidjson::Value endColorArray(rapidjson::kArrayType);
+            endColorArray.PushBack(emitter.EndColor.x, allocator);
+            endColorArray.PushBack(emitter.EndColor.y, allocator);
+            endColorArray.PushBack(emitter.EndColor.z, allocator);
+            endColorArray.PushBack(emitter.EndColor.w, allocator);
+            propertiesObj.AddMember("EndColor", endColorArray, allocator);
+
+            propertiesObj.AddMember("StartSize", emitter.StartSize, allocator);
+            propertiesObj.AddMember("EndSize", emitter.EndSize, allocator);
+            propertiesObj.AddMember("Additive", emitter.Additive, allocator);
+            propertiesObj.AddMember("SortByDepth", emitter.SortByDepth, allocator);
+
             componentObj.AddMember("Properties", propertiesObj, allocator);
             componentsArray.PushBack(componentObj, allocator);
         }
 
         // Serialize AudioComponent
-        if (entity.HasComponent<AudioComponent>()) {
+        if (entity.HasComponent<AudioComponent>() && shouldSerialize("AudioComponent")) {
             const auto& audio = entity.GetComponent<AudioComponent>();
             rapidjson::Value componentObj(rapidjson::kObjectType);
             componentObj.AddMember("Type", "AudioComponent", allocator);
@@ -347,7 +572,7 @@ namespace Engine {
         }
 
         // Serialize ListenerComponent
-        if (entity.HasComponent<ListenerComponent>()) {
+        if (entity.HasComponent<ListenerComponent>() && shouldSerialize("ListenerComponent")) {
             const auto& listener = entity.GetComponent<ListenerComponent>();
             rapidjson::Value componentObj(rapidjson::kObjectType);
             componentObj.AddMember("Type", "ListenerComponent", allocator);
@@ -360,7 +585,7 @@ namespace Engine {
         }
 
         // Serialize ReverbComponent
-        if (entity.HasComponent<ReverbZoneComponent>()) {
+        if (entity.HasComponent<ReverbZoneComponent>() && shouldSerialize("ReverbZoneComponent")) {
             const auto& reverb = entity.GetComponent<ReverbZoneComponent>();
             rapidjson::Value componentObj(rapidjson::kObjectType);
             componentObj.AddMember("Type", "ReverbComponent", allocator);
@@ -29,6 +29,8 @@ namespace Engine {
     public:
         /**
          * @brief Create an entity prefab from an existing entity
+         * @details If the entity is itself a prefab instance, the result is a variant that
+         *          references it; record its overrides first (Scene::RecordPrefabOverrides).
          * @param entity Entity to convert to prefab
          * @param name Name for the prefab
          * @return Shared pointer to the created prefab
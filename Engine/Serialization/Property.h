@@ -1,7 +1,10 @@
 #pragma once
 
 // Standard Library
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 #include <functional>
@@ -10,6 +13,9 @@
 // GLM Math Library
 #include <glm/glm.hpp>
 
+// EnTT
+#include <entt/entt.hpp>
+
 namespace Engine {
 
     // Forward declarations
@@ -31,27 +37,62 @@ namespace Engine {
         Entity
     };
 
+    /**
+     * @brief Stable 32-bit hash (FNV-1a) for component and property names
+     * @details Used as compact keys in binary data (prefab overrides, deltas)
+     */
+    inline constexpr uint32_t HashReflectionName(std::string_view name) {
+        uint32_t hash = 2166136261u;
+        for (char c : name) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
     /**
      * @brief Base property class - type-erased property access
      */
     class PropertyBase {
     public:
         PropertyBase(const std::string& name, PropertyType type)
-            : m_Name(name), m_Type(type) {
+            : m_Name(name), m_NameHash(HashReflectionName(name)), m_Type(type) {
         }
 
         virtual ~PropertyBase() = default;
 
         const std::string& GetName() const { return m_Name; }
+        uint32_t GetNameHash() const { return m_NameHash; }
         PropertyType GetType() const { return m_Type; }
 
         // Serialization helpers
         virtual std::string ToString(void* instance) const = 0;
         virtual void FromString(void* instance, const std::string& value) const = 0;
 
+        // Typed binary helpers (raw value bytes, strings without terminator)
+        virtual bool Equals(void* a, void* b) const = 0;
+        virtual void CopyValue(void* dst, void* src) const = 0;
+        virtual void WriteBinary(void* instance, std::vector<uint8_t>& out) const = 0;
+        virtual bool ReadBinary(void* instance, const uint8_t* data, size_t size) const = 0;
+
+        /**
+         * @brief Mark the property as network replicated (see Network/Replication.h)
+         * @param precision Quantization step for float lanes, 0 sends exact bits
+         */
+        void SetReplicated(float precision = 0.0f) {
+            m_Replicated = true;
+            m_ReplicationPrecision = precision;
+        }
+
+        bool IsReplicated() const { return m_Replicated; }
+        float GetReplicationPrecision() const { return m_ReplicationPrecision; }
+
     protected:
         std::string m_Name;
+        uint32_t m_NameHash;
         PropertyType m_Type;
+        bool m_Replicated = false;
+        float m_ReplicationPrecision = 0.0f;
     };
 
     /**
@@ -81,6 +122,18 @@ namespace Engine {
         std::string ToString(void* instance) const override;
         void FromString(void* instance, const std::string& value) const override;
 
+        // Binary implementation
+        bool Equals(void* a, void* b) const override {
+            return Get(*static_cast<ClassType*>(a)) == Get(*static_cast<ClassType*>(b));
+        }
+
+        void CopyValue(void* dst, void* src) const override {
+            Set(*static_cast<ClassType*>(dst), Get(*static_cast<ClassType*>(src)));
+        }
+
+        void WriteBinary(void* instance, std::vector<uint8_t>& out) const override;
+        bool ReadBinary(void* instance, const uint8_t* data, size_t size) const override;
+
     private:
         Getter m_Getter;
         Setter m_Setter;
@@ -91,8 +144,12 @@ namespace Engine {
      */
     class ComponentMetadata {
     public:
+        using GetFn = std::function<void*(entt::registry&, entt::entity)>;
+        using EmplaceFn = std::function<void*(entt::registry&, entt::entity)>;
+        using RemoveFn = std::function<void(entt::registry&, entt::entity)>;
+
         ComponentMetadata(const std::string& name)
-            : m_Name(name) {
+            : m_Name(name), m_NameHash(HashReflectionName(name)) {
         }
 
         // Delete copy constructor and assignment to prevent issues
@@ -113,13 +170,75 @@ namespace Engine {
         }
 
         const std::string& GetName() const { return m_Name; }
+        uint32_t GetNameHash() const { return m_NameHash; }
         const std::vector<std::unique_ptr<PropertyBase>>& GetProperties() const {
             return m_Properties;
         }
 
+        /**
+         * @brief Mark a property of this component as network replicated
+         * @param name Property name
+         * @param precision Quantization step for float lanes, 0 sends exact bits
+         * @return False if the component has no such property
+         */
+        bool Replicate(const std::string& name, float precision = 0.0f) {
+            for (const auto& property : m_Properties) {
+                if (property->GetName() == name) {
+                    property->SetReplicated(precision);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief True if at least one property is replicated
+         */
+        bool IsReplicated() const {
+            for (const auto& property : m_Properties) {
+                if (property->IsReplicated()) return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Find a property by name hash (nullptr if absent)
+         */
+        const PropertyBase* FindProperty(uint32_t nameHash) const {
+            for (const auto& property : m_Properties) {
+                if (property->GetNameHash() == nameHash) return property.get();
+            }
+            return nullptr;
+        }
+
+        // Type-erased registry access, installed by ReflectionRegistry::RegisterComponent
+        void SetAccessors(GetFn get, EmplaceFn emplace, RemoveFn remove) {
+            m_Get = std::move(get);
+            m_Emplace = std::move(emplace);
+            m_Remove = std::move(remove);
+        }
+
+        /// Component instance on an entity, or nullptr
+        void* Get(entt::registry& registry, entt::entity entity) const {
+            return m_Get ? m_Get(registry, entity) : nullptr;
+        }
+
+        /// Get or default-construct the component on an entity
+        void* Emplace(entt::registry& registry, entt::entity entity) const {
+            return m_Emplace ? m_Emplace(registry, entity) : nullptr;
+        }
+
+        void Remove(entt::registry& registry, entt::entity entity) const {
+            if (m_Remove) m_Remove(registry, entity);
+        }
+
     private:
         std::string m_Name;
+        uint32_t m_NameHash;
         std::vector<std::unique_ptr<PropertyBase>> m_Properties;
+        GetFn m_Get;
+        EmplaceFn m_Emplace;
+        RemoveFn m_Remove;
     };
 
     // Template implementations for ToString/FromString
@@ -200,4 +319,36 @@ namespace Engine {
         }
     }
 
-} // namespace Engine
\ No newline at end of file
+    template<typename ClassType, typename ValueType>
+    void Property<ClassType, ValueType>::WriteBinary(void* instance, std::vector<uint8_t>& out) const {
+        ValueType value = Get(*static_cast<ClassType*>(instance));
+
+        if constexpr (std::is_same_v<ValueType, std::string>) {
+            out.insert(out.end(), value.begin(), value.end());
+        }
+        else {
+            static_assert(std::is_trivially_copyable_v<ValueType>, "Binary property values must be trivially copyable");
+            const size_t offset = out.size();
+            out.resize(offset + sizeof(ValueType));
+            std::memcpy(out.data() + offset, &value, sizeof(ValueType));
+        }
+    }
+
+    template<typename ClassType, typename ValueType>
+    bool Property<ClassType, ValueType>::ReadBinary(void* instance, const uint8_t* data, size_t size) const {
+        ClassType* obj = static_cast<ClassType*>(instance);
+
+        if constexpr (std::is_same_v<ValueType, std::string>) {
+            Set(*obj, std::string(reinterpret_cast<const char*>(data), size));
+            return true;
+        }
+        else {
+            if (size != sizeof(ValueType)) return false;
+            ValueType value;
+            std::memcpy(&value, data, sizeof(ValueType));
+            Set(*obj, value);
+            return true;
+        }
+    }
+
+} // namespace Engine
@@ -35,9 +35,16 @@ namespace Engine {
             auto metadata = std::make_unique<ComponentMetadata>(name);
             ComponentMetadata* metadataPtr = metadata.get();
 
+            metadata->SetAccessors(
+                [](entt::registry& r, entt::entity e) -> void* { return r.try_get<T>(e); },
+                [](entt::registry& r, entt::entity e) -> void* { return &r.get_or_emplace<T>(e); },
+                [](entt::registry& r, entt::entity e) { r.remove<T>(e); }
+            );
+
             // Store in maps
             m_ComponentMetadata.insert(std::make_pair(typeId, std::move(metadata)));
             m_ComponentsByName.insert(std::make_pair(name, typeId));
+            m_ComponentsByHash.insert(std::make_pair(metadataPtr->GetNameHash(), metadataPtr));
 
             return *metadataPtr;
         }
@@ -66,6 +73,14 @@ namespace Engine {
             return nullptr;
         }
 
+        /**
+         * @brief Get component metadata by name hash (see HashReflectionName)
+         */
+        ComponentMetadata* GetMetadataByHash(uint32_t nameHash) {
+            auto it = m_ComponentsByHash.find(nameHash);
+            return (it != m_ComponentsByHash.end()) ? it->second : nullptr;
+        }
+
         /**
          * @brief Get all registered component types
          */
@@ -88,6 +103,7 @@ namespace Engine {
 
         std::unordered_map<std::type_index, std::unique_ptr<ComponentMetadata>> m_ComponentMetadata;
         std::unordered_map<std::string, std::type_index> m_ComponentsByName;
+        std::unordered_map<uint32_t, ComponentMetadata*> m_ComponentsByHash;
     };
 
     /**
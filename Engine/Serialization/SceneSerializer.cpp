@@ -6,9 +6,18 @@
 #include "../Component/CameraComponent.h"
 #include "../Component/MeshRendererComponent.h"
 #include "../Component/RigidbodyComponent.h"
+#include "../Component/CharacterControllerComponent.h"
+#include "../Component/TriggerComponent.h"
+#include "../Component/JointComponent.h"
+#include "../Component/AnimatorComponent.h"
+#include "../Component/ParticleEmitterComponent.h"
 #include "../Component/AudioComponent.h"
 #include "../Component/ListenerComponent.h"
 #include "../Component/ReverbZoneComponent.h"
+#include "../Component/PooledComponent.h"
+#include "../Component/PrefabComponent.h"
+#include "../Prefab/PrefabOverrides.h"
+#include "PrefabInstantiator.h"
 
 #include "ReflectionRegistry.h"
 #include "../Utility/Logger.h"
@@ -20,8 +29,10 @@
 #include <rapidjson/prettywriter.h>
 
 // Standard library
+#include <charconv>
 #include <fstream>
 #include <string>
+#include <unordered_map>
 
 // Required for quaternion to Euler conversion
 #include <glm/gtc/quaternion.hpp>
@@ -30,6 +41,23 @@
 
 namespace Engine {
 
+    namespace {
+        // GUIDs are saved as decimal strings; anything else (or 0) is rejected
+        bool ParseGUID(const rapidjson::Value& value, xresource::instance_guid& out) {
+            if (!value.IsString()) {
+                return false;
+            }
+            const char* end = value.GetString() + value.GetStringLength();
+            uint64_t parsed = 0;
+            const auto result = std::from_chars(value.GetString(), end, parsed);
+            if (result.ec != std::errc{} || result.ptr != end || parsed == 0) {
+                return false;
+            }
+            out = xresource::instance_guid{ parsed };
+            return true;
+        }
+    }
+
     SceneSerializer::SceneSerializer(Scene* scene)
         : m_Scene(scene) {
     }
@@ -78,6 +106,11 @@ namespace Engine {
 
         int entityIndex = 0;
         for (auto entityHandle : view) {
+            // Parked pool instances are runtime-only; the pool config below recreates them
+            if (registry.all_of<InactiveComponent>(entityHandle)) {
+                continue;
+            }
+
             LOG_TRACE("Serializing entity ", entityIndex++);
 
             Entity entity(entityHandle, &registry);
@@ -86,11 +119,27 @@ namespace Engine {
             // Entity ID
             entityObj.AddMember("ID", (uint32_t)entity, allocator);
 
+            // Prefab instances store a link plus their override diff; only components
+            // the prefab does not have are written out in full
+            PrefabComponent* prefabComp = nullptr;
+            if (entity.HasComponent<PrefabComponent>() && PrefabOverrides::Compute(m_Scene, entity)) {
+                prefabComp = &entity.GetComponent<PrefabComponent>();
+
+                std::string guidString = std::to_string(prefabComp->PrefabGUID.m_Value);
+                std::string overrides = PrefabOverrides::Encode(*prefabComp);
+                entityObj.AddMember("Prefab", Value(guidString.c_str(), allocator), allocator);
+                entityObj.AddMember("Overrides", Value(overrides.c_str(), allocator), allocator);
+            }
+
+            auto shouldSerialize = [prefabComp](const char* reflectedName) {
+                return !prefabComp || prefabComp->IsComponentAdded(HashReflectionName(reflectedName));
+            };
+
             // Components array
             Value componentsArray(kArrayType);
 
             // Serialize TagComponent
-            if (entity.HasComponent<TagComponent>()) {
+            if (entity.HasComponent<TagComponent>() && shouldSerialize("TagComponent")) {
                 LOG_TRACE("  - Serializing TagComponent");
                 auto& tag = entity.GetComponent<TagComponent>();
                 Value componentObj(kObjectType);
@@ -104,7 +153,7 @@ namespace Engine {
             }
 
             // Serialize TransformComponent
-            if (entity.HasComponent<TransformComponent>()) {
+            if (entity.HasComponent<TransformComponent>() && shouldSerialize("TransformComponent")) {
                 LOG_TRACE("  - Serializing TransformComponent");
                 auto& transform = entity.GetComponent<TransformComponent>();
                 Value componentObj(kObjectType);
@@ -139,7 +188,7 @@ namespace Engine {
             }
 
             // Serialize CameraComponent
-            if (entity.HasComponent<CameraComponent>()) {
+            if (entity.HasComponent<CameraComponent>() && shouldSerialize("CameraComponent")) {
                 LOG_TRACE("  - Serializing CameraComponent");
                 auto& camera = entity.GetComponent<CameraComponent>();
                 Value componentObj(kObjectType);
@@ -166,7 +215,7 @@ namespace Engine {
             }
 
             // Serialize MeshRendererComponent
-            if (entity.HasComponent<MeshRendererComponent>()) {
+            if (entity.HasComponent<MeshRendererComponent>() && shouldSerialize("MeshRendererComponent")) {
                 LOG_TRACE("  - Serializing MeshRendererComponent");
                 auto& mesh = entity.GetComponent<MeshRendererComponent>();
                 Value componentObj(kObjectType);
@@ -183,7 +232,7 @@ namespace Engine {
             }
 
             // Serialize RigidbodyComponent
-            if (entity.HasComponent<RigidbodyComponent>()) {
+            if (entity.HasComponent<RigidbodyComponent>() && shouldSerialize("RigidbodyComponent")) {
                 LOG_TRACE("  - Serializing RigidbodyComponent");
                 auto& rb = entity.GetComponent<RigidbodyComponent>();
                 Value componentObj(kObjectType);
@@ -200,12 +249,200 @@ namespace Engine {
                 velArray.PushBack(rb.Velocity.z, allocator);
                 propertiesObj.AddMember("Velocity", velArray, allocator);
 
+                Value angVelArray(kArrayType);
+                angVelArray.PushBack(rb.AngularVelocity.x, allocator);
+                angVelArray.PushBack(rb.AngularVelocity.y, allocator);
+                angVelArray.PushBack(rb.AngularVelocity.z, allocator);
+                propertiesObj.AddMember("AngularVelocity", angVelArray, allocator);
+
+                propertiesObj.AddMember("LinearDamping", rb.LinearDamping, allocator);
+                propertiesObj.AddMember("AngularDamping", rb.AngularDamping, allocator);
+                propertiesObj.AddMember("Restitution", rb.Restitution, allocator);
+                propertiesObj.AddMember("Friction", rb.Friction, allocator);
+                propertiesObj.AddMember("MotionQuality", static_cast<int>(rb.MotionQuality), allocator);
+                propertiesObj.AddMember("AllowSleeping", rb.AllowSleeping, allocator);
+                propertiesObj.AddMember("CompoundChildren", rb.CompoundChildren, allocator);
+
+                componentObj.AddMember("Properties", propertiesObj, allocator);
+                componentsArray.PushBack(componentObj, allocator);
+            }
+
+            // Serialize CharacterControllerComponent (settings only, state is rebuilt at runtime)
+            if (entity.HasComponent<CharacterControllerComponent>() && shouldSerialize("CharacterControllerComponent")) {
+                LOG_TRACE("  - Serializing CharacterControllerComponent");
+                auto& cc = entity.GetComponent<CharacterControllerComponent>();
+                Value componentObj(kObjectType);
+                componentObj.AddMember("Type", "CharacterControllerComponent", allocator);
+
+                Value propertiesObj(kObjectType);
+                propertiesObj.AddMember("Height", cc.Height, allocator);
+                propertiesObj.AddMember("Radius", cc.Radius, allocator);
+                propertiesObj.AddMember("MaxSlopeAngle", cc.MaxSlopeAngle, allocator);
+                propertiesObj.AddMember("StepHeight", cc.StepHeight, allocator);
+                propertiesObj.AddMember("StickToFloorDistance", cc.StickToFloorDistance, allocator);
+                propertiesObj.AddMember("Mass", cc.Mass, allocator);
+                propertiesObj.AddMember("MaxStrength", cc.MaxStrength, allocator);
+                propertiesObj.AddMember("UseGravity", cc.UseGravity, allocator);
+                propertiesObj.AddMember("JumpSpeed", cc.JumpSpeed, allocator);
+
+                componentObj.AddMember("Properties", propertiesObj, allocator);
+                componentsArray.PushBack(componentObj, allocator);
+            }
+
+            // Serialize TriggerComponent (settings only, overlaps are rebuilt at runtime)
+            if (entity.HasComponent<TriggerComponent>() && shouldSerialize("TriggerComponent")) {
+                LOG_TRACE("  - Serializing TriggerComponent");
+                auto& trigger = entity.GetComponent<TriggerComponent>();
+                Value componentObj(kObjectType);
+                componentObj.AddMember("Type", "TriggerComponent", allocator);
+
+                Value propertiesObj(kObjectType);
+                propertiesObj.AddMember("Shape", static_cast<int>(trigger.Shape), allocator);
+
+                Value extArray(kArrayType);
+                extArray.PushBack(trigger.HalfExtents.x, allocator);
+                extArray.PushBack(trigger.HalfExtents.y, allocator);
+                extArray.PushBack(trigger.HalfExtents.z, allocator);
+                propertiesObj.AddMember("HalfExtents", extArray, allocator);
+
+                propertiesObj.AddMember("Radius", trigger.Radius, allocator);
+                propertiesObj.AddMember("Enabled", trigger.Enabled, allocator);
+
+                componentObj.AddMember("Properties", propertiesObj, allocator);
+                componentsArray.PushBack(componentObj, allocator);
+            }
+
+            // Serialize JointComponent (the connected entity by its saved ID, remapped on load)
+            if (entity.HasComponent<JointComponent>() && shouldSerialize("JointComponent")) {
+                LOG_TRACE("  - Serializing JointComponent");
+                auto& joint = entity.GetComponent<JointComponent>();
+                Value componentObj(kObjectType);
+                componentObj.AddMember("Type", "JointComponent", allocator);
+
+                Value propertiesObj(kObjectType);
+                propertiesObj.AddMember("Type", static_cast<int>(joint.Type), allocator);
+                if (joint.ConnectedEntity != entt::null) {
+                    propertiesObj.AddMember("ConnectedEntity", static_cast<uint32_t>(joint.ConnectedEntity), allocator);
+                }
+
+                Value anchorArray(kArrayType);
+                anchorArray.PushBack(joint.Anchor.x, allocator);
+                anchorArray.PushBack(joint.Anchor.y, allocator);
+                anchorArray.PushBack(joint.Anchor.z, allocator);
+                propertiesObj.AddMember("Anchor", anchorArray, allocator);
+
+                Value connectedAnchorArray(kArrayType);
+                connectedAnchorArray.PushBack(joint.ConnectedAnchor.x, allocator);
+                connectedAnchorArray.PushBack(joint.ConnectedAnchor.y, allocator);
+                connectedAnchorArray.PushBack(joint.ConnectedAnchor.z, allocator);
+                propertiesObj.AddMember("ConnectedAnchor", connectedAnchorArray, allocator);
+
+                Value axisArray(kArrayType);
+                axisArray.PushBack(joint.Axis.x, allocator);
+                axisArray.PushBack(joint.Axis.y, allocator);
+                axisArray.PushBack(joint.Axis.z, allocator);
+                propertiesObj.AddMember("Axis", axisArray, allocator);
+
+                propertiesObj.AddMember("UseLimits", joint.UseLimits, allocator);
+                propertiesObj.AddMember("MinLimit", joint.MinLimit, allocator);
+                propertiesObj.AddMember("MaxLimit", joint.MaxLimit, allocator);
+                propertiesObj.AddMember("ConeAngle", joint.ConeAngle, allocator);
+                propertiesObj.AddMember("BreakForce", joint.BreakForce, allocator);
+                propertiesObj.AddMember("BreakTorque", joint.BreakTorque, allocator);
+
+                componentObj.AddMember("Properties", propertiesObj, allocator);
+                componentsArray.PushBack(componentObj, allocator);
+            }
+
+            // Serialize AnimatorComponent (playback state only, poses are rebuilt at runtime)
+            if (entity.HasComponent<AnimatorComponent>() && shouldSerialize("AnimatorComponent")) {
+                LOG_TRACE("  - Serializing AnimatorComponent");
+                auto& animator = entity.GetComponent<AnimatorComponent>();
+                Value componentObj(kObjectType);
+                componentObj.AddMember("Type", "AnimatorComponent", allocator);
+
+                Value propertiesObj(kObjectType);
+                propertiesObj.AddMember("Clip", animator.Clip, allocator);
+                propertiesObj.AddMember("BlendClip", animator.BlendClip, allocator);
+                propertiesObj.AddMember("BlendWeight", animator.BlendWeight, allocator);
+                propertiesObj.AddMember("Speed", animator.Speed, allocator);
+                propertiesObj.AddMember("Time", animator.Time, allocator);
+                propertiesObj.AddMember("BlendTime", animator.BlendTime, allocator);
+                propertiesObj.AddMember("Loop", animator.Loop, allocator);
+                propertiesObj.AddMember("Playing", animator.Playing, allocator);
+                propertiesObj.AddMember("CpuSkinning", animator.CpuSkinning, allocator);
+
+                componentObj.AddMember("Properties", propertiesObj, allocator);
+                componentsArray.PushBack(componentObj, allocator);
+            }
+
+            // Serialize ParticleEmitterComponent (settings only, live particles are not saved)
+            if (entity.HasComponent<ParticleEmitterComponent>() && shouldSerialize("ParticleEmitterComponent")) {
+                LOG_TRACE("  - Serializing ParticleEmitterComponent");
+                auto& emitter = entity.GetComponent<ParticleEmitterComponent>();
+                Value componentObj(kObjectType);
+                componentObj.AddMember("Type", "ParticleEmitterComponent", allocator);
+
+                Value propertiesObj(kObjectType);
+                propertiesObj.AddMember("Emitting", emitter.Emitting, allocator);
+                propertiesObj.AddMember("Rate", emitter.Rate, allocator);
+                propertiesObj.AddMember("Burst", emitter.Burst, allocator);
+                propertiesObj.AddMember("MaxParticles", emitter.MaxParticles, allocator);
+                propertiesObj.AddMember("LifetimeMin", emitter.LifetimeMin, allocator);
+                propertiesObj.AddMember("LifetimeMax", emitter.LifetimeMax, allocator);
+                propertiesObj.AddMember("SpawnRadius", emitter.SpawnRadius, allocator);
+
+                Value velocityArray(kArrayType);
+                velocityArray.PushBack(emitter.Velocity.x, allocator);
+                velocityArray.PushBack(emitter.Velocity.y, allocator);
+                velocityArray.PushBack(emitter.Velocity.z, allocator);
+                propertiesObj.AddMember("Velocity", velocityArray, allocator);
+
+                propertiesObj.AddMember("Spread", emitter.Spread, allocator);
+
+                Value gravityArray(kArrayType);
+                gravityArray.PushBack(emitter.Gravity.x, allocator);
+                gravityArray.PushBack(emitter.Gravity.y, allocator);
+                gravityArray.PushBack(emitter.Gravity.z, allocator);
+                propertiesObj.AddMember("Gravity", gravityArray, allocator);
+
+                propertiesObj.AddMember("Drag", emitter.Drag, allocator);
+                propertiesObj.AddMember("Collide", emitter.Collide, allocator);
+
+                Value collisionNormalArray(kArrayType);
+                collisionNormalArray.PushBack(emitter.CollisionNormal.x, allocator);
+                collisionNormalArray.PushBack(emitter.CollisionNormal.y, allocator);
+                collisionNormalArray.PushBack(emitter.CollisionNormal.z, allocator);
+                propertiesObj.AddMember("CollisionNormal", collisionNormalArray, allocator);
+
+                propertiesObj.AddMember("CollisionOffset", emitter.CollisionOffset, allocator);
+                propertiesObj.AddMember("Restitution", emitter.Restitution, allocator);
+
+                Value startColorArray(kArrayType);
+                startColorArray.PushBack(emitter.StartColor.x, allocator);
+                startColorArray.PushBack(emitter.StartColor.y, allocator);
+                startColorArray.PushBack(emitter.StartColor.z, allocator);
+                startColorArray.PushBack(emitter.StartColor.w, allocator);
+                propertiesObj.AddMember("StartColor", startColorArray, allocator);
+
+                Value endColorArray(kArrayType);
+                endColorArray.PushBack(emitter.EndColor.x, allocator);
+                endColorArray.PushBack(emitter.EndColor.y, allocator);
+                endColorArray.PushBack(emitter.EndColor.z, allocator);
+                endColorArray.PushBack(emitter.EndColor.w, allocator);
+                propertiesObj.AddMember("EndColor", endColorArray, allocator);
+
+                propertiesObj.AddMember("StartSize", emitter.StartSize, allocator);
+                propertiesObj.AddMember("EndSize", emitter.EndSize, allocator);
+                propertiesObj.AddMember("Additive", emitter.Additive, allocator);
+                propertiesObj.AddMember("SortByDepth", emitter.SortByDepth, allocator);
+
                 componentObj.AddMember("Properties", propertiesObj, allocator);
                 componentsArray.PushBack(componentObj, allocator);
             }
 
             // Serialize AudioComponent
-            if (entity.HasComponent<AudioComponent>()) {
+            if (entity.HasComponent<AudioComponent>() && shouldSerialize("AudioComponent")) {
                 LOG_TRACE("  - Serializing AudioComponent");
                 auto& audio = entity.GetComponent<AudioComponent>();
                 Value componentObj(kObjectType);
@@ -229,7 +466,7 @@ namespace Engine {
             }
 
             // Serialize ListenerComponent
-            if (entity.HasComponent<ListenerComponent>()) {
+            if (entity.HasComponent<ListenerComponent>() && shouldSerialize("ListenerComponent")) {
                 LOG_TRACE("  - Serializing ListenerComponent");
                 auto& listener = entity.GetComponent<ListenerComponent>();
                 Value componentObj(kObjectType);
@@ -243,7 +480,7 @@ namespace Engine {
             }
 
             // Serialize ReverbComponent
-            if (entity.HasComponent<ReverbZoneComponent>()) {
+            if (entity.HasComponent<ReverbZoneComponent>() && shouldSerialize("ReverbZoneComponent")) {
                 LOG_TRACE("  - Serializing ReverbComponent");
 
                 auto& reverb = entity.GetComponent<ReverbZoneComponent>();
@@ -270,6 +507,23 @@ namespace Engine {
 
         doc.AddMember("Entities", entitiesArray, allocator);
 
+        // Prefab pools to prewarm on load
+        Value poolsArray(kArrayType);
+        for (const auto& [prefabGUID, stats] : m_Scene->GetPrefabPool().GetAllStats()) {
+            if (stats.PrewarmCount == 0) {
+                continue;
+            }
+
+            Value poolObj(kObjectType);
+            std::string guidString = std::to_string(prefabGUID.m_Value);
+            poolObj.AddMember("PrefabGUID", Value(guidString.c_str(), allocator), allocator);
+            poolObj.AddMember("Count", stats.PrewarmCount, allocator);
+            poolsArray.PushBack(poolObj, allocator);
+        }
+        if (!poolsArray.Empty()) {
+            doc.AddMember("PrefabPools", poolsArray, allocator);
+        }
+
         // Convert to string
         StringBuffer buffer;
         PrettyWriter<StringBuffer> writer(buffer);
@@ -311,6 +565,7 @@ namespace Engine {
 
         // Clear current scene
         auto& registry = m_Scene->GetRegistry();
+        m_Scene->GetPrefabPool().Clear();
         registry.clear();
 
         // Read scene name
@@ -327,128 +582,351 @@ namespace Engine {
         }
 
         const Value& entities = doc["Entities"];
+        bool hasPrefabInstances = false;
+        EntityRemap remap;
 
         for (SizeType i = 0; i < entities.Size(); i++) {
-            const Value& entityObj = entities[i];
-
-            // Get entity name from TagComponent if available
-            std::string entityName = "Entity";
-            if (entityObj.HasMember("Components")) {
-                const Value& components = entityObj["Components"];
-                for (SizeType j = 0; j < components.Size(); j++) {
-                    if (components[j]["Type"].GetString() == std::string("TagComponent")) {
-                        entityName = components[j]["Properties"]["Tag"].GetString();
-                        break;
-                    }
+            bool hasOverrides = false;
+            DeserializeEntity(entities[i], hasOverrides, remap);
+            hasPrefabInstances = hasPrefabInstances || hasOverrides;
+        }
+
+        // Apply all prefab instance overrides in one pass
+        if (hasPrefabInstances) {
+            PrefabOverrides::ApplyAll(m_Scene);
+        }
+
+        ResolveReferences(remap);
+
+        // Prewarm prefab pools (optional section)
+        if (doc.HasMember("PrefabPools") && doc["PrefabPools"].IsArray()) {
+            const Value& pools = doc["PrefabPools"];
+            for (SizeType i = 0; i < pools.Size(); i++) {
+                const Value& poolObj = pools[i];
+                if (!poolObj.HasMember("PrefabGUID") || !poolObj.HasMember("Count") || !poolObj["Count"].IsUint()) {
+                    continue;
                 }
+
+                xresource::instance_guid prefabGUID;
+                if (!ParseGUID(poolObj["PrefabGUID"], prefabGUID)) {
+                    LOG_WARNING("Invalid PrefabGUID in PrefabPools entry ", i, ", pool not prewarmed");
+                    continue;
+                }
+                m_Scene->PrewarmPrefab(prefabGUID, poolObj["Count"].GetUint());
+            }
+        }
+
+        LOG_INFO("Scene deserialized successfully");
+        return true;
+    }
+
+    Entity SceneSerializer::DeserializeEntity(const rapidjson::Value& entityObj, bool& hasPrefabOverrides, EntityRemap& remap) {
+        using namespace rapidjson;
+
+        hasPrefabOverrides = false;
+
+        // Get entity name from TagComponent if available
+        std::string entityName = "Entity";
+        if (entityObj.HasMember("Components")) {
+            const Value& components = entityObj["Components"];
+            for (SizeType j = 0; j < components.Size(); j++) {
+                if (components[j]["Type"].GetString() == std::string("TagComponent")) {
+                    entityName = components[j]["Properties"]["Tag"].GetString();
+                    break;
+                }
+            }
+        }
+
+        // Create entity (prefab instances start from the prefab and keep their diff)
+        Entity entity;
+        xresource::instance_guid prefabGUID;
+        if (entityObj.HasMember("Prefab") && !ParseGUID(entityObj["Prefab"], prefabGUID)) {
+            LOG_WARNING("Invalid Prefab GUID for entity '", entityName, "', loading saved components only");
+        }
+        else if (entityObj.HasMember("Prefab")) {
+            entity = PrefabInstantiator::InstantiateEntityPrefab(m_Scene, prefabGUID);
+
+            if (entity && entityObj.HasMember("Overrides")) {
+                PrefabOverrides::Decode(entityObj["Overrides"].GetString(), entity.GetComponent<PrefabComponent>());
+                hasPrefabOverrides = true;
+            }
+            else if (!entity) {
+                LOG_WARNING("Prefab missing for entity '", entityName, "', loading saved components only");
             }
+        }
+        if (!entity) {
+            entity = m_Scene->CreateEntity(entityName);
+        }
 
-            // Create entity
-            Entity entity = m_Scene->CreateEntity(entityName);
+        if (entityObj.HasMember("ID")) {
+            remap.LoadedById[entityObj["ID"].GetUint()] = entity;
+        }
 
-            // Deserialize components
-            if (entityObj.HasMember("Components")) {
-                const Value& components = entityObj["Components"];
+        // Deserialize components
+        if (entityObj.HasMember("Components")) {
+            const Value& components = entityObj["Components"];
 
-                for (SizeType j = 0; j < components.Size(); j++) {
-                    const Value& componentObj = components[j];
-                    std::string componentType = componentObj["Type"].GetString();
-                    const Value& properties = componentObj["Properties"];
+            for (SizeType j = 0; j < components.Size(); j++) {
+                const Value& componentObj = components[j];
+                std::string componentType = componentObj["Type"].GetString();
+                const Value& properties = componentObj["Properties"];
 
-                    // Deserialize specific component types
-                    if (componentType == "TagComponent") {
-                        auto& tag = entity.AddComponent<TagComponent>();
-                        tag.Tag = properties["Tag"].GetString();
+                // Deserialize specific component types
+                if (componentType == "TagComponent") {
+                    auto& tag = entity.AddComponent<TagComponent>();
+                    tag.Tag = properties["Tag"].GetString();
+                }
+                else if (componentType == "TransformComponent") {
+                    auto& transform = entity.AddComponent<TransformComponent>();
+
+                    // Position
+                    if (properties.HasMember("Position")) {
+                        const Value& posArray = properties["Position"];
+                        transform.Position = glm::vec3(
+                            posArray[0].GetFloat(),
+                            posArray[1].GetFloat(),
+                            posArray[2].GetFloat()
+                        );
                     }
-                    else if (componentType == "TransformComponent") {
-                        auto& transform = entity.AddComponent<TransformComponent>();
-
-                        // Position
-                        if (properties.HasMember("Position")) {
-                            const Value& posArray = properties["Position"];
-                            transform.Position = glm::vec3(
-                                posArray[0].GetFloat(),
-                                posArray[1].GetFloat(),
-                                posArray[2].GetFloat()
-                            );
-                        }
 
-                        // Rotation - Convert Euler angles to quaternion
-                        if (properties.HasMember("Rotation")) {
-                            const Value& rotArray = properties["Rotation"];
-                            glm::vec3 eulerRotation(
-                                rotArray[0].GetFloat(),
-                                rotArray[1].GetFloat(),
-                                rotArray[2].GetFloat()
-                            );
-                            transform.Rotation = glm::quat(glm::radians(eulerRotation));
-                        }
+                    // Rotation - Convert Euler angles to quaternion
+                    if (properties.HasMember("Rotation")) {
+                        const Value& rotArray = properties["Rotation"];
+                        glm::vec3 eulerRotation(
+                            rotArray[0].GetFloat(),
+                            rotArray[1].GetFloat(),
+                            rotArray[2].GetFloat()
+                        );
+                        transform.Rotation = glm::quat(glm::radians(eulerRotation));
+                    }
 
-                        // Scale
-                        if (properties.HasMember("Scale")) {
-                            const Value& scaleArray = properties["Scale"];
-                            transform.Scale = glm::vec3(
-                                scaleArray[0].GetFloat(),
-                                scaleArray[1].GetFloat(),
-                                scaleArray[2].GetFloat()
-                            );
-                        }
+                    // Scale
+                    if (properties.HasMember("Scale")) {
+                        const Value& scaleArray = properties["Scale"];
+                        transform.Scale = glm::vec3(
+                            scaleArray[0].GetFloat(),
+                            scaleArray[1].GetFloat(),
+                            scaleArray[2].GetFloat()
+                        );
                     }
-                    else if (componentType == "CameraComponent") {
-                        auto& camera = entity.AddComponent<CameraComponent>();
-
-                        if (properties.HasMember("Enabled"))
-                            camera.Enabled = properties["Enabled"].GetBool();
-                        if (properties.HasMember("autoAspect"))
-                            camera.autoAspect = properties["autoAspect"].GetBool();
-                        if (properties.HasMember("isDirty"))
-                            camera.isDirty = properties["isDirty"].GetBool();
-                        if (properties.HasMember("Depth"))
-                            camera.Depth = properties["Depth"].GetUint();
-                        if (properties.HasMember("Aspect"))
-                            camera.Aspect = properties["Aspect"].GetFloat();
-                        if (properties.HasMember("FOV"))
-                            camera.FOV = properties["FOV"].GetFloat();
-                        if (properties.HasMember("NearPlane"))
-                            camera.NearPlane = properties["NearPlane"].GetFloat();
-                        if (properties.HasMember("FarPlane"))
-                            camera.FarPlane = properties["FarPlane"].GetFloat();
-
-                        if (properties.HasMember("Target")) {
-                            const Value& target = properties["Target"];
-                            camera.Target = glm::vec3(
-                                target[0].GetFloat(),
-                                target[1].GetFloat(),
-                                target[2].GetFloat()
-                            );
-                        }
+                }
+                else if (componentType == "CameraComponent") {
+                    auto& camera = entity.AddComponent<CameraComponent>();
+
+                    if (properties.HasMember("Enabled"))
+                        camera.Enabled = properties["Enabled"].GetBool();
+                    if (properties.HasMember("autoAspect"))
+                        camera.autoAspect = properties["autoAspect"].GetBool();
+                    if (properties.HasMember("isDirty"))
+                        camera.isDirty = properties["isDirty"].GetBool();
+                    if (properties.HasMember("Depth"))
+                        camera.Depth = properties["Depth"].GetUint();
+                    if (properties.HasMember("Aspect"))
+                        camera.Aspect = properties["Aspect"].GetFloat();
+                    if (properties.HasMember("FOV"))
+                        camera.FOV = properties["FOV"].GetFloat();
+                    if (properties.HasMember("NearPlane"))
+                        camera.NearPlane = properties["NearPlane"].GetFloat();
+                    if (properties.HasMember("FarPlane"))
+                        camera.FarPlane = properties["FarPlane"].GetFloat();
+
+                    if (properties.HasMember("Target")) {
+                        const Value& target = properties["Target"];
+                        camera.Target = glm::vec3(
+                            target[0].GetFloat(),
+                            target[1].GetFloat(),
+                            target[2].GetFloat()
+                        );
+                    }
+                }
+                else if (componentType == "MeshRendererComponent") {
+                    auto& mesh = entity.AddComponent<MeshRendererComponent>();
+                    if (properties.HasMember("Visible")) mesh.Visible = properties["Visible"].GetBool();
+                    if (properties.HasMember("MeshType")) mesh.MeshType = properties["MeshType"].GetUint();
+                    if (properties.HasMember("Material")) mesh.Material = properties["Material"].GetUint();
+                    if (properties.HasMember("Texture")) mesh.Texture = properties["Texture"].GetUint();
+                }
+                else if (componentType == "RigidbodyComponent") {
+                    auto& rb = entity.AddComponent<RigidbodyComponent>();
+                    if (properties.HasMember("Mass")) rb.Mass = properties["Mass"].GetFloat();
+                    if (properties.HasMember("IsKinematic")) rb.IsKinematic = properties["IsKinematic"].GetBool();
+                    if (properties.HasMember("UseGravity")) rb.UseGravity = properties["UseGravity"].GetBool();
+
+                    if (properties.HasMember("Velocity")) {
+                        const Value& velArray = properties["Velocity"];
+                        rb.Velocity = glm::vec3(
+                            velArray[0].GetFloat(),
+                            velArray[1].GetFloat(),
+                            velArray[2].GetFloat()
+                        );
+                    }
+
+                    if (properties.HasMember("AngularVelocity")) {
+                        const Value& angVelArray = properties["AngularVelocity"];
+                        rb.AngularVelocity = glm::vec3(
+                            angVelArray[0].GetFloat(),
+                            angVelArray[1].GetFloat(),
+                            angVelArray[2].GetFloat()
+                        );
                     }
-                    else if (componentType == "MeshRendererComponent") {
-                        auto& mesh = entity.AddComponent<MeshRendererComponent>();
-                        if (properties.HasMember("Visible")) mesh.Visible = properties["Visible"].GetBool();
-                        if (properties.HasMember("MeshType")) mesh.MeshType = properties["MeshType"].GetUint();
-                        if (properties.HasMember("Material")) mesh.Material = properties["Material"].GetUint();
-                        if (properties.HasMember("Texture")) mesh.Texture = properties["Texture"].GetUint();
+
+                    if (properties.HasMember("LinearDamping")) rb.LinearDamping = properties["LinearDamping"].GetFloat();
+                    if (properties.HasMember("AngularDamping")) rb.AngularDamping = properties["AngularDamping"].GetFloat();
+                    if (properties.HasMember("Restitution")) rb.Restitution = properties["Restitution"].GetFloat();
+                    if (properties.HasMember("Friction")) rb.Friction = properties["Friction"].GetFloat();
+                    if (properties.HasMember("MotionQuality")) rb.MotionQuality = static_cast<RigidbodyMotionQuality>(properties["MotionQuality"].GetInt());
+                    if (properties.HasMember("AllowSleeping")) rb.AllowSleeping = properties["AllowSleeping"].GetBool();
+                    if (properties.HasMember("CompoundChildren")) rb.CompoundChildren = properties["CompoundChildren"].GetBool();
+                }
+                else if (componentType == "CharacterControllerComponent") {
+                    auto& cc = entity.AddComponent<CharacterControllerComponent>();
+                    if (properties.HasMember("Height")) cc.Height = properties["Height"].GetFloat();
+                    if (properties.HasMember("Radius")) cc.Radius = properties["Radius"].GetFloat();
+                    if (properties.HasMember("MaxSlopeAngle")) cc.MaxSlopeAngle = properties["MaxSlopeAngle"].GetFloat();
+                    if (properties.HasMember("StepHeight")) cc.StepHeight = properties["StepHeight"].GetFloat();
+                    if (properties.HasMember("StickToFloorDistance")) cc.StickToFloorDistance = properties["StickToFloorDistance"].GetFloat();
+                    if (properties.HasMember("Mass")) cc.Mass = properties["Mass"].GetFloat();
+                    if (properties.HasMember("MaxStrength")) cc.MaxStrength = properties["MaxStrength"].GetFloat();
+                    if (properties.HasMember("UseGravity")) cc.UseGravity = properties["UseGravity"].GetBool();
+                    if (properties.HasMember("JumpSpeed")) cc.JumpSpeed = properties["JumpSpeed"].GetFloat();
+                }
+                else if (componentType == "TriggerComponent") {
+                    auto& trigger = entity.AddComponent<TriggerComponent>();
+                    if (properties.HasMember("Shape")) trigger.Shape = static_cast<TriggerShape>(properties["Shape"].GetInt());
+                    if (properties.HasMember("HalfExtents")) {
+                        const Value& extArray = properties["HalfExtents"];
+                        trigger.HalfExtents = glm::vec3(
+                            extArray[0].GetFloat(),
+                            extArray[1].GetFloat(),
+                            extArray[2].GetFloat()
+                        );
+                    }
+                    if (properties.HasMember("Radius")) trigger.Radius = properties["Radius"].GetFloat();
+                    if (properties.HasMember("Enabled")) trigger.Enabled = properties["Enabled"].GetBool();
+                }
+                else if (componentType == "JointComponent") {
+                    // Filled in a copy: a joint to another entity is only added by ResolveReferences
+                    JointComponent joint = entity.HasComponent<JointComponent>() ? entity.GetComponent<JointComponent>() : JointComponent();
+                    if (properties.HasMember("Type")) joint.Type = static_cast<JointType>(properties["Type"].GetInt());
+                    if (properties.HasMember("Anchor")) {
+                        const Value& anchorArray = properties["Anchor"];
+                        joint.Anchor = glm::vec3(
+                            anchorArray[0].GetFloat(),
+                            anchorArray[1].GetFloat(),
+                            anchorArray[2].GetFloat()
+                        );
                     }
-                    else if (componentType == "RigidbodyComponent") {
-                        auto& rb = entity.AddComponent<RigidbodyComponent>();
-                        if (properties.HasMember("Mass")) rb.Mass = properties["Mass"].GetFloat();
-                        if (properties.HasMember("IsKinematic")) rb.IsKinematic = properties["IsKinematic"].GetBool();
-                        if (properties.HasMember("UseGravity")) rb.UseGravity = properties["UseGravity"].GetBool();
-
-                        if (properties.HasMember("Velocity")) {
-                            const Value& velArray = properties["Velocity"];
-                            rb.Velocity = glm::vec3(
-                                velArray[0].GetFloat(),
-                                velArray[1].GetFloat(),
-                                velArray[2].GetFloat()
-                            );
+                    if (properties.HasMember("ConnectedAnchor")) {
+                        const Value& connectedAnchorArray = properties["ConnectedAnchor"];
+                        joint.ConnectedAnchor = glm::vec3(
+                            connectedAnchorArray[0].GetFloat(),
+                            connectedAnchorArray[1].GetFloat(),
+                            connectedAnchorArray[2].GetFloat()
+                        );
+                    }
+                    if (properties.HasMember("Axis")) {
+                        const Value& axisArray = properties["Axis"];
+                        joint.Axis = glm::vec3(
+                            axisArray[0].GetFloat(),
+                            axisArray[1].GetFloat(),
+                            axisArray[2].GetFloat()
+                        );
+                    }
+                    if (properties.HasMember("UseLimits")) joint.UseLimits = properties["UseLimits"].GetBool();
+                    if (properties.HasMember("MinLimit")) joint.MinLimit = properties["MinLimit"].GetFloat();
+                    if (properties.HasMember("MaxLimit")) joint.MaxLimit = properties["MaxLimit"].GetFloat();
+                    if (properties.HasMember("ConeAngle")) joint.ConeAngle = properties["ConeAngle"].GetFloat();
+                    if (properties.HasMember("BreakForce")) joint.BreakForce = properties["BreakForce"].GetFloat();
+                    if (properties.HasMember("BreakTorque")) joint.BreakTorque = properties["BreakTorque"].GetFloat();
+
+                    if (properties.HasMember("ConnectedEntity")) {
+                        // A prefab's joint would act before the saved one is resolved
+                        if (entity.HasComponent<JointComponent>()) {
+                            entity.RemoveComponent<JointComponent>();
                         }
+                        remap.PendingJoints.push_back({ static_cast<entt::entity>(entity), properties["ConnectedEntity"].GetUint(), joint });
                     }
-                    else if (componentType == "AudioComponent") {
+                    else {
+                        entity.AddComponent<JointComponent>() = joint;
+                    }
+                }
+                else if (componentType == "AnimatorComponent") {
+                    auto& animator = entity.AddComponent<AnimatorComponent>();
+                    if (properties.HasMember("Clip")) animator.Clip = properties["Clip"].GetInt();
+                    if (properties.HasMember("BlendClip")) animator.BlendClip = properties["BlendClip"].GetInt();
+                    if (properties.HasMember("BlendWeight")) animator.BlendWeight = properties["BlendWeight"].GetFloat();
+                    if (properties.HasMember("Speed")) animator.Speed = properties["Speed"].GetFloat();
+                    if (properties.HasMember("Time")) animator.Time = properties["Time"].GetFloat();
+                    if (properties.HasMember("BlendTime")) animator.BlendTime = properties["BlendTime"].GetFloat();
+                    if (properties.HasMember("Loop")) animator.Loop = properties["Loop"].GetBool();
+                    if (properties.HasMember("Playing")) animator.Playing = properties["Playing"].GetBool();
+                    if (properties.HasMember("CpuSkinning")) animator.CpuSkinning = properties["CpuSkinning"].GetBool();
+                }
+                else if (componentType == "ParticleEmitterComponent") {
+                    auto& emitter = entity.AddComponent<ParticleEmitterComponent>();
+                    if (properties.HasMember("Emitting")) emitter.Emitting = properties["Emitting"].GetBool();
+                    if (properties.HasMember("Rate")) emitter.Rate = properties["Rate"].GetFloat();
+                    if (properties.HasMember("Burst")) emitter.Burst = properties["Burst"].GetUint();
+                    if (properties.HasMember("MaxParticles")) emitter.MaxParticles = properties["MaxParticles"].GetUint();
+                    if (properties.HasMember("LifetimeMin")) emitter.LifetimeMin = properties["LifetimeMin"].GetFloat();
+                    if (properties.HasMember("LifetimeMax")) emitter.LifetimeMax = properties["LifetimeMax"].GetFloat();
+                    if (properties.HasMember("SpawnRadius")) emitter.SpawnRadius = properties["SpawnRadius"].GetFloat();
+                    if (properties.HasMember("Velocity")) {
+                        const Value& velocityArray = properties["Velocity"];
+                        emitter.Velocity = glm::vec3(
+                            velocityArray[0].GetFloat(),
+                            velocityArray[1].GetFloat(),
+                            velocityArray[2].GetFloat()
+                        );
+                    }
+                    if (properties.HasMember("Spread")) emitter.Spread = properties["Spread"].GetFloat();
+                    if (properties.HasMember("Gravity")) {
+                        const Value& gravityArray = properties["Gravity"];
+                        emitter.Gravity = glm::vec3(
+                            gravityArray[0].GetFloat(),
+                            gravityArray[1].GetFloat(),
+                            gravityArray[2].GetFloat()
+                        );
+                    }
+                    if (properties.HasMember("Drag")) emitter.Drag = properties["Drag"].GetFloat();
+                    if (properties.HasMember("Collide")) emitter.Collide = properties["Collide"].GetBool();
+                    if (properties.HasMember("CollisionNormal")) {
+                        const Value& collisionNormalArray = properties["CollisionNormal"];
+                        emitter.CollisionNormal = glm::vec3(
+                            collisionNormalArray[0].GetFloat(),
+                            collisionNormalArray[1].GetFloat(),
+                            collisionNormalArray[2].GetFloat()
+                        );
+                    }
+                    if (properties.HasMember("CollisionOffset")) emitter.CollisionOffset = properties["CollisionOffset"].GetFloat();
+                    if (properties.HasMember("Restitution")) emitter.Restitution = properties["Restitution"].GetFloat();
+                    if (properties.HasMember("StartColor")) {
+                        const Value& startColorArray = properties["StartColor"];
+                        emitter.StartColor = glm::vec4(
+                            startColorArray[0].GetFloat(),
+                            startColorArray[1].GetFloat(),
+                            startColorArray[2].GetFloat(),
+                            startColorArray[3].GetFloat()
+                        );
+                    }
+                    if (properties.HasMember("EndColor")) {
+                        const Value& endColorArray = properties["EndColor"];
+                        emitter.EndColor = glm::vec4(
+                            endColorArray[0].GetFloat(),
+                            endColorArray[1].GetFloat(),
+                            endColorArray[2].GetFloat(),
+                            endColorArray[3].GetFloat()
+                        );
+                    }
+                    if (properties.HasMember("StartSize")) emitter.StartSize = properties["StartSize"].GetFloat();
+                    if (properties.HasMember("EndSize")) emitter.EndSize = properties["EndSize"].GetFloat();
+                    if (properties.HasMember("Additive")) emitter.Additive = properties["Additive"].GetBool();
+                    if (properties.HasMember("SortByDepth")) emitter.SortByDepth = properties["SortByDepth"].GetBool();
+                }
+                else if (componentType == "AudioComponent") {
 						auto& audio = entity.AddComponent<AudioComponent>();
 
-                        if(properties.HasMember("FilePath"))
+                    if(properties.HasMember("FilePath"))
 							audio.AudioFilePath = properties["FilePath"].GetString();
 						if (properties.HasMember("Type"))
 							audio.Type = static_cast<AudioType>(properties["Type"].GetInt());
@@ -470,40 +948,61 @@ namespace Engine {
 							audio.MinDistance = properties["MinDistance"].GetFloat();
 						if (properties.HasMember("MaxDistance"))
 							audio.MaxDistance = properties["MaxDistance"].GetFloat();
-                    }
-                    else if (componentType == "ListenerComponent") {
-                        auto& listener = entity.AddComponent<ListenerComponent>();
-
-                        if (properties.HasMember("Active"))
-                            listener.Active = properties["Active"].GetBool();
-                    }
-                    else if (componentType == "ReverbComponent") {
-                        auto& reverb = entity.AddComponent<ReverbZoneComponent>();
-
-                        if (properties.HasMember("Preset"))
-                            reverb.Preset = static_cast<ReverbPreset>(properties["Preset"].GetInt());
-                        if (properties.HasMember("MinDistance"))
-                            reverb.MinDistance = properties["MinDistance"].GetFloat();
-                        if (properties.HasMember("MaxDistance"))
-                            reverb.MaxDistance = properties["MaxDistance"].GetFloat();
-                        if (properties.HasMember("DecayTime"))
-                            reverb.DecayTime = properties["DecayTime"].GetFloat();
-                        if (properties.HasMember("HfDecayRatio"))
-                            reverb.HfDecayRatio = properties["HfDecayRatio"].GetFloat();
-                        if (properties.HasMember("Diffusion"))
-                            reverb.Diffusion = properties["Diffusion"].GetFloat();
-                        if (properties.HasMember("Density"))
-                            reverb.Density = properties["Density"].GetFloat();
-                        if (properties.HasMember("WetLevel"))
-                            reverb.WetLevel = properties["WetLevel"].GetFloat();
-                            }
+                }
+                else if (componentType == "ListenerComponent") {
+                    auto& listener = entity.AddComponent<ListenerComponent>();
 
+                    if (properties.HasMember("Active"))
+                        listener.Active = properties["Active"].GetBool();
                 }
+                else if (componentType == "ReverbComponent") {
+                    auto& reverb = entity.AddComponent<ReverbZoneComponent>();
+
+                    if (properties.HasMember("Preset"))
+                        reverb.Preset = static_cast<ReverbPreset>(properties["Preset"].GetInt());
+                    if (properties.HasMember("MinDistance"))
+                        reverb.MinDistance = properties["MinDistance"].GetFloat();
+                    if (properties.HasMember("MaxDistance"))
+                        reverb.MaxDistance = properties["MaxDistance"].GetFloat();
+                    if (properties.HasMember("DecayTime"))
+                        reverb.DecayTime = properties["DecayTime"].GetFloat();
+                    if (properties.HasMember("HfDecayRatio"))
+                        reverb.HfDecayRatio = properties["HfDecayRatio"].GetFloat();
+                    if (properties.HasMember("Diffusion"))
+                        reverb.Diffusion = properties["Diffusion"].GetFloat();
+                    if (properties.HasMember("Density"))
+                        reverb.Density = properties["Density"].GetFloat();
+                    if (properties.HasMember("WetLevel"))
+                        reverb.WetLevel = properties["WetLevel"].GetFloat();
+                        }
+
             }
         }
 
-        LOG_INFO("Scene deserialized successfully");
-        return true;
+        return entity;
+    }
+
+    void SceneSerializer::ResolveReferences(EntityRemap& remap) {
+        auto& registry = m_Scene->GetRegistry();
+
+        for (EntityRemap::PendingJoint& pending : remap.PendingJoints) {
+            if (!registry.valid(pending.Owner)) {
+                continue;
+            }
+
+            auto it = remap.LoadedById.find(pending.SavedTarget);
+            if (it != remap.LoadedById.end() && registry.valid(it->second)) {
+                pending.Joint.ConnectedEntity = it->second;
+            }
+            else {
+                LOG_WARNING("Joint on entity ", static_cast<uint32_t>(pending.Owner), " references entity ",
+                    pending.SavedTarget, " that was not loaded with it, attaching it to the world");
+                pending.Joint.ConnectedEntity = entt::null;
+            }
+            registry.emplace_or_replace<JointComponent>(pending.Owner, pending.Joint);
+        }
+
+        remap.Clear();
     }
 
 } // namespace Engine
\ No newline at end of file
@@ -1,12 +1,43 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <memory>
+#include <unordered_map>
+#include <vector>
+#include <rapidjson/fwd.h>
+
+#include "../ECS/Entity.h"
+#include "../Component/JointComponent.h"
 
 namespace Engine {
 
     // Forward declarations
     class Scene;
 
+    /**
+     * @brief Saved entity IDs of one batch of loaded entities (a scene file or a world cell)
+     * @details References between entities are saved as the referenced entity's "ID".
+     *          While a batch loads, DeserializeEntity records each entity under its saved
+     *          ID and holds back joints that reference another entity. ResolveReferences
+     *          then adds them pointing at the loaded entity, so no system ever sees a
+     *          saved ID that happens to match an unrelated live entity.
+     */
+    struct EntityRemap {
+        struct PendingJoint {
+            entt::entity Owner = entt::null;
+            uint32_t SavedTarget = 0;       ///< "ID" of the connected entity in the file
+            JointComponent Joint;
+        };
+
+        std::unordered_map<uint32_t, entt::entity> LoadedById;
+        std::vector<PendingJoint> PendingJoints;
+
+        void Clear() {
+            LoadedById.clear();
+            PendingJoints.clear();
+        }
+    };
+
     /**
      * @brief Serializes/Deserializes scenes to/from JSON
      */
@@ -41,6 +72,25 @@ namespace Engine {
          */
         bool DeserializeFromString(const std::string& jsonString);
 
+        /**
+         * @brief Create a single entity from one element of a scene's "Entities" array
+         * @param entityObj Entity JSON object (world partition cells use the same layout)
+         * @param hasPrefabOverrides Set when the entity is a prefab instance whose decoded
+         *        overrides still have to be applied
+         * @param remap Batch the entity belongs to; call ResolveReferences once every
+         *        entity of the batch exists
+         * @return The created entity
+         */
+        Entity DeserializeEntity(const rapidjson::Value& entityObj, bool& hasPrefabOverrides, EntityRemap& remap);
+
+        /**
+         * @brief Point the held-back references of a batch at its loaded entities
+         * @details Joints whose connected entity was not part of the batch are attached to
+         *          the world with a warning. Entities destroyed meanwhile are skipped. The
+         *          batch is cleared afterwards.
+         */
+        void ResolveReferences(EntityRemap& remap);
+
     private:
         Scene* m_Scene;
     };
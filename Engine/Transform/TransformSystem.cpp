@@ -14,10 +14,10 @@ namespace Engine {
 
 	void TransformSystem::OnUpdate(Scene* scene, Timestep ts) {
 
-		auto view = scene->GetRegistry().view<TransformComponent>();
+		auto view = scene->GetRegistry().view<TransformComponent>(entt::exclude<InactiveComponent>);
 
 		std::vector<entt::entity> roots;
-		roots.reserve(view.size());
+		roots.reserve(view.size_hint());
 
 		for (auto entity : view) {
 
@@ -29,11 +29,27 @@ namespace Engine {
 			}
 		}
 
+		auto& registry = scene->GetRegistry();
+
 		// Iterate through all the roots
 		for (auto root : roots) {
 			auto& transform = view.get<TransformComponent>(root);
 
-			if (transform.IsDirty) {
+			// Roots in a low tick-rate bucket are drawn between their last two simulated poses
+			const auto* lod = registry.try_get<SimulationLODComponent>(root);
+			if (lod && lod->Interpolate && lod->HasPoses && lod->Interval > 1 &&
+				(lod->PrevPosition != lod->LastPosition || lod->PrevRotation != lod->LastRotation || lod->PrevScale != lod->LastScale)) {
+
+				glm::mat4 translation_matrix = glm::translate(glm::mat4(1.0f), glm::mix(lod->PrevPosition, lod->LastPosition, lod->Alpha));
+				glm::mat4 rotation_matrix = glm::toMat4(glm::slerp(lod->PrevRotation, lod->LastRotation, lod->Alpha));
+				glm::mat4 scale_matrix = glm::scale(glm::mat4(1.0f), glm::mix(lod->PrevScale, lod->LastScale, lod->Alpha));
+
+				transform.WorldTransform = transform.LocalTransform = translation_matrix * rotation_matrix * scale_matrix;
+
+				// Recompute from the live pose once the entity is back at full rate
+				transform.IsDirty = true;
+			}
+			else if (transform.IsDirty) {
 
 				// Compute transformation for roots -> since roots have no parents, local transform == world transform
 				glm::mat4 translation_matrix = glm::translate(glm::mat4(1.0f), transform.Position);
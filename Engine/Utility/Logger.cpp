@@ -1,7 +1,12 @@
 #include "Logger.h"
+#include "Core/CVar.h"
 
 namespace Engine {
 
+    static CVar<int> s_LogFlushLevel("log.FlushLevel", static_cast<int>(LogLevel::Trace),
+        static_cast<int>(LogLevel::Trace), static_cast<int>(LogLevel::Critical),
+        "Flush the log file after messages of this level and above (0 Trace .. 5 Critical)");
+
     void Logger::SetLogLevel(LogLevel level) {
         m_MinLevel = level;
     }
@@ -18,6 +23,10 @@ namespace Engine {
         }
     }
 
+    bool Logger::ShouldFlush(LogLevel level) {
+        return static_cast<int>(level) >= s_LogFlushLevel.Get();
+    }
+
     const char* Logger::GetLevelString(LogLevel level) {
         switch (level) {
         case LogLevel::Trace:    return "TRACE";
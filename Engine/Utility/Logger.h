@@ -45,8 +45,10 @@ namespace Engine {
             std::cout << message << std::endl;
 
             if (m_FileLoggingEnabled && m_FileStream.is_open()) {
-                m_FileStream << message << std::endl;
-                m_FileStream.flush();
+                m_FileStream << message << '\n';
+                if (ShouldFlush(level)) {
+                    m_FileStream.flush();
+                }
             }
         }
 
@@ -79,6 +81,9 @@ namespace Engine {
 
         const char* GetLevelString(LogLevel level);
 
+        // Messages at or above the log.FlushLevel CVar reach the file immediately
+        static bool ShouldFlush(LogLevel level);
+
         LogLevel m_MinLevel = LogLevel::Info;
         std::ofstream m_FileStream;
         bool m_FileLoggingEnabled = false;
@@ -18,6 +18,7 @@ namespace Engine {
     // Static random engine
     static std::mt19937 randomEngine;
     static bool hasBeenSeeded = false;
+    static MathUtils::SeedFilter seedFilter;
 
     // Angle conversion
     float MathUtils::toRadians(float degrees) {
@@ -63,8 +64,16 @@ namespace Engine {
         return std::abs(a - b) < epsilon;
     }
 
+    // Route seeds through a recorder/replayer
+    void MathUtils::setSeedFilter(SeedFilter filter) {
+        seedFilter = std::move(filter);
+    }
+
     // Seed the random number generator
     void MathUtils::seedRandom(unsigned int seed) {
+        if (seedFilter) {
+            seed = seedFilter(seed);
+        }
         randomEngine.seed(seed);
         hasBeenSeeded = true;
     }
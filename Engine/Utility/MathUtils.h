@@ -15,6 +15,7 @@
 
 #include <cmath>
 #include <algorithm> // For min, max, clamp
+#include <functional>
 
 namespace Engine {
 
@@ -42,6 +43,8 @@ namespace Engine {
         static bool approximatelyEqual(float a, float b, float epsilon = EPSILON);
 
         // Random number functions
+        using SeedFilter = std::function<unsigned int(unsigned int)>;
+        static void setSeedFilter(SeedFilter filter);          // Sees/replaces every seed (input recording/replay)
         static void seedRandom(unsigned int seed);
         static float random();                                  // Random [0.0, 1.0)
         static float random(float min, float max);              // Random [min, max)
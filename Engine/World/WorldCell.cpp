@@ -0,0 +1,126 @@
+/**
+ * @file WorldCell.cpp
+ * @brief Reading and writing the partitioned world manifest
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "WorldCell.h"
+#include "../Utility/Logger.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <fstream>
+#include <iterator>
+
+namespace Engine {
+
+    namespace {
+        void WriteVec3(rapidjson::Value& obj, const char* name, const glm::vec3& v, rapidjson::Document::AllocatorType& allocator) {
+            rapidjson::Value arr(rapidjson::kArrayType);
+            arr.PushBack(v.x, allocator).PushBack(v.y, allocator).PushBack(v.z, allocator);
+            obj.AddMember(rapidjson::StringRef(name), arr, allocator);
+        }
+
+        glm::vec3 ReadVec3(const rapidjson::Value& obj, const char* name) {
+            if (!obj.HasMember(name) || !obj[name].IsArray() || obj[name].Size() != 3) {
+                return glm::vec3(0.0f);
+            }
+            const auto& arr = obj[name];
+            return glm::vec3(arr[0].GetFloat(), arr[1].GetFloat(), arr[2].GetFloat());
+        }
+    }
+
+    bool WorldManifest::Save(const std::string& filepath) const {
+        using namespace rapidjson;
+
+        Document doc;
+        doc.SetObject();
+        auto& allocator = doc.GetAllocator();
+
+        doc.AddMember("World", Value(Name.c_str(), allocator), allocator);
+        doc.AddMember("Version", 1, allocator);
+        doc.AddMember("CellSize", CellSize, allocator);
+        doc.AddMember("Persistent", Value(PersistentFile.c_str(), allocator), allocator);
+
+        Value cells(kArrayType);
+        for (const auto& cell : Cells) {
+            Value cellObj(kObjectType);
+            cellObj.AddMember("X", cell.Coord.X, allocator);
+            cellObj.AddMember("Z", cell.Coord.Z, allocator);
+            cellObj.AddMember("File", Value(cell.File.c_str(), allocator), allocator);
+            cellObj.AddMember("EntityCount", cell.EntityCount, allocator);
+            WriteVec3(cellObj, "BoundsMin", cell.BoundsMin, allocator);
+            WriteVec3(cellObj, "BoundsMax", cell.BoundsMax, allocator);
+            cells.PushBack(cellObj, allocator);
+        }
+        doc.AddMember("Cells", cells, allocator);
+
+        StringBuffer buffer;
+        PrettyWriter<StringBuffer> writer(buffer);
+        doc.Accept(writer);
+
+        std::ofstream file(filepath);
+        if (!file.is_open()) {
+            LOG_ERROR("WorldManifest: Failed to open file for writing: ", filepath);
+            return false;
+        }
+        file << buffer.GetString();
+        return true;
+    }
+
+    bool WorldManifest::Load(const std::string& filepath) {
+        using namespace rapidjson;
+
+        std::ifstream file(filepath);
+        if (!file.is_open()) {
+            return false;
+        }
+        std::string json((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        Document doc;
+        doc.Parse(json.c_str());
+        if (doc.HasParseError() || !doc.IsObject()) {
+            LOG_ERROR("WorldManifest: JSON parse error in ", filepath, " at offset ", doc.GetErrorOffset());
+            return false;
+        }
+
+        if (!doc.HasMember("CellSize") || !doc["CellSize"].IsNumber() || doc["CellSize"].GetFloat() <= 0.0f) {
+            LOG_ERROR("WorldManifest: Missing or invalid CellSize in ", filepath);
+            return false;
+        }
+
+        Name = doc.HasMember("World") && doc["World"].IsString() ? doc["World"].GetString() : "World";
+        CellSize = doc["CellSize"].GetFloat();
+        PersistentFile = doc.HasMember("Persistent") && doc["Persistent"].IsString() ? doc["Persistent"].GetString() : "";
+
+        Cells.clear();
+        if (doc.HasMember("Cells") && doc["Cells"].IsArray()) {
+            const auto& cells = doc["Cells"];
+            Cells.reserve(cells.Size());
+            for (SizeType i = 0; i < cells.Size(); ++i) {
+                const auto& cellObj = cells[i];
+                if (!cellObj.HasMember("X") || !cellObj.HasMember("Z") || !cellObj.HasMember("File")) {
+                    LOG_WARNING("WorldManifest: Skipping malformed cell ", i);
+                    continue;
+                }
+
+                WorldCellInfo cell;
+                cell.Coord = CellCoord{ cellObj["X"].GetInt(), cellObj["Z"].GetInt() };
+                cell.File = cellObj["File"].GetString();
+                cell.EntityCount = cellObj.HasMember("EntityCount") ? cellObj["EntityCount"].GetUint() : 0;
+                cell.BoundsMin = ReadVec3(cellObj, "BoundsMin");
+                cell.BoundsMax = ReadVec3(cellObj, "BoundsMax");
+                Cells.push_back(std::move(cell));
+            }
+        }
+
+        return true;
+    }
+
+} // namespace Engine
@@ -0,0 +1,94 @@
+/**
+ * @file WorldCell.h
+ * @brief Cell addressing and the manifest of a partitioned world
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+#ifndef __WORLD_CELL_H__
+#define __WORLD_CELL_H__
+
+#include <cstdint>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace Engine {
+
+    /**
+     * @brief Integer coordinate of a cell on the XZ grid
+     */
+    struct CellCoord {
+        int32_t X = 0;
+        int32_t Z = 0;
+
+        bool operator==(const CellCoord& other) const { return X == other.X && Z == other.Z; }
+
+        /**
+         * @brief Cell containing a world position
+         */
+        static CellCoord FromPosition(const glm::vec3& position, float cellSize) {
+            return CellCoord{
+                static_cast<int32_t>(std::floor(position.x / cellSize)),
+                static_cast<int32_t>(std::floor(position.z / cellSize))
+            };
+        }
+    };
+
+    struct CellCoordHash {
+        size_t operator()(const CellCoord& coord) const {
+            return std::hash<uint64_t>{}((static_cast<uint64_t>(static_cast<uint32_t>(coord.X)) << 32) |
+                                          static_cast<uint32_t>(coord.Z));
+        }
+    };
+
+    /**
+     * @brief One independently loadable chunk of the world
+     */
+    struct WorldCellInfo {
+        CellCoord Coord;
+        std::string File;               ///< Chunk file, relative to the world directory
+        uint32_t EntityCount = 0;
+        glm::vec3 BoundsMin = glm::vec3(0.0f);  ///< Bounds of the entity positions in the cell
+        glm::vec3 BoundsMax = glm::vec3(0.0f);
+
+        /**
+         * @brief Horizontal distance from a point to the cell's footprint (0 inside)
+         */
+        float DistanceXZ(const glm::vec3& point, float cellSize) const {
+            const glm::vec2 min(Coord.X * cellSize, Coord.Z * cellSize);
+            const glm::vec2 max = min + glm::vec2(cellSize);
+            const glm::vec2 p(point.x, point.z);
+            const glm::vec2 d = glm::max(glm::max(min - p, p - max), glm::vec2(0.0f));
+            return glm::length(d);
+        }
+    };
+
+    /**
+     * @brief Index of a partitioned world ("world.json")
+     * @details The persistent chunk holds everything without a position (cameras,
+     *          listeners, global entities) plus pool prewarm data and is always loaded.
+     */
+    struct WorldManifest {
+        static constexpr const char* FILE_NAME = "world.json";
+
+        std::string Name;
+        float CellSize = 64.0f;
+        std::string PersistentFile;
+        std::vector<WorldCellInfo> Cells;
+
+        bool Save(const std::string& filepath) const;
+        bool Load(const std::string& filepath);
+    };
+
+} // namespace Engine
+
+#endif // __WORLD_CELL_H__
@@ -0,0 +1,258 @@
+/**
+ * @file WorldPartitionBuilder.cpp
+ * @brief Build step that splits a scene into spatial cells for streaming
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "WorldPartitionBuilder.h"
+#include "../ECS/Scene.h"
+#include "../Component/TransformComponent.h"
+#include "../Component/CameraComponent.h"
+#include "../Component/ListenerComponent.h"
+#include "../Component/JointComponent.h"
+#include "../Serialization/SceneSerializer.h"
+#include "../Utility/Logger.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+    namespace {
+        struct CellChunk {
+            rapidjson::Document Doc;
+            WorldCellInfo Info;
+        };
+
+        void BeginChunk(rapidjson::Document& doc, const std::string& name) {
+            doc.SetObject();
+            auto& allocator = doc.GetAllocator();
+            doc.AddMember("Scene", rapidjson::Value(name.c_str(), allocator), allocator);
+            doc.AddMember("Version", "1.0", allocator);
+            doc.AddMember("Entities", rapidjson::Value(rapidjson::kArrayType), allocator);
+        }
+
+        bool WriteChunk(const rapidjson::Document& doc, const std::filesystem::path& path) {
+            rapidjson::StringBuffer buffer;
+            rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+            doc.Accept(writer);
+
+            std::ofstream file(path);
+            if (!file.is_open()) {
+                LOG_ERROR("WorldPartitionBuilder: Failed to write ", path.string());
+                return false;
+            }
+            file << buffer.GetString();
+            return true;
+        }
+
+        // Children stay in their root's cell so hierarchies stream as a unit
+        entt::entity FindRoot(entt::registry& registry, entt::entity entity) {
+            size_t guard = 0;
+            while (guard++ < 1024) {
+                const auto* transform = registry.try_get<TransformComponent>(entity);
+                if (!transform || transform->Parent == entt::null || !registry.valid(transform->Parent)) {
+                    break;
+                }
+                entity = transform->Parent;
+            }
+            return entity;
+        }
+
+        // Where one source entity goes before joints are taken into account
+        struct Placement {
+            entt::entity Root = entt::null;
+            bool Global = true;
+            glm::vec3 Position{ 0.0f };
+        };
+
+        // Hierarchy roots linked by joints, so both ends of a joint stream as a unit
+        class JointGroups {
+        public:
+            entt::entity Find(entt::entity root) {
+                auto it = m_Parent.find(root);
+                while (it != m_Parent.end() && it->second != root) {
+                    root = it->second;
+                    it = m_Parent.find(root);
+                }
+                return root;
+            }
+
+            void Join(entt::entity a, entt::entity b) {
+                a = Find(a);
+                b = Find(b);
+                if (a != b) {
+                    m_Parent[a] = b;
+                    m_Parent.try_emplace(b, b);
+                }
+            }
+
+        private:
+            std::unordered_map<entt::entity, entt::entity> m_Parent;
+        };
+
+        struct GroupPlacement {
+            bool Global = false;
+            bool HasCell = false;
+            CellCoord Coord;
+        };
+    }
+
+    bool WorldPartitionBuilder::Build(Scene* scene, const std::string& outputDirectory, float cellSize,
+        WorldManifest* outManifest) {
+
+        if (!scene || cellSize <= 0.0f) {
+            LOG_ERROR("WorldPartitionBuilder: Need a scene and a positive cell size");
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::create_directories(outputDirectory, ec);
+        if (ec) {
+            LOG_ERROR("WorldPartitionBuilder: Cannot create ", outputDirectory, ": ", ec.message());
+            return false;
+        }
+
+        // Serialize through the regular path so chunks match the scene format exactly
+        SceneSerializer serializer(scene);
+        rapidjson::Document source;
+        source.Parse(serializer.SerializeToString().c_str());
+        if (source.HasParseError() || !source.HasMember("Entities")) {
+            LOG_ERROR("WorldPartitionBuilder: Could not serialize scene");
+            return false;
+        }
+
+        auto& registry = scene->GetRegistry();
+
+        rapidjson::Document persistent;
+        BeginChunk(persistent, scene->GetName());
+        if (source.HasMember("PrefabPools")) {
+            persistent.AddMember("PrefabPools", rapidjson::Value(source["PrefabPools"], persistent.GetAllocator()),
+                persistent.GetAllocator());
+        }
+
+        const auto& sourceEntities = source["Entities"].GetArray();
+        std::vector<Placement> placements;
+        placements.reserve(sourceEntities.Size());
+
+        for (const auto& entityObj : sourceEntities) {
+            const entt::entity handle = entityObj.HasMember("ID") ? static_cast<entt::entity>(entityObj["ID"].GetUint()) : entt::null;
+
+            Placement placement;
+            placement.Root = registry.valid(handle) ? FindRoot(registry, handle) : entt::null;
+
+            const auto* transform = placement.Root != entt::null ? registry.try_get<TransformComponent>(placement.Root) : nullptr;
+            placement.Global = !transform || registry.any_of<CameraComponent, ListenerComponent>(handle);
+            if (!placement.Global) {
+                placement.Position = transform->Parent == entt::null ? transform->Position : glm::vec3(transform->WorldTransform[3]);
+            }
+            placements.push_back(placement);
+        }
+
+        // A cell only resolves joints between its own entities, so both ends share a chunk:
+        // the cell of the first one in the scene, or the persistent chunk if either end is global
+        JointGroups groups;
+        registry.view<JointComponent>().each([&](entt::entity entity, const JointComponent& joint) {
+            if (joint.ConnectedEntity != entt::null && registry.valid(joint.ConnectedEntity)) {
+                groups.Join(FindRoot(registry, entity), FindRoot(registry, joint.ConnectedEntity));
+            }
+        });
+
+        std::unordered_map<entt::entity, GroupPlacement> groupPlacements;
+        for (const Placement& placement : placements) {
+            if (placement.Root == entt::null) {
+                continue;
+            }
+            GroupPlacement& group = groupPlacements[groups.Find(placement.Root)];
+            group.Global = group.Global || placement.Global;
+            if (!placement.Global && !group.HasCell) {
+                group.Coord = CellCoord::FromPosition(placement.Position, cellSize);
+                group.HasCell = true;
+            }
+        }
+
+        std::unordered_map<CellCoord, std::unique_ptr<CellChunk>, CellCoordHash> cells;
+        uint32_t persistentCount = 0;
+        uint32_t movedForJoints = 0;
+
+        for (rapidjson::SizeType i = 0; i < sourceEntities.Size(); i++) {
+            const auto& entityObj = sourceEntities[i];
+            const Placement& placement = placements[i];
+            const GroupPlacement* group = placement.Root != entt::null ? &groupPlacements[groups.Find(placement.Root)] : nullptr;
+
+            if (placement.Global || (group && group->Global)) {
+                persistent["Entities"].PushBack(rapidjson::Value(entityObj, persistent.GetAllocator()), persistent.GetAllocator());
+                persistentCount++;
+                movedForJoints += placement.Global ? 0 : 1;
+                continue;
+            }
+
+            const glm::vec3 position = placement.Position;
+            const CellCoord coord = group->Coord;
+            const CellCoord own = CellCoord::FromPosition(position, cellSize);
+            movedForJoints += own == coord ? 0 : 1;
+
+            auto& chunk = cells[coord];
+            if (!chunk) {
+                chunk = std::make_unique<CellChunk>();
+                chunk->Info.Coord = coord;
+                chunk->Info.File = "cell_" + std::to_string(coord.X) + "_" + std::to_string(coord.Z) + ".json";
+                chunk->Info.BoundsMin = glm::vec3(std::numeric_limits<float>::max());
+                chunk->Info.BoundsMax = glm::vec3(std::numeric_limits<float>::lowest());
+                BeginChunk(chunk->Doc, scene->GetName() + "/" + chunk->Info.File);
+            }
+
+            auto& allocator = chunk->Doc.GetAllocator();
+            chunk->Doc["Entities"].PushBack(rapidjson::Value(entityObj, allocator), allocator);
+            chunk->Info.EntityCount++;
+            chunk->Info.BoundsMin = glm::min(chunk->Info.BoundsMin, position);
+            chunk->Info.BoundsMax = glm::max(chunk->Info.BoundsMax, position);
+        }
+
+        const std::filesystem::path dir(outputDirectory);
+
+        WorldManifest manifest;
+        manifest.Name = scene->GetName();
+        manifest.CellSize = cellSize;
+        manifest.PersistentFile = "persistent.json";
+
+        bool ok = WriteChunk(persistent, dir / manifest.PersistentFile);
+
+        manifest.Cells.reserve(cells.size());
+        for (auto& [coord, chunk] : cells) {
+            ok = WriteChunk(chunk->Doc, dir / chunk->Info.File) && ok;
+            manifest.Cells.push_back(chunk->Info);
+        }
+
+        // Stable manifest order for diffs
+        std::sort(manifest.Cells.begin(), manifest.Cells.end(), [](const WorldCellInfo& a, const WorldCellInfo& b) {
+            return a.Coord.Z != b.Coord.Z ? a.Coord.Z < b.Coord.Z : a.Coord.X < b.Coord.X;
+        });
+
+        ok = manifest.Save((dir / WorldManifest::FILE_NAME).string()) && ok;
+
+        LOG_INFO("WorldPartitionBuilder: '", manifest.Name, "' -> ", manifest.Cells.size(), " cells of ", cellSize,
+            " units, ", persistentCount, " persistent entities, written to ", outputDirectory);
+        if (movedForJoints > 0) {
+            LOG_INFO("WorldPartitionBuilder: ", movedForJoints, " entities placed with the other end of their joint");
+        }
+
+        if (outManifest) {
+            *outManifest = std::move(manifest);
+        }
+        return ok;
+    }
+
+} // namespace Engine
@@ -0,0 +1,47 @@
+/**
+ * @file WorldPartitionBuilder.h
+ * @brief Build step that splits a scene into spatial cells for streaming
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+#ifndef __WORLD_PARTITION_BUILDER_H__
+#define __WORLD_PARTITION_BUILDER_H__
+
+#include <string>
+
+#include "WorldCell.h"
+
+namespace Engine {
+
+    class Scene;
+
+    /**
+     * @brief Writes a scene out as a manifest, a persistent chunk and one chunk per cell
+     * @details Chunks use the regular scene file layout, so each one can be read by
+     *          SceneSerializer on its own. Entities are placed by the position of their
+     *          hierarchy root; entities without a transform, cameras and listeners go
+     *          to the persistent chunk. Both ends of a joint share a chunk, since joints
+     *          are only resolved between entities loaded together.
+     */
+    class WorldPartitionBuilder {
+    public:
+        /**
+         * @brief Partition a loaded scene
+         * @param scene Source scene
+         * @param outputDirectory Directory for world.json and the chunk files (created if missing)
+         * @param cellSize Cell edge length in world units
+         * @param outManifest Optional, receives the written manifest
+         * @return True if every file was written
+         */
+        static bool Build(Scene* scene, const std::string& outputDirectory, float cellSize,
+            WorldManifest* outManifest = nullptr);
+    };
+
+} // namespace Engine
+
+#endif // __WORLD_PARTITION_BUILDER_H__
@@ -0,0 +1,384 @@
+/**
+ * @file WorldStreamer.cpp
+ * @brief Streams world-partition cells in and out around a focus point
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "WorldStreamer.h"
+#include "../ECS/Scene.h"
+#include "../ECS/Entity.h"
+#include "../Serialization/SceneSerializer.h"
+#include "../Prefab/PrefabOverrides.h"
+#include "../Utility/Logger.h"
+
+#include <rapidjson/document.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace Engine {
+
+    namespace {
+        double NowMs() {
+            using namespace std::chrono;
+            return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+        }
+    }
+
+    WorldStreamer::WorldStreamer() = default;
+
+    WorldStreamer::~WorldStreamer() {
+        Close();
+    }
+
+    bool WorldStreamer::Open(Scene* scene, const std::string& worldDirectory) {
+        Close();
+
+        if (!scene) {
+            LOG_ERROR("WorldStreamer: Cannot open a world without a scene");
+            return false;
+        }
+
+        const std::filesystem::path dir(worldDirectory);
+        if (!m_Manifest.Load((dir / WorldManifest::FILE_NAME).string())) {
+            LOG_ERROR("WorldStreamer: No world manifest in ", worldDirectory);
+            return false;
+        }
+
+        // Persistent content replaces the scene, cells are added on top
+        if (!m_Manifest.PersistentFile.empty()) {
+            SceneSerializer serializer(scene);
+            if (!serializer.Deserialize((dir / m_Manifest.PersistentFile).string())) {
+                LOG_ERROR("WorldStreamer: Failed to load persistent chunk of ", worldDirectory);
+                return false;
+            }
+        }
+
+        m_Scene = scene;
+        m_Directory = worldDirectory;
+        m_Cells.clear();
+        m_Cells.resize(m_Manifest.Cells.size());
+        m_Stats = WorldStreamingStats{};
+
+        StartWorkers();
+
+        LOG_INFO("WorldStreamer: Opened '", m_Manifest.Name, "' (", m_Manifest.Cells.size(), " cells, ",
+            m_Manifest.CellSize, " units, ", m_Workers.size(), " workers)");
+        return true;
+    }
+
+    void WorldStreamer::Close() {
+        StopWorkers();
+
+        if (m_Scene) {
+            auto& registry = m_Scene->GetRegistry();
+            for (auto& cell : m_Cells) {
+                for (entt::entity handle : cell.Entities) {
+                    if (registry.valid(handle)) {
+                        m_Scene->DestroyEntity(Entity(handle, &registry));
+                    }
+                }
+            }
+        }
+
+        m_Cells.clear();
+        m_Scene = nullptr;
+        m_Directory.clear();
+        m_Stats = WorldStreamingStats{};
+    }
+
+    void WorldStreamer::SetSettings(const WorldStreamingSettings& settings) {
+        const bool restartWorkers = m_Scene && settings.WorkerCount != m_Settings.WorkerCount;
+
+        m_Settings = settings;
+        m_Settings.LoadRadius = std::max(0.0f, m_Settings.LoadRadius);
+        m_Settings.UnloadRadius = std::max(m_Settings.LoadRadius, m_Settings.UnloadRadius);
+        m_Settings.FrameBudgetMs = std::max(0.0, m_Settings.FrameBudgetMs);
+
+        if (restartWorkers) {
+            StopWorkers();
+            StartWorkers();
+        }
+    }
+
+    WorldStreamer::CellState WorldStreamer::GetCellState(size_t cellIndex) const {
+        return cellIndex < m_Cells.size() ? m_Cells[cellIndex].State : CellState::Unloaded;
+    }
+
+    int32_t WorldStreamer::FindCellOf(entt::entity entity) const {
+        for (size_t i = 0; i < m_Cells.size(); ++i) {
+            const auto& entities = m_Cells[i].Entities;
+            if (std::find(entities.begin(), entities.end(), entity) != entities.end()) {
+                return static_cast<int32_t>(i);
+            }
+        }
+        return -1;
+    }
+
+    void WorldStreamer::Update(const glm::vec3& focus) {
+        if (!m_Scene) return;
+
+        const double start = NowMs();
+        m_Stats.EntitiesCreated = 0;
+        m_Stats.EntitiesDestroyed = 0;
+
+        CollectResults();
+
+        // Decide residency, nearest cells first so they are requested and built first
+        m_Order.resize(m_Cells.size());
+        for (size_t i = 0; i < m_Order.size(); ++i) m_Order[i] = i;
+
+        const float cellSize = m_Manifest.CellSize;
+        std::sort(m_Order.begin(), m_Order.end(), [&](size_t a, size_t b) {
+            return m_Manifest.Cells[a].DistanceXZ(focus, cellSize) < m_Manifest.Cells[b].DistanceXZ(focus, cellSize);
+        });
+
+        for (size_t index : m_Order) {
+            Cell& cell = m_Cells[index];
+            const float distance = m_Manifest.Cells[index].DistanceXZ(focus, cellSize);
+
+            if (distance <= m_Settings.LoadRadius) {
+                if (cell.State == CellState::Unloaded) {
+                    Request(index);
+                }
+            }
+            else if (distance > m_Settings.UnloadRadius) {
+                switch (cell.State) {
+                case CellState::Queued:
+                case CellState::Parsed:
+                    // Nothing in the registry yet; a late worker result is ignored by generation
+                    cell.Generation++;
+                    cell.Doc.reset();
+                    cell.State = CellState::Unloaded;
+                    break;
+                case CellState::Instantiating:
+                case CellState::Loaded:
+                    cell.Doc.reset();
+                    cell.Remap.Clear();
+                    cell.State = CellState::Unloading;
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+
+        // Time-sliced registry work: unloads first to free memory, then nearest loads
+        const double deadline = start + m_Settings.FrameBudgetMs;
+        uint32_t guaranteed = m_Settings.MinEntitiesPerFrame;
+
+        for (size_t index : m_Order) {
+            if (m_Cells[index].State == CellState::Unloading) {
+                StepUnload(index, deadline, guaranteed);
+            }
+        }
+        for (size_t index : m_Order) {
+            const CellState state = m_Cells[index].State;
+            if (state == CellState::Parsed || state == CellState::Instantiating) {
+                StepInstantiate(index, deadline, guaranteed);
+            }
+        }
+
+        RefreshCounts();
+        m_Stats.LastUpdateMs = NowMs() - start;
+    }
+
+    void WorldStreamer::Flush(const glm::vec3& focus) {
+        if (!m_Scene) return;
+
+        do {
+            Update(focus);
+            if (m_Stats.PendingCells > 0 && m_Stats.EntitiesCreated == 0 && m_Stats.EntitiesDestroyed == 0) {
+                // Waiting on workers
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        } while (m_Stats.PendingCells > 0);
+    }
+
+    void WorldStreamer::Request(size_t cellIndex) {
+        Cell& cell = m_Cells[cellIndex];
+        cell.Generation++;
+        cell.State = CellState::Queued;
+        cell.Remap.Clear();
+
+        const std::string path = (std::filesystem::path(m_Directory) / m_Manifest.Cells[cellIndex].File).string();
+
+        if (m_Workers.empty()) {
+            cell.Doc = ReadChunk(path);
+            cell.NextEntity = 0;
+            cell.State = cell.Doc ? CellState::Parsed : CellState::Loaded;  // Failed cells retry after leaving range
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Requests.push_back(ParseRequest{ cellIndex, cell.Generation, path });
+        }
+        m_WorkAvailable.notify_one();
+    }
+
+    void WorldStreamer::CollectResults() {
+        std::vector<ParseResult> results;
+        {
+            std::lock_guard lock(m_Mutex);
+            results.swap(m_Results);
+        }
+
+        for (auto& result : results) {
+            Cell& cell = m_Cells[result.CellIndex];
+            if (cell.State != CellState::Queued || cell.Generation != result.Generation) {
+                continue;   // Cancelled while parsing
+            }
+
+            cell.Doc = std::move(result.Doc);
+            cell.NextEntity = 0;
+            cell.State = cell.Doc ? CellState::Parsed : CellState::Loaded;
+        }
+    }
+
+    void WorldStreamer::StepInstantiate(size_t cellIndex, double deadlineMs, uint32_t& guaranteed) {
+        Cell& cell = m_Cells[cellIndex];
+        cell.State = CellState::Instantiating;
+
+        const auto& entities = (*cell.Doc)["Entities"];
+        SceneSerializer serializer(m_Scene);
+
+        while (cell.NextEntity < entities.Size()) {
+            if (guaranteed == 0 && NowMs() >= deadlineMs) {
+                return;
+            }
+
+            bool hasOverrides = false;
+            Entity entity = serializer.DeserializeEntity(entities[cell.NextEntity++], hasOverrides, cell.Remap);
+            if (entity) {
+                if (hasOverrides) {
+                    PrefabOverrides::Apply(m_Scene, entity);
+                }
+                cell.Entities.push_back(entity);
+                m_Stats.EntitiesCreated++;
+            }
+
+            if (guaranteed > 0) guaranteed--;
+        }
+
+        // Joints within the cell only connect once both ends exist
+        serializer.ResolveReferences(cell.Remap);
+
+        cell.Doc.reset();
+        cell.State = CellState::Loaded;
+    }
+
+    void WorldStreamer::StepUnload(size_t cellIndex, double deadlineMs, uint32_t& guaranteed) {
+        Cell& cell = m_Cells[cellIndex];
+        auto& registry = m_Scene->GetRegistry();
+
+        while (!cell.Entities.empty()) {
+            if (guaranteed == 0 && NowMs() >= deadlineMs) {
+                return;
+            }
+
+            const entt::entity handle = cell.Entities.back();
+            cell.Entities.pop_back();
+            if (registry.valid(handle)) {
+                m_Scene->DestroyEntity(Entity(handle, &registry));
+                m_Stats.EntitiesDestroyed++;
+            }
+
+            if (guaranteed > 0) guaranteed--;
+        }
+
+        cell.State = CellState::Unloaded;
+    }
+
+    void WorldStreamer::RefreshCounts() {
+        m_Stats.LoadedCells = 0;
+        m_Stats.PendingCells = 0;
+        for (const auto& cell : m_Cells) {
+            if (cell.State == CellState::Loaded) {
+                m_Stats.LoadedCells++;
+            }
+            else if (cell.State != CellState::Unloaded) {
+                m_Stats.PendingCells++;
+            }
+        }
+    }
+
+    // ===== WORKERS =====
+
+    void WorldStreamer::StartWorkers() {
+        m_StopWorkers = false;
+        for (uint32_t i = 0; i < m_Settings.WorkerCount; ++i) {
+            m_Workers.emplace_back(&WorldStreamer::WorkerLoop, this);
+        }
+    }
+
+    void WorldStreamer::StopWorkers() {
+        {
+            std::lock_guard lock(m_Mutex);
+            m_StopWorkers = true;
+        }
+        m_WorkAvailable.notify_all();
+
+        for (auto& worker : m_Workers) {
+            worker.join();
+        }
+        m_Workers.clear();
+
+        // Anything still queued is requested again by the next Update
+        std::lock_guard lock(m_Mutex);
+        for (const auto& request : m_Requests) {
+            if (request.CellIndex < m_Cells.size() && m_Cells[request.CellIndex].State == CellState::Queued) {
+                m_Cells[request.CellIndex].State = CellState::Unloaded;
+            }
+        }
+        m_Requests.clear();
+        m_Results.clear();
+    }
+
+    void WorldStreamer::WorkerLoop() {
+        while (true) {
+            ParseRequest request;
+            {
+                std::unique_lock lock(m_Mutex);
+                m_WorkAvailable.wait(lock, [this]() { return m_StopWorkers || !m_Requests.empty(); });
+                if (m_StopWorkers) {
+                    return;
+                }
+                request = std::move(m_Requests.front());
+                m_Requests.pop_front();
+            }
+
+            // File IO and parsing never touch the registry
+            auto doc = ReadChunk(request.Path);
+
+            std::lock_guard lock(m_Mutex);
+            m_Results.push_back(ParseResult{ request.CellIndex, request.Generation, std::move(doc) });
+        }
+    }
+
+    std::unique_ptr<rapidjson::Document> WorldStreamer::ReadChunk(const std::string& path) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            LOG_ERROR("WorldStreamer: Cannot open cell ", path);
+            return nullptr;
+        }
+
+        std::string json((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        auto doc = std::make_unique<rapidjson::Document>();
+        doc->Parse(json.c_str());
+        if (doc->HasParseError() || !doc->HasMember("Entities") || !(*doc)["Entities"].IsArray()) {
+            LOG_ERROR("WorldStreamer: Invalid cell chunk ", path);
+            return nullptr;
+        }
+        return doc;
+    }
+
+} // namespace Engine
@@ -0,0 +1,169 @@
+/**
+ * @file WorldStreamer.h
+ * @brief Streams world-partition cells in and out around a focus point
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+#ifndef __WORLD_STREAMER_H__
+#define __WORLD_STREAMER_H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <entt/entt.hpp>
+#include <rapidjson/fwd.h>
+
+#include "WorldCell.h"
+#include "../Serialization/SceneSerializer.h"
+
+namespace Engine {
+
+    class Scene;
+
+    /**
+     * @brief Streaming policy
+     */
+    struct WorldStreamingSettings {
+        float LoadRadius = 96.0f;           ///< Cells closer than this (XZ) are loaded
+        float UnloadRadius = 128.0f;        ///< Cells further than this are unloaded (> LoadRadius for hysteresis)
+        double FrameBudgetMs = 2.0;         ///< Main-thread time for instantiating/destroying per Update
+        uint32_t MinEntitiesPerFrame = 8;   ///< Progress guarantee even when the budget is exceeded
+        uint32_t WorkerCount = 1;           ///< Background read/parse threads, 0 = parse inline (deterministic)
+    };
+
+    /**
+     * @brief Counters for the last Update and the current residency
+     */
+    struct WorldStreamingStats {
+        uint32_t LoadedCells = 0;
+        uint32_t PendingCells = 0;          ///< Queued, parsing or waiting to be instantiated
+        uint32_t EntitiesCreated = 0;       ///< In the last Update
+        uint32_t EntitiesDestroyed = 0;     ///< In the last Update
+        double LastUpdateMs = 0.0;
+    };
+
+    /**
+     * @brief Loads and unloads cells of a partitioned world
+     * @details Reading and JSON parsing run on worker threads; the registry is only
+     *          touched on the main thread inside Update(), in batches bounded by
+     *          FrameBudgetMs so large cells do not cause hitches.
+     */
+    class WorldStreamer {
+    public:
+        enum class CellState : uint8_t {
+            Unloaded,
+            Queued,         ///< Waiting for or being parsed by a worker
+            Parsed,         ///< Document ready, nothing instantiated yet
+            Instantiating,  ///< Partially instantiated
+            Loaded,
+            Unloading       ///< Entities being destroyed over several frames
+        };
+
+        WorldStreamer();
+        ~WorldStreamer();
+
+        WorldStreamer(const WorldStreamer&) = delete;
+        WorldStreamer& operator=(const WorldStreamer&) = delete;
+
+        /**
+         * @brief Load the manifest and persistent chunk, start workers
+         * @param scene Target scene (the persistent chunk replaces its content)
+         * @param worldDirectory Directory containing world.json
+         * @return False if the manifest or persistent chunk cannot be loaded
+         */
+        bool Open(Scene* scene, const std::string& worldDirectory);
+
+        /**
+         * @brief Stop workers and destroy every streamed-in entity
+         */
+        void Close();
+
+        /**
+         * @brief Stream around a focus point (call once per frame on the main thread)
+         */
+        void Update(const glm::vec3& focus);
+
+        /**
+         * @brief Run Update until nothing is pending (loading screens, tests)
+         */
+        void Flush(const glm::vec3& focus);
+
+        void SetSettings(const WorldStreamingSettings& settings);
+        const WorldStreamingSettings& GetSettings() const { return m_Settings; }
+
+        bool IsOpen() const { return m_Scene != nullptr; }
+        const WorldManifest& GetManifest() const { return m_Manifest; }
+        const WorldStreamingStats& GetStats() const { return m_Stats; }
+
+        CellState GetCellState(size_t cellIndex) const;
+
+        /**
+         * @brief Cell an entity was streamed in with, -1 for persistent or unknown
+         */
+        int32_t FindCellOf(entt::entity entity) const;
+
+    private:
+        struct Cell {
+            CellState State = CellState::Unloaded;
+            uint32_t Generation = 0;                      ///< Bumped on every request, stale parses are dropped
+            std::unique_ptr<rapidjson::Document> Doc;
+            uint32_t NextEntity = 0;
+            std::vector<entt::entity> Entities;
+            EntityRemap Remap;                            ///< Saved IDs of the entities instantiated so far
+        };
+
+        struct ParseRequest {
+            size_t CellIndex;
+            uint32_t Generation;
+            std::string Path;
+        };
+
+        struct ParseResult {
+            size_t CellIndex;
+            uint32_t Generation;
+            std::unique_ptr<rapidjson::Document> Doc;    ///< nullptr on failure
+        };
+
+        void StartWorkers();
+        void StopWorkers();
+        void WorkerLoop();
+        static std::unique_ptr<rapidjson::Document> ReadChunk(const std::string& path);
+
+        void Request(size_t cellIndex);
+        void CollectResults();
+        void StepInstantiate(size_t cellIndex, double deadlineMs, uint32_t& budgetEntities);
+        void StepUnload(size_t cellIndex, double deadlineMs, uint32_t& budgetEntities);
+        void RefreshCounts();
+
+        Scene* m_Scene = nullptr;
+        std::string m_Directory;
+        WorldManifest m_Manifest;
+        WorldStreamingSettings m_Settings;
+        WorldStreamingStats m_Stats;
+
+        std::vector<Cell> m_Cells;
+        std::vector<size_t> m_Order;      ///< Scratch: cells sorted by distance
+
+        // Worker handoff
+        std::vector<std::thread> m_Workers;
+        std::mutex m_Mutex;
+        std::condition_variable m_WorkAvailable;
+        std::deque<ParseRequest> m_Requests;
+        std::vector<ParseResult> m_Results;
+        bool m_StopWorkers = false;
+    };
+
+} // namespace Engine
+
+#endif // __WORLD_STREAMER_H__
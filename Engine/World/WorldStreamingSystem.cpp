@@ -0,0 +1,86 @@
+/**
+ * @file WorldStreamingSystem.cpp
+ * @brief Drives a WorldStreamer from the active listener or camera
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "WorldStreamingSystem.h"
+#include "../ECS/Scene.h"
+#include "../ECS/Components.h"
+#include "../Component/TransformComponent.h"
+#include "../Component/CameraComponent.h"
+#include "../Component/ListenerComponent.h"
+#include "../Utility/Logger.h"
+
+#include <tracy/Tracy.hpp>
+
+namespace Engine {
+
+    namespace {
+        glm::vec3 WorldPosition(const TransformComponent& transform) {
+            return transform.Parent == entt::null ? transform.Position : glm::vec3(transform.WorldTransform[3]);
+        }
+    }
+
+    WorldStreamingSystem::WorldStreamingSystem(std::string worldDirectory, const WorldStreamingSettings& settings)
+        : m_WorldDirectory(std::move(worldDirectory)) {
+        m_Streamer.SetSettings(settings);
+    }
+
+    void WorldStreamingSystem::OnInit(Scene* scene) {
+        if (!m_Streamer.Open(scene, m_WorldDirectory)) {
+            LOG_ERROR("WorldStreamingSystem: Failed to open world at ", m_WorldDirectory);
+        }
+    }
+
+    void WorldStreamingSystem::OnUpdate(Scene* scene, Timestep ts) {
+        (void)ts;
+        ZoneScopedN("WorldStreaming");
+
+        if (!m_Streamer.IsOpen()) return;
+
+        if (m_FocusOverride) {
+            m_Focus = *m_FocusOverride;
+        }
+        else {
+            // Keep the previous focus when nothing is found (e.g. listener streamed out)
+            FindFocus(scene, m_Focus);
+        }
+
+        m_Streamer.Update(m_Focus);
+    }
+
+    void WorldStreamingSystem::OnShutdown(Scene* scene) {
+        (void)scene;
+        m_Streamer.Close();
+    }
+
+    bool WorldStreamingSystem::FindFocus(Scene* scene, glm::vec3& outFocus) {
+        if (!scene) return false;
+
+        auto& registry = scene->GetRegistry();
+
+        auto listeners = registry.view<ListenerComponent, TransformComponent>(entt::exclude<InactiveComponent>);
+        for (auto entity : listeners) {
+            if (listeners.get<ListenerComponent>(entity).Active) {
+                outFocus = WorldPosition(listeners.get<TransformComponent>(entity));
+                return true;
+            }
+        }
+
+        auto cameras = registry.view<CameraComponent, TransformComponent>(entt::exclude<InactiveComponent>);
+        for (auto entity : cameras) {
+            if (cameras.get<CameraComponent>(entity).Enabled) {
+                outFocus = WorldPosition(cameras.get<TransformComponent>(entity));
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+} // namespace Engine
@@ -0,0 +1,67 @@
+/**
+ * @file WorldStreamingSystem.h
+ * @brief Drives a WorldStreamer from the active listener or camera
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+#ifndef __WORLD_STREAMING_SYSTEM_H__
+#define __WORLD_STREAMING_SYSTEM_H__
+
+#include <optional>
+#include <string>
+
+#include "../ECS/System.h"
+#include "WorldStreamer.h"
+
+namespace Engine {
+
+    /**
+     * @brief Opens a partitioned world on init and streams it every frame
+     * @details The focus is the active ListenerComponent's position, else the first
+     *          enabled camera's. A focus override (scripted camera path, editor view)
+     *          takes precedence. Runs before the TransformSystem so streamed-in
+     *          entities get world transforms in the same frame.
+     */
+    class WorldStreamingSystem : public System {
+    public:
+        explicit WorldStreamingSystem(std::string worldDirectory, const WorldStreamingSettings& settings = {});
+
+        void OnInit(Scene* scene) override;
+        void OnUpdate(Scene* scene, Timestep ts) override;
+        void OnShutdown(Scene* scene) override;
+        int  GetPriority() const override { return 0; }
+        const char* GetName() const override { return "WorldStreamingSystem"; }
+
+        /**
+         * @brief Stream around a fixed point instead of the listener/camera
+         */
+        void SetFocusOverride(std::optional<glm::vec3> focus) { m_FocusOverride = focus; }
+
+        /**
+         * @brief Position streamed around in the last update
+         */
+        const glm::vec3& GetFocus() const { return m_Focus; }
+
+        WorldStreamer& GetStreamer() { return m_Streamer; }
+
+        /**
+         * @brief Pick the focus point from the scene
+         * @return False if the scene has no listener or camera with a transform
+         */
+        static bool FindFocus(Scene* scene, glm::vec3& outFocus);
+
+    private:
+        std::string m_WorldDirectory;
+        WorldStreamer m_Streamer;
+        std::optional<glm::vec3> m_FocusOverride;
+        glm::vec3 m_Focus = glm::vec3(0.0f);
+    };
+
+} // namespace Engine
+
+#endif // __WORLD_STREAMING_SYSTEM_H__
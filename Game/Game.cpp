@@ -23,6 +23,12 @@
 #include "Graphics/CameraSystem.h"
 #include "Transform/TransformSystem.h"
 #include "Physics/PhysicsSystem.h"
+#include "Physics/CharacterControllerSystem.h"
+#include "Animation/AnimationSystem.h"
+#include "Particles/ParticleSystem.h"
+#include "World/WorldStreamingSystem.h"
+#include "Network/ReplicationSystem.h"
+#include <filesystem>
 
 Game::Game()
     : Application("Property-Based ECS Engine", 1280, 720)
@@ -106,8 +112,8 @@ void Game::OnInit() {
             return;
         }
 
-        // Editor get scene
-        if (!m_Editor)
+        // Editor get scene (headless runs have no window or GL context for it)
+        if (!m_Editor && GetWindow())
         {
             m_Editor = std::make_unique<Engine::Editor>(GetWindow());
             m_Editor->SetScene(m_Scene.get()); 
@@ -123,18 +129,49 @@ void Game::OnInit() {
         return;
     }
 
+    // A partitioned build of the scene (File > Build World Partition) is streamed instead
+    const std::string worldDirectory = "Resources/Sources/Scenes/ExampleScene";
+    const auto& session = GetSessionOptions();
+    const bool netClient = session.IsNetClient();
+    // A replication client mirrors the server's world and does not simulate it
+    const bool streamWorld = !netClient && std::filesystem::exists(worldDirectory + "/" + Engine::WorldManifest::FILE_NAME);
+
     // Step 4: Add systems to the scene
     LOG_INFO("Step 4: Adding systems to scene...");
     try {
+        if (streamWorld) {
+            m_Scene->AddSystem<Engine::WorldStreamingSystem>(worldDirectory);
+        }
         // TODO: Add more systems here as they're created by team members:
         // m_Scene->AddSystem<Engine::PhysicsSystem>();
         // m_Scene->AddSystem<Engine::RenderSystem>(GetWidth(), GetHeight());
         m_Scene->AddSystem<Engine::AudioSystem>(m_AudioManager.get());
         m_Scene->AddSystem<Engine::AudioEffectSystem>(m_AudioManager.get());
-        m_Scene->AddSystem<Engine::PhysicsSystem>();
+        if (!netClient) {
+            m_Scene->AddSystem<Engine::PhysicsSystem>();
+            m_Scene->AddSystem<Engine::CharacterControllerSystem>();
+        }
+        m_Scene->AddSystem<Engine::AnimationSystem>();
+        m_Scene->AddSystem<Engine::ParticleSystem>();
         m_Scene->AddSystem<Engine::TransformSystem>();
         m_Scene->AddSystem<Engine::CameraSystem>();
-        m_Scene->AddSystem<Engine::RenderSystem>(*m_Renderer);
+        // Inline unless threaded rendering was enabled (the editor needs GL on this thread)
+        m_Scene->AddSystem<Engine::RenderSystem>(*m_Renderer, GetFramePipeline());
+
+        if (session.IsNetServer()) {
+            auto transport = std::make_unique<Engine::UdpTransport>();
+            if (transport->Listen(static_cast<uint16_t>(session.NetServePort))) {
+                auto server = std::make_unique<Engine::ReplicationServer>();
+                server->AddConnection(std::move(transport));
+                m_Scene->AddSystem<Engine::ReplicationSystem>(std::move(server));
+            }
+        }
+        else if (netClient) {
+            auto transport = std::make_unique<Engine::UdpTransport>();
+            if (transport->Connect(session.NetConnectHost, static_cast<uint16_t>(session.NetConnectPort))) {
+                m_Scene->AddSystem<Engine::ReplicationSystem>(std::make_unique<Engine::ReplicationClient>(std::move(transport)));
+            }
+        }
        
         LOG_INFO("  -> Systems added successfully");
     }
@@ -157,9 +194,25 @@ void Game::OnInit() {
     bool loadedFromFile = false;
 
     try {
-        loadedFromFile = m_Scene->LoadFromFile("Resources/Sources/Scenes/ExampleScene.json");
-
-        if (loadedFromFile) {
+        // Streamed worlds load their persistent chunk when the streaming system initializes
+        loadedFromFile = streamWorld || netClient || m_Scene->LoadFromFile("Resources/Sources/Scenes/ExampleScene.json");
+
+        if (netClient) {
+            // Replicated entities carry no camera, the client views them through its own
+            auto camera = m_Scene->CreateEntity("Client Camera");
+            auto& camTransform = camera.AddComponent<Engine::TransformComponent>();
+            camTransform.Position = glm::vec3(0, 5, 5);
+            camTransform.SetRotation(glm::vec3(-15, 0, 0));
+
+            auto& camComponent = camera.AddComponent<Engine::CameraComponent>();
+            camComponent.Enabled = true;
+            camComponent.autoAspect = true;
+            camComponent.Depth = 0;
+
+            camera.AddComponent<Engine::ListenerComponent>().Active = true;
+            LOG_INFO("  -> Waiting for replicated state from ", session.NetConnectHost, ":", session.NetConnectPort);
+        }
+        else if (loadedFromFile) {
             LOG_INFO("  -> Scene loaded from file successfully");
         }
         else {
@@ -179,6 +232,7 @@ void Game::OnInit() {
         }
         catch (const std::exception& e) {
             LOG_CRITICAL("  -> Failed to create default scene: ", e.what());
+            if (m_Editor) m_Editor->SetScene(nullptr);
             m_Scene.reset();
             return;
         }
@@ -321,8 +375,10 @@ void Game::OnUpdate(Engine::Timestep ts) {
         }
 
         // Still render something so window doesn't freeze
-        glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        if (GetWindow() && !IsThreadedRendering()) {
+            glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        }
         return;
     }
 
@@ -551,13 +607,21 @@ void Game::OnUpdate(Engine::Timestep ts) {
     // Update Editor To Do
     //m_Editor->OnUpdate(Engine::Timestep ts);
     //m_Renderer->get_imgui_texture();
-    m_Editor->OnUpdate(ts);
+    if (m_Editor) {
+        m_Editor->OnUpdate(ts);
+    }
 }
 
 void Game::OnShutdown() {
     LOG_INFO("Game shutting down...");
 
     if (m_Scene) {
+        // Before the systems go away, for comparing replayed sessions build over build
+        const auto& timingReport = GetSessionOptions().TimingReportPath;
+        if (!timingReport.empty()) {
+            m_Scene->GetSystemRegistry().WriteTimingReport(timingReport);
+        }
+
         LOG_DEBUG("SHUTTING DOWN SCENE");
         // Shutdown all systems before destroying scene
         m_Scene->ShutdownSystems();
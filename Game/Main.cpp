@@ -1,17 +1,22 @@
 #include "Game.h"
 #include "Utility/Logger.h"
+#include "Core/CVar.h"
 
 int main(int argc, char** argv) {
-    // Suppress unused parameter warnings
-    (void)argc;
-    (void)argv;
-
     // Set log level for development - TRACE shows everything
     Engine::Logger::Get().SetLogLevel(Engine::LogLevel::Trace);
 
     // Enable file logging to capture crash info
     Engine::Logger::Get().EnableFileLogging("engine_log.txt");
 
+    // --record / --replay / --headless / --timings
+    Engine::Application::SetSessionOptions(Engine::SessionOptions::FromCommandLine(argc, argv));
+
+    // CVar layers: defaults (static init) < config file < --cvar overrides
+    const auto& options = Engine::Application::GetSessionOptions();
+    Engine::CVarRegistry::Get().LoadFile(options.ConfigPath);
+    Engine::CVarRegistry::Get().ApplyCommandLine(options.CVarOverrides);
+
     try {
         // Create and run the game
         Game game;
@@ -1,9 +1,11 @@
 #version 420 core
 
+in vec4 Color;
+
 layout(location=0) out vec4 FragColor;
 
 void main(){
 
-    FragColor = vec4(1.0, 0.0, 0.0, 1.0);
+    FragColor = Color;
 
 }
\ No newline at end of file
@@ -1,20 +1,15 @@
 #version 420 core
 
 layout (location=0) in vec3 VertexPosition;
-layout (location=1) in vec3 VertexNormal;
-layout (location=2) in vec3 VertexColor;
+layout (location=1) in vec4 VertexColor;
 
-out vec3 Position;
-out vec3 Normal;
-out vec3 Color;
+out vec4 Color;
 
-uniform mat4 M;
 uniform mat4 V;
 uniform mat4 P;
 
 void main(){
 
-    mat4 MV = V * M; 
-    vec4 VertexPositionInView = MV * vec4(VertexPosition, 1.0);
-    gl_Position = P * VertexPositionInView;
+    Color = VertexColor;
+    gl_Position = P * V * vec4(VertexPosition, 1.0);
 }
\ No newline at end of file
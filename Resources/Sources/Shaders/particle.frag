@@ -0,0 +1,16 @@
+#version 420 core
+
+in vec4 Color;
+in vec2 Corner;
+
+layout(location=0) out vec4 FragColor;
+
+void main(){
+
+    // Soft round sprite, fading out towards the quad edge
+    float falloff = 1.0 - smoothstep(0.5, 1.0, length(Corner));
+    if (falloff <= 0.0) discard;
+
+    FragColor = vec4(Color.rgb, Color.a * falloff);
+
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#version 420 core
+
+// Per instance
+layout (location=0) in vec3 InstancePosition;
+layout (location=1) in float InstanceSize;
+layout (location=2) in vec4 InstanceColor;
+
+out vec4 Color;
+out vec2 Corner;
+
+uniform mat4 V;
+uniform mat4 P;
+
+void main(){
+
+    // Triangle strip quad from the vertex index: (-1,-1) (1,-1) (-1,1) (1,1)
+    Corner = vec2((gl_VertexID & 1) * 2 - 1, (gl_VertexID >> 1) * 2 - 1);
+
+    // Expand in view space so the quad always faces the camera
+    vec4 center = V * vec4(InstancePosition, 1.0);
+    center.xy += Corner * (0.5 * InstanceSize);
+
+    Color = InstanceColor;
+    gl_Position = P * center;
+}
\ No newline at end of file
@@ -0,0 +1,270 @@
+/**
+ * @file AnimationTests.cpp
+ * @brief Clip compression error, SIMD against scalar skinning, and an animation
+ *        throughput benchmark in characters per millisecond
+ * @details Clips are built from a synthetic 60-joint walk cycle and compressed with the
+ *          asset compiler's AnimationBuilder, then decoded by the engine exactly as a
+ *          loaded .mesh would be.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "Animation/AnimationPose.h"
+#include "Animation/AnimationSystem.h"
+#include "ECS/Components.h"
+#include "ECS/Scene.h"
+#include "CompilerCore/AnimationBuilder.h"
+#include "CompilerCore/MeshCompiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+
+using namespace Engine;
+using namespace Engine::Tests;
+
+namespace {
+    constexpr int JOINTS = 60;
+    constexpr int FRAMES = 120;
+    constexpr float SAMPLE_RATE = 30.0f;
+    constexpr int VERTICES = 5000;
+
+    // Root walks forward and bobs; every other joint swings around its own axis
+    AssetCompiler::SampledClip MakeWalk() {
+        AssetCompiler::SampledClip clip;
+        clip.name = "Walk";
+        clip.sampleRate = SAMPLE_RATE;
+        clip.frameCount = FRAMES;
+        for (int f = 0; f < FRAMES; ++f) {
+            const float t = static_cast<float>(f) / SAMPLE_RATE;
+            for (int j = 0; j < JOINTS; ++j) {
+                clip.translations.push_back(j == 0 ? glm::vec3(t * 1.5f, 0.1f * std::sin(t * 6.0f), 0.0f) : glm::vec3(0.0f, 0.3f, 0.0f));
+                const glm::vec3 axis = glm::normalize(glm::vec3(1.0f, 0.3f * static_cast<float>(j), 0.2f));
+                clip.rotations.push_back(glm::normalize(glm::angleAxis(0.8f * std::sin(t * 3.0f + static_cast<float>(j)), axis)));
+                clip.scales.push_back(glm::vec3(1.0f));
+            }
+        }
+        return clip;
+    }
+
+    // Same conversion as the .mesh loader
+    AnimationClip ToEngineClip(const AssetCompiler::CompressedClip& compressed) {
+        AnimationClip clip;
+        clip.Name = compressed.name;
+        clip.Duration = compressed.duration;
+        clip.SampleRate = compressed.sampleRate;
+        clip.FrameCount = compressed.frameCount;
+        for (const auto& channel : compressed.channels) {
+            AnimationChannel converted;
+            converted.FirstKey = channel.firstKey;
+            converted.KeyCount = channel.keyCount;
+            converted.Min = glm::vec3(channel.min[0], channel.min[1], channel.min[2]);
+            converted.Extent = glm::vec3(channel.extent[0], channel.extent[1], channel.extent[2]);
+            clip.Channels.push_back(converted);
+        }
+        clip.KeyFrames = compressed.keyFrames;
+        clip.KeyValues = compressed.keyValues;
+        return clip;
+    }
+
+    AnimationClip CompressWalk(const AssetCompiler::SampledClip& sampled, const AssetCompiler::MeshSettingsCompiler& settings) {
+        AssetCompiler::CompressedClip compressed;
+        AssetCompiler::AnimationBuilder().compressClip(sampled, settings, compressed);
+        return ToEngineClip(compressed);
+    }
+
+    // A chain of joints with the walk clip and a random four-influence skin
+    std::shared_ptr<AnimationSet> MakeCharacter() {
+        auto set = std::make_shared<AnimationSet>();
+        set->Clips.push_back(CompressWalk(MakeWalk(), AssetCompiler::MeshSettingsCompiler()));
+
+        for (int j = 0; j < JOINTS; ++j) {
+            set->Skeleton.JointNames.push_back("Joint" + std::to_string(j));
+            set->Skeleton.Parents.push_back(j - 1);
+            set->Skeleton.BindPose.push_back(JointPose{ glm::vec3(0.0f, 0.3f, 0.0f) });
+            set->Skeleton.InverseBind.push_back(glm::mat4(1.0f));
+        }
+
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        for (int v = 0; v < VERTICES; ++v) {
+            set->Skin.Positions.push_back(glm::vec3(unit(rng), unit(rng), unit(rng)));
+            set->Skin.Normals.push_back(glm::normalize(glm::vec3(unit(rng), unit(rng), 1.0f)));
+            glm::vec4 weights(unit(rng), unit(rng), unit(rng), unit(rng));
+            set->Skin.Weights.push_back(weights / (weights.x + weights.y + weights.z + weights.w));
+            set->Skin.Joints.push_back(glm::u16vec4(rng() % JOINTS, rng() % JOINTS, rng() % JOINTS, rng() % JOINTS));
+        }
+        return set;
+    }
+}
+
+TEST_CASE(Animation, CompressionStaysWithinTolerance) {
+    const AssetCompiler::SampledClip sampled = MakeWalk();
+    const AssetCompiler::MeshSettingsCompiler settings;
+    const AnimationClip clip = CompressWalk(sampled, settings);
+
+    CHECK(clip.GetJointCount() == JOINTS);
+    const std::size_t raw = static_cast<std::size_t>(FRAMES) * JOINTS * sizeof(float) * 10;
+    CHECK(clip.GetCompressedSize() * 4 < raw);
+
+    // Constant channels keep a single key
+    CHECK(clip.Channels[1 * ANIMATION_CHANNELS_PER_JOINT + static_cast<int>(AnimationChannelType::Translation)].KeyCount == 1);
+    CHECK(clip.Channels[static_cast<int>(AnimationChannelType::Scale)].KeyCount == 1);
+
+    // Key reduction error plus 15/16-bit quantization
+    const float rotationBound = settings.animationRotationTolerance + 1e-4f;
+    const float translationBound = settings.animationTranslationTolerance + 1e-4f;
+    float maxRotation = 0.0f;
+    float maxTranslation = 0.0f;
+    float maxScale = 0.0f;
+
+    std::vector<JointPose> pose;
+    for (int f = 0; f < FRAMES; ++f) {
+        Animation::SampleClip(clip, static_cast<float>(f) / SAMPLE_RATE, pose);
+        CHECK(pose.size() == JOINTS);
+        for (int j = 0; j < JOINTS && j < static_cast<int>(pose.size()); ++j) {
+            const std::size_t s = static_cast<std::size_t>(f) * JOINTS + j;
+            glm::quat expected = sampled.rotations[s];
+            if (glm::dot(expected, pose[j].Rotation) < 0.0f) expected = -expected;
+            for (int c = 0; c < 4; ++c) {
+                maxRotation = std::max(maxRotation, std::fabs(expected[c] - pose[j].Rotation[c]));
+            }
+            maxTranslation = std::max(maxTranslation, glm::length(sampled.translations[s] - pose[j].Translation));
+            maxScale = std::max(maxScale, glm::length(sampled.scales[s] - pose[j].Scale));
+        }
+    }
+    CHECK(maxRotation <= rotationBound);
+    CHECK(maxTranslation <= translationBound);
+    CHECK(maxScale <= 1e-4f);
+
+    // Between frames the decoded pose stays a unit rotation
+    Animation::SampleClip(clip, 0.517f, pose);
+    for (const JointPose& joint : pose) {
+        CHECK_NEAR(glm::length(joint.Rotation), 1.0f, 1e-4f);
+    }
+}
+
+TEST_CASE(Animation, LooserToleranceDropsMoreKeys) {
+    const AssetCompiler::SampledClip sampled = MakeWalk();
+    AssetCompiler::MeshSettingsCompiler tight;
+    AssetCompiler::MeshSettingsCompiler loose;
+    loose.animationRotationTolerance = 0.01f;
+    loose.animationTranslationTolerance = 0.01f;
+
+    CHECK(CompressWalk(sampled, loose).KeyFrames.size() < CompressWalk(sampled, tight).KeyFrames.size());
+}
+
+TEST_CASE(Animation, SimdSkinningMatchesScalar) {
+    std::shared_ptr<AnimationSet> set = MakeCharacter();
+    AnimatorComponent animator;
+    animator.Animations = set;
+    animator.CpuSkinning = true;
+    animator.Time = 0.5f;
+
+    std::vector<JointPose> scratch;
+    AnimationSystem::Evaluate(animator, scratch);
+    CHECK(animator.SkinnedPositions.size() == VERTICES);
+    CHECK(animator.SkinnedNormals.size() == VERTICES);
+    if (animator.SkinnedPositions.size() != VERTICES || animator.SkinnedNormals.size() != VERTICES)
+        return;
+
+    std::vector<glm::vec3> positions(VERTICES);
+    std::vector<glm::vec3> normals(VERTICES);
+    Animation::SkinVerticesScalar(set->Skin, animator.SkinningMatrices.data(), positions.data(), normals.data(), 0, VERTICES);
+
+    float maxDiff = 0.0f;
+    for (int v = 0; v < VERTICES; ++v) {
+        maxDiff = std::max(maxDiff, glm::length(positions[v] - animator.SkinnedPositions[v]));
+        maxDiff = std::max(maxDiff, glm::length(normals[v] - animator.SkinnedNormals[v]));
+    }
+    CHECK(maxDiff < 1e-5f);
+
+    // Odd ranges exercise the SIMD tail
+    std::vector<glm::vec3> partial(VERTICES, glm::vec3(-1.0f));
+    Animation::SkinVertices(set->Skin, animator.SkinningMatrices.data(), partial.data(), nullptr, 3, 10);
+    CHECK(partial[2] == glm::vec3(-1.0f));
+    CHECK(partial[10] == glm::vec3(-1.0f));
+    for (int v = 3; v < 10; ++v) {
+        CHECK_NEAR(glm::length(partial[v] - positions[v]), 0.0f, 1e-5f);
+    }
+}
+
+BENCHMARK_CASE(Animation, CharactersPerMs) {
+    std::shared_ptr<AnimationSet> set = MakeCharacter();
+    std::printf("  %d joints, %d vertices, clip %zu bytes compressed, SSE skinning %s\n",
+        JOINTS, VERTICES, set->Clips[0].GetCompressedSize(), Animation::HasSimdSkinning() ? "on" : "off");
+
+    // Single thread, pose only and pose plus CPU skinning
+    for (bool cpuSkinning : { false, true }) {
+        AnimatorComponent animator;
+        animator.Animations = set;
+        animator.CpuSkinning = cpuSkinning;
+        std::vector<JointPose> scratch;
+
+        constexpr int ITERATIONS = 2000;
+        Stopwatch timer;
+        for (int i = 0; i < ITERATIONS; ++i) {
+            AnimationSystem::Advance(animator, 1.0f / 60.0f);
+            AnimationSystem::Evaluate(animator, scratch);
+        }
+        const double ms = timer.ElapsedMs();
+        std::printf("  single thread, %s: %.1f characters/ms\n", cpuSkinning ? "pose + skinning" : "pose only", ITERATIONS / ms);
+    }
+
+    {
+        std::vector<glm::vec3> positions(VERTICES);
+        std::vector<glm::vec3> normals(VERTICES);
+        AnimatorComponent animator;
+        animator.Animations = set;
+        std::vector<JointPose> scratch;
+        AnimationSystem::Evaluate(animator, scratch);
+
+        constexpr int ITERATIONS = 200;
+        Stopwatch timer;
+        for (int i = 0; i < ITERATIONS; ++i)
+            Animation::SkinVerticesScalar(set->Skin, animator.SkinningMatrices.data(), positions.data(), normals.data(), 0, VERTICES);
+        const double scalarMs = timer.ElapsedMs() / ITERATIONS;
+        timer.Restart();
+        for (int i = 0; i < ITERATIONS; ++i)
+            Animation::SkinVertices(set->Skin, animator.SkinningMatrices.data(), positions.data(), normals.data(), 0, VERTICES);
+        const double simdMs = timer.ElapsedMs() / ITERATIONS;
+        std::printf("  skinning %d vertices: scalar %.3f ms, SkinVertices %.3f ms\n", VERTICES, scalarMs, simdMs);
+    }
+
+    // 1000 animators through the batched system update, half of them blending
+    for (bool cpuSkinning : { false, true }) {
+        Scene scene("AnimationBenchmark");
+        AnimationSystem* animation = scene.AddSystem<AnimationSystem>();
+        animation->SetFetchAnimationSetCallback([&](Scene*, entt::entity) { return std::shared_ptr<const AnimationSet>(set); });
+        for (int i = 0; i < 1000; ++i) {
+            auto& animator = scene.CreateEntity("Character").AddComponent<AnimatorComponent>();
+            animator.Time = static_cast<float>(i) * 0.01f;
+            animator.CpuSkinning = cpuSkinning;
+            if (i % 2 == 1) {
+                animator.BlendClip = 0;
+                animator.BlendWeight = 0.3f;
+            }
+        }
+        scene.InitializeSystems();
+        for (int i = 0; i < 5; ++i)
+            scene.OnUpdate(1.0f / 60.0f);
+
+        constexpr int UPDATES = 20;
+        double total = 0.0;
+        for (int i = 0; i < UPDATES; ++i) {
+            scene.OnUpdate(1.0f / 60.0f);
+            total += animation->GetStats().EvaluateMs;
+        }
+        const AnimationStats& stats = animation->GetStats();
+        const double ms = total / UPDATES;
+        std::printf("  scene, %s: %u characters in %u batches, %.3f ms, %.1f characters/ms\n",
+            cpuSkinning ? "pose + skinning" : "pose only", stats.Characters, stats.Batches, ms, stats.Characters / ms);
+        scene.ShutdownSystems();
+    }
+}
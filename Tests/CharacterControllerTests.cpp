@@ -0,0 +1,202 @@
+/**
+ * @file CharacterControllerTests.cpp
+ * @brief Headless step, wall, slope and jump checks for CharacterControllerSystem,
+ *        plus a crowd update benchmark
+ * @details Each case walks a default 1.8 m capsule (0.4 m step height, 45 degree slope
+ *          limit) along +X at 2 m/s from the origin towards one obstacle on a flat floor.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "PhysicsTestScene.h"
+#include "Physics/CharacterControllerSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+using namespace Engine;
+using namespace Engine::Tests;
+
+namespace {
+    constexpr int WALK_FRAMES = 240;    // 4 s, 8 m at 2 m/s
+
+    struct Walk {
+        glm::vec3 End{};
+        float MaxHeight = 0.0f;
+        bool Grounded = false;
+    };
+
+    class CharacterScene : public PhysicsTestScene {
+    public:
+        CharacterScene() {
+            m_Characters = GetScene().AddSystem<CharacterControllerSystem>();
+            AddBox("Floor", glm::vec3(0.0f, -0.5f, 0.0f), glm::vec3(200.0f, 0.5f, 200.0f), true);
+        }
+
+        Entity AddCharacter(const glm::vec3& position, const glm::vec3& velocity) {
+            Entity entity = GetScene().CreateEntity("Character");
+            entity.GetComponent<TransformComponent>().Position = position;
+            entity.AddComponent<CharacterControllerComponent>().DesiredVelocity = velocity;
+            return entity;
+        }
+
+        Walk Run(Entity character, int frames) {
+            Walk walk;
+            for (int i = 0; i < frames; ++i) {
+                Step(1);
+                walk.MaxHeight = std::max(walk.MaxHeight, character.GetComponent<TransformComponent>().Position.y);
+            }
+            walk.End = character.GetComponent<TransformComponent>().Position;
+            walk.Grounded = character.GetComponent<CharacterControllerComponent>().IsGrounded();
+            return walk;
+        }
+
+        CharacterControllerSystem& GetCharacters() { return *m_Characters; }
+
+    private:
+        CharacterControllerSystem* m_Characters = nullptr;
+    };
+
+    // Ramp rising along +X from x = 3, length 8 m, tilted by angleDeg
+    void AddRamp(CharacterScene& scene, float angleDeg) {
+        const float angle = glm::radians(angleDeg);
+        const float halfLength = 4.0f;
+        const float halfThickness = 0.05f;
+        scene.AddBox("Ramp",
+            glm::vec3(3.0f + halfLength * std::cos(angle), halfLength * std::sin(angle) - halfThickness, 0.0f),
+            glm::vec3(halfLength, halfThickness, 2.0f), true, glm::vec3(0.0f, 0.0f, angleDeg));
+    }
+}
+
+TEST_CASE(CharacterController, StandsOnFloor) {
+    CharacterScene scene;
+    Entity character = scene.AddCharacter(glm::vec3(0.0f, 0.5f, 0.0f), glm::vec3(0.0f));
+    scene.Initialize();
+
+    const Walk walk = scene.Run(character, 60);
+    CHECK(walk.Grounded);
+    CHECK_NEAR(walk.End.y, 0.0f, 0.02f);
+    CHECK_NEAR(walk.End.x, 0.0f, 1e-3f);
+}
+
+TEST_CASE(CharacterController, StepsUpLowLedge) {
+    // 0.3 m step between x = 5 and 6, below the 0.4 m step height
+    CharacterScene scene;
+    scene.AddBox("Step", glm::vec3(5.5f, 0.15f, 0.0f), glm::vec3(0.5f, 0.15f, 2.0f), true);
+    Entity character = scene.AddCharacter(glm::vec3(0.0f, 0.1f, 0.0f), glm::vec3(2.0f, 0.0f, 0.0f));
+    scene.Initialize();
+
+    const Walk walk = scene.Run(character, WALK_FRAMES);
+    CHECK(walk.MaxHeight > 0.25f);
+    CHECK(walk.End.x > 7.0f);
+    CHECK_NEAR(walk.End.y, 0.0f, 0.05f);
+    CHECK(walk.Grounded);
+}
+
+TEST_CASE(CharacterController, BlockedByWall) {
+    // 1 m wall starting at x = 5, well above the step height
+    CharacterScene scene;
+    scene.AddBox("Wall", glm::vec3(5.5f, 0.5f, 0.0f), glm::vec3(0.5f, 0.5f, 2.0f), true);
+    Entity character = scene.AddCharacter(glm::vec3(0.0f, 0.1f, 0.0f), glm::vec3(2.0f, 0.0f, 0.0f));
+    scene.Initialize();
+
+    const Walk walk = scene.Run(character, WALK_FRAMES);
+    CHECK(walk.End.x < 5.0f - 0.25f);
+    CHECK(walk.End.x > 4.0f);
+    CHECK(walk.MaxHeight < 0.1f);
+    CHECK(walk.Grounded);
+}
+
+TEST_CASE(CharacterController, ClimbsGentleSlope) {
+    CharacterScene scene;
+    AddRamp(scene, 20.0f);
+    Entity character = scene.AddCharacter(glm::vec3(0.0f, 0.1f, 0.0f), glm::vec3(2.0f, 0.0f, 0.0f));
+    scene.Initialize();
+
+    const Walk walk = scene.Run(character, WALK_FRAMES);
+    CHECK(walk.End.x > 6.0f);
+    CHECK(walk.End.y > 1.0f);
+    // On the ramp surface, not floating above or sunk into it
+    CHECK_NEAR(walk.End.y, (walk.End.x - 3.0f) * std::tan(glm::radians(20.0f)), 0.15f);
+}
+
+TEST_CASE(CharacterController, StopsAtSteepSlope) {
+    // 60 degrees is past the 45 degree limit
+    CharacterScene scene;
+    AddRamp(scene, 60.0f);
+    Entity character = scene.AddCharacter(glm::vec3(0.0f, 0.1f, 0.0f), glm::vec3(2.0f, 0.0f, 0.0f));
+    scene.Initialize();
+
+    const Walk walk = scene.Run(character, WALK_FRAMES);
+    CHECK(walk.End.x < 3.2f);
+    CHECK(walk.MaxHeight < 0.5f);
+}
+
+TEST_CASE(CharacterController, JumpsAndLands) {
+    CharacterScene scene;
+    Entity character = scene.AddCharacter(glm::vec3(0.0f, 0.1f, 0.0f), glm::vec3(0.0f));
+    scene.Initialize();
+    scene.Step(30);
+
+    // 5 m/s under 9.81 m/s^2 peaks at about 1.27 m
+    character.GetComponent<CharacterControllerComponent>().RequestJump();
+    const Walk walk = scene.Run(character, 90);
+    CHECK(walk.MaxHeight > 1.0f);
+    CHECK(walk.MaxHeight < 1.5f);
+    CHECK_NEAR(walk.End.y, 0.0f, 0.05f);
+    CHECK(walk.Grounded);
+}
+
+TEST_CASE(CharacterController, LODBucketKeepsPace) {
+    // Every entity in one bucket ticking every 4 frames, except the reference character
+    CharacterScene scene;
+    SimulationLODSettings settings;
+    settings.Buckets = { { 1.0e30f, 4 } };
+    scene.GetScene().GetSimulationLOD().SetSettings(settings);
+
+    Entity full = scene.AddCharacter(glm::vec3(0.0f, 1.0f, -3.0f), glm::vec3(2.0f, 0.0f, 0.0f));
+    full.AddComponent<SimulationLODComponent>().AlwaysTick = true;
+    Entity bucketed = scene.AddCharacter(glm::vec3(0.0f, 1.0f, 3.0f), glm::vec3(2.0f, 0.0f, 0.0f));
+    scene.Initialize();
+
+    const Walk fullWalk = scene.Run(full, WALK_FRAMES);
+    const glm::vec3 end = bucketed.GetComponent<TransformComponent>().Position;
+    CHECK(bucketed.GetComponent<SimulationLODComponent>().Interval == 4);
+
+    // At most three frames behind, from where in the interval its last tick fell
+    CHECK(fullWalk.End.x > 7.0f);
+    CHECK(end.x <= fullWalk.End.x + 1e-3f);
+    CHECK(end.x > fullWalk.End.x - 3.5f * 2.0f / 60.0f);
+    // Fell from 1 m and landed just as fast
+    CHECK_NEAR(end.y, fullWalk.End.y, 0.05f);
+    CHECK(bucketed.GetComponent<CharacterControllerComponent>().IsGrounded());
+}
+
+BENCHMARK_CASE(CharacterController, Crowd) {
+    for (int count : { 100, 1000 }) {
+        CharacterScene scene;
+        for (int i = 0; i < count; ++i) {
+            const glm::vec3 position(-60.0f + static_cast<float>(i % 40) * 3.0f, 0.1f, -60.0f + static_cast<float>(i / 40) * 3.0f);
+            scene.AddCharacter(position, glm::vec3(0.0f, 0.0f, 1.0f));
+        }
+        scene.Initialize();
+        scene.Step(60);
+
+        constexpr int FRAMES = 240;
+        double total = 0.0;
+        for (int i = 0; i < FRAMES; ++i) {
+            scene.Step(1);
+            total += scene.GetCharacters().GetStats().UpdateMs;
+        }
+
+        const CharacterControllerStats& stats = scene.GetCharacters().GetStats();
+        const double ms = total / FRAMES;
+        std::printf("  %5d characters: %.3f ms/frame, %.2f us/character, %.0f characters/ms, %u batches, peak %.3f ms\n",
+            count, ms, ms * 1000.0 / count, count / ms, stats.Batches, stats.PeakMs);
+    }
+}
@@ -0,0 +1,160 @@
+/**
+ * @file DebugDrawTests.cpp
+ * @brief Debug draw geometry, projection, and collection of timed primitives
+ * @details No GL context is involved: geometry is generated into plain vertex
+ *          vectors and DebugDraw::collect only merges queues.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "Graphics/DebugDraw.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+    bool AllOnUnitCube(const std::vector<DebugVertex>& vertices) {
+        for (const DebugVertex& vertex : vertices) {
+            const glm::vec3 p = glm::abs(vertex.position);
+            if (std::abs(p.x - 1.0f) > 1e-4f || std::abs(p.y - 1.0f) > 1e-4f || std::abs(p.z - 1.0f) > 1e-4f)
+                return false;
+        }
+        return true;
+    }
+}
+
+TEST_CASE(DebugDraw, GeometryVertexCounts) {
+    std::vector<DebugVertex> vertices;
+
+    DebugGeometry::box(vertices, glm::vec3(0.0f), glm::vec3(1.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), DebugColors::Red);
+    CHECK(vertices.size() == 24);
+    CHECK(AllOnUnitCube(vertices));
+    CHECK(vertices.front().color == DebugColors::Red);
+
+    // A rotated box keeps its corners at the same distance from the center
+    vertices.clear();
+    const glm::quat rotation = glm::angleAxis(0.7f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f)));
+    DebugGeometry::box(vertices, glm::vec3(5.0f, 0.0f, 0.0f), glm::vec3(1.0f, 2.0f, 3.0f), rotation, DebugColors::White);
+    CHECK(vertices.size() == 24);
+    for (const DebugVertex& vertex : vertices)
+        CHECK_NEAR(glm::length(vertex.position - glm::vec3(5.0f, 0.0f, 0.0f)), std::sqrt(14.0f), 1e-4f);
+
+    vertices.clear();
+    DebugGeometry::sphere(vertices, glm::vec3(0.0f, 1.0f, 0.0f), 2.0f, DebugColors::Green);
+    CHECK(vertices.size() == static_cast<size_t>(3 * 2 * DebugGeometry::circle_segments));
+    for (const DebugVertex& vertex : vertices)
+        CHECK_NEAR(glm::length(vertex.position - glm::vec3(0.0f, 1.0f, 0.0f)), 2.0f, 1e-4f);
+
+    vertices.clear();
+    DebugGeometry::circle(vertices, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f), 1.0f, DebugColors::Green, 1);
+    CHECK(vertices.size() == 6);
+
+    // The identity matrix clips exactly the NDC cube
+    vertices.clear();
+    DebugGeometry::frustum(vertices, glm::mat4(1.0f), DebugColors::Yellow);
+    CHECK(vertices.size() == 24);
+    CHECK(AllOnUnitCube(vertices));
+
+    // A perspective frustum's far corners lie on the far plane
+    vertices.clear();
+    const glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 1.0f, 10.0f);
+    DebugGeometry::frustum(vertices, projection, DebugColors::Yellow);
+    CHECK(vertices.size() == 24);
+    float nearZ = -1e9f, farZ = 1e9f;
+    for (const DebugVertex& vertex : vertices) {
+        nearZ = std::max(nearZ, vertex.position.z);
+        farZ = std::min(farZ, vertex.position.z);
+    }
+    CHECK_NEAR(nearZ, -1.0f, 1e-3f);
+    CHECK_NEAR(farZ, -10.0f, 1e-2f);
+}
+
+TEST_CASE(DebugDraw, ProjectToViewport) {
+    const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 0.0f, 5.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 viewProjection = glm::perspective(glm::radians(90.0f), 2.0f, 0.1f, 100.0f) * view;
+    const glm::vec2 viewport(800.0f, 400.0f);
+
+    glm::vec2 pixels(-1.0f);
+    CHECK(DebugGeometry::project(viewProjection, viewport, glm::vec3(0.0f), pixels));
+    CHECK_NEAR(pixels.x, 400.0f, 1e-3f);
+    CHECK_NEAR(pixels.y, 200.0f, 1e-3f);
+
+    // Up in the world is up on screen, which is toward row 0
+    CHECK(DebugGeometry::project(viewProjection, viewport, glm::vec3(1.0f, 1.0f, 0.0f), pixels));
+    CHECK(pixels.x > 400.0f);
+    CHECK(pixels.y < 200.0f);
+
+    const glm::vec2 unchanged = pixels;
+    CHECK(!DebugGeometry::project(viewProjection, viewport, glm::vec3(0.0f, 0.0f, 10.0f), pixels));
+    CHECK(pixels == unchanged);
+}
+
+TEST_CASE(DebugDraw, CollectAgesTimedPrimitives) {
+    if (!DebugDraw::enabled()) return;
+    DebugDraw::clear();
+    DebugDrawList list;
+
+    DebugDraw::line(glm::vec3(0.0f), glm::vec3(1.0f), DebugColors::Red);
+    DebugDraw::line(glm::vec3(0.0f), glm::vec3(2.0f), DebugColors::Green, 1.0f);
+    DebugDraw::box(glm::vec3(0.0f), glm::vec3(1.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), DebugColors::Blue, 0.5f, false);
+    DebugDraw::text(glm::vec3(0.0f), "label", DebugColors::White, 0.5f);
+
+    // Depth-tested lines come first, then the overlay range
+    DebugDraw::collect(list, 0.0f);
+    CHECK(list.depth_vertices == 4);
+    CHECK(list.vertices.size() == 4 + 24 + 6);
+    CHECK(list.texts.size() == 1);
+    CHECK(DebugDraw::stats().persistent_lines == 1 + 12 + 3);
+
+    // The untimed line is gone; the rest lives on for its duration
+    DebugDraw::collect(list, 0.3f);
+    CHECK(list.depth_vertices == 2);
+    CHECK(list.vertices.size() == 2 + 24 + 6);
+    CHECK(list.texts.size() == 1);
+
+    DebugDraw::collect(list, 0.3f);
+    CHECK(list.depth_vertices == 2);
+    CHECK(list.vertices.size() == 2);
+    CHECK(list.texts.empty());
+
+    DebugDraw::collect(list, 0.5f);
+    CHECK(list.empty());
+    CHECK(DebugDraw::stats().persistent_lines == 0);
+}
+
+TEST_CASE(DebugDraw, ExitedThreadsReleaseTheirBuffers) {
+    if (!DebugDraw::enabled()) return;
+    DebugDraw::clear();
+    DebugDrawList list;
+
+    DebugDraw::line(glm::vec3(0.0f), glm::vec3(1.0f));
+    DebugDraw::collect(list, 0.0f);
+    const std::uint32_t buffers = DebugDraw::stats().thread_buffers;
+
+    // Like a job pool torn down on reload: every worker draws once, then exits
+    for (int round = 0; round < 4; ++round) {
+        std::vector<std::thread> workers;
+        for (int i = 0; i < 4; ++i)
+            workers.emplace_back([] { DebugDraw::line(glm::vec3(0.0f), glm::vec3(1.0f), DebugColors::Cyan, 1.0f); });
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    // What they queued before exiting is still drawn
+    DebugDraw::collect(list, 0.0f);
+    CHECK(DebugDraw::stats().thread_buffers == buffers);
+    CHECK(list.vertices.size() == 2 * 16);
+
+    DebugDraw::collect(list, 2.0f);
+    CHECK(list.empty());
+}
@@ -0,0 +1,162 @@
+/**
+ * @file EditorHistoryTests.cpp
+ * @brief Undo/redo round trips of entity creation, deletion and property edits
+ * @details Drives EditorHistory headlessly against a plain Scene, the way the
+ *          hierarchy panel and the inspector record their operations.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "ECS/Components.h"
+#include "ECS/Scene.h"
+#include "Editor/EditorHistory.h"
+#include "Serialization/ComponentRegistry.h"
+#include "Serialization/ReflectionRegistry.h"
+
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+    // Registration is not idempotent; every suite using reflection shares this
+    void RegisterComponentsOnce() {
+        static const bool registered = (ComponentRegistry::RegisterAllComponents(), true);
+        (void)registered;
+    }
+
+    // Set a property through reflection and record it, like the inspector does
+    void EditPosition(EditorHistory& history, Scene& scene, Entity entity, const glm::vec3& position) {
+        ComponentMetadata& meta = *ReflectionRegistry::Get().GetMetadata<TransformComponent>();
+        const PropertyBase& property = *meta.FindProperty(HashReflectionName("Position"));
+        void* component = meta.Get(scene.GetRegistry(), entity);
+
+        std::vector<uint8_t> before;
+        property.WriteBinary(component, before);
+        entity.GetComponent<TransformComponent>().Position = position;
+        history.RecordPropertyChange(entity, meta, property, before);
+    }
+
+    Entity AddChild(Scene& scene, Entity parent, const std::string& name, const glm::vec3& position) {
+        Entity child = scene.CreateEntity(name);
+        child.GetComponent<TransformComponent>().Position = position;
+        child.GetComponent<TransformComponent>().Parent = parent;
+        parent.GetComponent<TransformComponent>().Children.push_back(child);
+        return child;
+    }
+
+    std::string TagOf(Scene& scene, entt::entity entity) {
+        return scene.GetRegistry().get<TagComponent>(entity).Tag;
+    }
+}
+
+TEST_CASE(EditorHistory, CreateRoundTrip) {
+    RegisterComponentsOnce();
+    Scene scene("HistoryTest");
+    EditorHistory history;
+    history.SetScene(&scene);
+
+    Entity entity = scene.CreateEntity("Crate");
+    entity.GetComponent<TransformComponent>().Position = glm::vec3(1.0f, 2.0f, 3.0f);
+    const entt::entity handle = entity;
+    history.RecordCreateEntity(entity);
+    CHECK(history.GetUndoName() == "Create Entity");
+
+    CHECK(history.Undo());
+    CHECK(!scene.GetRegistry().valid(handle));
+    CHECK(history.CanRedo());
+
+    CHECK(history.Redo());
+    CHECK(scene.GetRegistry().valid(handle));
+    CHECK(TagOf(scene, handle) == "Crate");
+    CHECK(scene.GetRegistry().get<TransformComponent>(handle).Position == glm::vec3(1.0f, 2.0f, 3.0f));
+    CHECK(!history.CanRedo());
+}
+
+TEST_CASE(EditorHistory, PropertyDragCoalesces) {
+    RegisterComponentsOnce();
+    Scene scene("HistoryTest");
+    EditorHistory history;
+    history.SetScene(&scene);
+
+    Entity entity = scene.CreateEntity("Crate");
+    auto& transform = entity.GetComponent<TransformComponent>();
+
+    // One drag is one step, whatever the number of frames it spans
+    for (int i = 1; i <= 5; ++i)
+        EditPosition(history, scene, entity, glm::vec3(static_cast<float>(i), 0.0f, 0.0f));
+    history.CloseCoalescing();
+    EditPosition(history, scene, entity, glm::vec3(9.0f, 9.0f, 9.0f));
+    history.CloseCoalescing();
+    CHECK(history.GetUndoCount() == 2);
+
+    CHECK(history.Undo());
+    CHECK(transform.Position == glm::vec3(5.0f, 0.0f, 0.0f));
+    CHECK(history.Undo());
+    CHECK(transform.Position == glm::vec3(0.0f));
+    CHECK(!history.Undo());
+
+    CHECK(history.Redo());
+    CHECK(history.Redo());
+    CHECK(transform.Position == glm::vec3(9.0f, 9.0f, 9.0f));
+
+    // A new edit drops what could be redone
+    CHECK(history.Undo());
+    EditPosition(history, scene, entity, glm::vec3(-1.0f));
+    CHECK(!history.CanRedo());
+}
+
+TEST_CASE(EditorHistory, DeleteRestoresHierarchy) {
+    RegisterComponentsOnce();
+    Scene scene("HistoryTest");
+    EditorHistory history;
+    history.SetScene(&scene);
+    auto& registry = scene.GetRegistry();
+
+    Entity parent = scene.CreateEntity("Parent");
+    Entity first = AddChild(scene, parent, "First", glm::vec3(1.0f, 0.0f, 0.0f));
+    Entity middle = AddChild(scene, parent, "Middle", glm::vec3(2.0f, 0.0f, 0.0f));
+    Entity last = AddChild(scene, parent, "Last", glm::vec3(3.0f, 0.0f, 0.0f));
+    Entity grandchild = AddChild(scene, middle, "Grandchild", glm::vec3(0.0f, 4.0f, 0.0f));
+    const entt::entity middleHandle = middle;
+    const entt::entity grandchildHandle = grandchild;
+
+    // Deleting takes the children along and leaves the parent's list consistent
+    history.DestroyEntity(middle);
+    CHECK(!registry.valid(middleHandle));
+    CHECK(!registry.valid(grandchildHandle));
+    CHECK((parent.GetComponent<TransformComponent>().Children == std::vector<entt::entity>{ first, last }));
+
+    CHECK(history.Undo());
+    CHECK(registry.valid(middleHandle));
+    CHECK(registry.valid(grandchildHandle));
+    CHECK((parent.GetComponent<TransformComponent>().Children == std::vector<entt::entity>{ first, middleHandle, last }));
+
+    const auto& middleTransform = registry.get<TransformComponent>(middleHandle);
+    CHECK(middleTransform.Parent == static_cast<entt::entity>(parent));
+    CHECK(middleTransform.Position == glm::vec3(2.0f, 0.0f, 0.0f));
+    CHECK((middleTransform.Children == std::vector<entt::entity>{ grandchildHandle }));
+
+    const auto& grandchildTransform = registry.get<TransformComponent>(grandchildHandle);
+    CHECK(grandchildTransform.Parent == middleHandle);
+    CHECK(grandchildTransform.Position == glm::vec3(0.0f, 4.0f, 0.0f));
+    CHECK(TagOf(scene, grandchildHandle) == "Grandchild");
+
+    CHECK(history.Redo());
+    CHECK(!registry.valid(middleHandle));
+    CHECK(!registry.valid(grandchildHandle));
+    CHECK((parent.GetComponent<TransformComponent>().Children == std::vector<entt::entity>{ first, last }));
+
+    // Edits made to a child before its parent was deleted still undo afterwards
+    CHECK(history.Undo());
+    EditPosition(history, scene, Entity(grandchildHandle, &registry), glm::vec3(7.0f));
+    history.CloseCoalescing();
+    history.DestroyEntity(Entity(middleHandle, &registry));
+    CHECK(history.Undo());
+    CHECK(history.Undo());
+    CHECK(registry.get<TransformComponent>(grandchildHandle).Position == glm::vec3(0.0f, 4.0f, 0.0f));
+}
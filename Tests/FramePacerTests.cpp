@@ -0,0 +1,172 @@
+/**
+ * @file FramePacerTests.cpp
+ * @brief Frame limiter, timestep smoothing and frame statistics of FramePacer
+ * @details The pacer runs on a fake clock that only moves when the test or the
+ *          pacer's own waits advance it, so every frame time is exact.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "Core/FramePacer.h"
+
+#include <cstdint>
+#include <memory>
+
+using namespace Engine;
+
+namespace {
+    constexpr uint64_t MS = 1000000ull;
+
+    // Sleeps overshoot by a fixed amount, like an OS scheduler tick; spins advance a little
+    class FakeClock : public FramePacerClock {
+    public:
+        explicit FakeClock(uint64_t startNs = 0) : Now(startNs) {}
+
+        uint64_t NowNanoseconds() const override { return Now; }
+
+        void SleepFor(uint64_t ns) override {
+            Now += ns + SleepOvershootNs;
+            ++Sleeps;
+        }
+
+        void Spin() override {
+            Now += SpinStepNs;
+            ++Spins;
+        }
+
+        uint64_t Now;
+        uint64_t SleepOvershootNs = 0;
+        uint64_t SpinStepNs = 10000;
+        int Sleeps = 0;
+        int Spins = 0;
+    };
+
+    struct FakePacer {
+        explicit FakePacer(const FramePacerSettings& settings, uint64_t startNs = 0) : Pacer(settings) {
+            auto clock = std::make_unique<FakeClock>(startNs);
+            Clock = clock.get();
+            Pacer.SetClock(std::move(clock));
+        }
+
+        // One loop iteration: the game works for workNs, then the pacer waits
+        float Frame(uint64_t workNs) {
+            const float dt = Pacer.BeginFrame();
+            Clock->Now += workNs;
+            Pacer.EndFrame();
+            return dt;
+        }
+
+        FramePacer Pacer;
+        FakeClock* Clock = nullptr;
+    };
+}
+
+TEST_CASE(FramePacer, LimiterHoldsTargetRate) {
+    FramePacerSettings settings;
+    settings.TargetFps = 100.0;
+    settings.SpinMs = 1.5;
+    settings.SmoothingFrames = 1;
+    FakePacer fake(settings);
+    fake.Clock->SleepOvershootNs = 1 * MS;
+
+    fake.Frame(3 * MS);
+    for (int i = 0; i < 50; ++i) {
+        const uint64_t start = fake.Clock->Now;
+        const float dt = fake.Frame(3 * MS);
+        CHECK_NEAR(dt, 0.010f, 0.00002f);
+
+        // Slept up to SpinMs before the deadline; the overshoot is absorbed by the spin
+        const uint64_t frameNs = fake.Clock->Now - start;
+        CHECK(frameNs >= 10 * MS);
+        CHECK(frameNs < 10 * MS + fake.Clock->SpinStepNs);
+    }
+    CHECK(fake.Clock->Sleeps == 51);
+    CHECK(fake.Clock->Spins > 0);
+    CHECK(fake.Pacer.GetStats().GetMaxMs() < 10.02);
+
+    // A frame longer than the period is not waited on at all
+    const int sleeps = fake.Clock->Sleeps;
+    const int spins = fake.Clock->Spins;
+    fake.Frame(25 * MS);
+    CHECK(fake.Clock->Sleeps == sleeps);
+    CHECK(fake.Clock->Spins == spins);
+
+    // Unlimited never waits
+    fake.Pacer.SetTargetFps(0.0);
+    fake.Frame(1 * MS);
+    CHECK(fake.Clock->Sleeps == sleeps);
+}
+
+TEST_CASE(FramePacer, TimestepClampAndSmoothing) {
+    FramePacerSettings settings;
+    settings.MaxTimestep = 0.1f;
+    settings.SmoothingFrames = 4;
+    FakePacer fake(settings);
+
+    // The first frame has nothing to measure against
+    CHECK(fake.Frame(10 * MS) == 0.0f);
+    for (int i = 0; i < 8; ++i)
+        CHECK_NEAR(fake.Frame(10 * MS), 0.010f, 1e-6f);
+
+    // A half-second hitch is clamped, then averaged over the window
+    CHECK_NEAR(fake.Frame(500 * MS), 0.010f, 1e-6f);
+    CHECK(fake.Pacer.GetRawFrameNs() == 10 * MS);
+    CHECK_NEAR(fake.Frame(10 * MS), (0.010f * 3.0f + 0.1f) / 4.0f, 1e-6f);
+    CHECK(fake.Pacer.GetRawFrameNs() == 500 * MS);
+    for (int i = 0; i < 3; ++i)
+        fake.Frame(10 * MS);
+    CHECK_NEAR(fake.Frame(10 * MS), 0.010f, 1e-6f);
+
+    // Without smoothing each frame gets its own clamped delta
+    settings.SmoothingFrames = 1;
+    fake.Pacer.SetSettings(settings);
+    fake.Frame(500 * MS);
+    CHECK_NEAR(fake.Frame(20 * MS), 0.1f, 1e-6f);
+    CHECK_NEAR(fake.Frame(20 * MS), 0.020f, 1e-6f);
+}
+
+TEST_CASE(FramePacer, StatisticsOfPacedFrames) {
+    FramePacerSettings settings;
+    FakePacer fake(settings);
+
+    fake.Frame(10 * MS);
+    for (int i = 0; i < 99; ++i)
+        fake.Frame(i == 50 ? 40 * MS : 10 * MS);
+    fake.Frame(10 * MS);
+
+    // 99 frames of 10 ms and one of 40 ms
+    const FrameStats& stats = fake.Pacer.GetStats();
+    CHECK(stats.GetSampleCount() == 100);
+    CHECK_NEAR(stats.GetAverageMs(), 10.3, 1e-9);
+    CHECK_NEAR(stats.GetMinMs(), 10.0, 1e-9);
+    CHECK_NEAR(stats.GetMaxMs(), 40.0, 1e-9);
+    CHECK_NEAR(stats.GetPercentileMs(50.0), 10.0, 1e-9);
+    CHECK_NEAR(stats.GetPercentileMs(99.0), 10.0, 1e-9);
+    CHECK_NEAR(stats.GetPercentileMs(100.0), 40.0, 1e-9);
+
+    const FrameStats::Histogram histogram = stats.GetHistogram();
+    CHECK(histogram[2] == 99);   // (8.4, 11.2]
+    CHECK(histogram[5] == 1);    // (33.4, 50]
+
+    // The window keeps the latest WINDOW frames only
+    for (size_t i = 0; i <= FrameStats::WINDOW; ++i)
+        fake.Frame(5 * MS);
+    CHECK(stats.GetSampleCount() == FrameStats::WINDOW);
+    CHECK_NEAR(stats.GetMaxMs(), 5.0, 1e-9);
+}
+
+TEST_CASE(FramePacer, ElapsedTimeKeepsPrecision) {
+    // A month of uptime: a float of seconds would be off by more than a frame
+    constexpr uint64_t MONTH_NS = 30ull * 24 * 3600 * 1000000000ull;
+    FramePacerSettings settings;
+    FakePacer fake(settings, MONTH_NS);
+
+    fake.Frame(16 * MS);
+    CHECK_NEAR(fake.Frame(16 * MS), 0.016f, 1e-6f);
+    CHECK(fake.Pacer.GetFrameIndex() == 2);
+    CHECK_NEAR(fake.Pacer.GetElapsedSeconds(), 0.032, 1e-12);
+}
@@ -0,0 +1,159 @@
+/**
+ * @file FramePipelineTests.cpp
+ * @brief Frame packet handoff between the simulation and render threads
+ * @details Packets are consumed by a NullRenderBackend, so production and
+ *          consumption are checked without a window or GL context.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "Graphics/FramePipeline.h"
+#include "Graphics/RenderBackend.h"
+#include "Graphics/RenderThread.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+    // Counts like NullRenderBackend, and also checks what each packet holds
+    class CheckingBackend : public NullRenderBackend {
+    public:
+        void render(const FramePacket& packet) override {
+            NullRenderBackend::render(packet);
+            if (packet.frame_index != m_Expected++) m_OutOfOrder = true;
+            for (const DrawItem& item : packet.draw_items) {
+                if (item.m_mesh_handle != static_cast<u32>(packet.frame_index)) m_Mismatched = true;
+            }
+            if (m_Delay.count() > 0) std::this_thread::sleep_for(m_Delay);
+        }
+
+        void SetDelay(std::chrono::microseconds delay) { m_Delay = delay; }
+        bool OutOfOrder() const { return m_OutOfOrder; }
+        bool Mismatched() const { return m_Mismatched; }
+
+    private:
+        u64 m_Expected = 0;
+        bool m_OutOfOrder = false;
+        bool m_Mismatched = false;
+        std::chrono::microseconds m_Delay{ 0 };
+    };
+
+    size_t DrawItemsOf(u64 frame) { return static_cast<size_t>(frame % 7); }
+
+    void Produce(FramePipeline& pipeline, u64 frames) {
+        for (u64 i = 0; i < frames; ++i) {
+            FramePacket* packet = pipeline.begin_write();
+            if (!packet) return;
+            for (size_t d = 0; d < DrawItemsOf(packet->frame_index); ++d)
+                packet->draw_items.push_back(DrawItem{ static_cast<u32>(packet->frame_index), 0u, 0u, glm::mat4(1.0f) });
+            pipeline.submit();
+        }
+    }
+}
+
+TEST_CASE(FramePipeline, HandoffOwnership) {
+    FramePipeline pipeline(2);
+    CHECK(pipeline.buffer_count() == 2);
+    CHECK(pipeline.try_acquire_read() == nullptr);
+
+    FramePacket* first = pipeline.begin_write();
+    CHECK(first != nullptr);
+    first->draw_items.resize(3);
+    pipeline.submit();
+
+    FramePacket* second = pipeline.begin_write();
+    CHECK(second != nullptr && second != first);
+    CHECK(second->draw_items.empty());
+    pipeline.submit();
+
+    // Oldest first; a packet being read is not handed to the producer
+    const FramePacket* read = pipeline.try_acquire_read();
+    CHECK(read == first);
+    CHECK(read->frame_index == 0);
+    CHECK(read->draw_items.size() == 3);
+    pipeline.release();
+
+    FramePacket* third = pipeline.begin_write();
+    CHECK(third == first);
+    CHECK(third->frame_index == 2);
+    CHECK(third->draw_items.empty());
+    pipeline.submit();
+
+    CHECK(pipeline.try_acquire_read() == second);
+    pipeline.release();
+    CHECK(pipeline.try_acquire_read() == third);
+    pipeline.release();
+    CHECK(pipeline.try_acquire_read() == nullptr);
+
+    // Once stopped, neither side waits
+    pipeline.stop();
+    CHECK(pipeline.begin_write() == nullptr);
+    CHECK(pipeline.acquire_read() == nullptr);
+
+    const FramePipelineStats stats = pipeline.stats();
+    CHECK(stats.submitted == 3);
+    CHECK(stats.consumed == 3);
+}
+
+TEST_CASE(FramePipeline, RenderThreadDrainsPackets) {
+    for (size_t buffers : { size_t(2), size_t(3) }) {
+        FramePipeline pipeline(buffers);
+        CheckingBackend backend;
+        RenderThread thread(pipeline, backend);
+        thread.start();
+
+        constexpr u64 FRAMES = 300;
+        Produce(pipeline, FRAMES);
+
+        // Stopping draws everything already submitted before joining
+        thread.stop();
+        CHECK(thread.frames_rendered() == FRAMES);
+        CHECK(backend.frames() == FRAMES);
+        CHECK(backend.last_frame() == FRAMES - 1);
+        CHECK(!backend.OutOfOrder());
+        CHECK(!backend.Mismatched());
+
+        u64 drawItems = 0;
+        for (u64 frame = 0; frame < FRAMES; ++frame)
+            drawItems += DrawItemsOf(frame);
+        CHECK(backend.draw_items() == drawItems);
+
+        const FramePipelineStats stats = pipeline.stats();
+        CHECK(stats.submitted == FRAMES);
+        CHECK(stats.consumed == FRAMES);
+    }
+}
+
+TEST_CASE(FramePipeline, SlowBackendThrottlesSimulation) {
+    FramePipeline pipeline(3);
+    CheckingBackend backend;
+    backend.SetDelay(std::chrono::microseconds(500));
+    RenderThread thread(pipeline, backend);
+    thread.start();
+
+    // The producer may run ahead by the spare buffers only, then has to wait
+    constexpr u64 FRAMES = 40;
+    u64 maxAhead = 0;
+    for (u64 i = 0; i < FRAMES; ++i) {
+        FramePacket* packet = pipeline.begin_write();
+        CHECK(packet != nullptr);
+        if (!packet) break;
+        const u64 rendered = thread.frames_rendered();
+        maxAhead = std::max(maxAhead, packet->frame_index - rendered);
+        pipeline.submit();
+    }
+    thread.stop();
+
+    CHECK(maxAhead <= pipeline.buffer_count());
+    CHECK(pipeline.stats().producer_waits > 0);
+    CHECK(backend.frames() == FRAMES);
+    CHECK(!backend.OutOfOrder());
+}
@@ -0,0 +1,81 @@
+/**
+ * @file HierarchyModelTests.cpp
+ * @brief Rows of the editor hierarchy as pooled instances are parked and re-spawned
+ * @details Pool toggles patch rows in place; the result must match a full rebuild.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "ECS/Components.h"
+#include "ECS/Scene.h"
+#include "Component/PooledComponent.h"
+#include "Editor/HierarchyModel.h"
+
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+    std::vector<entt::entity> Handles(const std::vector<HierarchyModel::Row>& rows) {
+        std::vector<entt::entity> handles;
+        for (const HierarchyModel::Row& row : rows)
+            handles.push_back(row.Handle);
+        return handles;
+    }
+
+    // What the model would show if it rebuilt from scratch
+    std::vector<entt::entity> Rebuilt(entt::registry& registry, const std::vector<entt::entity>& expanded) {
+        HierarchyModel fresh;
+        fresh.Attach(&registry);
+        for (entt::entity entity : expanded)
+            fresh.SetExpanded(entity, true);
+        std::vector<entt::entity> handles = Handles(fresh.GetRows());
+        fresh.Attach(nullptr);
+        return handles;
+    }
+}
+
+TEST_CASE(HierarchyModel, PoolTogglesMatchRebuild) {
+    Scene scene("HierarchyTest");
+    auto& registry = scene.GetRegistry();
+
+    Entity parent = scene.CreateEntity("Parent");
+    Entity child = scene.CreateEntity("Child");
+    child.GetComponent<TransformComponent>().Parent = parent;
+    parent.GetComponent<TransformComponent>().Children.push_back(child);
+
+    std::vector<Entity> pooled;
+    for (int i = 0; i < 6; ++i)
+        pooled.push_back(scene.CreateEntity("Bullet"));
+    const std::vector<entt::entity> expanded{ parent };
+
+    HierarchyModel model;
+    model.Attach(&registry);
+    model.SetExpanded(parent, true);
+    CHECK(model.GetRows().size() == 8);
+
+    // Park some, then release and re-spawn in the same frame like a busy pool
+    registry.emplace<InactiveComponent>(pooled[1]);
+    registry.emplace<InactiveComponent>(pooled[4]);
+    CHECK(Handles(model.GetRows()) == Rebuilt(registry, expanded));
+    CHECK(model.GetEntityCount() == 6);
+
+    registry.emplace<InactiveComponent>(pooled[0]);
+    registry.remove<InactiveComponent>(pooled[0]);
+    registry.remove<InactiveComponent>(pooled[4]);
+    CHECK(Handles(model.GetRows()) == Rebuilt(registry, expanded));
+    CHECK(model.GetEntityCount() == 7);
+
+    // Parking a parent re-roots its children, which takes a rebuild
+    registry.emplace<InactiveComponent>(parent);
+    CHECK(Handles(model.GetRows()) == Rebuilt(registry, expanded));
+    registry.remove<InactiveComponent>(parent);
+    registry.remove<InactiveComponent>(pooled[1]);
+    CHECK(Handles(model.GetRows()) == Rebuilt(registry, expanded));
+    CHECK(model.GetEntityCount() == 8);
+    model.Attach(nullptr);
+}
@@ -0,0 +1,155 @@
+/**
+ * @file InputTests.cpp
+ * @brief Input state built from events injected through SyntheticInputBackend
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "Core/Input.h"
+#include "Core/InputBackend.h"
+
+#include <GLFW/glfw3.h>
+
+#include <memory>
+
+using namespace Engine;
+
+namespace {
+    struct SyntheticInput {
+        SyntheticInput() {
+            auto owned = std::make_unique<SyntheticInputBackend>();
+            Backend = owned.get();
+            State.Init(std::move(owned));
+        }
+
+        Input State;
+        SyntheticInputBackend* Backend = nullptr;
+    };
+}
+
+TEST_CASE(Input, KeyTransitions) {
+    SyntheticInput input;
+    CHECK(!input.State.IsKeyPressed(GLFW_KEY_W));
+
+    input.Backend->PushKey(GLFW_KEY_W, true, 1.25);
+    CHECK(!input.State.IsKeyPressed(GLFW_KEY_W));   // Nothing applies before Update
+    input.State.Update();
+    CHECK(input.State.IsKeyPressed(GLFW_KEY_W));
+    CHECK(input.State.IsKeyJustPressed(GLFW_KEY_W));
+    CHECK(!input.State.IsKeyJustReleased(GLFW_KEY_W));
+    CHECK(input.State.GetKeyEventTime(GLFW_KEY_W) == 1.25);
+
+    // Held keys stay down, the transition lasts one frame
+    input.State.Update();
+    CHECK(input.State.IsKeyPressed(GLFW_KEY_W));
+    CHECK(!input.State.IsKeyJustPressed(GLFW_KEY_W));
+
+    // Repeats and duplicate presses change nothing
+    InputEvent repeat;
+    repeat.Type = InputEventType::Key;
+    repeat.Action = InputAction::Repeat;
+    repeat.Code = GLFW_KEY_W;
+    repeat.Timestamp = 1.5;
+    input.Backend->Push(repeat);
+    input.Backend->PushKey(GLFW_KEY_W, true, 1.6);
+    input.State.Update();
+    CHECK(!input.State.IsKeyJustPressed(GLFW_KEY_W));
+    CHECK(input.State.GetKeyEventTime(GLFW_KEY_W) == 1.25);
+    CHECK(input.State.GetFrameEventCount() == 2);
+
+    input.Backend->PushKey(GLFW_KEY_W, false, 2.0);
+    input.State.Update();
+    CHECK(!input.State.IsKeyPressed(GLFW_KEY_W));
+    CHECK(input.State.IsKeyJustReleased(GLFW_KEY_W));
+    CHECK(input.State.GetLastEventTime() == 2.0);
+
+    // Codes outside the table are ignored, not written out of bounds
+    input.Backend->PushKey(-1, true);
+    input.Backend->PushKey(Input::MAX_KEYS, true);
+    input.State.Update();
+    CHECK(!input.State.IsKeyPressed(-1));
+    CHECK(!input.State.IsKeyPressed(Input::MAX_KEYS));
+}
+
+TEST_CASE(Input, SubFramePressIsSeen) {
+    SyntheticInput input;
+
+    // Pressed and released between two updates: not held, but both transitions happened
+    input.Backend->PushKey(GLFW_KEY_SPACE, true, 0.010);
+    input.Backend->PushKey(GLFW_KEY_SPACE, false, 0.012);
+    input.Backend->PushMouseButton(GLFW_MOUSE_BUTTON_LEFT, true, 0.011);
+    input.Backend->PushMouseButton(GLFW_MOUSE_BUTTON_LEFT, false, 0.013);
+    input.State.Update();
+
+    CHECK(!input.State.IsKeyPressed(GLFW_KEY_SPACE));
+    CHECK(input.State.IsKeyJustPressed(GLFW_KEY_SPACE));
+    CHECK(input.State.IsKeyJustReleased(GLFW_KEY_SPACE));
+    CHECK(input.State.GetKeyEventTime(GLFW_KEY_SPACE) == 0.012);
+
+    CHECK(!input.State.IsMouseButtonPressed(GLFW_MOUSE_BUTTON_LEFT));
+    CHECK(input.State.IsMouseButtonJustPressed(GLFW_MOUSE_BUTTON_LEFT));
+    CHECK(input.State.IsMouseButtonJustReleased(GLFW_MOUSE_BUTTON_LEFT));
+    CHECK(input.State.GetMouseButtonEventTime(GLFW_MOUSE_BUTTON_LEFT) == 0.013);
+
+    // Events come out in the order they happened
+    const auto& events = input.State.GetFrameEvents();
+    CHECK(events.size() == 4);
+    CHECK(events[0].Timestamp == 0.010 && events[3].Timestamp == 0.013);
+
+    input.State.Update();
+    CHECK(!input.State.IsKeyJustPressed(GLFW_KEY_SPACE));
+    CHECK(!input.State.IsMouseButtonJustReleased(GLFW_MOUSE_BUTTON_LEFT));
+    CHECK(input.State.GetFrameEventCount() == 0);
+}
+
+TEST_CASE(Input, CursorAndScroll) {
+    SyntheticInput input;
+
+    // The first move only establishes the position
+    input.Backend->PushCursor(glm::vec2(100.0f, 50.0f));
+    input.State.Update();
+    CHECK(input.State.GetMousePosition() == glm::vec2(100.0f, 50.0f));
+    CHECK(input.State.GetMouseDelta() == glm::vec2(0.0f));
+
+    // Several moves in a frame add up to one delta; scroll accumulates
+    input.Backend->PushCursor(glm::vec2(110.0f, 45.0f));
+    input.Backend->PushCursor(glm::vec2(130.0f, 40.0f));
+    input.Backend->PushScroll(glm::vec2(0.0f, 1.0f));
+    input.Backend->PushScroll(glm::vec2(0.5f, 2.0f));
+    input.State.Update();
+    CHECK(input.State.GetMousePosition() == glm::vec2(130.0f, 40.0f));
+    CHECK(input.State.GetMouseDelta() == glm::vec2(30.0f, -10.0f));
+    CHECK(input.State.GetScrollDelta() == glm::vec2(0.5f, 3.0f));
+
+    input.State.Update();
+    CHECK(input.State.GetMouseDelta() == glm::vec2(0.0f));
+    CHECK(input.State.GetScrollDelta() == glm::vec2(0.0f));
+
+    // Warping the cursor is not a movement
+    input.State.SetCursorPosition(glm::vec2(400.0f, 300.0f));
+    input.State.Update();
+    CHECK(input.State.GetMousePosition() == glm::vec2(400.0f, 300.0f));
+    CHECK(input.State.GetMouseDelta() == glm::vec2(0.0f));
+}
+
+TEST_CASE(Input, FullQueueDropsNewEvents) {
+    SyntheticInput input;
+
+    for (size_t i = 0; i < InputEventQueue::CAPACITY + 10; ++i)
+        input.Backend->PushScroll(glm::vec2(0.0f, 1.0f));
+    CHECK(input.State.GetDroppedEventCount() == 10);
+
+    input.State.Update();
+    CHECK(input.State.GetFrameEventCount() == InputEventQueue::CAPACITY);
+    CHECK(input.State.GetScrollDelta().y == static_cast<float>(InputEventQueue::CAPACITY));
+
+    // A detached backend no longer reaches the queue
+    input.Backend->Detach();
+    input.Backend->PushKey(GLFW_KEY_A, true);
+    input.State.Update();
+    CHECK(!input.State.IsKeyPressed(GLFW_KEY_A));
+}
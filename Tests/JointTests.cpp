@@ -0,0 +1,184 @@
+/**
+ * @file JointTests.cpp
+ * @brief Headless checks of the JointComponent to Jolt constraint mapping, plus a
+ *        solver cost benchmark on 2000 joints
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "PhysicsTestScene.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Tests;
+
+namespace {
+    constexpr float LINK_SPACING = 0.5f;
+    const glm::vec3 LINK_HALF(0.1f);
+
+    Entity AddDynamicBox(PhysicsTestScene& scene, const glm::vec3& position, const glm::vec3& halfExtents, float mass = 1.0f) {
+        Entity entity = scene.AddBox("Body", position, halfExtents, false);
+        entity.GetComponent<RigidbodyComponent>().Mass = mass;
+        return entity;
+    }
+
+    // Links hang straight down from a world point; odd links use cone joints, even ones distance joints
+    std::vector<Entity> AddChain(PhysicsTestScene& scene, const glm::vec3& top, int links, bool mixed) {
+        std::vector<Entity> chain;
+        chain.reserve(links);
+        for (int i = 0; i < links; ++i) {
+            Entity link = AddDynamicBox(scene, top - glm::vec3(0.0f, LINK_SPACING * static_cast<float>(i + 1), 0.0f), LINK_HALF);
+            auto& joint = link.AddComponent<JointComponent>();
+            joint.Type = (mixed && i % 2 == 1) ? JointType::Cone : JointType::Distance;
+            if (joint.Type == JointType::Cone) {
+                joint.Anchor = glm::vec3(0.0f, LINK_SPACING, 0.0f);
+            }
+            if (i == 0) {
+                joint.ConnectedAnchor = top;
+            }
+            else {
+                joint.Connect(chain.back());
+            }
+            chain.push_back(link);
+        }
+        return chain;
+    }
+
+    glm::vec3 PositionOf(Entity entity) {
+        return entity.GetComponent<TransformComponent>().Position;
+    }
+}
+
+TEST_CASE(Joint, DistanceChainKeepsLinkLength) {
+    PhysicsTestScene scene;
+    std::vector<Entity> chain = AddChain(scene, glm::vec3(0.0f, 10.0f, 0.0f), 10, false);
+    chain.back().GetComponent<RigidbodyComponent>().Velocity = glm::vec3(5.0f, 0.0f, 0.0f);
+    scene.Initialize();
+    scene.Step(180);
+
+    CHECK(scene.GetPhysics().GetStats().Joints == 10);
+    CHECK_NEAR(glm::length(PositionOf(chain[0]) - glm::vec3(0.0f, 10.0f, 0.0f)), LINK_SPACING, 0.02f);
+    for (size_t i = 1; i < chain.size(); ++i) {
+        CHECK_NEAR(glm::length(PositionOf(chain[i]) - PositionOf(chain[i - 1])), LINK_SPACING, 0.02f);
+    }
+}
+
+TEST_CASE(Joint, HingeStaysWithinLimits) {
+    PhysicsTestScene scene;
+    Entity door = AddDynamicBox(scene, glm::vec3(0.0f, 1.2f, 0.0f), glm::vec3(0.5f, 1.0f, 0.05f));
+    auto& joint = door.AddComponent<JointComponent>();
+    joint.Type = JointType::Hinge;
+    joint.Anchor = glm::vec3(-0.5f, 0.0f, 0.0f);
+    joint.SetLimits(-90.0f, 0.0f);
+    scene.Initialize();
+
+    // Swing hard both ways; the hinge edge stays put and the yaw stays in [-90, 0]
+    for (float spin : { -6.0f, 6.0f }) {
+        door.GetComponent<RigidbodyComponent>().AngularVelocity = glm::vec3(0.0f, spin, 0.0f);
+        for (int frame = 0; frame < 90; ++frame) {
+            scene.Step(1);
+            const glm::quat rotation = door.GetComponent<TransformComponent>().Rotation;
+            const glm::vec3 across = rotation * glm::vec3(1.0f, 0.0f, 0.0f);
+            const float yaw = glm::degrees(std::atan2(-across.z, across.x));
+            CHECK(yaw > -92.0f && yaw < 2.0f);
+            CHECK_NEAR(glm::length(PositionOf(door) + rotation * joint.Anchor - glm::vec3(-0.5f, 1.2f, 0.0f)), 0.0f, 0.02f);
+        }
+    }
+}
+
+TEST_CASE(Joint, BreakForceBreaksOnlyWeakJoint) {
+    // 10 kg hangs with about 98 N: more than the weak joint holds, less than the strong one
+    PhysicsTestScene scene;
+    Entity weak = AddDynamicBox(scene, glm::vec3(-2.0f, 5.0f, 0.0f), glm::vec3(0.2f), 10.0f);
+    weak.AddComponent<JointComponent>().BreakForce = 50.0f;
+    Entity strong = AddDynamicBox(scene, glm::vec3(2.0f, 5.0f, 0.0f), glm::vec3(0.2f), 10.0f);
+    strong.AddComponent<JointComponent>().BreakForce = 500.0f;
+
+    std::vector<JointBreakEvent> breaks;
+    scene.GetPhysics().SetJointBreakCallback([&](Scene*, JointBreakEvent const& event) { breaks.push_back(event); });
+    scene.Initialize();
+    scene.Step(60);
+
+    CHECK(weak.GetComponent<JointComponent>().IsBroken);
+    CHECK(!strong.GetComponent<JointComponent>().IsBroken);
+    CHECK(breaks.size() == 1);
+    if (!breaks.empty()) {
+        CHECK(breaks[0].entity == static_cast<entt::entity>(weak));
+        CHECK(breaks[0].connected == entt::null);
+    }
+    CHECK(PositionOf(weak).y < 4.0f);
+    CHECK_NEAR(PositionOf(strong).y, 5.0f, 0.02f);
+    CHECK(scene.GetPhysics().GetStats().Joints == 1);
+
+    // Clearing IsBroken rebuilds the joint where the body is now
+    weak.GetComponent<JointComponent>().BreakForce = 0.0f;
+    weak.GetComponent<JointComponent>().IsBroken = false;
+    scene.Step(1);
+    const float rebuiltAt = PositionOf(weak).y;
+    scene.Step(60);
+    CHECK(scene.GetPhysics().GetStats().Joints == 2);
+    CHECK_NEAR(PositionOf(weak).y, rebuiltAt, 0.05f);
+}
+
+TEST_CASE(Joint, WaitsForConnectedBody) {
+    PhysicsTestScene scene;
+    // Registered as a box, but without a rigidbody until later
+    Entity anchor = scene.AddBox("Anchor", glm::vec3(0.0f, 5.0f, 0.0f), glm::vec3(0.1f), true);
+    anchor.RemoveComponent<RigidbodyComponent>();
+    Entity hanger = AddDynamicBox(scene, glm::vec3(0.0f, 4.0f, 0.0f), glm::vec3(0.2f));
+    auto& joint = hanger.AddComponent<JointComponent>();
+    joint.Type = JointType::Cone;
+    joint.Anchor = glm::vec3(0.0f, 1.0f, 0.0f);
+    joint.Connect(anchor);
+    scene.Initialize();
+    scene.Step(1);
+
+    CHECK(scene.GetPhysics().GetStats().PendingJoints == 1);
+    CHECK(scene.GetPhysics().GetStats().Joints == 0);
+
+    // Once the anchor gets a body the joint is built and holds the hanger
+    hanger.GetComponent<TransformComponent>().Position = glm::vec3(0.0f, 4.0f, 0.0f);
+    hanger.GetComponent<RigidbodyComponent>().Velocity = glm::vec3(0.0f);
+    anchor.AddComponent<RigidbodyComponent>().IsKinematic = true;
+    scene.Step(60);
+    CHECK(scene.GetPhysics().GetStats().PendingJoints == 0);
+    CHECK(scene.GetPhysics().GetStats().Joints == 1);
+    CHECK_NEAR(PositionOf(hanger).y, 4.0f, 0.05f);
+}
+
+BENCHMARK_CASE(Joint, Chains) {
+    // 2000 joints either as one long chain or as 100 chains of 20, all awake
+    struct Layout { int Chains; int Links; };
+    for (Layout layout : { Layout{ 1, 2000 }, Layout{ 100, 20 } }) {
+        PhysicsTestScene scene;
+        for (int c = 0; c < layout.Chains; ++c) {
+            const glm::vec3 top(static_cast<float>(c % 20) * 2.0f, 1000.0f, static_cast<float>(c / 20) * 2.0f);
+            std::vector<Entity> chain = AddChain(scene, top, layout.Links, true);
+            chain.back().GetComponent<RigidbodyComponent>().Velocity = glm::vec3(3.0f, 0.0f, 1.0f);
+        }
+        scene.Initialize();
+        scene.Step(1);
+
+        constexpr int FRAMES = 120;
+        double stepMs = 0.0;
+        Stopwatch timer;
+        for (int i = 0; i < FRAMES; ++i) {
+            scene.Step(1);
+            stepMs += scene.GetPhysics().GetStats().StepMs;
+        }
+        const double frameMs = timer.ElapsedMs() / FRAMES;
+
+        const PhysicsStats& stats = scene.GetPhysics().GetStats();
+        stepMs /= FRAMES;
+        std::printf("  %3d x %4d links: %u joints, %u bodies, frame %.3f ms, step %.3f ms, %.3f us/joint, peak step %.3f ms\n",
+            layout.Chains, layout.Links, stats.Joints, stats.Bodies, frameMs, stepMs,
+            stats.Joints > 0 ? stepMs * 1000.0 / stats.Joints : 0.0, stats.PeakStepMs);
+    }
+}
@@ -0,0 +1,236 @@
+/**
+ * @file NetworkTests.cpp
+ * @brief NetBuffer encoding, and server-to-client replication over LoopbackTransport
+ * @details The replication cases run a server Scene and a client Scene in the same
+ *          process, the way Game.cpp does with net.Loopback, and measure what the
+ *          delta encoding costs per entity record.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "ECS/Components.h"
+#include "ECS/Scene.h"
+#include "Component/ReplicatedComponent.h"
+#include "Network/NetBuffer.h"
+#include "Network/Replication.h"
+#include "Network/Transport.h"
+#include "Serialization/ComponentRegistry.h"
+
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+    // Registration is not idempotent; every suite using reflection shares this
+    void RegisterComponentsOnce() {
+        static const bool registered = (ComponentRegistry::RegisterAllComponents(), true);
+        (void)registered;
+    }
+
+    constexpr float FRAME = 1.0f / 60.0f;
+
+    struct LoopbackSession {
+        LoopbackSession(const ReplicationSettings& settings, float packetLoss = 0.0f)
+            : ServerScene("Server"), ClientScene("Client"), Server(settings) {
+            auto [serverEnd, clientEnd] = LoopbackTransport::CreatePair();
+            serverEnd->SetPacketLoss(packetLoss);
+            Server.AddConnection(std::move(serverEnd));
+            Client = std::make_unique<ReplicationClient>(std::move(clientEnd));
+        }
+
+        void Frame() {
+            Server.Update(&ServerScene, FRAME);
+            Client->Update(&ClientScene);
+        }
+
+        // Client-side copy of a server entity, null until it has been replicated
+        const TransformComponent* Mirror(Entity entity) {
+            const uint32_t netId = entity.GetComponent<ReplicatedComponent>().NetId;
+            const entt::entity mirrored = Client->FindEntity(netId);
+            return mirrored == entt::null ? nullptr : ClientScene.GetRegistry().try_get<TransformComponent>(mirrored);
+        }
+
+        Scene ServerScene;
+        Scene ClientScene;
+        ReplicationServer Server;
+        std::unique_ptr<ReplicationClient> Client;
+    };
+
+    std::vector<Entity> SpawnGrid(Scene& scene, int count) {
+        std::vector<Entity> entities;
+        for (int i = 0; i < count; ++i) {
+            Entity entity = scene.CreateEntity("Crate " + std::to_string(i));
+            entity.GetComponent<TransformComponent>().Position = glm::vec3(static_cast<float>(i % 8), 0.0f, static_cast<float>(i / 8));
+            entities.push_back(entity);
+        }
+        return entities;
+    }
+}
+
+TEST_CASE(Network, BufferRoundTrip) {
+    std::vector<uint8_t> packet;
+    NetWriter writer(packet);
+
+    const uint32_t unsignedValues[] = { 0u, 1u, 127u, 128u, 16383u, 16384u, 0x0FFFFFFFu, UINT_MAX };
+    const int32_t signedValues[] = { 0, -1, 1, -64, 64, INT_MIN, INT_MAX };
+    const uint8_t bytes[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0x00 };
+
+    writer.WriteU8(0xA5);
+    for (uint32_t value : unsignedValues) writer.WriteVarU32(value);
+    for (int32_t value : signedValues) writer.WriteVarI32(value);
+    writer.WriteU32(0x01020304u);
+    writer.WriteFloat(-3.25f);
+    writer.WriteBytes(bytes, sizeof(bytes));
+
+    NetReader reader(packet.data(), packet.size());
+    CHECK(reader.ReadU8() == 0xA5);
+    for (uint32_t value : unsignedValues) CHECK(reader.ReadVarU32() == value);
+    for (int32_t value : signedValues) CHECK(reader.ReadVarI32() == value);
+    CHECK(reader.ReadU32() == 0x01020304u);
+    CHECK(reader.ReadFloat() == -3.25f);
+    uint8_t readBack[sizeof(bytes)] = {};
+    CHECK(reader.ReadBytes(readBack, sizeof(readBack)));
+    CHECK(std::memcmp(readBack, bytes, sizeof(bytes)) == 0);
+    CHECK(reader.IsValid());
+    CHECK(reader.AtEnd());
+
+    // Varints grow 7 bits per byte; zigzag keeps small negatives small
+    std::vector<uint8_t> sized;
+    NetWriter sizer(sized);
+    sizer.WriteVarU32(127u);
+    CHECK(sizer.Size() == 1);
+    sizer.WriteVarU32(128u);
+    CHECK(sizer.Size() == 3);
+    sizer.WriteVarI32(-64);
+    CHECK(sizer.Size() == 4);
+    sizer.WriteVarU32(UINT_MAX);
+    CHECK(sizer.Size() == 9);
+}
+
+TEST_CASE(Network, BufferFailsOnOverrun) {
+    std::vector<uint8_t> packet;
+    NetWriter writer(packet);
+    writer.WriteU8(7);
+    writer.WriteVarU32(300u);
+
+    // Reading past the end fails once and every later read yields 0
+    {
+        NetReader reader(packet.data(), packet.size());
+        CHECK(reader.ReadU8() == 7);
+        CHECK(reader.ReadVarU32() == 300u);
+        CHECK(reader.IsValid());
+        CHECK(reader.ReadU32() == 0u);
+        CHECK(!reader.IsValid());
+        CHECK(reader.ReadU8() == 0);
+        CHECK(!reader.IsValid());
+    }
+
+    // A varint cut off by the end of the packet
+    {
+        NetReader reader(packet.data(), packet.size() - 1);
+        CHECK(reader.ReadU8() == 7);
+        CHECK(reader.ReadVarU32() == 0u);
+        CHECK(!reader.IsValid());
+    }
+
+    // A varint that never terminates within five bytes
+    {
+        const uint8_t malformed[] = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x01 };
+        NetReader reader(malformed, sizeof(malformed));
+        CHECK(reader.ReadVarU32() == 0u);
+        CHECK(!reader.IsValid());
+    }
+
+    // Blocks larger than what is left are not read partially
+    {
+        uint8_t out[4] = { 1, 1, 1, 1 };
+        NetReader reader(packet.data(), packet.size());
+        CHECK(!reader.ReadBytes(out, sizeof(out)));
+        CHECK(!reader.IsValid());
+        CHECK(out[0] == 1);
+    }
+}
+
+TEST_CASE(Network, LoopbackReplicatesMovement) {
+    RegisterComponentsOnce();
+    ReplicationSettings settings;
+    settings.SendRate = 60.0f;
+    LoopbackSession session(settings);
+
+    std::vector<Entity> entities = SpawnGrid(session.ServerScene, 32);
+    session.Frame();
+    session.Frame();
+    for (Entity entity : entities) {
+        const TransformComponent* mirror = session.Mirror(entity);
+        CHECK(mirror != nullptr);
+        if (mirror)
+            CHECK(glm::all(glm::lessThanEqual(glm::abs(mirror->Position - entity.GetComponent<TransformComponent>().Position), glm::vec3(0.001f))));
+    }
+
+    // Only a quarter of the entities move; the others cost nothing once acknowledged
+    const ReplicationStats before = session.Server.GetStats();
+    constexpr int FRAMES = 60;
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        for (size_t i = 0; i < entities.size(); i += 4)
+            entities[i].GetComponent<TransformComponent>().Position.y += 0.05f;
+        session.Frame();
+    }
+
+    const ReplicationStats& after = session.Server.GetStats();
+    const uint64_t records = after.TotalEntityRecords - before.TotalEntityRecords;
+    const uint64_t bytes = after.TotalBytes - before.TotalBytes;
+    CHECK(records == FRAMES * entities.size() / 4);
+    CHECK(records > 0 && bytes / records < 16);
+    std::printf("  loopback: %llu records, %.2f bytes per entity after the initial sync (%.2f overall)\n",
+        static_cast<unsigned long long>(records), records ? static_cast<double>(bytes) / static_cast<double>(records) : 0.0,
+        after.BytesPerEntity());
+
+    for (size_t i = 0; i < entities.size(); i += 4) {
+        const TransformComponent* mirror = session.Mirror(entities[i]);
+        CHECK(mirror != nullptr);
+        if (mirror)
+            CHECK_NEAR(mirror->Position.y, FRAMES * 0.05f, 0.002f);
+    }
+
+    // Destroying on the server removes the client's copy
+    const uint32_t netId = entities.back().GetComponent<ReplicatedComponent>().NetId;
+    session.ServerScene.DestroyEntity(entities.back());
+    session.Frame();
+    session.Frame();
+    CHECK(session.Client->FindEntity(netId) == entt::null);
+}
+
+TEST_CASE(Network, LoopbackRecoversFromPacketLoss) {
+    RegisterComponentsOnce();
+    ReplicationSettings settings;
+    settings.SendRate = 60.0f;
+    LoopbackSession session(settings, 0.3f);
+
+    std::vector<Entity> entities = SpawnGrid(session.ServerScene, 16);
+    for (int frame = 0; frame < 120; ++frame) {
+        for (Entity entity : entities)
+            entity.GetComponent<TransformComponent>().Position.x += 0.01f;
+        session.Frame();
+    }
+
+    // Once the world stops, the next snapshot that gets through settles the client
+    for (int frame = 0; frame < 30; ++frame)
+        session.Frame();
+
+    CHECK(session.Client->GetStats().PacketsDropped == 0u);
+    for (Entity entity : entities) {
+        const TransformComponent* mirror = session.Mirror(entity);
+        CHECK(mirror != nullptr);
+        if (mirror)
+            CHECK_NEAR(mirror->Position.x, entity.GetComponent<TransformComponent>().Position.x, 0.002f);
+    }
+}
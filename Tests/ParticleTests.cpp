@@ -0,0 +1,399 @@
+/**
+ * @file ParticleTests.cpp
+ * @brief Particle kernel checks (SSE against scalar, collisions, compaction, depth
+ *        order) and a one-million-particle frame cost benchmark
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "ECS/Components.h"
+#include "ECS/Scene.h"
+#include "Particles/ParticleKernels.h"
+#include "Particles/ParticleSystem.h"
+#include "Physics/PhysicsSystem.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Tests;
+
+namespace {
+    // Not a multiple of the SIMD width, so every kernel runs its scalar tail too
+    constexpr std::uint32_t COUNT = 1003;
+
+    ParticleSpawnParams Fountain() {
+        ParticleSpawnParams spawn;
+        spawn.Origin = glm::vec3(0.0f, 1.0f, 0.0f);
+        spawn.Radius = 0.5f;
+        spawn.Velocity = glm::vec3(0.0f, 2.0f, 0.0f);
+        spawn.Spread = 3.0f;
+        spawn.LifetimeMin = 0.5f;
+        spawn.LifetimeMax = 2.0f;
+        return spawn;
+    }
+
+    // Ground plane at y = 0, drag, bounces, fading orange to grey
+    ParticleSimParams Falling(const ParticlePlane* ground) {
+        ParticleSimParams sim;
+        sim.DeltaTime = 1.0f / 60.0f;
+        sim.Gravity = glm::vec3(0.0f, -9.81f, 0.0f);
+        sim.Drag = 0.3f;
+        sim.Planes = ground;
+        sim.PlaneCount = ground ? 1u : 0u;
+        sim.Restitution = 0.4f;
+        sim.StartColor = glm::vec4(1.0f, 0.5f, 0.0f, 1.0f);
+        sim.EndColor = glm::vec4(0.2f, 0.2f, 0.2f, 0.0f);
+        sim.StartSize = 0.1f;
+        sim.EndSize = 0.5f;
+        return sim;
+    }
+
+    void SpawnPool(ParticlePool& pool, std::uint32_t count, std::uint32_t seed) {
+        pool.Reserve(count);
+        pool.Count = count;
+        // Two ranges, the way spawn jobs split a pool
+        Particles::Spawn(pool, 0, count / 2, Fountain(), seed);
+        Particles::Spawn(pool, count / 2, count, Fountain(), seed);
+    }
+
+    bool IsAlive(const ParticlePool& pool, std::uint32_t i) {
+        return pool.Age[i] * pool.InvLifetime[i] < 1.0f;
+    }
+
+    float Depth(const glm::vec3& position, const glm::vec3& eye, const glm::vec3& forward) {
+        return glm::dot(forward, position - eye);
+    }
+
+    // Back to front within the sort's precision (a thousandth of the depth span)
+    bool IsFarToNear(const std::vector<float>& depths) {
+        if (depths.empty()) return true;
+        const auto [nearest, farthest] = std::minmax_element(depths.begin(), depths.end());
+        const float tolerance = 1e-3f * (*farthest - *nearest) + 1e-6f;
+        for (std::size_t i = 1; i < depths.size(); ++i) {
+            if (depths[i - 1] < depths[i] - tolerance) return false;
+        }
+        return true;
+    }
+
+    const glm::vec3 EYE(3.0f, 2.0f, 5.0f);
+    const glm::vec3 FORWARD = glm::normalize(-EYE);
+}
+
+TEST_CASE(Particles, SimdMatchesScalar) {
+    ParticlePool simd;
+    ParticlePool scalar;
+    SpawnPool(simd, COUNT, 7);
+    SpawnPool(scalar, COUNT, 7);
+
+    const ParticlePlane ground;
+    const ParticleSimParams sim = Falling(&ground);
+    for (int frame = 0; frame < 120; ++frame) {
+        // Start at 1 so the SIMD groups are misaligned with the pool
+        Particles::Simulate(simd, 1, COUNT, sim);
+        Particles::SimulateScalar(scalar, 1, COUNT, sim);
+    }
+
+    float maxDiff = 0.0f;
+    int maxColorDiff = 0;
+    for (std::uint32_t i = 0; i < COUNT; ++i) {
+        for (auto attribute : { &ParticlePool::PosX, &ParticlePool::PosY, &ParticlePool::PosZ, &ParticlePool::VelX,
+            &ParticlePool::VelY, &ParticlePool::VelZ, &ParticlePool::Age, &ParticlePool::Size }) {
+            maxDiff = std::max(maxDiff, std::fabs((simd.*attribute)[i] - (scalar.*attribute)[i]));
+        }
+        for (int channel = 0; channel < 4; ++channel) {
+            const int a = static_cast<int>((simd.Color[i] >> (8 * channel)) & 0xFFu);
+            const int b = static_cast<int>((scalar.Color[i] >> (8 * channel)) & 0xFFu);
+            maxColorDiff = std::max(maxColorDiff, std::abs(a - b));
+        }
+    }
+    CHECK(maxDiff < 1e-5f);
+    CHECK(maxColorDiff == 0);
+
+    // Particle 0 was outside every range
+    ParticlePool untouched;
+    SpawnPool(untouched, COUNT, 7);
+    CHECK(simd.PosY[0] == untouched.PosY[0]);
+    CHECK(simd.Age[0] == untouched.Age[0]);
+}
+
+TEST_CASE(Particles, SimulateStaysInItsRange) {
+    ParticlePool pool;
+    SpawnPool(pool, 16, 3);
+    const ParticlePool before = pool;
+
+    Particles::Simulate(pool, 3, 10, Falling(nullptr));
+    for (std::uint32_t i = 0; i < 16; ++i) {
+        const bool inRange = i >= 3 && i < 10;
+        CHECK((pool.Age[i] != before.Age[i]) == inRange);
+        CHECK((pool.PosY[i] != before.PosY[i]) == inRange);
+    }
+}
+
+TEST_CASE(Particles, BounceOffGroundPlane) {
+    ParticlePool pool;
+    SpawnPool(pool, COUNT, 11);
+    const ParticlePlane ground;
+    const ParticleSimParams sim = Falling(&ground);
+
+    std::uint32_t bounced = 0;
+    for (int frame = 0; frame < 120; ++frame) {
+        std::vector<float> velocityBefore(pool.VelY.begin(), pool.VelY.begin() + COUNT);
+        Particles::Simulate(pool, 0, COUNT, sim);
+        for (std::uint32_t i = 0; i < COUNT; ++i) {
+            CHECK(pool.PosY[i] >= -1e-5f);
+            bounced += (velocityBefore[i] < 0.0f && pool.VelY[i] > 0.0f) ? 1u : 0u;
+        }
+    }
+    CHECK(bounced > COUNT / 4);
+}
+
+TEST_CASE(Particles, CompactKeepsOnlyLiveParticles) {
+    ParticlePool pool;
+    SpawnPool(pool, COUNT, 5);
+    const ParticleSimParams sim = Falling(nullptr);
+    for (int frame = 0; frame < 60; ++frame) {
+        Particles::Simulate(pool, 0, COUNT, sim);
+    }
+
+    std::vector<float> live;
+    for (std::uint32_t i = 0; i < pool.Count; ++i) {
+        if (IsAlive(pool, i)) live.push_back(pool.InvLifetime[i]);
+    }
+    CHECK(!live.empty());
+    CHECK(live.size() < COUNT);
+
+    const std::uint32_t removed = Particles::Compact(pool);
+    CHECK(removed == COUNT - live.size());
+    CHECK(pool.Count == live.size());
+
+    // The same particles survive, only their slots change
+    std::vector<float> kept;
+    for (std::uint32_t i = 0; i < pool.Count; ++i) {
+        CHECK(IsAlive(pool, i));
+        kept.push_back(pool.InvLifetime[i]);
+    }
+    std::sort(live.begin(), live.end());
+    std::sort(kept.begin(), kept.end());
+    CHECK(live == kept);
+
+    CHECK(Particles::Compact(pool) == 0);
+}
+
+TEST_CASE(Particles, SortsBackToFront) {
+    ParticlePool pool;
+    SpawnPool(pool, COUNT, 9);
+    const ParticleSimParams sim = Falling(nullptr);
+
+    std::vector<ParticleInstance> instances(COUNT);
+    // Sorting again after the particles move keeps working off the previous frame's order
+    for (int frame = 0; frame < 3; ++frame) {
+        Particles::Simulate(pool, 0, pool.Count, sim);
+        Particles::SortBackToFront(pool, Particles::ComputeDepths(pool, 0, pool.Count, EYE, FORWARD));
+
+        std::vector<std::uint32_t> order(pool.Order.begin(), pool.Order.begin() + pool.Count);
+        std::vector<float> depths;
+        for (std::uint32_t i : order) depths.push_back(pool.Depth[i]);
+        CHECK(IsFarToNear(depths));
+
+        std::sort(order.begin(), order.end());
+        for (std::uint32_t i = 0; i < pool.Count; ++i) {
+            CHECK(order[i] == i);
+        }
+
+        Particles::WriteInstances(pool, pool.Order.data(), 0, pool.Count, instances.data());
+        depths.clear();
+        for (std::uint32_t k = 0; k < pool.Count; ++k) {
+            depths.push_back(Depth(instances[k].Position, EYE, FORWARD));
+        }
+        CHECK(IsFarToNear(depths));
+    }
+}
+
+TEST_CASE(Particles, RangeSortMatchesSingleRange) {
+    ParticlePool pool;
+    SpawnPool(pool, COUNT, 11);
+
+    // Uneven ranges, as a job split would give them
+    constexpr std::uint32_t RANGES = 3;
+    const std::uint32_t bounds[RANGES + 1] = { 0, 200, 650, COUNT };
+    ParticleDepthSpan span;
+    for (std::uint32_t r = 0; r < RANGES; ++r) {
+        span.Merge(Particles::ComputeDepths(pool, bounds[r], bounds[r + 1], EYE, FORWARD));
+    }
+
+    const std::uint32_t buckets = Particles::SortBucketCount(pool.Count);
+    std::vector<std::uint32_t> counts(RANGES * buckets, 0u);
+    for (std::uint32_t r = 0; r < RANGES; ++r) {
+        Particles::CountSortKeys(pool, bounds[r], bounds[r + 1], span, buckets, counts.data() + r * buckets);
+    }
+    Particles::PrefixSortCounts(counts.data(), buckets, RANGES);
+    for (std::uint32_t r = 0; r < RANGES; ++r) {
+        Particles::ScatterSortKeys(pool, bounds[r], bounds[r + 1], counts.data() + r * buckets);
+    }
+    const std::vector<std::uint32_t> ranged(pool.Order.begin(), pool.Order.begin() + pool.Count);
+
+    // Counting sort is stable, so both give the same order, not just an equally sorted one
+    Particles::SortBackToFront(pool, Particles::ComputeDepths(pool, 0, pool.Count, EYE, FORWARD));
+    CHECK(ranged == std::vector<std::uint32_t>(pool.Order.begin(), pool.Order.begin() + pool.Count));
+}
+
+TEST_CASE(Particles, ApplyOrderKeepsDrawOrder) {
+    ParticlePool pool;
+    SpawnPool(pool, COUNT, 13);
+
+    std::vector<ParticleInstance> before(COUNT);
+    Particles::SortBackToFront(pool, Particles::ComputeDepths(pool, 0, pool.Count, EYE, FORWARD));
+    Particles::WriteInstances(pool, pool.Order.data(), 0, pool.Count, before.data());
+    std::vector<float> velocities;
+    for (std::uint32_t k = 0; k < pool.Count; ++k) velocities.push_back(pool.VelY[pool.Order[k]]);
+
+    // The pool now reads in draw order, with every attribute moved together
+    Particles::ApplyOrder(pool);
+    std::vector<ParticleInstance> after(COUNT);
+    Particles::WriteInstances(pool, nullptr, 0, pool.Count, after.data());
+    for (std::uint32_t k = 0; k < pool.Count; ++k) {
+        CHECK(after[k].Position == before[k].Position);
+        CHECK(after[k].Size == before[k].Size);
+        CHECK(after[k].Color == before[k].Color);
+        CHECK(pool.VelY[k] == velocities[k]);
+    }
+
+    // Unmoved particles sort back into the same places
+    Particles::SortBackToFront(pool, Particles::ComputeDepths(pool, 0, pool.Count, EYE, FORWARD));
+    for (std::uint32_t k = 0; k < pool.Count; ++k) {
+        CHECK(pool.Order[k] == k);
+    }
+}
+
+TEST_CASE(Particles, DrawListBatchesEmitters) {
+    Scene scene("ParticleTest");
+    ParticleSystem* particles = scene.AddSystem<ParticleSystem>();
+
+    auto addEmitter = [&](const glm::vec3& position, bool additive) {
+        Entity entity = scene.CreateEntity("Emitter");
+        entity.GetComponent<TransformComponent>().WorldTransform = glm::translate(glm::mat4(1.0f), position);
+        auto& emitter = entity.AddComponent<ParticleEmitterComponent>();
+        emitter.MaxParticles = 4000;
+        emitter.Burst = 3000;
+        emitter.Rate = 600.0f;
+        emitter.Spread = 2.0f;
+        emitter.Additive = additive;
+        return entity;
+    };
+    addEmitter(glm::vec3(0.0f), false);
+    addEmitter(glm::vec3(4.0f, 0.0f, 0.0f), true);
+    scene.InitializeSystems();
+
+    const glm::mat4 view = glm::lookAt(EYE, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    ParticleDrawList list;
+    for (int frame = 0; frame < 30; ++frame) {
+        scene.OnUpdate(1.0f / 60.0f);
+        particles->BuildDrawList(&scene, view, list);
+    }
+
+    CHECK(list.Batches.size() == 2);
+    CHECK(particles->GetStats().Drawn == list.Instances.size());
+    std::uint32_t next = 0;
+    for (const ParticleBatch& batch : list.Batches) {
+        CHECK(batch.First == next);
+        next += batch.Count;
+
+        if (!batch.Additive) {
+            std::vector<float> depths;
+            for (std::uint32_t k = batch.First; k < batch.First + batch.Count; ++k) {
+                depths.push_back(Depth(list.Instances[k].Position, EYE, FORWARD));
+            }
+            CHECK(IsFarToNear(depths));
+        }
+    }
+    CHECK(next == list.Instances.size());
+    scene.ShutdownSystems();
+}
+
+BENCHMARK_CASE(Particles, MillionParticleFrame) {
+    constexpr std::uint32_t MILLION = 1u << 20;
+    constexpr int FRAMES = 12;
+
+    ParticlePool pool;
+    SpawnPool(pool, MILLION, 1);
+    const ParticlePlane ground;
+    const ParticleSimParams sim = Falling(&ground);
+    std::vector<ParticleInstance> instances(MILLION);
+
+    {
+        Stopwatch timer;
+        for (int i = 0; i < FRAMES; ++i) Particles::SimulateScalar(pool, 0, pool.Count, sim);
+        const double scalarMs = timer.ElapsedMs() / FRAMES;
+        timer.Restart();
+        for (int i = 0; i < FRAMES; ++i) Particles::Simulate(pool, 0, pool.Count, sim);
+        std::printf("  simulate 1M: scalar %.2f ms, Simulate %.2f ms (SSE %s)\n",
+            scalarMs, timer.ElapsedMs() / FRAMES, Particles::HasSimdParticles() ? "on" : "off");
+    }
+
+    // One emitter, one thread, steady state, reordered as often as the system does by default
+    constexpr int REORDER_INTERVAL = 4;
+    double simulateMs = 0.0, sortMs = 0.0, instancesMs = 0.0, reorderMs = 0.0;
+    for (int frame = 0; frame < FRAMES + 2; ++frame) {
+        Stopwatch timer;
+        Particles::Simulate(pool, 0, pool.Count, sim);
+        const double t0 = timer.ElapsedMs();
+        Particles::SortBackToFront(pool, Particles::ComputeDepths(pool, 0, pool.Count, EYE, FORWARD));
+        const double t1 = timer.ElapsedMs();
+        Particles::WriteInstances(pool, pool.Order.data(), 0, pool.Count, instances.data());
+        const double t2 = timer.ElapsedMs();
+        if (frame % REORDER_INTERVAL == 0) Particles::ApplyOrder(pool);
+        const double t3 = timer.ElapsedMs();
+        if (frame < 2) continue;
+        simulateMs += t0;
+        sortMs += t1 - t0;
+        instancesMs += t2 - t1;
+        reorderMs += t3 - t2;
+    }
+    std::printf("  1M particles, one thread: simulate %.2f, depth + sort %.2f, instances %.2f, reorder %.2f ms\n",
+        simulateMs / FRAMES, sortMs / FRAMES, instancesMs / FRAMES, reorderMs / FRAMES);
+
+    // 16 emitters of 64K through the system, one in four additive
+    Scene scene("ParticleBenchmark");
+    scene.AddSystem<PhysicsSystem>();
+    ParticleSystem* particles = scene.AddSystem<ParticleSystem>();
+    for (int i = 0; i < 16; ++i) {
+        Entity entity = scene.CreateEntity("Emitter");
+        entity.GetComponent<TransformComponent>().WorldTransform = glm::translate(glm::mat4(1.0f), glm::vec3(static_cast<float>(i), 0.0f, 0.0f));
+        auto& emitter = entity.AddComponent<ParticleEmitterComponent>();
+        emitter.MaxParticles = 65536;
+        emitter.Rate = 40000.0f;
+        emitter.Burst = 30000;
+        emitter.LifetimeMin = 2.0f;
+        emitter.LifetimeMax = 3.0f;
+        emitter.Collide = true;
+        emitter.Additive = i % 4 == 0;
+    }
+    scene.InitializeSystems();
+
+    const glm::mat4 view = glm::lookAt(EYE, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    ParticleDrawList list;
+    double systemSimulateMs = 0.0, systemDrawMs = 0.0;
+    int measured = 0;
+    for (int frame = 0; frame < 240; ++frame) {
+        scene.OnUpdate(1.0f / 60.0f);
+        particles->BuildDrawList(&scene, view, list);
+        if (frame < 180) continue;
+        systemSimulateMs += particles->GetStats().SimulateMs;
+        systemDrawMs += particles->GetStats().SortMs;
+        measured++;
+    }
+    const ParticleStats& stats = particles->GetStats();
+    std::printf("  system: %u emitters, %u alive, %u drawn, %u jobs: simulate %.2f ms, draw list %.2f ms\n",
+        stats.Emitters, stats.Alive, stats.Drawn, stats.Jobs, systemSimulateMs / measured, systemDrawMs / measured);
+    scene.ShutdownSystems();
+}
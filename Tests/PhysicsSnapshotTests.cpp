@@ -0,0 +1,157 @@
+/**
+ * @file PhysicsSnapshotTests.cpp
+ * @brief Physics state snapshots: the delta-compressed ring, rollback and the
+ *        determinism self-check
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "PhysicsTestScene.h"
+#include "Physics/PhysicsSnapshot.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Tests;
+
+namespace {
+    // A state whose size and content drift from frame to frame, like contacts do
+    std::vector<std::uint8_t> StateOf(std::uint64_t frame) {
+        std::vector<std::uint8_t> raw(200 + (frame % 5) * 3);
+        for (size_t i = 0; i < raw.size(); ++i)
+            raw[i] = static_cast<std::uint8_t>(i % 64 < 4 ? frame * 7 + i : i);
+        return raw;
+    }
+
+    void AddPile(PhysicsTestScene& scene, int count) {
+        scene.AddBox("Floor", glm::vec3(0.0f, -0.5f, 0.0f), glm::vec3(100.0f, 0.5f, 100.0f), true);
+        for (int i = 0; i < count; ++i) {
+            const glm::vec3 position(static_cast<float>(i % 20) * 1.5f - 15.0f, 0.5f + static_cast<float>(i / 400) * 1.2f,
+                static_cast<float>((i / 20) % 20) * 1.5f - 15.0f);
+            scene.AddBox("Crate", position, glm::vec3(0.5f), false, glm::vec3(0.0f, static_cast<float>(i * 17 % 90), 0.0f));
+        }
+    }
+}
+
+TEST_CASE(PhysicsSnapshot, WrappedRingStaysDecodable) {
+    PhysicsSnapshotRing ring;
+    ring.Reset(10, 4);
+    const PhysicsSnapshotTopology topology;
+
+    std::vector<std::uint8_t> raw;
+    for (std::uint64_t frame = 0; frame < 40; ++frame) {
+        ring.Push(frame, StateOf(frame), topology);
+
+        // Every frame the ring holds decodes, including deltas of overwritten keyframes
+        const std::uint64_t oldest = frame >= 9 ? frame - 9 : 0;
+        for (std::uint64_t stored = oldest; stored <= frame; ++stored) {
+            CHECK(ring.Has(stored));
+            CHECK(ring.Decode(stored, raw) != nullptr);
+            CHECK(raw == StateOf(stored));
+        }
+        if (oldest > 0)
+            CHECK(!ring.Has(oldest - 1));
+    }
+
+    PhysicsSnapshotStats stats;
+    ring.GetStats(stats);
+    CHECK(stats.Stored == 10);
+    CHECK(stats.Rebased > 0);
+
+    CHECK(stats.Keyframes >= 3);
+
+    // A rollback drops newer frames; pushing continues from there
+    ring.Push(35, StateOf(35), topology);
+    CHECK(!ring.Has(36));
+    CHECK(ring.Decode(30, raw) != nullptr);
+    CHECK(raw == StateOf(30));
+}
+
+TEST_CASE(PhysicsSnapshot, RestoreRewindsTheWorld) {
+    PhysicsTestScene scene;
+    AddPile(scene, 60);
+    Entity probe = scene.AddBox("Probe", glm::vec3(0.0f, 8.0f, 0.0f), glm::vec3(0.5f), false);
+    scene.Initialize();
+
+    // More frames than the ring holds, so the oldest ones went through a wrap
+    std::map<std::uint64_t, std::uint64_t> hashes;
+    std::map<std::uint64_t, glm::vec3> positions;
+    constexpr std::uint64_t FRAMES = 100;
+    for (std::uint64_t frame = 0; frame < FRAMES; ++frame) {
+        scene.Step(1);
+        CHECK(scene.GetPhysics().SaveState(frame));
+        hashes[frame] = scene.GetPhysics().ComputeStateHash();
+        positions[frame] = probe.GetComponent<TransformComponent>().Position;
+    }
+
+    const std::uint64_t oldest = FRAMES - scene.GetPhysics().GetSnapshotStats().Stored;
+    CHECK(!scene.GetPhysics().HasState(oldest - 1));
+    for (std::uint64_t frame = oldest; frame < FRAMES; ++frame)
+        CHECK(scene.GetPhysics().HasState(frame));
+
+    // Rewinding restores the bodies and the component mirror
+    const std::uint64_t target = oldest + 1;
+    CHECK(scene.GetPhysics().RestoreState(&scene.GetScene(), target));
+    CHECK(scene.GetPhysics().ComputeStateHash() == hashes[target]);
+    CHECK(probe.GetComponent<TransformComponent>().Position == positions[target]);
+
+    // Resimulating from there repeats the original run step for step
+    for (std::uint64_t frame = target + 1; frame < target + 20; ++frame) {
+        scene.Step(1);
+        CHECK(scene.GetPhysics().ComputeStateHash() == hashes[frame]);
+    }
+    CHECK(scene.GetPhysics().RestoreState(&scene.GetScene(), FRAMES - 1));
+    CHECK(scene.GetPhysics().ComputeStateHash() == hashes[FRAMES - 1]);
+}
+
+TEST_CASE(PhysicsSnapshot, DeterminismCheckPasses) {
+    PhysicsTestScene scene;
+    AddPile(scene, 200);
+    scene.Initialize();
+    scene.Step(10);
+
+    const std::uint64_t before = scene.GetPhysics().ComputeStateHash();
+    CHECK(scene.GetPhysics().CheckDeterminism(60, 1.0f / 60.0f));
+
+    // The check leaves no trace in the world
+    CHECK(scene.GetPhysics().ComputeStateHash() == before);
+}
+
+BENCHMARK_CASE(PhysicsSnapshot, Restore2kBodies) {
+    PhysicsTestScene scene;
+    AddPile(scene, 2000);
+    scene.Initialize();
+
+    constexpr std::uint64_t FRAMES = 64;
+    double saveMs = 0.0;
+    for (std::uint64_t frame = 0; frame < FRAMES; ++frame) {
+        scene.Step(1);
+        scene.GetPhysics().SaveState(frame);
+        saveMs += scene.GetPhysics().GetSnapshotStats().SaveMs;
+    }
+    const PhysicsSnapshotStats stats = scene.GetPhysics().GetSnapshotStats();
+
+    // Alternate between a keyframe and the delta furthest from its keyframe
+    constexpr int RESTORES = 40;
+    double restoreMs = 0.0, peakMs = 0.0;
+    for (int i = 0; i < RESTORES; ++i) {
+        const std::uint64_t frame = (i % 2) ? FRAMES - 1 : FRAMES - 8;
+        CHECK(scene.GetPhysics().RestoreState(&scene.GetScene(), frame));
+        const double ms = scene.GetPhysics().GetSnapshotStats().RestoreMs;
+        restoreMs += ms;
+        peakMs = std::max(peakMs, ms);
+    }
+
+    std::printf("  2000 bodies: state %zu bytes, last delta %zu bytes, ring %zu bytes for %u frames\n",
+        stats.LastRawBytes, stats.LastStoredBytes, stats.RingBytes, stats.Stored);
+    std::printf("  save %.3f ms, restore %.3f ms (peak %.3f ms)\n", saveMs / FRAMES, restoreMs / RESTORES, peakMs);
+    CHECK(restoreMs / RESTORES < 1000.0 / 60.0);
+}
@@ -0,0 +1,88 @@
+/**
+ * @file PhysicsTestScene.h
+ * @brief Headless scene with a PhysicsSystem and box colliders for physics tests
+ * @details Meshes are not loaded in tests, so bodies get their shape from a box
+ *          half extent registered per entity through the shape callback.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include "ECS/Components.h"
+#include "ECS/Entity.h"
+#include "ECS/Scene.h"
+#include "Physics/PhysicsSystem.h"
+
+#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+
+#include <string>
+#include <unordered_map>
+
+namespace Engine {
+
+    namespace Tests {
+
+        class PhysicsTestScene {
+        public:
+            PhysicsTestScene() : m_Scene("PhysicsTest") {
+                m_Physics = m_Scene.AddSystem<PhysicsSystem>();
+                m_Physics->SetMakeEntityShapeCallback(
+                    [this](Scene*, entt::entity entity, TransformComponent const&, RigidbodyComponent const&) -> JPH::Ref<JPH::Shape> {
+                        auto it = m_HalfExtents.find(entity);
+                        if (it == m_HalfExtents.end())
+                            return nullptr;
+                        return new JPH::BoxShape(ToJPHVec3(it->second));
+                    });
+            }
+
+            ~PhysicsTestScene() {
+                if (m_Initialized)
+                    m_Scene.ShutdownSystems();
+            }
+
+            PhysicsTestScene(const PhysicsTestScene&) = delete;
+            PhysicsTestScene& operator=(const PhysicsTestScene&) = delete;
+
+            /**
+             * @brief Box rigidbody; rotation in degrees
+             */
+            Entity AddBox(const std::string& name, const glm::vec3& position, const glm::vec3& halfExtents,
+                bool kinematic, const glm::vec3& rotationDeg = glm::vec3(0.0f)) {
+                Entity entity = m_Scene.CreateEntity(name);
+                auto& transform = entity.GetComponent<TransformComponent>();
+                transform.Position = position;
+                transform.SetRotation(rotationDeg);
+                entity.AddComponent<RigidbodyComponent>().IsKinematic = kinematic;
+                m_HalfExtents[entity] = halfExtents;
+                return entity;
+            }
+
+            /**
+             * @brief Call after the scene content is set up, before stepping
+             */
+            void Initialize() {
+                m_Scene.InitializeSystems();
+                m_Initialized = true;
+            }
+
+            void Step(int frames, float dt = 1.0f / 60.0f) {
+                for (int i = 0; i < frames; ++i)
+                    m_Scene.OnUpdate(dt);
+            }
+
+            Scene& GetScene() { return m_Scene; }
+            PhysicsSystem& GetPhysics() { return *m_Physics; }
+
+        private:
+            Scene m_Scene;
+            PhysicsSystem* m_Physics = nullptr;
+            std::unordered_map<entt::entity, glm::vec3> m_HalfExtents;
+            bool m_Initialized = false;
+        };
+    }
+
+} // namespace Engine
@@ -0,0 +1,159 @@
+/**
+ * @file PrefabTests.cpp
+ * @brief Property override storage of prefab instances, the prefab registry's
+ *        dependency index and change notifications, and pooled instance bodies
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "PhysicsTestScene.h"
+#include "Component/PrefabComponent.h"
+#include "Prefab/Prefab.h"
+#include "Prefab/PrefabRegistry.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Tests;
+
+namespace {
+    const uint32_t TAG = HashReflectionName("TagComponent");
+    const uint32_t TRANSFORM = HashReflectionName("TransformComponent");
+    const uint32_t NAME = HashReflectionName("Tag");
+    const uint32_t POSITION = HashReflectionName("Position");
+
+    void SetString(PrefabComponent& prefab, const std::string& value) {
+        prefab.SetPropertyOverride(TAG, NAME, PropertyType::String,
+            reinterpret_cast<const uint8_t*>(value.data()), static_cast<uint32_t>(value.size()));
+    }
+
+    void SetFloats(PrefabComponent& prefab, float x, float y, float z) {
+        const float value[3] = { x, y, z };
+        prefab.SetPropertyOverride(TRANSFORM, POSITION, PropertyType::Vec3,
+            reinterpret_cast<const uint8_t*>(value), sizeof(value));
+    }
+
+    std::string StringOf(const PrefabComponent& prefab) {
+        const auto* override = prefab.FindPropertyOverride(TAG, NAME);
+        return override ? std::string(prefab.OverrideData.begin() + override->Offset,
+            prefab.OverrideData.begin() + override->Offset + override->Size) : std::string();
+    }
+
+    std::shared_ptr<Prefab> MakePrefab(uint64_t guid, const std::string& name, const std::string& data) {
+        auto prefab = std::make_shared<Prefab>(PrefabType::Entity);
+        prefab->SetGUID(xresource::instance_guid{ guid });
+        prefab->SetName(name);
+        prefab->SetEntityData(data);
+        return prefab;
+    }
+
+    float FloatAt(const PrefabComponent& prefab, int lane) {
+        const auto* override = prefab.FindPropertyOverride(TRANSFORM, POSITION);
+        float value = 0.0f;
+        if (override)
+            std::memcpy(&value, prefab.OverrideData.data() + override->Offset + lane * sizeof(float), sizeof(float));
+        return value;
+    }
+}
+
+TEST_CASE(Prefab, OverrideDataStaysCompact) {
+    PrefabComponent prefab;
+    SetString(prefab, "Crate");
+    SetFloats(prefab, 1.0f, 2.0f, 3.0f);
+
+    // Typing a name one character at a time resizes the value on every edit
+    std::string name;
+    for (int i = 0; i < 200; ++i) {
+        name += static_cast<char>('a' + i % 26);
+        SetString(prefab, name);
+    }
+    CHECK(StringOf(prefab) == name);
+    CHECK(FloatAt(prefab, 2) == 3.0f);
+    CHECK(prefab.OverrideData.size() == name.size() + 3 * sizeof(float));
+
+    SetFloats(prefab, 4.0f, 5.0f, 6.0f);
+    CHECK(prefab.OverrideData.size() == name.size() + 3 * sizeof(float));
+
+    // Removing frees the bytes and keeps the other values where they can be found
+    CHECK(prefab.RemovePropertyOverride(TAG, NAME));
+    CHECK(!prefab.RemovePropertyOverride(TAG, NAME));
+    CHECK(prefab.OverrideData.size() == 3 * sizeof(float));
+    CHECK(FloatAt(prefab, 0) == 4.0f);
+    CHECK(FloatAt(prefab, 2) == 6.0f);
+
+    SetString(prefab, "Barrel");
+    CHECK(StringOf(prefab) == "Barrel");
+    CHECK(prefab.RemovePropertyOverride(TRANSFORM, POSITION));
+    CHECK(StringOf(prefab) == "Barrel");
+    CHECK(prefab.OverrideData.size() == 6);
+}
+
+TEST_CASE(Prefab, RegistrySkipsMalformedReferences) {
+    PrefabRegistry& registry = PrefabRegistry::Get();
+    registry.Clear();
+
+    registry.RegisterPrefab(MakePrefab(100, "Base", R"({"Components":{}})"));
+    registry.RegisterPrefab(MakePrefab(101, "Variant", R"({"Prefab":"100"})"));
+    registry.RegisterPrefab(MakePrefab(102, "Garbage", R"({"Prefab":"not a guid"})"));
+    registry.RegisterPrefab(MakePrefab(103, "Overflow", R"({"Prefab":"99999999999999999999999"})"));
+    registry.RegisterPrefab(MakePrefab(104, "Trailing", R"({"Prefab":"100x"})"));
+
+    const auto& dependents = registry.GetDependents(xresource::instance_guid{ 100 });
+    CHECK((dependents == std::vector<xresource::instance_guid>{ xresource::instance_guid{ 101 } }));
+    CHECK(registry.IsPrefabLoaded(xresource::instance_guid{ 102 }));
+    registry.Clear();
+}
+
+TEST_CASE(Prefab, ListenerRemovedDuringNotifyIsNotCalled) {
+    PrefabRegistry& registry = PrefabRegistry::Get();
+    registry.Clear();
+    registry.RegisterPrefab(MakePrefab(200, "Base", R"({"Components":{}})"));
+    registry.RegisterPrefab(MakePrefab(201, "Variant", R"({"Prefab":"200"})"));
+
+    // The first listener tears down the second, as destroying a Scene would
+    std::vector<xresource::instance_guid> first, second;
+    uint32_t secondHandle = 0;
+    const uint32_t firstHandle = registry.AddChangeListener([&](xresource::instance_guid guid) {
+        first.push_back(guid);
+        registry.RemoveChangeListener(secondHandle);
+    });
+    secondHandle = registry.AddChangeListener([&](xresource::instance_guid guid) { second.push_back(guid); });
+
+    registry.UpdatePrefab(MakePrefab(200, "Base", R"({"Components":{"TagComponent":{}}})"));
+    CHECK((first == std::vector<xresource::instance_guid>{ xresource::instance_guid{ 200 }, xresource::instance_guid{ 201 } }));
+    CHECK(second.empty());
+
+    registry.RemoveChangeListener(firstHandle);
+    registry.Clear();
+}
+
+TEST_CASE(Prefab, RespawnInSameFrameMovesBody) {
+    PhysicsTestScene scene;
+    scene.AddBox("Floor", glm::vec3(0.0f, -0.5f, 0.0f), glm::vec3(20.0f, 0.5f, 20.0f), true);
+    Entity crate = scene.AddBox("Crate", glm::vec3(0.0f, 0.25f, 0.0f), glm::vec3(0.25f), false);
+    crate.AddComponent<PooledComponent>().Generation = 1;
+    scene.Initialize();
+    scene.Step(30);
+    CHECK_NEAR(crate.GetComponent<TransformComponent>().Position.x, 0.0f, 0.01f);
+
+    // What PrefabPool does for a Release followed by a Spawn before the next step:
+    // the entity never stays inactive, only its generation and placement change
+    crate.GetComponent<TransformComponent>().Position = glm::vec3(5.0f, 3.0f, 0.0f);
+    crate.GetComponent<PooledComponent>().Generation++;
+    scene.Step(1);
+    const glm::vec3 position = crate.GetComponent<TransformComponent>().Position;
+    CHECK_NEAR(position.x, 5.0f, 0.01f);
+    CHECK(position.y > 2.9f);
+
+    // Lands at the new place and stays there
+    scene.Step(120);
+    CHECK_NEAR(crate.GetComponent<TransformComponent>().Position.x, 5.0f, 0.01f);
+    CHECK_NEAR(crate.GetComponent<TransformComponent>().Position.y, 0.25f, 0.02f);
+}
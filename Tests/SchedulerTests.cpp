@@ -0,0 +1,222 @@
+/**
+ * @file SchedulerTests.cpp
+ * @brief Firing order and cancellation semantics of the timer wheel
+ * @details The scheduler runs with a one-second tick so delays are exact tick counts.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "ECS/Scheduler.h"
+
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+    // One Update per tick, like one frame per tick
+    void RunTicks(Scheduler& scheduler, int ticks) {
+        for (int i = 0; i < ticks; ++i)
+            scheduler.Update(1.0f);
+    }
+}
+
+TEST_CASE(Scheduler, SameTickFiresInSchedulingOrder) {
+    Scheduler scheduler(1.0);
+    std::string order;
+
+    scheduler.After(3.0f, [&] { order += 'a'; });
+    scheduler.After(1.0f, [&] { order += 'b'; });
+    scheduler.After(3.0f, [&] { order += 'c'; });
+    scheduler.After(3.0f, [&] { order += 'd'; });
+
+    RunTicks(scheduler, 1);
+    CHECK(order == "b");
+    RunTicks(scheduler, 1);
+    CHECK(order == "b");
+    RunTicks(scheduler, 1);
+    CHECK(order == "bacd");
+}
+
+TEST_CASE(Scheduler, NeverFiresEarly) {
+    Scheduler scheduler(1.0);
+    int fired = 0;
+
+    // Delays round up to whole ticks
+    scheduler.After(2.5f, [&] { fired++; });
+    scheduler.Update(2.0f);
+    CHECK(fired == 0);
+    scheduler.Update(0.5f);
+    CHECK(fired == 0);
+    scheduler.Update(0.5f);
+    CHECK(fired == 1);
+
+    // Zero delay still waits for the next tick
+    scheduler.After(0.0f, [&] { fired++; });
+    CHECK(fired == 1);
+    scheduler.Update(1.0f);
+    CHECK(fired == 2);
+}
+
+TEST_CASE(Scheduler, CancelFromInsideFiringCallback) {
+    Scheduler scheduler(1.0);
+    std::string order;
+    TimerHandle second;
+    TimerHandle self;
+
+    scheduler.After(1.0f, [&] {
+        order += 'a';
+        // Same tick, later in the batch: must not run
+        CHECK(scheduler.Cancel(second));
+    });
+    second = scheduler.After(1.0f, [&] { order += 'b'; });
+    self = scheduler.After(1.0f, [&] {
+        order += 'c';
+        // Cancelling the running one-shot is allowed and reported once
+        CHECK(scheduler.Cancel(self));
+        CHECK(!scheduler.Cancel(self));
+    });
+
+    RunTicks(scheduler, 1);
+    CHECK(order == "ac");
+    CHECK(!scheduler.IsPending(second));
+    CHECK(!scheduler.IsPending(self));
+    CHECK(scheduler.GetStats().PendingTimers == 0);
+    CHECK(scheduler.GetStats().Cancelled == 2);
+}
+
+TEST_CASE(Scheduler, EveryRearmsUntilCancelled) {
+    Scheduler scheduler(1.0);
+    std::vector<double> times;
+    TimerHandle repeat;
+
+    repeat = scheduler.Every(2.0f, [&] {
+        times.push_back(scheduler.GetTime());
+        if (times.size() == 3)
+            scheduler.Cancel(repeat);
+    });
+
+    RunTicks(scheduler, 20);
+    CHECK(times.size() == 3);
+    if (times.size() == 3) {
+        CHECK(times[0] == 2.0);
+        CHECK(times[1] == 4.0);
+        CHECK(times[2] == 6.0);
+    }
+    CHECK(!scheduler.IsPending(repeat));
+
+    // First delay differs from the interval
+    int fired = 0;
+    TimerHandle early = scheduler.Every(5.0f, [&] { fired++; }, entt::null, 1.0f);
+    RunTicks(scheduler, 1);
+    CHECK(fired == 1);
+    RunTicks(scheduler, 4);
+    CHECK(fired == 1);
+    RunTicks(scheduler, 1);
+    CHECK(fired == 2);
+    CHECK_NEAR(scheduler.GetRemaining(early), 5.0f, 1e-4f);
+}
+
+TEST_CASE(Scheduler, OwnerDestroyCancels) {
+    entt::registry registry;
+    Scheduler scheduler(1.0);
+    scheduler.Connect(registry);
+
+    const entt::entity owner = registry.create();
+    const entt::entity other = registry.create();
+
+    int ownerCalls = 0;
+    int otherCalls = 0;
+    TimerHandle timer = scheduler.After(2.0f, [&] { ownerCalls++; }, owner);
+    scheduler.Every(1.0f, [&] { ownerCalls++; }, owner);
+    scheduler.NextFrame([&] { ownerCalls++; }, owner);
+    scheduler.EndOfFrame([&] { ownerCalls++; }, owner);
+    scheduler.After(2.0f, [&] { otherCalls++; }, other);
+
+    registry.destroy(owner);
+    CHECK(!scheduler.IsPending(timer));
+
+    RunTicks(scheduler, 3);
+    scheduler.FlushEndOfFrame();
+    CHECK(ownerCalls == 0);
+    CHECK(otherCalls == 1);
+    CHECK(scheduler.GetStats().Cancelled == 4);
+
+    // An entity destroying itself from its own timer cancels the rest of its calls
+    const entt::entity self = registry.create();
+    int selfCalls = 0;
+    scheduler.After(1.0f, [&] { selfCalls++; registry.destroy(self); }, self);
+    scheduler.After(1.0f, [&] { selfCalls++; }, self);
+    RunTicks(scheduler, 2);
+    CHECK(selfCalls == 1);
+
+    scheduler.Disconnect(registry);
+}
+
+TEST_CASE(Scheduler, CascadesAcrossLevelBoundaries) {
+    // 255 and 65535 are the last ticks of levels 0 and 1; 256 and 65536 the first of the next
+    const std::uint64_t delays[] = { 255, 256, 257, 511, 65535, 65536, 65537, 16777216 };
+
+    for (std::uint64_t start : { std::uint64_t(0), std::uint64_t(1), std::uint64_t(200), std::uint64_t(65500) }) {
+        for (std::uint64_t delay : delays) {
+            Scheduler scheduler(1.0);
+            // A pending timer makes the wheel walk to start tick by tick instead of skipping ahead
+            scheduler.After(static_cast<float>(start + 1), [] {});
+            scheduler.Update(static_cast<float>(start));
+
+            double firedAt = -1.0;
+            scheduler.After(static_cast<float>(delay), [&] { firedAt = scheduler.GetTime(); });
+
+            // Large steps are still walked tick by tick while timers are pending
+            scheduler.Update(static_cast<float>(delay - 1));
+            CHECK(firedAt < 0.0);
+            scheduler.Update(1.0f);
+            CHECK(firedAt == static_cast<double>(start + delay));
+        }
+    }
+}
+
+TEST_CASE(Scheduler, DeferredCallsRunOnTheirFrame) {
+    Scheduler scheduler(1.0);
+    std::string order;
+
+    scheduler.NextFrame([&] {
+        order += 'n';
+        // Scheduled while next-frame calls run: waits for the following Update
+        scheduler.NextFrame([&] { order += 'N'; });
+    });
+    scheduler.EndOfFrame([&] {
+        order += 'e';
+        scheduler.EndOfFrame([&] { order += 'E'; });
+    });
+
+    scheduler.FlushEndOfFrame();
+    CHECK(order == "e");
+    scheduler.Update(0.0f);
+    CHECK(order == "en");
+    scheduler.FlushEndOfFrame();
+    CHECK(order == "enE");
+    scheduler.Update(0.0f);
+    CHECK(order == "enEN");
+    CHECK(scheduler.GetStats().PendingDeferred == 0);
+}
+
+TEST_CASE(Scheduler, StaleHandlesAreRejected) {
+    Scheduler scheduler(1.0);
+    int fired = 0;
+
+    TimerHandle first = scheduler.After(1.0f, [&] { fired++; });
+    RunTicks(scheduler, 1);
+    CHECK(fired == 1);
+
+    // The freed node is reused; the old handle must not reach the new timer
+    TimerHandle second = scheduler.After(1.0f, [&] { fired += 10; });
+    CHECK(!scheduler.Cancel(first));
+    CHECK(scheduler.IsPending(second));
+    RunTicks(scheduler, 1);
+    CHECK(fired == 11);
+}
@@ -0,0 +1,91 @@
+/**
+ * @file TestFramework.h
+ * @brief Minimal headless test and benchmark registry for the engine
+ * @details Test cases register themselves at static-init time and are run by
+ *          TestMain.cpp. A failed CHECK reports and keeps going, so one run lists
+ *          every broken expectation of a case. Benchmarks use the same registry but
+ *          only run when asked for (--bench), since their cost depends on the machine.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace Engine {
+
+    namespace Tests {
+
+        using TestFunction = void (*)();
+
+        struct TestCase {
+            const char* Suite;
+            const char* Name;
+            TestFunction Function;
+            bool IsBenchmark;
+        };
+
+        /**
+         * @brief Every registered test and benchmark, in registration order
+         */
+        std::vector<TestCase>& GetTestCases();
+
+        /**
+         * @brief Record a failed expectation of the running case
+         */
+        void ReportFailure(const char* file, int line, const char* expression);
+
+        struct TestRegistrar {
+            TestRegistrar(const char* suite, const char* name, TestFunction function, bool isBenchmark) {
+                GetTestCases().push_back({ suite, name, function, isBenchmark });
+            }
+        };
+
+        /**
+         * @brief Wall-clock timer for benchmarks
+         */
+        class Stopwatch {
+        public:
+            Stopwatch() : m_Start(std::chrono::steady_clock::now()) {}
+
+            void Restart() { m_Start = std::chrono::steady_clock::now(); }
+
+            double ElapsedMs() const {
+                return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_Start).count();
+            }
+
+        private:
+            std::chrono::steady_clock::time_point m_Start;
+        };
+    }
+
+} // namespace Engine
+
+#define ENGINE_TEST_REGISTER(suite, name, isBenchmark)                                      \
+    static void suite##_##name();                                                           \
+    static ::Engine::Tests::TestRegistrar suite##_##name##_Registrar(#suite, #name, &suite##_##name, isBenchmark); \
+    static void suite##_##name()
+
+/// Define a test case, run by default
+#define TEST_CASE(suite, name) ENGINE_TEST_REGISTER(suite, name, false)
+
+/// Define a benchmark, run only with --bench
+#define BENCHMARK_CASE(suite, name) ENGINE_TEST_REGISTER(suite, name, true)
+
+#define CHECK(expression)                                                                   \
+    do {                                                                                    \
+        if (!(expression))                                                                  \
+            ::Engine::Tests::ReportFailure(__FILE__, __LINE__, #expression);                \
+    } while (0)
+
+#define CHECK_NEAR(a, b, tolerance)                                                         \
+    do {                                                                                    \
+        if (!(std::fabs(static_cast<double>(a) - static_cast<double>(b)) <= static_cast<double>(tolerance))) \
+            ::Engine::Tests::ReportFailure(__FILE__, __LINE__, #a " ~= " #b);               \
+    } while (0)
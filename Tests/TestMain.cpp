@@ -0,0 +1,100 @@
+/**
+ * @file TestMain.cpp
+ * @brief Entry point of the headless engine tests
+ * @details Usage: EngineTests [--bench] [Suite | Suite.Name]...
+ *          Without a filter every test runs. --bench runs the benchmarks instead.
+ *          Returns non-zero if any check failed, so ctest picks it up.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "Utility/Logger.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace Engine {
+
+    namespace Tests {
+
+        namespace {
+            int s_Failures = 0;
+        }
+
+        std::vector<TestCase>& GetTestCases() {
+            static std::vector<TestCase> cases;
+            return cases;
+        }
+
+        void ReportFailure(const char* file, int line, const char* expression) {
+            std::printf("  FAILED %s(%d): %s\n", file, line, expression);
+            s_Failures++;
+        }
+
+        namespace {
+            bool Matches(const TestCase& test, const std::vector<std::string>& filters) {
+                if (filters.empty())
+                    return true;
+
+                const std::string suite = test.Suite;
+                const std::string full = suite + "." + test.Name;
+                for (const std::string& filter : filters) {
+                    if (filter == suite || filter == full)
+                        return true;
+                }
+                return false;
+            }
+        }
+    }
+
+} // namespace Engine
+
+int main(int argc, char** argv) {
+    using namespace Engine::Tests;
+
+    bool benchmarks = false;
+    std::vector<std::string> filters;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--bench") == 0)
+            benchmarks = true;
+        else
+            filters.emplace_back(argv[i]);
+    }
+
+    // Expected warnings from the code under test would drown the report
+    Engine::Logger::Get().SetLogLevel(Engine::LogLevel::Error);
+
+    int run = 0;
+    int failedCases = 0;
+    for (const TestCase& test : GetTestCases()) {
+        if (test.IsBenchmark != benchmarks || !Matches(test, filters))
+            continue;
+
+        std::printf("[ RUN  ] %s.%s\n", test.Suite, test.Name);
+        std::fflush(stdout);
+
+        const int before = s_Failures;
+        Stopwatch timer;
+        test.Function();
+        const double ms = timer.ElapsedMs();
+
+        const bool passed = s_Failures == before;
+        std::printf("[ %s ] %s.%s (%.1f ms)\n", passed ? " OK " : "FAIL", test.Suite, test.Name, ms);
+        run++;
+        if (!passed)
+            failedCases++;
+    }
+
+    if (run == 0) {
+        std::printf("No %s matched\n", benchmarks ? "benchmarks" : "tests");
+        return 1;
+    }
+
+    std::printf("%d %s, %d failed\n", run, benchmarks ? "benchmarks" : "tests", failedCases);
+    return failedCases == 0 ? 0 : 1;
+}
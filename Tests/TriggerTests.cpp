@@ -0,0 +1,106 @@
+/**
+ * @file TriggerTests.cpp
+ * @brief Trigger enter, stay and exit events of PhysicsSystem, and its per-thread
+ *        sensor buffers across recreated job systems
+ * @details A 0.5 m dynamic box is dropped from 6 m through a trigger hanging in the
+ *          air and comes to rest inside a second trigger sitting on the floor.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "PhysicsTestScene.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Tests;
+
+namespace {
+    class TriggerScene : public PhysicsTestScene {
+    public:
+        TriggerScene() {
+            AddBox("Floor", glm::vec3(0.0f, -0.5f, 0.0f), glm::vec3(20.0f, 0.5f, 20.0f), true);
+            m_Box = AddBox("Box", glm::vec3(0.0f, 6.0f, 0.0f), glm::vec3(0.25f), false);
+            m_Air = AddTrigger("Air", glm::vec3(0.0f, 3.0f, 0.0f));
+            m_Ground = AddTrigger("Ground", glm::vec3(0.0f, 0.5f, 0.0f));
+            GetPhysics().SetTriggerCallback([this](Scene*, const TriggerEvent& event) { m_Events.push_back(event); });
+        }
+
+        Entity AddTrigger(const std::string& name, const glm::vec3& position) {
+            Entity entity = GetScene().CreateEntity(name);
+            entity.GetComponent<TransformComponent>().Position = position;
+            entity.AddComponent<TriggerComponent>().HalfExtents = glm::vec3(1.0f, 0.5f, 1.0f);
+            return entity;
+        }
+
+        int Count(Entity trigger, TriggerEventType type) const {
+            int count = 0;
+            for (const TriggerEvent& event : m_Events)
+                if (event.trigger == static_cast<entt::entity>(trigger) && event.type == type) {
+                    CHECK(event.other == static_cast<entt::entity>(m_Box));
+                    count++;
+                }
+            return count;
+        }
+
+        std::uint32_t Overlaps(Entity trigger) { return trigger.GetComponent<TriggerComponent>().OverlapCount; }
+
+        Entity m_Box, m_Air, m_Ground;
+        std::vector<TriggerEvent> m_Events;
+    };
+}
+
+TEST_CASE(Trigger, EnterStayExit) {
+    TriggerScene scene;
+    scene.Initialize();
+
+    // Falling 6 m takes about 1.1 s; the air trigger spans y = 2.5 to 3.5
+    bool wasInside = false;
+    for (int frame = 0; frame < 120 && !scene.Count(scene.m_Air, TriggerEventType::Exit); ++frame) {
+        scene.Step(1);
+        wasInside = wasInside || scene.Overlaps(scene.m_Air) == 1u;
+    }
+    CHECK(wasInside);
+    CHECK(scene.Count(scene.m_Air, TriggerEventType::Enter) == 1);
+    CHECK(scene.Count(scene.m_Air, TriggerEventType::Exit) == 1);
+    CHECK(scene.Overlaps(scene.m_Air) == 0u);
+
+    // Resting in the ground trigger, even once asleep: one enter and no exit
+    scene.Step(300);
+    CHECK(scene.m_Box.GetComponent<TransformComponent>().Position.y < 0.5f);
+    CHECK(scene.Count(scene.m_Ground, TriggerEventType::Enter) == 1);
+    CHECK(scene.Count(scene.m_Ground, TriggerEventType::Exit) == 0);
+    CHECK(scene.Overlaps(scene.m_Ground) == 1u);
+
+    // Knocked out sideways, which also wakes it
+    scene.m_Box.GetComponent<RigidbodyComponent>().Velocity = glm::vec3(6.0f, 3.0f, 0.0f);
+    scene.Step(60);
+    CHECK(scene.m_Box.GetComponent<TransformComponent>().Position.x > 2.0f);
+    CHECK(scene.Count(scene.m_Ground, TriggerEventType::Exit) == 1);
+    CHECK(scene.Overlaps(scene.m_Ground) == 0u);
+    CHECK(scene.Count(scene.m_Air, TriggerEventType::Enter) == 1);
+}
+
+TEST_CASE(Trigger, RecreatedWorldsReuseThreadBuffers) {
+    // Every scene brings its own job system and worker threads, more of them in
+    // total than there are sensor buffers
+    const std::uint32_t threads = std::max(1u, std::thread::hardware_concurrency()) + 1u;
+    for (int i = 0; i < 80; ++i) {
+        TriggerScene scene;
+        scene.Initialize();
+        scene.Step(120);
+        CHECK(scene.Count(scene.m_Air, TriggerEventType::Enter) == 1);
+        CHECK(scene.Count(scene.m_Air, TriggerEventType::Exit) == 1);
+        CHECK(scene.Overlaps(scene.m_Ground) == 1u);
+
+        const std::uint32_t buffers = scene.GetPhysics().GetStats().SensorThreadBuffers;
+        CHECK(buffers >= 1u);
+        CHECK(buffers <= threads);
+    }
+}
@@ -0,0 +1,200 @@
+/**
+ * @file WorldStreamingTests.cpp
+ * @brief World partitioning and cell streaming along a scripted camera path
+ * @details A grid of entities is partitioned to a temporary directory, then
+ *          streamed back into a fresh scene while a camera flies across it.
+ *          Residency is checked every frame against the streaming policy.
+ * @author
+ * @date 2025
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "TestFramework.h"
+#include "ECS/Components.h"
+#include "ECS/Scene.h"
+#include "Serialization/ComponentRegistry.h"
+#include "World/WorldPartitionBuilder.h"
+#include "World/WorldStreamer.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+    // Registration is not idempotent; every suite using reflection shares this
+    void RegisterComponentsOnce() {
+        static const bool registered = (ComponentRegistry::RegisterAllComponents(), true);
+        (void)registered;
+    }
+
+    constexpr float CELL_SIZE = 64.0f;
+    constexpr int GRID = 16;            // Entities per side, 16 units apart: 4x4 cells of 16
+    constexpr float SPACING = 16.0f;
+
+    std::string WorldDirectory() {
+        return (std::filesystem::temp_directory_path() / "EngineTests_World").string();
+    }
+
+    bool BuildWorld(WorldManifest& manifest) {
+        RegisterComponentsOnce();
+        Scene source("StreamingSource");
+        for (int z = 0; z < GRID; ++z) {
+            for (int x = 0; x < GRID; ++x) {
+                Entity entity = source.CreateEntity("Rock");
+                entity.GetComponent<TransformComponent>().Position =
+                    glm::vec3(x * SPACING + 1.0f, 0.0f, z * SPACING + 1.0f);
+            }
+        }
+        std::filesystem::remove_all(WorldDirectory());
+        return WorldPartitionBuilder::Build(&source, WorldDirectory(), CELL_SIZE, &manifest);
+    }
+
+    size_t StreamedEntities(Scene& scene) {
+        return scene.GetRegistry().view<TransformComponent>().size();
+    }
+
+    // Checks what must hold after any Update, and returns the entities loaded cells should hold
+    size_t CheckResidency(const WorldStreamer& streamer, const glm::vec3& focus) {
+        const WorldManifest& manifest = streamer.GetManifest();
+        const WorldStreamingSettings& settings = streamer.GetSettings();
+        size_t expected = 0;
+        for (size_t i = 0; i < manifest.Cells.size(); ++i) {
+            const float distance = manifest.Cells[i].DistanceXZ(focus, manifest.CellSize);
+            const WorldStreamer::CellState state = streamer.GetCellState(i);
+            if (distance > settings.UnloadRadius)
+                CHECK(state == WorldStreamer::CellState::Unloaded || state == WorldStreamer::CellState::Unloading);
+            if (distance <= settings.LoadRadius)
+                CHECK(state != WorldStreamer::CellState::Unloaded && state != WorldStreamer::CellState::Unloading);
+            if (state == WorldStreamer::CellState::Loaded)
+                expected += manifest.Cells[i].EntityCount;
+        }
+        return expected;
+    }
+
+    std::vector<glm::vec3> CameraPath() {
+        // Diagonally across the world and back along one edge
+        std::vector<glm::vec3> path;
+        for (int i = 0; i <= 120; ++i)
+            path.push_back(glm::vec3(-40.0f + i * 2.5f, 10.0f, -40.0f + i * 2.5f));
+        for (int i = 0; i <= 120; ++i)
+            path.push_back(glm::vec3(260.0f - i * 2.5f, 10.0f, 20.0f));
+        return path;
+    }
+}
+
+TEST_CASE(WorldStreaming, PartitionCoversScene) {
+    WorldManifest manifest;
+    CHECK(BuildWorld(manifest));
+    CHECK(manifest.Cells.size() == 16);
+
+    uint32_t total = 0;
+    for (const WorldCellInfo& cell : manifest.Cells) {
+        CHECK(cell.EntityCount == 16);
+        CHECK(std::filesystem::exists(std::filesystem::path(WorldDirectory()) / cell.File));
+        total += cell.EntityCount;
+    }
+    CHECK(total == GRID * GRID);
+}
+
+TEST_CASE(WorldStreaming, ScriptedCameraPath) {
+    WorldManifest built;
+    CHECK(BuildWorld(built));
+
+    Scene scene("Streamed");
+    WorldStreamer streamer;
+    WorldStreamingSettings settings;
+    settings.LoadRadius = 40.0f;
+    settings.UnloadRadius = 70.0f;
+    settings.WorkerCount = 0;
+    settings.FrameBudgetMs = 0.0;       // Only the guaranteed entities each frame
+    settings.MinEntitiesPerFrame = 6;
+    streamer.SetSettings(settings);
+    CHECK(streamer.Open(&scene, WorldDirectory()));
+    CHECK(StreamedEntities(scene) == 0);
+
+    uint32_t peakLoaded = 0;
+    bool sawPartialCell = false;
+    for (const glm::vec3& focus : CameraPath()) {
+        streamer.Update(focus);
+        const WorldStreamingStats& stats = streamer.GetStats();
+
+        // Registry work is sliced: never more than the guaranteed batch per frame
+        CHECK(stats.EntitiesCreated + stats.EntitiesDestroyed <= settings.MinEntitiesPerFrame);
+        sawPartialCell |= stats.PendingCells > 0;
+        peakLoaded = std::max(peakLoaded, stats.LoadedCells);
+
+        const size_t expected = CheckResidency(streamer, focus);
+        if (stats.PendingCells == 0)
+            CHECK(StreamedEntities(scene) == expected);
+    }
+    CHECK(sawPartialCell);
+    CHECK(peakLoaded > 1 && peakLoaded < built.Cells.size());
+
+    // Once settled at the end of the path, only the nearby cells are in, each complete
+    const glm::vec3 end = CameraPath().back();
+    streamer.Flush(end);
+    CHECK(streamer.GetStats().PendingCells == 0);
+    const size_t expected = CheckResidency(streamer, end);
+    CHECK(expected > 0);
+    CHECK(StreamedEntities(scene) == expected);
+
+    // Streamed entities sit in the cell they were loaded with
+    for (entt::entity handle : scene.GetRegistry().view<TransformComponent>()) {
+        const int32_t cell = streamer.FindCellOf(handle);
+        CHECK(cell >= 0);
+        if (cell >= 0) {
+            const glm::vec3 position = scene.GetRegistry().get<TransformComponent>(handle).Position;
+            CHECK(CellCoord::FromPosition(position, CELL_SIZE) == built.Cells[cell].Coord);
+        }
+    }
+
+    // Flying away empties the world; coming back loads the same cells again
+    streamer.Flush(glm::vec3(5000.0f, 0.0f, 5000.0f));
+    CHECK(StreamedEntities(scene) == 0);
+    CHECK(streamer.GetStats().LoadedCells == 0);
+    streamer.Flush(end);
+    CHECK(StreamedEntities(scene) == expected);
+
+    streamer.Close();
+    CHECK(StreamedEntities(scene) == 0);
+}
+
+TEST_CASE(WorldStreaming, WorkersMatchInlineLoading) {
+    WorldManifest built;
+    CHECK(BuildWorld(built));
+
+    // Same path with background parsing; where the camera stops decides what is loaded
+    std::vector<WorldStreamer::CellState> inlineStates;
+    for (uint32_t workers : { 0u, 2u }) {
+        Scene scene("Streamed");
+        WorldStreamer streamer;
+        WorldStreamingSettings settings;
+        settings.LoadRadius = 40.0f;
+        settings.UnloadRadius = 70.0f;
+        settings.WorkerCount = workers;
+        streamer.SetSettings(settings);
+        CHECK(streamer.Open(&scene, WorldDirectory()));
+
+        for (const glm::vec3& focus : CameraPath()) {
+            streamer.Update(focus);
+            CheckResidency(streamer, focus);
+        }
+        streamer.Flush(CameraPath().back());
+
+        std::vector<WorldStreamer::CellState> states;
+        for (size_t i = 0; i < built.Cells.size(); ++i)
+            states.push_back(streamer.GetCellState(i));
+        if (workers == 0)
+            inlineStates = states;
+        else
+            CHECK(states == inlineStates);
+        CHECK(StreamedEntities(scene) == CheckResidency(streamer, CameraPath().back()));
+    }
+
+    std::filesystem::remove_all(WorldDirectory());
+}